@@ -24,18 +24,8 @@
 using namespace aeron;
 using namespace aeron::archive::client;
 
-static aeron::controlled_poll_fragment_handler_t controlHandler(ControlResponsePoller &poller)
-{
-    return
-        [&](AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
-        {
-            return poller.onFragment(buffer, offset, length, header);
-        };
-}
-
 ControlResponsePoller::ControlResponsePoller(std::shared_ptr<Subscription> subscription, int fragmentLimit) :
-    m_fragmentAssembler(controlHandler(*this)),
-    m_fragmentHandler(m_fragmentAssembler.handler()),
+    m_fragmentAssembler(FragmentHandler{ *this }),
     m_subscription(std::move(subscription)),
     m_fragmentLimit(fragmentLimit)
 {
@@ -72,7 +72,7 @@ public:
             m_isPollComplete = false;
         }
 
-        return m_subscription->controlledPoll(m_fragmentHandler, m_fragmentLimit);
+        return m_subscription->controlledPoll(m_fragmentAssembler, m_fragmentLimit);
     }
 
     /**
@@ -248,8 +248,18 @@ public:
     ControlledPollAction onFragment(AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header);
 
 private:
-    ControlledFragmentAssembler m_fragmentAssembler;
-    controlled_poll_fragment_handler_t m_fragmentHandler;
+    struct FragmentHandler
+    {
+        ControlResponsePoller &m_poller;
+
+        inline ControlledPollAction operator()(
+            AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+        {
+            return m_poller.onFragment(buffer, offset, length, header);
+        }
+    };
+
+    TypedControlledFragmentAssembler<FragmentHandler> m_fragmentAssembler;
     std::shared_ptr<Subscription> m_subscription;
     const int m_fragmentLimit;
 
@@ -282,6 +282,11 @@ inline static void aeron_async_cmd_free(aeron_client_registering_resource_t *asy
             aeron_free((void *)async->counter.label_buffer);
         }
 
+        if (AERON_CLIENT_TYPE_BATCH == async->type)
+        {
+            aeron_free(async->batch.array);
+        }
+
         aeron_free(async);
     }
 }
@@ -660,6 +665,265 @@ int aeron_async_add_counter_poll(aeron_counter_t **counter, aeron_async_add_coun
     }
 }
 
+int aeron_async_batch_create(aeron_async_batch_t **async, aeron_t *client)
+{
+    if (NULL == async || NULL == client)
+    {
+        AERON_SET_ERR(
+            EINVAL,
+            "Parameters must not be null, async: %s, client: %s",
+            AERON_NULL_STR(async),
+            AERON_NULL_STR(client));
+        return -1;
+    }
+
+    return aeron_client_conductor_async_batch_create(async, &client->conductor);
+}
+
+int aeron_async_batch_add_publication(
+    aeron_async_add_publication_t **async, aeron_async_batch_t *batch, const char *uri, int32_t stream_id)
+{
+    if (NULL == async || NULL == batch || NULL == uri)
+    {
+        AERON_SET_ERR(
+            EINVAL,
+            "Parameters must not be null, async: %s, batch: %s, uri: %s",
+            AERON_NULL_STR(async),
+            AERON_NULL_STR(batch),
+            AERON_NULL_STR(uri));
+        return -1;
+    }
+
+    return aeron_client_conductor_async_batch_add_publication(async, batch, uri, stream_id);
+}
+
+int aeron_async_batch_add_exclusive_publication(
+    aeron_async_add_exclusive_publication_t **async, aeron_async_batch_t *batch, const char *uri, int32_t stream_id)
+{
+    if (NULL == async || NULL == batch || NULL == uri)
+    {
+        AERON_SET_ERR(
+            EINVAL,
+            "Parameters must not be null, async: %s, batch: %s, uri: %s",
+            AERON_NULL_STR(async),
+            AERON_NULL_STR(batch),
+            AERON_NULL_STR(uri));
+        return -1;
+    }
+
+    return aeron_client_conductor_async_batch_add_exclusive_publication(async, batch, uri, stream_id);
+}
+
+int aeron_async_batch_add_subscription(
+    aeron_async_add_subscription_t **async,
+    aeron_async_batch_t *batch,
+    const char *uri,
+    int32_t stream_id,
+    aeron_on_available_image_t on_available_image_handler,
+    void *on_available_image_clientd,
+    aeron_on_unavailable_image_t on_unavailable_image_handler,
+    void *on_unavailable_image_clientd)
+{
+    if (NULL == async || NULL == batch || NULL == uri)
+    {
+        AERON_SET_ERR(
+            EINVAL,
+            "Parameters must not be null, async: %s, batch: %s, uri: %s",
+            AERON_NULL_STR(async),
+            AERON_NULL_STR(batch),
+            AERON_NULL_STR(uri));
+        return -1;
+    }
+
+    return aeron_client_conductor_async_batch_add_subscription(
+        async,
+        batch,
+        uri,
+        stream_id,
+        on_available_image_handler,
+        on_available_image_clientd,
+        on_unavailable_image_handler,
+        on_unavailable_image_clientd);
+}
+
+int aeron_async_batch_add_counter(
+    aeron_async_add_counter_t **async,
+    aeron_async_batch_t *batch,
+    int32_t type_id,
+    const uint8_t *key_buffer,
+    size_t key_buffer_length,
+    const char *label_buffer,
+    size_t label_buffer_length)
+{
+    if (NULL == async || NULL == batch)
+    {
+        AERON_SET_ERR(
+            EINVAL,
+            "Parameters must not be null, async: %s, batch: %s",
+            AERON_NULL_STR(async),
+            AERON_NULL_STR(batch));
+        return -1;
+    }
+
+    return aeron_client_conductor_async_batch_add_counter(
+        async, batch, type_id, key_buffer, key_buffer_length, label_buffer, label_buffer_length);
+}
+
+int aeron_async_batch_close_publication(
+    aeron_async_batch_t *batch,
+    aeron_publication_t *publication,
+    aeron_notification_t on_close_complete,
+    void *on_close_complete_clientd)
+{
+    if (NULL == batch || NULL == publication)
+    {
+        AERON_SET_ERR(
+            EINVAL,
+            "Parameters must not be null, batch: %s, publication: %s",
+            AERON_NULL_STR(batch),
+            AERON_NULL_STR(publication));
+        return -1;
+    }
+
+    return aeron_client_conductor_async_batch_close_publication(
+        batch, publication, on_close_complete, on_close_complete_clientd);
+}
+
+int aeron_async_batch_close_exclusive_publication(
+    aeron_async_batch_t *batch,
+    aeron_exclusive_publication_t *publication,
+    aeron_notification_t on_close_complete,
+    void *on_close_complete_clientd)
+{
+    if (NULL == batch || NULL == publication)
+    {
+        AERON_SET_ERR(
+            EINVAL,
+            "Parameters must not be null, batch: %s, publication: %s",
+            AERON_NULL_STR(batch),
+            AERON_NULL_STR(publication));
+        return -1;
+    }
+
+    return aeron_client_conductor_async_batch_close_exclusive_publication(
+        batch, publication, on_close_complete, on_close_complete_clientd);
+}
+
+int aeron_async_batch_close_subscription(
+    aeron_async_batch_t *batch,
+    aeron_subscription_t *subscription,
+    aeron_notification_t on_close_complete,
+    void *on_close_complete_clientd)
+{
+    if (NULL == batch || NULL == subscription)
+    {
+        AERON_SET_ERR(
+            EINVAL,
+            "Parameters must not be null, batch: %s, subscription: %s",
+            AERON_NULL_STR(batch),
+            AERON_NULL_STR(subscription));
+        return -1;
+    }
+
+    return aeron_client_conductor_async_batch_close_subscription(
+        batch, subscription, on_close_complete, on_close_complete_clientd);
+}
+
+int aeron_async_batch_close_counter(
+    aeron_async_batch_t *batch,
+    aeron_counter_t *counter,
+    aeron_notification_t on_close_complete,
+    void *on_close_complete_clientd)
+{
+    if (NULL == batch || NULL == counter)
+    {
+        AERON_SET_ERR(
+            EINVAL,
+            "Parameters must not be null, batch: %s, counter: %s",
+            AERON_NULL_STR(batch),
+            AERON_NULL_STR(counter));
+        return -1;
+    }
+
+    return aeron_client_conductor_async_batch_close_counter(
+        batch, counter, on_close_complete, on_close_complete_clientd);
+}
+
+int aeron_async_batch_submit(aeron_async_batch_t *batch)
+{
+    if (NULL == batch || AERON_CLIENT_TYPE_BATCH != batch->type)
+    {
+        AERON_SET_ERR(EINVAL, "aeron_async_batch_submit: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    return aeron_client_conductor_async_batch_submit(batch);
+}
+
+int aeron_async_batch_poll(aeron_async_batch_t *batch)
+{
+    if (NULL == batch || AERON_CLIENT_TYPE_BATCH != batch->type)
+    {
+        AERON_SET_ERR(EINVAL, "aeron_async_batch_poll: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    aeron_client_registration_status_t registration_status;
+    AERON_GET_VOLATILE(registration_status, batch->registration_status);
+
+    switch (registration_status)
+    {
+        case AERON_CLIENT_AWAITING_MEDIA_DRIVER:
+        {
+            return 0;
+        }
+
+        case AERON_CLIENT_ERRORED_MEDIA_DRIVER:
+        {
+            AERON_SET_ERR(
+                -batch->error_code,
+                "async_batch registration\n== Driver Error ==\n%.*s",
+                (int)batch->error_message_length,
+                batch->error_message);
+            aeron_async_cmd_free(batch);
+            return -1;
+        }
+
+        case AERON_CLIENT_REGISTERED_MEDIA_DRIVER:
+        {
+            const int32_t failed_count = batch->batch.failed_count;
+            const size_t entry_count = batch->batch.length;
+            aeron_async_cmd_free(batch);
+
+            if (failed_count > 0)
+            {
+                AERON_SET_ERR(
+                    EINVAL,
+                    "async_batch %" PRId32 " of %" PRIu64 " operations failed",
+                    failed_count,
+                    (uint64_t)entry_count);
+                return -1;
+            }
+
+            return 1;
+        }
+
+        case AERON_CLIENT_TIMEOUT_MEDIA_DRIVER:
+        {
+            AERON_SET_ERR(AERON_CLIENT_ERROR_DRIVER_TIMEOUT, "%s", "async_batch no response from media driver");
+            aeron_async_cmd_free(batch);
+            return -1;
+        }
+
+        default:
+        {
+            AERON_SET_ERR(EINVAL, "async_batch async status %s", "unknown");
+            aeron_async_cmd_free(batch);
+            return -1;
+        }
+    }
+}
+
 static int aeron_async_destination_poll(aeron_async_destination_t *async)
 {
     if (NULL == async)
@@ -352,6 +352,22 @@ void aeron_client_conductor_on_driver_response(int32_t type_id, uint8_t *buffer,
             break;
         }
 
+        case AERON_RESPONSE_ON_BATCH_COMPLETE:
+        {
+            aeron_batch_complete_t *response = (aeron_batch_complete_t *)buffer;
+
+            if (length < sizeof(aeron_batch_complete_t) ||
+                response->result_count < 0 ||
+                length <
+                (sizeof(aeron_batch_complete_t) + ((size_t)response->result_count * sizeof(aeron_batch_result_t))))
+            {
+                goto malformed_command;
+            }
+
+            result = aeron_client_conductor_on_batch_complete(conductor, response);
+            break;
+        }
+
         default:
         {
 
@@ -653,6 +669,7 @@ void aeron_client_conductor_delete_resource(void *clientd, int64_t key, void *va
 
         case AERON_CLIENT_TYPE_LOGBUFFER:
         case AERON_CLIENT_TYPE_DESTINATION:
+        case AERON_CLIENT_TYPE_BATCH:
             break;
     }
 }
@@ -724,6 +741,7 @@ void aeron_client_conductor_force_close_resource(void *clientd, int64_t key, voi
 
         case AERON_CLIENT_TYPE_LOGBUFFER:
         case AERON_CLIENT_TYPE_DESTINATION:
+        case AERON_CLIENT_TYPE_BATCH:
             break;
     }
 }
@@ -822,6 +840,86 @@ int aeron_client_conductor_linger_or_delete_all_images(
     return 0;
 }
 
+static void aeron_client_conductor_add_registering_resource(
+    aeron_client_conductor_t *conductor, aeron_client_registering_resource_t *async, const char *name)
+{
+    int ensure_capacity_result = 0;
+
+    AERON_ARRAY_ENSURE_CAPACITY(
+        ensure_capacity_result, conductor->registering_resources, aeron_client_registering_resource_entry_t)
+    if (ensure_capacity_result < 0)
+    {
+        char err_buffer[AERON_MAX_PATH];
+
+        snprintf(err_buffer, sizeof(err_buffer) - 1, "%s registering_resources: %s", name, aeron_errmsg());
+        conductor->error_handler(conductor->error_handler_clientd, aeron_errcode(), err_buffer);
+        return;
+    }
+
+    conductor->registering_resources.array[conductor->registering_resources.length++].resource = async;
+    async->registration_deadline_ns = (long long)(conductor->nano_clock() + conductor->driver_timeout_ns);
+}
+
+static void aeron_client_conductor_encode_publication_command(
+    aeron_client_conductor_t *conductor, aeron_client_registering_resource_t *async, uint8_t *ptr)
+{
+    aeron_publication_command_t *command = (aeron_publication_command_t *)ptr;
+    command->correlated.correlation_id = async->registration_id;
+    command->correlated.client_id = conductor->client_id;
+    command->stream_id = async->stream_id;
+    command->channel_length = async->uri_length;
+    memcpy(ptr + sizeof(aeron_publication_command_t), async->uri, (size_t)async->uri_length);
+}
+
+static void aeron_client_conductor_encode_subscription_command(
+    aeron_client_conductor_t *conductor, aeron_client_registering_resource_t *async, uint8_t *ptr)
+{
+    aeron_subscription_command_t *command = (aeron_subscription_command_t *)ptr;
+    command->correlated.correlation_id = async->registration_id;
+    command->correlated.client_id = conductor->client_id;
+    command->stream_id = async->stream_id;
+    command->channel_length = async->uri_length;
+    memcpy(ptr + sizeof(aeron_subscription_command_t), async->uri, (size_t)async->uri_length);
+}
+
+static size_t aeron_client_conductor_counter_command_length(aeron_client_registering_resource_t *async)
+{
+    return sizeof(aeron_counter_command_t) +
+        sizeof(int32_t) +
+        (size_t)(AERON_ALIGN(async->counter.key_buffer_length, sizeof(int32_t))) +
+        sizeof(int32_t) +
+        (size_t)async->counter.label_buffer_length;
+}
+
+static void aeron_client_conductor_encode_counter_command(
+    aeron_client_conductor_t *conductor, aeron_client_registering_resource_t *async, uint8_t *ptr)
+{
+    aeron_counter_command_t *command = (aeron_counter_command_t *)ptr;
+    char *cursor = (char *)(ptr + sizeof(aeron_counter_command_t));
+
+    command->correlated.correlation_id = async->registration_id;
+    command->correlated.client_id = conductor->client_id;
+    command->type_id = async->counter.type_id;
+
+    memcpy(cursor, &async->counter.key_buffer_length, sizeof(int32_t));
+    cursor += sizeof(int32_t);
+    memcpy(cursor, async->counter.key_buffer, (size_t)async->counter.key_buffer_length);
+    cursor += AERON_ALIGN(async->counter.key_buffer_length, sizeof(int32_t));
+    memcpy(cursor, &async->counter.label_buffer_length, sizeof(int32_t));
+    cursor += sizeof(int32_t);
+    memcpy(cursor, async->counter.label_buffer, (size_t)async->counter.label_buffer_length);
+}
+
+static void aeron_client_conductor_encode_remove_command(
+    aeron_client_conductor_t *conductor, int64_t correlation_id, int64_t registration_id, uint8_t *ptr)
+{
+    aeron_remove_command_t *command = (aeron_remove_command_t *)ptr;
+
+    command->correlated.correlation_id = correlation_id;
+    command->correlated.client_id = conductor->client_id;
+    command->registration_id = registration_id;
+}
+
 void aeron_client_conductor_on_cmd_add_publication(void *clientd, void *item)
 {
     aeron_client_conductor_t *conductor = (aeron_client_conductor_t *)clientd;
@@ -829,7 +927,7 @@ void aeron_client_conductor_on_cmd_add_publication(void *clientd, void *item)
 
     const size_t command_length = sizeof(aeron_publication_command_t) + async->uri_length;
 
-    int ensure_capacity_result = 0, rb_offer_fail_count = 0;
+    int rb_offer_fail_count = 0;
 
     int32_t offset;
     while ((offset = aeron_mpsc_rb_try_claim(
@@ -850,29 +948,11 @@ void aeron_client_conductor_on_cmd_add_publication(void *clientd, void *item)
         sched_yield();
     }
 
-    uint8_t *ptr = (conductor->to_driver_buffer.buffer + offset);
-    aeron_publication_command_t *command = (aeron_publication_command_t *)ptr;
-    command->correlated.correlation_id = async->registration_id;
-    command->correlated.client_id = conductor->client_id;
-    command->stream_id = async->stream_id;
-    command->channel_length = async->uri_length;
-    memcpy(ptr + sizeof(aeron_publication_command_t), async->uri, (size_t)async->uri_length);
-
+    aeron_client_conductor_encode_publication_command(
+        conductor, async, conductor->to_driver_buffer.buffer + offset);
     aeron_mpsc_rb_commit(&conductor->to_driver_buffer, offset);
 
-    AERON_ARRAY_ENSURE_CAPACITY(
-        ensure_capacity_result, conductor->registering_resources, aeron_client_registering_resource_entry_t)
-    if (ensure_capacity_result < 0)
-    {
-        char err_buffer[AERON_MAX_PATH];
-
-        snprintf(err_buffer, sizeof(err_buffer) - 1, "publication registering_resources: %s", aeron_errmsg());
-        conductor->error_handler(conductor->error_handler_clientd, aeron_errcode(), err_buffer);
-        return;
-    }
-
-    conductor->registering_resources.array[conductor->registering_resources.length++].resource = async;
-    async->registration_deadline_ns = (long long)(conductor->nano_clock() + conductor->driver_timeout_ns);
+    aeron_client_conductor_add_registering_resource(conductor, async, "publication");
 }
 
 void aeron_client_conductor_on_cmd_close_publication(void *clientd, void *item)
@@ -900,7 +980,7 @@ void aeron_client_conductor_on_cmd_add_exclusive_publication(void *clientd, void
 
     const size_t command_length = sizeof(aeron_publication_command_t) + async->uri_length;
 
-    int ensure_capacity_result = 0, rb_offer_fail_count = 0;
+    int rb_offer_fail_count = 0;
 
     int32_t offset;
     while ((offset = aeron_mpsc_rb_try_claim(
@@ -921,29 +1001,11 @@ void aeron_client_conductor_on_cmd_add_exclusive_publication(void *clientd, void
         sched_yield();
     }
 
-    uint8_t *ptr = (conductor->to_driver_buffer.buffer + offset);
-    aeron_publication_command_t *command = (aeron_publication_command_t *)ptr;
-    command->correlated.correlation_id = async->registration_id;
-    command->correlated.client_id = conductor->client_id;
-    command->stream_id = async->stream_id;
-    command->channel_length = async->uri_length;
-    memcpy(ptr + sizeof(aeron_publication_command_t), async->uri, (size_t)async->uri_length);
-
+    aeron_client_conductor_encode_publication_command(
+        conductor, async, conductor->to_driver_buffer.buffer + offset);
     aeron_mpsc_rb_commit(&conductor->to_driver_buffer, offset);
 
-    AERON_ARRAY_ENSURE_CAPACITY(
-        ensure_capacity_result, conductor->registering_resources, aeron_client_registering_resource_entry_t)
-    if (ensure_capacity_result < 0)
-    {
-        char err_buffer[AERON_MAX_PATH];
-
-        snprintf(err_buffer, sizeof(err_buffer) - 1, "exclusive_publication registering_resources: %s", aeron_errmsg());
-        conductor->error_handler(conductor->error_handler_clientd, aeron_errcode(), err_buffer);
-        return;
-    }
-
-    conductor->registering_resources.array[conductor->registering_resources.length++].resource = async;
-    async->registration_deadline_ns = (long long)(conductor->nano_clock() + conductor->driver_timeout_ns);
+    aeron_client_conductor_add_registering_resource(conductor, async, "exclusive_publication");
 }
 
 void aeron_client_conductor_on_cmd_close_exclusive_publication(void *clientd, void *item)
@@ -971,7 +1033,7 @@ void aeron_client_conductor_on_cmd_add_subscription(void *clientd, void *item)
 
     const size_t command_length = sizeof(aeron_subscription_command_t) + async->uri_length;
 
-    int ensure_capacity_result = 0, rb_offer_fail_count = 0;
+    int rb_offer_fail_count = 0;
 
     int32_t offset;
     while ((offset = aeron_mpsc_rb_try_claim(
@@ -992,29 +1054,11 @@ void aeron_client_conductor_on_cmd_add_subscription(void *clientd, void *item)
         sched_yield();
     }
 
-    uint8_t *ptr = (conductor->to_driver_buffer.buffer + offset);
-    aeron_subscription_command_t *command = (aeron_subscription_command_t *)ptr;
-    command->correlated.correlation_id = async->registration_id;
-    command->correlated.client_id = conductor->client_id;
-    command->stream_id = async->stream_id;
-    command->channel_length = async->uri_length;
-    memcpy(ptr + sizeof(aeron_subscription_command_t), async->uri, (size_t)async->uri_length);
-
+    aeron_client_conductor_encode_subscription_command(
+        conductor, async, conductor->to_driver_buffer.buffer + offset);
     aeron_mpsc_rb_commit(&conductor->to_driver_buffer, offset);
 
-    AERON_ARRAY_ENSURE_CAPACITY(
-        ensure_capacity_result, conductor->registering_resources, aeron_client_registering_resource_entry_t)
-    if (ensure_capacity_result < 0)
-    {
-        char err_buffer[AERON_MAX_PATH];
-
-        snprintf(err_buffer, sizeof(err_buffer) - 1, "subscription registering_resources: %s", aeron_errmsg());
-        conductor->error_handler(conductor->error_handler_clientd, aeron_errcode(), err_buffer);
-        return;
-    }
-
-    conductor->registering_resources.array[conductor->registering_resources.length++].resource = async;
-    async->registration_deadline_ns = (long long)(conductor->nano_clock() + conductor->driver_timeout_ns);
+    aeron_client_conductor_add_registering_resource(conductor, async, "subscription");
 }
 
 void aeron_client_conductor_on_cmd_close_subscription(void *clientd, void *item)
@@ -1040,14 +1084,9 @@ void aeron_client_conductor_on_cmd_add_counter(void *clientd, void *item)
     aeron_client_conductor_t *conductor = (aeron_client_conductor_t *)clientd;
     aeron_async_add_counter_t *async = (aeron_async_add_counter_t *)item;
 
-    const size_t command_length =
-        sizeof(aeron_counter_command_t) +
-        sizeof(int32_t) +
-        (size_t)(AERON_ALIGN(async->counter.key_buffer_length, sizeof(int32_t))) +
-        sizeof(int32_t) +
-        (size_t)async->counter.label_buffer_length;
+    const size_t command_length = aeron_client_conductor_counter_command_length(async);
 
-    int ensure_capacity_result = 0, rb_offer_fail_count = 0;
+    int rb_offer_fail_count = 0;
 
     int32_t offset;
     while ((offset = aeron_mpsc_rb_try_claim(
@@ -1066,37 +1105,10 @@ void aeron_client_conductor_on_cmd_add_counter(void *clientd, void *item)
         sched_yield();
     }
 
-    uint8_t *ptr = (conductor->to_driver_buffer.buffer + offset);
-    aeron_counter_command_t *command = (aeron_counter_command_t *)ptr;
-    char *cursor = (char *)(ptr + sizeof(aeron_counter_command_t));
-
-    command->correlated.correlation_id = async->registration_id;
-    command->correlated.client_id = conductor->client_id;
-    command->type_id = async->counter.type_id;
-
-    memcpy(cursor, &async->counter.key_buffer_length, sizeof(int32_t));
-    cursor += sizeof(int32_t);
-    memcpy(cursor, async->counter.key_buffer, (size_t)async->counter.key_buffer_length);
-    cursor += AERON_ALIGN(async->counter.key_buffer_length, sizeof(int32_t));
-    memcpy(cursor, &async->counter.label_buffer_length, sizeof(int32_t));
-    cursor += sizeof(int32_t);
-    memcpy(cursor, async->counter.label_buffer, (size_t)async->counter.label_buffer_length);
-
+    aeron_client_conductor_encode_counter_command(conductor, async, conductor->to_driver_buffer.buffer + offset);
     aeron_mpsc_rb_commit(&conductor->to_driver_buffer, offset);
 
-    AERON_ARRAY_ENSURE_CAPACITY(
-        ensure_capacity_result, conductor->registering_resources, aeron_client_registering_resource_entry_t)
-    if (ensure_capacity_result < 0)
-    {
-        char err_buffer[AERON_MAX_PATH];
-
-        snprintf(err_buffer, sizeof(err_buffer) - 1, "counter registering_resources: %s", aeron_errmsg());
-        conductor->error_handler(conductor->error_handler_clientd, aeron_errcode(), err_buffer);
-        return;
-    }
-
-    conductor->registering_resources.array[conductor->registering_resources.length++].resource = async;
-    async->registration_deadline_ns = (long long)(conductor->nano_clock() + conductor->driver_timeout_ns);
+    aeron_client_conductor_add_registering_resource(conductor, async, "counter");
 }
 
 void aeron_client_conductor_on_cmd_close_counter(void *clientd, void *item)
@@ -1140,6 +1152,7 @@ static void aeron_client_conductor_on_cmd_destination(const void *clientd, const
         case AERON_CLIENT_TYPE_LOGBUFFER:
         case AERON_CLIENT_TYPE_COUNTER:
         case AERON_CLIENT_TYPE_DESTINATION:
+        case AERON_CLIENT_TYPE_BATCH:
         {
             char err_buffer[AERON_MAX_PATH];
             snprintf(
@@ -1359,26 +1372,32 @@ int aeron_client_conductor_command_offer(aeron_mpsc_concurrent_array_queue_t *co
     return 0;
 }
 
-int aeron_client_conductor_async_add_publication(
-    aeron_async_add_publication_t **async, aeron_client_conductor_t *conductor, const char *uri, int32_t stream_id)
+static int aeron_client_conductor_new_async_add_publication(
+    aeron_client_registering_resource_t **async,
+    aeron_client_conductor_t *conductor,
+    const char *uri,
+    int32_t stream_id,
+    aeron_client_managed_resource_type_t type)
 {
-    aeron_async_add_publication_t *cmd = NULL;
+    const bool is_exclusive = AERON_CLIENT_TYPE_EXCLUSIVE_PUBLICATION == type;
+    aeron_client_registering_resource_t *cmd = NULL;
     char *uri_copy = NULL;
     size_t uri_length = strlen(uri);
 
-    *async = NULL;
-
-    if (aeron_alloc((void **)&cmd, sizeof(aeron_async_add_publication_t)) < 0 ||
+    if (aeron_alloc((void **)&cmd, sizeof(aeron_client_registering_resource_t)) < 0 ||
         aeron_alloc((void **)&uri_copy, uri_length + 1) < 0)
     {
-        AERON_APPEND_ERR("%s", "Unable to allocate publication and uri_copy");
+        aeron_free(cmd);
+        AERON_APPEND_ERR(
+            "Unable to allocate %s and uri_copy", is_exclusive ? "exclusive_publication" : "publication");
         return -1;
     }
 
     memcpy(uri_copy, uri, uri_length);
     uri_copy[uri_length] = '\0';
 
-    cmd->command_base.func = aeron_client_conductor_on_cmd_add_publication;
+    cmd->command_base.func = is_exclusive ?
+        aeron_client_conductor_on_cmd_add_exclusive_publication : aeron_client_conductor_on_cmd_add_publication;
     cmd->command_base.item = NULL;
     cmd->resource.publication = NULL;
     cmd->error_message = NULL;
@@ -1387,100 +1406,200 @@ int aeron_client_conductor_async_add_publication(
     cmd->stream_id = stream_id;
     cmd->registration_id = aeron_mpsc_rb_next_correlation_id(&conductor->to_driver_buffer);
     cmd->registration_status = AERON_CLIENT_AWAITING_MEDIA_DRIVER;
-    cmd->type = AERON_CLIENT_TYPE_PUBLICATION;
-
-    if (conductor->invoker_mode)
-    {
-        *async = cmd;
-        aeron_client_conductor_on_cmd_add_publication(conductor, cmd);
-    }
-    else
-    {
-        if (aeron_client_conductor_command_offer(conductor->command_queue, cmd) < 0)
-        {
-            aeron_free(cmd->uri);
-            aeron_free(cmd);
-            return -1;
-        }
-
-        *async = cmd;
-    }
-
-    return 0;
-}
-
-int aeron_client_conductor_async_close_publication(
-    aeron_client_conductor_t *conductor,
-    aeron_publication_t *publication,
-    aeron_notification_t on_close_complete,
-    void *on_close_complete_clientd)
-{
-    publication->command_base.func = aeron_client_conductor_on_cmd_close_publication;
-    publication->command_base.item = NULL;
-    publication->on_close_complete = on_close_complete;
-    publication->on_close_complete_clientd = on_close_complete_clientd;
-
-    if (aeron_client_conductor_offer_remove_command(
-        conductor, publication->registration_id, AERON_COMMAND_REMOVE_PUBLICATION) < 0)
-    {
-        return -1;
-    }
+    cmd->type = type;
 
-    if (conductor->invoker_mode)
-    {
-        aeron_client_conductor_on_cmd_close_publication(conductor, publication);
-    }
-    else
-    {
-        if (aeron_client_conductor_command_offer(conductor->command_queue, publication) < 0)
-        {
-            return -1;
-        }
-    }
+    *async = cmd;
 
     return 0;
 }
 
-int aeron_client_conductor_async_add_exclusive_publication(
-    aeron_async_add_exclusive_publication_t **async,
+static int aeron_client_conductor_new_async_add_subscription(
+    aeron_client_registering_resource_t **async,
     aeron_client_conductor_t *conductor,
     const char *uri,
-    int32_t stream_id)
+    int32_t stream_id,
+    aeron_on_available_image_t on_available_image_handler,
+    void *on_available_image_clientd,
+    aeron_on_unavailable_image_t on_unavailable_image_handler,
+    void *on_unavailable_image_clientd)
 {
-    aeron_async_add_exclusive_publication_t *cmd = NULL;
+    aeron_client_registering_resource_t *cmd = NULL;
     char *uri_copy = NULL;
     size_t uri_length = strlen(uri);
 
-    *async = NULL;
-
-    if (aeron_alloc((void **)&cmd, sizeof(aeron_async_add_exclusive_publication_t)) < 0 ||
+    if (aeron_alloc((void **)&cmd, sizeof(aeron_client_registering_resource_t)) < 0 ||
         aeron_alloc((void **)&uri_copy, uri_length + 1) < 0)
     {
-        AERON_APPEND_ERR("%s", "Unable to allocate exclusive_publication and uri_copy");
+        aeron_free(cmd);
+        AERON_APPEND_ERR("%s", "Unable to allocate subscription and uri_copy");
         return -1;
     }
 
     memcpy(uri_copy, uri, uri_length);
     uri_copy[uri_length] = '\0';
 
-    cmd->command_base.func = aeron_client_conductor_on_cmd_add_exclusive_publication;
+    cmd->command_base.func = aeron_client_conductor_on_cmd_add_subscription;
     cmd->command_base.item = NULL;
-    cmd->resource.exclusive_publication = NULL;
+    cmd->resource.subscription = NULL;
     cmd->error_message = NULL;
     cmd->uri = uri_copy;
     cmd->uri_length = (int32_t)uri_length;
     cmd->stream_id = stream_id;
     cmd->registration_id = aeron_mpsc_rb_next_correlation_id(&conductor->to_driver_buffer);
+    cmd->on_available_image = on_available_image_handler;
+    cmd->on_available_image_clientd = on_available_image_clientd;
+    cmd->on_unavailable_image = on_unavailable_image_handler;
+    cmd->on_unavailable_image_clientd = on_unavailable_image_clientd;
     cmd->registration_status = AERON_CLIENT_AWAITING_MEDIA_DRIVER;
-    cmd->type = AERON_CLIENT_TYPE_EXCLUSIVE_PUBLICATION;
+    cmd->type = AERON_CLIENT_TYPE_SUBSCRIPTION;
 
-    if (conductor->invoker_mode)
-    {
-        *async = cmd;
-        aeron_client_conductor_on_cmd_add_exclusive_publication(conductor, cmd);
-    }
-    else
-    {
+    *async = cmd;
+
+    return 0;
+}
+
+static int aeron_client_conductor_new_async_add_counter(
+    aeron_client_registering_resource_t **async,
+    aeron_client_conductor_t *conductor,
+    int32_t type_id,
+    const uint8_t *key_buffer,
+    size_t key_buffer_length,
+    const char *label_buffer,
+    size_t label_buffer_length)
+{
+    aeron_client_registering_resource_t *cmd = NULL;
+    uint8_t *key_buffer_copy = NULL;
+    char *label_buffer_copy = NULL;
+
+    if (aeron_alloc((void **)&cmd, sizeof(aeron_client_registering_resource_t)) < 0 ||
+        aeron_alloc((void **)&key_buffer_copy, key_buffer_length) < 0 ||
+        aeron_alloc((void **)&label_buffer_copy, label_buffer_length + 1) < 0)
+    {
+        aeron_free(key_buffer_copy);
+        aeron_free(cmd);
+        AERON_APPEND_ERR("%s", "Unable to allocate counter");
+        return -1;
+    }
+
+    if (key_buffer && key_buffer_length > 0)
+    {
+        memcpy(key_buffer_copy, key_buffer, key_buffer_length);
+    }
+
+    if (label_buffer && label_buffer_length > 0)
+    {
+        memcpy(label_buffer_copy, label_buffer, label_buffer_length);
+    }
+
+    label_buffer_copy[label_buffer_length] = '\0';
+
+    cmd->command_base.func = aeron_client_conductor_on_cmd_add_counter;
+    cmd->command_base.item = NULL;
+    cmd->resource.counter = NULL;
+    cmd->error_message = NULL;
+    cmd->uri = NULL;
+    cmd->counter.key_buffer = key_buffer_copy;
+    cmd->counter.label_buffer = label_buffer_copy;
+    cmd->counter.key_buffer_length = key_buffer_length;
+    cmd->counter.label_buffer_length = label_buffer_length;
+    cmd->counter.type_id = type_id;
+    cmd->registration_id = aeron_mpsc_rb_next_correlation_id(&conductor->to_driver_buffer);
+    cmd->registration_status = AERON_CLIENT_AWAITING_MEDIA_DRIVER;
+    cmd->type = AERON_CLIENT_TYPE_COUNTER;
+
+    *async = cmd;
+
+    return 0;
+}
+
+int aeron_client_conductor_async_add_publication(
+    aeron_async_add_publication_t **async, aeron_client_conductor_t *conductor, const char *uri, int32_t stream_id)
+{
+    aeron_async_add_publication_t *cmd = NULL;
+
+    *async = NULL;
+
+    if (aeron_client_conductor_new_async_add_publication(
+        &cmd, conductor, uri, stream_id, AERON_CLIENT_TYPE_PUBLICATION) < 0)
+    {
+        return -1;
+    }
+
+    if (conductor->invoker_mode)
+    {
+        *async = cmd;
+        aeron_client_conductor_on_cmd_add_publication(conductor, cmd);
+    }
+    else
+    {
+        if (aeron_client_conductor_command_offer(conductor->command_queue, cmd) < 0)
+        {
+            aeron_free(cmd->uri);
+            aeron_free(cmd);
+            return -1;
+        }
+
+        *async = cmd;
+    }
+
+    return 0;
+}
+
+int aeron_client_conductor_async_close_publication(
+    aeron_client_conductor_t *conductor,
+    aeron_publication_t *publication,
+    aeron_notification_t on_close_complete,
+    void *on_close_complete_clientd)
+{
+    publication->command_base.func = aeron_client_conductor_on_cmd_close_publication;
+    publication->command_base.item = NULL;
+    publication->on_close_complete = on_close_complete;
+    publication->on_close_complete_clientd = on_close_complete_clientd;
+
+    if (aeron_client_conductor_offer_remove_command(
+        conductor, publication->registration_id, AERON_COMMAND_REMOVE_PUBLICATION) < 0)
+    {
+        return -1;
+    }
+
+    if (conductor->invoker_mode)
+    {
+        aeron_client_conductor_on_cmd_close_publication(conductor, publication);
+    }
+    else
+    {
+        if (aeron_client_conductor_command_offer(conductor->command_queue, publication) < 0)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+int aeron_client_conductor_async_add_exclusive_publication(
+    aeron_async_add_exclusive_publication_t **async,
+    aeron_client_conductor_t *conductor,
+    const char *uri,
+    int32_t stream_id)
+{
+    aeron_async_add_exclusive_publication_t *cmd = NULL;
+
+    *async = NULL;
+
+    if (aeron_client_conductor_new_async_add_publication(
+        &cmd, conductor, uri, stream_id, AERON_CLIENT_TYPE_EXCLUSIVE_PUBLICATION) < 0)
+    {
+        return -1;
+    }
+
+    if (conductor->invoker_mode)
+    {
+        *async = cmd;
+        aeron_client_conductor_on_cmd_add_exclusive_publication(conductor, cmd);
+    }
+    else
+    {
         if (aeron_client_conductor_command_offer(conductor->command_queue, cmd) < 0)
         {
             aeron_free(cmd->uri);
@@ -1537,36 +1656,22 @@ int aeron_client_conductor_async_add_subscription(
     void *on_unavailable_image_clientd)
 {
     aeron_async_add_subscription_t *cmd = NULL;
-    char *uri_copy = NULL;
-    size_t uri_length = strlen(uri);
 
     *async = NULL;
 
-    if (aeron_alloc((void **)&cmd, sizeof(aeron_async_add_subscription_t)) < 0 ||
-        aeron_alloc((void **)&uri_copy, uri_length + 1) < 0)
+    if (aeron_client_conductor_new_async_add_subscription(
+        &cmd,
+        conductor,
+        uri,
+        stream_id,
+        on_available_image_handler,
+        on_available_image_clientd,
+        on_unavailable_image_handler,
+        on_unavailable_image_clientd) < 0)
     {
-        AERON_APPEND_ERR("%s", "Unable to allocate subscription and uri_copy");
         return -1;
     }
 
-    memcpy(uri_copy, uri, uri_length);
-    uri_copy[uri_length] = '\0';
-
-    cmd->command_base.func = aeron_client_conductor_on_cmd_add_subscription;
-    cmd->command_base.item = NULL;
-    cmd->resource.subscription = NULL;
-    cmd->error_message = NULL;
-    cmd->uri = uri_copy;
-    cmd->uri_length = (int32_t)uri_length;
-    cmd->stream_id = stream_id;
-    cmd->registration_id = aeron_mpsc_rb_next_correlation_id(&conductor->to_driver_buffer);
-    cmd->on_available_image = on_available_image_handler;
-    cmd->on_available_image_clientd = on_available_image_clientd;
-    cmd->on_unavailable_image = on_unavailable_image_handler;
-    cmd->on_unavailable_image_clientd = on_unavailable_image_clientd;
-    cmd->registration_status = AERON_CLIENT_AWAITING_MEDIA_DRIVER;
-    cmd->type = AERON_CLIENT_TYPE_SUBSCRIPTION;
-
     if (conductor->invoker_mode)
     {
         *async = cmd;
@@ -1629,246 +1734,795 @@ int aeron_client_conductor_async_add_counter(
     size_t label_buffer_length)
 {
     aeron_async_add_counter_t *cmd = NULL;
-    uint8_t *key_buffer_copy = NULL;
-    char *label_buffer_copy = NULL;
 
     *async = NULL;
 
-    if (aeron_alloc((void **)&cmd, sizeof(aeron_async_add_counter_t)) < 0 ||
-        aeron_alloc((void **)&key_buffer_copy, key_buffer_length) < 0 ||
-        aeron_alloc((void **)&label_buffer_copy, label_buffer_length + 1) < 0)
+    if (aeron_client_conductor_new_async_add_counter(
+        &cmd, conductor, type_id, key_buffer, key_buffer_length, label_buffer, label_buffer_length) < 0)
     {
-        AERON_APPEND_ERR("%s", "Unable to allocate counter");
         return -1;
     }
 
-    if (key_buffer && key_buffer_length > 0)
+    if (conductor->invoker_mode)
     {
-        memcpy(key_buffer_copy, key_buffer, key_buffer_length);
+        *async = cmd;
+        aeron_client_conductor_on_cmd_add_counter(conductor, cmd);
     }
+    else
+    {
+        if (aeron_client_conductor_command_offer(conductor->command_queue, cmd) < 0)
+        {
+            aeron_free(cmd->uri);
+            aeron_free(cmd);
+            return -1;
+        }
 
-    if (label_buffer && label_buffer_length > 0)
+        *async = cmd;
+    }
+
+    return 0;
+}
+
+int aeron_client_conductor_async_close_counter(
+    aeron_client_conductor_t *conductor,
+    aeron_counter_t *counter,
+    aeron_notification_t on_close_complete,
+    void *on_close_complete_clientd)
+{
+    counter->command_base.func = aeron_client_conductor_on_cmd_close_counter;
+    counter->command_base.item = NULL;
+    counter->on_close_complete = on_close_complete;
+    counter->on_close_complete_clientd = on_close_complete_clientd;
+
+    if (aeron_client_conductor_offer_remove_command(
+        conductor, counter->registration_id, AERON_COMMAND_REMOVE_COUNTER) < 0)
     {
-        memcpy(label_buffer_copy, label_buffer, label_buffer_length);
+        return -1;
     }
 
-    label_buffer_copy[label_buffer_length] = '\0';
+    if (conductor->invoker_mode)
+    {
+        aeron_client_conductor_on_cmd_close_counter(conductor, counter);
+    }
+    else
+    {
+        if (aeron_client_conductor_command_offer(conductor->command_queue, counter) < 0)
+        {
+            return -1;
+        }
+    }
 
-    cmd->command_base.func = aeron_client_conductor_on_cmd_add_counter;
+    return 0;
+}
+
+static int aeron_client_conductor_async_destination(
+    aeron_async_destination_t **async,
+    union aeron_client_registering_resource_un *resource,
+    const char *uri,
+    aeron_client_conductor_t *conductor,
+    void (*destination_func)(void *clientd, void *command))
+{
+    aeron_async_destination_t *cmd = NULL;
+    char *uri_copy = NULL;
+    size_t uri_length = strlen(uri);
+
+    *async = NULL;
+
+    if (aeron_alloc((void **)&uri_copy, uri_length + 1) < 0)
+    {
+        AERON_APPEND_ERR("%s", "Unable to allocate uri_copy");
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&cmd, sizeof(aeron_async_destination_t)) < 0)
+    {
+        AERON_APPEND_ERR("%s", "Unable to allocate destination");
+        return -1;
+    }
+
+    memcpy(uri_copy, uri, uri_length);
+    uri_copy[uri_length] = '\0';
+
+    cmd->command_base.func = destination_func;
+    cmd->command_base.item = NULL;
+    memcpy(&cmd->resource, resource, sizeof(union aeron_client_registering_resource_un));
+    cmd->error_message = NULL;
+    cmd->uri = uri_copy;
+    cmd->uri_length = (int32_t)uri_length;
+    cmd->registration_id = aeron_mpsc_rb_next_correlation_id(&conductor->to_driver_buffer);
+    cmd->registration_status = AERON_CLIENT_AWAITING_MEDIA_DRIVER;
+    cmd->type = AERON_CLIENT_TYPE_DESTINATION;
+
+    if (conductor->invoker_mode)
+    {
+        *async = cmd;
+        destination_func(conductor, cmd);
+    }
+    else
+    {
+        if (aeron_client_conductor_command_offer(conductor->command_queue, cmd) < 0)
+        {
+            aeron_free(cmd->uri);
+            aeron_free(cmd);
+            return -1;
+        }
+
+        *async = cmd;
+    }
+
+    return 0;
+}
+
+int aeron_client_conductor_async_add_publication_destination(
+    aeron_async_destination_t **async,
+    aeron_client_conductor_t *conductor,
+    aeron_publication_t *publication,
+    const char *uri)
+{
+    union aeron_client_registering_resource_un resource;
+    resource.publication = publication;
+
+    return aeron_client_conductor_async_destination(
+        async, &resource, uri, conductor, aeron_client_conductor_on_cmd_add_destination);
+}
+
+int aeron_client_conductor_async_remove_publication_destination(
+    aeron_async_destination_t **async,
+    aeron_client_conductor_t *conductor,
+    aeron_publication_t *publication,
+    const char *uri)
+{
+    union aeron_client_registering_resource_un resource;
+    resource.publication = publication;
+
+    return aeron_client_conductor_async_destination(
+        async, &resource, uri, conductor, aeron_client_conductor_on_cmd_remove_destination);
+}
+
+int aeron_client_conductor_async_add_exclusive_publication_destination(
+    aeron_async_destination_t **async,
+    aeron_client_conductor_t *conductor,
+    aeron_exclusive_publication_t *publication,
+    const char *uri)
+{
+    union aeron_client_registering_resource_un resource;
+    resource.exclusive_publication = publication;
+
+    return aeron_client_conductor_async_destination(
+        async, &resource, uri, conductor, aeron_client_conductor_on_cmd_add_destination);
+}
+
+int aeron_client_conductor_async_remove_exclusive_publication_destination(
+    aeron_async_destination_t **async,
+    aeron_client_conductor_t *conductor,
+    aeron_exclusive_publication_t *publication,
+    const char *uri)
+{
+    union aeron_client_registering_resource_un resource;
+    resource.exclusive_publication = publication;
+
+    return aeron_client_conductor_async_destination(
+        async, &resource, uri, conductor, aeron_client_conductor_on_cmd_remove_destination);
+}
+
+int aeron_client_conductor_async_add_subscription_destination(
+    aeron_async_destination_t **async,
+    aeron_client_conductor_t *conductor,
+    aeron_subscription_t *subscription,
+    const char *uri)
+{
+    union aeron_client_registering_resource_un resource;
+    resource.subscription = subscription;
+
+    return aeron_client_conductor_async_destination(
+        async, &resource, uri, conductor, aeron_client_conductor_on_cmd_add_rcv_destination);
+}
+
+int aeron_client_conductor_async_remove_subscription_destination(
+    aeron_async_destination_t **async,
+    aeron_client_conductor_t *conductor,
+    aeron_subscription_t *subscription,
+    const char *uri)
+{
+    union aeron_client_registering_resource_un resource;
+    resource.subscription = subscription;
+
+    return aeron_client_conductor_async_destination(
+        async, &resource, uri, conductor, aeron_client_conductor_on_cmd_remove_rcv_destination);
+}
+
+int aeron_client_conductor_async_handler(aeron_client_conductor_t *conductor, aeron_client_handler_cmd_t *cmd)
+{
+    cmd->command_base.func = aeron_client_conductor_on_cmd_handler;
+    cmd->command_base.item = NULL;
+
+    if (conductor->invoker_mode)
+    {
+        aeron_client_conductor_on_cmd_handler(conductor, cmd);
+    }
+    else
+    {
+        if (aeron_client_conductor_command_offer(conductor->command_queue, cmd) < 0)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+void aeron_client_conductor_on_cmd_batch(void *clientd, void *item)
+{
+    aeron_client_conductor_t *conductor = (aeron_client_conductor_t *)clientd;
+    aeron_async_batch_t *batch = (aeron_async_batch_t *)item;
+    const size_t command_length = sizeof(aeron_batch_command_t) + batch->batch.entries_length;
+    bool is_sent = true;
+    int rb_offer_fail_count = 0;
+
+    int32_t offset;
+    while ((offset = aeron_mpsc_rb_try_claim(&conductor->to_driver_buffer, AERON_COMMAND_BATCH, command_length)) < 0)
+    {
+        if (++rb_offer_fail_count > AERON_CLIENT_COMMAND_RB_FAIL_THRESHOLD)
+        {
+            char err_buffer[AERON_MAX_PATH];
+
+            snprintf(err_buffer, sizeof(err_buffer) - 1, "BATCH could not be sent (%s:%d)", __FILE__, __LINE__);
+            conductor->error_handler(conductor->error_handler_clientd, AERON_CLIENT_ERROR_BUFFER_FULL, err_buffer);
+            is_sent = false;
+            break;
+        }
+
+        sched_yield();
+    }
+
+    if (is_sent)
+    {
+        uint8_t *ptr = conductor->to_driver_buffer.buffer + offset;
+        aeron_batch_command_t *command = (aeron_batch_command_t *)ptr;
+        uint8_t *cursor = ptr + sizeof(aeron_batch_command_t);
+
+        command->correlated.correlation_id = batch->registration_id;
+        command->correlated.client_id = conductor->client_id;
+        command->entry_count = (int32_t)batch->batch.length;
+        command->entries_length = (int32_t)batch->batch.entries_length;
+
+        for (size_t i = 0; i < batch->batch.length; i++)
+        {
+            aeron_client_batch_entry_t *entry = &batch->batch.array[i];
+            aeron_batch_entry_header_t *header = (aeron_batch_entry_header_t *)cursor;
+            uint8_t *entry_ptr = cursor + sizeof(aeron_batch_entry_header_t);
+
+            header->msg_type_id = entry->msg_type_id;
+            header->length = entry->length;
+
+            switch (entry->msg_type_id)
+            {
+                case AERON_COMMAND_ADD_PUBLICATION:
+                case AERON_COMMAND_ADD_EXCLUSIVE_PUBLICATION:
+                    aeron_client_conductor_encode_publication_command(conductor, entry->item, entry_ptr);
+                    break;
+
+                case AERON_COMMAND_ADD_SUBSCRIPTION:
+                    aeron_client_conductor_encode_subscription_command(conductor, entry->item, entry_ptr);
+                    break;
+
+                case AERON_COMMAND_ADD_COUNTER:
+                    aeron_client_conductor_encode_counter_command(conductor, entry->item, entry_ptr);
+                    break;
+
+                default:
+                    aeron_client_conductor_encode_remove_command(
+                        conductor, entry->correlation_id, entry->registration_id, entry_ptr);
+                    break;
+            }
+
+            cursor += AERON_ALIGN(
+                sizeof(aeron_batch_entry_header_t) + (size_t)entry->length, AERON_BATCH_ENTRY_ALIGNMENT);
+        }
+
+        aeron_mpsc_rb_commit(&conductor->to_driver_buffer, offset);
+    }
+
+    for (size_t i = 0; i < batch->batch.length; i++)
+    {
+        aeron_client_batch_entry_t *entry = &batch->batch.array[i];
+
+        switch (entry->msg_type_id)
+        {
+            case AERON_COMMAND_ADD_PUBLICATION:
+            case AERON_COMMAND_ADD_EXCLUSIVE_PUBLICATION:
+            case AERON_COMMAND_ADD_SUBSCRIPTION:
+            case AERON_COMMAND_ADD_COUNTER:
+                aeron_client_conductor_add_registering_resource(conductor, entry->item, "batch entry");
+                break;
+
+            default:
+            {
+                aeron_client_command_base_t *cmd = (aeron_client_command_base_t *)entry->item;
+                cmd->func(conductor, cmd);
+                break;
+            }
+        }
+    }
+
+    aeron_client_conductor_add_registering_resource(conductor, batch, "batch");
+}
+
+int aeron_client_conductor_async_batch_create(aeron_async_batch_t **async, aeron_client_conductor_t *conductor)
+{
+    aeron_async_batch_t *cmd = NULL;
+
+    *async = NULL;
+
+    if (aeron_alloc((void **)&cmd, sizeof(aeron_async_batch_t)) < 0)
+    {
+        AERON_APPEND_ERR("%s", "Unable to allocate batch");
+        return -1;
+    }
+
+    cmd->command_base.func = aeron_client_conductor_on_cmd_batch;
     cmd->command_base.item = NULL;
-    cmd->resource.counter = NULL;
     cmd->error_message = NULL;
     cmd->uri = NULL;
-    cmd->counter.key_buffer = key_buffer_copy;
-    cmd->counter.label_buffer = label_buffer_copy;
-    cmd->counter.key_buffer_length = key_buffer_length;
-    cmd->counter.label_buffer_length = label_buffer_length;
-    cmd->counter.type_id = type_id;
+    cmd->batch.conductor = conductor;
+    cmd->batch.array = NULL;
+    cmd->batch.length = 0;
+    cmd->batch.capacity = 0;
+    cmd->batch.entries_length = 0;
+    cmd->batch.failed_count = 0;
+    cmd->batch.is_submitted = false;
     cmd->registration_id = aeron_mpsc_rb_next_correlation_id(&conductor->to_driver_buffer);
     cmd->registration_status = AERON_CLIENT_AWAITING_MEDIA_DRIVER;
-    cmd->type = AERON_CLIENT_TYPE_COUNTER;
+    cmd->type = AERON_CLIENT_TYPE_BATCH;
+
+    *async = cmd;
+
+    return 0;
+}
+
+static int aeron_client_conductor_batch_reserve(aeron_async_batch_t *batch, size_t length)
+{
+    if (batch->batch.is_submitted)
+    {
+        AERON_SET_ERR(EINVAL, "%s", "batch has already been submitted");
+        return -1;
+    }
+
+    const size_t entries_length = batch->batch.entries_length +
+        AERON_ALIGN(sizeof(aeron_batch_entry_header_t) + length, AERON_BATCH_ENTRY_ALIGNMENT);
+    const size_t max_message_length = batch->batch.conductor->to_driver_buffer.max_message_length;
+
+    if (sizeof(aeron_batch_command_t) + entries_length > max_message_length)
+    {
+        AERON_SET_ERR(
+            EINVAL,
+            "batch length=%" PRIu64 " would exceed max command length=%" PRIu64,
+            (uint64_t)(sizeof(aeron_batch_command_t) + entries_length),
+            (uint64_t)max_message_length);
+        return -1;
+    }
+
+    int ensure_capacity_result = 0;
+    AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, batch->batch, aeron_client_batch_entry_t)
+    if (ensure_capacity_result < 0)
+    {
+        AERON_APPEND_ERR("%s", "Unable to allocate batch entry");
+        return -1;
+    }
+
+    return 0;
+}
+
+static void aeron_client_conductor_batch_append(
+    aeron_async_batch_t *batch,
+    void *item,
+    int64_t correlation_id,
+    int64_t registration_id,
+    int32_t msg_type_id,
+    size_t length)
+{
+    aeron_client_batch_entry_t *entry = &batch->batch.array[batch->batch.length++];
+
+    entry->item = item;
+    entry->on_close_complete = NULL;
+    entry->on_close_complete_clientd = NULL;
+    entry->correlation_id = correlation_id;
+    entry->registration_id = registration_id;
+    entry->msg_type_id = msg_type_id;
+    entry->length = (int32_t)length;
+
+    batch->batch.entries_length +=
+        AERON_ALIGN(sizeof(aeron_batch_entry_header_t) + length, AERON_BATCH_ENTRY_ALIGNMENT);
+}
+
+static int aeron_client_conductor_async_batch_add_publication_of_type(
+    aeron_client_registering_resource_t **async,
+    aeron_async_batch_t *batch,
+    const char *uri,
+    int32_t stream_id,
+    aeron_client_managed_resource_type_t type)
+{
+    const size_t length = sizeof(aeron_publication_command_t) + strlen(uri);
+    aeron_client_registering_resource_t *cmd = NULL;
+
+    *async = NULL;
+
+    if (aeron_client_conductor_batch_reserve(batch, length) < 0 ||
+        aeron_client_conductor_new_async_add_publication(&cmd, batch->batch.conductor, uri, stream_id, type) < 0)
+    {
+        return -1;
+    }
+
+    aeron_client_conductor_batch_append(
+        batch,
+        cmd,
+        cmd->registration_id,
+        cmd->registration_id,
+        AERON_CLIENT_TYPE_PUBLICATION == type ? AERON_COMMAND_ADD_PUBLICATION : AERON_COMMAND_ADD_EXCLUSIVE_PUBLICATION,
+        length);
+    *async = cmd;
+
+    return 0;
+}
+
+int aeron_client_conductor_async_batch_add_publication(
+    aeron_async_add_publication_t **async, aeron_async_batch_t *batch, const char *uri, int32_t stream_id)
+{
+    return aeron_client_conductor_async_batch_add_publication_of_type(
+        async, batch, uri, stream_id, AERON_CLIENT_TYPE_PUBLICATION);
+}
+
+int aeron_client_conductor_async_batch_add_exclusive_publication(
+    aeron_async_add_exclusive_publication_t **async, aeron_async_batch_t *batch, const char *uri, int32_t stream_id)
+{
+    return aeron_client_conductor_async_batch_add_publication_of_type(
+        async, batch, uri, stream_id, AERON_CLIENT_TYPE_EXCLUSIVE_PUBLICATION);
+}
+
+int aeron_client_conductor_async_batch_add_subscription(
+    aeron_async_add_subscription_t **async,
+    aeron_async_batch_t *batch,
+    const char *uri,
+    int32_t stream_id,
+    aeron_on_available_image_t on_available_image_handler,
+    void *on_available_image_clientd,
+    aeron_on_unavailable_image_t on_unavailable_image_handler,
+    void *on_unavailable_image_clientd)
+{
+    const size_t length = sizeof(aeron_subscription_command_t) + strlen(uri);
+    aeron_async_add_subscription_t *cmd = NULL;
+
+    *async = NULL;
+
+    if (aeron_client_conductor_batch_reserve(batch, length) < 0 ||
+        aeron_client_conductor_new_async_add_subscription(
+            &cmd,
+            batch->batch.conductor,
+            uri,
+            stream_id,
+            on_available_image_handler,
+            on_available_image_clientd,
+            on_unavailable_image_handler,
+            on_unavailable_image_clientd) < 0)
+    {
+        return -1;
+    }
+
+    aeron_client_conductor_batch_append(
+        batch, cmd, cmd->registration_id, cmd->registration_id, AERON_COMMAND_ADD_SUBSCRIPTION, length);
+    *async = cmd;
+
+    return 0;
+}
+
+int aeron_client_conductor_async_batch_add_counter(
+    aeron_async_add_counter_t **async,
+    aeron_async_batch_t *batch,
+    int32_t type_id,
+    const uint8_t *key_buffer,
+    size_t key_buffer_length,
+    const char *label_buffer,
+    size_t label_buffer_length)
+{
+    aeron_async_add_counter_t *cmd = NULL;
+
+    *async = NULL;
 
-    if (conductor->invoker_mode)
+    if (aeron_client_conductor_new_async_add_counter(
+        &cmd, batch->batch.conductor, type_id, key_buffer, key_buffer_length, label_buffer, label_buffer_length) < 0)
     {
-        *async = cmd;
-        aeron_client_conductor_on_cmd_add_counter(conductor, cmd);
+        return -1;
     }
-    else
-    {
-        if (aeron_client_conductor_command_offer(conductor->command_queue, cmd) < 0)
-        {
-            aeron_free(cmd->uri);
-            aeron_free(cmd);
-            return -1;
-        }
 
-        *async = cmd;
+    const size_t length = aeron_client_conductor_counter_command_length(cmd);
+    if (aeron_client_conductor_batch_reserve(batch, length) < 0)
+    {
+        aeron_free((void *)cmd->counter.key_buffer);
+        aeron_free((void *)cmd->counter.label_buffer);
+        aeron_free(cmd);
+        return -1;
     }
 
+    aeron_client_conductor_batch_append(
+        batch, cmd, cmd->registration_id, cmd->registration_id, AERON_COMMAND_ADD_COUNTER, length);
+    *async = cmd;
+
     return 0;
 }
 
-int aeron_client_conductor_async_close_counter(
-    aeron_client_conductor_t *conductor,
-    aeron_counter_t *counter,
+static int aeron_client_conductor_async_batch_close(
+    aeron_async_batch_t *batch,
+    aeron_client_command_base_t *resource,
+    int64_t registration_id,
+    int32_t msg_type_id,
     aeron_notification_t on_close_complete,
     void *on_close_complete_clientd)
 {
-    counter->command_base.func = aeron_client_conductor_on_cmd_close_counter;
-    counter->command_base.item = NULL;
-    counter->on_close_complete = on_close_complete;
-    counter->on_close_complete_clientd = on_close_complete_clientd;
-
-    if (aeron_client_conductor_offer_remove_command(
-        conductor, counter->registration_id, AERON_COMMAND_REMOVE_COUNTER) < 0)
+    if (aeron_client_conductor_batch_reserve(batch, sizeof(aeron_remove_command_t)) < 0)
     {
         return -1;
     }
 
-    if (conductor->invoker_mode)
-    {
-        aeron_client_conductor_on_cmd_close_counter(conductor, counter);
-    }
-    else
-    {
-        if (aeron_client_conductor_command_offer(conductor->command_queue, counter) < 0)
-        {
-            return -1;
-        }
-    }
+    aeron_client_conductor_batch_append(
+        batch,
+        resource,
+        aeron_mpsc_rb_next_correlation_id(&batch->batch.conductor->to_driver_buffer),
+        registration_id,
+        msg_type_id,
+        sizeof(aeron_remove_command_t));
+
+    aeron_client_batch_entry_t *entry = &batch->batch.array[batch->batch.length - 1];
+    entry->on_close_complete = on_close_complete;
+    entry->on_close_complete_clientd = on_close_complete_clientd;
 
     return 0;
 }
 
-static int aeron_client_conductor_async_destination(
-    aeron_async_destination_t **async,
-    union aeron_client_registering_resource_un *resource,
-    const char *uri,
-    aeron_client_conductor_t *conductor,
-    void (*destination_func)(void *clientd, void *command))
+int aeron_client_conductor_async_batch_close_publication(
+    aeron_async_batch_t *batch,
+    aeron_publication_t *publication,
+    aeron_notification_t on_close_complete,
+    void *on_close_complete_clientd)
 {
-    aeron_async_destination_t *cmd = NULL;
-    char *uri_copy = NULL;
-    size_t uri_length = strlen(uri);
+    bool is_closed;
 
-    *async = NULL;
-
-    if (aeron_alloc((void **)&uri_copy, uri_length + 1) < 0)
+    AERON_GET_VOLATILE(is_closed, publication->is_closed);
+    if (is_closed)
     {
-        AERON_APPEND_ERR("%s", "Unable to allocate uri_copy");
-        return -1;
+        return 0;
     }
 
-    if (aeron_alloc((void **)&cmd, sizeof(aeron_async_destination_t)) < 0)
+    return aeron_client_conductor_async_batch_close(
+        batch,
+        &publication->command_base,
+        publication->registration_id,
+        AERON_COMMAND_REMOVE_PUBLICATION,
+        on_close_complete,
+        on_close_complete_clientd);
+}
+
+int aeron_client_conductor_async_batch_close_exclusive_publication(
+    aeron_async_batch_t *batch,
+    aeron_exclusive_publication_t *publication,
+    aeron_notification_t on_close_complete,
+    void *on_close_complete_clientd)
+{
+    bool is_closed;
+
+    AERON_GET_VOLATILE(is_closed, publication->is_closed);
+    if (is_closed)
     {
-        AERON_APPEND_ERR("%s", "Unable to allocate destination");
-        return -1;
+        return 0;
     }
 
-    memcpy(uri_copy, uri, uri_length);
-    uri_copy[uri_length] = '\0';
+    return aeron_client_conductor_async_batch_close(
+        batch,
+        &publication->command_base,
+        publication->registration_id,
+        AERON_COMMAND_REMOVE_PUBLICATION,
+        on_close_complete,
+        on_close_complete_clientd);
+}
 
-    cmd->command_base.func = destination_func;
-    cmd->command_base.item = NULL;
-    memcpy(&cmd->resource, resource, sizeof(union aeron_client_registering_resource_un));
-    cmd->error_message = NULL;
-    cmd->uri = uri_copy;
-    cmd->uri_length = (int32_t)uri_length;
-    cmd->registration_id = aeron_mpsc_rb_next_correlation_id(&conductor->to_driver_buffer);
-    cmd->registration_status = AERON_CLIENT_AWAITING_MEDIA_DRIVER;
-    cmd->type = AERON_CLIENT_TYPE_DESTINATION;
+int aeron_client_conductor_async_batch_close_subscription(
+    aeron_async_batch_t *batch,
+    aeron_subscription_t *subscription,
+    aeron_notification_t on_close_complete,
+    void *on_close_complete_clientd)
+{
+    bool is_closed;
 
-    if (conductor->invoker_mode)
-    {
-        *async = cmd;
-        destination_func(conductor, cmd);
-    }
-    else
+    AERON_GET_VOLATILE(is_closed, subscription->is_closed);
+    if (is_closed)
     {
-        if (aeron_client_conductor_command_offer(conductor->command_queue, cmd) < 0)
-        {
-            aeron_free(cmd->uri);
-            aeron_free(cmd);
-            return -1;
-        }
-
-        *async = cmd;
+        return 0;
     }
 
-    return 0;
+    return aeron_client_conductor_async_batch_close(
+        batch,
+        &subscription->command_base,
+        subscription->registration_id,
+        AERON_COMMAND_REMOVE_SUBSCRIPTION,
+        on_close_complete,
+        on_close_complete_clientd);
 }
 
-int aeron_client_conductor_async_add_publication_destination(
-    aeron_async_destination_t **async,
-    aeron_client_conductor_t *conductor,
-    aeron_publication_t *publication,
-    const char *uri)
+int aeron_client_conductor_async_batch_close_counter(
+    aeron_async_batch_t *batch,
+    aeron_counter_t *counter,
+    aeron_notification_t on_close_complete,
+    void *on_close_complete_clientd)
 {
-    union aeron_client_registering_resource_un resource;
-    resource.publication = publication;
+    bool is_closed;
 
-    return aeron_client_conductor_async_destination(
-        async, &resource, uri, conductor, aeron_client_conductor_on_cmd_add_destination);
+    AERON_GET_VOLATILE(is_closed, counter->is_closed);
+    if (is_closed)
+    {
+        return 0;
+    }
+
+    return aeron_client_conductor_async_batch_close(
+        batch,
+        &counter->command_base,
+        counter->registration_id,
+        AERON_COMMAND_REMOVE_COUNTER,
+        on_close_complete,
+        on_close_complete_clientd);
 }
 
-int aeron_client_conductor_async_remove_publication_destination(
-    aeron_async_destination_t **async,
-    aeron_client_conductor_t *conductor,
-    aeron_publication_t *publication,
-    const char *uri)
+static bool aeron_client_conductor_batch_is_close_entry(aeron_client_batch_entry_t *entry)
 {
-    union aeron_client_registering_resource_un resource;
-    resource.publication = publication;
+    switch (entry->msg_type_id)
+    {
+        case AERON_COMMAND_REMOVE_PUBLICATION:
+        case AERON_COMMAND_REMOVE_SUBSCRIPTION:
+        case AERON_COMMAND_REMOVE_COUNTER:
+            return true;
 
-    return aeron_client_conductor_async_destination(
-        async, &resource, uri, conductor, aeron_client_conductor_on_cmd_remove_destination);
+        default:
+            return false;
+    }
 }
 
-int aeron_client_conductor_async_add_exclusive_publication_destination(
-    aeron_async_destination_t **async,
-    aeron_client_conductor_t *conductor,
-    aeron_exclusive_publication_t *publication,
-    const char *uri)
+static volatile bool *aeron_client_conductor_batch_close_flag(aeron_client_batch_entry_t *entry)
 {
-    union aeron_client_registering_resource_un resource;
-    resource.exclusive_publication = publication;
+    aeron_client_command_base_t *resource = (aeron_client_command_base_t *)entry->item;
 
-    return aeron_client_conductor_async_destination(
-        async, &resource, uri, conductor, aeron_client_conductor_on_cmd_add_destination);
+    switch (resource->type)
+    {
+        case AERON_CLIENT_TYPE_PUBLICATION:
+            return &((aeron_publication_t *)resource)->is_closed;
+
+        case AERON_CLIENT_TYPE_EXCLUSIVE_PUBLICATION:
+            return &((aeron_exclusive_publication_t *)resource)->is_closed;
+
+        case AERON_CLIENT_TYPE_SUBSCRIPTION:
+            return &((aeron_subscription_t *)resource)->is_closed;
+
+        default:
+            return &((aeron_counter_t *)resource)->is_closed;
+    }
 }
 
-int aeron_client_conductor_async_remove_exclusive_publication_destination(
-    aeron_async_destination_t **async,
-    aeron_client_conductor_t *conductor,
-    aeron_exclusive_publication_t *publication,
-    const char *uri)
+static void aeron_client_conductor_batch_prepare_close(aeron_client_batch_entry_t *entry)
 {
-    union aeron_client_registering_resource_un resource;
-    resource.exclusive_publication = publication;
+    aeron_client_command_base_t *resource = (aeron_client_command_base_t *)entry->item;
 
-    return aeron_client_conductor_async_destination(
-        async, &resource, uri, conductor, aeron_client_conductor_on_cmd_remove_destination);
+    resource->item = NULL;
+    switch (resource->type)
+    {
+        case AERON_CLIENT_TYPE_PUBLICATION:
+        {
+            aeron_publication_t *publication = (aeron_publication_t *)resource;
+            resource->func = aeron_client_conductor_on_cmd_close_publication;
+            publication->on_close_complete = entry->on_close_complete;
+            publication->on_close_complete_clientd = entry->on_close_complete_clientd;
+            break;
+        }
+
+        case AERON_CLIENT_TYPE_EXCLUSIVE_PUBLICATION:
+        {
+            aeron_exclusive_publication_t *publication = (aeron_exclusive_publication_t *)resource;
+            resource->func = aeron_client_conductor_on_cmd_close_exclusive_publication;
+            publication->on_close_complete = entry->on_close_complete;
+            publication->on_close_complete_clientd = entry->on_close_complete_clientd;
+            break;
+        }
+
+        case AERON_CLIENT_TYPE_SUBSCRIPTION:
+        {
+            aeron_subscription_t *subscription = (aeron_subscription_t *)resource;
+            resource->func = aeron_client_conductor_on_cmd_close_subscription;
+            subscription->on_close_complete = entry->on_close_complete;
+            subscription->on_close_complete_clientd = entry->on_close_complete_clientd;
+            break;
+        }
+
+        default:
+        {
+            aeron_counter_t *counter = (aeron_counter_t *)resource;
+            resource->func = aeron_client_conductor_on_cmd_close_counter;
+            counter->on_close_complete = entry->on_close_complete;
+            counter->on_close_complete_clientd = entry->on_close_complete_clientd;
+            break;
+        }
+    }
 }
 
-int aeron_client_conductor_async_add_subscription_destination(
-    aeron_async_destination_t **async,
-    aeron_client_conductor_t *conductor,
-    aeron_subscription_t *subscription,
-    const char *uri)
+/*
+ * Resources closed in a batch are only marked closed when it is submitted, so a batch which is never submitted, or
+ * fails to submit, leaves them open. A resource closed since it was added to the batch, including by an earlier entry
+ * of the same batch, has its entry dropped so the remove is not sent twice.
+ */
+static void aeron_client_conductor_batch_claim_closes(aeron_async_batch_t *batch)
 {
-    union aeron_client_registering_resource_un resource;
-    resource.subscription = subscription;
+    size_t length = 0;
+    size_t entries_length = 0;
 
-    return aeron_client_conductor_async_destination(
-        async, &resource, uri, conductor, aeron_client_conductor_on_cmd_add_rcv_destination);
+    for (size_t i = 0; i < batch->batch.length; i++)
+    {
+        aeron_client_batch_entry_t *entry = &batch->batch.array[i];
+
+        if (aeron_client_conductor_batch_is_close_entry(entry))
+        {
+            volatile bool *is_closed = aeron_client_conductor_batch_close_flag(entry);
+            bool was_closed;
+
+            AERON_GET_VOLATILE(was_closed, *is_closed);
+            if (was_closed)
+            {
+                continue;
+            }
+
+            aeron_client_conductor_batch_prepare_close(entry);
+            AERON_PUT_ORDERED(*is_closed, true);
+        }
+
+        entries_length += AERON_ALIGN(
+            sizeof(aeron_batch_entry_header_t) + (size_t)entry->length, AERON_BATCH_ENTRY_ALIGNMENT);
+        batch->batch.array[length++] = *entry;
+    }
+
+    batch->batch.length = length;
+    batch->batch.entries_length = entries_length;
 }
 
-int aeron_client_conductor_async_remove_subscription_destination(
-    aeron_async_destination_t **async,
-    aeron_client_conductor_t *conductor,
-    aeron_subscription_t *subscription,
-    const char *uri)
+static void aeron_client_conductor_batch_unclaim_closes(aeron_async_batch_t *batch)
 {
-    union aeron_client_registering_resource_un resource;
-    resource.subscription = subscription;
+    for (size_t i = 0; i < batch->batch.length; i++)
+    {
+        aeron_client_batch_entry_t *entry = &batch->batch.array[i];
 
-    return aeron_client_conductor_async_destination(
-        async, &resource, uri, conductor, aeron_client_conductor_on_cmd_remove_rcv_destination);
+        if (aeron_client_conductor_batch_is_close_entry(entry))
+        {
+            AERON_PUT_ORDERED(*aeron_client_conductor_batch_close_flag(entry), false);
+        }
+    }
 }
 
-int aeron_client_conductor_async_handler(aeron_client_conductor_t *conductor, aeron_client_handler_cmd_t *cmd)
+int aeron_client_conductor_async_batch_submit(aeron_async_batch_t *batch)
 {
-    cmd->command_base.func = aeron_client_conductor_on_cmd_handler;
-    cmd->command_base.item = NULL;
+    aeron_client_conductor_t *conductor = batch->batch.conductor;
+
+    if (batch->batch.is_submitted)
+    {
+        AERON_SET_ERR(EINVAL, "%s", "batch has already been submitted");
+        return -1;
+    }
+
+    batch->batch.is_submitted = true;
+    aeron_client_conductor_batch_claim_closes(batch);
 
     if (conductor->invoker_mode)
     {
-        aeron_client_conductor_on_cmd_handler(conductor, cmd);
+        aeron_client_conductor_on_cmd_batch(conductor, batch);
     }
     else
     {
-        if (aeron_client_conductor_command_offer(conductor->command_queue, cmd) < 0)
+        if (aeron_client_conductor_command_offer(conductor->command_queue, batch) < 0)
         {
+            aeron_client_conductor_batch_unclaim_closes(batch);
+            batch->batch.is_submitted = false;
             return -1;
         }
     }
@@ -2188,6 +2842,43 @@ int aeron_client_conductor_on_operation_success(
     return 0;
 }
 
+int aeron_client_conductor_on_batch_complete(aeron_client_conductor_t *conductor, aeron_batch_complete_t *response)
+{
+    for (size_t i = 0, size = conductor->registering_resources.length, last_index = size - 1; i < size; i++)
+    {
+        aeron_client_registering_resource_t *resource = conductor->registering_resources.array[i].resource;
+
+        if (response->correlation_id == resource->registration_id)
+        {
+            aeron_batch_result_t *results =
+                (aeron_batch_result_t *)((uint8_t *)response + sizeof(aeron_batch_complete_t));
+            int32_t failed_count = 0;
+
+            for (int32_t j = 0; j < response->result_count; j++)
+            {
+                if (AERON_ERROR_CODE_UNUSED != results[j].error_code)
+                {
+                    failed_count++;
+                }
+            }
+
+            resource->batch.failed_count = failed_count;
+
+            aeron_array_fast_unordered_remove(
+                (uint8_t *)conductor->registering_resources.array,
+                sizeof(aeron_client_registering_resource_entry_t),
+                i,
+                last_index);
+            conductor->registering_resources.length--;
+
+            AERON_PUT_ORDERED(resource->registration_status, AERON_CLIENT_REGISTERED_MEDIA_DRIVER);
+            break;
+        }
+    }
+
+    return 0;
+}
+
 aeron_subscription_t *aeron_client_conductor_find_subscription_by_id(
     aeron_client_conductor_t *conductor, int64_t registration_id)
 {
@@ -2425,12 +3116,11 @@ int aeron_client_conductor_offer_remove_command(
         sched_yield();
     }
 
-    aeron_remove_command_t *command = (aeron_remove_command_t *)(conductor->to_driver_buffer.buffer + offset);
-
-    command->correlated.correlation_id = aeron_mpsc_rb_next_correlation_id(&conductor->to_driver_buffer);
-    command->correlated.client_id = conductor->client_id;
-    command->registration_id = registration_id;
-
+    aeron_client_conductor_encode_remove_command(
+        conductor,
+        aeron_mpsc_rb_next_correlation_id(&conductor->to_driver_buffer),
+        registration_id,
+        conductor->to_driver_buffer.buffer + offset);
     aeron_mpsc_rb_commit(&conductor->to_driver_buffer, offset);
 
     return 0;
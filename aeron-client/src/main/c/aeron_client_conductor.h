@@ -46,7 +46,8 @@ typedef enum aeron_client_managed_resource_type_en
     AERON_CLIENT_TYPE_IMAGE,
     AERON_CLIENT_TYPE_LOGBUFFER,
     AERON_CLIENT_TYPE_COUNTER,
-    AERON_CLIENT_TYPE_DESTINATION
+    AERON_CLIENT_TYPE_DESTINATION,
+    AERON_CLIENT_TYPE_BATCH
 }
 aeron_client_managed_resource_type_t;
 
@@ -58,6 +59,18 @@ typedef struct aeron_client_command_base_stct
 }
 aeron_client_command_base_t;
 
+typedef struct aeron_client_batch_entry_stct
+{
+    void *item;
+    aeron_notification_t on_close_complete;
+    void *on_close_complete_clientd;
+    int64_t correlation_id;
+    int64_t registration_id;
+    int32_t msg_type_id;
+    int32_t length;
+}
+aeron_client_batch_entry_t;
+
 typedef struct aeron_client_registering_resource_stct
 {
     aeron_client_command_base_t command_base;
@@ -93,6 +106,17 @@ typedef struct aeron_client_registering_resource_stct
         int32_t type_id;
     }
     counter;
+    struct aeron_client_registering_batch_stct
+    {
+        struct aeron_client_conductor_stct *conductor;
+        size_t length;
+        size_t capacity;
+        aeron_client_batch_entry_t *array;
+        size_t entries_length;
+        int32_t failed_count;
+        bool is_submitted;
+    }
+    batch;
     volatile aeron_client_registration_status_t registration_status;
     aeron_client_managed_resource_type_t type;
 }
@@ -338,6 +362,52 @@ int aeron_client_conductor_async_remove_subscription_destination(
 
 int aeron_client_conductor_async_handler(aeron_client_conductor_t *conductor, aeron_client_handler_cmd_t *cmd);
 
+void aeron_client_conductor_on_cmd_batch(void *clientd, void *item);
+
+int aeron_client_conductor_async_batch_create(aeron_async_batch_t **async, aeron_client_conductor_t *conductor);
+int aeron_client_conductor_async_batch_add_publication(
+    aeron_async_add_publication_t **async, aeron_async_batch_t *batch, const char *uri, int32_t stream_id);
+int aeron_client_conductor_async_batch_add_exclusive_publication(
+    aeron_async_add_exclusive_publication_t **async, aeron_async_batch_t *batch, const char *uri, int32_t stream_id);
+int aeron_client_conductor_async_batch_add_subscription(
+    aeron_async_add_subscription_t **async,
+    aeron_async_batch_t *batch,
+    const char *uri,
+    int32_t stream_id,
+    aeron_on_available_image_t on_available_image_handler,
+    void *on_available_image_clientd,
+    aeron_on_unavailable_image_t on_unavailable_image_handler,
+    void *on_unavailable_image_clientd);
+int aeron_client_conductor_async_batch_add_counter(
+    aeron_async_add_counter_t **async,
+    aeron_async_batch_t *batch,
+    int32_t type_id,
+    const uint8_t *key_buffer,
+    size_t key_buffer_length,
+    const char *label_buffer,
+    size_t label_buffer_length);
+int aeron_client_conductor_async_batch_close_publication(
+    aeron_async_batch_t *batch,
+    aeron_publication_t *publication,
+    aeron_notification_t on_close_complete,
+    void *on_close_complete_clientd);
+int aeron_client_conductor_async_batch_close_exclusive_publication(
+    aeron_async_batch_t *batch,
+    aeron_exclusive_publication_t *publication,
+    aeron_notification_t on_close_complete,
+    void *on_close_complete_clientd);
+int aeron_client_conductor_async_batch_close_subscription(
+    aeron_async_batch_t *batch,
+    aeron_subscription_t *subscription,
+    aeron_notification_t on_close_complete,
+    void *on_close_complete_clientd);
+int aeron_client_conductor_async_batch_close_counter(
+    aeron_async_batch_t *batch,
+    aeron_counter_t *counter,
+    aeron_notification_t on_close_complete,
+    void *on_close_complete_clientd);
+int aeron_client_conductor_async_batch_submit(aeron_async_batch_t *batch);
+
 int aeron_client_conductor_on_error(aeron_client_conductor_t *conductor, aeron_error_response_t *response);
 int aeron_client_conductor_on_publication_ready(
     aeron_client_conductor_t *conductor, aeron_publication_buffers_ready_t *response);
@@ -357,6 +427,7 @@ int aeron_client_conductor_on_counter_ready(aeron_client_conductor_t *conductor,
 int aeron_client_conductor_on_unavailable_counter(
     aeron_client_conductor_t *conductor, aeron_counter_update_t *response);
 int aeron_client_conductor_on_client_timeout(aeron_client_conductor_t *conductor, aeron_client_timeout_t *response);
+int aeron_client_conductor_on_batch_complete(aeron_client_conductor_t *conductor, aeron_batch_complete_t *response);
 
 int aeron_client_conductor_get_or_create_log_buffer(
     aeron_client_conductor_t *conductor,
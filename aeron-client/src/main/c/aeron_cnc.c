@@ -25,6 +25,7 @@
 #include "util/aeron_error.h"
 #include "util/aeron_fileutil.h"
 #include "reports/aeron_loss_reporter.h"
+#include "reports/aeron_latency_reporter.h"
 #include "aeron_cnc_file_descriptor.h"
 
 typedef struct aeron_cnc_stct
@@ -184,6 +185,34 @@ int aeron_cnc_loss_reporter_read(
     return result;
 }
 
+int aeron_cnc_latency_reporter_read(
+    aeron_cnc_t *aeron_cnc,
+    aeron_latency_reporter_read_entry_func_t entry_func,
+    void *clientd)
+{
+    char latency_report_filename[AERON_MAX_PATH];
+
+    if (aeron_latency_reporter_resolve_filename(
+        aeron_cnc->base_path, latency_report_filename, sizeof(latency_report_filename)) < 0)
+    {
+        AERON_APPEND_ERR("%s", "Failed to resolve latency report file name");
+        return -1;
+    }
+
+    aeron_mapped_file_t latency_mmap;
+    if (aeron_map_existing_file(&latency_mmap, latency_report_filename) < 0)
+    {
+        AERON_APPEND_ERR("%s", "Failed to map latency report, is the latency report enabled on the media driver?");
+        return -1;
+    }
+
+    int result = (int)aeron_latency_reporter_read(latency_mmap.addr, latency_mmap.length, entry_func, clientd);
+
+    aeron_unmap(&latency_mmap);
+
+    return result;
+}
+
 void aeron_cnc_close(aeron_cnc_t *aeron_cnc)
 {
     if (NULL != aeron_cnc)
@@ -67,6 +67,12 @@
 #define AERON_COUNTER_CHANNEL_MDC_NUM_DESTINATIONS_NAME "mdc-num-dest"
 #define AERON_COUNTER_CHANNEL_NUM_DESTINATIONS_TYPE_ID (18)
 
+#define AERON_COUNTER_SENDER_BATCH_NAME "snd-batch"
+#define AERON_COUNTER_SENDER_BATCH_TYPE_ID (19)
+
+#define AERON_COUNTER_SENDER_PACING_DELAYS_NAME "snd-pacing-delays"
+#define AERON_COUNTER_SENDER_PACING_DELAYS_TYPE_ID (20)
+
 // AERON_EF_VI reserved range 50-74
 // AERON_DPDK reserved range 75-99
 
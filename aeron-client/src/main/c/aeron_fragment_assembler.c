@@ -23,6 +23,7 @@
 
 #define AERON_BUFFER_BUILDER_MIN_ALLOCATED_CAPACITY (4096)
 #define AERON_BUFFER_BUILDER_MAX_CAPACITY (INT32_MAX - 8)
+#define AERON_BUFFER_BUILDER_MIN_IOV_CAPACITY (8)
 
 int aeron_buffer_builder_create(aeron_buffer_builder_t **buffer_builder)
 {
@@ -41,6 +42,9 @@ int aeron_buffer_builder_create(aeron_buffer_builder_t **buffer_builder)
     _buffer_builder->limit = 0;
     _buffer_builder->next_term_offset = -1;
     _buffer_builder->header.frame = _frame;
+    _buffer_builder->iov = NULL;
+    _buffer_builder->iov_count = 0;
+    _buffer_builder->iov_capacity = 0;
 
     *buffer_builder = _buffer_builder;
     return 0;
@@ -102,10 +106,35 @@ int aeron_buffer_builder_ensure_capacity(aeron_buffer_builder_t *buffer_builder,
     return 0;
 }
 
+int aeron_buffer_builder_append_iov(aeron_buffer_builder_t *buffer_builder, const uint8_t *buffer, size_t length)
+{
+    if (buffer_builder->iov_count >= buffer_builder->iov_capacity)
+    {
+        const size_t new_capacity = 0 == buffer_builder->iov_capacity ?
+            AERON_BUFFER_BUILDER_MIN_IOV_CAPACITY : buffer_builder->iov_capacity * 2;
+
+        if (aeron_reallocf((void **)&buffer_builder->iov, new_capacity * sizeof(aeron_iovec_t)) < 0)
+        {
+            AERON_APPEND_ERR("%s", "Unable to reallocate buffer_builder->iov");
+            return -1;
+        }
+
+        buffer_builder->iov_capacity = new_capacity;
+    }
+
+    aeron_iovec_t *iov = &buffer_builder->iov[buffer_builder->iov_count++];
+    iov->iov_base = (uint8_t *)buffer;
+    iov->iov_len = length;
+    buffer_builder->limit += length;
+
+    return 0;
+}
+
 void aeron_buffer_builder_delete(aeron_buffer_builder_t *buffer_builder)
 {
     if (buffer_builder)
     {
+        aeron_free(buffer_builder->iov);
         aeron_free(buffer_builder->buffer);
         aeron_free(buffer_builder->header.frame);
         aeron_free(buffer_builder);
@@ -511,6 +540,190 @@ aeron_controlled_fragment_handler_action_t aeron_controlled_fragment_assembler_h
     return action;
 }
 
+int aeron_image_iovec_fragment_assembler_create(
+    aeron_image_iovec_fragment_assembler_t **assembler,
+    aeron_iovec_fragment_handler_t delegate,
+    void *delegate_clientd)
+{
+    aeron_image_iovec_fragment_assembler_t *_assembler;
+
+    if (aeron_alloc((void **)&_assembler, sizeof(aeron_image_iovec_fragment_assembler_t)) < 0)
+    {
+        AERON_APPEND_ERR("%s", "Failed to allocate assembler");
+        return -1;
+    }
+
+    if (aeron_buffer_builder_create(&_assembler->buffer_builder) < 0)
+    {
+        aeron_free(_assembler);
+        return -1;
+    }
+
+    _assembler->delegate = delegate;
+    _assembler->delegate_clientd = delegate_clientd;
+
+    *assembler = _assembler;
+    return 0;
+}
+
+int aeron_image_iovec_fragment_assembler_delete(aeron_image_iovec_fragment_assembler_t *assembler)
+{
+    if (assembler)
+    {
+        aeron_buffer_builder_delete(assembler->buffer_builder);
+        aeron_free(assembler);
+    }
+
+    return 0;
+}
+
+static void aeron_iovec_fragment_assembler_on_fragment(
+    aeron_iovec_fragment_handler_t delegate,
+    void *delegate_clientd,
+    aeron_buffer_builder_t *buffer_builder,
+    const uint8_t *buffer,
+    size_t length,
+    aeron_header_t *header)
+{
+    uint8_t flags = header->frame->frame_header.flags;
+
+    if ((flags & AERON_DATA_HEADER_BEGIN_FLAG) == AERON_DATA_HEADER_BEGIN_FLAG)
+    {
+        aeron_buffer_builder_reset(buffer_builder);
+        aeron_buffer_builder_capture_header(buffer_builder, header);
+
+        if (aeron_buffer_builder_append_iov(buffer_builder, buffer, length) < 0)
+        {
+            aeron_buffer_builder_reset(buffer_builder);
+        }
+        else
+        {
+            aeron_buffer_builder_next_term_offset(buffer_builder, aeron_header_next_term_offset(header));
+        }
+    }
+    else if (buffer_builder->next_term_offset == header->frame->term_offset)
+    {
+        if (aeron_buffer_builder_append_iov(buffer_builder, buffer, length) < 0)
+        {
+            aeron_buffer_builder_reset(buffer_builder);
+        }
+        else if ((flags & AERON_DATA_HEADER_END_FLAG) == AERON_DATA_HEADER_END_FLAG)
+        {
+            delegate(
+                delegate_clientd,
+                buffer_builder->iov,
+                buffer_builder->iov_count,
+                aeron_buffer_builder_complete_header(buffer_builder, header));
+            aeron_buffer_builder_reset(buffer_builder);
+        }
+        else
+        {
+            aeron_buffer_builder_next_term_offset(buffer_builder, aeron_header_next_term_offset(header));
+        }
+    }
+    else
+    {
+        aeron_buffer_builder_reset(buffer_builder);
+    }
+}
+
+void aeron_image_iovec_fragment_assembler_handler(
+    void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
+{
+    aeron_image_iovec_fragment_assembler_t *assembler = (aeron_image_iovec_fragment_assembler_t *)clientd;
+    uint8_t flags = header->frame->frame_header.flags;
+
+    if ((flags & AERON_DATA_HEADER_UNFRAGMENTED) == AERON_DATA_HEADER_UNFRAGMENTED)
+    {
+        aeron_iovec_t iov = { (uint8_t *)buffer, length };
+        assembler->delegate(assembler->delegate_clientd, &iov, 1, header);
+    }
+    else
+    {
+        aeron_iovec_fragment_assembler_on_fragment(
+            assembler->delegate, assembler->delegate_clientd, assembler->buffer_builder, buffer, length, header);
+    }
+}
+
+int aeron_iovec_fragment_assembler_create(
+    aeron_iovec_fragment_assembler_t **assembler, aeron_iovec_fragment_handler_t delegate, void *delegate_clientd)
+{
+    aeron_iovec_fragment_assembler_t *_assembler;
+
+    if (aeron_alloc((void **)&_assembler, sizeof(aeron_iovec_fragment_assembler_t)) < 0)
+    {
+        AERON_APPEND_ERR("%s", "Failed to allocate assembler");
+        return -1;
+    }
+
+    if (aeron_int64_to_ptr_hash_map_init(
+        &_assembler->builder_by_session_id_map, 8, AERON_MAP_DEFAULT_LOAD_FACTOR) < 0)
+    {
+        aeron_free(_assembler);
+        AERON_APPEND_ERR("%s", "Unable to init builder_by_session_id_map");
+        return -1;
+    }
+
+    _assembler->delegate = delegate;
+    _assembler->delegate_clientd = delegate_clientd;
+
+    *assembler = _assembler;
+    return 0;
+}
+
+int aeron_iovec_fragment_assembler_delete(aeron_iovec_fragment_assembler_t *assembler)
+{
+    if (assembler)
+    {
+        aeron_int64_to_ptr_hash_map_for_each(
+            &assembler->builder_by_session_id_map, aeron_fragment_assembler_entry_delete, NULL);
+        aeron_int64_to_ptr_hash_map_delete(&assembler->builder_by_session_id_map);
+        aeron_free(assembler);
+    }
+
+    return 0;
+}
+
+void aeron_iovec_fragment_assembler_handler(
+    void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
+{
+    aeron_iovec_fragment_assembler_t *assembler = (aeron_iovec_fragment_assembler_t *)clientd;
+    uint8_t flags = header->frame->frame_header.flags;
+
+    if ((flags & AERON_DATA_HEADER_UNFRAGMENTED) == AERON_DATA_HEADER_UNFRAGMENTED)
+    {
+        aeron_iovec_t iov = { (uint8_t *)buffer, length };
+        assembler->delegate(assembler->delegate_clientd, &iov, 1, header);
+        return;
+    }
+
+    aeron_buffer_builder_t *buffer_builder = aeron_int64_to_ptr_hash_map_get(
+        &assembler->builder_by_session_id_map, header->frame->session_id);
+
+    if (NULL == buffer_builder)
+    {
+        if ((flags & AERON_DATA_HEADER_BEGIN_FLAG) != AERON_DATA_HEADER_BEGIN_FLAG)
+        {
+            return;
+        }
+
+        if (aeron_buffer_builder_create(&buffer_builder) < 0)
+        {
+            return;
+        }
+
+        if (aeron_int64_to_ptr_hash_map_put(
+            &assembler->builder_by_session_id_map, header->frame->session_id, buffer_builder) < 0)
+        {
+            aeron_buffer_builder_delete(buffer_builder);
+            return;
+        }
+    }
+
+    aeron_iovec_fragment_assembler_on_fragment(
+        assembler->delegate, assembler->delegate_clientd, buffer_builder, buffer, length, header);
+}
+
 extern void aeron_buffer_builder_reset(aeron_buffer_builder_t *buffer_builder);
 
 extern void aeron_buffer_builder_next_term_offset(aeron_buffer_builder_t *buffer_builder, int32_t next_term_offset);
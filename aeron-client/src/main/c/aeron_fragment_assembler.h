@@ -30,6 +30,9 @@ typedef struct aeron_buffer_builder_stct
     size_t limit;
     int32_t next_term_offset;
     aeron_header_t header;
+    aeron_iovec_t *iov;
+    size_t iov_count;
+    size_t iov_capacity;
 }
 aeron_buffer_builder_t;
 
@@ -65,14 +68,32 @@ typedef struct aeron_controlled_fragment_assembler_stct
 }
 aeron_controlled_fragment_assembler_t;
 
+typedef struct aeron_image_iovec_fragment_assembler_stct
+{
+    aeron_iovec_fragment_handler_t delegate;
+    void *delegate_clientd;
+    aeron_buffer_builder_t *buffer_builder;
+}
+aeron_image_iovec_fragment_assembler_t;
+
+typedef struct aeron_iovec_fragment_assembler_stct
+{
+    aeron_iovec_fragment_handler_t delegate;
+    void *delegate_clientd;
+    aeron_int64_to_ptr_hash_map_t builder_by_session_id_map;
+}
+aeron_iovec_fragment_assembler_t;
+
 int aeron_buffer_builder_create(aeron_buffer_builder_t **buffer_builder);
 int aeron_buffer_builder_find_suitable_capacity(size_t current_capacity, size_t required_capacity);
 int aeron_buffer_builder_ensure_capacity(aeron_buffer_builder_t *buffer_builder, size_t additional_capacity);
+int aeron_buffer_builder_append_iov(aeron_buffer_builder_t *buffer_builder, const uint8_t *buffer, size_t length);
 void aeron_buffer_builder_delete(aeron_buffer_builder_t *buffer_builder);
 
 inline void aeron_buffer_builder_reset(aeron_buffer_builder_t *buffer_builder)
 {
     buffer_builder->limit = 0;
+    buffer_builder->iov_count = 0;
     buffer_builder->next_term_offset = -1;
     buffer_builder->header.fragmented_frame_length = AERON_NULL_VALUE;
 }
@@ -97,6 +97,9 @@ int aeron_image_create(
     _image->final_position = 0;
     _image->join_position = *subscriber_position;
     _image->eos_position = INT64_MAX;
+    _image->fair_poll_deficit = 0;
+    _image->fair_poll_starved_count = 0;
+    _image->fair_poll_weight = 1;
     _image->refcnt = 1;
 
     _image->metadata =
@@ -326,6 +329,90 @@ int aeron_image_poll(aeron_image_t *image, aeron_fragment_handler_t handler, voi
     return (int)fragments_read;
 }
 
+int aeron_image_poll_batch(
+    aeron_image_t *image, aeron_fragment_batch_handler_t handler, void *clientd, size_t fragment_limit)
+{
+    if (NULL == image || NULL == handler)
+    {
+        AERON_SET_ERR(
+            EINVAL,
+            "Parameters must not be null, image: %s, handler: %s",
+            AERON_NULL_STR(image),
+            AERON_NULL_STR(handler));
+        return -1;
+    }
+
+    bool is_closed;
+    AERON_GET_VOLATILE(is_closed, image->is_closed);
+    if (is_closed)
+    {
+        return 0;
+    }
+
+    aeron_header_t headers[AERON_FRAGMENT_BATCH_MAX_LENGTH];
+    aeron_fragment_descriptor_t fragments[AERON_FRAGMENT_BATCH_MAX_LENGTH];
+    size_t batch_length = 0;
+    size_t fragments_read = 0;
+    const int64_t initial_position = *image->subscriber_position;
+    const size_t index = aeron_logbuffer_index_by_position(initial_position, image->position_bits_to_shift);
+    const uint8_t *term_buffer = image->log_buffer->mapped_raw_log.term_buffers[index].addr;
+    const int32_t initial_offset = (int32_t)initial_position & image->term_length_mask;
+    const int32_t capacity = (const int32_t)image->log_buffer->mapped_raw_log.term_length;
+    int32_t offset = initial_offset;
+
+    while (fragments_read < fragment_limit && offset < capacity)
+    {
+        aeron_data_header_t *frame = (aeron_data_header_t *)(term_buffer + offset);
+        int32_t frame_length, frame_offset;
+
+        AERON_GET_VOLATILE(frame_length, frame->frame_header.frame_length);
+
+        if (frame_length <= 0)
+        {
+            break;
+        }
+
+        frame_offset = offset;
+        offset += AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+
+        if (AERON_HDR_TYPE_PAD != frame->frame_header.type)
+        {
+            aeron_header_t *header = &headers[batch_length];
+            aeron_fragment_descriptor_t *fragment = &fragments[batch_length];
+
+            header->frame = frame;
+            header->initial_term_id = image->metadata->initial_term_id;
+            header->position_bits_to_shift = image->position_bits_to_shift;
+            header->fragmented_frame_length = AERON_NULL_VALUE;
+            header->context = (void *)image;
+
+            fragment->offset = (size_t)frame_offset + AERON_DATA_HEADER_LENGTH;
+            fragment->length = (size_t)frame_length - AERON_DATA_HEADER_LENGTH;
+            fragment->header = header;
+
+            ++fragments_read;
+            if (++batch_length == AERON_FRAGMENT_BATCH_MAX_LENGTH)
+            {
+                handler(clientd, term_buffer, fragments, batch_length);
+                batch_length = 0;
+            }
+        }
+    }
+
+    if (batch_length > 0)
+    {
+        handler(clientd, term_buffer, fragments, batch_length);
+    }
+
+    int64_t new_position = initial_position + (offset - initial_offset);
+    if (new_position > initial_position)
+    {
+        aeron_counter_set_ordered(image->subscriber_position, new_position);
+    }
+
+    return (int)fragments_read;
+}
+
 int aeron_image_controlled_poll(
     aeron_image_t *image, aeron_controlled_fragment_handler_t handler, void *clientd, size_t fragment_limit)
 {
@@ -793,6 +880,42 @@ int aeron_image_block_poll(
     return (int)length;
 }
 
+int aeron_image_set_fair_poll_weight(aeron_image_t *image, uint32_t weight)
+{
+    if (NULL == image || 0 == weight)
+    {
+        AERON_SET_ERR(
+            EINVAL,
+            "Parameters must be valid, image: %s, weight: %" PRIu32,
+            AERON_NULL_STR(image),
+            weight);
+        return -1;
+    }
+
+    image->fair_poll_weight = weight;
+
+    return 0;
+}
+
+bool aeron_image_is_fragment_available(aeron_image_t *image)
+{
+    const int64_t position = *image->subscriber_position;
+    const size_t index = aeron_logbuffer_index_by_position(position, image->position_bits_to_shift);
+    const uint8_t *term_buffer = image->log_buffer->mapped_raw_log.term_buffers[index].addr;
+    const aeron_frame_header_t *frame =
+        (const aeron_frame_header_t *)(term_buffer + ((int32_t)position & image->term_length_mask));
+    int32_t frame_length;
+
+    AERON_GET_VOLATILE(frame_length, frame->frame_length);
+
+    return frame_length > 0;
+}
+
+int64_t aeron_image_fair_poll_starved_count(aeron_image_t *image)
+{
+    return image->fair_poll_starved_count;
+}
+
 bool aeron_image_is_closed(aeron_image_t *image)
 {
     bool is_closed = true;
@@ -48,6 +48,8 @@ typedef struct aeron_image_stct
     int64_t final_position;
     volatile int64_t refcnt;
     int64_t eos_position;
+    int64_t fair_poll_deficit;
+    int64_t fair_poll_starved_count;
 
     int32_t session_id;
     int32_t term_length_mask;
@@ -55,6 +57,7 @@ typedef struct aeron_image_stct
     int32_t subscriber_position_id;
 
     size_t position_bits_to_shift;
+    uint32_t fair_poll_weight;
 
     volatile bool is_closed;
     volatile bool is_eos;
@@ -143,4 +146,6 @@ inline int64_t aeron_image_refcnt_volatile(aeron_image_t *image)
     return value;
 }
 
+bool aeron_image_is_fragment_available(aeron_image_t *image);
+
 #endif //AERON_C_IMAGE_H
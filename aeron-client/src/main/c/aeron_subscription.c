@@ -67,6 +67,7 @@ int aeron_subscription_create(
     _subscription->on_unavailable_image_clientd = on_unavailable_image_clientd;
 
     _subscription->round_robin_index = 0;
+    _subscription->fair_poll_starved_count = 0;
     _subscription->is_closed = false;
 
     *subscription = _subscription;
@@ -472,6 +473,156 @@ int aeron_subscription_poll(
     return (int)fragments_read;
 }
 
+int aeron_subscription_poll_batch(
+    aeron_subscription_t *subscription, aeron_fragment_batch_handler_t handler, void *clientd, size_t fragment_limit)
+{
+    volatile aeron_image_list_t *image_list;
+
+    if (NULL == handler)
+    {
+        AERON_SET_ERR(
+            EINVAL,
+            "handler must not be null %s",
+            AERON_NULL_STR(handler));
+        return -1;
+    }
+
+    AERON_GET_VOLATILE(image_list, subscription->conductor_fields.image_lists_head.next_list);
+
+    size_t length = image_list->length;
+    size_t fragments_read = 0;
+    size_t starting_index = subscription->round_robin_index++;
+    if (starting_index >= length)
+    {
+        subscription->round_robin_index = starting_index = 0;
+    }
+
+    for (size_t i = starting_index; i < length && fragments_read < fragment_limit; i++)
+    {
+        if (NULL != image_list->array[i])
+        {
+            fragments_read += (size_t)aeron_image_poll_batch(
+                image_list->array[i], handler, clientd, fragment_limit - fragments_read);
+        }
+    }
+
+    for (size_t i = 0; i < starting_index && fragments_read < fragment_limit; i++)
+    {
+        if (NULL != image_list->array[i])
+        {
+            fragments_read += (size_t)aeron_image_poll_batch(
+                image_list->array[i], handler, clientd, fragment_limit - fragments_read);
+        }
+    }
+
+    aeron_subscription_propose_last_image_change_number(subscription, image_list->change_number);
+
+    return (int)fragments_read;
+}
+
+int aeron_subscription_fair_poll(
+    aeron_subscription_t *subscription,
+    aeron_fragment_handler_t handler,
+    void *clientd,
+    size_t fragment_limit,
+    size_t image_fragment_quantum)
+{
+    volatile aeron_image_list_t *image_list;
+
+    if (NULL == handler || 0 == image_fragment_quantum)
+    {
+        AERON_SET_ERR(
+            EINVAL,
+            "Parameters must be valid, handler: %s, image_fragment_quantum: %" PRIu64,
+            AERON_NULL_STR(handler),
+            (uint64_t)image_fragment_quantum);
+        return -1;
+    }
+
+    AERON_GET_VOLATILE(image_list, subscription->conductor_fields.image_lists_head.next_list);
+
+    size_t length = image_list->length;
+    size_t fragments_read = 0;
+    size_t first_round_visited = 0;
+    size_t starting_index = subscription->round_robin_index++;
+    if (starting_index >= length)
+    {
+        subscription->round_robin_index = starting_index = 0;
+    }
+
+    bool is_first_round = true;
+    bool is_progress = true;
+
+    while (is_progress && fragments_read < fragment_limit)
+    {
+        is_progress = false;
+
+        for (size_t i = 0; i < length && fragments_read < fragment_limit; i++)
+        {
+            size_t index = starting_index + i;
+            aeron_image_t *image = image_list->array[index < length ? index : index - length];
+
+            if (is_first_round)
+            {
+                first_round_visited++;
+            }
+
+            if (NULL == image)
+            {
+                continue;
+            }
+
+            const int64_t quantum = (int64_t)image_fragment_quantum * image->fair_poll_weight;
+            const size_t remaining = fragment_limit - fragments_read;
+
+            image->fair_poll_deficit += quantum;
+            const size_t budget = (size_t)image->fair_poll_deficit < remaining ?
+                (size_t)image->fair_poll_deficit : remaining;
+
+            int read = aeron_image_poll(image, handler, clientd, budget);
+            if (read > 0)
+            {
+                fragments_read += (size_t)read;
+                image->fair_poll_deficit -= read;
+                is_progress = true;
+            }
+
+            if (read < (int)budget)
+            {
+                // a drained image does not bank credit, as in deficit round-robin
+                image->fair_poll_deficit = 0;
+            }
+            else if (image->fair_poll_deficit > quantum)
+            {
+                image->fair_poll_deficit = quantum;
+            }
+        }
+
+        is_first_round = false;
+    }
+
+    for (size_t i = first_round_visited; i < length; i++)
+    {
+        size_t index = starting_index + i;
+        aeron_image_t *image = image_list->array[index < length ? index : index - length];
+
+        if (NULL != image && !aeron_image_is_closed(image) && aeron_image_is_fragment_available(image))
+        {
+            image->fair_poll_starved_count++;
+            subscription->fair_poll_starved_count++;
+        }
+    }
+
+    aeron_subscription_propose_last_image_change_number(subscription, image_list->change_number);
+
+    return (int)fragments_read;
+}
+
+int64_t aeron_subscription_fair_poll_starved_count(aeron_subscription_t *subscription)
+{
+    return subscription->fair_poll_starved_count;
+}
+
 int aeron_subscription_controlled_poll(
     aeron_subscription_t *subscription,
     aeron_controlled_fragment_handler_t handler,
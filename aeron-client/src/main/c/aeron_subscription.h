@@ -63,6 +63,7 @@ typedef struct aeron_subscription_stct
     int32_t stream_id;
     int32_t channel_status_indicator_id;
     size_t round_robin_index;
+    int64_t fair_poll_starved_count;
 
     volatile bool is_closed;
     uint8_t post_fields_padding[AERON_CACHE_LINE_LENGTH];
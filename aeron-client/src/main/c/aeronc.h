@@ -78,11 +78,14 @@ typedef struct aeron_client_registering_resource_stct aeron_async_add_exclusive_
 typedef struct aeron_client_registering_resource_stct aeron_async_add_subscription_t;
 typedef struct aeron_client_registering_resource_stct aeron_async_add_counter_t;
 typedef struct aeron_client_registering_resource_stct aeron_async_destination_t;
+typedef struct aeron_client_registering_resource_stct aeron_async_batch_t;
 
 typedef struct aeron_image_fragment_assembler_stct aeron_image_fragment_assembler_t;
 typedef struct aeron_image_controlled_fragment_assembler_stct aeron_image_controlled_fragment_assembler_t;
 typedef struct aeron_fragment_assembler_stct aeron_fragment_assembler_t;
 typedef struct aeron_controlled_fragment_assembler_stct aeron_controlled_fragment_assembler_t;
+typedef struct aeron_image_iovec_fragment_assembler_stct aeron_image_iovec_fragment_assembler_t;
+typedef struct aeron_iovec_fragment_assembler_stct aeron_iovec_fragment_assembler_t;
 
 /**
  * Environment variables and functions used for setting values of an aeron_context_t.
@@ -499,6 +502,174 @@ int aeron_async_add_counter(
  */
 int aeron_async_add_counter_poll(aeron_counter_t **counter, aeron_async_add_counter_t *async);
 
+/**
+ * Create a batch to which add and close operations for publications, subscriptions, and counters can be added. When
+ * submitted the whole batch is sent to the media driver as a single command, which is cheaper than issuing each
+ * operation on its own when creating or closing many resources at once, e.g. on start up.
+ *
+ * The batch must be submitted with aeron_async_batch_submit and then polled with aeron_async_batch_poll until
+ * complete, which also frees it.
+ *
+ * @param async batch to be filled in.
+ * @param client to send the batch from.
+ * @return 0 for success or -1 for an error.
+ */
+int aeron_async_batch_create(aeron_async_batch_t **async, aeron_t *client);
+
+/**
+ * Add a publication to a batch. The returned async is polled with aeron_async_add_publication_poll as usual once
+ * the batch has been submitted.
+ *
+ * @param async object to use for polling completion.
+ * @param batch to add the publication to.
+ * @param uri for the channel of the publication.
+ * @param stream_id for the publication.
+ * @return 0 for success or -1 for an error, e.g. the batch would exceed the maximum command length.
+ */
+int aeron_async_batch_add_publication(
+    aeron_async_add_publication_t **async, aeron_async_batch_t *batch, const char *uri, int32_t stream_id);
+
+/**
+ * Add an exclusive publication to a batch. The returned async is polled with
+ * aeron_async_add_exclusive_publication_poll as usual once the batch has been submitted.
+ *
+ * @param async object to use for polling completion.
+ * @param batch to add the exclusive publication to.
+ * @param uri for the channel of the exclusive publication.
+ * @param stream_id for the exclusive publication.
+ * @return 0 for success or -1 for an error, e.g. the batch would exceed the maximum command length.
+ */
+int aeron_async_batch_add_exclusive_publication(
+    aeron_async_add_exclusive_publication_t **async, aeron_async_batch_t *batch, const char *uri, int32_t stream_id);
+
+/**
+ * Add a subscription to a batch. The returned async is polled with aeron_async_add_subscription_poll as usual once
+ * the batch has been submitted.
+ *
+ * @param async object to use for polling completion.
+ * @param batch to add the subscription to.
+ * @param uri for the channel of the subscription.
+ * @param stream_id for the subscription.
+ * @param on_available_image_handler to be called when images become available on the subscription.
+ * @param on_available_image_clientd to be passed when images become available on the subscription.
+ * @param on_unavailable_image_handler to be called when images go unavailable on the subscription.
+ * @param on_unavailable_image_clientd to be passed when images go unavailable on the subscription.
+ * @return 0 for success or -1 for an error, e.g. the batch would exceed the maximum command length.
+ */
+int aeron_async_batch_add_subscription(
+    aeron_async_add_subscription_t **async,
+    aeron_async_batch_t *batch,
+    const char *uri,
+    int32_t stream_id,
+    aeron_on_available_image_t on_available_image_handler,
+    void *on_available_image_clientd,
+    aeron_on_unavailable_image_t on_unavailable_image_handler,
+    void *on_unavailable_image_clientd);
+
+/**
+ * Add a counter to a batch. The returned async is polled with aeron_async_add_counter_poll as usual once the batch
+ * has been submitted.
+ *
+ * @param async object to use for polling completion.
+ * @param batch to add the counter to.
+ * @param type_id for the counter.
+ * @param key_buffer for the counter.
+ * @param key_buffer_length for the counter.
+ * @param label_buffer for the counter.
+ * @param label_buffer_length for the counter.
+ * @return 0 for success or -1 for an error, e.g. the batch would exceed the maximum command length.
+ */
+int aeron_async_batch_add_counter(
+    aeron_async_add_counter_t **async,
+    aeron_async_batch_t *batch,
+    int32_t type_id,
+    const uint8_t *key_buffer,
+    size_t key_buffer_length,
+    const char *label_buffer,
+    size_t label_buffer_length);
+
+/**
+ * Add the close of a publication to a batch. The publication stays open until the batch is submitted, when it is
+ * marked as closed and then released, with on_close_complete called.
+ *
+ * @param batch to add the close to.
+ * @param publication to close.
+ * @param on_close_complete optional callback to execute once the publication has been closed and freed.
+ * @param on_close_complete_clientd parameter to pass to the on_complete callback.
+ * @return 0 for success or -1 for an error.
+ */
+int aeron_async_batch_close_publication(
+    aeron_async_batch_t *batch,
+    aeron_publication_t *publication,
+    aeron_notification_t on_close_complete,
+    void *on_close_complete_clientd);
+
+/**
+ * Add the close of an exclusive publication to a batch. The publication stays open until the batch is submitted,
+ * when it is marked as closed and then released, with on_close_complete called.
+ *
+ * @param batch to add the close to.
+ * @param publication to close.
+ * @param on_close_complete optional callback to execute once the publication has been closed and freed.
+ * @param on_close_complete_clientd parameter to pass to the on_complete callback.
+ * @return 0 for success or -1 for an error.
+ */
+int aeron_async_batch_close_exclusive_publication(
+    aeron_async_batch_t *batch,
+    aeron_exclusive_publication_t *publication,
+    aeron_notification_t on_close_complete,
+    void *on_close_complete_clientd);
+
+/**
+ * Add the close of a subscription to a batch. The subscription stays open until the batch is submitted, when it is
+ * marked as closed and then released, with on_close_complete called.
+ *
+ * @param batch to add the close to.
+ * @param subscription to close.
+ * @param on_close_complete optional callback to execute once the subscription has been closed and freed.
+ * @param on_close_complete_clientd parameter to pass to the on_complete callback.
+ * @return 0 for success or -1 for an error.
+ */
+int aeron_async_batch_close_subscription(
+    aeron_async_batch_t *batch,
+    aeron_subscription_t *subscription,
+    aeron_notification_t on_close_complete,
+    void *on_close_complete_clientd);
+
+/**
+ * Add the close of a counter to a batch. The counter stays open until the batch is submitted, when it is marked as
+ * closed and then released, with on_close_complete called.
+ *
+ * @param batch to add the close to.
+ * @param counter to close.
+ * @param on_close_complete optional callback to execute once the counter has been closed and freed.
+ * @param on_close_complete_clientd parameter to pass to the on_complete callback.
+ * @return 0 for success or -1 for an error.
+ */
+int aeron_async_batch_close_counter(
+    aeron_async_batch_t *batch,
+    aeron_counter_t *counter,
+    aeron_notification_t on_close_complete,
+    void *on_close_complete_clientd);
+
+/**
+ * Submit a batch to the media driver. No further operations can be added to the batch once submitted.
+ *
+ * @param batch to submit.
+ * @return 0 for success or -1 for an error.
+ */
+int aeron_async_batch_submit(aeron_async_batch_t *batch);
+
+/**
+ * Poll the completion of a submitted batch. The batch is complete once the media driver has processed every
+ * operation in it, and the batch is freed when this returns 1 or -1.
+ *
+ * @param batch to check for completion.
+ * @return 0 for not complete (try again), 1 for all operations completed successfully, or -1 for an error or if any
+ * operation in the batch failed.
+ */
+int aeron_async_batch_poll(aeron_async_batch_t *batch);
+
 typedef struct aeron_on_available_counter_pair_stct
 {
     aeron_on_available_counter_t handler;
@@ -1383,6 +1554,60 @@ int aeron_exclusive_publication_local_sockaddrs(
 typedef void (*aeron_fragment_handler_t)(
     void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header);
 
+/**
+ * Callback for handling a whole message as a list of regions of the log, one per fragment, read in order.
+ *
+ * The regions point into the log buffer and are only valid for the duration of the callback.
+ *
+ * @param clientd passed to the poll function.
+ * @param iov regions of the log holding the message payload.
+ * @param iovcnt number of regions.
+ * @param header representing the meta data for the data.
+ */
+typedef void (*aeron_iovec_fragment_handler_t)(
+    void *clientd, const aeron_iovec_t *iov, size_t iovcnt, aeron_header_t *header);
+
+/**
+ * Maximum number of fragments delivered in a single call to an aeron_fragment_batch_handler_t.
+ */
+#define AERON_FRAGMENT_BATCH_MAX_LENGTH (64)
+
+/**
+ * Location of a fragment within the buffer passed to an aeron_fragment_batch_handler_t.
+ */
+typedef struct aeron_fragment_descriptor_stct
+{
+    /**
+     * Offset in the buffer at which the fragment data begins.
+     */
+    size_t offset;
+
+    /**
+     * Length of the fragment data in bytes.
+     */
+    size_t length;
+
+    /**
+     * Header representing the meta data for the fragment.
+     */
+    aeron_header_t *header;
+}
+aeron_fragment_descriptor_t;
+
+/**
+ * Callback for handling a batch of fragments being read from a log, in order, with a single call. This avoids the
+ * indirect call per fragment of aeron_fragment_handler_t when fragments are small.
+ *
+ * The descriptors and headers are only valid for the duration of the callback.
+ *
+ * @param clientd passed to the poll function.
+ * @param buffer containing the fragments.
+ * @param fragments describing where each fragment is within the buffer.
+ * @param fragment_count number of fragments, at most AERON_FRAGMENT_BATCH_MAX_LENGTH.
+ */
+typedef void (*aeron_fragment_batch_handler_t)(
+    void *clientd, const uint8_t *buffer, const aeron_fragment_descriptor_t *fragments, size_t fragment_count);
+
 typedef enum aeron_controlled_fragment_handler_action_en
 {
     /**
@@ -1529,6 +1754,49 @@ aeron_subscription_constants_t;
 int aeron_subscription_poll(
     aeron_subscription_t *subscription, aeron_fragment_handler_t handler, void *clientd, size_t fragment_limit);
 
+/**
+ * Poll the images under the subscription for available message fragments, delivering them in batches of up to
+ * AERON_FRAGMENT_BATCH_MAX_LENGTH fragments from the same image per call to the handler.
+ *
+ * @param subscription to poll.
+ * @param handler for handling each batch of message fragments as it is read.
+ * @param fragment_limit number of message fragments to limit when polling across multiple images.
+ * @return the number of fragments received or -1 for error.
+ */
+int aeron_subscription_poll_batch(
+    aeron_subscription_t *subscription, aeron_fragment_batch_handler_t handler, void *clientd, size_t fragment_limit);
+
+/**
+ * Poll the images under the subscription for available message fragments, sharing the fragment limit fairly between
+ * images with deficit round-robin. Each round every image is granted image_fragment_quantum fragments multiplied by
+ * its weight, see aeron_image_set_fair_poll_weight, and rounds repeat until the fragment limit is reached or no image
+ * has anything left to read. Unused credit is carried over for at most one quantum and is dropped when an image has
+ * nothing left to read.
+ * <p>
+ * Images which had fragments available but were not reached before the fragment limit was exhausted are counted as
+ * starved, see aeron_image_fair_poll_starved_count and aeron_subscription_fair_poll_starved_count.
+ *
+ * @param subscription to poll.
+ * @param handler for handling each message fragment as it is read.
+ * @param fragment_limit number of message fragments to limit when polling across multiple images.
+ * @param image_fragment_quantum number of fragments granted to an image of weight 1 per round, must be > 0.
+ * @return the number of fragments received or -1 for error.
+ */
+int aeron_subscription_fair_poll(
+    aeron_subscription_t *subscription,
+    aeron_fragment_handler_t handler,
+    void *clientd,
+    size_t fragment_limit,
+    size_t image_fragment_quantum);
+
+/**
+ * Number of times an image of this subscription was starved by aeron_subscription_fair_poll.
+ *
+ * @param subscription to check.
+ * @return the number of times an image with fragments available was not polled.
+ */
+int64_t aeron_subscription_fair_poll_starved_count(aeron_subscription_t *subscription);
+
 /**
  * Poll in a controlled manner the images under the subscription for available message fragments.
  * Control is applied to fragments in the stream. If more fragments can be read on another stream
@@ -1898,6 +2166,20 @@ int aeron_image_active_transport_count(aeron_image_t *image);
  */
 int aeron_image_poll(aeron_image_t *image, aeron_fragment_handler_t handler, void *clientd, size_t fragment_limit);
 
+/**
+ * Poll for new messages in a stream. If new messages are found beyond the last consumed position then they
+ * will be delivered to the handler in batches of up to AERON_FRAGMENT_BATCH_MAX_LENGTH fragments, up to a limited
+ * number of fragments as specified.
+ *
+ * @param image to poll.
+ * @param handler to which batches of message fragments are delivered.
+ * @param clientd to pass to the handler.
+ * @param fragment_limit for the number of fragments to be consumed during one polling operation.
+ * @return the number of fragments that have been consumed or -1 for error.
+ */
+int aeron_image_poll_batch(
+    aeron_image_t *image, aeron_fragment_batch_handler_t handler, void *clientd, size_t fragment_limit);
+
 /**
  * Poll for new messages in a stream. If new messages are found beyond the last consumed position then they
  * will be delivered to the handler up to a limited number of fragments as specified.
@@ -1996,6 +2278,25 @@ int aeron_image_block_poll(
 
 bool aeron_image_is_closed(aeron_image_t *image);
 
+/**
+ * Set the weight of this image for aeron_subscription_fair_poll. An image of weight n is granted n times as many
+ * fragments per round as an image of weight 1. Images default to a weight of 1.
+ *
+ * @param image to set the weight of.
+ * @param weight to apply, must be > 0.
+ * @return 0 on success or -1 for error.
+ */
+int aeron_image_set_fair_poll_weight(aeron_image_t *image, uint32_t weight);
+
+/**
+ * Number of times aeron_subscription_fair_poll reached its fragment limit before polling this image while it had
+ * fragments available.
+ *
+ * @param image to check.
+ * @return the number of times this image was starved.
+ */
+int64_t aeron_image_fair_poll_starved_count(aeron_image_t *image);
+
 /**
  * A fragment handler that sits in a chain-of-responsibility pattern that reassembles fragmented messages
  * so that the next handler in the chain only sees whole messages.
@@ -2134,6 +2435,83 @@ int aeron_controlled_fragment_assembler_delete(aeron_controlled_fragment_assembl
 aeron_controlled_fragment_handler_action_t aeron_controlled_fragment_assembler_handler(
     void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header);
 
+/**
+ * A fragment handler that sits in a chain-of-responsibility pattern that reassembles fragmented messages
+ * without copying them, so that the next handler in the chain only sees whole messages.
+ * <p>
+ * A message is always appended within a single term so its fragments sit one after the other in the term buffer,
+ * separated only by their headers. The delegate is handed a region per fragment pointing into the term buffer in
+ * place of a copy, which saves a memcpy of the whole message. Unfragmented messages are delegated as a single region.
+ * <p>
+ * Fragments of a partly assembled message are remembered by location across polls. This holds because the driver
+ * only cleans a log a term behind its slowest consumer, so a term the image has not yet moved beyond is never zeroed
+ * under the assembler. The regions handed to the delegate are only valid for the duration of the callback.
+ * <p>
+ * The aeron_header_t passed to the delegate on assembling a message will be that of the last fragment.
+ */
+
+/**
+ * Create an image iovec fragment assembler for use with a single image.
+ *
+ * @param assembler to be set when created successfully.
+ * @param delegate to call on completed.
+ * @param delegate_clientd to pass to delegate handler.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_image_iovec_fragment_assembler_create(
+    aeron_image_iovec_fragment_assembler_t **assembler,
+    aeron_iovec_fragment_handler_t delegate,
+    void *delegate_clientd);
+
+/**
+ * Delete an image iovec fragment assembler.
+ *
+ * @param assembler to delete.
+ * @return 0 for success or -1 for error.
+ */
+int aeron_image_iovec_fragment_assembler_delete(aeron_image_iovec_fragment_assembler_t *assembler);
+
+/**
+ * Handler function to be passed for handling fragment assembly.
+ *
+ * @param clientd passed in the poll call (must be a aeron_image_iovec_fragment_assembler_t)
+ * @param buffer containing the data.
+ * @param length of the data in bytes.
+ * @param header representing the meta data for the data.
+ */
+void aeron_image_iovec_fragment_assembler_handler(
+    void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header);
+
+/**
+ * Create an iovec fragment assembler for use with a subscription.
+ *
+ * @param assembler to be set when created successfully.
+ * @param delegate to call on completed.
+ * @param delegate_clientd to pass to delegate handler.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_iovec_fragment_assembler_create(
+    aeron_iovec_fragment_assembler_t **assembler, aeron_iovec_fragment_handler_t delegate, void *delegate_clientd);
+
+/**
+ * Delete an iovec fragment assembler.
+ *
+ * @param assembler to delete.
+ * @return 0 for success or -1 for error.
+ */
+int aeron_iovec_fragment_assembler_delete(aeron_iovec_fragment_assembler_t *assembler);
+
+/**
+ * Handler function to be passed for handling fragment assembly.
+ *
+ * @param clientd passed in the poll call (must be a aeron_iovec_fragment_assembler_t)
+ * @param buffer containing the data.
+ * @param length of the data in bytes.
+ * @param header representing the meta data for the data.
+ */
+void aeron_iovec_fragment_assembler_handler(
+    void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header);
+
 /**
  * Counter functions
  */
@@ -2494,6 +2872,57 @@ typedef void (*aeron_loss_reporter_read_entry_func_t)(
 int aeron_cnc_loss_reporter_read(
     aeron_cnc_t *aeron_cnc, aeron_loss_reporter_read_entry_func_t entry_func, void *clientd);
 
+#define AERON_LATENCY_REPORT_HOP_SEND_TO_WIRE (1)
+#define AERON_LATENCY_REPORT_HOP_WIRE_TO_TERM (2)
+#define AERON_LATENCY_REPORT_HOP_TERM_TO_SUBSCRIBER (3)
+
+#define AERON_LATENCY_REPORT_BUCKET_COUNT (256)
+
+typedef void (*aeron_latency_reporter_read_entry_func_t)(
+    void *clientd,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    int32_t hop,
+    const char *channel,
+    int32_t channel_length,
+    int64_t sample_count,
+    int64_t total_ns,
+    int64_t max_ns,
+    const int64_t *buckets,
+    size_t bucket_count);
+
+/**
+ * Read all of the latency histograms from the report in the same media driver instance as the cnc file. The report
+ * only exists when the media driver has been started with the latency report enabled.
+ *
+ * @param aeron_cnc to query
+ * @param entry_func callback for each histogram found
+ * @param clientd client data to be passed to the callback.
+ * @return -1 on failure, number of histograms on success (could be 0).
+ */
+int aeron_cnc_latency_reporter_read(
+    aeron_cnc_t *aeron_cnc, aeron_latency_reporter_read_entry_func_t entry_func, void *clientd);
+
+/**
+ * Get the name of a hop recorded in the latency report, e.g. "snd-wire".
+ *
+ * @param hop one of the AERON_LATENCY_REPORT_HOP_* values.
+ * @return name of the hop or "unknown".
+ */
+const char *aeron_latency_report_hop_name(int32_t hop);
+
+/**
+ * Get the value in nanoseconds at or below which the given percentile of samples in a latency histogram fall. The
+ * value returned is the highest value that is recorded in the same bucket so is an upper bound.
+ *
+ * @param buckets of the histogram as passed to an aeron_latency_reporter_read_entry_func_t.
+ * @param bucket_count of the histogram.
+ * @param percentile in the range 0.0 to 100.0.
+ * @return value at the percentile or 0 if the histogram is empty.
+ */
+int64_t aeron_latency_report_value_at_percentile(const int64_t *buckets, size_t bucket_count, double percentile);
+
 /**
  * Closes the instance of the aeron cnc and frees its resources.
  *
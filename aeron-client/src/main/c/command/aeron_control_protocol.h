@@ -34,6 +34,7 @@
 #define AERON_COMMAND_ADD_RCV_DESTINATION (0x0C)
 #define AERON_COMMAND_REMOVE_RCV_DESTINATION (0x0D)
 #define AERON_COMMAND_TERMINATE_DRIVER (0x0E)
+#define AERON_COMMAND_BATCH (0x0F)
 
 #define AERON_RESPONSE_ON_ERROR (0x0F01)
 #define AERON_RESPONSE_ON_AVAILABLE_IMAGE (0x0F02)
@@ -45,6 +46,7 @@
 #define AERON_RESPONSE_ON_COUNTER_READY (0x0F08)
 #define AERON_RESPONSE_ON_UNAVAILABLE_COUNTER (0x0F09)
 #define AERON_RESPONSE_ON_CLIENT_TIMEOUT (0x0F0A)
+#define AERON_RESPONSE_ON_BATCH_COMPLETE (0x0F0B)
 
 /* error codes */
 #define AERON_ERROR_CODE_UNKNOWN_CODE_VALUE (-1)
@@ -182,6 +184,43 @@ typedef struct aeron_terminate_driver_command_stct
 }
 aeron_terminate_driver_command_t;
 
+/*
+ * A batch carries add/remove publication, subscription, and counter commands in a single record. Each entry is a
+ * header followed by the command exactly as it would be written on its own, padded to
+ * AERON_BATCH_ENTRY_ALIGNMENT. The driver processes the entries in order, responding to each as normal, then sends
+ * a single AERON_RESPONSE_ON_BATCH_COMPLETE listing the result of every entry.
+ */
+typedef struct aeron_batch_command_stct
+{
+    aeron_correlated_command_t correlated;
+    int32_t entry_count;
+    int32_t entries_length;
+}
+aeron_batch_command_t;
+
+typedef struct aeron_batch_entry_header_stct
+{
+    int32_t msg_type_id;
+    int32_t length;
+}
+aeron_batch_entry_header_t;
+
+#define AERON_BATCH_ENTRY_ALIGNMENT (sizeof(int64_t))
+
+typedef struct aeron_batch_result_stct
+{
+    int64_t correlation_id;
+    int32_t error_code;
+}
+aeron_batch_result_t;
+
+typedef struct aeron_batch_complete_stct
+{
+    int64_t correlation_id;
+    int32_t result_count;
+}
+aeron_batch_complete_t;
+
 #pragma pack(pop)
 
 #endif //AERON_CONTROL_PROTOCOL_H
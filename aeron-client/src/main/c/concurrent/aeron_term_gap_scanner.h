@@ -20,6 +20,7 @@
 #include "protocol/aeron_udp_protocol.h"
 #include "util/aeron_bitutil.h"
 #include "aeron_logbuffer_descriptor.h"
+#include "aeron_term_scanner_simd.h"
 
 typedef void (*aeron_term_gap_scanner_on_gap_detected_func_t)(void *clientd, int32_t term_id, int32_t term_offset, size_t length);
 
@@ -34,6 +35,7 @@ inline int32_t aeron_term_gap_scanner_scan_for_gap(
     void *clientd)
 {
     int32_t offset = term_offset;
+    int32_t last_aligned_frame_length = 0;
 
     do
     {
@@ -46,7 +48,14 @@ inline int32_t aeron_term_gap_scanner_scan_for_gap(
             break;
         }
 
-        offset += AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+        const int32_t aligned_frame_length = AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+        offset += aligned_frame_length;
+
+        if (aligned_frame_length == last_aligned_frame_length && offset < limit_offset)
+        {
+            offset += aeron_term_scanner_uniform_frames(buffer + offset, aligned_frame_length, limit_offset - offset);
+        }
+        last_aligned_frame_length = aligned_frame_length;
     }
     while (offset < limit_offset);
 
@@ -54,6 +63,11 @@ inline int32_t aeron_term_gap_scanner_scan_for_gap(
     if (offset < limit_offset)
     {
         const int32_t limit = limit_offset - AERON_ALIGNED_HEADER_LENGTH;
+        const int32_t zeroed_offset = offset + AERON_ALIGNED_HEADER_LENGTH;
+
+        // skip whole blocks of the gap which are still zero before finding where it ends one frame at a time
+        offset += aeron_term_scanner_zeroed_length(buffer + zeroed_offset, limit_offset - zeroed_offset);
+
         while (offset < limit)
         {
             offset += AERON_LOGBUFFER_FRAME_ALIGNMENT;
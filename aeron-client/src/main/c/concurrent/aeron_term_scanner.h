@@ -21,12 +21,14 @@
 #include <stddef.h>
 #include "util/aeron_bitutil.h"
 #include "aeron_logbuffer_descriptor.h"
+#include "aeron_term_scanner_simd.h"
 
 inline int32_t aeron_term_scanner_scan_for_availability(
     const uint8_t *buffer, int32_t term_length_left, int32_t max_length, int32_t *padding)
 {
     const int32_t limit = max_length < term_length_left ? max_length : term_length_left;
     int32_t available = 0;
+    int32_t last_aligned_frame_length = 0;
     *padding = 0;
 
     do
@@ -56,6 +58,13 @@ inline int32_t aeron_term_scanner_scan_for_availability(
             *padding = 0;
             break;
         }
+
+        // small messages tend to repeat the same length so check the rest of a run several frames at a time
+        if (aligned_frame_length == last_aligned_frame_length && 0 == *padding && available < limit)
+        {
+            available += aeron_term_scanner_uniform_frames(buffer + available, aligned_frame_length, limit - available);
+        }
+        last_aligned_frame_length = aligned_frame_length;
     }
     while (0 == *padding && available < limit);
 
@@ -0,0 +1,315 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "concurrent/aeron_term_scanner_simd.h"
+#include "concurrent/aeron_atomic.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+#include "protocol/aeron_udp_protocol.h"
+#include "util/aeron_platform.h"
+#include "util/aeron_error.h"
+
+#if defined(AERON_CPU_X64)
+#include <immintrin.h>
+#if defined(AERON_COMPILER_MSVC)
+#include <intrin.h>
+#define AERON_TARGET_AVX2
+#else
+#define AERON_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+#if defined(AERON_CPU_ARM)
+#include <arm_neon.h>
+#endif
+
+#define AERON_TERM_SCANNER_ZEROED_BLOCK_LENGTH (4 * AERON_LOGBUFFER_FRAME_ALIGNMENT)
+
+static int32_t aeron_term_scanner_uniform_frames_scalar(
+    const uint8_t *buffer, int32_t aligned_frame_length, int32_t length)
+{
+    return 0;
+}
+
+static int32_t aeron_term_scanner_zeroed_length_scalar(const uint8_t *buffer, int32_t length)
+{
+    return 0;
+}
+
+static const aeron_term_scanner_simd_t aeron_term_scanner_simd_scalar =
+{
+    "scalar",
+    aeron_term_scanner_uniform_frames_scalar,
+    aeron_term_scanner_zeroed_length_scalar
+};
+
+#if defined(AERON_CPU_X64)
+
+static bool aeron_term_scanner_cpu_has_avx2(void)
+{
+#if defined(AERON_COMPILER_MSVC)
+    int info[4];
+    __cpuid(info, 1);
+    const bool has_os_xsave = 0 != (info[2] & (1 << 27));
+    const bool has_avx = 0 != (info[2] & (1 << 28));
+    if (!has_os_xsave || !has_avx || 0x6 != (_xgetbv(0) & 0x6))
+    {
+        return false;
+    }
+
+    __cpuidex(info, 7, 0);
+    return 0 != (info[1] & (1 << 5));
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+AERON_TARGET_AVX2
+static int32_t aeron_term_scanner_uniform_frames_avx2(
+    const uint8_t *buffer, int32_t aligned_frame_length, int32_t length)
+{
+    const int32_t batch_length = aligned_frame_length * 8;
+    const __m256i offsets = _mm256_mullo_epi32(
+        _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(aligned_frame_length));
+    const __m256i expected_aligned_length = _mm256_set1_epi32(aligned_frame_length);
+    const __m256i alignment_add = _mm256_set1_epi32(AERON_LOGBUFFER_FRAME_ALIGNMENT - 1);
+    const __m256i alignment_mask = _mm256_set1_epi32(~(AERON_LOGBUFFER_FRAME_ALIGNMENT - 1));
+    const __m256i type_mask = _mm256_set1_epi32((int32_t)0xFFFF0000);
+    const __m256i pad_type = _mm256_set1_epi32((int32_t)((uint32_t)(uint16_t)AERON_HDR_TYPE_PAD << 16));
+    const __m256i zero = _mm256_setzero_si256();
+    int32_t offset = 0;
+
+    while (offset + batch_length <= length)
+    {
+        const int *frame = (const int *)(buffer + offset);
+
+        // frame lengths are read with acquire semantics, as in the scalar scanner, before the words holding version,
+        // flags, and type (little endian so type is the high half), so a new length is never paired with a stale type
+        const __m256i frame_lengths = _mm256_i32gather_epi32(frame, offsets, 1);
+        aeron_acquire();
+        const __m256i type_words = _mm256_i32gather_epi32(frame + 1, offsets, 1);
+
+        const __m256i aligned_lengths = _mm256_and_si256(
+            _mm256_add_epi32(frame_lengths, alignment_add), alignment_mask);
+        const __m256i is_complete = _mm256_and_si256(
+            _mm256_cmpgt_epi32(frame_lengths, zero),
+            _mm256_cmpeq_epi32(aligned_lengths, expected_aligned_length));
+        const __m256i is_pad = _mm256_cmpeq_epi32(_mm256_and_si256(type_words, type_mask), pad_type);
+
+        if (-1 != _mm256_movemask_epi8(_mm256_andnot_si256(is_pad, is_complete)))
+        {
+            break;
+        }
+
+        offset += batch_length;
+    }
+
+    return offset;
+}
+
+AERON_TARGET_AVX2
+static int32_t aeron_term_scanner_zeroed_length_avx2(const uint8_t *buffer, int32_t length)
+{
+    int32_t offset = 0;
+
+    while (offset + AERON_TERM_SCANNER_ZEROED_BLOCK_LENGTH <= length)
+    {
+        const __m256i *block = (const __m256i *)(buffer + offset);
+        const __m256i bits = _mm256_or_si256(
+            _mm256_or_si256(_mm256_loadu_si256(block), _mm256_loadu_si256(block + 1)),
+            _mm256_or_si256(_mm256_loadu_si256(block + 2), _mm256_loadu_si256(block + 3)));
+
+        if (!_mm256_testz_si256(bits, bits))
+        {
+            break;
+        }
+
+        offset += AERON_TERM_SCANNER_ZEROED_BLOCK_LENGTH;
+    }
+
+    return offset;
+}
+
+static const aeron_term_scanner_simd_t aeron_term_scanner_simd_avx2 =
+{
+    "avx2",
+    aeron_term_scanner_uniform_frames_avx2,
+    aeron_term_scanner_zeroed_length_avx2
+};
+
+#endif
+
+#if defined(AERON_CPU_ARM)
+
+#define AERON_TERM_SCANNER_NEON_LOAD_LENGTH(_frame_lengths, _frame, _lane) \
+    _frame_lengths = vld1q_lane_s32((const int32_t *)(_frame), _frame_lengths, _lane)
+
+#define AERON_TERM_SCANNER_NEON_LOAD_TYPE(_type_words, _frame, _lane) \
+    _type_words = vld1q_lane_u32((const uint32_t *)((_frame) + sizeof(int32_t)), _type_words, _lane)
+
+static int32_t aeron_term_scanner_uniform_frames_neon(
+    const uint8_t *buffer, int32_t aligned_frame_length, int32_t length)
+{
+    const int32_t batch_length = aligned_frame_length * 4;
+    const int32x4_t expected_aligned_length = vdupq_n_s32(aligned_frame_length);
+    const int32x4_t alignment_add = vdupq_n_s32(AERON_LOGBUFFER_FRAME_ALIGNMENT - 1);
+    const int32x4_t alignment_mask = vdupq_n_s32(~(AERON_LOGBUFFER_FRAME_ALIGNMENT - 1));
+    const uint32x4_t type_mask = vdupq_n_u32(0xFFFF0000);
+    const uint32x4_t pad_type = vdupq_n_u32((uint32_t)(uint16_t)AERON_HDR_TYPE_PAD << 16);
+    int32x4_t frame_lengths = vdupq_n_s32(0);
+    uint32x4_t type_words = vdupq_n_u32(0);
+    int32_t offset = 0;
+
+    while (offset + batch_length <= length)
+    {
+        const uint8_t *frame = buffer + offset;
+
+        // all lengths, then the acquire, then the type words, as in the avx2 scanner
+        AERON_TERM_SCANNER_NEON_LOAD_LENGTH(frame_lengths, frame, 0);
+        AERON_TERM_SCANNER_NEON_LOAD_LENGTH(frame_lengths, frame + aligned_frame_length, 1);
+        AERON_TERM_SCANNER_NEON_LOAD_LENGTH(frame_lengths, frame + (aligned_frame_length * 2), 2);
+        AERON_TERM_SCANNER_NEON_LOAD_LENGTH(frame_lengths, frame + (aligned_frame_length * 3), 3);
+        aeron_acquire();
+        AERON_TERM_SCANNER_NEON_LOAD_TYPE(type_words, frame, 0);
+        AERON_TERM_SCANNER_NEON_LOAD_TYPE(type_words, frame + aligned_frame_length, 1);
+        AERON_TERM_SCANNER_NEON_LOAD_TYPE(type_words, frame + (aligned_frame_length * 2), 2);
+        AERON_TERM_SCANNER_NEON_LOAD_TYPE(type_words, frame + (aligned_frame_length * 3), 3);
+
+        const int32x4_t aligned_lengths = vandq_s32(vaddq_s32(frame_lengths, alignment_add), alignment_mask);
+        const uint32x4_t is_complete = vandq_u32(
+            vcgtq_s32(frame_lengths, vdupq_n_s32(0)), vceqq_s32(aligned_lengths, expected_aligned_length));
+        const uint32x4_t is_pad = vceqq_u32(vandq_u32(type_words, type_mask), pad_type);
+
+        if (UINT32_MAX != vminvq_u32(vbicq_u32(is_complete, is_pad)))
+        {
+            break;
+        }
+
+        offset += batch_length;
+    }
+
+    return offset;
+}
+
+static int32_t aeron_term_scanner_zeroed_length_neon(const uint8_t *buffer, int32_t length)
+{
+    int32_t offset = 0;
+
+    while (offset + AERON_TERM_SCANNER_ZEROED_BLOCK_LENGTH <= length)
+    {
+        const uint8_t *block = buffer + offset;
+        uint8x16_t bits = vld1q_u8(block);
+        for (int i = 16; i < AERON_TERM_SCANNER_ZEROED_BLOCK_LENGTH; i += 16)
+        {
+            bits = vorrq_u8(bits, vld1q_u8(block + i));
+        }
+
+        if (0 != vmaxvq_u8(bits))
+        {
+            break;
+        }
+
+        offset += AERON_TERM_SCANNER_ZEROED_BLOCK_LENGTH;
+    }
+
+    return offset;
+}
+
+static const aeron_term_scanner_simd_t aeron_term_scanner_simd_neon =
+{
+    "neon",
+    aeron_term_scanner_uniform_frames_neon,
+    aeron_term_scanner_zeroed_length_neon
+};
+
+#endif
+
+static const aeron_term_scanner_simd_t *aeron_term_scanner_simd_current = NULL;
+
+static const aeron_term_scanner_simd_t *aeron_term_scanner_simd_find(const char *name)
+{
+    const aeron_term_scanner_simd_t *supported[3];
+    size_t supported_length = 0;
+
+#if defined(AERON_CPU_X64)
+    if (aeron_term_scanner_cpu_has_avx2())
+    {
+        supported[supported_length++] = &aeron_term_scanner_simd_avx2;
+    }
+#endif
+#if defined(AERON_CPU_ARM)
+    supported[supported_length++] = &aeron_term_scanner_simd_neon;
+#endif
+    supported[supported_length++] = &aeron_term_scanner_simd_scalar;
+
+    if (NULL == name)
+    {
+        return supported[0];
+    }
+
+    for (size_t i = 0; i < supported_length; i++)
+    {
+        if (0 == strcmp(name, supported[i]->name))
+        {
+            return supported[i];
+        }
+    }
+
+    return NULL;
+}
+
+const aeron_term_scanner_simd_t *aeron_term_scanner_simd(void)
+{
+    const aeron_term_scanner_simd_t *simd;
+    AERON_GET_VOLATILE(simd, aeron_term_scanner_simd_current);
+
+    if (NULL == simd)
+    {
+        // racing threads resolve to the same implementation so there is no need to coordinate
+        simd = aeron_term_scanner_simd_find(NULL);
+        AERON_PUT_ORDERED(aeron_term_scanner_simd_current, simd);
+    }
+
+    return simd;
+}
+
+int aeron_term_scanner_simd_select(const char *name)
+{
+    const aeron_term_scanner_simd_t *simd = aeron_term_scanner_simd_find(name);
+    if (NULL == simd)
+    {
+        AERON_SET_ERR(EINVAL, "term scanner implementation not supported: %s", name);
+        return -1;
+    }
+
+    AERON_PUT_ORDERED(aeron_term_scanner_simd_current, simd);
+
+    return 0;
+}
+
+int32_t aeron_term_scanner_uniform_frames(const uint8_t *buffer, int32_t aligned_frame_length, int32_t length)
+{
+    return aeron_term_scanner_simd()->uniform_frames(buffer, aligned_frame_length, length);
+}
+
+int32_t aeron_term_scanner_zeroed_length(const uint8_t *buffer, int32_t length)
+{
+    return aeron_term_scanner_simd()->zeroed_length(buffer, length);
+}
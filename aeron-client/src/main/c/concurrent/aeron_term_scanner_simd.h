@@ -0,0 +1,59 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_TERM_SCANNER_SIMD_H
+#define AERON_TERM_SCANNER_SIMD_H
+
+#include <stdint.h>
+
+/*
+ * Length from buffer of a run of whole, non padding, frames which all have the given aligned length and fit within
+ * length. Frames are checked a vector at a time at the offsets their predecessors imply, which removes the load to
+ * load dependency of walking one header at a time. Stopping short of the end of the run is always safe as callers
+ * carry on frame by frame.
+ */
+typedef int32_t (*aeron_term_scanner_uniform_frames_func_t)(
+    const uint8_t *buffer, int32_t aligned_frame_length, int32_t length);
+
+/*
+ * Length from buffer, in whole blocks that fit within length, which is entirely zero and so holds no frames.
+ */
+typedef int32_t (*aeron_term_scanner_zeroed_length_func_t)(const uint8_t *buffer, int32_t length);
+
+typedef struct aeron_term_scanner_simd_stct
+{
+    const char *name;
+    aeron_term_scanner_uniform_frames_func_t uniform_frames;
+    aeron_term_scanner_zeroed_length_func_t zeroed_length;
+}
+aeron_term_scanner_simd_t;
+
+/*
+ * Implementation in use, resolved on first use to the widest one the CPU supports.
+ */
+const aeron_term_scanner_simd_t *aeron_term_scanner_simd(void);
+
+/*
+ * Select an implementation by name, "scalar", "avx2" or "neon", or the best supported when name is NULL. Returns -1
+ * if the named implementation is unknown or not supported on this CPU.
+ */
+int aeron_term_scanner_simd_select(const char *name);
+
+int32_t aeron_term_scanner_uniform_frames(const uint8_t *buffer, int32_t aligned_frame_length, int32_t length);
+
+int32_t aeron_term_scanner_zeroed_length(const uint8_t *buffer, int32_t length);
+
+#endif //AERON_TERM_SCANNER_SIMD_H
@@ -96,6 +96,26 @@ typedef struct aeron_rttm_header_stct
 }
 aeron_rttm_header_t;
 
+#define AERON_FEC_MAX_DATAGRAMS (16)
+
+/*
+ * Parity over a group of consecutive datagrams of a term, each zero padded to the longest, which lets a receiver
+ * rebuild any one of them that goes missing. The parity follows the header.
+ */
+typedef struct aeron_fec_header_stct
+{
+    aeron_frame_header_t frame_header;
+    int32_t term_offset;
+    int32_t session_id;
+    int32_t stream_id;
+    int32_t term_id;
+    int16_t datagram_count;
+    int16_t reserved;
+    int32_t parity_length;
+    uint16_t datagram_lengths[AERON_FEC_MAX_DATAGRAMS];
+}
+aeron_fec_header_t;
+
 #pragma pack(pop)
 
 #define AERON_RES_HEADER_ADDRESS_LENGTH_IP4 (4u)
@@ -161,6 +181,7 @@ int aeron_udp_protocol_group_tag(aeron_status_message_header_t *sm, int64_t *gro
 #define AERON_HDR_TYPE_ATS_SETUP (INT16_C(0x09))
 #define AERON_HDR_TYPE_ATS_SM (INT16_C(0x0A))
 #define AERON_HDR_TYPE_RSP_SETUP (INT16_C(0x0B))
+#define AERON_HDR_TYPE_FEC (INT16_C(0x0C))
 #define AERON_HDR_TYPE_EXT (INT16_C(-1))
 
 #define AERON_DATA_HEADER_LENGTH (sizeof(aeron_data_header_t))
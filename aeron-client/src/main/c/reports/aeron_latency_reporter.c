@@ -0,0 +1,233 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include "reports/aeron_latency_reporter.h"
+#include "util/aeron_fileutil.h"
+
+int aeron_latency_reporter_init(aeron_latency_reporter_t *reporter, uint8_t *buffer, size_t length)
+{
+    reporter->buffer = buffer;
+    reporter->next_record_offset = 0;
+    reporter->capacity = length;
+
+    return 0;
+}
+
+aeron_latency_reporter_entry_offset_t aeron_latency_reporter_create_entry(
+    aeron_latency_reporter_t *reporter,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    int32_t hop,
+    const char *channel,
+    size_t channel_length)
+{
+    aeron_latency_reporter_entry_offset_t entry_offset = -1;
+    const size_t required_capacity = sizeof(aeron_latency_reporter_entry_t) + channel_length;
+
+    if (required_capacity <= (reporter->capacity - reporter->next_record_offset))
+    {
+        uint8_t *ptr = reporter->buffer + reporter->next_record_offset;
+        aeron_latency_reporter_entry_t *entry = (aeron_latency_reporter_entry_t *)ptr;
+
+        entry->registration_id = registration_id;
+        entry->session_id = session_id;
+        entry->stream_id = stream_id;
+        entry->channel_length = (int32_t)channel_length;
+        memcpy(ptr + sizeof(aeron_latency_reporter_entry_t), channel, channel_length);
+
+        AERON_PUT_ORDERED(entry->hop, hop);
+
+        entry_offset = (aeron_latency_reporter_entry_offset_t)reporter->next_record_offset;
+        reporter->next_record_offset += AERON_ALIGN(required_capacity, AERON_LATENCY_REPORTER_ENTRY_ALIGNMENT);
+    }
+    else
+    {
+        AERON_SET_ERR(ENOMEM, "could not create latency report entry: %s", strerror(ENOMEM));
+    }
+
+    return entry_offset;
+}
+
+static int aeron_latency_reporter_highest_bit(uint64_t value)
+{
+    const int32_t upper = (int32_t)(value >> 32u);
+
+    return 0 != upper ?
+        63 - aeron_number_of_leading_zeroes(upper) :
+        31 - aeron_number_of_leading_zeroes((int32_t)(value & UINT64_C(0xFFFFFFFF)));
+}
+
+size_t aeron_latency_reporter_bucket_index(int64_t value_ns)
+{
+    if (value_ns < AERON_LATENCY_REPORT_SUB_BUCKET_COUNT)
+    {
+        return value_ns < 0 ? 0 : (size_t)value_ns;
+    }
+
+    const int shift = aeron_latency_reporter_highest_bit((uint64_t)value_ns) - AERON_LATENCY_REPORT_SUB_BUCKET_BITS;
+    const size_t index = ((size_t)(shift + 1) << AERON_LATENCY_REPORT_SUB_BUCKET_BITS) +
+        (size_t)((value_ns >> shift) & (AERON_LATENCY_REPORT_SUB_BUCKET_COUNT - 1));
+
+    return index < AERON_LATENCY_REPORT_BUCKET_COUNT ? index : AERON_LATENCY_REPORT_BUCKET_COUNT - 1;
+}
+
+int64_t aeron_latency_reporter_bucket_highest_value(size_t index)
+{
+    if (index < AERON_LATENCY_REPORT_SUB_BUCKET_COUNT)
+    {
+        return (int64_t)index;
+    }
+
+    if (index >= AERON_LATENCY_REPORT_BUCKET_COUNT - 1)
+    {
+        return INT64_MAX;
+    }
+
+    const size_t shift = (index >> AERON_LATENCY_REPORT_SUB_BUCKET_BITS) - 1;
+    const int64_t sub_bucket = (int64_t)(index & (AERON_LATENCY_REPORT_SUB_BUCKET_COUNT - 1));
+    const int64_t lowest_value = (AERON_LATENCY_REPORT_SUB_BUCKET_COUNT + sub_bucket) << shift;
+
+    return lowest_value + ((INT64_C(1) << shift) - 1);
+}
+
+void aeron_latency_reporter_record(
+    aeron_latency_reporter_t *reporter, aeron_latency_reporter_entry_offset_t offset, int64_t value_ns)
+{
+    if (offset >= 0)
+    {
+        aeron_latency_reporter_entry_t *entry = (aeron_latency_reporter_entry_t *)(reporter->buffer + offset);
+        const int64_t value = value_ns < 0 ? 0 : value_ns;
+        const size_t index = aeron_latency_reporter_bucket_index(value);
+
+        AERON_PUT_ORDERED(entry->buckets[index], entry->buckets[index] + 1);
+        AERON_PUT_ORDERED(entry->total_ns, entry->total_ns + value);
+        if (value > entry->max_ns)
+        {
+            AERON_PUT_ORDERED(entry->max_ns, value);
+        }
+        AERON_PUT_ORDERED(entry->sample_count, entry->sample_count + 1);
+    }
+}
+
+int aeron_latency_reporter_resolve_filename(const char *directory, char *filename_buffer, size_t filename_buffer_length)
+{
+    return aeron_file_resolve(directory, AERON_LATENCY_REPORT_FILE, filename_buffer, filename_buffer_length);
+}
+
+size_t aeron_latency_reporter_read(
+    const uint8_t *buffer, size_t capacity, aeron_latency_reporter_read_entry_func_t entry_func, void *clientd)
+{
+    size_t records_read = 0;
+    size_t offset = 0;
+    int64_t buckets[AERON_LATENCY_REPORT_BUCKET_COUNT];
+
+    while (offset + sizeof(aeron_latency_reporter_entry_t) <= capacity)
+    {
+        aeron_latency_reporter_entry_t *entry = (aeron_latency_reporter_entry_t *)(buffer + offset);
+
+        int32_t hop;
+        AERON_GET_VOLATILE(hop, entry->hop);
+        if (hop <= 0)
+        {
+            break;
+        }
+
+        ++records_read;
+
+        int64_t sample_count;
+        AERON_GET_VOLATILE(sample_count, entry->sample_count);
+
+        int64_t total_ns;
+        AERON_GET_VOLATILE(total_ns, entry->total_ns);
+
+        int64_t max_ns;
+        AERON_GET_VOLATILE(max_ns, entry->max_ns);
+
+        for (size_t i = 0; i < AERON_LATENCY_REPORT_BUCKET_COUNT; i++)
+        {
+            AERON_GET_VOLATILE(buckets[i], entry->buckets[i]);
+        }
+
+        entry_func(
+            clientd,
+            entry->registration_id,
+            entry->session_id,
+            entry->stream_id,
+            hop,
+            (const char *)entry + sizeof(aeron_latency_reporter_entry_t),
+            entry->channel_length,
+            sample_count,
+            total_ns,
+            max_ns,
+            buckets,
+            AERON_LATENCY_REPORT_BUCKET_COUNT);
+
+        const size_t record_length = sizeof(aeron_latency_reporter_entry_t) + (size_t)entry->channel_length;
+        offset += AERON_ALIGN(record_length, AERON_LATENCY_REPORTER_ENTRY_ALIGNMENT);
+    }
+
+    return records_read;
+}
+
+const char *aeron_latency_report_hop_name(int32_t hop)
+{
+    switch (hop)
+    {
+        case AERON_LATENCY_REPORT_HOP_SEND_TO_WIRE:
+            return "snd-wire";
+
+        case AERON_LATENCY_REPORT_HOP_WIRE_TO_TERM:
+            return "wire-term";
+
+        case AERON_LATENCY_REPORT_HOP_TERM_TO_SUBSCRIBER:
+            return "term-sub";
+
+        default:
+            return "unknown";
+    }
+}
+
+int64_t aeron_latency_report_value_at_percentile(const int64_t *buckets, size_t bucket_count, double percentile)
+{
+    int64_t total_count = 0;
+    for (size_t i = 0; i < bucket_count; i++)
+    {
+        total_count += buckets[i];
+    }
+
+    if (0 == total_count)
+    {
+        return 0;
+    }
+
+    const double clamped_percentile = percentile < 0.0 ? 0.0 : (percentile > 100.0 ? 100.0 : percentile);
+    int64_t count_at_percentile = (int64_t)(((clamped_percentile / 100.0) * (double)total_count) + 0.5);
+    count_at_percentile = count_at_percentile < 1 ? 1 : count_at_percentile;
+
+    int64_t count_to_index = 0;
+    for (size_t i = 0; i < bucket_count; i++)
+    {
+        count_to_index += buckets[i];
+        if (count_to_index >= count_at_percentile)
+        {
+            return aeron_latency_reporter_bucket_highest_value(i);
+        }
+    }
+
+    return aeron_latency_reporter_bucket_highest_value(bucket_count - 1);
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_LATENCY_REPORTER_H
+#define AERON_LATENCY_REPORTER_H
+
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include "aeronc.h"
+#include "concurrent/aeron_atomic.h"
+#include "util/aeron_error.h"
+#include "util/aeron_bitutil.h"
+
+#define AERON_LATENCY_REPORT_FILE "latency-report.dat"
+
+/*
+ * Histograms are log-linear in the style of HdrHistogram. Values below AERON_LATENCY_REPORT_SUB_BUCKET_COUNT
+ * have a bucket each, after which every power of two is split into AERON_LATENCY_REPORT_SUB_BUCKET_COUNT buckets,
+ * giving a worst case error of 12.5%. 256 buckets cover values up to 2^34 ns (~17s) and larger values are counted
+ * in the last bucket.
+ */
+#define AERON_LATENCY_REPORT_SUB_BUCKET_BITS (3)
+#define AERON_LATENCY_REPORT_SUB_BUCKET_COUNT (1 << AERON_LATENCY_REPORT_SUB_BUCKET_BITS)
+
+#pragma pack(push)
+#pragma pack(4)
+typedef struct aeron_latency_reporter_entry_stct
+{
+    volatile int64_t sample_count;
+    volatile int64_t total_ns;
+    volatile int64_t max_ns;
+    int64_t registration_id;
+    int32_t session_id;
+    int32_t stream_id;
+    volatile int32_t hop;
+    int32_t channel_length;
+    volatile int64_t buckets[AERON_LATENCY_REPORT_BUCKET_COUNT];
+}
+aeron_latency_reporter_entry_t;
+#pragma pack(pop)
+
+#define AERON_LATENCY_REPORTER_ENTRY_ALIGNMENT (AERON_CACHE_LINE_LENGTH)
+
+typedef struct aeron_latency_reporter_stct
+{
+    uint8_t *buffer;
+    size_t next_record_offset;
+    size_t capacity;
+}
+aeron_latency_reporter_t;
+
+typedef int64_t aeron_latency_reporter_entry_offset_t;
+
+int aeron_latency_reporter_init(aeron_latency_reporter_t *reporter, uint8_t *buffer, size_t length);
+
+aeron_latency_reporter_entry_offset_t aeron_latency_reporter_create_entry(
+    aeron_latency_reporter_t *reporter,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    int32_t hop,
+    const char *channel,
+    size_t channel_length);
+
+/*
+ * Each entry has a single writer so recording is a sequence of ordered stores rather than atomic adds. Readers may
+ * see the fields of an entry from slightly different points in time.
+ */
+void aeron_latency_reporter_record(
+    aeron_latency_reporter_t *reporter, aeron_latency_reporter_entry_offset_t offset, int64_t value_ns);
+
+size_t aeron_latency_reporter_bucket_index(int64_t value_ns);
+
+int64_t aeron_latency_reporter_bucket_highest_value(size_t index);
+
+int aeron_latency_reporter_resolve_filename(const char *directory, char *filename_buffer, size_t filename_buffer_length);
+
+size_t aeron_latency_reporter_read(
+    const uint8_t *buffer, size_t capacity, aeron_latency_reporter_read_entry_func_t entry_func, void *clientd);
+
+#endif //AERON_LATENCY_REPORTER_H
@@ -53,6 +53,7 @@ aeron_uri_params_t;
 #define AERON_URI_LINGER_TIMEOUT_KEY "linger"
 #define AERON_URI_MTU_LENGTH_KEY "mtu"
 #define AERON_URI_SPARSE_TERM_KEY "sparse"
+#define AERON_URI_HUGE_PAGES_KEY "huge-pages"
 #define AERON_URI_EOS_KEY "eos"
 #define AERON_URI_TETHER_KEY "tether"
 #define AERON_URI_TAGS_KEY "tags"
@@ -75,6 +76,10 @@ aeron_uri_params_t;
 #define AERON_URI_NAK_DELAY_KEY "nak-delay"
 #define AERON_URI_UNTETHERED_WINDOW_LIMIT_TIMEOUT_KEY "untethered-window-limit-timeout"
 #define AERON_URI_UNTETHERED_RESTING_TIMEOUT_KEY "untethered-resting-timeout"
+#define AERON_URI_SENDER_ID_KEY "sender-id"
+#define AERON_URI_RATE_KEY "rate"
+#define AERON_URI_BURST_KEY "burst"
+#define AERON_URI_FEC_KEY "fec"
 #define AERON_URI_INVALID_TAG (-1)
 
 typedef struct aeron_udp_channel_params_stct
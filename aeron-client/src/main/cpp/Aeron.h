@@ -281,6 +281,175 @@ public:
         return m_conductor.findCounter(registrationId);
     }
 
+    /**
+     * Create a batch of add and close commands which is sent to the media driver as a single command when submitted.
+     * This is cheaper than adding or closing each {@link Publication}, {@link Subscription}, or {@link Counter} on its
+     * own when many are created or closed at once, e.g. on start up or shutdown.
+     *
+     * The registration ids returned when adding to the batch are resolved with the usual find methods once the
+     * batch has been submitted with Aeron::submitBatch.
+     *
+     * @return id of the batch to add commands to.
+     */
+    inline std::int64_t createBatch()
+    {
+        return m_conductor.createBatch();
+    }
+
+    /**
+     * Add a {@link Publication} to a batch.
+     *
+     * @param batchId  returned by Aeron::createBatch.
+     * @param channel  for sending the messages known to the media layer.
+     * @param streamId within the channel scope.
+     * @return registration id for the publication
+     */
+    inline std::int64_t addPublication(std::int64_t batchId, const std::string &channel, std::int32_t streamId)
+    {
+        return m_conductor.addPublication(batchId, channel, streamId);
+    }
+
+    /**
+     * Add an {@link ExclusivePublication} to a batch.
+     *
+     * @param batchId  returned by Aeron::createBatch.
+     * @param channel  for sending the messages known to the media layer.
+     * @param streamId within the channel scope.
+     * @return registration id for the publication
+     */
+    inline std::int64_t addExclusivePublication(
+        std::int64_t batchId, const std::string &channel, std::int32_t streamId)
+    {
+        return m_conductor.addExclusivePublication(batchId, channel, streamId);
+    }
+
+    /**
+     * Add a {@link Subscription} to a batch using the default image handlers from the {@link Context}.
+     *
+     * @param batchId  returned by Aeron::createBatch.
+     * @param channel  for receiving the messages known to the media layer.
+     * @param streamId within the channel scope.
+     * @return registration id for the subscription
+     */
+    inline std::int64_t addSubscription(std::int64_t batchId, const std::string &channel, std::int32_t streamId)
+    {
+        return m_conductor.addSubscription(
+            batchId, channel, streamId, m_context.m_onAvailableImageHandler, m_context.m_onUnavailableImageHandler);
+    }
+
+    /**
+     * Add a {@link Subscription} to a batch.
+     *
+     * @param batchId                 returned by Aeron::createBatch.
+     * @param channel                 for receiving the messages known to the media layer.
+     * @param streamId                within the channel scope.
+     * @param availableImageHandler   called when {@link Image}s become available for consumption.
+     * @param unavailableImageHandler called when {@link Image}s go unavailable for consumption.
+     * @return registration id for the subscription
+     */
+    inline std::int64_t addSubscription(
+        std::int64_t batchId,
+        const std::string &channel,
+        std::int32_t streamId,
+        const on_available_image_t &onAvailableImageHandler,
+        const on_unavailable_image_t &onUnavailableImageHandler)
+    {
+        return m_conductor.addSubscription(
+            batchId, channel, streamId, onAvailableImageHandler, onUnavailableImageHandler);
+    }
+
+    /**
+     * Add a {@link Counter} to a batch.
+     *
+     * @param batchId   returned by Aeron::createBatch.
+     * @param typeId    for the counter.
+     * @param keyBuffer containing the optional key for the counter.
+     * @param keyLength of the key in the keyBuffer.
+     * @param label     for the counter.
+     * @return registration id for the Counter
+     */
+    inline std::int64_t addCounter(
+        std::int64_t batchId,
+        std::int32_t typeId,
+        const std::uint8_t *keyBuffer,
+        std::size_t keyLength,
+        const std::string &label)
+    {
+        return m_conductor.addCounter(batchId, typeId, keyBuffer, keyLength, label);
+    }
+
+    /**
+     * Add the close of a {@link Publication} to a batch. The publication stays open until the batch is submitted,
+     * after which it is closed and must no longer be used through any reference to it.
+     *
+     * @param batchId     returned by Aeron::createBatch.
+     * @param publication to close.
+     */
+    inline void close(std::int64_t batchId, const std::shared_ptr<Publication> &publication)
+    {
+        m_conductor.close(batchId, publication);
+    }
+
+    /**
+     * Add the close of an {@link ExclusivePublication} to a batch. The publication stays open until the batch is
+     * submitted, after which it is closed and must no longer be used through any reference to it.
+     *
+     * @param batchId     returned by Aeron::createBatch.
+     * @param publication to close.
+     */
+    inline void close(std::int64_t batchId, const std::shared_ptr<ExclusivePublication> &publication)
+    {
+        m_conductor.close(batchId, publication);
+    }
+
+    /**
+     * Add the close of a {@link Subscription} to a batch. The subscription stays open until the batch is submitted,
+     * after which it is closed and must no longer be used through any reference to it.
+     *
+     * @param batchId      returned by Aeron::createBatch.
+     * @param subscription to close.
+     */
+    inline void close(std::int64_t batchId, const std::shared_ptr<Subscription> &subscription)
+    {
+        m_conductor.close(batchId, subscription);
+    }
+
+    /**
+     * Add the close of a {@link Counter} to a batch. The counter stays open until the batch is submitted, after
+     * which it is closed and must no longer be used through any reference to it.
+     *
+     * @param batchId returned by Aeron::createBatch.
+     * @param counter to close.
+     */
+    inline void close(std::int64_t batchId, const std::shared_ptr<Counter> &counter)
+    {
+        m_conductor.close(batchId, counter);
+    }
+
+    /**
+     * Submit a batch to the media driver as a single command. No further commands can be added to it.
+     *
+     * @param batchId returned by Aeron::createBatch.
+     */
+    inline void submitBatch(std::int64_t batchId)
+    {
+        m_conductor.submitBatch(batchId);
+    }
+
+    /**
+     * Check if the media driver has processed every command in a submitted batch.
+     *
+     * This method is non-blocking and will throw if any command in the batch failed, in which case the failed
+     * resources also throw when found.
+     *
+     * @param batchId returned by Aeron::createBatch.
+     * @return true if the batch is complete, otherwise false.
+     */
+    inline bool findBatchResponse(std::int64_t batchId)
+    {
+        return m_conductor.findBatchResponse(batchId);
+    }
+
     /**
      * Add a handler to the list to be called when a counter becomes available.
      *
@@ -17,6 +17,7 @@
 #define AERON_BUFFERBUILDER_H
 
 #include <limits>
+#include <vector>
 
 #include "Aeron.h"
 #include "protocol/DataHeaderFlyweight.h"
@@ -56,7 +57,8 @@ public:
         m_nextTermOffset(builder.m_nextTermOffset),
         m_buffer(std::move(builder.m_buffer)),
         m_headerBuffer(std::move(builder.m_headerBuffer)),
-        m_header(std::move(builder.m_header))
+        m_header(std::move(builder.m_header)),
+        m_views(std::move(builder.m_views))
     {
     }
 
@@ -102,6 +104,7 @@ public:
         m_limit = 0;
         m_nextTermOffset = NULL_VALUE;
         m_header.fragmentedFrameLength(NULL_VALUE);
+        m_views.clear();
         return *this;
     }
 
@@ -126,6 +129,21 @@ public:
         return *this;
     }
 
+    /**
+     * Append a view of the region in place of a copy. The region must remain valid until the views are consumed.
+     */
+    this_t &appendView(AtomicBuffer &buffer, util::index_t offset, util::index_t length)
+    {
+        m_views.emplace_back(buffer.buffer() + offset, static_cast<std::size_t>(length));
+        m_limit += length;
+        return *this;
+    }
+
+    const std::vector<AtomicBuffer> &views() const
+    {
+        return m_views;
+    }
+
     this_t &captureHeader(const Header &header)
     {
         m_header.copyFrom(header);
@@ -157,6 +175,7 @@ private:
     std::unique_ptr<std::uint8_t[]> m_buffer = {};
     std::unique_ptr<std::uint8_t[]> m_headerBuffer = {};
     Header m_header;
+    std::vector<AtomicBuffer> m_views;
 
     inline static std::uint32_t findSuitableCapacity(
         std::uint32_t currentCapacity, std::uint32_t requiredCapacity) noexcept
@@ -36,8 +36,53 @@ static ExceptionCategory getCategory(std::int32_t errorCode)
         ExceptionCategory::EXCEPTION_CATEGORY_WARN : ExceptionCategory::EXCEPTION_CATEGORY_ERROR;
 }
 
+/*
+ * Callbacks run on the conductor thread and, for images of a released subscription, on the releasing thread, so
+ * reentrancy is tracked per thread rather than per conductor.
+ */
+static thread_local const ClientConductor *callbackConductor = nullptr;
+
+class ConductorCallbackGuard
+{
+public:
+    explicit ConductorCallbackGuard(const ClientConductor *conductor) : m_previousConductor(callbackConductor)
+    {
+        callbackConductor = conductor;
+    }
+
+    ~ConductorCallbackGuard()
+    {
+        callbackConductor = m_previousConductor;
+    }
+
+    ConductorCallbackGuard(const ConductorCallbackGuard &) = delete;
+
+    ConductorCallbackGuard &operator=(const ConductorCallbackGuard &) = delete;
+
+private:
+    const ClientConductor *m_previousConductor;
+};
+
 ClientConductor::~ClientConductor()
 {
+    m_isClosed.store(true, std::memory_order_release);
+    processCommands();
+
+    // resources still cached are destroyed here and see the conductor closed when they release themselves
+    m_clientPublicationByRegistrationId.clear();
+    m_clientExclusivePublicationByRegistrationId.clear();
+    m_clientSubscriptionByRegistrationId.clear();
+    m_clientCounterByRegistrationId.clear();
+    m_clientDestinationStateByCorrelationId.clear();
+    m_clientBatchByRegistrationId.clear();
+
+    m_publicationByRegistrationId.clear();
+    m_exclusivePublicationByRegistrationId.clear();
+    m_subscriptionByRegistrationId.clear();
+    m_counterByRegistrationId.clear();
+    m_destinationStateByCorrelationId.clear();
+    m_batchByRegistrationId.clear();
+
     std::for_each(m_lingeringImageLists.begin(), m_lingeringImageLists.end(),
         [](ImageListLingerDefn &entry)
         {
@@ -54,9 +99,9 @@ void ClientConductor::onStart()
 
 int ClientConductor::doWork()
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     int workCount = 0;
 
+    workCount += processCommands();
     workCount += m_driverListenerAdapter.receiveMessages();
     workCount += onHeartbeatCheckTimeouts();
 
@@ -67,187 +112,190 @@ void ClientConductor::onClose()
 {
     if (!m_isClosed)
     {
-        std::lock_guard<std::recursive_mutex> lock(m_adminLock);
         closeAllResources(m_epochClock());
     }
 }
 
-std::int64_t ClientConductor::addPublication(const std::string &channel, std::int32_t streamId)
+void ClientConductor::ensureNotReentrant()
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
-    verifyDriverIsActive();
-    ensureNotReentrant();
-    ensureOpen();
+    if (this == callbackConductor)
+    {
+        ReentrantException exception("client cannot be invoked within callback", SOURCEINFO);
+        m_errorHandler(exception);
+    }
+}
 
-    std::int64_t registrationId = m_driverProxy.addPublication(channel, streamId);
+void ClientConductor::offerCommand(command_t &&command)
+{
+    m_commandQueue.offer(std::move(command));
+}
 
-    m_publicationByRegistrationId.insert(std::pair<std::int64_t, PublicationStateDefn>(
-        registrationId,
-        PublicationStateDefn(channel, registrationId, streamId, m_epochClock())));
+int ClientConductor::processCommands()
+{
+    return static_cast<int>(m_commandQueue.drainAll([](command_t &command) { command(); }));
+}
 
-    return registrationId;
+template<typename S>
+void ClientConductor::registerState(
+    state_map_t<S> &clientStateMap, state_map_t<S> &stateMap, std::int64_t id, const std::shared_ptr<S> &state)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_clientLock);
+        clientStateMap.emplace(id, state);
+    }
+
+    try
+    {
+        offerCommand([&stateMap, id, state]() { stateMap.emplace(id, state); });
+    }
+    catch (...)
+    {
+        removeClientState(clientStateMap, id);
+        throw;
+    }
 }
 
-std::shared_ptr<Publication> ClientConductor::findPublication(std::int64_t registrationId)
+template<typename S>
+void ClientConductor::releaseState(state_map_t<S> &stateMap, std::int64_t registrationId)
+{
+    offerCommand([&stateMap, registrationId]() { stateMap.erase(registrationId); });
+}
+
+template<typename T, typename S>
+std::shared_ptr<T> ClientConductor::findResource(state_map_t<S> &clientStateMap, std::int64_t registrationId)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     ensureNotReentrant();
     ensureOpen();
 
-    auto it = m_publicationByRegistrationId.find(registrationId);
-    if (it == m_publicationByRegistrationId.end())
+    std::shared_ptr<S> state = findClientState(clientStateMap, registrationId);
+    if (!state)
     {
         return {};
     }
 
-    PublicationStateDefn &state = it->second;
-    std::shared_ptr<Publication> pub(state.m_publication.lock());
+    std::shared_ptr<T> resource;
 
-    if (!pub)
+    switch (state->m_status.load(std::memory_order_acquire))
     {
-        switch (state.m_status)
-        {
-            case RegistrationStatus::AWAITING_MEDIA_DRIVER:
-                if (m_epochClock() > (state.m_timeOfRegistrationMs + m_driverTimeoutMs))
-                {
-                    throw DriverTimeoutException(
-                        "no response from driver in " + std::to_string(m_driverTimeoutMs) + " ms", SOURCEINFO);
-                }
-                break;
-
-            case RegistrationStatus::REGISTERED_MEDIA_DRIVER:
+        case RegistrationStatus::AWAITING_MEDIA_DRIVER:
+            if (m_epochClock() > (state->m_timeOfRegistrationMs + m_driverTimeoutMs))
             {
-                UnsafeBufferPosition publicationLimit(m_counterValuesBuffer, state.m_publicationLimitCounterId);
-
-                pub = std::make_shared<Publication>(
-                    *this,
-                    state.m_channel,
-                    state.m_registrationId,
-                    state.m_originalRegistrationId,
-                    state.m_streamId,
-                    state.m_sessionId,
-                    publicationLimit,
-                    state.m_channelStatusId,
-                    state.m_buffers);
-
-                state.m_publication = std::weak_ptr<Publication>(pub);
-                break;
+                throw DriverTimeoutException(
+                    "no response from driver in " + std::to_string(m_driverTimeoutMs) + " ms", SOURCEINFO);
             }
+            break;
 
-            case RegistrationStatus::ERRORED_MEDIA_DRIVER:
+        case RegistrationStatus::REGISTERED_MEDIA_DRIVER:
+            resource = state->claimResourceCache();
+            if (!resource)
             {
-                const std::int32_t errorCode = state.m_errorCode;
-                const std::string errorMessage = state.m_errorMessage;
-
-                m_publicationByRegistrationId.erase(it);
-
-                throw RegistrationException(errorCode, getCategory(errorCode), errorMessage, SOURCEINFO);
+                resource = state->m_resource.lock();
             }
-        }
-    }
+            break;
 
-    return pub;
-}
+        case RegistrationStatus::ERRORED_MEDIA_DRIVER:
+        {
+            removeClientState(clientStateMap, registrationId);
 
-void ClientConductor::releasePublication(std::int64_t registrationId)
-{
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
-    verifyDriverIsActiveViaErrorHandler();
+            const std::int32_t errorCode = state->m_errorCode;
+            throw RegistrationException(errorCode, getCategory(errorCode), state->m_errorMessage, SOURCEINFO);
+        }
 
-    auto it = m_publicationByRegistrationId.find(registrationId);
-    if (it != m_publicationByRegistrationId.end())
-    {
-        m_driverProxy.removePublication(registrationId);
-        m_publicationByRegistrationId.erase(it);
+        case RegistrationStatus::REMOVED_BY_CONDUCTOR:
+            removeClientState(clientStateMap, registrationId);
+            break;
     }
+
+    return resource;
 }
 
-std::int64_t ClientConductor::addExclusivePublication(const std::string &channel, std::int32_t streamId)
+std::int64_t ClientConductor::addPublication(const std::string &channel, std::int32_t streamId)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     verifyDriverIsActive();
     ensureNotReentrant();
     ensureOpen();
 
-    std::int64_t registrationId = m_driverProxy.addExclusivePublication(channel, streamId);
+    const std::int64_t registrationId = m_driverProxy.nextCorrelationId();
 
-    m_exclusivePublicationByRegistrationId.insert(std::pair<std::int64_t, ExclusivePublicationStateDefn>(
+    registerState(
+        m_clientPublicationByRegistrationId,
+        m_publicationByRegistrationId,
         registrationId,
-        ExclusivePublicationStateDefn(channel, registrationId, streamId, m_epochClock())));
+        std::make_shared<PublicationStateDefn>(channel, registrationId, streamId, m_epochClock()));
+    m_driverProxy.addPublication(registrationId, channel, streamId);
 
     return registrationId;
 }
 
-std::shared_ptr<ExclusivePublication> ClientConductor::findExclusivePublication(std::int64_t registrationId)
+std::shared_ptr<Publication> ClientConductor::findPublication(std::int64_t registrationId)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
-    ensureNotReentrant();
-    ensureOpen();
+    return findResource<Publication>(m_clientPublicationByRegistrationId, registrationId);
+}
 
-    auto it = m_exclusivePublicationByRegistrationId.find(registrationId);
-    if (it == m_exclusivePublicationByRegistrationId.end())
+void ClientConductor::releasePublication(std::int64_t registrationId, bool isRemoveBatched)
+{
+    verifyDriverIsActiveViaErrorHandler();
+
+    if (isClosed())
     {
-        return {};
+        return;
     }
 
-    ExclusivePublicationStateDefn &state = it->second;
-    std::shared_ptr<ExclusivePublication> pub(state.m_publication.lock());
+    std::shared_ptr<PublicationStateDefn> state =
+        removeClientState(m_clientPublicationByRegistrationId, registrationId);
 
-    if (!pub)
+    if (state && RegistrationStatus::REMOVED_BY_CONDUCTOR != state->m_status.load(std::memory_order_acquire))
     {
-        switch (state.m_status)
+        if (!isRemoveBatched)
         {
-            case RegistrationStatus::AWAITING_MEDIA_DRIVER:
-                if (m_epochClock() > (state.m_timeOfRegistrationMs + m_driverTimeoutMs))
-                {
-                    throw DriverTimeoutException(
-                        "no response from driver in " + std::to_string(m_driverTimeoutMs) + " ms", SOURCEINFO);
-                }
-                break;
+            m_driverProxy.removePublication(registrationId);
+        }
+        releaseState(m_publicationByRegistrationId, registrationId);
+    }
+}
 
-            case RegistrationStatus::REGISTERED_MEDIA_DRIVER:
-            {
-                UnsafeBufferPosition publicationLimit(m_counterValuesBuffer, state.m_publicationLimitCounterId);
-
-                pub = std::make_shared<ExclusivePublication>(
-                    *this,
-                    state.m_channel,
-                    state.m_registrationId,
-                    state.m_streamId,
-                    state.m_sessionId,
-                    publicationLimit,
-                    state.m_channelStatusId,
-                    state.m_buffers);
-
-                state.m_publication = std::weak_ptr<ExclusivePublication>(pub);
-                break;
-            }
+std::int64_t ClientConductor::addExclusivePublication(const std::string &channel, std::int32_t streamId)
+{
+    verifyDriverIsActive();
+    ensureNotReentrant();
+    ensureOpen();
 
-            case RegistrationStatus::ERRORED_MEDIA_DRIVER:
-            {
-                const std::int32_t errorCode = state.m_errorCode;
-                const std::string errorMessage = state.m_errorMessage;
+    const std::int64_t registrationId = m_driverProxy.nextCorrelationId();
 
-                m_exclusivePublicationByRegistrationId.erase(it);
+    registerState(
+        m_clientExclusivePublicationByRegistrationId,
+        m_exclusivePublicationByRegistrationId,
+        registrationId,
+        std::make_shared<ExclusivePublicationStateDefn>(channel, registrationId, streamId, m_epochClock()));
+    m_driverProxy.addExclusivePublication(registrationId, channel, streamId);
 
-                throw RegistrationException(errorCode, getCategory(errorCode), errorMessage, SOURCEINFO);
-            }
-        }
-    }
+    return registrationId;
+}
 
-    return pub;
+std::shared_ptr<ExclusivePublication> ClientConductor::findExclusivePublication(std::int64_t registrationId)
+{
+    return findResource<ExclusivePublication>(m_clientExclusivePublicationByRegistrationId, registrationId);
 }
 
-void ClientConductor::releaseExclusivePublication(std::int64_t registrationId)
+void ClientConductor::releaseExclusivePublication(std::int64_t registrationId, bool isRemoveBatched)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     verifyDriverIsActiveViaErrorHandler();
 
-    auto it = m_exclusivePublicationByRegistrationId.find(registrationId);
-    if (it != m_exclusivePublicationByRegistrationId.end())
+    if (isClosed())
+    {
+        return;
+    }
+
+    std::shared_ptr<ExclusivePublicationStateDefn> state =
+        removeClientState(m_clientExclusivePublicationByRegistrationId, registrationId);
+
+    if (state && RegistrationStatus::REMOVED_BY_CONDUCTOR != state->m_status.load(std::memory_order_acquire))
     {
-        m_driverProxy.removePublication(registrationId);
-        m_exclusivePublicationByRegistrationId.erase(it);
+        if (!isRemoveBatched)
+        {
+            m_driverProxy.removePublication(registrationId);
+        }
+        releaseState(m_exclusivePublicationByRegistrationId, registrationId);
     }
 }
 
@@ -257,83 +305,62 @@ std::int64_t ClientConductor::addSubscription(
     const on_available_image_t &onAvailableImageHandler,
     const on_unavailable_image_t &onUnavailableImageHandler)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     verifyDriverIsActive();
     ensureNotReentrant();
     ensureOpen();
 
-    std::int64_t registrationId = m_driverProxy.addSubscription(channel, streamId);
+    const std::int64_t registrationId = m_driverProxy.nextCorrelationId();
 
-    m_subscriptionByRegistrationId.insert(std::pair<std::int64_t, SubscriptionStateDefn>(
+    registerState(
+        m_clientSubscriptionByRegistrationId,
+        m_subscriptionByRegistrationId,
         registrationId,
-        SubscriptionStateDefn(
-            channel, registrationId, streamId, m_epochClock(), onAvailableImageHandler, onUnavailableImageHandler)));
+        std::make_shared<SubscriptionStateDefn>(
+            channel, registrationId, streamId, m_epochClock(), onAvailableImageHandler, onUnavailableImageHandler));
+    m_driverProxy.addSubscription(registrationId, channel, streamId);
 
     return registrationId;
 }
 
 std::shared_ptr<Subscription> ClientConductor::findSubscription(std::int64_t registrationId)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
-    ensureNotReentrant();
-    ensureOpen();
-
-    auto it = m_subscriptionByRegistrationId.find(registrationId);
-    if (it == m_subscriptionByRegistrationId.end())
-    {
-        return {};
-    }
+    return findResource<Subscription>(m_clientSubscriptionByRegistrationId, registrationId);
+}
 
-    SubscriptionStateDefn &state = it->second;
-    std::shared_ptr<Subscription> sub = state.m_subscription.lock();
+void ClientConductor::releaseSubscription(
+    std::int64_t registrationId, Image::array_t imageArray, std::size_t length, bool isRemoveBatched)
+{
+    verifyDriverIsActiveViaErrorHandler();
 
-    if (state.m_subscriptionCache)
+    std::shared_ptr<SubscriptionStateDefn> state;
+    if (!isClosed())
     {
-        state.m_subscriptionCache.reset();
+        state = removeClientState(m_clientSubscriptionByRegistrationId, registrationId);
     }
 
-    if (!sub && RegistrationStatus::AWAITING_MEDIA_DRIVER == state.m_status)
+    if (state && RegistrationStatus::REMOVED_BY_CONDUCTOR != state->m_status.load(std::memory_order_acquire))
     {
-        if (m_epochClock() > (state.m_timeOfRegistrationMs + m_driverTimeoutMs))
+        if (!isRemoveBatched)
         {
-            throw DriverTimeoutException(
-                "no response from driver in " + std::to_string(m_driverTimeoutMs) + " ms", SOURCEINFO);
+            m_driverProxy.removeSubscription(registrationId);
         }
-    }
-    else if (!sub && RegistrationStatus::ERRORED_MEDIA_DRIVER == state.m_status)
-    {
-        const std::int32_t errorCode = state.m_errorCode;
-        const std::string errorMessage = state.m_errorMessage;
-
-        m_subscriptionByRegistrationId.erase(it);
-
-        throw RegistrationException(errorCode, getCategory(errorCode), errorMessage, SOURCEINFO);
-    }
-
-    return sub;
-}
-
-void ClientConductor::releaseSubscription(std::int64_t registrationId, Image::array_t imageArray, std::size_t length)
-{
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
-    verifyDriverIsActiveViaErrorHandler();
-
-    auto it = m_subscriptionByRegistrationId.find(registrationId);
-    if (it != m_subscriptionByRegistrationId.end())
-    {
-        m_driverProxy.removeSubscription(registrationId);
-        lingerAllResources(m_epochClock(), imageArray);
+        // unavailable image handlers run on the conductor thread as they do for images removed by the driver
+        offerCommand(
+            [this, registrationId, imageArray, length, state]()
+            {
+                lingerAllResources(m_epochClock(), imageArray);
 
-        for (std::size_t i = 0; i < length; i++)
-        {
-            auto image = *imageArray[i];
-            image.close();
+                for (std::size_t i = 0; i < length; i++)
+                {
+                    auto image = *imageArray[i];
+                    image.close();
 
-            CallbackGuard callbackGuard(m_isInCallback);
-            it->second.m_onUnavailableImageHandler(image);
-        }
+                    ConductorCallbackGuard callbackGuard(this);
+                    state->m_onUnavailableImageHandler(image);
+                }
 
-        m_subscriptionByRegistrationId.erase(it);
+                m_subscriptionByRegistrationId.erase(registrationId);
+            });
     }
     else
     {
@@ -344,7 +371,6 @@ void ClientConductor::releaseSubscription(std::int64_t registrationId, Image::ar
 std::int64_t ClientConductor::addCounter(
     std::int32_t typeId, const std::uint8_t *keyBuffer, std::size_t keyLength, const std::string &label)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     verifyDriverIsActive();
     ensureNotReentrant();
     ensureOpen();
@@ -359,82 +385,59 @@ std::int64_t ClientConductor::addCounter(
         throw IllegalArgumentException("label length out of bounds: " + std::to_string(label.length()), SOURCEINFO);
     }
 
-    std::int64_t registrationId = m_driverProxy.addCounter(typeId, keyBuffer, keyLength, label);
+    const std::int64_t registrationId = m_driverProxy.nextCorrelationId();
 
-    m_counterByRegistrationId.insert(std::pair<std::int64_t, CounterStateDefn>(
-        registrationId, CounterStateDefn(registrationId, m_epochClock())));
+    registerState(
+        m_clientCounterByRegistrationId,
+        m_counterByRegistrationId,
+        registrationId,
+        std::make_shared<CounterStateDefn>(registrationId, m_epochClock()));
+    m_driverProxy.addCounter(registrationId, typeId, keyBuffer, keyLength, label);
 
     return registrationId;
 }
 
 std::shared_ptr<Counter> ClientConductor::findCounter(std::int64_t registrationId)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
-    ensureNotReentrant();
-    ensureOpen();
-
-    auto it = m_counterByRegistrationId.find(registrationId);
-    if (it == m_counterByRegistrationId.end())
-    {
-        return {};
-    }
+    return findResource<Counter>(m_clientCounterByRegistrationId, registrationId);
+}
 
-    CounterStateDefn &state = it->second;
-    std::shared_ptr<Counter> counter = state.m_counter.lock();
+void ClientConductor::releaseCounter(std::int64_t registrationId, bool isRemoveBatched)
+{
+    verifyDriverIsActiveViaErrorHandler();
 
-    if (state.m_counterCache)
+    if (isClosed())
     {
-        state.m_counterCache.reset();
+        return;
     }
 
-    if (!counter && RegistrationStatus::AWAITING_MEDIA_DRIVER == state.m_status)
+    std::shared_ptr<CounterStateDefn> state = removeClientState(m_clientCounterByRegistrationId, registrationId);
+
+    if (state)
     {
-        if (m_epochClock() > (state.m_timeOfRegistrationMs + m_driverTimeoutMs))
+        if (!isRemoveBatched)
         {
-            throw DriverTimeoutException(
-                "no response from driver in " + std::to_string(m_driverTimeoutMs) + " ms", SOURCEINFO);
+            m_driverProxy.removeCounter(registrationId);
         }
-    }
-    else if (!counter && RegistrationStatus::ERRORED_MEDIA_DRIVER == state.m_status)
-    {
-        const std::int32_t errorCode = state.m_errorCode;
-        const std::string errorMessage = state.m_errorMessage;
-
-        m_counterByRegistrationId.erase(it);
-
-        throw RegistrationException(errorCode, getCategory(errorCode), errorMessage, SOURCEINFO);
-    }
-
-    return counter;
-}
-
-void ClientConductor::releaseCounter(std::int64_t registrationId)
-{
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
-    verifyDriverIsActiveViaErrorHandler();
-
-    auto it = m_counterByRegistrationId.find(registrationId);
-    if (it != m_counterByRegistrationId.end())
-    {
-        m_driverProxy.removeCounter(registrationId);
-
-        m_counterByRegistrationId.erase(it);
+        releaseState(m_counterByRegistrationId, registrationId);
     }
 }
 
 std::int64_t ClientConductor::addDestination(
     std::int64_t publicationRegistrationId, const std::string &endpointChannel)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     verifyDriverIsActive();
     ensureNotReentrant();
     ensureOpen();
 
-    std::int64_t correlationId = m_driverProxy.addDestination(publicationRegistrationId, endpointChannel);
+    const std::int64_t correlationId = m_driverProxy.nextCorrelationId();
 
-    m_destinationStateByCorrelationId.insert(std::pair<std::int64_t, DestinationStateDefn>(
+    registerState(
+        m_clientDestinationStateByCorrelationId,
+        m_destinationStateByCorrelationId,
         correlationId,
-        DestinationStateDefn(correlationId, publicationRegistrationId, m_epochClock())));
+        std::make_shared<DestinationStateDefn>(correlationId, publicationRegistrationId, m_epochClock()));
+    m_driverProxy.addDestination(correlationId, publicationRegistrationId, endpointChannel);
 
     return correlationId;
 }
@@ -442,16 +445,18 @@ std::int64_t ClientConductor::addDestination(
 std::int64_t ClientConductor::removeDestination(
     std::int64_t publicationRegistrationId, const std::string &endpointChannel)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     verifyDriverIsActive();
     ensureNotReentrant();
     ensureOpen();
 
-    std::int64_t correlationId = m_driverProxy.removeDestination(publicationRegistrationId, endpointChannel);
+    const std::int64_t correlationId = m_driverProxy.nextCorrelationId();
 
-    m_destinationStateByCorrelationId.insert(std::pair<std::int64_t, DestinationStateDefn>(
+    registerState(
+        m_clientDestinationStateByCorrelationId,
+        m_destinationStateByCorrelationId,
         correlationId,
-        DestinationStateDefn(correlationId, publicationRegistrationId, m_epochClock())));
+        std::make_shared<DestinationStateDefn>(correlationId, publicationRegistrationId, m_epochClock()));
+    m_driverProxy.removeDestination(correlationId, publicationRegistrationId, endpointChannel);
 
     return correlationId;
 }
@@ -459,16 +464,18 @@ std::int64_t ClientConductor::removeDestination(
 std::int64_t ClientConductor::addRcvDestination(
     std::int64_t subscriptionRegistrationId, const std::string &endpointChannel)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     verifyDriverIsActive();
     ensureNotReentrant();
     ensureOpen();
 
-    std::int64_t correlationId = m_driverProxy.addRcvDestination(subscriptionRegistrationId, endpointChannel);
+    const std::int64_t correlationId = m_driverProxy.nextCorrelationId();
 
-    m_destinationStateByCorrelationId.insert(std::pair<std::int64_t, DestinationStateDefn>(
+    registerState(
+        m_clientDestinationStateByCorrelationId,
+        m_destinationStateByCorrelationId,
         correlationId,
-        DestinationStateDefn(correlationId, subscriptionRegistrationId, m_epochClock())));
+        std::make_shared<DestinationStateDefn>(correlationId, subscriptionRegistrationId, m_epochClock()));
+    m_driverProxy.addRcvDestination(correlationId, subscriptionRegistrationId, endpointChannel);
 
     return correlationId;
 }
@@ -476,42 +483,43 @@ std::int64_t ClientConductor::addRcvDestination(
 std::int64_t ClientConductor::removeRcvDestination(
     std::int64_t subscriptionRegistrationId, const std::string &endpointChannel)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     verifyDriverIsActive();
     ensureNotReentrant();
     ensureOpen();
 
-    std::int64_t correlationId = m_driverProxy.removeRcvDestination(subscriptionRegistrationId, endpointChannel);
+    const std::int64_t correlationId = m_driverProxy.nextCorrelationId();
 
-    m_destinationStateByCorrelationId.insert(std::pair<std::int64_t, DestinationStateDefn>(
+    registerState(
+        m_clientDestinationStateByCorrelationId,
+        m_destinationStateByCorrelationId,
         correlationId,
-        DestinationStateDefn(correlationId, subscriptionRegistrationId, m_epochClock())));
+        std::make_shared<DestinationStateDefn>(correlationId, subscriptionRegistrationId, m_epochClock()));
+    m_driverProxy.removeRcvDestination(correlationId, subscriptionRegistrationId, endpointChannel);
 
     return correlationId;
 }
 
 bool ClientConductor::findDestinationResponse(std::int64_t correlationId)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     ensureNotReentrant();
     ensureOpen();
 
-    auto it = m_destinationStateByCorrelationId.find(correlationId);
-    if (it == m_destinationStateByCorrelationId.end())
+    std::shared_ptr<DestinationStateDefn> state =
+        findClientState(m_clientDestinationStateByCorrelationId, correlationId);
+    if (!state)
     {
         throw IllegalArgumentException("correlationId unknown", SOURCEINFO);
     }
 
-    DestinationStateDefn &state = it->second;
     bool result = false;
 
-    switch (state.m_status)
+    switch (state->m_status.load(std::memory_order_acquire))
     {
         case RegistrationStatus::AWAITING_MEDIA_DRIVER:
         {
-            if (m_epochClock() > (state.m_timeOfRegistrationMs + m_driverTimeoutMs))
+            if (m_epochClock() > (state->m_timeOfRegistrationMs + m_driverTimeoutMs))
             {
-                m_destinationStateByCorrelationId.erase(it);
+                removeClientState(m_clientDestinationStateByCorrelationId, correlationId);
                 throw DriverTimeoutException(
                     "no response from driver in " + std::to_string(m_driverTimeoutMs) + " ms", SOURCEINFO);
             }
@@ -520,20 +528,324 @@ bool ClientConductor::findDestinationResponse(std::int64_t correlationId)
 
         case RegistrationStatus::REGISTERED_MEDIA_DRIVER:
         {
-            m_destinationStateByCorrelationId.erase(it);
+            removeClientState(m_clientDestinationStateByCorrelationId, correlationId);
             result = true;
             break;
         }
 
         case RegistrationStatus::ERRORED_MEDIA_DRIVER:
         {
-            const std::int32_t errorCode = state.m_errorCode;
-            const std::string errorMessage = state.m_errorMessage;
+            removeClientState(m_clientDestinationStateByCorrelationId, correlationId);
+
+            const std::int32_t errorCode = state->m_errorCode;
+            throw RegistrationException(errorCode, getCategory(errorCode), state->m_errorMessage, SOURCEINFO);
+        }
+
+        default:
+            break;
+    }
+
+    return result;
+}
+
+std::int64_t ClientConductor::createBatch()
+{
+    ensureNotReentrant();
+    ensureOpen();
+
+    const std::int64_t batchId = m_driverProxy.nextCorrelationId();
+
+    std::lock_guard<std::mutex> lock(m_clientLock);
+    m_clientBatchByRegistrationId.emplace(batchId, std::make_shared<BatchStateDefn>());
+
+    return batchId;
+}
+
+std::int64_t ClientConductor::addPublication(
+    std::int64_t batchId, const std::string &channel, std::int32_t streamId)
+{
+    ensureNotReentrant();
+    ensureOpen();
+
+    std::lock_guard<std::mutex> lock(m_clientLock);
+    BatchStateDefn &state = *findUnsubmittedBatch(batchId);
+    const std::int64_t registrationId = m_driverProxy.nextCorrelationId();
+
+    m_driverProxy.addPublication(registrationId, channel, streamId, &state.m_batch);
+
+    state.m_registrations.emplace_back(
+        [this, channel, registrationId, streamId](long long nowMs)
+        {
+            registerState(
+                m_clientPublicationByRegistrationId,
+                m_publicationByRegistrationId,
+                registrationId,
+                std::make_shared<PublicationStateDefn>(channel, registrationId, streamId, nowMs));
+        });
 
-            m_destinationStateByCorrelationId.erase(it);
+    return registrationId;
+}
 
-            throw RegistrationException(errorCode, getCategory(errorCode), errorMessage, SOURCEINFO);
+std::int64_t ClientConductor::addExclusivePublication(
+    std::int64_t batchId, const std::string &channel, std::int32_t streamId)
+{
+    ensureNotReentrant();
+    ensureOpen();
+
+    std::lock_guard<std::mutex> lock(m_clientLock);
+    BatchStateDefn &state = *findUnsubmittedBatch(batchId);
+    const std::int64_t registrationId = m_driverProxy.nextCorrelationId();
+
+    m_driverProxy.addExclusivePublication(registrationId, channel, streamId, &state.m_batch);
+
+    state.m_registrations.emplace_back(
+        [this, channel, registrationId, streamId](long long nowMs)
+        {
+            registerState(
+                m_clientExclusivePublicationByRegistrationId,
+                m_exclusivePublicationByRegistrationId,
+                registrationId,
+                std::make_shared<ExclusivePublicationStateDefn>(channel, registrationId, streamId, nowMs));
+        });
+
+    return registrationId;
+}
+
+std::int64_t ClientConductor::addSubscription(
+    std::int64_t batchId,
+    const std::string &channel,
+    std::int32_t streamId,
+    const on_available_image_t &onAvailableImageHandler,
+    const on_unavailable_image_t &onUnavailableImageHandler)
+{
+    ensureNotReentrant();
+    ensureOpen();
+
+    std::lock_guard<std::mutex> lock(m_clientLock);
+    BatchStateDefn &state = *findUnsubmittedBatch(batchId);
+    const std::int64_t registrationId = m_driverProxy.nextCorrelationId();
+
+    m_driverProxy.addSubscription(registrationId, channel, streamId, &state.m_batch);
+
+    state.m_registrations.emplace_back(
+        [this, channel, registrationId, streamId, onAvailableImageHandler, onUnavailableImageHandler](long long nowMs)
+        {
+            registerState(
+                m_clientSubscriptionByRegistrationId,
+                m_subscriptionByRegistrationId,
+                registrationId,
+                std::make_shared<SubscriptionStateDefn>(
+                    channel, registrationId, streamId, nowMs, onAvailableImageHandler, onUnavailableImageHandler));
+        });
+
+    return registrationId;
+}
+
+std::int64_t ClientConductor::addCounter(
+    std::int64_t batchId,
+    std::int32_t typeId,
+    const std::uint8_t *keyBuffer,
+    std::size_t keyLength,
+    const std::string &label)
+{
+    ensureNotReentrant();
+    ensureOpen();
+
+    if (keyLength > CountersManager::MAX_KEY_LENGTH)
+    {
+        throw IllegalArgumentException("key length out of bounds: " + std::to_string(keyLength), SOURCEINFO);
+    }
+
+    if (label.length() > CountersManager::MAX_LABEL_LENGTH)
+    {
+        throw IllegalArgumentException("label length out of bounds: " + std::to_string(label.length()), SOURCEINFO);
+    }
+
+    std::lock_guard<std::mutex> lock(m_clientLock);
+    BatchStateDefn &state = *findUnsubmittedBatch(batchId);
+    const std::int64_t registrationId = m_driverProxy.nextCorrelationId();
+
+    m_driverProxy.addCounter(registrationId, typeId, keyBuffer, keyLength, label, &state.m_batch);
+
+    state.m_registrations.emplace_back(
+        [this, registrationId](long long nowMs)
+        {
+            registerState(
+                m_clientCounterByRegistrationId,
+                m_counterByRegistrationId,
+                registrationId,
+                std::make_shared<CounterStateDefn>(registrationId, nowMs));
+        });
+
+    return registrationId;
+}
+
+void ClientConductor::close(std::int64_t batchId, const std::shared_ptr<Publication> &publication)
+{
+    ensureNotReentrant();
+    ensureOpen();
+
+    std::lock_guard<std::mutex> lock(m_clientLock);
+    BatchStateDefn &state = *findUnsubmittedBatch(batchId);
+
+    m_driverProxy.removePublication(publication->registrationId(), &state.m_batch);
+
+    state.m_registrations.emplace_back(
+        [this, publication](long long)
+        {
+            publication->close();
+            releasePublication(publication->registrationId(), true);
+        });
+}
+
+void ClientConductor::close(std::int64_t batchId, const std::shared_ptr<ExclusivePublication> &publication)
+{
+    ensureNotReentrant();
+    ensureOpen();
+
+    std::lock_guard<std::mutex> lock(m_clientLock);
+    BatchStateDefn &state = *findUnsubmittedBatch(batchId);
+
+    m_driverProxy.removePublication(publication->registrationId(), &state.m_batch);
+
+    state.m_registrations.emplace_back(
+        [this, publication](long long)
+        {
+            publication->close();
+            releaseExclusivePublication(publication->registrationId(), true);
+        });
+}
+
+void ClientConductor::close(std::int64_t batchId, const std::shared_ptr<Subscription> &subscription)
+{
+    ensureNotReentrant();
+    ensureOpen();
+
+    std::lock_guard<std::mutex> lock(m_clientLock);
+    BatchStateDefn &state = *findUnsubmittedBatch(batchId);
+
+    m_driverProxy.removeSubscription(subscription->registrationId(), &state.m_batch);
+
+    state.m_registrations.emplace_back(
+        [this, subscription](long long)
+        {
+            std::pair<Image::array_t, std::size_t> imageArrayPair = subscription->closeAndRemoveImages();
+            releaseSubscription(subscription->registrationId(), imageArrayPair.first, imageArrayPair.second, true);
+        });
+}
+
+void ClientConductor::close(std::int64_t batchId, const std::shared_ptr<Counter> &counter)
+{
+    ensureNotReentrant();
+    ensureOpen();
+
+    std::lock_guard<std::mutex> lock(m_clientLock);
+    BatchStateDefn &state = *findUnsubmittedBatch(batchId);
+
+    m_driverProxy.removeCounter(counter->registrationId(), &state.m_batch);
+
+    state.m_registrations.emplace_back(
+        [this, counter](long long)
+        {
+            counter->close();
+            releaseCounter(counter->registrationId(), true);
+        });
+}
+
+void ClientConductor::submitBatch(std::int64_t batchId)
+{
+    verifyDriverIsActive();
+    ensureNotReentrant();
+    ensureOpen();
+
+    const long long nowMs = m_epochClock();
+    std::shared_ptr<BatchStateDefn> state;
+    std::vector<std::function<void(long long)>> registrations;
+    DriverProxy::Batch batch;
+
+    {
+        std::lock_guard<std::mutex> lock(m_clientLock);
+        state = findUnsubmittedBatch(batchId);
+
+        registrations = std::move(state->m_registrations);
+        batch = std::move(state->m_batch);
+        state->m_registrations.clear();
+        state->m_batch = DriverProxy::Batch();
+        state->m_timeOfRegistrationMs = nowMs;
+        state->m_isSubmitted = true;
+    }
+
+    for (auto &registration : registrations)
+    {
+        registration(nowMs);
+    }
+
+    offerCommand([this, batchId, state]() { m_batchByRegistrationId.emplace(batchId, state); });
+    m_driverProxy.submitBatch(batchId, batch);
+}
+
+bool ClientConductor::findBatchResponse(std::int64_t batchId)
+{
+    ensureNotReentrant();
+    ensureOpen();
+
+    std::shared_ptr<BatchStateDefn> state;
+
+    {
+        std::lock_guard<std::mutex> lock(m_clientLock);
+
+        auto it = m_clientBatchByRegistrationId.find(batchId);
+        if (it == m_clientBatchByRegistrationId.end())
+        {
+            throw IllegalArgumentException("batchId unknown", SOURCEINFO);
+        }
+
+        if (!it->second->m_isSubmitted)
+        {
+            throw IllegalStateException("batch has not been submitted", SOURCEINFO);
         }
+
+        state = it->second;
+    }
+
+    bool result = false;
+
+    switch (state->m_status.load(std::memory_order_acquire))
+    {
+        case RegistrationStatus::AWAITING_MEDIA_DRIVER:
+        {
+            if (m_epochClock() > (state->m_timeOfRegistrationMs + m_driverTimeoutMs))
+            {
+                removeClientState(m_clientBatchByRegistrationId, batchId);
+                throw DriverTimeoutException(
+                    "no response from driver in " + std::to_string(m_driverTimeoutMs) + " ms", SOURCEINFO);
+            }
+            break;
+        }
+
+        case RegistrationStatus::REGISTERED_MEDIA_DRIVER:
+        {
+            removeClientState(m_clientBatchByRegistrationId, batchId);
+            result = true;
+            break;
+        }
+
+        case RegistrationStatus::ERRORED_MEDIA_DRIVER:
+        {
+            const std::int32_t errorCode = state->m_errorCode;
+            const std::int32_t failedCount = state->m_failedCount;
+
+            removeClientState(m_clientBatchByRegistrationId, batchId);
+
+            throw RegistrationException(
+                errorCode,
+                getCategory(errorCode),
+                std::to_string(failedCount) + " commands in batch failed, first errorCode=" + std::to_string(errorCode),
+                SOURCEINFO);
+        }
+
+        default:
+            break;
     }
 
     return result;
@@ -541,140 +853,167 @@ bool ClientConductor::findDestinationResponse(std::int64_t correlationId)
 
 std::int64_t ClientConductor::addAvailableCounterHandler(const on_available_counter_t &handler)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     ensureNotReentrant();
     ensureOpen();
 
     const std::int64_t registrationId = m_driverProxy.nextCorrelationId();
-    m_onAvailableCounterHandlers.emplace_back(registrationId, handler);
+    offerCommand(
+        [this, registrationId, handler]()
+        {
+            m_onAvailableCounterHandlers.emplace_back(registrationId, handler);
+        });
 
     return registrationId;
 }
 
 void ClientConductor::removeAvailableCounterHandler(const on_available_counter_t &handler)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     ensureNotReentrant();
     ensureOpen();
 
-    auto &v = m_onAvailableCounterHandlers;
-    auto predicate =
-        [handler](const std::pair<std::int64_t, on_available_counter_t> &item)
+    offerCommand(
+        [this, handler]()
         {
-            std::size_t itemAddress = getAddress(item.second);
-            std::size_t handlerAddress = getAddress(handler);
-            return itemAddress != 0 && itemAddress == handlerAddress;
-        };
+            auto &v = m_onAvailableCounterHandlers;
+            auto predicate =
+                [handler](const std::pair<std::int64_t, on_available_counter_t> &item)
+                {
+                    std::size_t itemAddress = getAddress(item.second);
+                    std::size_t handlerAddress = getAddress(handler);
+                    return itemAddress != 0 && itemAddress == handlerAddress;
+                };
 
-    v.erase(std::remove_if(v.begin(), v.end(), predicate), v.end());
+            v.erase(std::remove_if(v.begin(), v.end(), predicate), v.end());
+        });
 }
 
 void ClientConductor::removeAvailableCounterHandler(std::int64_t registrationId)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     ensureNotReentrant();
     ensureOpen();
 
-    auto &v = m_onAvailableCounterHandlers;
-    auto predicate =
-        [registrationId](const std::pair<std::int64_t, on_available_counter_t> &item)
+    offerCommand(
+        [this, registrationId]()
         {
-            return item.first == registrationId;
-        };
+            auto &v = m_onAvailableCounterHandlers;
+            auto predicate =
+                [registrationId](const std::pair<std::int64_t, on_available_counter_t> &item)
+                {
+                    return item.first == registrationId;
+                };
 
-    v.erase(std::remove_if(v.begin(), v.end(), predicate), v.end());
+            v.erase(std::remove_if(v.begin(), v.end(), predicate), v.end());
+        });
 }
 
 std::int64_t ClientConductor::addUnavailableCounterHandler(const on_unavailable_counter_t &handler)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     ensureNotReentrant();
     ensureOpen();
 
-    std::int64_t registrationId = m_driverProxy.nextCorrelationId();
-    m_onUnavailableCounterHandlers.emplace_back(registrationId, handler);
+    const std::int64_t registrationId = m_driverProxy.nextCorrelationId();
+    offerCommand(
+        [this, registrationId, handler]()
+        {
+            m_onUnavailableCounterHandlers.emplace_back(registrationId, handler);
+        });
 
     return registrationId;
 }
 
 void ClientConductor::removeUnavailableCounterHandler(const on_unavailable_counter_t &handler)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     ensureNotReentrant();
     ensureOpen();
 
-    auto &v = m_onUnavailableCounterHandlers;
-    auto predicate =
-        [handler](const std::pair<std::int64_t, on_unavailable_counter_t> &item)
+    offerCommand(
+        [this, handler]()
         {
-            std::size_t itemAddress = getAddress(item.second);
-            std::size_t handlerAddress = getAddress(handler);
-            return itemAddress != 0 && itemAddress == handlerAddress;
-        };
+            auto &v = m_onUnavailableCounterHandlers;
+            auto predicate =
+                [handler](const std::pair<std::int64_t, on_unavailable_counter_t> &item)
+                {
+                    std::size_t itemAddress = getAddress(item.second);
+                    std::size_t handlerAddress = getAddress(handler);
+                    return itemAddress != 0 && itemAddress == handlerAddress;
+                };
 
-    v.erase(std::remove_if(v.begin(), v.end(), predicate), v.end());
+            v.erase(std::remove_if(v.begin(), v.end(), predicate), v.end());
+        });
 }
 
 void ClientConductor::removeUnavailableCounterHandler(std::int64_t registrationId)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     ensureNotReentrant();
     ensureOpen();
 
-    auto &v = m_onUnavailableCounterHandlers;
-    auto predicate =
-        [registrationId](const std::pair<std::int64_t, on_unavailable_counter_t> &item)
+    offerCommand(
+        [this, registrationId]()
         {
-            return item.first == registrationId;
-        };
+            auto &v = m_onUnavailableCounterHandlers;
+            auto predicate =
+                [registrationId](const std::pair<std::int64_t, on_unavailable_counter_t> &item)
+                {
+                    return item.first == registrationId;
+                };
 
-    v.erase(std::remove_if(v.begin(), v.end(), predicate), v.end());
+            v.erase(std::remove_if(v.begin(), v.end(), predicate), v.end());
+        });
 }
 
 std::int64_t ClientConductor::addCloseClientHandler(const on_close_client_t &handler)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     ensureNotReentrant();
     ensureOpen();
 
-    std::int64_t registrationId = m_driverProxy.nextCorrelationId();
-    m_onCloseClientHandlers.emplace_back(registrationId, handler);
+    const std::int64_t registrationId = m_driverProxy.nextCorrelationId();
+    offerCommand(
+        [this, registrationId, handler]()
+        {
+            m_onCloseClientHandlers.emplace_back(registrationId, handler);
+        });
 
     return registrationId;
 }
 
 void ClientConductor::removeCloseClientHandler(const on_close_client_t &handler)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     ensureNotReentrant();
     ensureOpen();
 
-    auto &v = m_onCloseClientHandlers;
-    auto predicate =
-        [handler](const std::pair<std::int64_t, on_close_client_t> &item)
+    offerCommand(
+        [this, handler]()
         {
-            std::size_t itemAddress = getAddress(item.second);
-            std::size_t handlerAddress = getAddress(handler);
-            return itemAddress != 0 && itemAddress == handlerAddress;
-        };
+            auto &v = m_onCloseClientHandlers;
+            auto predicate =
+                [handler](const std::pair<std::int64_t, on_close_client_t> &item)
+                {
+                    std::size_t itemAddress = getAddress(item.second);
+                    std::size_t handlerAddress = getAddress(handler);
+                    return itemAddress != 0 && itemAddress == handlerAddress;
+                };
 
-    v.erase(std::remove_if(v.begin(), v.end(), predicate), v.end());
+            v.erase(std::remove_if(v.begin(), v.end(), predicate), v.end());
+        });
 }
 
 void ClientConductor::removeCloseClientHandler(std::int64_t registrationId)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     ensureNotReentrant();
     ensureOpen();
 
-    auto &v = m_onCloseClientHandlers;
-    auto predicate =
-        [registrationId](const std::pair<std::int64_t, on_close_client_t> &item)
+    offerCommand(
+        [this, registrationId]()
         {
-            return item.first == registrationId;
-        };
+            auto &v = m_onCloseClientHandlers;
+            auto predicate =
+                [registrationId](const std::pair<std::int64_t, on_close_client_t> &item)
+                {
+                    return item.first == registrationId;
+                };
 
-    v.erase(std::remove_if(v.begin(), v.end(), predicate), v.end());
+            v.erase(std::remove_if(v.begin(), v.end(), predicate), v.end());
+        });
 }
 
 void ClientConductor::onNewPublication(
@@ -686,19 +1025,29 @@ void ClientConductor::onNewPublication(
     std::int32_t channelStatusIndicatorId,
     const std::string &logFileName)
 {
+    processCommands();
+
     auto it = m_publicationByRegistrationId.find(registrationId);
-    if (it != m_publicationByRegistrationId.end())
+    if (it != m_publicationByRegistrationId.end() &&
+        it->second->m_status.load(std::memory_order_relaxed) == RegistrationStatus::AWAITING_MEDIA_DRIVER)
     {
-        PublicationStateDefn &state = it->second;
-
-        state.m_status = RegistrationStatus::REGISTERED_MEDIA_DRIVER;
-        state.m_sessionId = sessionId;
-        state.m_publicationLimitCounterId = publicationLimitCounterId;
-        state.m_channelStatusId = channelStatusIndicatorId;
-        state.m_buffers = getLogBuffers(originalRegistrationId, logFileName, state.m_channel);
-        state.m_originalRegistrationId = originalRegistrationId;
-
-        CallbackGuard callbackGuard(m_isInCallback);
+        PublicationStateDefn &state = *it->second;
+        UnsafeBufferPosition publicationLimit(m_counterValuesBuffer, publicationLimitCounterId);
+
+        state.m_resourceCache = std::make_shared<Publication>(
+            *this,
+            state.m_channel,
+            registrationId,
+            originalRegistrationId,
+            state.m_streamId,
+            sessionId,
+            publicationLimit,
+            channelStatusIndicatorId,
+            getLogBuffers(originalRegistrationId, logFileName, state.m_channel));
+        state.m_resource = std::weak_ptr<Publication>(state.m_resourceCache);
+        state.m_status.store(RegistrationStatus::REGISTERED_MEDIA_DRIVER, std::memory_order_release);
+
+        ConductorCallbackGuard callbackGuard(this);
         m_onNewPublicationHandler(state.m_channel, streamId, sessionId, registrationId);
     }
 }
@@ -714,86 +1063,106 @@ void ClientConductor::onNewExclusivePublication(
 {
     assert(registrationId == originalRegistrationId);
 
+    processCommands();
+
     auto it = m_exclusivePublicationByRegistrationId.find(registrationId);
-    if (it != m_exclusivePublicationByRegistrationId.end())
+    if (it != m_exclusivePublicationByRegistrationId.end() &&
+        it->second->m_status.load(std::memory_order_relaxed) == RegistrationStatus::AWAITING_MEDIA_DRIVER)
     {
-        ExclusivePublicationStateDefn &state = it->second;
-
-        state.m_status = RegistrationStatus::REGISTERED_MEDIA_DRIVER;
-        state.m_sessionId = sessionId;
-        state.m_publicationLimitCounterId = publicationLimitCounterId;
-        state.m_channelStatusId = channelStatusIndicatorId;
-        state.m_buffers = getLogBuffers(originalRegistrationId, logFileName, state.m_channel);
-
-        CallbackGuard callbackGuard(m_isInCallback);
+        ExclusivePublicationStateDefn &state = *it->second;
+        UnsafeBufferPosition publicationLimit(m_counterValuesBuffer, publicationLimitCounterId);
+
+        state.m_resourceCache = std::make_shared<ExclusivePublication>(
+            *this,
+            state.m_channel,
+            registrationId,
+            state.m_streamId,
+            sessionId,
+            publicationLimit,
+            channelStatusIndicatorId,
+            getLogBuffers(originalRegistrationId, logFileName, state.m_channel));
+        state.m_resource = std::weak_ptr<ExclusivePublication>(state.m_resourceCache);
+        state.m_status.store(RegistrationStatus::REGISTERED_MEDIA_DRIVER, std::memory_order_release);
+
+        ConductorCallbackGuard callbackGuard(this);
         m_onNewExclusivePublicationHandler(state.m_channel, streamId, sessionId, registrationId);
     }
 }
 
 void ClientConductor::onSubscriptionReady(std::int64_t registrationId, std::int32_t channelStatusId)
 {
+    processCommands();
+
     auto it = m_subscriptionByRegistrationId.find(registrationId);
-    if (it != m_subscriptionByRegistrationId.end() && it->second.m_status == RegistrationStatus::AWAITING_MEDIA_DRIVER)
+    if (it != m_subscriptionByRegistrationId.end() &&
+        it->second->m_status.load(std::memory_order_relaxed) == RegistrationStatus::AWAITING_MEDIA_DRIVER)
     {
-        SubscriptionStateDefn &state = it->second;
+        SubscriptionStateDefn &state = *it->second;
 
-        state.m_status = RegistrationStatus::REGISTERED_MEDIA_DRIVER;
-        state.m_subscriptionCache = std::make_shared<Subscription>(
+        state.m_resourceCache = std::make_shared<Subscription>(
             *this, state.m_registrationId, state.m_channel, state.m_streamId, channelStatusId);
-        state.m_subscription = std::weak_ptr<Subscription>(state.m_subscriptionCache);
+        state.m_resource = std::weak_ptr<Subscription>(state.m_resourceCache);
+        state.m_status.store(RegistrationStatus::REGISTERED_MEDIA_DRIVER, std::memory_order_release);
 
-        CallbackGuard callbackGuard(m_isInCallback);
+        ConductorCallbackGuard callbackGuard(this);
         m_onNewSubscriptionHandler(state.m_channel, state.m_streamId, registrationId);
     }
 }
 
 void ClientConductor::onAvailableCounter(std::int64_t registrationId, std::int32_t counterId)
 {
+    processCommands();
+
     auto it = m_counterByRegistrationId.find(registrationId);
-    if (it != m_counterByRegistrationId.end() && it->second.m_status == RegistrationStatus::AWAITING_MEDIA_DRIVER)
+    if (it != m_counterByRegistrationId.end() &&
+        it->second->m_status.load(std::memory_order_relaxed) == RegistrationStatus::AWAITING_MEDIA_DRIVER)
     {
-        CounterStateDefn &state = it->second;
+        CounterStateDefn &state = *it->second;
 
-        state.m_status = RegistrationStatus::REGISTERED_MEDIA_DRIVER;
-        state.m_counterId = counterId;
-        state.m_counterCache = std::make_shared<Counter>(
+        state.m_resourceCache = std::make_shared<Counter>(
             this, m_counterValuesBuffer, state.m_registrationId, counterId);
-        state.m_counter = std::weak_ptr<Counter>(state.m_counterCache);
+        state.m_resource = std::weak_ptr<Counter>(state.m_resourceCache);
+        state.m_status.store(RegistrationStatus::REGISTERED_MEDIA_DRIVER, std::memory_order_release);
     }
 
     for (auto const &handler: m_onAvailableCounterHandlers)
     {
-        CallbackGuard callbackGuard(m_isInCallback);
+        ConductorCallbackGuard callbackGuard(this);
         handler.second(m_countersReader, registrationId, counterId);
     }
 }
 
 void ClientConductor::onUnavailableCounter(std::int64_t registrationId, std::int32_t counterId)
 {
+    processCommands();
+
     for (auto const &handler: m_onUnavailableCounterHandlers)
     {
-        CallbackGuard callbackGuard(m_isInCallback);
+        ConductorCallbackGuard callbackGuard(this);
         handler.second(m_countersReader, registrationId, counterId);
     }
 }
 
 void ClientConductor::onOperationSuccess(std::int64_t correlationId)
 {
+    processCommands();
+
     auto it = m_destinationStateByCorrelationId.find(correlationId);
     if (it != m_destinationStateByCorrelationId.end() &&
-        it->second.m_status == RegistrationStatus::AWAITING_MEDIA_DRIVER)
+        it->second->m_status.load(std::memory_order_relaxed) == RegistrationStatus::AWAITING_MEDIA_DRIVER)
     {
-        DestinationStateDefn &state = it->second;
-
-        state.m_status = RegistrationStatus::REGISTERED_MEDIA_DRIVER;
+        it->second->m_status.store(RegistrationStatus::REGISTERED_MEDIA_DRIVER, std::memory_order_release);
+        m_destinationStateByCorrelationId.erase(it);
     }
 }
 
 void ClientConductor::onChannelEndpointErrorResponse(std::int32_t channelStatusId, const std::string &errorMessage)
 {
+    processCommands();
+
     for (auto it = m_subscriptionByRegistrationId.begin(); it != m_subscriptionByRegistrationId.end();)
     {
-        std::shared_ptr<Subscription> subscription = it->second.m_subscription.lock();
+        std::shared_ptr<Subscription> subscription = it->second->m_resource.lock();
 
         if (subscription && subscription->channelStatusId() == channelStatusId)
         {
@@ -811,10 +1180,11 @@ void ClientConductor::onChannelEndpointErrorResponse(std::int32_t channelStatusI
                 auto image = *(imageArray[i]);
                 image.close();
 
-                CallbackGuard callbackGuard(m_isInCallback);
-                it->second.m_onUnavailableImageHandler(image);
+                ConductorCallbackGuard callbackGuard(this);
+                it->second->m_onUnavailableImageHandler(image);
             }
 
+            it->second->m_status.store(RegistrationStatus::REMOVED_BY_CONDUCTOR, std::memory_order_release);
             it = m_subscriptionByRegistrationId.erase(it);
         }
         else
@@ -825,7 +1195,7 @@ void ClientConductor::onChannelEndpointErrorResponse(std::int32_t channelStatusI
 
     for (auto it = m_publicationByRegistrationId.begin(); it != m_publicationByRegistrationId.end();)
     {
-        std::shared_ptr<Publication> publication = it->second.m_publication.lock();
+        std::shared_ptr<Publication> publication = it->second->m_resource.lock();
 
         if (publication && publication->channelStatusId() == channelStatusId)
         {
@@ -834,6 +1204,7 @@ void ClientConductor::onChannelEndpointErrorResponse(std::int32_t channelStatusI
 
             publication->close();
 
+            it->second->m_status.store(RegistrationStatus::REMOVED_BY_CONDUCTOR, std::memory_order_release);
             it = m_publicationByRegistrationId.erase(it);
         }
         else
@@ -844,7 +1215,7 @@ void ClientConductor::onChannelEndpointErrorResponse(std::int32_t channelStatusI
 
     for (auto it = m_exclusivePublicationByRegistrationId.begin(); it != m_exclusivePublicationByRegistrationId.end();)
     {
-        std::shared_ptr<ExclusivePublication> publication = it->second.m_publication.lock();
+        std::shared_ptr<ExclusivePublication> publication = it->second->m_resource.lock();
 
         if (publication && publication->channelStatusId() == channelStatusId)
         {
@@ -853,6 +1224,7 @@ void ClientConductor::onChannelEndpointErrorResponse(std::int32_t channelStatusI
 
             publication->close();
 
+            it->second->m_status.store(RegistrationStatus::REMOVED_BY_CONDUCTOR, std::memory_order_release);
             it = m_exclusivePublicationByRegistrationId.erase(it);
         }
         else
@@ -862,53 +1234,55 @@ void ClientConductor::onChannelEndpointErrorResponse(std::int32_t channelStatusI
     }
 }
 
-void ClientConductor::onErrorResponse(
-    std::int64_t offendingCommandCorrelationId, std::int32_t errorCode, const std::string &errorMessage)
+template<typename S>
+bool ClientConductor::onStateErrorResponse(
+    state_map_t<S> &stateMap, std::int64_t correlationId, std::int32_t errorCode, const std::string &errorMessage)
 {
-    auto subIt = m_subscriptionByRegistrationId.find(offendingCommandCorrelationId);
-    if (subIt != m_subscriptionByRegistrationId.end())
+    auto it = stateMap.find(correlationId);
+    if (it == stateMap.end())
     {
-        subIt->second.m_status = RegistrationStatus::ERRORED_MEDIA_DRIVER;
-        subIt->second.m_errorCode = errorCode;
-        subIt->second.m_errorMessage = errorMessage;
-        return;
+        return false;
+    }
+
+    S &state = *it->second;
+    if (state.m_status.load(std::memory_order_relaxed) == RegistrationStatus::AWAITING_MEDIA_DRIVER)
+    {
+        state.m_errorCode = errorCode;
+        state.m_errorMessage = errorMessage;
+        state.m_status.store(RegistrationStatus::ERRORED_MEDIA_DRIVER, std::memory_order_release);
+        stateMap.erase(it);
     }
 
-    auto pubIt = m_publicationByRegistrationId.find(offendingCommandCorrelationId);
-    if (pubIt != m_publicationByRegistrationId.end())
+    return true;
+}
+
+void ClientConductor::onErrorResponse(
+    std::int64_t offendingCommandCorrelationId, std::int32_t errorCode, const std::string &errorMessage)
+{
+    processCommands();
+
+    if (onStateErrorResponse(m_subscriptionByRegistrationId, offendingCommandCorrelationId, errorCode, errorMessage))
     {
-        pubIt->second.m_status = RegistrationStatus::ERRORED_MEDIA_DRIVER;
-        pubIt->second.m_errorCode = errorCode;
-        pubIt->second.m_errorMessage = errorMessage;
         return;
     }
 
-    auto exPubIt = m_exclusivePublicationByRegistrationId.find(offendingCommandCorrelationId);
-    if (exPubIt != m_exclusivePublicationByRegistrationId.end())
+    if (onStateErrorResponse(m_publicationByRegistrationId, offendingCommandCorrelationId, errorCode, errorMessage))
     {
-        exPubIt->second.m_status = RegistrationStatus::ERRORED_MEDIA_DRIVER;
-        exPubIt->second.m_errorCode = errorCode;
-        exPubIt->second.m_errorMessage = errorMessage;
         return;
     }
 
-    auto counterIt = m_counterByRegistrationId.find(offendingCommandCorrelationId);
-    if (counterIt != m_counterByRegistrationId.end())
+    if (onStateErrorResponse(
+        m_exclusivePublicationByRegistrationId, offendingCommandCorrelationId, errorCode, errorMessage))
     {
-        counterIt->second.m_status = RegistrationStatus::ERRORED_MEDIA_DRIVER;
-        counterIt->second.m_errorCode = errorCode;
-        counterIt->second.m_errorMessage = errorMessage;
         return;
     }
 
-    auto destinationIt = m_destinationStateByCorrelationId.find(offendingCommandCorrelationId);
-    if (destinationIt != m_destinationStateByCorrelationId.end())
+    if (onStateErrorResponse(m_counterByRegistrationId, offendingCommandCorrelationId, errorCode, errorMessage))
     {
-        destinationIt->second.m_status = RegistrationStatus::ERRORED_MEDIA_DRIVER;
-        destinationIt->second.m_errorCode = errorCode;
-        destinationIt->second.m_errorMessage = errorMessage;
         return;
     }
+
+    onStateErrorResponse(m_destinationStateByCorrelationId, offendingCommandCorrelationId, errorCode, errorMessage);
 }
 
 void ClientConductor::onAvailableImage(
@@ -919,11 +1293,13 @@ void ClientConductor::onAvailableImage(
     const std::string &logFilename,
     const std::string &sourceIdentity)
 {
+    processCommands();
+
     auto it = m_subscriptionByRegistrationId.find(subscriptionRegistrationId);
     if (it != m_subscriptionByRegistrationId.end())
     {
-        SubscriptionStateDefn &entry = it->second;
-        std::shared_ptr<Subscription> subscription = entry.m_subscription.lock();
+        SubscriptionStateDefn &entry = *it->second;
+        std::shared_ptr<Subscription> subscription = entry.m_resource.lock();
 
         if (nullptr != subscription)
         {
@@ -944,7 +1320,7 @@ void ClientConductor::onAvailableImage(
                 lingerResource(m_epochClock(), oldImageArray);
             }
 
-            CallbackGuard callbackGuard(m_isInCallback);
+            ConductorCallbackGuard callbackGuard(this);
             entry.m_onAvailableImageHandler(*image);
         }
     }
@@ -952,11 +1328,13 @@ void ClientConductor::onAvailableImage(
 
 void ClientConductor::onUnavailableImage(std::int64_t correlationId, std::int64_t subscriptionRegistrationId)
 {
+    processCommands();
+
     auto it = m_subscriptionByRegistrationId.find(subscriptionRegistrationId);
     if (it != m_subscriptionByRegistrationId.end())
     {
-        SubscriptionStateDefn &entry = it->second;
-        std::shared_ptr<Subscription> subscription = entry.m_subscription.lock();
+        SubscriptionStateDefn &entry = *it->second;
+        std::shared_ptr<Subscription> subscription = entry.m_resource.lock();
 
         if (nullptr != subscription)
         {
@@ -967,7 +1345,7 @@ void ClientConductor::onUnavailableImage(std::int64_t correlationId, std::int64_
             {
                 lingerResource(m_epochClock(), oldImageArray);
 
-                CallbackGuard callbackGuard(m_isInCallback);
+                ConductorCallbackGuard callbackGuard(this);
                 entry.m_onUnavailableImageHandler(*(oldImageArray[result.second]));
             }
         }
@@ -985,37 +1363,58 @@ void ClientConductor::onClientTimeout(std::int64_t clientId)
     }
 }
 
+void ClientConductor::onBatchComplete(
+    std::int64_t correlationId, std::int32_t failedCount, std::int32_t firstErrorCode)
+{
+    processCommands();
+
+    auto it = m_batchByRegistrationId.find(correlationId);
+    if (it != m_batchByRegistrationId.end())
+    {
+        it->second->m_failedCount = failedCount;
+        it->second->m_errorCode = firstErrorCode;
+        it->second->m_status.store(
+            0 == failedCount ? RegistrationStatus::REGISTERED_MEDIA_DRIVER : RegistrationStatus::ERRORED_MEDIA_DRIVER,
+            std::memory_order_release);
+        m_batchByRegistrationId.erase(it);
+    }
+}
+
 void ClientConductor::closeAllResources(long long nowMs)
 {
     m_isClosed.store(true, std::memory_order_release);
+    processCommands();
 
+    // resources claimed from the caches are destroyed without releasing through the closed conductor
     for (auto &kv : m_publicationByRegistrationId)
     {
-        std::shared_ptr<Publication> pub = kv.second.m_publication.lock();
+        std::shared_ptr<Publication> pub = kv.second->m_resource.lock();
 
         if (nullptr != pub)
         {
             pub->close();
         }
+
+        kv.second->claimResourceCache();
     }
     m_publicationByRegistrationId.clear();
 
     for (auto &kv : m_exclusivePublicationByRegistrationId)
     {
-        std::shared_ptr<ExclusivePublication> pub = kv.second.m_publication.lock();
+        std::shared_ptr<ExclusivePublication> pub = kv.second->m_resource.lock();
 
         if (nullptr != pub)
         {
             pub->close();
         }
+
+        kv.second->claimResourceCache();
     }
     m_exclusivePublicationByRegistrationId.clear();
 
-    std::vector<std::shared_ptr<Subscription>> subscriptionsToHoldUntilCleared;
-
     for (auto &kv : m_subscriptionByRegistrationId)
     {
-        std::shared_ptr<Subscription> sub = kv.second.m_subscription.lock();
+        std::shared_ptr<Subscription> sub = kv.second->m_resource.lock();
 
         if (nullptr != sub)
         {
@@ -1030,24 +1429,18 @@ void ClientConductor::closeAllResources(long long nowMs)
                 auto image = *(imageArray[i]);
                 image.close();
 
-                CallbackGuard callbackGuard(m_isInCallback);
-                kv.second.m_onUnavailableImageHandler(image);
-            }
-
-            if (kv.second.m_subscriptionCache)
-            {
-                subscriptionsToHoldUntilCleared.push_back(kv.second.m_subscriptionCache);
-                kv.second.m_subscriptionCache.reset();
+                ConductorCallbackGuard callbackGuard(this);
+                kv.second->m_onUnavailableImageHandler(image);
             }
         }
+
+        kv.second->claimResourceCache();
     }
     m_subscriptionByRegistrationId.clear();
 
-    std::vector<std::shared_ptr<Counter>> countersToHoldUntilCleared;
-
     for (auto &kv : m_counterByRegistrationId)
     {
-        std::shared_ptr<Counter> counter = kv.second.m_counter.lock();
+        std::shared_ptr<Counter> counter = kv.second->m_resource.lock();
 
         if (nullptr != counter)
         {
@@ -1057,22 +1450,21 @@ void ClientConductor::closeAllResources(long long nowMs)
 
             for (auto const &handler: m_onUnavailableCounterHandlers)
             {
-                CallbackGuard callbackGuard(m_isInCallback);
+                ConductorCallbackGuard callbackGuard(this);
                 handler.second(m_countersReader, registrationId, counterId);
             }
-
-            if (kv.second.m_counterCache)
-            {
-                countersToHoldUntilCleared.push_back(kv.second.m_counterCache);
-                kv.second.m_counterCache.reset();
-            }
         }
+
+        kv.second->claimResourceCache();
     }
     m_counterByRegistrationId.clear();
 
+    m_destinationStateByCorrelationId.clear();
+    m_batchByRegistrationId.clear();
+
     for (auto const &handler: m_onCloseClientHandlers)
     {
-        CallbackGuard callbackGuard(m_isInCallback);
+        ConductorCallbackGuard callbackGuard(this);
         handler.second();
     }
 }
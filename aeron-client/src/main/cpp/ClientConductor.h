@@ -17,6 +17,9 @@
 #ifndef AERON_CLIENT_CONDUCTOR_H
 #define AERON_CLIENT_CONDUCTOR_H
 
+#include <atomic>
+#include <functional>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 #include <mutex>
@@ -31,6 +34,7 @@
 #include "DriverListenerAdapter.h"
 #include "LogBuffers.h"
 #include "HeartbeatTimestamp.h"
+#include "concurrent/ManyToOneConcurrentLinkedQueue.h"
 #include "util/Export.h"
 #include "AeronVersion.h"
 
@@ -108,13 +112,13 @@ public:
 
     std::shared_ptr<Publication> findPublication(std::int64_t registrationId);
 
-    void releasePublication(std::int64_t registrationId);
+    void releasePublication(std::int64_t registrationId, bool isRemoveBatched = false);
 
     std::int64_t addExclusivePublication(const std::string &channel, std::int32_t streamId);
 
     std::shared_ptr<ExclusivePublication> findExclusivePublication(std::int64_t registrationId);
 
-    void releaseExclusivePublication(std::int64_t registrationId);
+    void releaseExclusivePublication(std::int64_t registrationId, bool isRemoveBatched = false);
 
     std::int64_t addSubscription(
         const std::string &channel,
@@ -124,7 +128,8 @@ public:
 
     std::shared_ptr<Subscription> findSubscription(std::int64_t registrationId);
 
-    void releaseSubscription(std::int64_t registrationId, Image::array_t imageArray, std::size_t length);
+    void releaseSubscription(
+        std::int64_t registrationId, Image::array_t imageArray, std::size_t length, bool isRemoveBatched = false);
 
     std::int64_t addCounter(
         std::int32_t typeId,
@@ -134,10 +139,42 @@ public:
 
     std::shared_ptr<Counter> findCounter(std::int64_t registrationId);
 
-    void releaseCounter(std::int64_t registrationId);
+    void releaseCounter(std::int64_t registrationId, bool isRemoveBatched = false);
 
     bool findDestinationResponse(std::int64_t correlationId);
 
+    std::int64_t createBatch();
+
+    std::int64_t addPublication(std::int64_t batchId, const std::string &channel, std::int32_t streamId);
+
+    std::int64_t addExclusivePublication(std::int64_t batchId, const std::string &channel, std::int32_t streamId);
+
+    std::int64_t addSubscription(
+        std::int64_t batchId,
+        const std::string &channel,
+        std::int32_t streamId,
+        const on_available_image_t &onAvailableImageHandler,
+        const on_unavailable_image_t &onUnavailableImageHandler);
+
+    std::int64_t addCounter(
+        std::int64_t batchId,
+        std::int32_t typeId,
+        const std::uint8_t *keyBuffer,
+        std::size_t keyLength,
+        const std::string &label);
+
+    void close(std::int64_t batchId, const std::shared_ptr<Publication> &publication);
+
+    void close(std::int64_t batchId, const std::shared_ptr<ExclusivePublication> &publication);
+
+    void close(std::int64_t batchId, const std::shared_ptr<Subscription> &subscription);
+
+    void close(std::int64_t batchId, const std::shared_ptr<Counter> &counter);
+
+    void submitBatch(std::int64_t batchId);
+
+    bool findBatchResponse(std::int64_t batchId);
+
     void onNewPublication(
         std::int64_t registrationId,
         std::int64_t originalRegistrationId,
@@ -181,6 +218,8 @@ public:
 
     void onClientTimeout(std::int64_t clientId);
 
+    void onBatchComplete(std::int64_t correlationId, std::int32_t failedCount, std::int32_t firstErrorCode);
+
     void closeAllResources(long long nowMs);
 
     std::int64_t addDestination(std::int64_t publicationRegistrationId, const std::string &endpointChannel);
@@ -246,73 +285,74 @@ public:
 private:
     enum class RegistrationStatus : std::int8_t
     {
-        AWAITING_MEDIA_DRIVER, REGISTERED_MEDIA_DRIVER, ERRORED_MEDIA_DRIVER
+        AWAITING_MEDIA_DRIVER, REGISTERED_MEDIA_DRIVER, ERRORED_MEDIA_DRIVER, REMOVED_BY_CONDUCTOR
     };
 
-    struct PublicationStateDefn
+    /*
+     * Registration state is shared between the client threads, which create it and find resources through it, and
+     * the conductor thread, which completes it from driver responses. The conductor writes the result fields before
+     * the release store of m_status and does not change them afterwards. The resource cache holds the resource until
+     * it is claimed exactly once, by the first find or by the conductor on close.
+     */
+    template<typename T>
+    struct ResourceStateDefn
     {
         std::string m_errorMessage;
-        std::shared_ptr<LogBuffers> m_buffers;
-        std::weak_ptr<Publication> m_publication;
-        const std::string m_channel;
+        std::shared_ptr<T> m_resourceCache;
+        std::weak_ptr<T> m_resource;
         const std::int64_t m_registrationId;
-        std::int64_t m_originalRegistrationId = -1;
         const long long m_timeOfRegistrationMs;
-        const std::int32_t m_streamId;
-        std::int32_t m_sessionId = -1;
-        std::int32_t m_publicationLimitCounterId = -1;
-        std::int32_t m_channelStatusId = -1;
         std::int32_t m_errorCode = -1;
-        RegistrationStatus m_status = RegistrationStatus::AWAITING_MEDIA_DRIVER;
+        std::atomic<bool> m_isCacheClaimed = { false };
+        std::atomic<RegistrationStatus> m_status = { RegistrationStatus::AWAITING_MEDIA_DRIVER };
+
+        inline ResourceStateDefn(std::int64_t registrationId, long long nowMs) :
+            m_registrationId(registrationId),
+            m_timeOfRegistrationMs(nowMs)
+        {
+        }
+
+        inline std::shared_ptr<T> claimResourceCache()
+        {
+            return m_isCacheClaimed.exchange(true, std::memory_order_acq_rel) ?
+                std::shared_ptr<T>() : std::move(m_resourceCache);
+        }
+    };
+
+    struct PublicationStateDefn : ResourceStateDefn<Publication>
+    {
+        const std::string m_channel;
+        const std::int32_t m_streamId;
 
         inline PublicationStateDefn(
             const std::string &channel, std::int64_t registrationId, std::int32_t streamId, long long nowMs) :
+            ResourceStateDefn<Publication>(registrationId, nowMs),
             m_channel(channel),
-            m_registrationId(registrationId),
-            m_timeOfRegistrationMs(nowMs),
             m_streamId(streamId)
         {
         }
     };
 
-    struct ExclusivePublicationStateDefn
+    struct ExclusivePublicationStateDefn : ResourceStateDefn<ExclusivePublication>
     {
-        std::string m_errorMessage;
-        std::shared_ptr<LogBuffers> m_buffers;
-        std::weak_ptr<ExclusivePublication> m_publication;
         const std::string m_channel;
-        const std::int64_t m_registrationId;
-        const long long m_timeOfRegistrationMs;
         const std::int32_t m_streamId;
-        std::int32_t m_sessionId = -1;
-        std::int32_t m_publicationLimitCounterId = -1;
-        std::int32_t m_channelStatusId = -1;
-        std::int32_t m_errorCode = -1;
-        RegistrationStatus m_status = RegistrationStatus::AWAITING_MEDIA_DRIVER;
 
         inline ExclusivePublicationStateDefn(
             const std::string &channel, std::int64_t registrationId, std::int32_t streamId, long long nowMs) :
+            ResourceStateDefn<ExclusivePublication>(registrationId, nowMs),
             m_channel(channel),
-            m_registrationId(registrationId),
-            m_timeOfRegistrationMs(nowMs),
             m_streamId(streamId)
         {
         }
     };
 
-    struct SubscriptionStateDefn
+    struct SubscriptionStateDefn : ResourceStateDefn<Subscription>
     {
-        std::string m_errorMessage;
-        std::shared_ptr<Subscription> m_subscriptionCache;
-        std::weak_ptr<Subscription> m_subscription;
-        on_available_image_t m_onAvailableImageHandler;
-        on_unavailable_image_t m_onUnavailableImageHandler;
+        const on_available_image_t m_onAvailableImageHandler;
+        const on_unavailable_image_t m_onUnavailableImageHandler;
         const std::string m_channel;
-        const std::int64_t m_registrationId;
-        const long long m_timeOfRegistrationMs;
         const std::int32_t m_streamId;
-        std::int32_t m_errorCode = -1;
-        RegistrationStatus m_status = RegistrationStatus::AWAITING_MEDIA_DRIVER;
 
         inline SubscriptionStateDefn(
             const std::string &channel,
@@ -321,30 +361,19 @@ private:
             long long nowMs,
             const on_available_image_t &onAvailableImageHandler,
             const on_unavailable_image_t &onUnavailableImageHandler) :
+            ResourceStateDefn<Subscription>(registrationId, nowMs),
             m_onAvailableImageHandler(onAvailableImageHandler),
             m_onUnavailableImageHandler(onUnavailableImageHandler),
             m_channel(channel),
-            m_registrationId(registrationId),
-            m_timeOfRegistrationMs(nowMs),
             m_streamId(streamId)
         {
         }
     };
 
-    struct CounterStateDefn
+    struct CounterStateDefn : ResourceStateDefn<Counter>
     {
-        std::string m_errorMessage;
-        std::shared_ptr<Counter> m_counterCache;
-        std::weak_ptr<Counter> m_counter;
-        const std::int64_t m_registrationId;
-        const long long m_timeOfRegistrationMs;
-        std::int32_t m_counterId = -1;
-        RegistrationStatus m_status = RegistrationStatus::AWAITING_MEDIA_DRIVER;
-        std::int32_t m_errorCode = -1;
-
         inline CounterStateDefn(std::int64_t registrationId, long long nowMs) :
-            m_registrationId(registrationId),
-            m_timeOfRegistrationMs(nowMs)
+            ResourceStateDefn<Counter>(registrationId, nowMs)
         {
         }
     };
@@ -380,7 +409,7 @@ private:
         const std::int64_t m_registrationId;
         const long long m_timeOfRegistrationMs;
         std::int32_t m_errorCode = -1;
-        RegistrationStatus m_status = RegistrationStatus::AWAITING_MEDIA_DRIVER;
+        std::atomic<RegistrationStatus> m_status = { RegistrationStatus::AWAITING_MEDIA_DRIVER };
 
         inline DestinationStateDefn(std::int64_t correlationId, std::int64_t registrationId, long long nowMs) :
             m_correlationId(correlationId),
@@ -390,15 +419,42 @@ private:
         }
     };
 
-    std::unordered_map<std::int64_t, PublicationStateDefn> m_publicationByRegistrationId;
-    std::unordered_map<std::int64_t, ExclusivePublicationStateDefn> m_exclusivePublicationByRegistrationId;
-    std::unordered_map<std::int64_t, SubscriptionStateDefn> m_subscriptionByRegistrationId;
-    std::unordered_map<std::int64_t, CounterStateDefn> m_counterByRegistrationId;
-    std::unordered_map<std::int64_t, DestinationStateDefn> m_destinationStateByCorrelationId;
+    struct BatchStateDefn
+    {
+        DriverProxy::Batch m_batch;
+        std::vector<std::function<void(long long)>> m_registrations;
+        long long m_timeOfRegistrationMs = 0;
+        std::int32_t m_failedCount = 0;
+        std::int32_t m_errorCode = -1;
+        bool m_isSubmitted = false;
+        std::atomic<RegistrationStatus> m_status = { RegistrationStatus::AWAITING_MEDIA_DRIVER };
+    };
+
+    template<typename S>
+    using state_map_t = std::unordered_map<std::int64_t, std::shared_ptr<S>>;
+
+    typedef std::function<void()> command_t;
+
+    // owned by the conductor thread and only changed by it, including when processing commands
+    state_map_t<PublicationStateDefn> m_publicationByRegistrationId;
+    state_map_t<ExclusivePublicationStateDefn> m_exclusivePublicationByRegistrationId;
+    state_map_t<SubscriptionStateDefn> m_subscriptionByRegistrationId;
+    state_map_t<CounterStateDefn> m_counterByRegistrationId;
+    state_map_t<DestinationStateDefn> m_destinationStateByCorrelationId;
+    state_map_t<BatchStateDefn> m_batchByRegistrationId;
 
     std::unordered_map<std::int64_t, LogBuffersDefn> m_logBuffersByRegistrationId;
     std::vector<ImageListLingerDefn> m_lingeringImageLists;
 
+    // owned by the client threads under m_clientLock, which the conductor thread never takes
+    state_map_t<PublicationStateDefn> m_clientPublicationByRegistrationId;
+    state_map_t<ExclusivePublicationStateDefn> m_clientExclusivePublicationByRegistrationId;
+    state_map_t<SubscriptionStateDefn> m_clientSubscriptionByRegistrationId;
+    state_map_t<CounterStateDefn> m_clientCounterByRegistrationId;
+    state_map_t<DestinationStateDefn> m_clientDestinationStateByCorrelationId;
+    state_map_t<BatchStateDefn> m_clientBatchByRegistrationId;
+    std::mutex m_clientLock;
+
     DriverProxy &m_driverProxy;
     DriverListenerAdapter<ClientConductor> m_driverListenerAdapter;
 
@@ -420,10 +476,11 @@ private:
     long m_resourceLingerTimeoutMs;
     long m_interServiceTimeoutMs;
     bool m_preTouchMappedMemory;
-    bool m_isInCallback = false;
     std::atomic<bool> m_driverActive = { true };
     std::atomic<bool> m_isClosed = { false };
-    std::recursive_mutex m_adminLock;
+    // unbounded so client threads never fail to hand over a command, commands accumulate while the conductor is
+    // not running, e.g. between calls to invoke() with an agent invoker, and are freed as it drains them
+    ManyToOneConcurrentLinkedQueue<command_t> m_commandQueue;
     std::unique_ptr<AtomicCounter> m_heartbeatTimestamp;
 
     long long m_timeOfLastDoWorkMs;
@@ -544,15 +601,76 @@ private:
         }
     }
 
-    inline void ensureNotReentrant()
+    // to be called with m_clientLock held
+    inline std::shared_ptr<BatchStateDefn> &findUnsubmittedBatch(std::int64_t batchId)
     {
-        if (m_isInCallback)
+        auto it = m_clientBatchByRegistrationId.find(batchId);
+        if (it == m_clientBatchByRegistrationId.end())
         {
-            ReentrantException exception("client cannot be invoked within callback", SOURCEINFO);
-            m_errorHandler(exception);
+            throw IllegalArgumentException("batchId unknown", SOURCEINFO);
+        }
+
+        if (it->second->m_isSubmitted)
+        {
+            throw IllegalStateException("batch has already been submitted", SOURCEINFO);
         }
+
+        return it->second;
     }
 
+    template<typename S>
+    inline std::shared_ptr<S> findClientState(state_map_t<S> &clientStateMap, std::int64_t id)
+    {
+        std::lock_guard<std::mutex> lock(m_clientLock);
+
+        auto it = clientStateMap.find(id);
+        return it != clientStateMap.end() ? it->second : std::shared_ptr<S>();
+    }
+
+    /*
+     * The removed state is handed back so it is destroyed after m_clientLock is released, as it may hold the last
+     * reference to a resource whose destructor releases it through this conductor.
+     */
+    template<typename S>
+    inline std::shared_ptr<S> removeClientState(state_map_t<S> &clientStateMap, std::int64_t id)
+    {
+        std::lock_guard<std::mutex> lock(m_clientLock);
+
+        std::shared_ptr<S> state;
+        auto it = clientStateMap.find(id);
+        if (it != clientStateMap.end())
+        {
+            state = std::move(it->second);
+            clientStateMap.erase(it);
+        }
+
+        return state;
+    }
+
+    void ensureNotReentrant();
+
+    void offerCommand(command_t &&command);
+
+    /*
+     * A driver response can overtake the command which registered the state it completes, so the handlers of
+     * driver responses process outstanding commands before looking up state.
+     */
+    int processCommands();
+
+    template<typename T, typename S>
+    std::shared_ptr<T> findResource(state_map_t<S> &clientStateMap, std::int64_t registrationId);
+
+    template<typename S>
+    void registerState(
+        state_map_t<S> &clientStateMap, state_map_t<S> &stateMap, std::int64_t id, const std::shared_ptr<S> &state);
+
+    template<typename S>
+    void releaseState(state_map_t<S> &stateMap, std::int64_t registrationId);
+
+    template<typename S>
+    bool onStateErrorResponse(
+        state_map_t<S> &stateMap, std::int64_t correlationId, std::int32_t errorCode, const std::string &errorMessage);
+
     inline std::shared_ptr<LogBuffers> getLogBuffers(
         std::int64_t registrationId, const std::string &logFilename, const std::string &channel)
     {
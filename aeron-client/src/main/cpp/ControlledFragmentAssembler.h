@@ -17,6 +17,7 @@
 #define AERON_CONTROLLEDFRAGMENTASSEMBLER_H
 
 #include <unordered_map>
+#include <utility>
 #include "BufferBuilder.h"
 
 namespace aeron
@@ -36,8 +37,15 @@ static const std::size_t DEFAULT_CONTROLLED_FRAGMENT_ASSEMBLY_BUFFER_LENGTH = 40
  * Session based buffers will be allocated and grown as necessary based on the length of messages to be assembled.
  * When sessions go inactive see {@link on_unavailable_image_t}, it is possible to free the buffer by calling
  * {@link #deleteSessionBuffer(std::int32_t)}.
+ * <p>
+ * The delegate type is statically known, so passing the assembler itself to Subscription::controlledPoll or
+ * Image::controlledPoll, rather than a controlled_poll_fragment_handler_t, lets the compiler inline the delegate
+ * into the frame loop.
+ *
+ * @tparam H type of the delegate, callable as a controlled_poll_fragment_handler_t.
  */
-class ControlledFragmentAssembler
+template<typename H>
+class TypedControlledFragmentAssembler
 {
 public:
 
@@ -47,26 +55,38 @@ public:
      * @param delegate            onto which whole messages are forwarded.
      * @param initialBufferLength to be used for each session.
      */
-    explicit ControlledFragmentAssembler(
-        const controlled_poll_fragment_handler_t &delegate,
-        std::size_t initialBufferLength = DEFAULT_CONTROLLED_FRAGMENT_ASSEMBLY_BUFFER_LENGTH) :
+    explicit TypedControlledFragmentAssembler(
+        H delegate, std::size_t initialBufferLength = DEFAULT_CONTROLLED_FRAGMENT_ASSEMBLY_BUFFER_LENGTH) :
         m_initialBufferLength(initialBufferLength),
-        m_delegate(delegate)
+        m_delegate(std::move(delegate))
     {
     }
 
     /**
-     * Compose a controlled_poll_fragment_handler_t that calls the this ControlledFragmentAssembler instance for
-     * reassembly. Suitable for passing to Subscription::controlledPoll(controlled_poll_fragment_handler_t, int).
+     * Reassemble a fragment, forwarding it to the delegate once a whole message is available.
      *
-     * @return controlled_poll_fragment_handler_t composed with the ControlledFragmentAssembler instance
+     * @param buffer containing the data.
+     * @param offset at which the data begins.
+     * @param length of the data in bytes.
+     * @param header representing the meta data for the data.
+     * @return The action to be taken with regard to the stream position after the callback.
      */
-    controlled_poll_fragment_handler_t handler()
+    inline ControlledPollAction operator()(
+        AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
     {
-        return [this](AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+        const std::uint8_t flags = header.flags();
+        ControlledPollAction action = ControlledPollAction::CONTINUE;
+
+        if ((flags & FrameDescriptor::UNFRAGMENTED) == FrameDescriptor::UNFRAGMENTED)
         {
-            return this->onFragment(buffer, offset, length, header);
-        };
+            action = m_delegate(buffer, offset, length, header);
+        }
+        else
+        {
+            action = handleFragment(buffer, offset, length, header);
+        }
+
+        return action;
     }
 
     /**
@@ -82,26 +102,9 @@ public:
 
 private:
     const std::size_t m_initialBufferLength;
-    controlled_poll_fragment_handler_t m_delegate;
+    H m_delegate;
     std::unordered_map<std::int32_t, BufferBuilder> m_builderBySessionIdMap;
 
-    inline ControlledPollAction onFragment(AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
-    {
-        const std::uint8_t flags = header.flags();
-        ControlledPollAction action = ControlledPollAction::CONTINUE;
-
-        if ((flags & FrameDescriptor::UNFRAGMENTED) == FrameDescriptor::UNFRAGMENTED)
-        {
-            action = m_delegate(buffer, offset, length, header);
-        }
-        else
-        {
-            action = handleFragment(buffer, offset, length, header);
-        }
-
-        return action;
-    }
-
     ControlledPollAction handleFragment(AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
     {
         const std::uint8_t flags = header.flags();
@@ -173,5 +176,40 @@ private:
     }
 };
 
+/**
+ * A TypedControlledFragmentAssembler over a controlled_poll_fragment_handler_t.
+ */
+class ControlledFragmentAssembler : public TypedControlledFragmentAssembler<controlled_poll_fragment_handler_t>
+{
+public:
+
+    /**
+     * Construct an adapter to reassembly message fragments and delegate on only whole messages.
+     *
+     * @param delegate            onto which whole messages are forwarded.
+     * @param initialBufferLength to be used for each session.
+     */
+    explicit ControlledFragmentAssembler(
+        const controlled_poll_fragment_handler_t &delegate,
+        std::size_t initialBufferLength = DEFAULT_CONTROLLED_FRAGMENT_ASSEMBLY_BUFFER_LENGTH) :
+        TypedControlledFragmentAssembler<controlled_poll_fragment_handler_t>(delegate, initialBufferLength)
+    {
+    }
+
+    /**
+     * Compose a controlled_poll_fragment_handler_t that calls the this ControlledFragmentAssembler instance for
+     * reassembly. Suitable for passing to Subscription::controlledPoll(controlled_poll_fragment_handler_t, int).
+     *
+     * @return controlled_poll_fragment_handler_t composed with the ControlledFragmentAssembler instance
+     */
+    controlled_poll_fragment_handler_t handler()
+    {
+        return [this](AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+        {
+            return (*this)(buffer, offset, length, header);
+        };
+    }
+};
+
 }
 #endif
@@ -27,6 +27,7 @@
 #include "command/SubscriptionReadyFlyweight.h"
 #include "command/CounterUpdateFlyweight.h"
 #include "command/ClientTimeoutFlyweight.h"
+#include "command/BatchCompleteFlyweight.h"
 
 namespace aeron
 {
@@ -169,6 +170,26 @@ public:
                         break;
                     }
 
+                    case ControlProtocolEvents::ON_BATCH_COMPLETE:
+                    {
+                        const BatchCompleteFlyweight flyweight(buffer, offset);
+                        std::int32_t failedCount = 0;
+                        std::int32_t firstErrorCode = 0;
+
+                        for (std::int32_t i = 0, resultCount = flyweight.resultCount(); i < resultCount; i++)
+                        {
+                            const std::int32_t errorCode = flyweight.resultErrorCode(i);
+                            if (0 != errorCode)
+                            {
+                                firstErrorCode = 0 == failedCount ? errorCode : firstErrorCode;
+                                failedCount++;
+                            }
+                        }
+
+                        m_driverListener.onBatchComplete(flyweight.correlationId(), failedCount, firstErrorCode);
+                        break;
+                    }
+
                     default:
                         break;
                 }
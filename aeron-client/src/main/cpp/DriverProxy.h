@@ -17,6 +17,9 @@
 #ifndef AERON_DRIVER_PROXY_H
 #define AERON_DRIVER_PROXY_H
 
+#include <cstring>
+#include <vector>
+
 #include "concurrent/ringbuffer/ManyToOneRingBuffer.h"
 #include "command/PublicationMessageFlyweight.h"
 #include "command/RemoveMessageFlyweight.h"
@@ -24,6 +27,7 @@
 #include "command/DestinationMessageFlyweight.h"
 #include "command/CounterMessageFlyweight.h"
 #include "command/TerminateDriverFlyweight.h"
+#include "command/BatchMessageFlyweight.h"
 #include "command/ControlProtocolEvents.h"
 
 namespace aeron
@@ -36,6 +40,28 @@ using namespace aeron::concurrent::ringbuffer;
 class DriverProxy
 {
 public:
+    /**
+     * Commands held by the client until they are written to the driver as a single BATCH command.
+     */
+    class Batch
+    {
+        friend class DriverProxy;
+
+    public:
+        Batch() : m_buffer(sizeof(BatchMessageDefn), 0)
+        {
+        }
+
+        inline std::int32_t entryCount() const
+        {
+            return m_entryCount;
+        }
+
+    private:
+        std::vector<std::uint8_t> m_buffer;
+        std::int32_t m_entryCount = 0;
+    };
+
     explicit DriverProxy(ManyToOneRingBuffer &toDriverCommandBuffer) :
         m_toDriverCommandBuffer(toDriverCommandBuffer),
         m_clientId(toDriverCommandBuffer.nextCorrelationId())
@@ -61,11 +87,14 @@ public:
         return m_clientId;
     }
 
-    std::int64_t addPublication(const std::string &channel, std::int32_t streamId)
+    void addPublication(
+        std::int64_t correlationId,
+        const std::string &channel,
+        std::int32_t streamId,
+        Batch *batch = nullptr)
     {
-        std::int64_t correlationId = m_toDriverCommandBuffer.nextCorrelationId();
-
-        writeCommandToDriver(
+        writeCommand(
+            batch,
             [&](AtomicBuffer &buffer, util::index_t &length)
             {
                 PublicationMessageFlyweight publicationMessage(buffer, 0);
@@ -79,15 +108,16 @@ public:
 
                 return ControlProtocolEvents::ADD_PUBLICATION;
             });
-
-        return correlationId;
     }
 
-    std::int64_t addExclusivePublication(const std::string &channel, std::int32_t streamId)
+    void addExclusivePublication(
+        std::int64_t correlationId,
+        const std::string &channel,
+        std::int32_t streamId,
+        Batch *batch = nullptr)
     {
-        std::int64_t correlationId = m_toDriverCommandBuffer.nextCorrelationId();
-
-        writeCommandToDriver(
+        writeCommand(
+            batch,
             [&](AtomicBuffer &buffer, util::index_t &length)
             {
                 PublicationMessageFlyweight publicationMessage(buffer, 0);
@@ -101,15 +131,14 @@ public:
 
                 return ControlProtocolEvents::ADD_EXCLUSIVE_PUBLICATION;
             });
-
-        return correlationId;
     }
 
-    std::int64_t removePublication(std::int64_t registrationId)
+    std::int64_t removePublication(std::int64_t registrationId, Batch *batch = nullptr)
     {
         std::int64_t correlationId = m_toDriverCommandBuffer.nextCorrelationId();
 
-        writeCommandToDriver(
+        writeCommand(
+            batch,
             [&](AtomicBuffer &buffer, util::index_t &length)
             {
                 RemoveMessageFlyweight removeMessage(buffer, 0);
@@ -126,11 +155,14 @@ public:
         return correlationId;
     }
 
-    std::int64_t addSubscription(const std::string &channel, std::int32_t streamId)
+    void addSubscription(
+        std::int64_t correlationId,
+        const std::string &channel,
+        std::int32_t streamId,
+        Batch *batch = nullptr)
     {
-        std::int64_t correlationId = m_toDriverCommandBuffer.nextCorrelationId();
-
-        writeCommandToDriver(
+        writeCommand(
+            batch,
             [&](AtomicBuffer &buffer, util::index_t &length)
             {
                 SubscriptionMessageFlyweight subscriptionMessage(buffer, 0);
@@ -145,15 +177,14 @@ public:
 
                 return ControlProtocolEvents::ADD_SUBSCRIPTION;
             });
-
-        return correlationId;
     }
 
-    std::int64_t removeSubscription(std::int64_t registrationId)
+    std::int64_t removeSubscription(std::int64_t registrationId, Batch *batch = nullptr)
     {
         std::int64_t correlationId = m_toDriverCommandBuffer.nextCorrelationId();
 
-        writeCommandToDriver(
+        writeCommand(
+            batch,
             [&](AtomicBuffer &buffer, util::index_t &length)
             {
                 RemoveMessageFlyweight removeMessage(buffer, 0);
@@ -170,10 +201,8 @@ public:
         return correlationId;
     }
 
-    std::int64_t addDestination(std::int64_t publicationRegistrationId, const std::string &channel)
+    void addDestination(std::int64_t correlationId, std::int64_t publicationRegistrationId, const std::string &channel)
     {
-        std::int64_t correlationId = m_toDriverCommandBuffer.nextCorrelationId();
-
         writeCommandToDriver(
             [&](AtomicBuffer &buffer, util::index_t &length)
             {
@@ -188,14 +217,13 @@ public:
 
                 return ControlProtocolEvents::ADD_DESTINATION;
             });
-
-        return correlationId;
     }
 
-    std::int64_t removeDestination(std::int64_t publicationRegistrationId, const std::string &channel)
+    void removeDestination(
+        std::int64_t correlationId,
+        std::int64_t publicationRegistrationId,
+        const std::string &channel)
     {
-        std::int64_t correlationId = m_toDriverCommandBuffer.nextCorrelationId();
-
         writeCommandToDriver(
             [&](AtomicBuffer &buffer, util::index_t &length)
             {
@@ -210,14 +238,13 @@ public:
 
                 return ControlProtocolEvents::REMOVE_DESTINATION;
             });
-
-        return correlationId;
     }
 
-    std::int64_t addRcvDestination(std::int64_t subscriptionRegistrationId, const std::string &channel)
+    void addRcvDestination(
+        std::int64_t correlationId,
+        std::int64_t subscriptionRegistrationId,
+        const std::string &channel)
     {
-        std::int64_t correlationId = m_toDriverCommandBuffer.nextCorrelationId();
-
         writeCommandToDriver([
             &](AtomicBuffer &buffer, util::index_t &length)
             {
@@ -232,14 +259,13 @@ public:
 
                 return ControlProtocolEvents::ADD_RCV_DESTINATION;
             });
-
-        return correlationId;
     }
 
-    std::int64_t removeRcvDestination(std::int64_t subscriptionRegistrationId, const std::string &channel)
+    void removeRcvDestination(
+        std::int64_t correlationId,
+        std::int64_t subscriptionRegistrationId,
+        const std::string &channel)
     {
-        std::int64_t correlationId = m_toDriverCommandBuffer.nextCorrelationId();
-
         writeCommandToDriver(
             [&](AtomicBuffer &buffer, util::index_t &length)
             {
@@ -254,15 +280,18 @@ public:
 
                 return ControlProtocolEvents::REMOVE_RCV_DESTINATION;
             });
-
-        return correlationId;
     }
 
-    std::int64_t addCounter(std::int32_t typeId, const std::uint8_t *key, std::size_t keyLength, const std::string &label)
+    void addCounter(
+        std::int64_t correlationId,
+        std::int32_t typeId,
+        const std::uint8_t *key,
+        std::size_t keyLength,
+        const std::string &label,
+        Batch *batch = nullptr)
     {
-        std::int64_t correlationId = m_toDriverCommandBuffer.nextCorrelationId();
-
-        writeCommandToDriver(
+        writeCommand(
+            batch,
             [&](AtomicBuffer &buffer, util::index_t &length)
             {
                 CounterMessageFlyweight command(buffer, 0);
@@ -277,15 +306,14 @@ public:
 
                 return ControlProtocolEvents::ADD_COUNTER;
             });
-
-        return correlationId;
     }
 
-    std::int64_t removeCounter(std::int64_t registrationId)
+    std::int64_t removeCounter(std::int64_t registrationId, Batch *batch = nullptr)
     {
         std::int64_t correlationId = m_toDriverCommandBuffer.nextCorrelationId();
 
-        writeCommandToDriver(
+        writeCommand(
+            batch,
             [&](AtomicBuffer &buffer, util::index_t &length)
             {
                 RemoveMessageFlyweight command(buffer, 0);
@@ -322,6 +350,22 @@ public:
         return correlationId;
     }
 
+    void submitBatch(std::int64_t correlationId, Batch &batch)
+    {
+        AtomicBuffer buffer(batch.m_buffer.data(), batch.m_buffer.size());
+        BatchMessageFlyweight batchMessage(buffer, 0);
+
+        batchMessage.clientId(m_clientId);
+        batchMessage.correlationId(correlationId);
+        batchMessage.entryCount(batch.m_entryCount);
+        batchMessage.entriesLength(static_cast<std::int32_t>(batch.m_buffer.size() - sizeof(BatchMessageDefn)));
+
+        if (!m_toDriverCommandBuffer.write(ControlProtocolEvents::BATCH, buffer, 0, batchMessage.length()))
+        {
+            throw util::IllegalStateException("couldn't write command to driver", SOURCEINFO);
+        }
+    }
+
     void terminateDriver(const std::uint8_t *tokenBuffer, std::size_t tokenLength)
     {
         writeCommandToDriver(
@@ -359,6 +403,39 @@ private:
             throw util::IllegalStateException("couldn't write command to driver", SOURCEINFO);
         }
     }
+
+    template<typename Filler>
+    inline void writeCommand(Batch *batch, Filler &&filler)
+    {
+        if (nullptr == batch)
+        {
+            writeCommandToDriver(filler);
+            return;
+        }
+
+        AERON_DECL_ALIGNED(driver_proxy_command_buffer_t messageBuffer, 16);
+        AtomicBuffer buffer(messageBuffer);
+        util::index_t length = buffer.capacity();
+
+        util::index_t msgTypeId = filler(buffer, length);
+
+        const std::size_t offset = batch->m_buffer.size();
+        const std::size_t entryLength = static_cast<std::size_t>(BatchMessageFlyweight::entryLength(length));
+        const std::size_t maxMsgLength = static_cast<std::size_t>(m_toDriverCommandBuffer.maxMsgLength());
+        if (offset + entryLength > maxMsgLength)
+        {
+            throw util::IllegalArgumentException(
+                "batch length=" + std::to_string(offset + entryLength) +
+                " would exceed maxMsgLength=" + std::to_string(maxMsgLength),
+                SOURCEINFO);
+        }
+
+        const BatchEntryHeaderDefn header = { msgTypeId, length };
+        batch->m_buffer.resize(offset + entryLength, 0);
+        std::memcpy(batch->m_buffer.data() + offset, &header, sizeof(header));
+        std::memcpy(batch->m_buffer.data() + offset + sizeof(header), messageBuffer.data(), length);
+        batch->m_entryCount++;
+    }
 };
 
 }
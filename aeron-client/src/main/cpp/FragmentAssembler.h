@@ -18,6 +18,7 @@
 #define AERON_FRAGMENT_ASSEMBLER_H
 
 #include <unordered_map>
+#include <utility>
 #include "BufferBuilder.h"
 
 namespace aeron
@@ -37,8 +38,14 @@ static const std::size_t DEFAULT_FRAGMENT_ASSEMBLY_BUFFER_LENGTH = 4096;
  * Session based buffers will be allocated and grown as necessary based on the length of messages to be assembled.
  * When sessions go inactive see {@link on_unavailable_image_t}, it is possible to free the buffer by calling
  * {@link #deleteSessionBuffer(std::int32_t)}.
+ * <p>
+ * The delegate type is statically known, so passing the assembler itself to Subscription::poll or Image::poll,
+ * rather than a fragment_handler_t, lets the compiler inline the delegate into the frame loop.
+ *
+ * @tparam H type of the delegate, callable as a fragment_handler_t.
  */
-class FragmentAssembler
+template<typename H>
+class TypedFragmentAssembler
 {
 public:
 
@@ -48,25 +55,33 @@ public:
      * @param delegate            onto which whole messages are forwarded.
      * @param initialBufferLength to be used for each session.
      */
-    explicit FragmentAssembler(
-        const fragment_handler_t &delegate, std::size_t initialBufferLength = DEFAULT_FRAGMENT_ASSEMBLY_BUFFER_LENGTH) :
+    explicit TypedFragmentAssembler(
+        H delegate, std::size_t initialBufferLength = DEFAULT_FRAGMENT_ASSEMBLY_BUFFER_LENGTH) :
         m_initialBufferLength(initialBufferLength),
-        m_delegate(delegate)
+        m_delegate(std::move(delegate))
     {
     }
 
     /**
-     * Compose a fragment_handler_t that calls the this FragmentAssembler instance for reassembly. Suitable for
-     * passing to Subscription::poll(fragment_handler_t, int).
+     * Reassemble a fragment, forwarding it to the delegate once a whole message is available.
      *
-     * @return fragment_handler_t composed with the FragmentAssembler instance
+     * @param buffer containing the data.
+     * @param offset at which the data begins.
+     * @param length of the data in bytes.
+     * @param header representing the meta data for the data.
      */
-    fragment_handler_t handler()
+    inline void operator()(AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
     {
-        return [this](AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+        const std::uint8_t flags = header.flags();
+
+        if ((flags & FrameDescriptor::UNFRAGMENTED) == FrameDescriptor::UNFRAGMENTED)
         {
-            this->onFragment(buffer, offset, length, header);
-        };
+            m_delegate(buffer, offset, length, header);
+        }
+        else
+        {
+            handleFragment(buffer, offset, length, header);
+        }
     }
 
     /**
@@ -82,23 +97,9 @@ public:
 
 private:
     const std::size_t m_initialBufferLength;
-    fragment_handler_t m_delegate;
+    H m_delegate;
     std::unordered_map<std::int32_t, BufferBuilder> m_builderBySessionIdMap;
 
-    inline void onFragment(AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
-    {
-        const std::uint8_t flags = header.flags();
-
-        if ((flags & FrameDescriptor::UNFRAGMENTED) == FrameDescriptor::UNFRAGMENTED)
-        {
-            m_delegate(buffer, offset, length, header);
-        }
-        else
-        {
-            handleFragment(buffer, offset, length, header);
-        }
-    }
-
     void handleFragment(AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
     {
         const std::uint8_t flags = header.flags();
@@ -159,6 +160,40 @@ private:
     }
 };
 
+/**
+ * A TypedFragmentAssembler over a fragment_handler_t.
+ */
+class FragmentAssembler : public TypedFragmentAssembler<fragment_handler_t>
+{
+public:
+
+    /**
+     * Construct an adapter to reassembly message fragments and delegate on only whole messages.
+     *
+     * @param delegate            onto which whole messages are forwarded.
+     * @param initialBufferLength to be used for each session.
+     */
+    explicit FragmentAssembler(
+        const fragment_handler_t &delegate, std::size_t initialBufferLength = DEFAULT_FRAGMENT_ASSEMBLY_BUFFER_LENGTH) :
+        TypedFragmentAssembler<fragment_handler_t>(delegate, initialBufferLength)
+    {
+    }
+
+    /**
+     * Compose a fragment_handler_t that calls the this FragmentAssembler instance for reassembly. Suitable for
+     * passing to Subscription::poll(fragment_handler_t, int).
+     *
+     * @return fragment_handler_t composed with the FragmentAssembler instance
+     */
+    fragment_handler_t handler()
+    {
+        return [this](AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+        {
+            (*this)(buffer, offset, length, header);
+        };
+    }
+};
+
 }
 
 #endif
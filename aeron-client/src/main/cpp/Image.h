@@ -149,7 +149,10 @@ public:
         m_joinPosition(image.m_joinPosition),
         m_finalPosition(image.m_finalPosition),
         m_subscriptionRegistrationId(image.m_subscriptionRegistrationId),
-        m_correlationId(image.m_correlationId)
+        m_correlationId(image.m_correlationId),
+        m_fairPollWeight(image.m_fairPollWeight),
+        m_fairPollDeficit(image.m_fairPollDeficit),
+        m_fairPollStarvedCount(image.m_fairPollStarvedCount)
     {
     }
 
@@ -170,6 +173,9 @@ public:
         m_finalPosition = image.m_finalPosition;
         m_subscriptionRegistrationId = image.m_subscriptionRegistrationId;
         m_correlationId = image.m_correlationId;
+        m_fairPollWeight = image.m_fairPollWeight;
+        m_fairPollDeficit = image.m_fairPollDeficit;
+        m_fairPollStarvedCount = image.m_fairPollStarvedCount;
 
         return *this;
     }
@@ -189,7 +195,10 @@ public:
         m_joinPosition(image.m_joinPosition),
         m_finalPosition(image.m_finalPosition),
         m_subscriptionRegistrationId(image.m_subscriptionRegistrationId),
-        m_correlationId(image.m_correlationId)
+        m_correlationId(image.m_correlationId),
+        m_fairPollWeight(image.m_fairPollWeight),
+        m_fairPollDeficit(image.m_fairPollDeficit),
+        m_fairPollStarvedCount(image.m_fairPollStarvedCount)
     {
     }
 
@@ -210,6 +219,9 @@ public:
         m_finalPosition = image.m_finalPosition;
         m_subscriptionRegistrationId = image.m_subscriptionRegistrationId;
         m_correlationId = image.m_correlationId;
+        m_fairPollWeight = image.m_fairPollWeight;
+        m_fairPollDeficit = image.m_fairPollDeficit;
+        m_fairPollStarvedCount = image.m_fairPollStarvedCount;
 
         return *this;
     }
@@ -432,6 +444,136 @@ public:
         return outcome.fragmentsRead;
     }
 
+    /**
+     * Set the weight of this image for Subscription::fairPoll. An image of weight n is granted n times as many
+     * fragments per round as an image of weight 1. Images default to a weight of 1.
+     *
+     * @param weight to apply, must be > 0.
+     */
+    inline void fairPollWeight(std::int32_t weight)
+    {
+        if (weight <= 0)
+        {
+            throw util::IllegalArgumentException("weight must be > 0: " + std::to_string(weight), SOURCEINFO);
+        }
+
+        m_fairPollWeight = weight;
+    }
+
+    /**
+     * The weight of this image for Subscription::fairPoll.
+     *
+     * @return the weight of this image for Subscription::fairPoll.
+     */
+    inline std::int32_t fairPollWeight() const
+    {
+        return m_fairPollWeight;
+    }
+
+    /**
+     * Number of times Subscription::fairPoll reached its fragment limit before polling this image while it had
+     * fragments available.
+     *
+     * @return the number of times this image was starved.
+     */
+    inline std::int64_t fairPollStarvedCount() const
+    {
+        return m_fairPollStarvedCount;
+    }
+
+    /// @cond HIDDEN_SYMBOLS
+    template<typename F>
+    inline int fairPoll(F &&fragmentHandler, int fragmentLimit, int imageFragmentQuantum)
+    {
+        const std::int64_t quantum = static_cast<std::int64_t>(imageFragmentQuantum) * m_fairPollWeight;
+        m_fairPollDeficit += quantum;
+        const int budget = static_cast<int>(std::min<std::int64_t>(m_fairPollDeficit, fragmentLimit));
+
+        const int fragmentsRead = poll(std::forward<F>(fragmentHandler), budget);
+        m_fairPollDeficit -= fragmentsRead;
+
+        if (fragmentsRead < budget)
+        {
+            // a drained image does not bank credit, as in deficit round-robin
+            m_fairPollDeficit = 0;
+        }
+        else if (m_fairPollDeficit > quantum)
+        {
+            m_fairPollDeficit = quantum;
+        }
+
+        return fragmentsRead;
+    }
+
+    inline bool isFragmentAvailable()
+    {
+        if (isClosed())
+        {
+            return false;
+        }
+
+        const std::int64_t position = m_subscriberPosition.get();
+        const auto offset = static_cast<std::int32_t>(position & m_termLengthMask);
+        const int index = LogBufferDescriptor::indexByPosition(position, m_positionBitsToShift);
+
+        return FrameDescriptor::frameLengthVolatile(m_termBuffers[index], offset) > 0;
+    }
+
+    inline void onFairPollStarved()
+    {
+        m_fairPollStarvedCount++;
+    }
+    /// @endcond
+
+    /**
+     * Poll for new messages in a stream. If new messages are found beyond the last consumed position then they
+     * will be delivered via the batch_fragment_handler_t in batches of up to FRAGMENT_BATCH_MAX_LENGTH, up to a
+     * limited number of fragments as specified.
+     *
+     * @param batchHandler  to which batches of messages are delivered.
+     * @param fragmentLimit for the number of fragments to be consumed during one polling operation.
+     * @return the number of fragments that have been consumed.
+     *
+     * @see batch_fragment_handler_t
+     */
+    template<typename F>
+    inline int pollBatch(F &&batchHandler, int fragmentLimit)
+    {
+        if (isClosed())
+        {
+            return 0;
+        }
+
+        if (m_batchHeaders.empty())
+        {
+            m_batchHeaders.assign(FRAGMENT_BATCH_MAX_LENGTH, m_header);
+        }
+
+        const std::int64_t position = m_subscriberPosition.get();
+        const auto offset = static_cast<std::int32_t>(position & m_termLengthMask);
+        const int index = LogBufferDescriptor::indexByPosition(position, m_positionBitsToShift);
+        assert(index >= 0 && index < LogBufferDescriptor::PARTITION_COUNT);
+        AtomicBuffer &termBuffer = m_termBuffers[index];
+        TermReader::ReadOutcome outcome{};
+
+        TermReader::readBatch(
+            outcome,
+            termBuffer,
+            offset,
+            std::forward<F>(batchHandler),
+            fragmentLimit,
+            m_batchHeaders.data(),
+            m_exceptionHandler);
+
+        const std::int64_t newPosition = position + (outcome.offset - offset);
+        if (newPosition > position)
+        {
+            m_subscriberPosition.setOrdered(newPosition);
+        }
+
+        return outcome.fragmentsRead;
+    }
+
     /**
      * Poll for new messages in a stream. If new messages are found beyond the last consumed position then they
      * will be delivered via the fragment_handler_t up to a limited number of fragments as specified or the
@@ -882,6 +1024,7 @@ private:
     std::array<AtomicBuffer, LogBufferDescriptor::PARTITION_COUNT> m_termBuffers;
     Position<UnsafeBufferPosition> m_subscriberPosition;
     Header m_header;
+    std::vector<Header> m_batchHeaders;
     std::atomic<bool> m_isClosed = { false };
     bool m_isEos = false;
 
@@ -893,6 +1036,9 @@ private:
     std::int64_t m_subscriptionRegistrationId;
     std::int64_t m_correlationId;
     std::int64_t m_eosPosition = INT64_MAX;
+    std::int32_t m_fairPollWeight = 1;
+    std::int64_t m_fairPollDeficit = 0;
+    std::int64_t m_fairPollStarvedCount = 0;
 
     void validatePosition(std::int64_t newPosition)
     {
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_IMAGE_SCATTER_FRAGMENT_ASSEMBLER_H
+#define AERON_IMAGE_SCATTER_FRAGMENT_ASSEMBLER_H
+
+#include "BufferBuilder.h"
+
+namespace aeron
+{
+
+/**
+ * Callback for handling a whole message as views of the term buffer, one per fragment, read in order.
+ *
+ * The views point into the term buffer and are only valid for the duration of the callback.
+ *
+ * @param buffers holding the message payload.
+ * @param length  of the message in bytes.
+ * @param header  representing the meta data for the data.
+ */
+typedef std::function<void(
+    const std::vector<AtomicBuffer> &buffers,
+    util::index_t length,
+    Header &header)> scatter_fragment_handler_t;
+
+/**
+ * A handler that sits in a chain-of-responsibility pattern that reassembles fragmented messages without copying
+ * them, so that the next handler in the chain only sees whole messages.
+ * <p>
+ * Fragments are handed over as views of the term buffer under the rules for the iovec fragment assemblers in aeronc.h.
+ * <p>
+ * The Header passed to the delegate on assembling a message will be that of the last fragment.
+ * <p>
+ * This handler is not session aware and must only be used when polling a single Image.
+ */
+class ImageScatterFragmentAssembler
+{
+public:
+
+    /**
+     * Construct an adapter to reassemble message fragments and delegate on only whole messages.
+     *
+     * @param delegate onto which whole messages are forwarded.
+     */
+    explicit ImageScatterFragmentAssembler(const scatter_fragment_handler_t &delegate) :
+        m_delegate(delegate),
+        m_unfragmented(1)
+    {
+    }
+
+    /**
+     * Compose a fragment_handler_t that calls the ImageScatterFragmentAssembler instance for reassembly. Suitable
+     * for passing to Image::poll(fragment_handler_t, int).
+     *
+     * @return fragment_handler_t composed with the ImageScatterFragmentAssembler instance
+     */
+    fragment_handler_t handler()
+    {
+        return [this](AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+        {
+            this->onFragment(buffer, offset, length, header);
+        };
+    }
+
+private:
+    scatter_fragment_handler_t m_delegate;
+    BufferBuilder m_builder;
+    std::vector<AtomicBuffer> m_unfragmented;
+
+    inline void onFragment(AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+    {
+        std::uint8_t flags = header.flags();
+
+        if ((flags & FrameDescriptor::UNFRAGMENTED) == FrameDescriptor::UNFRAGMENTED)
+        {
+            m_unfragmented[0].wrap(buffer.buffer() + offset, static_cast<std::size_t>(length));
+            m_delegate(m_unfragmented, length, header);
+        }
+        else
+        {
+            handleFragment(buffer, offset, length, header);
+        }
+    }
+
+    void handleFragment(AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+    {
+        std::uint8_t flags = header.flags();
+
+        if ((flags & FrameDescriptor::BEGIN_FRAG) == FrameDescriptor::BEGIN_FRAG)
+        {
+            m_builder.reset()
+                .captureHeader(header)
+                .appendView(buffer, offset, length)
+                .nextTermOffset(header.nextTermOffset());
+        }
+        else if (m_builder.nextTermOffset() == header.termOffset())
+        {
+            m_builder.appendView(buffer, offset, length);
+
+            if ((flags & FrameDescriptor::END_FRAG) == FrameDescriptor::END_FRAG)
+            {
+                m_delegate(m_builder.views(), (util::index_t)m_builder.limit(), m_builder.completeHeader(header));
+
+                m_builder.reset();
+            }
+            else
+            {
+                m_builder.nextTermOffset(header.nextTermOffset());
+            }
+        }
+        else
+        {
+            m_builder.reset();
+        }
+    }
+};
+
+}
+
+#endif
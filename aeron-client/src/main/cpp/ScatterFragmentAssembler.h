@@ -0,0 +1,142 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_SCATTER_FRAGMENT_ASSEMBLER_H
+#define AERON_SCATTER_FRAGMENT_ASSEMBLER_H
+
+#include <unordered_map>
+#include "ImageScatterFragmentAssembler.h"
+
+namespace aeron
+{
+
+/**
+ * A handler that sits in a chain-of-responsibility pattern that reassembles fragmented messages without copying
+ * them, so that the next handler in the chain only sees whole messages.
+ * <p>
+ * Fragments are handed over as views of the term buffer under the rules for the iovec fragment assemblers in aeronc.h.
+ * <p>
+ * The Header passed to the delegate on assembling a message will be that of the last fragment.
+ * <p>
+ * Session based view lists are allocated as necessary. When sessions go inactive see {@link on_unavailable_image_t},
+ * it is possible to free them by calling {@link #deleteSessionBuffer(std::int32_t)}.
+ */
+class ScatterFragmentAssembler
+{
+public:
+
+    /**
+     * Construct an adapter to reassemble message fragments and delegate on only whole messages.
+     *
+     * @param delegate onto which whole messages are forwarded.
+     */
+    explicit ScatterFragmentAssembler(const scatter_fragment_handler_t &delegate) :
+        m_delegate(delegate),
+        m_unfragmented(1)
+    {
+    }
+
+    /**
+     * Compose a fragment_handler_t that calls the this ScatterFragmentAssembler instance for reassembly. Suitable
+     * for passing to Subscription::poll(fragment_handler_t, int).
+     *
+     * @return fragment_handler_t composed with the ScatterFragmentAssembler instance
+     */
+    fragment_handler_t handler()
+    {
+        return [this](AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+        {
+            this->onFragment(buffer, offset, length, header);
+        };
+    }
+
+    /**
+     * Free an existing session view list when an Image goes inactive.
+     *
+     * @param sessionId to have its view list freed
+     */
+    void deleteSessionBuffer(std::int32_t sessionId)
+    {
+        m_builderBySessionIdMap.erase(sessionId);
+    }
+
+private:
+    scatter_fragment_handler_t m_delegate;
+    std::vector<AtomicBuffer> m_unfragmented;
+    std::unordered_map<std::int32_t, BufferBuilder> m_builderBySessionIdMap;
+
+    inline void onFragment(AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+    {
+        const std::uint8_t flags = header.flags();
+
+        if ((flags & FrameDescriptor::UNFRAGMENTED) == FrameDescriptor::UNFRAGMENTED)
+        {
+            m_unfragmented[0].wrap(buffer.buffer() + offset, static_cast<std::size_t>(length));
+            m_delegate(m_unfragmented, length, header);
+        }
+        else
+        {
+            handleFragment(buffer, offset, length, header);
+        }
+    }
+
+    void handleFragment(AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+    {
+        const std::uint8_t flags = header.flags();
+
+        if ((flags & FrameDescriptor::BEGIN_FRAG) == FrameDescriptor::BEGIN_FRAG)
+        {
+            BufferBuilder &builder = m_builderBySessionIdMap[header.sessionId()];
+            builder.reset()
+                .captureHeader(header)
+                .appendView(buffer, offset, length)
+                .nextTermOffset(header.nextTermOffset());
+        }
+        else
+        {
+            auto result = m_builderBySessionIdMap.find(header.sessionId());
+
+            if (result != m_builderBySessionIdMap.end())
+            {
+                BufferBuilder &builder = result->second;
+
+                if (header.termOffset() == builder.nextTermOffset())
+                {
+                    builder.appendView(buffer, offset, length);
+
+                    if ((flags & FrameDescriptor::END_FRAG) == FrameDescriptor::END_FRAG)
+                    {
+                        m_delegate(builder.views(), (util::index_t)builder.limit(), builder.completeHeader(header));
+
+                        builder.reset();
+                    }
+                    else
+                    {
+                        builder.nextTermOffset(header.nextTermOffset());
+                    }
+                }
+                else
+                {
+                    builder.reset();
+                }
+            }
+        }
+    }
+};
+
+}
+
+#endif
@@ -232,6 +232,134 @@ public:
         return fragmentsRead;
     }
 
+    /**
+     * Poll the {@link Image}s under the subscription for available message fragments, sharing the fragment limit
+     * fairly between Image s with deficit round-robin. Each round every Image is granted imageFragmentQuantum
+     * fragments multiplied by its Image::fairPollWeight, and rounds repeat until the fragment limit is reached or no
+     * Image has anything left to read. Unused credit is carried over for at most one quantum and is dropped when an
+     * Image has nothing left to read.
+     * <p>
+     * Image s which had fragments available but were not reached before the fragment limit was exhausted are counted
+     * as starved, see Image::fairPollStarvedCount and #fairPollStarvedCount.
+     *
+     * @param fragmentHandler      callback for handling each message fragment as it is read.
+     * @param fragmentLimit        number of message fragments to limit for the poll across multiple Image s.
+     * @param imageFragmentQuantum number of fragments granted to an Image of weight 1 per round, must be > 0.
+     * @return the number of fragments received.
+     *
+     * @see fragment_handler_t
+     */
+    template<typename F>
+    inline int fairPoll(F &&fragmentHandler, int fragmentLimit, int imageFragmentQuantum)
+    {
+        if (imageFragmentQuantum <= 0)
+        {
+            throw util::IllegalArgumentException(
+                "imageFragmentQuantum must be > 0: " + std::to_string(imageFragmentQuantum), SOURCEINFO);
+        }
+
+        auto imageArrayPair = m_imageArray.load();
+        auto imageArray = imageArrayPair.first;
+        const std::size_t length = imageArrayPair.second;
+        int fragmentsRead = 0;
+        std::size_t firstRoundVisited = 0;
+
+        std::size_t startingIndex = m_roundRobinIndex++;
+        if (startingIndex >= length)
+        {
+            m_roundRobinIndex = startingIndex = 0;
+        }
+
+        bool isFirstRound = true;
+        bool isProgress = true;
+
+        while (isProgress && fragmentsRead < fragmentLimit)
+        {
+            isProgress = false;
+
+            for (std::size_t i = 0; i < length && fragmentsRead < fragmentLimit; i++)
+            {
+                const std::size_t index = startingIndex + i;
+                const int read = imageArray[index < length ? index : index - length]->fairPoll(
+                    std::forward<F>(fragmentHandler), fragmentLimit - fragmentsRead, imageFragmentQuantum);
+
+                if (isFirstRound)
+                {
+                    firstRoundVisited++;
+                }
+
+                if (read > 0)
+                {
+                    fragmentsRead += read;
+                    isProgress = true;
+                }
+            }
+
+            isFirstRound = false;
+        }
+
+        for (std::size_t i = firstRoundVisited; i < length; i++)
+        {
+            const std::size_t index = startingIndex + i;
+            Image &image = *imageArray[index < length ? index : index - length];
+
+            if (image.isFragmentAvailable())
+            {
+                image.onFairPollStarved();
+                m_fairPollStarvedCount++;
+            }
+        }
+
+        return fragmentsRead;
+    }
+
+    /**
+     * Number of times an Image of this subscription was starved by #fairPoll.
+     *
+     * @return the number of times an Image with fragments available was not polled.
+     */
+    inline std::int64_t fairPollStarvedCount() const
+    {
+        return m_fairPollStarvedCount;
+    }
+
+    /**
+     * Poll the {@link Image}s under the subscription for available message fragments, delivering them in batches
+     * of up to FRAGMENT_BATCH_MAX_LENGTH fragments from the same Image per call to the handler.
+     *
+     * @param batchHandler  callback for handling each batch of message fragments as it is read.
+     * @param fragmentLimit number of message fragments to limit for the poll across multiple Image s.
+     * @return the number of fragments received.
+     *
+     * @see batch_fragment_handler_t
+     */
+    template<typename F>
+    inline int pollBatch(F &&batchHandler, int fragmentLimit)
+    {
+        auto imageArrayPair = m_imageArray.load();
+        auto imageArray = imageArrayPair.first;
+        const std::size_t length = imageArrayPair.second;
+        int fragmentsRead = 0;
+
+        std::size_t startingIndex = m_roundRobinIndex++;
+        if (startingIndex >= length)
+        {
+            m_roundRobinIndex = startingIndex = 0;
+        }
+
+        for (std::size_t i = startingIndex; i < length && fragmentsRead < fragmentLimit; i++)
+        {
+            fragmentsRead += imageArray[i]->pollBatch(std::forward<F>(batchHandler), fragmentLimit - fragmentsRead);
+        }
+
+        for (std::size_t i = 0; i < startingIndex && fragmentsRead < fragmentLimit; i++)
+        {
+            fragmentsRead += imageArray[i]->pollBatch(std::forward<F>(batchHandler), fragmentLimit - fragmentsRead);
+        }
+
+        return fragmentsRead;
+    }
+
     /**
      * Poll in a controlled manner the Image s under the subscription for available message fragments.
      * Control is applied to fragments in the stream. If more fragments can be read on another stream
@@ -528,6 +656,7 @@ private:
     AtomicArrayUpdater<std::shared_ptr<Image>> m_imageArray = {};
     char m_paddingBefore[util::BitUtil::CACHE_LINE_LENGTH] = {};
     std::size_t m_roundRobinIndex = 0;
+    std::int64_t m_fairPollStarvedCount = 0;
     char m_paddingAfter[util::BitUtil::CACHE_LINE_LENGTH] = {};
 };
 
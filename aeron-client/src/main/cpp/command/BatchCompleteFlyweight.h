@@ -0,0 +1,101 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_COMMAND_BATCH_COMPLETE_FLYWEIGHT_H
+#define AERON_COMMAND_BATCH_COMPLETE_FLYWEIGHT_H
+
+#include <cstdint>
+#include <cstddef>
+#include "Flyweight.h"
+
+namespace aeron { namespace command
+{
+
+/**
+ * Message to denote that every command in a batch has been processed, with the error code of each in order. An
+ * error code of 0 means the command succeeded.
+ *
+ *   0                   1                   2                   3
+ *   0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+ *  +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *  |                       Correlation ID                          |
+ *  |                                                               |
+ *  +---------------------------------------------------------------+
+ *  |                        Result Count                           |
+ *  +---------------------------------------------------------------+
+ *  |                   Result Correlation ID 0                     |
+ *  |                                                               |
+ *  +---------------------------------------------------------------+
+ *  |                       Result Error Code 0                     |
+ *  +---------------------------------------------------------------+
+ *  |                             ...                              ...
+ *  +---------------------------------------------------------------+
+ */
+#pragma pack(push)
+#pragma pack(4)
+struct BatchCompleteDefn
+{
+    std::int64_t correlationId;
+    std::int32_t resultCount;
+};
+
+struct BatchResultDefn
+{
+    std::int64_t correlationId;
+    std::int32_t errorCode;
+};
+#pragma pack(pop)
+
+class BatchCompleteFlyweight : public Flyweight<BatchCompleteDefn>
+{
+public:
+    typedef BatchCompleteFlyweight this_t;
+
+    inline BatchCompleteFlyweight(concurrent::AtomicBuffer &buffer, util::index_t offset) :
+        Flyweight<BatchCompleteDefn>(buffer, offset)
+    {
+    }
+
+    inline std::int64_t correlationId() const
+    {
+        return m_struct.correlationId;
+    }
+
+    inline std::int32_t resultCount() const
+    {
+        return m_struct.resultCount;
+    }
+
+    inline std::int64_t resultCorrelationId(std::int32_t index) const
+    {
+        return result(index).correlationId;
+    }
+
+    inline std::int32_t resultErrorCode(std::int32_t index) const
+    {
+        return result(index).errorCode;
+    }
+
+private:
+    inline const BatchResultDefn &result(std::int32_t index) const
+    {
+        return overlayStruct<BatchResultDefn>(
+            static_cast<util::index_t>(sizeof(BatchCompleteDefn) + (index * sizeof(BatchResultDefn))));
+    }
+};
+
+}}
+#endif
@@ -0,0 +1,121 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_BATCH_MESSAGE_FLYWEIGHT_H
+#define AERON_BATCH_MESSAGE_FLYWEIGHT_H
+
+#include <cstdint>
+#include <cstddef>
+#include "util/BitUtil.h"
+#include "CorrelatedMessageFlyweight.h"
+
+namespace aeron { namespace command
+{
+
+/**
+ * Control message carrying a batch of add and remove commands to be processed by the driver in a single pass.
+ *
+ * Each entry is the msg type id and length of a command followed by the command itself, padded to
+ * BATCH_ENTRY_ALIGNMENT.
+ *
+ * @see ControlProtocolEvents
+ * <pre>
+ *   0                   1                   2                   3
+ *   0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+ *  +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *  |                         Client ID                             |
+ *  |                                                               |
+ *  +---------------------------------------------------------------+
+ *  |                       Correlation ID                          |
+ *  |                                                               |
+ *  +---------------------------------------------------------------+
+ *  |                         Entry Count                           |
+ *  +---------------------------------------------------------------+
+ *  |                        Entries Length                         |
+ *  +---------------------------------------------------------------+
+ *  |                          Entries                             ...
+ * ...                                                              |
+ *  +---------------------------------------------------------------+
+ * </pre>
+ */
+#pragma pack(push)
+#pragma pack(4)
+struct BatchMessageDefn
+{
+    CorrelatedMessageDefn correlatedMessage;
+    std::int32_t entryCount;
+    std::int32_t entriesLength;
+};
+
+struct BatchEntryHeaderDefn
+{
+    std::int32_t msgTypeId;
+    std::int32_t length;
+};
+#pragma pack(pop)
+
+static const util::index_t BATCH_ENTRY_ALIGNMENT = sizeof(std::int64_t);
+
+class BatchMessageFlyweight : public CorrelatedMessageFlyweight
+{
+public:
+    typedef BatchMessageFlyweight this_t;
+
+    inline BatchMessageFlyweight(concurrent::AtomicBuffer &buffer, util::index_t offset) :
+        CorrelatedMessageFlyweight(buffer, offset), m_struct(overlayStruct<BatchMessageDefn>(0))
+    {
+    }
+
+    inline std::int32_t entryCount() const
+    {
+        return m_struct.entryCount;
+    }
+
+    inline this_t &entryCount(std::int32_t value)
+    {
+        m_struct.entryCount = value;
+        return *this;
+    }
+
+    inline std::int32_t entriesLength() const
+    {
+        return m_struct.entriesLength;
+    }
+
+    inline this_t &entriesLength(std::int32_t value)
+    {
+        m_struct.entriesLength = value;
+        return *this;
+    }
+
+    inline util::index_t length() const
+    {
+        return static_cast<util::index_t>(sizeof(BatchMessageDefn) + m_struct.entriesLength);
+    }
+
+    inline static util::index_t entryLength(util::index_t commandLength)
+    {
+        return util::BitUtil::align(
+            static_cast<util::index_t>(sizeof(BatchEntryHeaderDefn)) + commandLength, BATCH_ENTRY_ALIGNMENT);
+    }
+
+private:
+    BatchMessageDefn &m_struct;
+};
+
+}}
+
+#endif //AERON_BATCH_MESSAGE_FLYWEIGHT_H
@@ -0,0 +1,164 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_MANY_TO_ONE_CONCURRENT_LINKED_QUEUE_H
+#define AERON_MANY_TO_ONE_CONCURRENT_LINKED_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+#include "util/BitUtil.h"
+
+namespace aeron { namespace concurrent
+{
+
+/**
+ * Unbounded queue of elements which many threads may offer to and a single thread may drain. Each offer links in a
+ * newly allocated node so an offer never fails for want of capacity, which suits callers that cannot back off such
+ * as those releasing resources from destructors.
+ * <p>
+ * There is no backpressure: the cost is one node allocation per offer and, while the consumer is stalled, memory
+ * grows by one node per element offered until it drains again. Nodes are freed as they are drained.
+ *
+ * @tparam E type of the elements, which must be default constructible and movable.
+ */
+template<typename E>
+class ManyToOneConcurrentLinkedQueue
+{
+public:
+    ManyToOneConcurrentLinkedQueue() :
+        m_head(new Node())
+    {
+        m_tail.store(m_head, std::memory_order_relaxed);
+
+        static_cast<void>(m_tailPadding);
+        static_cast<void>(m_producerPadding);
+        static_cast<void>(m_consumerPadding);
+    }
+
+    ~ManyToOneConcurrentLinkedQueue()
+    {
+        Node *node = m_head;
+        while (nullptr != node)
+        {
+            Node *next = node->m_next.load(std::memory_order_relaxed);
+            delete node;
+            node = next;
+        }
+    }
+
+    ManyToOneConcurrentLinkedQueue(const ManyToOneConcurrentLinkedQueue &) = delete;
+
+    ManyToOneConcurrentLinkedQueue &operator=(const ManyToOneConcurrentLinkedQueue &) = delete;
+
+    /**
+     * Offer an element to the queue from any thread.
+     *
+     * @param element to be moved into the queue.
+     */
+    inline void offer(E &&element)
+    {
+        Node *node = new Node(std::move(element));
+        Node *previousTail = m_tail.exchange(node, std::memory_order_acq_rel);
+        previousTail->m_next.store(node, std::memory_order_release);
+    }
+
+    /**
+     * Drain up to limit elements from the queue in order. Only to be called from the single consumer thread.
+     *
+     * @param func  called for each element drained.
+     * @param limit on the number of elements to drain.
+     * @return the number of elements drained.
+     */
+    template<typename F>
+    inline std::size_t drain(F &&func, std::size_t limit)
+    {
+        std::size_t count = 0;
+
+        while (count < limit)
+        {
+            Node *head = m_head;
+            Node *next = head->m_next.load(std::memory_order_acquire);
+            if (nullptr == next)
+            {
+                break;
+            }
+
+            E element(std::move(next->m_element));
+            m_head = next;
+            delete head;
+            count++;
+            func(element);
+        }
+
+        return count;
+    }
+
+    /**
+     * Drain the elements which have been offered up to the time of the call. Only to be called from the single
+     * consumer thread.
+     *
+     * @param func called for each element drained.
+     * @return the number of elements drained.
+     */
+    template<typename F>
+    inline std::size_t drainAll(F &&func)
+    {
+        const Node *lastNode = m_tail.load(std::memory_order_acquire);
+        std::size_t count = 0;
+
+        while (m_head != lastNode)
+        {
+            if (0 == drain(func, 1))
+            {
+                break;
+            }
+
+            count++;
+        }
+
+        return count;
+    }
+
+    inline bool isEmpty() const
+    {
+        return nullptr == m_head->m_next.load(std::memory_order_acquire);
+    }
+
+private:
+    struct Node
+    {
+        Node() = default;
+
+        explicit Node(E &&element) : m_element(std::move(element))
+        {
+        }
+
+        std::atomic<Node *> m_next = { nullptr };
+        E m_element;
+    };
+
+    char m_tailPadding[util::BitUtil::CACHE_LINE_LENGTH] = {};
+    std::atomic<Node *> m_tail = { nullptr };
+    char m_producerPadding[util::BitUtil::CACHE_LINE_LENGTH] = {};
+    Node *m_head;
+    char m_consumerPadding[util::BitUtil::CACHE_LINE_LENGTH] = {};
+};
+
+}}
+
+#endif
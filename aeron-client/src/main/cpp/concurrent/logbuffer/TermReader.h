@@ -17,6 +17,7 @@
 #ifndef AERON_CONCURRENT_LOGBUFFER_TERM_READER_H
 #define AERON_CONCURRENT_LOGBUFFER_TERM_READER_H
 
+#include <array>
 #include <functional>
 
 #include "concurrent/logbuffer/LogBufferDescriptor.h"
@@ -41,6 +42,39 @@ typedef std::function<void(
     util::index_t length,
     Header &header)> fragment_handler_t;
 
+/**
+ * Maximum number of fragments delivered in a single call to a batch_fragment_handler_t.
+ */
+static constexpr int FRAGMENT_BATCH_MAX_LENGTH = 64;
+
+/**
+ * Location of a fragment within the buffer passed to a batch_fragment_handler_t.
+ */
+struct FragmentDescriptor
+{
+    /// Offset in the buffer at which the fragment data begins.
+    util::index_t offset;
+    /// Length of the fragment data in bytes.
+    util::index_t length;
+    /// Header representing the meta data for the fragment.
+    Header *header;
+};
+
+/**
+ * Callback for handling a batch of fragments being read from a log, in order, with a single call. This avoids a
+ * call per fragment when fragments are small.
+ *
+ * The descriptors and headers are only valid for the duration of the callback.
+ *
+ * @param buffer        containing the fragments.
+ * @param fragments     describing where each fragment is within the buffer.
+ * @param fragmentCount number of fragments, at most FRAGMENT_BATCH_MAX_LENGTH.
+ */
+typedef std::function<void(
+    concurrent::AtomicBuffer &buffer,
+    const FragmentDescriptor *fragments,
+    int fragmentCount)> batch_fragment_handler_t;
+
 
 namespace TermReader {
 
@@ -97,6 +131,72 @@ inline void read(
     outcome.offset = termOffset;
 }
 
+/**
+ * Read fragments as read() does but deliver them to the handler in batches of up to FRAGMENT_BATCH_MAX_LENGTH.
+ * The headers must have room for FRAGMENT_BATCH_MAX_LENGTH entries which are reused for each batch.
+ */
+template <typename F>
+inline void readBatch(
+    ReadOutcome &outcome,
+    AtomicBuffer &termBuffer,
+    std::int32_t termOffset,
+    F &&handler,
+    int fragmentsLimit,
+    Header *headers,
+    const util::exception_handler_t &exceptionHandler)
+{
+    std::array<FragmentDescriptor, FRAGMENT_BATCH_MAX_LENGTH> fragments;
+    int batchLength = 0;
+    outcome.fragmentsRead = 0;
+    outcome.offset = termOffset;
+    const util::index_t capacity = termBuffer.capacity();
+
+    try
+    {
+        while (outcome.fragmentsRead < fragmentsLimit && termOffset < capacity)
+        {
+            const std::int32_t frameLength = FrameDescriptor::frameLengthVolatile(termBuffer, termOffset);
+            if (frameLength <= 0)
+            {
+                break;
+            }
+
+            const std::int32_t fragmentOffset = termOffset;
+            termOffset += util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+
+            if (!FrameDescriptor::isPaddingFrame(termBuffer, fragmentOffset))
+            {
+                Header &header = headers[batchLength];
+                header.buffer(termBuffer);
+                header.offset(fragmentOffset);
+
+                FragmentDescriptor &fragment = fragments[batchLength];
+                fragment.offset = fragmentOffset + DataFrameHeader::LENGTH;
+                fragment.length = frameLength - DataFrameHeader::LENGTH;
+                fragment.header = &header;
+
+                ++outcome.fragmentsRead;
+                if (++batchLength == FRAGMENT_BATCH_MAX_LENGTH)
+                {
+                    handler(termBuffer, fragments.data(), batchLength);
+                    batchLength = 0;
+                }
+            }
+        }
+
+        if (batchLength > 0)
+        {
+            handler(termBuffer, fragments.data(), batchLength);
+        }
+    }
+    catch (const std::exception &ex)
+    {
+        exceptionHandler(ex);
+    }
+
+    outcome.offset = termOffset;
+}
+
 }
 
 }}}
@@ -17,6 +17,7 @@
 #ifndef INCLUDED_AERON_H
 #define INCLUDED_AERON_H
 
+#include <functional>
 #include <unordered_map>
 #include <mutex>
 
@@ -42,6 +43,7 @@ using namespace aeron::concurrent;
 using AsyncAddPublication = aeron_async_add_publication_t;
 using AsyncAddExclusivePublication = aeron_async_add_exclusive_publication_t;
 using AsyncAddCounter = aeron_async_add_counter_t;
+using AsyncBatch = aeron_async_batch_t;
 
 /**
  * @example BasicPublisher.cpp
@@ -79,6 +81,8 @@ public:
 
     ~Aeron()
     {
+        m_batchCloses.clear();
+
         aeron_on_close_client_pair_t closePair = {emptyCallback, nullptr};
         aeron_add_close_handler(m_aeron, &closePair);
         aeron_close(m_aeron);
@@ -658,6 +662,461 @@ public:
         }
     }
 
+    /**
+     * Create a batch of add and close commands which is sent to the media driver as a single command when submitted.
+     * This is cheaper than adding or closing each {@link Publication}, {@link Subscription}, or {@link Counter} on its
+     * own when many are created or closed at once, e.g. on start up or shutdown.
+     *
+     * The registration ids returned when adding to the batch are resolved with the usual find methods once the
+     * batch has been submitted with Aeron::submitBatch.
+     *
+     * @return id of the batch to add commands to.
+     */
+    inline std::int64_t createBatch()
+    {
+        AsyncBatch *batch = createBatchAsync();
+        std::int64_t batchId = aeron_next_correlation_id(m_aeron);
+
+        std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+        m_pendingBatches[batchId] = batch;
+
+        return batchId;
+    }
+
+    /**
+     * Add a {@link Publication} to a batch.
+     *
+     * @param batchId  returned by Aeron::createBatch.
+     * @param channel  for sending the messages known to the media layer.
+     * @param streamId within the channel scope.
+     * @return registration id for the publication
+     */
+    inline std::int64_t addPublication(std::int64_t batchId, const std::string &channel, std::int32_t streamId)
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+
+        AsyncAddPublication *addPublication = addPublicationAsync(findPendingBatch(batchId), channel, streamId);
+        std::int64_t registrationId = aeron_async_add_publication_get_registration_id(addPublication);
+        m_pendingPublications[registrationId] = addPublication;
+
+        return registrationId;
+    }
+
+    /**
+     * Add an {@link ExclusivePublication} to a batch.
+     *
+     * @param batchId  returned by Aeron::createBatch.
+     * @param channel  for sending the messages known to the media layer.
+     * @param streamId within the channel scope.
+     * @return registration id for the publication
+     */
+    inline std::int64_t addExclusivePublication(
+        std::int64_t batchId, const std::string &channel, std::int32_t streamId)
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+
+        AsyncAddExclusivePublication *addExclusivePublication = addExclusivePublicationAsync(
+            findPendingBatch(batchId), channel, streamId);
+        std::int64_t registrationId = aeron_async_add_exclusive_exclusive_publication_get_registration_id(
+            addExclusivePublication);
+        m_pendingExclusivePublications[registrationId] = addExclusivePublication;
+
+        return registrationId;
+    }
+
+    /**
+     * Add a {@link Subscription} to a batch using the default image handlers from the {@link Context}.
+     *
+     * @param batchId  returned by Aeron::createBatch.
+     * @param channel  for receiving the messages known to the media layer.
+     * @param streamId within the channel scope.
+     * @return registration id for the subscription
+     */
+    inline std::int64_t addSubscription(std::int64_t batchId, const std::string &channel, std::int32_t streamId)
+    {
+        return addSubscription(
+            batchId, channel, streamId, m_context.m_onAvailableImageHandler, m_context.m_onUnavailableImageHandler);
+    }
+
+    /**
+     * Add a {@link Subscription} to a batch.
+     *
+     * @param batchId                 returned by Aeron::createBatch.
+     * @param channel                 for receiving the messages known to the media layer.
+     * @param streamId                within the channel scope.
+     * @param availableImageHandler   called when {@link Image}s become available for consumption.
+     * @param unavailableImageHandler called when {@link Image}s go unavailable for consumption.
+     * @return registration id for the subscription
+     */
+    inline std::int64_t addSubscription(
+        std::int64_t batchId,
+        const std::string &channel,
+        std::int32_t streamId,
+        const on_available_image_t &onAvailableImageHandler,
+        const on_unavailable_image_t &onUnavailableImageHandler)
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+
+        AsyncAddSubscription *addSubscription = addSubscriptionAsync(
+            findPendingBatch(batchId), channel, streamId, onAvailableImageHandler, onUnavailableImageHandler);
+        std::int64_t registrationId = aeron_async_add_subscription_get_registration_id(addSubscription->m_async);
+        m_pendingSubscriptions[registrationId] = addSubscription;
+
+        return registrationId;
+    }
+
+    /**
+     * Add a {@link Counter} to a batch.
+     *
+     * @param batchId   returned by Aeron::createBatch.
+     * @param typeId    for the counter.
+     * @param keyBuffer containing the optional key for the counter.
+     * @param keyLength of the key in the keyBuffer.
+     * @param label     for the counter.
+     * @return registration id for the Counter
+     */
+    inline std::int64_t addCounter(
+        std::int64_t batchId,
+        std::int32_t typeId,
+        const std::uint8_t *keyBuffer,
+        std::size_t keyLength,
+        const std::string &label)
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+
+        AsyncAddCounter *addCounter = addCounterAsync(findPendingBatch(batchId), typeId, keyBuffer, keyLength, label);
+        std::int64_t registrationId = aeron_async_add_counter_get_registration_id(addCounter);
+        m_pendingCounters[registrationId] = addCounter;
+
+        return registrationId;
+    }
+
+    /**
+     * Add the close of a {@link Publication} to a batch. The publication stays open until the batch is submitted,
+     * after which it is closed and must no longer be used through any reference to it.
+     *
+     * @param batchId     returned by Aeron::createBatch.
+     * @param publication to close.
+     */
+    inline void close(std::int64_t batchId, const std::shared_ptr<Publication> &publication)
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+        closeAsync(findPendingBatch(batchId), publication);
+    }
+
+    /**
+     * Add the close of an {@link ExclusivePublication} to a batch. The publication stays open until the batch is
+     * submitted, after which it is closed and must no longer be used through any reference to it.
+     *
+     * @param batchId     returned by Aeron::createBatch.
+     * @param publication to close.
+     */
+    inline void close(std::int64_t batchId, const std::shared_ptr<ExclusivePublication> &publication)
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+        closeAsync(findPendingBatch(batchId), publication);
+    }
+
+    /**
+     * Add the close of a {@link Subscription} to a batch. The subscription stays open until the batch is submitted,
+     * after which it is closed and must no longer be used through any reference to it.
+     *
+     * @param batchId      returned by Aeron::createBatch.
+     * @param subscription to close.
+     */
+    inline void close(std::int64_t batchId, const std::shared_ptr<Subscription> &subscription)
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+        closeAsync(findPendingBatch(batchId), subscription);
+    }
+
+    /**
+     * Add the close of a {@link Counter} to a batch. The counter stays open until the batch is submitted, after
+     * which it is closed and must no longer be used through any reference to it.
+     *
+     * @param batchId returned by Aeron::createBatch.
+     * @param counter to close.
+     */
+    inline void close(std::int64_t batchId, const std::shared_ptr<Counter> &counter)
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+        closeAsync(findPendingBatch(batchId), counter);
+    }
+
+    /**
+     * Submit a batch to the media driver as a single command. No further commands can be added to it.
+     *
+     * @param batchId returned by Aeron::createBatch.
+     */
+    inline void submitBatch(std::int64_t batchId)
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+        submitBatch(findPendingBatch(batchId));
+    }
+
+    /**
+     * Check if the media driver has processed every command in a submitted batch.
+     *
+     * This method is non-blocking and will throw if any command in the batch failed, in which case the failed
+     * resources also throw when found.
+     *
+     * @param batchId returned by Aeron::createBatch.
+     * @return true if the batch is complete, otherwise false.
+     */
+    inline bool findBatchResponse(std::int64_t batchId)
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+
+        AsyncBatch *batch = findPendingBatch(batchId);
+        int result = aeron_async_batch_poll(batch);
+        if (0 != result)
+        {
+            m_pendingBatches.erase(batchId);
+        }
+
+        if (result < 0)
+        {
+            AERON_MAP_ERRNO_TO_SOURCED_EXCEPTION_AND_THROW;
+        }
+
+        return result > 0;
+    }
+
+    /**
+     * Create a batch of add commands which is sent to the media driver as a single command when submitted.
+     *
+     * The batch must be submitted with Aeron::submitBatch and then checked with Aeron::findBatchResponse until
+     * complete. The async objects returned when adding to the batch are resolved with the usual find methods.
+     *
+     * @return AsyncBatch to add commands to.
+     */
+    inline AsyncBatch *createBatchAsync()
+    {
+        aeron_async_batch_t *batch;
+        if (aeron_async_batch_create(&batch, m_aeron) < 0)
+        {
+            AERON_MAP_ERRNO_TO_SOURCED_EXCEPTION_AND_THROW;
+        }
+
+        return batch;
+    }
+
+    /**
+     * Add a {@link Publication} to a batch.
+     *
+     * @param batch    to add the publication to.
+     * @param channel  for sending the messages known to the media layer.
+     * @param streamId within the channel scope.
+     * @return AsyncAddPublication for the publication to be resolved with Aeron::findPublication.
+     */
+    inline AsyncAddPublication *addPublicationAsync(
+        AsyncBatch *batch, const std::string &channel, std::int32_t streamId)
+    {
+        aeron_async_add_publication_t *addPublication;
+        if (aeron_async_batch_add_publication(&addPublication, batch, channel.c_str(), streamId) < 0)
+        {
+            AERON_MAP_ERRNO_TO_SOURCED_EXCEPTION_AND_THROW;
+        }
+
+        return addPublication;
+    }
+
+    /**
+     * Add an {@link ExclusivePublication} to a batch.
+     *
+     * @param batch    to add the publication to.
+     * @param channel  for sending the messages known to the media layer.
+     * @param streamId within the channel scope.
+     * @return AsyncAddExclusivePublication for the publication to be resolved with Aeron::findExclusivePublication.
+     */
+    inline AsyncAddExclusivePublication *addExclusivePublicationAsync(
+        AsyncBatch *batch, const std::string &channel, std::int32_t streamId)
+    {
+        aeron_async_add_exclusive_publication_t *addExclusivePublication;
+        if (aeron_async_batch_add_exclusive_publication(
+            &addExclusivePublication, batch, channel.c_str(), streamId) < 0)
+        {
+            AERON_MAP_ERRNO_TO_SOURCED_EXCEPTION_AND_THROW;
+        }
+
+        return addExclusivePublication;
+    }
+
+    /**
+     * Add a {@link Subscription} to a batch.
+     *
+     * @param batch                   to add the subscription to.
+     * @param channel                 for receiving the messages known to the media layer.
+     * @param streamId                within the channel scope.
+     * @param availableImageHandler   called when {@link Image}s become available for consumption.
+     * @param unavailableImageHandler called when {@link Image}s go unavailable for consumption.
+     * @return AsyncAddSubscription for the subscription to be resolved with Aeron::findSubscription.
+     */
+    inline AsyncAddSubscription *addSubscriptionAsync(
+        AsyncBatch *batch,
+        const std::string &channel,
+        std::int32_t streamId,
+        const on_available_image_t &onAvailableImageHandler,
+        const on_unavailable_image_t &onUnavailableImageHandler)
+    {
+        auto *addSubscription = new AsyncAddSubscription(onAvailableImageHandler, onUnavailableImageHandler);
+        void *availableClientd =
+            const_cast<void *>(reinterpret_cast<const void *>(&addSubscription->m_onAvailableImage));
+        void *unavailableClientd =
+            const_cast<void *>(reinterpret_cast<const void *>(&addSubscription->m_onUnavailableImage));
+
+        if (aeron_async_batch_add_subscription(
+            &addSubscription->m_async,
+            batch,
+            channel.c_str(),
+            streamId,
+            onAvailableImageCallback,
+            availableClientd,
+            onUnavailableImageCallback,
+            unavailableClientd) < 0)
+        {
+            delete addSubscription;
+            AERON_MAP_ERRNO_TO_SOURCED_EXCEPTION_AND_THROW;
+        }
+
+        return addSubscription;
+    }
+
+    /**
+     * Add a {@link Subscription} to a batch using the default image handlers from the {@link Context}.
+     *
+     * @param batch    to add the subscription to.
+     * @param channel  for receiving the messages known to the media layer.
+     * @param streamId within the channel scope.
+     * @return AsyncAddSubscription for the subscription to be resolved with Aeron::findSubscription.
+     */
+    inline AsyncAddSubscription *addSubscriptionAsync(
+        AsyncBatch *batch, const std::string &channel, std::int32_t streamId)
+    {
+        return addSubscriptionAsync(
+            batch, channel, streamId, m_context.m_onAvailableImageHandler, m_context.m_onUnavailableImageHandler);
+    }
+
+    /**
+     * Add a {@link Counter} to a batch.
+     *
+     * @param batch     to add the counter to.
+     * @param typeId    for the counter.
+     * @param keyBuffer containing the optional key for the counter.
+     * @param keyLength of the key in the keyBuffer.
+     * @param label     for the counter.
+     * @return AsyncAddCounter for the counter to be resolved with Aeron::findCounter.
+     */
+    inline AsyncAddCounter *addCounterAsync(
+        AsyncBatch *batch,
+        std::int32_t typeId,
+        const std::uint8_t *keyBuffer,
+        std::size_t keyLength,
+        const std::string &label)
+    {
+        aeron_async_add_counter_t *addCounter;
+        if (aeron_async_batch_add_counter(
+            &addCounter, batch, typeId, keyBuffer, keyLength, label.c_str(), label.length()) < 0)
+        {
+            AERON_MAP_ERRNO_TO_SOURCED_EXCEPTION_AND_THROW;
+        }
+
+        return addCounter;
+    }
+
+    /**
+     * Add the close of a {@link Publication} to a batch. The publication stays open until the batch is submitted,
+     * after which it is closed and must no longer be used through any reference to it.
+     *
+     * @param batch       to add the close to.
+     * @param publication to close.
+     */
+    inline void closeAsync(AsyncBatch *batch, const std::shared_ptr<Publication> &publication)
+    {
+        addCloseToBatch(batch, publication);
+    }
+
+    /**
+     * Add the close of an {@link ExclusivePublication} to a batch. The publication stays open until the batch is
+     * submitted, after which it is closed and must no longer be used through any reference to it.
+     *
+     * @param batch       to add the close to.
+     * @param publication to close.
+     */
+    inline void closeAsync(AsyncBatch *batch, const std::shared_ptr<ExclusivePublication> &publication)
+    {
+        addCloseToBatch(batch, publication);
+    }
+
+    /**
+     * Add the close of a {@link Subscription} to a batch. The subscription stays open until the batch is submitted,
+     * after which it is closed and must no longer be used through any reference to it.
+     *
+     * @param batch        to add the close to.
+     * @param subscription to close.
+     */
+    inline void closeAsync(AsyncBatch *batch, const std::shared_ptr<Subscription> &subscription)
+    {
+        addCloseToBatch(batch, subscription);
+    }
+
+    /**
+     * Add the close of a {@link Counter} to a batch. The counter stays open until the batch is submitted, after
+     * which it is closed and must no longer be used through any reference to it.
+     *
+     * @param batch   to add the close to.
+     * @param counter to close.
+     */
+    inline void closeAsync(AsyncBatch *batch, const std::shared_ptr<Counter> &counter)
+    {
+        addCloseToBatch(batch, counter);
+    }
+
+    /**
+     * Submit a batch to the media driver as a single command.
+     *
+     * @param batch to submit.
+     */
+    inline void submitBatch(AsyncBatch *batch)
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+
+        if (aeron_async_batch_submit(batch) < 0)
+        {
+            AERON_MAP_ERRNO_TO_SOURCED_EXCEPTION_AND_THROW;
+        }
+
+        auto search = m_batchCloses.find(batch);
+        if (search != m_batchCloses.end())
+        {
+            for (auto &closedInBatch : search->second)
+            {
+                closedInBatch();
+            }
+
+            m_batchCloses.erase(search);
+        }
+    }
+
+    /**
+     * Check if a submitted batch has been completed by the media driver. The batch is freed once complete.
+     *
+     * This method is non-blocking and will throw if the batch failed or any command in it failed.
+     *
+     * @param batch to check for completion.
+     * @return true if the batch is complete, otherwise false.
+     */
+    inline bool findBatchResponse(AsyncBatch *batch)
+    {
+        int result = aeron_async_batch_poll(batch);
+        if (result < 0)
+        {
+            AERON_MAP_ERRNO_TO_SOURCED_EXCEPTION_AND_THROW;
+        }
+
+        return result > 0;
+    }
+
     /**
      * Add a handler to the list to be called when a counter becomes available.
      *
@@ -933,6 +1392,8 @@ private:
     std::unordered_map<std::int64_t, AsyncAddExclusivePublication *> m_pendingExclusivePublications;
     std::unordered_map<std::int64_t, AsyncAddSubscription *> m_pendingSubscriptions;
     std::unordered_map<std::int64_t, AsyncAddCounter *> m_pendingCounters;
+    std::unordered_map<std::int64_t, AsyncBatch *> m_pendingBatches;
+    std::unordered_map<AsyncBatch *, std::vector<std::function<void()>>> m_batchCloses;
     std::vector<std::pair<std::int64_t, std::shared_ptr<on_available_counter_t>>> m_availableCounterHandlers;
     std::vector<std::pair<std::int64_t, std::shared_ptr<on_unavailable_counter_t>>> m_unavailableCounterHandlers;
     std::vector<std::pair<std::int64_t, std::shared_ptr<on_close_client_t>>> m_closeClientHandlers;
@@ -940,6 +1401,30 @@ private:
     ClientConductor m_clientConductor;
     AgentInvoker<ClientConductor> m_conductorInvoker;
 
+    /*
+     * The C resource is freed once the batch is submitted, so the wrapper is kept alive until then and its
+     * reference to the C resource dropped on submission so it is not closed a second time on destruction.
+     */
+    template<typename T>
+    inline void addCloseToBatch(AsyncBatch *batch, const std::shared_ptr<T> &resource)
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+
+        resource->addCloseToBatch(batch);
+        m_batchCloses[batch].push_back([resource]() { resource->closedInBatch(); });
+    }
+
+    inline AsyncBatch *findPendingBatch(std::int64_t batchId)
+    {
+        auto search = m_pendingBatches.find(batchId);
+        if (search == m_pendingBatches.end())
+        {
+            throw IllegalArgumentException("Unknown batch id", SOURCEINFO);
+        }
+
+        return search->second;
+    }
+
     static aeron_t *init_aeron(Context &context)
     {
         aeron_t *aeron;
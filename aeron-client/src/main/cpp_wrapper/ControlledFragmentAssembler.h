@@ -17,6 +17,7 @@
 #define AERON_CONTROLLEDFRAGMENTASSEMBLER_H
 
 #include <unordered_map>
+#include <utility>
 
 #include "Aeron.h"
 
@@ -37,8 +38,15 @@ static constexpr std::size_t DEFAULT_CONTROLLED_FRAGMENT_ASSEMBLY_BUFFER_LENGTH
  * Session based buffers will be allocated and grown as necessary based on the length of messages to be assembled.
  * When sessions go inactive see {@link on_unavailable_image_t}, it is possible to free the buffer by calling
  * {@link #deleteSessionBuffer(std::int32_t)}.
+ * <p>
+ * The delegate type is statically known, so passing the assembler itself to Subscription::controlledPoll or
+ * Image::controlledPoll, rather than a controlled_poll_fragment_handler_t, calls the delegate directly from the
+ * assembler callback.
+ *
+ * @tparam H type of the delegate, callable as a controlled_poll_fragment_handler_t.
  */
-class ControlledFragmentAssembler
+template<typename H>
+class TypedControlledFragmentAssembler
 {
 public:
     /**
@@ -47,31 +55,53 @@ public:
      * @param delegate            onto which whole messages are forwarded.
      * @param initialBufferLength to be used for each session.
      */
-    explicit ControlledFragmentAssembler(
-        const controlled_poll_fragment_handler_t &delegate,
-        std::size_t initialBufferLength = DEFAULT_CONTROLLED_FRAGMENT_ASSEMBLY_BUFFER_LENGTH) :
-        m_delegate(delegate)
+    explicit TypedControlledFragmentAssembler(
+        H delegate, std::size_t initialBufferLength = DEFAULT_CONTROLLED_FRAGMENT_ASSEMBLY_BUFFER_LENGTH) :
+        m_delegate(std::move(delegate))
     {
         aeron_controlled_fragment_assembler_create(&m_fragment_assembler, handlerCallback, reinterpret_cast<void *>(this));
     }
 
-    ~ControlledFragmentAssembler()
+    ~TypedControlledFragmentAssembler()
     {
         aeron_controlled_fragment_assembler_delete(m_fragment_assembler);
     }
 
     /**
-     * Compose a controlled_poll_fragment_handler_t that calls the this ControlledFragmentAssembler instance for
-     * reassembly. Suitable for passing to Subscription::controlledPoll(controlled_poll_fragment_handler_t, int).
+     * Reassemble a fragment, forwarding it to the delegate once a whole message is available.
      *
-     * @return controlled_poll_fragment_handler_t composed with the ControlledFragmentAssembler instance
+     * @param buffer containing the data.
+     * @param offset at which the data begins.
+     * @param length of the data in bytes.
+     * @param header representing the meta data for the data.
+     * @return The action to be taken with regard to the stream position after the callback.
      */
-    controlled_poll_fragment_handler_t handler()
+    inline ControlledPollAction operator()(
+        AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
     {
-        return [this](AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+        aeron_controlled_fragment_handler_action_t action = aeron_controlled_fragment_assembler_handler(
+            m_fragment_assembler,
+            buffer.buffer() + offset,
+            length,
+            header.hdr());
+
+        switch (action)
         {
-            return this->onFragment(buffer, offset, length, header);
-        };
+            case AERON_ACTION_ABORT:
+                return ControlledPollAction::ABORT;
+                break;
+            case AERON_ACTION_BREAK:
+                return ControlledPollAction::BREAK;
+                break;
+            case AERON_ACTION_COMMIT:
+                return ControlledPollAction::COMMIT;
+                break;
+            case AERON_ACTION_CONTINUE:
+                return ControlledPollAction::CONTINUE;
+                break;
+        }
+
+        throw IllegalArgumentException("unknown action", SOURCEINFO);
     }
 
     /**
@@ -85,12 +115,12 @@ public:
     }
 
 private:
-    controlled_poll_fragment_handler_t m_delegate;
+    H m_delegate;
     aeron_controlled_fragment_assembler_t *m_fragment_assembler;
 
     static aeron_controlled_fragment_handler_action_t handlerCallback(void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
     {
-        auto *assembler = reinterpret_cast<ControlledFragmentAssembler *>(clientd);
+        auto *assembler = reinterpret_cast<TypedControlledFragmentAssembler<H> *>(clientd);
         Header headerWrapper{header};
         AtomicBuffer bufferWrapper{const_cast<uint8_t *>(buffer), length};
         ControlledPollAction action = assembler->m_delegate(bufferWrapper, 0, (util::index_t)length, headerWrapper);
@@ -113,32 +143,39 @@ private:
 
         throw IllegalArgumentException("unknown action", SOURCEINFO);
     }
+};
 
-    ControlledPollAction onFragment(AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+/**
+ * A TypedControlledFragmentAssembler over a controlled_poll_fragment_handler_t.
+ */
+class ControlledFragmentAssembler : public TypedControlledFragmentAssembler<controlled_poll_fragment_handler_t>
+{
+public:
+    /**
+     * Construct an adapter to reassembly message fragments and delegate on only whole messages.
+     *
+     * @param delegate            onto which whole messages are forwarded.
+     * @param initialBufferLength to be used for each session.
+     */
+    explicit ControlledFragmentAssembler(
+        const controlled_poll_fragment_handler_t &delegate,
+        std::size_t initialBufferLength = DEFAULT_CONTROLLED_FRAGMENT_ASSEMBLY_BUFFER_LENGTH) :
+        TypedControlledFragmentAssembler<controlled_poll_fragment_handler_t>(delegate, initialBufferLength)
     {
-        aeron_controlled_fragment_handler_action_t action = aeron_controlled_fragment_assembler_handler(
-            m_fragment_assembler,
-            buffer.buffer() + offset,
-            length,
-            header.hdr());
+    }
 
-        switch (action)
+    /**
+     * Compose a controlled_poll_fragment_handler_t that calls the this ControlledFragmentAssembler instance for
+     * reassembly. Suitable for passing to Subscription::controlledPoll(controlled_poll_fragment_handler_t, int).
+     *
+     * @return controlled_poll_fragment_handler_t composed with the ControlledFragmentAssembler instance
+     */
+    controlled_poll_fragment_handler_t handler()
+    {
+        return [this](AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
         {
-            case AERON_ACTION_ABORT:
-                return ControlledPollAction::ABORT;
-                break;
-            case AERON_ACTION_BREAK:
-                return ControlledPollAction::BREAK;
-                break;
-            case AERON_ACTION_COMMIT:
-                return ControlledPollAction::COMMIT;
-                break;
-            case AERON_ACTION_CONTINUE:
-                return ControlledPollAction::CONTINUE;
-                break;
-        }
-
-        throw IllegalArgumentException("unknown action", SOURCEINFO);
+            return (*this)(buffer, offset, length, header);
+        };
     }
 };
 
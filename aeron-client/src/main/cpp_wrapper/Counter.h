@@ -66,12 +66,29 @@ public:
 
     bool isClosed() const
     {
-        return aeron_counter_is_closed(counter());
+        return m_isClosedInBatch || aeron_counter_is_closed(counter());
     }
 
+    /// @cond HIDDEN_SYMBOLS
+    inline void addCloseToBatch(aeron_async_batch_t *batch)
+    {
+        if (aeron_async_batch_close_counter(batch, counter(), nullptr, nullptr) < 0)
+        {
+            AERON_MAP_ERRNO_TO_SOURCED_EXCEPTION_AND_THROW;
+        }
+    }
+
+    inline void closedInBatch()
+    {
+        releaseCounter();
+        m_isClosedInBatch = true;
+    }
+    /// @endcond
+
 private:
     CountersReader &m_reader;
     std::int64_t m_registrationId;
+    bool m_isClosedInBatch = false;
 };
 
 }
@@ -651,6 +651,19 @@ public:
     {
         aeron_exclusive_publication_close(m_publication, nullptr, nullptr);
     }
+
+    inline void addCloseToBatch(aeron_async_batch_t *batch)
+    {
+        if (aeron_async_batch_close_exclusive_publication(batch, m_publication, nullptr, nullptr) < 0)
+        {
+            AERON_MAP_ERRNO_TO_SOURCED_EXCEPTION_AND_THROW;
+        }
+    }
+
+    inline void closedInBatch()
+    {
+        m_publication = nullptr;
+    }
     /// @endcond
 
 private:
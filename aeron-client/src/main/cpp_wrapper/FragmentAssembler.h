@@ -18,6 +18,7 @@
 #define AERON_FRAGMENT_ASSEMBLER_H
 
 #include <unordered_map>
+#include <utility>
 
 #include "Aeron.h"
 
@@ -38,8 +39,14 @@ static constexpr std::size_t DEFAULT_FRAGMENT_ASSEMBLY_BUFFER_LENGTH = 4096;
  * Session based buffers will be allocated and grown as necessary based on the length of messages to be assembled.
  * When sessions go inactive see {@link on_unavailable_image_t}, it is possible to free the buffer by calling
  * {@link #deleteSessionBuffer(std::int32_t)}.
+ * <p>
+ * The delegate type is statically known, so passing the assembler itself to Subscription::poll or Image::poll,
+ * rather than a fragment_handler_t, calls the delegate directly from the assembler callback.
+ *
+ * @tparam H type of the delegate, callable as a fragment_handler_t.
  */
-class FragmentAssembler
+template<typename H>
+class TypedFragmentAssembler
 {
 public:
 
@@ -49,30 +56,29 @@ public:
      * @param delegate            onto which whole messages are forwarded.
      * @param initialBufferLength to be used for each session.
      */
-    explicit FragmentAssembler(
-        const fragment_handler_t &delegate, std::size_t initialBufferLength = DEFAULT_FRAGMENT_ASSEMBLY_BUFFER_LENGTH) :
-        m_delegate(delegate)
+    explicit TypedFragmentAssembler(
+        H delegate, std::size_t initialBufferLength = DEFAULT_FRAGMENT_ASSEMBLY_BUFFER_LENGTH) :
+        m_delegate(std::move(delegate))
     {
         aeron_fragment_assembler_create(&m_fragment_assembler, handlerCallback, reinterpret_cast<void *>(this));
     }
 
-    ~FragmentAssembler()
+    ~TypedFragmentAssembler()
     {
         aeron_fragment_assembler_delete(m_fragment_assembler);
     }
 
     /**
-     * Compose a fragment_handler_t that calls the this FragmentAssembler instance for reassembly. Suitable for
-     * passing to Subscription::poll(fragment_handler_t, int).
+     * Reassemble a fragment, forwarding it to the delegate once a whole message is available.
      *
-     * @return fragment_handler_t composed with the FragmentAssembler instance
+     * @param buffer containing the data.
+     * @param offset at which the data begins.
+     * @param length of the data in bytes.
+     * @param header representing the meta data for the data.
      */
-    fragment_handler_t handler()
+    inline void operator()(AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
     {
-        return [this](AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
-        {
-            this->onFragment(buffer, offset, length, header);
-        };
+        aeron_fragment_assembler_handler(m_fragment_assembler, buffer.buffer() + offset, length, header.hdr());
     }
 
     /**
@@ -88,19 +94,48 @@ public:
 
 private:
     aeron_fragment_assembler_t *m_fragment_assembler = nullptr;
-    fragment_handler_t m_delegate;
+    H m_delegate;
 
     static void handlerCallback(void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
     {
-        auto *assembler = reinterpret_cast<FragmentAssembler *>(clientd);
+        auto *assembler = reinterpret_cast<TypedFragmentAssembler<H> *>(clientd);
         Header headerWrapper{header};
         AtomicBuffer buffer1{const_cast<uint8_t *>(buffer), length};
         assembler->m_delegate(buffer1, 0, (util::index_t)length, headerWrapper);
     }
+};
+
+/**
+ * A TypedFragmentAssembler over a fragment_handler_t.
+ */
+class FragmentAssembler : public TypedFragmentAssembler<fragment_handler_t>
+{
+public:
+
+    /**
+     * Construct an adapter to reassembly message fragments and delegate on only whole messages.
+     *
+     * @param delegate            onto which whole messages are forwarded.
+     * @param initialBufferLength to be used for each session.
+     */
+    explicit FragmentAssembler(
+        const fragment_handler_t &delegate, std::size_t initialBufferLength = DEFAULT_FRAGMENT_ASSEMBLY_BUFFER_LENGTH) :
+        TypedFragmentAssembler<fragment_handler_t>(delegate, initialBufferLength)
+    {
+    }
 
-    inline void onFragment(AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+    /**
+     * Compose a fragment_handler_t that calls the this FragmentAssembler instance for reassembly. Suitable for
+     * passing to Subscription::poll(fragment_handler_t, int).
+     *
+     * @return fragment_handler_t composed with the FragmentAssembler instance
+     */
+    fragment_handler_t handler()
     {
-        aeron_fragment_assembler_handler(m_fragment_assembler, buffer.buffer() + offset, length, header.hdr());
+        return [this](AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+        {
+            (*this)(buffer, offset, length, header);
+        };
     }
 };
 
@@ -670,6 +670,21 @@ public:
         return findDestinationResponse(search->second);
     }
 
+    /// @cond HIDDEN_SYMBOLS
+    inline void addCloseToBatch(aeron_async_batch_t *batch)
+    {
+        if (aeron_async_batch_close_publication(batch, m_publication, nullptr, nullptr) < 0)
+        {
+            AERON_MAP_ERRNO_TO_SOURCED_EXCEPTION_AND_THROW;
+        }
+    }
+
+    inline void closedInBatch()
+    {
+        m_publication = nullptr;
+    }
+    /// @endcond
+
 private:
     aeron_t *m_aeron = nullptr;
     aeron_publication_t *m_publication = nullptr;
@@ -547,7 +547,7 @@ public:
      */
     inline bool isClosed() const
     {
-        return aeron_subscription_is_closed(m_subscription);
+        return nullptr == m_subscription || aeron_subscription_is_closed(m_subscription);
     }
 
     /**
@@ -577,6 +577,21 @@ public:
 
         return hasImage;
     }
+
+    inline void addCloseToBatch(aeron_async_batch_t *batch)
+    {
+        if (aeron_async_batch_close_subscription(
+            batch, m_subscription, AsyncAddSubscription::remove, m_addSubscription) < 0)
+        {
+            AERON_MAP_ERRNO_TO_SOURCED_EXCEPTION_AND_THROW;
+        }
+    }
+
+    inline void closedInBatch()
+    {
+        m_subscription = nullptr;
+        m_addSubscription = nullptr;
+    }
     /// @endcond
 
 private:
@@ -120,6 +120,11 @@ protected:
         return m_counter;
     }
 
+    void releaseCounter()
+    {
+        m_counter = nullptr;
+    }
+
 private:
     aeron_counter_t *m_counter = nullptr;
     std::int64_t *m_ptr = nullptr;
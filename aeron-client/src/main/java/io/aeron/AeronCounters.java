@@ -138,6 +138,16 @@ public final class AeronCounters
      */
     public static final int MDC_DESTINATIONS_COUNTER_TYPE_ID = 18;
 
+    /**
+     * The number of messages a sender currently gathers into each send when adaptive batching is enabled.
+     */
+    public static final int DRIVER_SENDER_BATCH_TYPE_ID = 19;
+
+    /**
+     * Count of times a sender held data back to keep a publication within its paced rate.
+     */
+    public static final int DRIVER_SENDER_PACING_DELAYS_TYPE_ID = 20;
+
     // Archive counters
     /**
      * The position a recording has reached when being archived.
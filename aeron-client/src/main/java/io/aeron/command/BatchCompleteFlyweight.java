@@ -0,0 +1,195 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package io.aeron.command;
+
+import io.aeron.ErrorCode;
+import org.agrona.MutableDirectBuffer;
+
+import static org.agrona.BitUtil.SIZE_OF_INT;
+import static org.agrona.BitUtil.SIZE_OF_LONG;
+
+/**
+ * Indicate a batch of commands has been processed, giving the result of each entry in the order of the batch.
+ * <p>
+ * An entry which was not processed, such as one following a malformed entry, has a {@link io.aeron.Aeron#NULL_VALUE}
+ * correlation id and a {@link ErrorCode#MALFORMED_COMMAND} error code.
+ *
+ * @see ControlProtocolEvents
+ * <pre>
+ *   0                   1                   2                   3
+ *   0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+ *  +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *  |                   Batch Correlation ID                        |
+ *  |                                                               |
+ *  +---------------------------------------------------------------+
+ *  |                         Result Count                          |
+ *  +---------------------------------------------------------------+
+ *  |                  Entry Correlation ID 0                       |
+ *  |                                                               |
+ *  +---------------------------------------------------------------+
+ *  |                       Error Code 0                            |
+ *  +---------------------------------------------------------------+
+ *  |                  Entry Correlation ID 1                      ...
+ * ...                                                              |
+ *  +---------------------------------------------------------------+
+ * </pre>
+ */
+public class BatchCompleteFlyweight
+{
+    /**
+     * Length of the header before the results.
+     */
+    public static final int HEADER_LENGTH = SIZE_OF_LONG + SIZE_OF_INT;
+
+    /**
+     * Length of each result.
+     */
+    public static final int RESULT_LENGTH = SIZE_OF_LONG + SIZE_OF_INT;
+
+    private static final int CORRELATION_ID_FIELD_OFFSET = 0;
+    private static final int RESULT_COUNT_FIELD_OFFSET = CORRELATION_ID_FIELD_OFFSET + SIZE_OF_LONG;
+    private static final int RESULT_CORRELATION_ID_OFFSET = 0;
+    private static final int RESULT_ERROR_CODE_OFFSET = RESULT_CORRELATION_ID_OFFSET + SIZE_OF_LONG;
+
+    private MutableDirectBuffer buffer;
+    private int offset;
+
+    /**
+     * Wrap the buffer at a given offset for updates.
+     *
+     * @param buffer to wrap.
+     * @param offset at which the message begins.
+     * @return this for a fluent API.
+     */
+    public final BatchCompleteFlyweight wrap(final MutableDirectBuffer buffer, final int offset)
+    {
+        this.buffer = buffer;
+        this.offset = offset;
+
+        return this;
+    }
+
+    /**
+     * The correlation id of the batch command.
+     *
+     * @return correlation id of the batch command.
+     */
+    public long correlationId()
+    {
+        return buffer.getLong(offset + CORRELATION_ID_FIELD_OFFSET);
+    }
+
+    /**
+     * Set the correlation id of the batch command.
+     *
+     * @param correlationId field value.
+     * @return this for a fluent API.
+     */
+    public BatchCompleteFlyweight correlationId(final long correlationId)
+    {
+        buffer.putLong(offset + CORRELATION_ID_FIELD_OFFSET, correlationId);
+
+        return this;
+    }
+
+    /**
+     * The number of results which follow the header.
+     *
+     * @return number of results which follow the header.
+     */
+    public int resultCount()
+    {
+        return buffer.getInt(offset + RESULT_COUNT_FIELD_OFFSET);
+    }
+
+    /**
+     * Set the number of results which follow the header.
+     *
+     * @param resultCount field value.
+     * @return this for a fluent API.
+     */
+    public BatchCompleteFlyweight resultCount(final int resultCount)
+    {
+        buffer.putInt(offset + RESULT_COUNT_FIELD_OFFSET, resultCount);
+
+        return this;
+    }
+
+    /**
+     * The correlation id of the entry for a given result.
+     *
+     * @param index of the result.
+     * @return correlation id of the entry for the result.
+     */
+    public long resultCorrelationId(final int index)
+    {
+        return buffer.getLong(resultOffset(index) + RESULT_CORRELATION_ID_OFFSET);
+    }
+
+    /**
+     * Set the correlation id of the entry for a given result.
+     *
+     * @param index         of the result.
+     * @param correlationId field value.
+     * @return this for a fluent API.
+     */
+    public BatchCompleteFlyweight resultCorrelationId(final int index, final long correlationId)
+    {
+        buffer.putLong(resultOffset(index) + RESULT_CORRELATION_ID_OFFSET, correlationId);
+
+        return this;
+    }
+
+    /**
+     * The error code value of a given result, {@link ErrorCode#UNUSED} if the entry succeeded.
+     *
+     * @param index of the result.
+     * @return error code value of the result.
+     */
+    public int resultErrorCodeValue(final int index)
+    {
+        return buffer.getInt(resultOffset(index) + RESULT_ERROR_CODE_OFFSET);
+    }
+
+    /**
+     * Set the error code of a given result.
+     *
+     * @param index     of the result.
+     * @param errorCode field value.
+     * @return this for a fluent API.
+     */
+    public BatchCompleteFlyweight resultErrorCode(final int index, final ErrorCode errorCode)
+    {
+        buffer.putInt(resultOffset(index) + RESULT_ERROR_CODE_OFFSET, errorCode.value());
+
+        return this;
+    }
+
+    /**
+     * Length of the message in bytes for the current result count.
+     *
+     * @return length of the message in bytes for the current result count.
+     */
+    public int length()
+    {
+        return HEADER_LENGTH + (resultCount() * RESULT_LENGTH);
+    }
+
+    private int resultOffset(final int index)
+    {
+        return offset + HEADER_LENGTH + (index * RESULT_LENGTH);
+    }
+}
@@ -0,0 +1,197 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package io.aeron.command;
+
+import io.aeron.exceptions.ControlProtocolException;
+import org.agrona.BitUtil;
+import org.agrona.MutableDirectBuffer;
+
+import static io.aeron.ErrorCode.MALFORMED_COMMAND;
+import static org.agrona.BitUtil.SIZE_OF_INT;
+import static org.agrona.BitUtil.SIZE_OF_LONG;
+
+/**
+ * Control message carrying a batch of add and remove commands for publications, subscriptions, and counters.
+ * <p>
+ * Each entry is an entry header of type id and length followed by the command exactly as it would be written on its
+ * own, with the entry padded to {@link #ENTRY_ALIGNMENT}. The driver responds to each entry as normal then sends a
+ * single {@link ControlProtocolEvents#ON_BATCH_COMPLETE} listing the result of every entry.
+ * <pre>
+ *   0                   1                   2                   3
+ *   0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+ *  +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *  |                          Client ID                            |
+ *  |                                                               |
+ *  +---------------------------------------------------------------+
+ *  |                    Command Correlation ID                     |
+ *  |                                                               |
+ *  +---------------------------------------------------------------+
+ *  |                         Entry Count                           |
+ *  +---------------------------------------------------------------+
+ *  |                        Entries Length                         |
+ *  +---------------------------------------------------------------+
+ *  |                         Entries                              ...
+ * ...                                                              |
+ *  +---------------------------------------------------------------+
+ * </pre>
+ * Each entry:
+ * <pre>
+ *   0                   1                   2                   3
+ *   0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+ *  +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *  |                        Command Type ID                        |
+ *  +---------------------------------------------------------------+
+ *  |                        Command Length                         |
+ *  +---------------------------------------------------------------+
+ *  |                      Command and Padding                     ...
+ * ...                                                              |
+ *  +---------------------------------------------------------------+
+ * </pre>
+ */
+public class BatchMessageFlyweight extends CorrelatedMessageFlyweight
+{
+    /**
+     * Length of the header of an entry which precedes the command.
+     */
+    public static final int ENTRY_HEADER_LENGTH = 2 * SIZE_OF_INT;
+
+    /**
+     * Alignment of each entry, including its header, within the entries.
+     */
+    public static final int ENTRY_ALIGNMENT = SIZE_OF_LONG;
+
+    /**
+     * Offset of the type id field within an entry.
+     */
+    public static final int ENTRY_TYPE_ID_OFFSET = 0;
+
+    /**
+     * Offset of the command length field within an entry.
+     */
+    public static final int ENTRY_LENGTH_OFFSET = ENTRY_TYPE_ID_OFFSET + SIZE_OF_INT;
+
+    /**
+     * Smallest aligned length an entry can occupy as each command is at least a {@link CorrelatedMessageFlyweight}.
+     */
+    public static final int MIN_ALIGNED_ENTRY_LENGTH =
+        BitUtil.align(ENTRY_HEADER_LENGTH + CorrelatedMessageFlyweight.LENGTH, ENTRY_ALIGNMENT);
+
+    private static final int ENTRY_COUNT_OFFSET = CORRELATION_ID_FIELD_OFFSET + SIZE_OF_LONG;
+    private static final int ENTRIES_LENGTH_OFFSET = ENTRY_COUNT_OFFSET + SIZE_OF_INT;
+    private static final int ENTRIES_OFFSET = ENTRIES_LENGTH_OFFSET + SIZE_OF_INT;
+
+    /**
+     * Wrap the buffer at a given offset for updates.
+     *
+     * @param buffer to wrap.
+     * @param offset at which the message begins.
+     * @return this for a fluent API.
+     */
+    public BatchMessageFlyweight wrap(final MutableDirectBuffer buffer, final int offset)
+    {
+        super.wrap(buffer, offset);
+
+        return this;
+    }
+
+    /**
+     * Get the number of entries in the batch.
+     *
+     * @return number of entries in the batch.
+     */
+    public int entryCount()
+    {
+        return buffer.getInt(offset + ENTRY_COUNT_OFFSET);
+    }
+
+    /**
+     * Set the number of entries in the batch.
+     *
+     * @param entryCount field value.
+     * @return this for a fluent API.
+     */
+    public BatchMessageFlyweight entryCount(final int entryCount)
+    {
+        buffer.putInt(offset + ENTRY_COUNT_OFFSET, entryCount);
+
+        return this;
+    }
+
+    /**
+     * Get the length in bytes of the entries which follow the header.
+     *
+     * @return length in bytes of the entries which follow the header.
+     */
+    public int entriesLength()
+    {
+        return buffer.getInt(offset + ENTRIES_LENGTH_OFFSET);
+    }
+
+    /**
+     * Set the length in bytes of the entries which follow the header.
+     *
+     * @param entriesLength field value.
+     * @return this for a fluent API.
+     */
+    public BatchMessageFlyweight entriesLength(final int entriesLength)
+    {
+        buffer.putInt(offset + ENTRIES_LENGTH_OFFSET, entriesLength);
+
+        return this;
+    }
+
+    /**
+     * Offset in the wrapped buffer at which the entries begin.
+     *
+     * @return offset in the wrapped buffer at which the entries begin.
+     */
+    public int entriesOffset()
+    {
+        return offset + ENTRIES_OFFSET;
+    }
+
+    /**
+     * Length of the message in bytes.
+     *
+     * @return length of the message in bytes.
+     */
+    public int length()
+    {
+        return ENTRIES_OFFSET + entriesLength();
+    }
+
+    /**
+     * Validate buffer length is long enough for message.
+     *
+     * @param msgTypeId type of message.
+     * @param length of message in bytes to validate.
+     */
+    public void validateLength(final int msgTypeId, final int length)
+    {
+        if (length < ENTRIES_OFFSET)
+        {
+            throw new ControlProtocolException(
+                MALFORMED_COMMAND, "command=" + msgTypeId + " too short: length=" + length);
+        }
+
+        final int entriesLength = entriesLength();
+        if (entriesLength < 0 || (length - ENTRIES_OFFSET) < entriesLength)
+        {
+            throw new ControlProtocolException(
+                MALFORMED_COMMAND, "command=" + msgTypeId + " too short: length=" + length);
+        }
+    }
+}
@@ -92,6 +92,11 @@ public class ControlProtocolEvents
      */
     public static final int TERMINATE_DRIVER = 0x0E;
 
+    /**
+     * Batch of add and remove commands for publications, subscriptions, and counters.
+     */
+    public static final int BATCH = 0x0F;
+
     // Media Driver to Clients
 
     /**
@@ -143,4 +148,9 @@ public class ControlProtocolEvents
      * Inform clients of client timeout.
      */
     public static final int ON_CLIENT_TIMEOUT = 0x0F0A;
+
+    /**
+     * Inform client of the results of a batch of commands.
+     */
+    public static final int ON_BATCH_COMPLETE = 0x0F0B;
 }
@@ -17,6 +17,7 @@
 #include <cstdint>
 #include <thread>
 #include <functional>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -372,6 +373,32 @@ public:
         }
     }
 
+    void transmitOnBatchComplete(
+        aeron_async_batch_t *batch, const std::vector<std::pair<int64_t, int32_t>> &results)
+    {
+        std::vector<uint8_t> response_buffer(
+            sizeof(aeron_batch_complete_t) + (results.size() * sizeof(aeron_batch_result_t)));
+        auto response = reinterpret_cast<aeron_batch_complete_t *>(response_buffer.data());
+        auto result = reinterpret_cast<aeron_batch_result_t *>(response_buffer.data() + sizeof(aeron_batch_complete_t));
+
+        response->correlation_id = batch->registration_id;
+        response->result_count = static_cast<int32_t>(results.size());
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            result[i].correlation_id = results[i].first;
+            result[i].error_code = results[i].second;
+        }
+
+        if (aeron_broadcast_transmitter_transmit(
+            &m_to_clients,
+            AERON_RESPONSE_ON_BATCH_COMPLETE,
+            response_buffer.data(),
+            response_buffer.size()) < 0)
+        {
+            throw std::runtime_error("error transmitting ON_BATCH_COMPLETE: " + std::string(aeron_errmsg()));
+        }
+    }
+
 protected:
     aeron_context_t *m_context = nullptr;
     aeron_client_conductor_t m_conductor = {};
@@ -1081,6 +1108,161 @@ TEST_F(ClientConductorTest, shouldHandleSubscriptionAddDestinationMaxMessageSize
     doWork();
 }
 
+TEST_F(ClientConductorTest, shouldAddPublicationAndSubscriptionInBatchSuccessfully)
+{
+    aeron_async_batch_t *batch = nullptr;
+    aeron_async_add_publication_t *async_pub = nullptr;
+    aeron_async_add_subscription_t *async_sub = nullptr;
+    aeron_publication_t *publication = nullptr;
+    aeron_subscription_t *subscription = nullptr;
+
+    ASSERT_EQ(aeron_client_conductor_async_batch_create(&batch, &m_conductor), 0) << aeron_errmsg();
+    ASSERT_EQ(aeron_client_conductor_async_batch_add_publication(&async_pub, batch, URI_RESERVED, STREAM_ID), 0);
+    ASSERT_EQ(aeron_client_conductor_async_batch_add_subscription(
+        &async_sub, batch, SUB_URI, STREAM_ID, nullptr, nullptr, nullptr, nullptr), 0);
+    ASSERT_EQ(aeron_client_conductor_async_batch_submit(batch), 0) << aeron_errmsg();
+    ASSERT_EQ(aeron_client_conductor_async_batch_submit(batch), -1);
+    doWork();
+
+    size_t records_read = aeron_mpsc_rb_read(
+        &m_to_driver,
+        [](int32_t msg_type_id, const void *buffer, size_t length, void *clientd)
+        {
+            const auto *command = static_cast<const aeron_batch_command_t *>(buffer);
+            EXPECT_EQ(AERON_COMMAND_BATCH, msg_type_id);
+            EXPECT_EQ(2, command->entry_count);
+            EXPECT_EQ(length, sizeof(aeron_batch_command_t) + static_cast<size_t>(command->entries_length));
+        },
+        nullptr,
+        10);
+    ASSERT_EQ(1u, records_read);
+
+    ASSERT_EQ(aeron_async_batch_poll(batch), 0) << aeron_errmsg();
+    ASSERT_EQ(aeron_async_add_publication_poll(&publication, async_pub), 0) << aeron_errmsg();
+    ASSERT_EQ(aeron_async_add_subscription_poll(&subscription, async_sub), 0) << aeron_errmsg();
+
+    transmitOnPublicationReady(async_pub, m_logFileName, false);
+    transmitOnSubscriptionReady(async_sub);
+    transmitOnBatchComplete(batch, { { async_pub->registration_id, 0 }, { async_sub->registration_id, 0 } });
+    createLogFile(m_logFileName);
+    doWork();
+    doWork();
+    doWork();
+
+    ASSERT_GT(aeron_async_add_publication_poll(&publication, async_pub), 0) << aeron_errmsg();
+    ASSERT_TRUE(nullptr != publication);
+    ASSERT_GT(aeron_async_add_subscription_poll(&subscription, async_sub), 0) << aeron_errmsg();
+    ASSERT_TRUE(nullptr != subscription);
+    ASSERT_GT(aeron_async_batch_poll(batch), 0) << aeron_errmsg();
+
+    ASSERT_EQ(aeron_client_conductor_async_batch_create(&batch, &m_conductor), 0) << aeron_errmsg();
+    ASSERT_EQ(aeron_client_conductor_async_batch_close_publication(batch, publication, nullptr, nullptr), 0);
+    ASSERT_EQ(aeron_client_conductor_async_batch_close_subscription(batch, subscription, nullptr, nullptr), 0);
+    ASSERT_EQ(aeron_client_conductor_async_batch_submit(batch), 0) << aeron_errmsg();
+    doWork();
+
+    transmitOnBatchComplete(batch, { { AERON_NULL_VALUE, 0 }, { AERON_NULL_VALUE, 0 } });
+    doWork();
+
+    ASSERT_GT(aeron_async_batch_poll(batch), 0) << aeron_errmsg();
+}
+
+TEST_F(ClientConductorTest, shouldOnlyMarkResourceClosedInBatchOnSubmit)
+{
+    aeron_async_add_publication_t *async_pub = nullptr;
+    aeron_async_batch_t *batch = nullptr;
+    aeron_publication_t *publication = nullptr;
+
+    ASSERT_EQ(aeron_client_conductor_async_add_publication(&async_pub, &m_conductor, URI_RESERVED, STREAM_ID), 0);
+    doWork();
+
+    transmitOnPublicationReady(async_pub, m_logFileName, false);
+    createLogFile(m_logFileName);
+    doWork();
+
+    ASSERT_GT(aeron_async_add_publication_poll(&publication, async_pub), 0) << aeron_errmsg();
+    ASSERT_TRUE(nullptr != publication);
+    aeron_mpsc_rb_read(&m_to_driver, [](int32_t, const void *, size_t, void *) {}, nullptr, 10);
+
+    ASSERT_EQ(aeron_client_conductor_async_batch_create(&batch, &m_conductor), 0) << aeron_errmsg();
+    ASSERT_EQ(aeron_client_conductor_async_batch_close_publication(batch, publication, nullptr, nullptr), 0);
+    ASSERT_EQ(aeron_client_conductor_async_batch_close_publication(batch, publication, nullptr, nullptr), 0);
+    EXPECT_FALSE(aeron_publication_is_closed(publication));
+
+    ASSERT_EQ(aeron_client_conductor_async_batch_submit(batch), 0) << aeron_errmsg();
+    doWork();
+
+    size_t records_read = aeron_mpsc_rb_read(
+        &m_to_driver,
+        [](int32_t msg_type_id, const void *buffer, size_t length, void *clientd)
+        {
+            const auto *command = static_cast<const aeron_batch_command_t *>(buffer);
+            EXPECT_EQ(AERON_COMMAND_BATCH, msg_type_id);
+            EXPECT_EQ(1, command->entry_count);
+        },
+        nullptr,
+        10);
+    ASSERT_EQ(1u, records_read);
+
+    transmitOnBatchComplete(batch, { { AERON_NULL_VALUE, 0 } });
+    doWork();
+
+    ASSERT_GT(aeron_async_batch_poll(batch), 0) << aeron_errmsg();
+}
+
+TEST_F(ClientConductorTest, shouldErrorOnBatchWithFailedEntry)
+{
+    aeron_async_batch_t *batch = nullptr;
+    aeron_async_add_publication_t *async_pub = nullptr;
+    aeron_async_add_counter_t *async_counter = nullptr;
+    aeron_publication_t *publication = nullptr;
+    aeron_counter_t *counter = nullptr;
+
+    ASSERT_EQ(aeron_client_conductor_async_batch_create(&batch, &m_conductor), 0) << aeron_errmsg();
+    ASSERT_EQ(aeron_client_conductor_async_batch_add_publication(&async_pub, batch, URI_RESERVED, STREAM_ID), 0);
+    ASSERT_EQ(aeron_client_conductor_async_batch_add_counter(
+        &async_counter, batch, COUNTER_TYPE_ID, nullptr, 0, nullptr, 0), 0);
+    ASSERT_EQ(aeron_client_conductor_async_batch_submit(batch), 0) << aeron_errmsg();
+    doWork();
+
+    transmitOnError(async_pub, AERON_ERROR_CODE_INVALID_CHANNEL, "invalid channel");
+    transmitOnCounterReady(async_counter);
+    transmitOnBatchComplete(
+        batch,
+        { { async_pub->registration_id, AERON_ERROR_CODE_INVALID_CHANNEL }, { async_counter->registration_id, 0 } });
+    doWork();
+    doWork();
+    doWork();
+
+    ASSERT_EQ(aeron_async_add_publication_poll(&publication, async_pub), -1);
+    ASSERT_GT(aeron_async_add_counter_poll(&counter, async_counter), 0) << aeron_errmsg();
+    ASSERT_TRUE(nullptr != counter);
+    ASSERT_EQ(aeron_async_batch_poll(batch), -1);
+    ASSERT_EQ(EINVAL, aeron_errcode());
+
+    ASSERT_EQ(aeron_counter_close(counter, nullptr, nullptr), 0);
+    doWork();
+}
+
+TEST_F(ClientConductorTest, shouldErrorOnBatchExceedingMaxMessageLength)
+{
+    aeron_async_batch_t *batch = nullptr;
+    aeron_async_add_publication_t *async_pub = nullptr;
+    const size_t uri_length = MAX_MESSAGE_SIZE - sizeof(aeron_publication_command_t);
+    std::string uri = allocateStringWithPrefix(URI_RESERVED, "|alias=", 'X', uri_length);
+
+    ASSERT_EQ(aeron_client_conductor_async_batch_create(&batch, &m_conductor), 0) << aeron_errmsg();
+    ASSERT_EQ(aeron_client_conductor_async_batch_add_publication(&async_pub, batch, uri.c_str(), STREAM_ID), -1);
+    ASSERT_TRUE(nullptr == async_pub);
+    ASSERT_EQ(aeron_client_conductor_async_batch_submit(batch), 0) << aeron_errmsg();
+    doWork();
+
+    transmitOnBatchComplete(batch, {});
+    doWork();
+
+    ASSERT_GT(aeron_async_batch_poll(batch), 0) << aeron_errmsg();
+}
+
 TEST_F(ClientConductorTest, shouldSetCloseFlagOnTimeout)
 {
     int errorcode = 0;
@@ -17,6 +17,7 @@
 #include <exception>
 #include <functional>
 #include <string>
+#include <vector>
 #include <limits>
 
 #include <gtest/gtest.h>
@@ -212,6 +213,24 @@ public:
         return aeron_image_poll(m_image, fragment_handler, this, fragment_limit);
     }
 
+    static void fragment_batch_handler(
+        void *clientd, const uint8_t *buffer, const aeron_fragment_descriptor_t *fragments, size_t fragment_count)
+    {
+        auto image = reinterpret_cast<ImageTest *>(clientd);
+
+        if (image->m_batch_handler)
+        {
+            image->m_batch_handler(buffer, fragments, fragment_count);
+        }
+    }
+
+    template<typename F>
+    int imagePollBatch(F &&handler, size_t fragment_limit)
+    {
+        m_batch_handler = handler;
+        return aeron_image_poll_batch(m_image, fragment_batch_handler, this, fragment_limit);
+    }
+
     template<typename F>
     int imageControlledPoll(F &&handler, size_t fragment_limit)
     {
@@ -249,6 +268,7 @@ protected:
     size_t m_position_bits_to_shift = 0;
 
     std::function<void(const uint8_t *, size_t, aeron_header_t *)> m_handler = nullptr;
+    std::function<void(const uint8_t *, const aeron_fragment_descriptor_t *, size_t)> m_batch_handler = nullptr;
     std::function<aeron_controlled_fragment_handler_action_t(const uint8_t *, size_t, aeron_header_t *)>
         m_controlled_handler = nullptr;
 
@@ -329,6 +349,68 @@ TEST_F(ImageTest, shouldReadMultipleMessages)
     EXPECT_EQ(m_sub_pos, alignedMessageLength * 2);
 }
 
+TEST_F(ImageTest, shouldPollBatchOfMessagesInSingleCall)
+{
+    const size_t messageLength = 120;
+    const int64_t alignedMessageLength =
+        AERON_ALIGN(messageLength + AERON_DATA_HEADER_LENGTH, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+
+    createImage();
+
+    for (int64_t i = 0; i < 3; i++)
+    {
+        appendMessage(m_sub_pos + (alignedMessageLength * i), messageLength);
+    }
+
+    size_t batchCount = 0;
+    auto handler = [&](const uint8_t *buffer, const aeron_fragment_descriptor_t *fragments, size_t fragment_count)
+    {
+        batchCount++;
+        EXPECT_EQ(buffer, termBuffer(0));
+        ASSERT_EQ(fragment_count, 3u);
+        for (size_t i = 0; i < fragment_count; i++)
+        {
+            EXPECT_EQ(fragments[i].offset, (alignedMessageLength * i) + AERON_DATA_HEADER_LENGTH);
+            EXPECT_EQ(fragments[i].length, messageLength);
+            EXPECT_EQ(fragments[i].header->frame->term_offset, (int32_t)(alignedMessageLength * i));
+            EXPECT_EQ(fragments[i].header->frame->session_id, SESSION_ID);
+        }
+    };
+
+    EXPECT_EQ(imagePollBatch(handler, std::numeric_limits<size_t>::max()), 3);
+    EXPECT_EQ(batchCount, 1u);
+    EXPECT_EQ(m_sub_pos, alignedMessageLength * 3);
+}
+
+TEST_F(ImageTest, shouldSplitPollBatchAtMaxLength)
+{
+    const size_t messageLength = 8;
+    const size_t messageCount = AERON_FRAGMENT_BATCH_MAX_LENGTH + 3;
+    const int64_t alignedMessageLength =
+        AERON_ALIGN(messageLength + AERON_DATA_HEADER_LENGTH, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+
+    createImage();
+
+    for (size_t i = 0; i < messageCount; i++)
+    {
+        appendMessage(m_sub_pos + (alignedMessageLength * (int64_t)i), messageLength);
+    }
+
+    std::vector<size_t> batchLengths;
+    auto handler = [&](const uint8_t *, const aeron_fragment_descriptor_t *fragments, size_t fragment_count)
+    {
+        batchLengths.push_back(fragment_count);
+    };
+
+    EXPECT_EQ(imagePollBatch(handler, messageCount - 1), (int)(messageCount - 1));
+    EXPECT_EQ(m_sub_pos, alignedMessageLength * (int64_t)(messageCount - 1));
+    EXPECT_EQ(imagePollBatch(handler, std::numeric_limits<size_t>::max()), 1);
+    EXPECT_EQ(m_sub_pos, alignedMessageLength * (int64_t)messageCount);
+
+    const std::vector<size_t> expected = { AERON_FRAGMENT_BATCH_MAX_LENGTH, 2, 1 };
+    EXPECT_EQ(batchLengths, expected);
+}
+
 TEST_F(ImageTest, shouldReadLastMessage)
 {
     const size_t messageLength = 120;
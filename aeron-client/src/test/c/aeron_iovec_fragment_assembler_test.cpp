@@ -0,0 +1,200 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeronc.h"
+#include "aeron_image.h"
+#include "aeron_fragment_assembler.h"
+}
+
+#define STREAM_ID (8)
+#define SESSION_ID (-541)
+#define TERM_LENGTH (AERON_LOGBUFFER_TERM_MIN_LENGTH)
+#define INITIAL_TERM_ID (42)
+#define ACTIVE_TERM_ID  (INITIAL_TERM_ID + 3)
+#define POSITION_BITS_TO_SHIFT (aeron_number_of_trailing_zeroes(TERM_LENGTH))
+#define MTU_LENGTH (1408)
+#define MAX_PAYLOAD_LENGTH (MTU_LENGTH - AERON_DATA_HEADER_LENGTH)
+
+typedef std::array<uint8_t, TERM_LENGTH> term_buffer_t;
+
+class IovecFragmentAssemblerTest : public testing::Test
+{
+public:
+    IovecFragmentAssemblerTest()
+    {
+        m_term.fill(0);
+        m_header.initial_term_id = INITIAL_TERM_ID;
+        m_header.position_bits_to_shift = POSITION_BITS_TO_SHIFT;
+
+        if (aeron_image_iovec_fragment_assembler_create(&m_image_assembler, iovec_handler, this) < 0 ||
+            aeron_iovec_fragment_assembler_create(&m_assembler, iovec_handler, this) < 0)
+        {
+            throw std::runtime_error("could not create iovec fragment assembler: " + std::string(aeron_errmsg()));
+        }
+    }
+
+    ~IovecFragmentAssemblerTest() override
+    {
+        aeron_image_iovec_fragment_assembler_delete(m_image_assembler);
+        aeron_iovec_fragment_assembler_delete(m_assembler);
+    }
+
+    void fillFrame(int32_t termOffset, uint8_t flags, int32_t sessionId, size_t length, uint8_t initialPayloadValue)
+    {
+        auto frame = (aeron_data_header_t *)(m_term.data() + termOffset);
+
+        frame->frame_header.frame_length = (int32_t)(AERON_DATA_HEADER_LENGTH + length);
+        frame->frame_header.version = AERON_FRAME_HEADER_VERSION;
+        frame->frame_header.flags = flags;
+        frame->frame_header.type = AERON_HDR_TYPE_DATA;
+        frame->term_offset = termOffset;
+        frame->session_id = sessionId;
+        frame->stream_id = STREAM_ID;
+        frame->term_id = ACTIVE_TERM_ID;
+
+        uint8_t value = initialPayloadValue;
+        for (size_t i = 0; i < length; i++)
+        {
+            m_term[termOffset + AERON_DATA_HEADER_LENGTH + i] = value++;
+        }
+    }
+
+    void onFragment(aeron_fragment_handler_t assembler_handler, void *assembler, int32_t termOffset)
+    {
+        auto frame = (aeron_data_header_t *)(m_term.data() + termOffset);
+        m_header.frame = frame;
+        assembler_handler(
+            assembler,
+            m_term.data() + termOffset + AERON_DATA_HEADER_LENGTH,
+            (size_t)frame->frame_header.frame_length - AERON_DATA_HEADER_LENGTH,
+            &m_header);
+    }
+
+    static void iovec_handler(void *clientd, const aeron_iovec_t *iov, size_t iovcnt, aeron_header_t *header)
+    {
+        auto test = reinterpret_cast<IovecFragmentAssemblerTest *>(clientd);
+        test->m_messages.emplace_back(iov, iov + iovcnt);
+        test->m_frame_lengths.push_back((int32_t)header->frame->frame_header.frame_length);
+        test->m_session_ids.push_back((int32_t)header->frame->session_id);
+    }
+
+protected:
+    AERON_DECL_ALIGNED(term_buffer_t m_term, 16) = {};
+    aeron_header_t m_header = {};
+    aeron_image_iovec_fragment_assembler_t *m_image_assembler = nullptr;
+    aeron_iovec_fragment_assembler_t *m_assembler = nullptr;
+    std::vector<std::vector<aeron_iovec_t>> m_messages;
+    std::vector<int32_t> m_frame_lengths;
+    std::vector<int32_t> m_session_ids;
+};
+
+TEST_F(IovecFragmentAssemblerTest, shouldPassThroughUnfragmentedMessageAsSingleRegion)
+{
+    fillFrame(0, AERON_DATA_HEADER_UNFRAGMENTED, SESSION_ID, 158, 0);
+
+    onFragment(aeron_image_iovec_fragment_assembler_handler, m_image_assembler, 0);
+
+    ASSERT_EQ(1u, m_messages.size());
+    ASSERT_EQ(1u, m_messages[0].size());
+    EXPECT_EQ(m_term.data() + AERON_DATA_HEADER_LENGTH, m_messages[0][0].iov_base);
+    EXPECT_EQ(158u, m_messages[0][0].iov_len);
+}
+
+TEST_F(IovecFragmentAssemblerTest, shouldReassembleInPlaceFromThreeFragments)
+{
+    fillFrame(0, AERON_DATA_HEADER_BEGIN_FLAG, SESSION_ID, MAX_PAYLOAD_LENGTH, 0);
+    fillFrame(MTU_LENGTH, 0, SESSION_ID, MAX_PAYLOAD_LENGTH, 1);
+    fillFrame(2 * MTU_LENGTH, AERON_DATA_HEADER_END_FLAG, SESSION_ID, 100, 2);
+
+    onFragment(aeron_image_iovec_fragment_assembler_handler, m_image_assembler, 0);
+    onFragment(aeron_image_iovec_fragment_assembler_handler, m_image_assembler, MTU_LENGTH);
+    EXPECT_EQ(0u, m_messages.size());
+
+    onFragment(aeron_image_iovec_fragment_assembler_handler, m_image_assembler, 2 * MTU_LENGTH);
+
+    ASSERT_EQ(1u, m_messages.size());
+    ASSERT_EQ(3u, m_messages[0].size());
+    for (size_t i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(m_term.data() + (i * MTU_LENGTH) + AERON_DATA_HEADER_LENGTH, m_messages[0][i].iov_base);
+        EXPECT_EQ(i, m_messages[0][i].iov_base[0]);
+    }
+    EXPECT_EQ((size_t)MAX_PAYLOAD_LENGTH, m_messages[0][1].iov_len);
+    EXPECT_EQ(100u, m_messages[0][2].iov_len);
+    EXPECT_EQ(AERON_DATA_HEADER_LENGTH + (2 * MAX_PAYLOAD_LENGTH) + 100, m_frame_lengths[0]);
+}
+
+TEST_F(IovecFragmentAssemblerTest, shouldNotReassembleIfMissingMiddleFragment)
+{
+    fillFrame(0, AERON_DATA_HEADER_BEGIN_FLAG, SESSION_ID, MAX_PAYLOAD_LENGTH, 0);
+    fillFrame(2 * MTU_LENGTH, AERON_DATA_HEADER_END_FLAG, SESSION_ID, 100, 2);
+
+    onFragment(aeron_image_iovec_fragment_assembler_handler, m_image_assembler, 0);
+    onFragment(aeron_image_iovec_fragment_assembler_handler, m_image_assembler, 2 * MTU_LENGTH);
+
+    EXPECT_EQ(0u, m_messages.size());
+}
+
+TEST_F(IovecFragmentAssemblerTest, shouldReassembleInterleavedSessions)
+{
+    const int32_t otherSessionId = SESSION_ID + 1;
+    fillFrame(0, AERON_DATA_HEADER_BEGIN_FLAG, SESSION_ID, MAX_PAYLOAD_LENGTH, 0);
+    fillFrame(MTU_LENGTH, AERON_DATA_HEADER_END_FLAG, SESSION_ID, 64, 1);
+    fillFrame(4 * MTU_LENGTH, AERON_DATA_HEADER_BEGIN_FLAG, otherSessionId, MAX_PAYLOAD_LENGTH, 10);
+    fillFrame(5 * MTU_LENGTH, AERON_DATA_HEADER_END_FLAG, otherSessionId, 32, 11);
+
+    onFragment(aeron_iovec_fragment_assembler_handler, m_assembler, 0);
+    onFragment(aeron_iovec_fragment_assembler_handler, m_assembler, 4 * MTU_LENGTH);
+    onFragment(aeron_iovec_fragment_assembler_handler, m_assembler, 5 * MTU_LENGTH);
+    onFragment(aeron_iovec_fragment_assembler_handler, m_assembler, MTU_LENGTH);
+
+    ASSERT_EQ(2u, m_messages.size());
+    EXPECT_EQ(otherSessionId, m_session_ids[0]);
+    ASSERT_EQ(2u, m_messages[0].size());
+    EXPECT_EQ(m_term.data() + (5 * MTU_LENGTH) + AERON_DATA_HEADER_LENGTH, m_messages[0][1].iov_base);
+    EXPECT_EQ(32u, m_messages[0][1].iov_len);
+
+    EXPECT_EQ(SESSION_ID, m_session_ids[1]);
+    ASSERT_EQ(2u, m_messages[1].size());
+    EXPECT_EQ(m_term.data() + AERON_DATA_HEADER_LENGTH, m_messages[1][0].iov_base);
+    EXPECT_EQ(64u, m_messages[1][1].iov_len);
+}
+
+TEST_F(IovecFragmentAssemblerTest, shouldGrowRegionListForLargeMessages)
+{
+    const int32_t fragmentCount = 20;
+    for (int32_t i = 0; i < fragmentCount; i++)
+    {
+        uint8_t flags = 0 == i ? AERON_DATA_HEADER_BEGIN_FLAG :
+            (fragmentCount - 1 == i ? AERON_DATA_HEADER_END_FLAG : (uint8_t)0);
+        fillFrame(i * MTU_LENGTH, flags, SESSION_ID, MAX_PAYLOAD_LENGTH, (uint8_t)i);
+        onFragment(aeron_image_iovec_fragment_assembler_handler, m_image_assembler, i * MTU_LENGTH);
+    }
+
+    ASSERT_EQ(1u, m_messages.size());
+    ASSERT_EQ((size_t)fragmentCount, m_messages[0].size());
+    EXPECT_EQ(fragmentCount - 1, m_messages[0][fragmentCount - 1].iov_base[0]);
+}
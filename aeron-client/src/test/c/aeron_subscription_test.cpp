@@ -16,6 +16,7 @@
 
 #include <exception>
 #include <functional>
+#include <map>
 #include <string>
 
 #include <gtest/gtest.h>
@@ -122,6 +123,50 @@ public:
     {
     }
 
+    static void session_fragment_handler(void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
+    {
+        auto fragmentsBySessionId = reinterpret_cast<std::map<int32_t, int> *>(clientd);
+        (*fragmentsBySessionId)[header->frame->session_id]++;
+    }
+
+    aeron_image_t *addImageWithFrames(int64_t *sub_pos, int32_t frame_count)
+    {
+        aeron_image_t *image = m_imageMap.find(createImage(sub_pos))->second;
+        uint8_t *term_buffer = image->log_buffer->mapped_raw_log.term_buffers[0].addr;
+        const int32_t frame_length = AERON_DATA_HEADER_LENGTH + 32;
+
+        for (int32_t i = 0; i < frame_count; i++)
+        {
+            auto frame = (aeron_data_header_t *)(term_buffer + (i * frame_length));
+            frame->frame_header.version = AERON_FRAME_HEADER_VERSION;
+            frame->frame_header.flags = AERON_DATA_HEADER_BEGIN_FLAG | AERON_DATA_HEADER_END_FLAG;
+            frame->frame_header.type = AERON_HDR_TYPE_DATA;
+            frame->term_offset = i * frame_length;
+            frame->session_id = image->session_id;
+            frame->stream_id = STREAM_ID;
+            AERON_PUT_ORDERED(frame->frame_header.frame_length, frame_length);
+        }
+
+        if (aeron_client_conductor_subscription_add_image(m_subscription, image) < 0)
+        {
+            throw std::runtime_error("could not add image: " + std::string(aeron_errmsg()));
+        }
+
+        return image;
+    }
+
+    void removeAndDeleteImages()
+    {
+        for (auto &entry : m_imageMap)
+        {
+            aeron_client_conductor_subscription_remove_image(m_subscription, entry.second);
+            aeron_log_buffer_delete(entry.second->log_buffer);
+            aeron_image_delete(entry.second);
+        }
+
+        m_imageMap.clear();
+    }
+
 protected:
     aeron_client_conductor_t *m_conductor = nullptr;
     aeron_subscription_t *m_subscription = nullptr;
@@ -199,3 +244,93 @@ TEST_F(SubscriptionTest, shouldFetchConstants)
     ASSERT_EQ(0, aeron_subscription_constants(m_subscription, &constants));
     ASSERT_NE(0, constants.channel_status_indicator_id);
 }
+
+TEST_F(SubscriptionTest, shouldShareFragmentLimitFairlyBetweenImages)
+{
+    int64_t sub_pos[3] = { 0, 0, 0 };
+    std::map<int32_t, int> fragmentsBySessionId;
+    aeron_image_t *images[3];
+
+    for (int i = 0; i < 3; i++)
+    {
+        images[i] = addImageWithFrames(&sub_pos[i], 10);
+    }
+
+    ASSERT_EQ(aeron_subscription_fair_poll(m_subscription, session_fragment_handler, &fragmentsBySessionId, 6, 1), 6);
+
+    for (auto &image : images)
+    {
+        EXPECT_EQ(fragmentsBySessionId[image->session_id], 2);
+        EXPECT_EQ(aeron_image_fair_poll_starved_count(image), 0);
+    }
+
+    removeAndDeleteImages();
+}
+
+TEST_F(SubscriptionTest, shouldGrantFragmentsInProportionToImageWeight)
+{
+    int64_t sub_pos[3] = { 0, 0, 0 };
+    std::map<int32_t, int> fragmentsBySessionId;
+    aeron_image_t *images[3];
+
+    for (int i = 0; i < 3; i++)
+    {
+        images[i] = addImageWithFrames(&sub_pos[i], 10);
+    }
+
+    ASSERT_EQ(aeron_image_set_fair_poll_weight(images[0], 2), 0);
+    ASSERT_EQ(aeron_image_set_fair_poll_weight(images[1], 0), -1);
+
+    ASSERT_EQ(aeron_subscription_fair_poll(m_subscription, session_fragment_handler, &fragmentsBySessionId, 8, 1), 8);
+
+    EXPECT_EQ(fragmentsBySessionId[images[0]->session_id], 4);
+    EXPECT_EQ(fragmentsBySessionId[images[1]->session_id], 2);
+    EXPECT_EQ(fragmentsBySessionId[images[2]->session_id], 2);
+
+    removeAndDeleteImages();
+}
+
+TEST_F(SubscriptionTest, shouldGiveUnusedQuantumOfDrainedImageToOthers)
+{
+    int64_t sub_pos[2] = { 0, 0 };
+    std::map<int32_t, int> fragmentsBySessionId;
+
+    aeron_image_t *sparse = addImageWithFrames(&sub_pos[0], 1);
+    aeron_image_t *busy = addImageWithFrames(&sub_pos[1], 10);
+
+    ASSERT_EQ(aeron_subscription_fair_poll(m_subscription, session_fragment_handler, &fragmentsBySessionId, 8, 2), 8);
+
+    EXPECT_EQ(fragmentsBySessionId[sparse->session_id], 1);
+    EXPECT_EQ(fragmentsBySessionId[busy->session_id], 7);
+    EXPECT_EQ(sparse->fair_poll_deficit, 0);
+    EXPECT_EQ(aeron_subscription_fair_poll_starved_count(m_subscription), 0);
+
+    removeAndDeleteImages();
+}
+
+TEST_F(SubscriptionTest, shouldCountImagesStarvedByFragmentLimit)
+{
+    int64_t sub_pos[3] = { 0, 0, 0 };
+    std::map<int32_t, int> fragmentsBySessionId;
+    aeron_image_t *images[3];
+
+    for (int i = 0; i < 3; i++)
+    {
+        images[i] = addImageWithFrames(&sub_pos[i], 10);
+    }
+
+    ASSERT_EQ(aeron_subscription_fair_poll(m_subscription, session_fragment_handler, &fragmentsBySessionId, 4, 4), 4);
+    EXPECT_EQ(aeron_image_fair_poll_starved_count(images[0]), 0);
+    EXPECT_EQ(aeron_image_fair_poll_starved_count(images[1]), 1);
+    EXPECT_EQ(aeron_image_fair_poll_starved_count(images[2]), 1);
+
+    ASSERT_EQ(aeron_subscription_fair_poll(m_subscription, session_fragment_handler, &fragmentsBySessionId, 4, 4), 4);
+    EXPECT_EQ(aeron_image_fair_poll_starved_count(images[0]), 1);
+    EXPECT_EQ(aeron_image_fair_poll_starved_count(images[1]), 1);
+    EXPECT_EQ(aeron_image_fair_poll_starved_count(images[2]), 2);
+    EXPECT_EQ(aeron_subscription_fair_poll_starved_count(m_subscription), 4);
+
+    EXPECT_EQ(aeron_subscription_fair_poll(m_subscription, null_fragment_handler, this, 4, 0), -1);
+
+    removeAndDeleteImages();
+}
@@ -168,6 +168,21 @@ TEST_F(Int64CounterMapTest, shouldRemoveEntryAndCompactCollisionChain)
     EXPECT_EQ(aeron_int64_counter_map_remove(&m_map, 12), value_12);
 }
 
+TEST_F(Int64CounterMapTest, shouldRemoveEntryFurtherAlongCollisionChain)
+{
+    int64_t collision_value = 43;
+    ASSERT_EQ(aeron_int64_counter_map_init(&m_map, -2, 8, AERON_MAP_DEFAULT_LOAD_FACTOR), 0);
+
+    auto collision_key = (int64_t)(12 + m_map.entries_length);
+    EXPECT_EQ(aeron_int64_counter_map_put(&m_map, 12, collision_key, nullptr), 0);
+    EXPECT_EQ(aeron_int64_counter_map_put(&m_map, collision_key, collision_value, nullptr), 0);
+
+    EXPECT_EQ(aeron_int64_counter_map_remove(&m_map, collision_key), collision_value);
+    EXPECT_EQ(m_map.size, 1u);
+    EXPECT_EQ(aeron_int64_counter_map_get(&m_map, 12), collision_key);
+    EXPECT_EQ(aeron_int64_counter_map_get(&m_map, collision_key), m_map.initial_value);
+}
+
 TEST_F(Int64CounterMapTest, shouldNotForEachEmptyMap)
 {
     ASSERT_EQ(aeron_int64_counter_map_init(&m_map, -2, 8, AERON_MAP_DEFAULT_LOAD_FACTOR), 0);
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include <thread>
+
 #include <gtest/gtest.h>
 
 #include "ClientConductorFixture.h"
@@ -184,6 +186,23 @@ TEST_F(ClientConductorTest, shouldReturnSamePublicationAfterLogBuffersCreated)
     ASSERT_TRUE(pub1 == pub2);
 }
 
+TEST_F(ClientConductorTest, shouldReturnPublicationAddedAndFoundOnOtherThreads)
+{
+    std::int64_t id = 0;
+    std::thread adder([&]() { id = m_conductor.addPublication(CHANNEL, STREAM_ID); });
+    adder.join();
+
+    m_conductor.onNewPublication(
+        id, id, STREAM_ID, SESSION_ID, PUBLICATION_LIMIT_COUNTER_ID, CHANNEL_STATUS_INDICATOR_ID, m_logFileName);
+
+    std::shared_ptr<Publication> pub;
+    std::thread finder([&]() { pub = m_conductor.findPublication(id); });
+    finder.join();
+
+    ASSERT_TRUE(pub != nullptr);
+    EXPECT_EQ(pub->registrationId(), id);
+}
+
 TEST_F(ClientConductorTest, shouldIgnorePublicationReadyForUnknownCorrelationId)
 {
     std::int64_t id = m_conductor.addPublication(CHANNEL, STREAM_ID);
@@ -828,6 +847,35 @@ TEST_F(ClientConductorTest, shouldCallUnavailableImageIfSubscriptionReleased)
     std::shared_ptr<Subscription> sub = m_conductor.findSubscription(id);
     m_conductor.onAvailableImage(correlationId, SESSION_ID, 1, id, m_logFileName, SOURCE_IDENTITY);
     EXPECT_TRUE(sub->hasImage(correlationId));
+
+    sub.reset();
+    m_conductor.doWork();
+}
+
+TEST_F(ClientConductorTest, shouldCallUnavailableImageOnConductorDutyCycleAfterSubscriptionReleased)
+{
+    std::int64_t id = m_conductor.addSubscription(
+        CHANNEL, STREAM_ID, m_onAvailableImageHandler, m_onUnavailableImageHandler);
+    std::int64_t correlationId = id + 1;
+
+    EXPECT_CALL(m_handlers, onNewSub(CHANNEL, STREAM_ID, id))
+        .Times(1);
+    EXPECT_CALL(m_handlers, onNewImage(testing::_))
+        .Times(1);
+    EXPECT_CALL(m_handlers, onInactive(testing::_))
+        .Times(0);
+
+    m_conductor.onSubscriptionReady(id, CHANNEL_STATUS_INDICATOR_ID);
+    std::shared_ptr<Subscription> sub = m_conductor.findSubscription(id);
+    m_conductor.onAvailableImage(correlationId, SESSION_ID, 1, id, m_logFileName, SOURCE_IDENTITY);
+    sub.reset();
+
+    testing::Mock::VerifyAndClearExpectations(&m_handlers);
+
+    EXPECT_CALL(m_handlers, onInactive(testing::_))
+        .Times(1);
+
+    m_conductor.doWork();
 }
 
 TEST_F(ClientConductorTest, shouldClosePublicationOnInterServiceTimeout)
@@ -1021,6 +1069,47 @@ TEST_F(ClientConductorTest, shouldReleaseCounterAfterGoingOutOfScope)
     ASSERT_TRUE(counterPost == nullptr);
 }
 
+TEST_F(ClientConductorTest, shouldNotLimitOutstandingCommandsWithoutConductorDutyCycle)
+{
+    const int resourceCount = 1500;
+    std::vector<std::int64_t> ids;
+    std::vector<std::shared_ptr<Counter>> counters;
+    auto discardToDriverMessages =
+        [&]()
+        {
+            m_manyToOneRingBuffer.read(
+                [&](std::int32_t, concurrent::AtomicBuffer &, util::index_t, util::index_t)
+                {
+                });
+        };
+
+    for (int i = 0; i < resourceCount; i++)
+    {
+        ASSERT_NO_THROW(ids.push_back(m_conductor.addCounter(COUNTER_TYPE_ID, nullptr, 0, COUNTER_LABEL)));
+        discardToDriverMessages();
+    }
+
+    for (std::int64_t id : ids)
+    {
+        m_conductor.onAvailableCounter(id, COUNTER_ID);
+        counters.push_back(m_conductor.findCounter(id));
+        ASSERT_TRUE(counters.back() != nullptr);
+    }
+
+    for (std::shared_ptr<Counter> &counter : counters)
+    {
+        ASSERT_NO_THROW(counter.reset());
+        discardToDriverMessages();
+    }
+
+    m_conductor.doWork();
+
+    for (std::int64_t id : ids)
+    {
+        ASSERT_TRUE(m_conductor.findCounter(id) == nullptr);
+    }
+}
+
 TEST_F(ClientConductorTest, shouldReturnDifferentIdsForDuplicateAddCounter)
 {
     std::int64_t id1 = m_conductor.addCounter(COUNTER_TYPE_ID, nullptr, 0, COUNTER_LABEL);
@@ -314,6 +314,127 @@ TEST_F(ImageTest, shouldEnsureImageIsOpenBeforePoll)
     EXPECT_EQ(image.poll(m_handler, INT_MAX), 0);
 }
 
+TEST_F(ImageTest, shouldLimitFairPollToWeightedQuantum)
+{
+    const std::int64_t initialPosition = LogBufferDescriptor::computePosition(
+        INITIAL_TERM_ID, 0, POSITION_BITS_TO_SHIFT, INITIAL_TERM_ID);
+
+    m_subscriberPosition.set(initialPosition);
+    Image image(
+        SESSION_ID,
+        CORRELATION_ID,
+        SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY,
+        m_subscriberPosition,
+        m_logBuffers,
+        exceptionHandler);
+
+    for (std::int32_t i = 0; i < 5; i++)
+    {
+        insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(i));
+    }
+
+    EXPECT_THROW(image.fairPollWeight(0), util::IllegalArgumentException);
+    image.fairPollWeight(2);
+    EXPECT_TRUE(image.isFragmentAvailable());
+
+    EXPECT_CALL(m_fragmentHandler, onFragment(testing::_, testing::_, static_cast<index_t>(DATA.size()), testing::_))
+        .Times(5);
+
+    EXPECT_EQ(2, image.fairPoll(m_handler, INT_MAX, 1));
+    EXPECT_EQ(1, image.fairPoll(m_handler, 1, 1));
+    EXPECT_EQ(2, image.fairPoll(m_handler, INT_MAX, 1));
+    EXPECT_FALSE(image.isFragmentAvailable());
+    EXPECT_EQ(0, image.fairPoll(m_handler, INT_MAX, 1));
+    EXPECT_EQ(initialPosition + offsetOfFrame(5), m_subscriberPosition.get());
+}
+
+TEST_F(ImageTest, shouldPollBatchOfFragmentsInSingleCall)
+{
+    const std::int64_t initialPosition = LogBufferDescriptor::computePosition(
+        INITIAL_TERM_ID, 0, POSITION_BITS_TO_SHIFT, INITIAL_TERM_ID);
+
+    m_subscriberPosition.set(initialPosition);
+    Image image(
+        SESSION_ID,
+        CORRELATION_ID,
+        SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY,
+        m_subscriberPosition,
+        m_logBuffers,
+        exceptionHandler);
+
+    for (std::int32_t i = 0; i < 3; i++)
+    {
+        insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(i));
+    }
+
+    int batchCount = 0;
+    auto batchHandler = [&](AtomicBuffer &buffer, const FragmentDescriptor *fragments, int fragmentCount)
+    {
+        ++batchCount;
+        ASSERT_EQ(3, fragmentCount);
+        for (int i = 0; i < fragmentCount; i++)
+        {
+            EXPECT_EQ(offsetOfFrame(i) + DataFrameHeader::LENGTH, fragments[i].offset);
+            EXPECT_EQ(static_cast<util::index_t>(DATA.size()), fragments[i].length);
+            EXPECT_EQ(offsetOfFrame(i), fragments[i].header->offset());
+            EXPECT_EQ(SESSION_ID, fragments[i].header->sessionId());
+            EXPECT_EQ(DATA[1], buffer.getUInt8(fragments[i].offset + 1));
+        }
+    };
+
+    EXPECT_EQ(3, image.pollBatch(batchHandler, INT_MAX));
+    EXPECT_EQ(1, batchCount);
+    EXPECT_EQ(initialPosition + offsetOfFrame(3), m_subscriberPosition.get());
+}
+
+TEST_F(ImageTest, shouldSplitPollBatchAtMaxLengthAndRespectFragmentLimit)
+{
+    const std::int32_t frameCount = FRAGMENT_BATCH_MAX_LENGTH + 6;
+    const std::int64_t initialPosition = LogBufferDescriptor::computePosition(
+        INITIAL_TERM_ID, 0, POSITION_BITS_TO_SHIFT, INITIAL_TERM_ID);
+
+    m_subscriberPosition.set(initialPosition);
+    Image image(
+        SESSION_ID,
+        CORRELATION_ID,
+        SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY,
+        m_subscriberPosition,
+        m_logBuffers,
+        exceptionHandler);
+
+    for (std::int32_t i = 0; i < frameCount; i++)
+    {
+        insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(i));
+    }
+
+    std::vector<int> batchLengths;
+    std::vector<util::index_t> offsets;
+    auto batchHandler = [&](AtomicBuffer &, const FragmentDescriptor *fragments, int fragmentCount)
+    {
+        batchLengths.push_back(fragmentCount);
+        for (int i = 0; i < fragmentCount; i++)
+        {
+            offsets.push_back(fragments[i].header->offset());
+        }
+    };
+
+    EXPECT_EQ(2, image.pollBatch(batchHandler, 2));
+    EXPECT_EQ(initialPosition + offsetOfFrame(2), m_subscriberPosition.get());
+
+    EXPECT_EQ(frameCount - 2, image.pollBatch(batchHandler, INT_MAX));
+    EXPECT_EQ(initialPosition + offsetOfFrame(frameCount), m_subscriberPosition.get());
+
+    EXPECT_EQ(std::vector<int>({ 2, FRAGMENT_BATCH_MAX_LENGTH, 4 }), batchLengths);
+    ASSERT_EQ(static_cast<std::size_t>(frameCount), offsets.size());
+    for (std::int32_t i = 0; i < frameCount; i++)
+    {
+        EXPECT_EQ(offsetOfFrame(i), offsets[i]);
+    }
+}
+
 TEST_F(ImageTest, shouldPollNoFragmentsToBoundedFragmentHandlerWithMaxPositionBeforeInitialPosition)
 {
     const std::int32_t messageIndex = 0;
@@ -0,0 +1,186 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <array>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ImageScatterFragmentAssembler.h"
+#include "ScatterFragmentAssembler.h"
+
+using namespace aeron;
+using namespace aeron::concurrent;
+using namespace aeron::concurrent::logbuffer;
+
+static const std::int32_t STREAM_ID = 10;
+static const std::int32_t SESSION_ID = 200;
+static const std::int32_t TERM_LENGTH = LogBufferDescriptor::TERM_MIN_LENGTH;
+static const std::int32_t INITIAL_TERM_ID = -1234;
+static const std::int32_t ACTIVE_TERM_ID = INITIAL_TERM_ID + 5;
+static const int POSITION_BITS_TO_SHIFT = BitUtil::numberOfTrailingZeroes(TERM_LENGTH);
+static const util::index_t MTU_LENGTH = 128;
+static const util::index_t MAX_PAYLOAD_LENGTH = MTU_LENGTH - DataFrameHeader::LENGTH;
+
+typedef std::array<std::uint8_t, TERM_LENGTH> term_buffer_t;
+
+class ScatterFragmentAssemblerTest : public testing::Test
+{
+public:
+    ScatterFragmentAssemblerTest() :
+        m_termBuffer(m_term.data(), m_term.size()),
+        m_header(INITIAL_TERM_ID, POSITION_BITS_TO_SHIFT, nullptr)
+    {
+        m_header.buffer(m_termBuffer);
+    }
+
+    void fillFrame(util::index_t termOffset, std::uint8_t flags, std::int32_t sessionId, util::index_t payloadLength)
+    {
+        auto &frame(m_termBuffer.overlayStruct<DataFrameHeader::DataFrameHeaderDefn>(termOffset));
+
+        frame.frameLength = DataFrameHeader::LENGTH + payloadLength;
+        frame.version = DataFrameHeader::CURRENT_VERSION;
+        frame.flags = flags;
+        frame.type = DataFrameHeader::HDR_TYPE_DATA;
+        frame.termOffset = termOffset;
+        frame.sessionId = sessionId;
+        frame.streamId = STREAM_ID;
+        frame.termId = ACTIVE_TERM_ID;
+
+        for (util::index_t i = 0; i < payloadLength; i++)
+        {
+            m_term[termOffset + DataFrameHeader::LENGTH + i] = static_cast<std::uint8_t>(termOffset + i);
+        }
+    }
+
+    void onFragment(fragment_handler_t &handler, util::index_t termOffset)
+    {
+        m_header.offset(termOffset);
+        handler(
+            m_termBuffer, termOffset + DataFrameHeader::LENGTH, m_header.frameLength() - DataFrameHeader::LENGTH, m_header);
+    }
+
+    scatter_fragment_handler_t delegate()
+    {
+        return [this](const std::vector<AtomicBuffer> &buffers, util::index_t length, Header &header)
+        {
+            std::vector<std::pair<std::uint8_t *, util::index_t>> views;
+            for (const AtomicBuffer &buffer : buffers)
+            {
+                views.emplace_back(buffer.buffer(), buffer.capacity());
+            }
+
+            m_messages.push_back(views);
+            m_lengths.push_back(length);
+            m_frameLengths.push_back(header.frameLength());
+            m_sessionIds.push_back(header.sessionId());
+        };
+    }
+
+    std::uint8_t *payload(util::index_t termOffset)
+    {
+        return m_term.data() + termOffset + DataFrameHeader::LENGTH;
+    }
+
+protected:
+    AERON_DECL_ALIGNED(term_buffer_t m_term, 16) = {};
+    AtomicBuffer m_termBuffer;
+    Header m_header;
+    std::vector<std::vector<std::pair<std::uint8_t *, util::index_t>>> m_messages;
+    std::vector<util::index_t> m_lengths;
+    std::vector<std::int32_t> m_frameLengths;
+    std::vector<std::int32_t> m_sessionIds;
+};
+
+TEST_F(ScatterFragmentAssemblerTest, shouldPassThroughUnfragmentedMessageAsSingleView)
+{
+    ImageScatterFragmentAssembler assembler(delegate());
+    fragment_handler_t handler = assembler.handler();
+    fillFrame(0, FrameDescriptor::UNFRAGMENTED, SESSION_ID, 40);
+
+    onFragment(handler, 0);
+
+    ASSERT_EQ(1u, m_messages.size());
+    ASSERT_EQ(1u, m_messages[0].size());
+    EXPECT_EQ(payload(0), m_messages[0][0].first);
+    EXPECT_EQ(40, m_messages[0][0].second);
+    EXPECT_EQ(40, m_lengths[0]);
+}
+
+TEST_F(ScatterFragmentAssemblerTest, shouldReassembleInPlaceFromThreeFragments)
+{
+    ImageScatterFragmentAssembler assembler(delegate());
+    fragment_handler_t handler = assembler.handler();
+    fillFrame(0, FrameDescriptor::BEGIN_FRAG, SESSION_ID, MAX_PAYLOAD_LENGTH);
+    fillFrame(MTU_LENGTH, 0, SESSION_ID, MAX_PAYLOAD_LENGTH);
+    fillFrame(2 * MTU_LENGTH, FrameDescriptor::END_FRAG, SESSION_ID, 20);
+
+    onFragment(handler, 0);
+    onFragment(handler, MTU_LENGTH);
+    EXPECT_EQ(0u, m_messages.size());
+    onFragment(handler, 2 * MTU_LENGTH);
+
+    ASSERT_EQ(1u, m_messages.size());
+    ASSERT_EQ(3u, m_messages[0].size());
+    for (util::index_t i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(payload(i * MTU_LENGTH), m_messages[0][i].first);
+    }
+    EXPECT_EQ(20, m_messages[0][2].second);
+    EXPECT_EQ((2 * MAX_PAYLOAD_LENGTH) + 20, m_lengths[0]);
+    EXPECT_EQ(DataFrameHeader::LENGTH + m_lengths[0], m_frameLengths[0]);
+}
+
+TEST_F(ScatterFragmentAssemblerTest, shouldNotReassembleIfMissingMiddleFragment)
+{
+    ImageScatterFragmentAssembler assembler(delegate());
+    fragment_handler_t handler = assembler.handler();
+    fillFrame(0, FrameDescriptor::BEGIN_FRAG, SESSION_ID, MAX_PAYLOAD_LENGTH);
+    fillFrame(2 * MTU_LENGTH, FrameDescriptor::END_FRAG, SESSION_ID, 20);
+
+    onFragment(handler, 0);
+    onFragment(handler, 2 * MTU_LENGTH);
+
+    EXPECT_EQ(0u, m_messages.size());
+}
+
+TEST_F(ScatterFragmentAssemblerTest, shouldReassembleInterleavedSessions)
+{
+    const std::int32_t otherSessionId = SESSION_ID + 1;
+    ScatterFragmentAssembler assembler(delegate());
+    fragment_handler_t handler = assembler.handler();
+    fillFrame(0, FrameDescriptor::BEGIN_FRAG, SESSION_ID, MAX_PAYLOAD_LENGTH);
+    fillFrame(MTU_LENGTH, FrameDescriptor::END_FRAG, SESSION_ID, 32);
+    fillFrame(4 * MTU_LENGTH, FrameDescriptor::BEGIN_FRAG, otherSessionId, MAX_PAYLOAD_LENGTH);
+    fillFrame(5 * MTU_LENGTH, FrameDescriptor::END_FRAG, otherSessionId, 16);
+
+    onFragment(handler, 0);
+    onFragment(handler, 4 * MTU_LENGTH);
+    onFragment(handler, 5 * MTU_LENGTH);
+    onFragment(handler, MTU_LENGTH);
+
+    ASSERT_EQ(2u, m_messages.size());
+    EXPECT_EQ(otherSessionId, m_sessionIds[0]);
+    ASSERT_EQ(2u, m_messages[0].size());
+    EXPECT_EQ(payload(5 * MTU_LENGTH), m_messages[0][1].first);
+    EXPECT_EQ(MAX_PAYLOAD_LENGTH + 16, m_lengths[0]);
+
+    EXPECT_EQ(SESSION_ID, m_sessionIds[1]);
+    ASSERT_EQ(2u, m_messages[1].size());
+    EXPECT_EQ(payload(0), m_messages[1][0].first);
+    EXPECT_EQ(MAX_PAYLOAD_LENGTH + 32, m_lengths[1]);
+}
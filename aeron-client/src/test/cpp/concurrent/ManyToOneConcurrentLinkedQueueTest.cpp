@@ -0,0 +1,180 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "concurrent/ManyToOneConcurrentLinkedQueue.h"
+
+using namespace aeron;
+using namespace aeron::concurrent;
+
+#define NUM_PRODUCERS (4)
+#define NUM_ELEMENTS_PER_PRODUCER (100 * 1000)
+
+struct Element
+{
+    Element() = default;
+
+    Element(int producerId, int sequence) : m_producerId(producerId), m_sequence(sequence)
+    {
+    }
+
+    int m_producerId = 0;
+    int m_sequence = 0;
+};
+
+TEST(ManyToOneConcurrentLinkedQueueTest, shouldBeEmptyOnCreation)
+{
+    ManyToOneConcurrentLinkedQueue<Element> queue;
+    int drainedCount = 0;
+
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_EQ(queue.drainAll([&](Element &) { drainedCount++; }), 0u);
+    EXPECT_EQ(drainedCount, 0);
+}
+
+TEST(ManyToOneConcurrentLinkedQueueTest, shouldDrainInOrderOfOffer)
+{
+    ManyToOneConcurrentLinkedQueue<Element> queue;
+    std::vector<int> drained;
+
+    for (int i = 0; i < 3; i++)
+    {
+        queue.offer(Element(0, i));
+    }
+
+    EXPECT_FALSE(queue.isEmpty());
+    EXPECT_EQ(queue.drainAll([&](Element &element) { drained.push_back(element.m_sequence); }), 3u);
+    ASSERT_EQ(drained.size(), 3u);
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(drained[i], i);
+    }
+
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+TEST(ManyToOneConcurrentLinkedQueueTest, shouldDrainUpToLimit)
+{
+    ManyToOneConcurrentLinkedQueue<Element> queue;
+    int drainedCount = 0;
+
+    for (int i = 0; i < 8; i++)
+    {
+        queue.offer(Element(0, i));
+    }
+
+    EXPECT_EQ(queue.drain([&](Element &) { drainedCount++; }, 3), 3u);
+    EXPECT_EQ(drainedCount, 3);
+    EXPECT_EQ(queue.drainAll([&](Element &) { drainedCount++; }), 5u);
+    EXPECT_EQ(drainedCount, 8);
+}
+
+TEST(ManyToOneConcurrentLinkedQueueTest, shouldNotDrainElementsOfferedWhileDraining)
+{
+    ManyToOneConcurrentLinkedQueue<Element> queue;
+    int drainedCount = 0;
+
+    queue.offer(Element(0, 0));
+    queue.offer(Element(0, 1));
+
+    EXPECT_EQ(queue.drainAll(
+        [&](Element &element)
+        {
+            drainedCount++;
+            queue.offer(Element(0, element.m_sequence + 2));
+        }), 2u);
+    EXPECT_EQ(drainedCount, 2);
+    EXPECT_FALSE(queue.isEmpty());
+}
+
+TEST(ManyToOneConcurrentLinkedQueueTest, shouldReleaseUndrainedElementsOnDestruction)
+{
+    std::shared_ptr<int> resource = std::make_shared<int>(7);
+
+    {
+        ManyToOneConcurrentLinkedQueue<std::shared_ptr<int>> queue;
+        for (int i = 0; i < 4; i++)
+        {
+            queue.offer(std::shared_ptr<int>(resource));
+        }
+
+        EXPECT_EQ(resource.use_count(), 5);
+    }
+
+    EXPECT_EQ(resource.use_count(), 1);
+}
+
+TEST(ManyToOneConcurrentLinkedQueueConcurrentTest, shouldExchangeElements)
+{
+    ManyToOneConcurrentLinkedQueue<Element> queue;
+
+    std::atomic<int> countDown(NUM_PRODUCERS);
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < NUM_PRODUCERS; i++)
+    {
+        threads.push_back(std::thread(
+            [&queue, &countDown, i]()
+            {
+                countDown--;
+                while (countDown > 0)
+                {
+                    std::this_thread::yield();
+                }
+
+                for (int m = 0; m < NUM_ELEMENTS_PER_PRODUCER; m++)
+                {
+                    queue.offer(Element(i, m));
+                }
+            }));
+    }
+
+    int elementCount = 0;
+    int counts[NUM_PRODUCERS] = {};
+
+    while (elementCount < (NUM_ELEMENTS_PER_PRODUCER * NUM_PRODUCERS))
+    {
+        const std::size_t drainCount = queue.drainAll(
+            [&counts](Element &element)
+            {
+                EXPECT_EQ(counts[element.m_producerId], element.m_sequence);
+                counts[element.m_producerId]++;
+            });
+
+        if (0 == drainCount)
+        {
+            std::this_thread::yield();
+        }
+
+        elementCount += static_cast<int>(drainCount);
+    }
+
+    for (std::thread &t: threads)
+    {
+        if (t.joinable())
+        {
+            t.join();
+        }
+    }
+
+    EXPECT_TRUE(queue.isEmpty());
+}
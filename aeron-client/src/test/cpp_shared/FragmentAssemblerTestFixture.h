@@ -291,4 +291,30 @@ TEST_P(FragmentAssemblerParameterisedTest, shouldReassembleTwoMessagesFromFourFr
     ASSERT_TRUE(isCalled);
 }
 
+TEST_P(FragmentAssemblerParameterisedTest, shouldReassembleWithTypedDelegate)
+{
+    util::index_t fragmentLength = MTU_LENGTH - DataFrameHeader::LENGTH;
+    int callCount = 0;
+    auto handler =
+        [&](AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+        {
+            ++callCount;
+            EXPECT_EQ(length, fragmentLength * 2);
+            EXPECT_EQ(header.sessionId(), SESSION_ID);
+            EXPECT_EQ(header.termOffset(), TERM_OFFSET);
+            verifyPayload(buffer, offset, length);
+        };
+
+    TypedFragmentAssembler<decltype(handler)> assembler(handler);
+    AtomicBuffer buf{m_buffer};
+
+    fillFrame(TERM_OFFSET, FrameDescriptor::BEGIN_FRAG, 0, fragmentLength, 0);
+    assembler(buf, 0, fragmentLength, *m_header);
+    ASSERT_EQ(0, callCount);
+
+    fillFrame(TERM_OFFSET + MTU_LENGTH, FrameDescriptor::END_FRAG, MTU_LENGTH, fragmentLength, fragmentLength % 256);
+    assembler(buf, MTU_LENGTH, fragmentLength, *m_header);
+    ASSERT_EQ(1, callCount);
+}
+
 #endif //AERON_FRAGMENTASSEMBLERTESTFIXTURE_H
@@ -193,6 +193,101 @@ TEST_F(SystemTest, shouldAddRemoveCloseHandler)
     EXPECT_EQ(0, closeCount2);
 }
 
+TEST_F(SystemTest, shouldAddPublicationsSubscriptionAndCounterInBatch)
+{
+    std::shared_ptr<Aeron> aeron = Aeron::connect();
+    const std::uint8_t key[] = { 1, 2, 3, 4 };
+
+    const std::int64_t batchId = aeron->createBatch();
+    const std::int64_t pubId = aeron->addPublication(batchId, "aeron:ipc", 1001);
+    const std::int64_t exPubId = aeron->addExclusivePublication(batchId, "aeron:ipc", 1002);
+    const std::int64_t subId = aeron->addSubscription(batchId, "aeron:ipc", 1001);
+    const std::int64_t counterId = aeron->addCounter(batchId, 1003, key, sizeof(key), "batch counter");
+    aeron->submitBatch(batchId);
+
+    WAIT_FOR(aeron->findBatchResponse(batchId));
+
+    WAIT_FOR_NON_NULL(publication, aeron->findPublication(pubId));
+    WAIT_FOR_NON_NULL(exclusivePublication, aeron->findExclusivePublication(exPubId));
+    WAIT_FOR_NON_NULL(subscription, aeron->findSubscription(subId));
+    WAIT_FOR_NON_NULL(counter, aeron->findCounter(counterId));
+
+    EXPECT_EQ(1001, publication->streamId());
+    EXPECT_EQ(1002, exclusivePublication->streamId());
+    EXPECT_EQ(1001, subscription->streamId());
+    EXPECT_EQ("batch counter", counter->label());
+    WAIT_FOR(publication->isConnected() && subscription->isConnected());
+}
+
+TEST_F(SystemTest, shouldClosePublicationsSubscriptionAndCounterInBatch)
+{
+    std::shared_ptr<Aeron> aeron = Aeron::connect();
+    const std::uint8_t key[] = { 1, 2, 3, 4 };
+
+    const std::int64_t addBatchId = aeron->createBatch();
+    const std::int64_t pubId = aeron->addPublication(addBatchId, "aeron:ipc", 1001);
+    const std::int64_t exPubId = aeron->addExclusivePublication(addBatchId, "aeron:ipc", 1002);
+    const std::int64_t subId = aeron->addSubscription(addBatchId, "aeron:ipc", 1001);
+    const std::int64_t counterId = aeron->addCounter(addBatchId, 1003, key, sizeof(key), "batch counter");
+    aeron->submitBatch(addBatchId);
+
+    WAIT_FOR(aeron->findBatchResponse(addBatchId));
+
+    WAIT_FOR_NON_NULL(publication, aeron->findPublication(pubId));
+    WAIT_FOR_NON_NULL(exclusivePublication, aeron->findExclusivePublication(exPubId));
+    WAIT_FOR_NON_NULL(subscription, aeron->findSubscription(subId));
+    WAIT_FOR_NON_NULL(counter, aeron->findCounter(counterId));
+
+    const std::int64_t closeBatchId = aeron->createBatch();
+    aeron->close(closeBatchId, publication);
+    aeron->close(closeBatchId, exclusivePublication);
+    aeron->close(closeBatchId, subscription);
+    aeron->close(closeBatchId, counter);
+
+    EXPECT_FALSE(publication->isClosed());
+    EXPECT_FALSE(exclusivePublication->isClosed());
+    EXPECT_FALSE(subscription->isClosed());
+    EXPECT_FALSE(counter->isClosed());
+
+    aeron->submitBatch(closeBatchId);
+
+    EXPECT_TRUE(publication->isClosed());
+    EXPECT_TRUE(exclusivePublication->isClosed());
+    EXPECT_TRUE(subscription->isClosed());
+    EXPECT_TRUE(counter->isClosed());
+
+    WAIT_FOR(aeron->findBatchResponse(closeBatchId));
+}
+
+TEST_F(SystemTest, shouldThrowWhenBatchCommandFails)
+{
+    std::shared_ptr<Aeron> aeron = Aeron::connect();
+
+    const std::int64_t batchId = aeron->createBatch();
+    const std::int64_t pubId = aeron->addPublication(batchId, "aeron:ipc?term-length=1000", 1001);
+    const std::int64_t subId = aeron->addSubscription(batchId, "aeron:ipc", 1001);
+    aeron->submitBatch(batchId);
+    ASSERT_THROW(aeron->submitBatch(batchId), util::SourcedException);
+
+    WAIT_FOR_NON_NULL(subscription, aeron->findSubscription(subId));
+    ASSERT_THROW(
+        {
+            while (!aeron->findBatchResponse(batchId))
+            {
+                std::this_thread::yield();
+            }
+        },
+        util::SourcedException);
+    ASSERT_THROW(
+        {
+            while (nullptr == aeron->findPublication(pubId))
+            {
+                std::this_thread::yield();
+            }
+        },
+        util::SourcedException);
+}
+
 //
 // These tests will fail with the sanitizer if not implemented correctly.
 //
@@ -24,6 +24,7 @@
 #include "util/aeron_parse_util.h"
 #include "util/aeron_error.h"
 #include "util/aeron_symbol_table.h"
+#include "concurrent/aeron_atomic.h"
 #include "aeron_congestion_control.h"
 #include "aeron_alloc.h"
 #include "aeron_driver_context.h"
@@ -38,6 +39,22 @@
 #define AERON_CUBICCONGESTIONCONTROL_B (0.2)
 #define AERON_CUBICCONGESTIONCONTROL_RTT_TIMEOUT_MULTIPLE (4)
 
+#define AERON_BBRCONGESTIONCONTROL_INITIALRTT_DEFAULT (100 * 1000LL)
+#define AERON_BBRCONGESTIONCONTROL_SECOND_IN_NS (1 * 1000 * 1000 * 1000LL)
+
+#define AERON_BBRCONGESTIONCONTROL_INITCWND (10)
+#define AERON_BBRCONGESTIONCONTROL_MIN_CWND (4)
+#define AERON_BBRCONGESTIONCONTROL_MIN_ROUND_NS (100 * 1000LL)
+#define AERON_BBRCONGESTIONCONTROL_RTT_MEASURE_MULTIPLE (2)
+#define AERON_BBRCONGESTIONCONTROL_BANDWIDTH_FILTER_ROUNDS (10)
+#define AERON_BBRCONGESTIONCONTROL_HIGH_GAIN (2.885)
+#define AERON_BBRCONGESTIONCONTROL_CWND_GAIN (2.0)
+#define AERON_BBRCONGESTIONCONTROL_FULL_BANDWIDTH_THRESHOLD (1.25)
+#define AERON_BBRCONGESTIONCONTROL_FULL_BANDWIDTH_ROUNDS (3)
+#define AERON_BBRCONGESTIONCONTROL_GAIN_CYCLE_LENGTH (8)
+#define AERON_BBRCONGESTIONCONTROL_MIN_RTT_WINDOW_NS (10 * 1000 * 1000 * 1000LL)
+#define AERON_BBRCONGESTIONCONTROL_PROBE_RTT_DURATION_NS (200 * 1000 * 1000LL)
+
 static const aeron_symbol_table_func_t aeron_congestion_control_table[] =
     {
         {
@@ -55,6 +72,11 @@ static const aeron_symbol_table_func_t aeron_congestion_control_table[] =
             "aeron_cubic_congestion_control_strategy_supplier",
             (aeron_fptr_t)aeron_cubic_congestion_control_strategy_supplier
         },
+        {
+            "bbr",
+            "aeron_bbr_congestion_control_strategy_supplier",
+            (aeron_fptr_t)aeron_bbr_congestion_control_strategy_supplier
+        },
     };
 
 static const size_t aeron_congestion_control_table_length =
@@ -178,6 +200,7 @@ int aeron_congestion_control_default_strategy_supplier(
     const char *cc_str = aeron_uri_find_param_value(&channel->uri.params.udp.additional_params, AERON_URI_CC_KEY);
     size_t scc_length = sizeof(AERON_STATICWINDOWCONGESTIONCONTROL_CC_PARAM_VALUE) + 1;
     size_t ccc_length = sizeof(AERON_CUBICCONGESTIONCONTROL_CC_PARAM_VALUE) + 1;
+    size_t bcc_length = sizeof(AERON_BBRCONGESTIONCONTROL_CC_PARAM_VALUE) + 1;
     int result = -1;
 
     if (NULL == cc_str || 0 == strncmp(cc_str, AERON_STATICWINDOWCONGESTIONCONTROL_CC_PARAM_VALUE, scc_length))
@@ -210,6 +233,21 @@ int aeron_congestion_control_default_strategy_supplier(
             context,
             counters_manager);
     }
+    else if (0 == strncmp(cc_str, AERON_BBRCONGESTIONCONTROL_CC_PARAM_VALUE, bcc_length))
+    {
+        result = aeron_bbr_congestion_control_strategy_supplier(
+            strategy,
+            channel,
+            stream_id,
+            session_id,
+            registration_id,
+            term_length,
+            sender_mtu_length,
+            control_address,
+            src_address,
+            context,
+            counters_manager);
+    }
 
     return result;
 }
@@ -487,3 +525,475 @@ int32_t aeron_cubic_congestion_control_strategy_get_max_cwnd(void *state)
 {
     return ((aeron_cubic_congestion_control_strategy_state_t *)state)->max_cwnd;
 }
+
+typedef enum aeron_bbr_congestion_control_mode_en
+{
+    AERON_BBRCONGESTIONCONTROL_MODE_STARTUP,
+    AERON_BBRCONGESTIONCONTROL_MODE_DRAIN,
+    AERON_BBRCONGESTIONCONTROL_MODE_PROBE_BW,
+    AERON_BBRCONGESTIONCONTROL_MODE_PROBE_RTT
+}
+aeron_bbr_congestion_control_mode_t;
+
+static const double aeron_bbr_congestion_control_gain_cycle[AERON_BBRCONGESTIONCONTROL_GAIN_CYCLE_LENGTH] =
+    {
+        1.25, 0.75, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+    };
+
+/*
+ * Model based window which tracks the bottleneck bandwidth, as the max receive rate over recent rounds, and the
+ * min RTT so the window can be held near the bandwidth delay product rather than backing off on loss. RTT state is
+ * written by the receiver and read by the conductor which owns everything else.
+ */
+struct aeron_bbr_congestion_control_strategy_state_stct
+{
+    aeron_bbr_congestion_control_mode_t mode;
+    bool is_round_started;
+    bool is_pipe_full;
+
+    int32_t initial_window_length;
+    int32_t min_window_length;
+    int32_t max_window_length;
+    int32_t window_length;
+    int32_t prior_window_length;
+    int32_t mtu;
+    int32_t full_bandwidth_rounds;
+    size_t cycle_index;
+
+    int64_t initial_rtt_ns;
+    int64_t min_rtt_ns;
+    int64_t min_rtt_timestamp_ns;
+    int64_t last_rtt_timestamp_ns;
+    int64_t probe_rtt_start_ns;
+
+    int64_t round_start_ns;
+    int64_t round_start_position;
+    int64_t round_count;
+    int64_t max_bandwidth;
+    int64_t full_bandwidth;
+    int64_t bandwidth_samples[AERON_BBRCONGESTIONCONTROL_BANDWIDTH_FILTER_ROUNDS];
+
+    aeron_position_t rtt_indicator;
+    aeron_position_t bandwidth_indicator;
+    aeron_position_t window_indicator;
+
+    aeron_counters_manager_t *counters_manager;
+};
+
+typedef struct aeron_bbr_congestion_control_strategy_state_stct aeron_bbr_congestion_control_strategy_state_t;
+
+static int64_t aeron_bbr_congestion_control_strategy_rtt_ns(aeron_bbr_congestion_control_strategy_state_t *bbr_state)
+{
+    int64_t min_rtt_ns;
+    AERON_GET_VOLATILE(min_rtt_ns, bbr_state->min_rtt_ns);
+
+    return INT64_MAX == min_rtt_ns ? bbr_state->initial_rtt_ns : min_rtt_ns;
+}
+
+bool aeron_bbr_congestion_control_strategy_should_measure_rtt(void *state, int64_t now_ns)
+{
+    aeron_bbr_congestion_control_strategy_state_t *bbr_state = (aeron_bbr_congestion_control_strategy_state_t *)state;
+    const int64_t rtt_ns = aeron_bbr_congestion_control_strategy_rtt_ns(bbr_state);
+    const int64_t interval_ns = AERON_BBRCONGESTIONCONTROL_RTT_MEASURE_MULTIPLE *
+        (rtt_ns > AERON_BBRCONGESTIONCONTROL_MIN_ROUND_NS ? rtt_ns : AERON_BBRCONGESTIONCONTROL_MIN_ROUND_NS);
+
+    return (bbr_state->last_rtt_timestamp_ns + interval_ns) - now_ns < 0;
+}
+
+void aeron_bbr_congestion_control_strategy_on_rttm_sent(void *state, int64_t now_ns)
+{
+    ((aeron_bbr_congestion_control_strategy_state_t *)state)->last_rtt_timestamp_ns = now_ns;
+}
+
+void aeron_bbr_congestion_control_strategy_on_rttm(
+    void *state, int64_t now_ns, int64_t rtt_ns, struct sockaddr_storage *source_address)
+{
+    aeron_bbr_congestion_control_strategy_state_t *bbr_state = (aeron_bbr_congestion_control_strategy_state_t *)state;
+    bbr_state->last_rtt_timestamp_ns = now_ns;
+
+    if (rtt_ns <= 0)
+    {
+        return;
+    }
+
+    int64_t probe_rtt_start_ns;
+    AERON_GET_VOLATILE(probe_rtt_start_ns, bbr_state->probe_rtt_start_ns);
+
+    // once a probe has started the stale min is replaced by whatever is measured while the queue drains
+    if (rtt_ns <= bbr_state->min_rtt_ns || bbr_state->min_rtt_timestamp_ns < probe_rtt_start_ns)
+    {
+        AERON_PUT_ORDERED(bbr_state->min_rtt_timestamp_ns, now_ns);
+        AERON_PUT_ORDERED(bbr_state->min_rtt_ns, rtt_ns);
+        aeron_counter_set_ordered(bbr_state->rtt_indicator.value_addr, rtt_ns);
+    }
+}
+
+static void aeron_bbr_congestion_control_strategy_on_round(
+    aeron_bbr_congestion_control_strategy_state_t *bbr_state, int64_t now_ns, int64_t position)
+{
+    const int64_t delivered = position - bbr_state->round_start_position;
+    const int64_t elapsed_ns = now_ns - bbr_state->round_start_ns;
+
+    // idle rounds and the shrunken window during a probe of RTT say nothing about the bottleneck
+    if (delivered > 0 && AERON_BBRCONGESTIONCONTROL_MODE_PROBE_RTT != bbr_state->mode)
+    {
+        const size_t index = (size_t)(bbr_state->round_count % AERON_BBRCONGESTIONCONTROL_BANDWIDTH_FILTER_ROUNDS);
+        bbr_state->bandwidth_samples[index] = (int64_t)(
+            (double)delivered * (double)AERON_BBRCONGESTIONCONTROL_SECOND_IN_NS / (double)elapsed_ns);
+        bbr_state->round_count++;
+
+        int64_t max_bandwidth = 0;
+        for (size_t i = 0; i < AERON_BBRCONGESTIONCONTROL_BANDWIDTH_FILTER_ROUNDS; i++)
+        {
+            max_bandwidth = bbr_state->bandwidth_samples[i] > max_bandwidth ?
+                bbr_state->bandwidth_samples[i] : max_bandwidth;
+        }
+
+        bbr_state->max_bandwidth = max_bandwidth;
+        aeron_counter_set_ordered(bbr_state->bandwidth_indicator.value_addr, max_bandwidth);
+
+        if (!bbr_state->is_pipe_full)
+        {
+            if (max_bandwidth >=
+                (int64_t)((double)bbr_state->full_bandwidth * AERON_BBRCONGESTIONCONTROL_FULL_BANDWIDTH_THRESHOLD))
+            {
+                bbr_state->full_bandwidth = max_bandwidth;
+                bbr_state->full_bandwidth_rounds = 0;
+            }
+            else if (++bbr_state->full_bandwidth_rounds >= AERON_BBRCONGESTIONCONTROL_FULL_BANDWIDTH_ROUNDS)
+            {
+                bbr_state->is_pipe_full = true;
+            }
+        }
+    }
+
+    switch (bbr_state->mode)
+    {
+        case AERON_BBRCONGESTIONCONTROL_MODE_STARTUP:
+            if (bbr_state->is_pipe_full)
+            {
+                bbr_state->mode = AERON_BBRCONGESTIONCONTROL_MODE_DRAIN;
+            }
+            break;
+
+        case AERON_BBRCONGESTIONCONTROL_MODE_DRAIN:
+            // enter the cycle cruising so the first probe follows a settled round
+            bbr_state->mode = AERON_BBRCONGESTIONCONTROL_MODE_PROBE_BW;
+            bbr_state->cycle_index = 2;
+            break;
+
+        case AERON_BBRCONGESTIONCONTROL_MODE_PROBE_BW:
+            bbr_state->cycle_index = (bbr_state->cycle_index + 1) % AERON_BBRCONGESTIONCONTROL_GAIN_CYCLE_LENGTH;
+            break;
+
+        case AERON_BBRCONGESTIONCONTROL_MODE_PROBE_RTT:
+            break;
+    }
+
+    bbr_state->round_start_ns = now_ns;
+    bbr_state->round_start_position = position;
+}
+
+static void aeron_bbr_congestion_control_strategy_check_probe_rtt(
+    aeron_bbr_congestion_control_strategy_state_t *bbr_state, int64_t now_ns)
+{
+    int64_t min_rtt_timestamp_ns;
+    AERON_GET_VOLATILE(min_rtt_timestamp_ns, bbr_state->min_rtt_timestamp_ns);
+
+    if (AERON_BBRCONGESTIONCONTROL_MODE_PROBE_RTT == bbr_state->mode)
+    {
+        if (now_ns - bbr_state->probe_rtt_start_ns >= AERON_BBRCONGESTIONCONTROL_PROBE_RTT_DURATION_NS)
+        {
+            bbr_state->mode = bbr_state->is_pipe_full ?
+                AERON_BBRCONGESTIONCONTROL_MODE_PROBE_BW : AERON_BBRCONGESTIONCONTROL_MODE_STARTUP;
+            bbr_state->window_length = bbr_state->prior_window_length;
+        }
+    }
+    else
+    {
+        const int64_t last_probe_ns = min_rtt_timestamp_ns > bbr_state->probe_rtt_start_ns ?
+            min_rtt_timestamp_ns : bbr_state->probe_rtt_start_ns;
+
+        if (now_ns - last_probe_ns > AERON_BBRCONGESTIONCONTROL_MIN_RTT_WINDOW_NS)
+        {
+            bbr_state->mode = AERON_BBRCONGESTIONCONTROL_MODE_PROBE_RTT;
+            bbr_state->prior_window_length = bbr_state->window_length;
+            AERON_PUT_ORDERED(bbr_state->probe_rtt_start_ns, now_ns);
+        }
+    }
+}
+
+static int32_t aeron_bbr_congestion_control_strategy_window_length(
+    aeron_bbr_congestion_control_strategy_state_t *bbr_state)
+{
+    if (AERON_BBRCONGESTIONCONTROL_MODE_PROBE_RTT == bbr_state->mode)
+    {
+        return bbr_state->min_window_length;
+    }
+
+    if (0 == bbr_state->max_bandwidth)
+    {
+        return bbr_state->window_length;
+    }
+
+    double gain;
+    switch (bbr_state->mode)
+    {
+        case AERON_BBRCONGESTIONCONTROL_MODE_STARTUP:
+            gain = AERON_BBRCONGESTIONCONTROL_HIGH_GAIN;
+            break;
+
+        case AERON_BBRCONGESTIONCONTROL_MODE_DRAIN:
+            gain = 1.0;
+            break;
+
+        default:
+            gain = AERON_BBRCONGESTIONCONTROL_CWND_GAIN *
+                aeron_bbr_congestion_control_gain_cycle[bbr_state->cycle_index];
+            break;
+    }
+
+    const double rtt_ns = (double)aeron_bbr_congestion_control_strategy_rtt_ns(bbr_state);
+    const double bdp =
+        (double)bbr_state->max_bandwidth * rtt_ns / (double)AERON_BBRCONGESTIONCONTROL_SECOND_IN_NS;
+    const double target = gain * bdp;
+
+    int32_t window_length = target < (double)bbr_state->max_window_length ?
+        ((int32_t)target / bbr_state->mtu) * bbr_state->mtu : bbr_state->max_window_length;
+
+    // the window is never reduced while still searching for the bottleneck
+    if (AERON_BBRCONGESTIONCONTROL_MODE_STARTUP == bbr_state->mode && window_length < bbr_state->window_length)
+    {
+        window_length = bbr_state->window_length;
+    }
+
+    return window_length > bbr_state->min_window_length ? window_length : bbr_state->min_window_length;
+}
+
+int32_t aeron_bbr_congestion_control_strategy_on_track_rebuild(
+    void *state,
+    bool *should_force_sm,
+    int64_t now_ns,
+    int64_t new_consumption_position,
+    int64_t last_sm_position,
+    int64_t hwm_position,
+    int64_t starting_rebuild_position,
+    int64_t ending_rebuild_position,
+    bool loss_occurred)
+{
+    aeron_bbr_congestion_control_strategy_state_t *bbr_state = (aeron_bbr_congestion_control_strategy_state_t *)state;
+    *should_force_sm = loss_occurred;
+
+    if (!bbr_state->is_round_started)
+    {
+        bbr_state->is_round_started = true;
+        bbr_state->round_start_ns = now_ns;
+        bbr_state->round_start_position = ending_rebuild_position;
+
+        // the min RTT window is timed from the owning receiver's clock, or the first RTT measured if that came first
+        int64_t min_rtt_timestamp_ns;
+        AERON_GET_VOLATILE(min_rtt_timestamp_ns, bbr_state->min_rtt_timestamp_ns);
+        if (0 == min_rtt_timestamp_ns)
+        {
+            min_rtt_timestamp_ns = now_ns;
+            AERON_PUT_ORDERED(bbr_state->min_rtt_timestamp_ns, now_ns);
+        }
+        AERON_PUT_ORDERED(bbr_state->probe_rtt_start_ns, min_rtt_timestamp_ns);
+    }
+    else
+    {
+        const int64_t rtt_ns = aeron_bbr_congestion_control_strategy_rtt_ns(bbr_state);
+        const int64_t round_ns = rtt_ns > AERON_BBRCONGESTIONCONTROL_MIN_ROUND_NS ?
+            rtt_ns : AERON_BBRCONGESTIONCONTROL_MIN_ROUND_NS;
+
+        if (now_ns - bbr_state->round_start_ns >= round_ns)
+        {
+            aeron_bbr_congestion_control_strategy_on_round(bbr_state, now_ns, ending_rebuild_position);
+        }
+    }
+
+    // loss while probing for more bandwidth ends the probe early rather than shrinking the model
+    if (loss_occurred &&
+        AERON_BBRCONGESTIONCONTROL_MODE_PROBE_BW == bbr_state->mode &&
+        0 == bbr_state->cycle_index)
+    {
+        bbr_state->cycle_index = 1;
+    }
+
+    aeron_bbr_congestion_control_strategy_check_probe_rtt(bbr_state, now_ns);
+
+    const int32_t window_length = aeron_bbr_congestion_control_strategy_window_length(bbr_state);
+    if (AERON_BBRCONGESTIONCONTROL_MODE_PROBE_RTT != bbr_state->mode)
+    {
+        bbr_state->window_length = window_length;
+    }
+
+    aeron_counter_set_ordered(bbr_state->window_indicator.value_addr, window_length);
+
+    return window_length;
+}
+
+int32_t aeron_bbr_congestion_control_strategy_initial_window_length(void *state)
+{
+    return ((aeron_bbr_congestion_control_strategy_state_t *)state)->initial_window_length;
+}
+
+int32_t aeron_bbr_congestion_control_strategy_max_window_length(void *state)
+{
+    return ((aeron_bbr_congestion_control_strategy_state_t *)state)->max_window_length;
+}
+
+int aeron_bbr_congestion_control_strategy_fini(aeron_congestion_control_strategy_t *strategy)
+{
+    aeron_bbr_congestion_control_strategy_state_t *state = strategy->state;
+    aeron_counters_manager_free(state->counters_manager, state->rtt_indicator.counter_id);
+    aeron_counters_manager_free(state->counters_manager, state->bandwidth_indicator.counter_id);
+    aeron_counters_manager_free(state->counters_manager, state->window_indicator.counter_id);
+
+    aeron_free(strategy->state);
+    aeron_free(strategy);
+
+    return 0;
+}
+
+static int aeron_bbr_congestion_control_strategy_indicator_allocate(
+    aeron_position_t *indicator,
+    aeron_counters_manager_t *counters_manager,
+    const char *name,
+    aeron_udp_channel_t *channel,
+    int32_t stream_id,
+    int32_t session_id,
+    int64_t registration_id,
+    int64_t initial_value)
+{
+    const int32_t counter_id = aeron_stream_counter_allocate(
+        counters_manager,
+        name,
+        AERON_COUNTER_PER_IMAGE_TYPE_ID,
+        registration_id,
+        session_id,
+        stream_id,
+        channel->uri_length,
+        channel->original_uri,
+        "");
+    if (counter_id < 0)
+    {
+        return -1;
+    }
+
+    indicator->counter_id = counter_id;
+    indicator->value_addr = aeron_counters_manager_addr(counters_manager, counter_id);
+    aeron_counter_set_ordered(indicator->value_addr, initial_value);
+
+    return 0;
+}
+
+int aeron_bbr_congestion_control_strategy_supplier(
+    aeron_congestion_control_strategy_t **strategy,
+    aeron_udp_channel_t *channel,
+    int32_t stream_id,
+    int32_t session_id,
+    int64_t registration_id,
+    int32_t term_length,
+    int32_t sender_mtu_length,
+    struct sockaddr_storage *control_address,
+    struct sockaddr_storage *src_address,
+    aeron_driver_context_t *context,
+    aeron_counters_manager_t *counters_manager)
+{
+    aeron_congestion_control_strategy_t *_strategy;
+
+    if (aeron_alloc((void **)&_strategy, sizeof(aeron_congestion_control_strategy_t)) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_alloc(&_strategy->state, sizeof(aeron_bbr_congestion_control_strategy_state_t)) < 0)
+    {
+        aeron_free(_strategy);
+        return -1;
+    }
+
+    _strategy->should_measure_rtt = aeron_bbr_congestion_control_strategy_should_measure_rtt;
+    _strategy->on_rttm_sent = aeron_bbr_congestion_control_strategy_on_rttm_sent;
+    _strategy->on_rttm = aeron_bbr_congestion_control_strategy_on_rttm;
+    _strategy->on_track_rebuild = aeron_bbr_congestion_control_strategy_on_track_rebuild;
+    _strategy->initial_window_length = aeron_bbr_congestion_control_strategy_initial_window_length;
+    _strategy->max_window_length = aeron_bbr_congestion_control_strategy_max_window_length;
+    _strategy->fini = aeron_bbr_congestion_control_strategy_fini;
+
+    aeron_bbr_congestion_control_strategy_state_t *state = _strategy->state;
+    state->counters_manager = counters_manager;
+    state->rtt_indicator.counter_id = -1;
+    state->bandwidth_indicator.counter_id = -1;
+    state->window_indicator.counter_id = -1;
+
+    uint64_t initial_rtt_ns = AERON_BBRCONGESTIONCONTROL_INITIALRTT_DEFAULT;
+    char *const rtt_ns = getenv(AERON_BBRCONGESTIONCONTROL_INITIALRTT_ENV_VAR);
+    if (NULL != rtt_ns)
+    {
+        if (-1 == aeron_parse_duration_ns(rtt_ns, &initial_rtt_ns))
+        {
+            goto error_cleanup;
+        }
+    }
+
+    state->mode = AERON_BBRCONGESTIONCONTROL_MODE_STARTUP;
+    state->initial_rtt_ns = (int64_t)initial_rtt_ns;
+    state->min_rtt_ns = INT64_MAX;
+    state->min_rtt_timestamp_ns = 0;
+    state->probe_rtt_start_ns = 0;
+
+    state->mtu = sender_mtu_length;
+    const int32_t initial_window_length = (int32_t)aeron_udp_channel_receiver_window(
+        channel, context->initial_window_length);
+    state->max_window_length = (int32_t)aeron_receiver_window_length(initial_window_length, term_length);
+
+    const int32_t max_cwnd = state->max_window_length / sender_mtu_length;
+    const int32_t min_cwnd = max_cwnd > AERON_BBRCONGESTIONCONTROL_MIN_CWND ?
+        AERON_BBRCONGESTIONCONTROL_MIN_CWND : max_cwnd;
+    const int32_t init_cwnd = max_cwnd > AERON_BBRCONGESTIONCONTROL_INITCWND ?
+        AERON_BBRCONGESTIONCONTROL_INITCWND : max_cwnd;
+    state->min_window_length = min_cwnd * sender_mtu_length;
+    state->initial_window_length = init_cwnd * sender_mtu_length;
+    state->window_length = state->initial_window_length;
+    state->prior_window_length = state->initial_window_length;
+
+    if (aeron_bbr_congestion_control_strategy_indicator_allocate(
+        &state->rtt_indicator,
+        counters_manager,
+        AERON_BBRCONGESTIONCONTROL_RTT_INDICATOR_COUNTER_NAME,
+        channel,
+        stream_id,
+        session_id,
+        registration_id,
+        0) < 0 ||
+        aeron_bbr_congestion_control_strategy_indicator_allocate(
+        &state->bandwidth_indicator,
+        counters_manager,
+        AERON_BBRCONGESTIONCONTROL_BANDWIDTH_INDICATOR_COUNTER_NAME,
+        channel,
+        stream_id,
+        session_id,
+        registration_id,
+        0) < 0 ||
+        aeron_bbr_congestion_control_strategy_indicator_allocate(
+        &state->window_indicator,
+        counters_manager,
+        AERON_BBRCONGESTIONCONTROL_WINDOW_INDICATOR_COUNTER_NAME,
+        channel,
+        stream_id,
+        session_id,
+        registration_id,
+        state->initial_window_length) < 0)
+    {
+        goto error_cleanup;
+    }
+
+    *strategy = _strategy;
+    return 0;
+
+error_cleanup:
+    aeron_bbr_congestion_control_strategy_fini(_strategy);
+    return -1;
+}
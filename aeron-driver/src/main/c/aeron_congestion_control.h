@@ -23,10 +23,15 @@
 
 #define AERON_STATICWINDOWCONGESTIONCONTROL_CC_PARAM_VALUE ("static")
 #define AERON_CUBICCONGESTIONCONTROL_CC_PARAM_VALUE ("cubic")
+#define AERON_BBRCONGESTIONCONTROL_CC_PARAM_VALUE ("bbr")
 
 #define AERON_CUBICCONGESTIONCONTROL_RTT_INDICATOR_COUNTER_NAME ("rcv-cc-cubic-rtt")
 #define AERON_CUBICCONGESTIONCONTROL_WINDOW_INDICATOR_COUNTER_NAME ("rcv-cc-cubic-wnd")
 
+#define AERON_BBRCONGESTIONCONTROL_RTT_INDICATOR_COUNTER_NAME ("rcv-cc-bbr-rtt")
+#define AERON_BBRCONGESTIONCONTROL_BANDWIDTH_INDICATOR_COUNTER_NAME ("rcv-cc-bbr-bw")
+#define AERON_BBRCONGESTIONCONTROL_WINDOW_INDICATOR_COUNTER_NAME ("rcv-cc-bbr-wnd")
+
 typedef struct aeron_congestion_control_strategy_stct aeron_congestion_control_strategy_t;
 typedef struct aeron_driver_context_stct aeron_driver_context_t;
 typedef struct aeron_counters_manager_stct aeron_counters_manager_t;
@@ -111,4 +116,17 @@ int aeron_cubic_congestion_control_strategy_supplier(
     aeron_driver_context_t *context,
     aeron_counters_manager_t *counters_manager);
 
+int aeron_bbr_congestion_control_strategy_supplier(
+    aeron_congestion_control_strategy_t **strategy,
+    aeron_udp_channel_t *channel,
+    int32_t stream_id,
+    int32_t session_id,
+    int64_t registration_id,
+    int32_t term_length,
+    int32_t sender_mtu_length,
+    struct sockaddr_storage *control_address,
+    struct sockaddr_storage *src_address,
+    aeron_driver_context_t *context,
+    aeron_counters_manager_t *counters_manager);
+
 #endif //AERON_CONGESTION_CONTROL_H
@@ -359,7 +359,8 @@ int aeron_data_packet_dispatcher_on_data(
     aeron_data_header_t *header,
     uint8_t *buffer,
     size_t length,
-    struct sockaddr_storage *addr)
+    struct sockaddr_storage *addr,
+    struct timespec *media_receive_timestamp)
 {
     aeron_data_packet_dispatcher_stream_interest_t *stream_interest =
         aeron_int64_to_ptr_hash_map_get(&dispatcher->session_by_stream_id_map, header->stream_id);
@@ -373,7 +374,14 @@ int aeron_data_packet_dispatcher_on_data(
         if (NULL != image)
         {
             return aeron_publication_image_insert_packet(
-                image, destination, header->term_id, header->term_offset, buffer, length, addr);
+                image,
+                destination,
+                header->term_id,
+                header->term_offset,
+                buffer,
+                length,
+                addr,
+                media_receive_timestamp);
         }
         else if (!found && (header->frame_header.flags & AERON_DATA_HEADER_EOS_FLAG) == 0)
         {
@@ -466,7 +474,7 @@ int aeron_data_packet_dispatcher_on_setup(
                 if (destination->conductor_fields.udp_channel->is_multicast &&
                     destination->conductor_fields.udp_channel->multicast_ttl < header->ttl)
                 {
-                    aeron_counter_ordered_increment(endpoint->possible_ttl_asymmetry_counter, 1);
+                    aeron_counter_increment(endpoint->possible_ttl_asymmetry_counter, 1);
                 }
 
                 if (aeron_data_packet_dispatcher_create_publication(
@@ -545,6 +553,33 @@ int aeron_data_packet_dispatcher_on_rttm(
     return 0;
 }
 
+int aeron_data_packet_dispatcher_on_fec(
+    aeron_data_packet_dispatcher_t *dispatcher,
+    aeron_receive_channel_endpoint_t *endpoint,
+    aeron_receive_destination_t *destination,
+    aeron_fec_header_t *header,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr)
+{
+    aeron_data_packet_dispatcher_stream_interest_t *stream_interest =
+        aeron_int64_to_ptr_hash_map_get(&dispatcher->session_by_stream_id_map, header->stream_id);
+
+    if (NULL != stream_interest)
+    {
+        aeron_publication_image_t *image = NULL;
+        aeron_int64_to_tagged_ptr_hash_map_get(
+            &stream_interest->image_by_session_id_map, header->session_id, NULL, (void **)&image);
+
+        if (NULL != image)
+        {
+            return aeron_publication_image_on_fec(image, destination, header, length, addr);
+        }
+    }
+
+    return 0;
+}
+
 int aeron_data_packet_dispatcher_try_connect_stream(
     aeron_data_packet_dispatcher_t *dispatcher,
     aeron_receive_channel_endpoint_t *endpoint,
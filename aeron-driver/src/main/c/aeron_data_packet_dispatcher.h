@@ -88,7 +88,8 @@ int aeron_data_packet_dispatcher_on_data(
     aeron_data_header_t *header,
     uint8_t *buffer,
     size_t length,
-    struct sockaddr_storage *addr);
+    struct sockaddr_storage *addr,
+    struct timespec *media_receive_timestamp);
 
 int aeron_data_packet_dispatcher_on_setup(
     aeron_data_packet_dispatcher_t *dispatcher,
@@ -108,6 +109,15 @@ int aeron_data_packet_dispatcher_on_rttm(
     size_t length,
     struct sockaddr_storage *addr);
 
+int aeron_data_packet_dispatcher_on_fec(
+    aeron_data_packet_dispatcher_t *dispatcher,
+    aeron_receive_channel_endpoint_t *endpoint,
+    aeron_receive_destination_t *destination,
+    aeron_fec_header_t *header,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr);
+
 // Used by ATS
 int aeron_data_packet_dispatcher_try_connect_stream(
     aeron_data_packet_dispatcher_t *dispatcher,
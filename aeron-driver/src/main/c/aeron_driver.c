@@ -172,6 +172,80 @@ int aeron_report_existing_errors(aeron_mapped_file_t *cnc_map, const char *aeron
     return result;
 }
 
+static int aeron_driver_ensure_huge_pages_dir_is_recreated(aeron_driver_context_t *context)
+{
+    char name[AERON_MAX_PATH];
+    char dirname[AERON_MAX_PATH];
+    char filename[AERON_MAX_PATH];
+    const char *aeron_dir = context->aeron_dir;
+
+    if (NULL == context->huge_pages_dir)
+    {
+        return 0;
+    }
+
+    size_t name_end = strlen(aeron_dir);
+    while (name_end > 1 && ('/' == aeron_dir[name_end - 1] || '\\' == aeron_dir[name_end - 1]))
+    {
+        name_end--;
+    }
+
+    size_t name_start = name_end;
+    while (name_start > 0 && '/' != aeron_dir[name_start - 1] && '\\' != aeron_dir[name_start - 1])
+    {
+        name_start--;
+    }
+
+    // aeron dirs sharing a basename must not share, and so delete, each other's huge pages dir
+    const uint64_t aeron_dir_hash = aeron_fnv_64a_buf((uint8_t *)aeron_dir, name_end);
+    snprintf(
+        name,
+        sizeof(name),
+        "%.*s-%016" PRIx64,
+        (int)(name_end - name_start),
+        aeron_dir + name_start,
+        aeron_dir_hash);
+    if (aeron_file_resolve(context->huge_pages_dir, name, dirname, sizeof(dirname)) < 0)
+    {
+        AERON_APPEND_ERR("%s", "Unable to get huge pages directory filename");
+        return -1;
+    }
+
+    if (aeron_is_directory(dirname) && aeron_delete_directory(dirname) != 0)
+    {
+        AERON_SET_ERR(errno, "Failed to delete huge pages directory: %s", dirname);
+        return -1;
+    }
+
+    if (aeron_mkdir(dirname, S_IRWXU | S_IRWXG | S_IRWXO) != 0)
+    {
+        AERON_SET_ERR(errno, "Failed to mkdir huge pages directory: %s", dirname);
+        return -1;
+    }
+
+    const char *subdirs[] = { AERON_PUBLICATIONS_DIR, AERON_IMAGES_DIR };
+    for (size_t i = 0; i < sizeof(subdirs) / sizeof(subdirs[0]); i++)
+    {
+        if (aeron_file_resolve(dirname, subdirs[i], filename, sizeof(filename)) < 0 ||
+            aeron_mkdir(filename, S_IRWXU | S_IRWXG | S_IRWXO) != 0)
+        {
+            AERON_SET_ERR(errno, "Failed to mkdir huge pages %s directory: %s", subdirs[i], dirname);
+            return -1;
+        }
+    }
+
+    size_t dirname_length = strlen(dirname);
+    aeron_free(context->huge_pages_log_dir);
+    if (aeron_alloc((void **)&context->huge_pages_log_dir, dirname_length + 1) < 0)
+    {
+        AERON_APPEND_ERR("%s", "Unable to allocate huge pages directory");
+        return -1;
+    }
+    memcpy(context->huge_pages_log_dir, dirname, dirname_length + 1);
+
+    return 0;
+}
+
 int aeron_driver_ensure_dir_is_recreated(aeron_driver_context_t *context)
 {
     char filename[AERON_MAX_PATH];
@@ -274,7 +348,7 @@ int aeron_driver_ensure_dir_is_recreated(aeron_driver_context_t *context)
         return -1;
     }
 
-    return 0;
+    return aeron_driver_ensure_huge_pages_dir_is_recreated(context);
 }
 
 void aeron_driver_fill_cnc_metadata(aeron_driver_context_t *context)
@@ -368,6 +442,36 @@ int aeron_driver_create_loss_report_file(aeron_driver_t *driver)
     return 0;
 }
 
+int aeron_driver_create_latency_report_file(aeron_driver_t *driver)
+{
+    char buffer[AERON_MAX_PATH];
+
+    driver->context->latency_report.addr = NULL;
+    driver->context->latency_report.length = 0;
+
+    if (!driver->context->latency_report_enabled)
+    {
+        return 0;
+    }
+
+    driver->context->latency_report.length =
+        AERON_ALIGN(driver->context->latency_report_length, driver->context->file_page_size);
+
+    if (aeron_latency_reporter_resolve_filename(driver->context->aeron_dir, buffer, sizeof(buffer)) < 0)
+    {
+        AERON_APPEND_ERR("%s", "Unable to get latency report filename");
+        return -1;
+    }
+
+    if (aeron_map_new_file(&driver->context->latency_report, buffer, true) < 0)
+    {
+        AERON_APPEND_ERR("could not map latency report file: %s", buffer);
+        return -1;
+    }
+
+    return 0;
+}
+
 int aeron_driver_validate_sufficient_socket_buffer_lengths(aeron_driver_t *driver)
 {
     int result = -1;
@@ -508,6 +612,40 @@ int aeron_driver_validate_page_size(aeron_driver_t *driver)
     return 0;
 }
 
+static int aeron_driver_validate_huge_pages(aeron_driver_t *driver)
+{
+    aeron_driver_context_t *context = driver->context;
+
+    if (NULL == context->huge_pages_dir)
+    {
+        if (context->term_buffer_huge_pages)
+        {
+            AERON_SET_ERR(
+                EINVAL, "%s requires %s to be set", AERON_TERM_BUFFER_HUGE_PAGES_ENV_VAR, AERON_HUGE_PAGES_DIR_ENV_VAR);
+            return -1;
+        }
+
+        return 0;
+    }
+
+    if (aeron_driver_validate_value_range(
+        context->huge_page_size, AERON_PAGE_MIN_SIZE, AERON_PAGE_MAX_SIZE, "huge_page_size") < 0)
+    {
+        return -1;
+    }
+
+    if (!AERON_IS_POWER_OF_TWO(context->huge_page_size))
+    {
+        AERON_SET_ERR(
+            EINVAL,
+            "Huge page size not a power of 2: huge page size=%" PRIu64,
+            (uint64_t)context->huge_page_size);
+        return -1;
+    }
+
+    return 0;
+}
+
 const char *aeron_driver_threading_mode_to_string(aeron_threading_mode_t mode)
 {
     switch (mode)
@@ -542,6 +680,10 @@ void aeron_driver_context_print_configuration(aeron_driver_context_t *context)
     fprintf(fpout, "\n    dirs_delete_on_shutdown=%d", context->dirs_delete_on_shutdown);
     fprintf(fpout, "\n    warn_if_dirs_exists=%d", context->warn_if_dirs_exist);
     fprintf(fpout, "\n    term_buffer_sparse_file=%d", context->term_buffer_sparse_file);
+    fprintf(fpout, "\n    term_buffer_huge_pages=%d", context->term_buffer_huge_pages);
+    fprintf(fpout, "\n    huge_pages_dir=%s", NULL != context->huge_pages_dir ? context->huge_pages_dir : "");
+    fprintf(fpout, "\n    term_buffer_clean_non_temporal=%d", context->term_buffer_clean_non_temporal);
+    fprintf(fpout, "\n    term_buffer_cleaner_thread=%d", context->term_buffer_cleaner_thread);
     fprintf(fpout, "\n    perform_storage_checks=%d", context->perform_storage_checks);
     fprintf(fpout, "\n    spies_simulate_connection=%d", context->spies_simulate_connection);
     fprintf(fpout, "\n    reliable_stream=%d", context->reliable_stream);
@@ -584,24 +726,47 @@ void aeron_driver_context_print_configuration(aeron_driver_context_t *context)
     fprintf(fpout, "\n    socket_sndbuf_length=%" PRIu64, (uint64_t)context->socket_sndbuf);
     fprintf(fpout, "\n    socket_rcvbuf_length=%" PRIu64, (uint64_t)context->socket_rcvbuf);
     fprintf(fpout, "\n    multicast_ttl=%" PRIu8, context->multicast_ttl);
+    fprintf(fpout, "\n    socket_gso_enabled=%d", context->socket_gso_enabled);
+    fprintf(fpout, "\n    socket_gro_enabled=%d", context->socket_gro_enabled);
+    fprintf(fpout, "\n    receiver_zero_copy_enabled=%d", context->receiver_zero_copy_enabled);
     fprintf(fpout, "\n    mtu_length=%" PRIu64, (uint64_t)context->mtu_length);
     fprintf(fpout, "\n    ipc_mtu_length=%" PRIu64, (uint64_t)context->ipc_mtu_length);
     fprintf(fpout, "\n    file_page_size=%" PRIu64, (uint64_t)context->file_page_size);
+    fprintf(fpout, "\n    huge_page_size=%" PRIu64, (uint64_t)context->huge_page_size);
     fprintf(fpout, "\n    low_file_store_warning_threshold=%" PRIu64, (uint64_t)context->low_file_store_warning_threshold);
     fprintf(fpout, "\n    publication_reserved_session_id_low=%" PRId32, context->publication_reserved_session_id_low);
     fprintf(fpout, "\n    publication_reserved_session_id_high=%" PRId32, context->publication_reserved_session_id_high);
     fprintf(fpout, "\n    loss_report_length=%" PRIu64, (uint64_t)context->loss_report_length);
+    fprintf(fpout, "\n    latency_report_enabled=%d", context->latency_report_enabled);
+    fprintf(fpout, "\n    latency_report_length=%" PRIu64, (uint64_t)context->latency_report_length);
+    fprintf(fpout, "\n    latency_report_sample_interval_ns=%" PRIu64, context->latency_report_sample_interval_ns);
     fprintf(fpout, "\n    send_to_sm_poll_ratio=%" PRIu64, (uint64_t)context->send_to_sm_poll_ratio);
     fprintf(fpout, "\n    receiver_io_vector_capacity=%" PRIu64, (uint64_t)context->receiver_io_vector_capacity);
     fprintf(fpout, "\n    sender_io_vector_capacity=%" PRIu64, (uint64_t)context->sender_io_vector_capacity);
     fprintf(
         fpout, "\n    network_publication_max_messages_per_send=%" PRIu64,
         (uint64_t)context->network_publication_max_messages_per_send);
+    fprintf(
+        fpout, "\n    network_publication_adaptive_messages_per_send=%d",
+        context->network_publication_adaptive_messages_per_send);
     fprintf(fpout, "\n    resource_free_limit=%" PRIu32, context->resource_free_limit);
     fprintf(fpout, "\n    async_executor_threads=%" PRIu32, context->async_executor_threads);
+    fprintf(fpout, "\n    log_buffer_pool_size=%" PRIu32, context->log_buffer_pool_size);
     fprintf(fpout, "\n    conductor_cpu_affinity_no=%" PRId32, context->conductor_cpu_affinity_no);
     fprintf(fpout, "\n    receiver_cpu_affinity_no=%" PRId32, context->receiver_cpu_affinity_no);
+    fprintf(fpout, "\n    receiver_count=%" PRIu32, context->receiver_count);
+    fprintf(fpout, "\n    receiver_cpu_affinity_list=");
+    for (size_t i = 0; i < context->receiver_count; i++)
+    {
+        fprintf(fpout, "%s%" PRId32, 0 == i ? "" : ",", context->receiver_cpu_affinity_list[i]);
+    }
     fprintf(fpout, "\n    sender_cpu_affinity_no=%" PRId32, context->sender_cpu_affinity_no);
+    fprintf(fpout, "\n    sender_count=%" PRIu32, context->sender_count);
+    fprintf(fpout, "\n    sender_cpu_affinity_list=");
+    for (size_t i = 0; i < context->sender_count; i++)
+    {
+        fprintf(fpout, "%s%" PRId32, 0 == i ? "" : ",", context->sender_cpu_affinity_list[i]);
+    }
 
     fprintf(fpout, "\n    epoch_clock=%s",
         aeron_dlinfo_func((aeron_fptr_t)context->epoch_clock, buffer, sizeof(buffer)));
@@ -732,8 +897,14 @@ int aeron_driver_shared_do_work(void *clientd)
     int sum = 0;
 
     sum += aeron_driver_conductor_do_work(&driver->conductor);
-    sum += aeron_driver_sender_do_work(&driver->sender);
-    sum += aeron_driver_receiver_do_work(&driver->receiver);
+    for (uint32_t i = 0; i < driver->context->sender_count; i++)
+    {
+        sum += aeron_driver_sender_do_work(&driver->senders[i]);
+    }
+    for (uint32_t i = 0; i < driver->context->receiver_count; i++)
+    {
+        sum += aeron_driver_receiver_do_work(&driver->receivers[i]);
+    }
 
     return sum;
 }
@@ -743,8 +914,14 @@ void aeron_driver_shared_on_close(void *clientd)
     aeron_driver_t *driver = (aeron_driver_t *)clientd;
 
     aeron_driver_conductor_on_close(&driver->conductor);
-    aeron_driver_sender_on_close(&driver->sender);
-    aeron_driver_receiver_on_close(&driver->receiver);
+    for (uint32_t i = 0; i < driver->context->sender_count; i++)
+    {
+        aeron_driver_sender_on_close(&driver->senders[i]);
+    }
+    for (uint32_t i = 0; i < driver->context->receiver_count; i++)
+    {
+        aeron_driver_receiver_on_close(&driver->receivers[i]);
+    }
 }
 
 int aeron_driver_shared_network_do_work(void *clientd)
@@ -752,8 +929,14 @@ int aeron_driver_shared_network_do_work(void *clientd)
     aeron_driver_t *driver = (aeron_driver_t *)clientd;
     int sum = 0;
 
-    sum += aeron_driver_sender_do_work(&driver->sender);
-    sum += aeron_driver_receiver_do_work(&driver->receiver);
+    for (uint32_t i = 0; i < driver->context->sender_count; i++)
+    {
+        sum += aeron_driver_sender_do_work(&driver->senders[i]);
+    }
+    for (uint32_t i = 0; i < driver->context->receiver_count; i++)
+    {
+        sum += aeron_driver_receiver_do_work(&driver->receivers[i]);
+    }
 
     return sum;
 }
@@ -762,8 +945,14 @@ void aeron_driver_shared_network_on_close(void *clientd)
 {
     aeron_driver_t *driver = (aeron_driver_t *)clientd;
 
-    aeron_driver_sender_on_close(&driver->sender);
-    aeron_driver_receiver_on_close(&driver->receiver);
+    for (uint32_t i = 0; i < driver->context->sender_count; i++)
+    {
+        aeron_driver_sender_on_close(&driver->senders[i]);
+    }
+    for (uint32_t i = 0; i < driver->context->receiver_count; i++)
+    {
+        aeron_driver_receiver_on_close(&driver->receivers[i]);
+    }
 }
 
 int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
@@ -802,7 +991,7 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
         goto error;
     }
 
-    if (aeron_driver_validate_page_size(_driver) < 0)
+    if (aeron_driver_validate_page_size(_driver) < 0 || aeron_driver_validate_huge_pages(_driver) < 0)
     {
         goto error;
     }
@@ -888,6 +1077,11 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
         goto error;
     }
 
+    if (aeron_driver_create_latency_report_file(_driver) < 0)
+    {
+        goto error;
+    }
+
     if (aeron_driver_validate_unblock_timeout(_driver->context) < 0)
     {
         goto error;
@@ -908,21 +1102,39 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
         goto error;
     }
 
-    if (aeron_driver_sender_init(
-        &_driver->sender, context, &_driver->conductor.system_counters, &_driver->conductor.error_log) < 0)
+    for (uint32_t i = 0; i < context->sender_count; i++)
     {
-        goto error;
+        if (aeron_driver_sender_init(
+            &_driver->senders[i],
+            context,
+            &_driver->conductor.system_counters,
+            &_driver->conductor.error_log,
+            i) < 0)
+        {
+            goto error;
+        }
+
+        _driver->context->sender_proxies[i] = &_driver->senders[i].sender_proxy;
     }
 
-    _driver->context->sender_proxy = &_driver->sender.sender_proxy;
+    _driver->context->sender_proxy = _driver->context->sender_proxies[0];
 
-    if (aeron_driver_receiver_init(
-        &_driver->receiver, context, &_driver->conductor.system_counters, &_driver->conductor.error_log) < 0)
+    for (uint32_t i = 0; i < context->receiver_count; i++)
     {
-        goto error;
+        if (aeron_driver_receiver_init(
+            &_driver->receivers[i],
+            context,
+            &_driver->conductor.system_counters,
+            &_driver->conductor.error_log,
+            i) < 0)
+        {
+            goto error;
+        }
+
+        _driver->context->receiver_proxies[i] = &_driver->receivers[i].receiver_proxy;
     }
 
-    _driver->context->receiver_proxy = &_driver->receiver.receiver_proxy;
+    _driver->context->receiver_proxy = _driver->context->receiver_proxies[0];
 
     aeron_counter_set_ordered(
         aeron_system_counter_addr(context->system_counters, AERON_SYSTEM_COUNTER_AERON_VERSION),
@@ -930,7 +1142,8 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
 
     aeron_counter_set_ordered(
         aeron_system_counter_addr(context->system_counters, AERON_SYSTEM_COUNTER_BYTES_CURRENTLY_MAPPED),
-        (int64_t)(_driver->context->cnc_map.length + _driver->context->loss_report_length));
+        (int64_t)(_driver->context->cnc_map.length + _driver->context->loss_report_length +
+            _driver->context->latency_report.length));
 
     if (aeron_feedback_delay_state_init(
         &_driver->context->unicast_delay_feedback_generator,
@@ -1027,32 +1240,78 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
                 goto error;
             }
 
-            if (aeron_agent_init(
-                &_driver->runners[AERON_AGENT_RUNNER_SENDER],
-                "sender",
-                &_driver->sender,
-                _driver->context->agent_on_start_func,
-                _driver->context->agent_on_start_state,
-                aeron_driver_sender_do_work,
-                aeron_driver_sender_on_close,
-                _driver->context->sender_idle_strategy_func,
-                _driver->context->sender_idle_strategy_state) < 0)
+            _driver->sender_idle_strategy_states[0] = _driver->context->sender_idle_strategy_state;
+            for (uint32_t i = 0; i < _driver->context->sender_count; i++)
             {
-                goto error;
+                char role_name[32];
+                if (0 == i)
+                {
+                    snprintf(role_name, sizeof(role_name), "sender");
+                }
+                else
+                {
+                    snprintf(role_name, sizeof(role_name), "sender-%" PRIu32, i);
+
+                    if (NULL == aeron_idle_strategy_load(
+                        _driver->context->sender_idle_strategy_name,
+                        &_driver->sender_idle_strategy_states[i],
+                        AERON_SENDER_IDLE_STRATEGY_ENV_VAR,
+                        _driver->context->sender_idle_strategy_init_args))
+                    {
+                        goto error;
+                    }
+                }
+
+                if (aeron_agent_init(
+                    &_driver->runners[AERON_AGENT_RUNNER_SENDER + i],
+                    role_name,
+                    &_driver->senders[i],
+                    _driver->context->agent_on_start_func,
+                    _driver->context->agent_on_start_state,
+                    aeron_driver_sender_do_work,
+                    aeron_driver_sender_on_close,
+                    _driver->context->sender_idle_strategy_func,
+                    _driver->sender_idle_strategy_states[i]) < 0)
+                {
+                    goto error;
+                }
             }
 
-            if (aeron_agent_init(
-                &_driver->runners[AERON_AGENT_RUNNER_RECEIVER],
-                "receiver",
-                &_driver->receiver,
-                _driver->context->agent_on_start_func,
-                _driver->context->agent_on_start_state,
-                aeron_driver_receiver_do_work,
-                aeron_driver_receiver_on_close,
-                _driver->context->receiver_idle_strategy_func,
-                _driver->context->receiver_idle_strategy_state) < 0)
+            _driver->receiver_idle_strategy_states[0] = _driver->context->receiver_idle_strategy_state;
+            for (uint32_t i = 0; i < _driver->context->receiver_count; i++)
             {
-                goto error;
+                char role_name[32];
+                if (0 == i)
+                {
+                    snprintf(role_name, sizeof(role_name), "receiver");
+                }
+                else
+                {
+                    snprintf(role_name, sizeof(role_name), "receiver-%" PRIu32, i);
+
+                    if (NULL == aeron_idle_strategy_load(
+                        _driver->context->receiver_idle_strategy_name,
+                        &_driver->receiver_idle_strategy_states[i],
+                        AERON_RECEIVER_IDLE_STRATEGY_ENV_VAR,
+                        _driver->context->receiver_idle_strategy_init_args))
+                    {
+                        goto error;
+                    }
+                }
+
+                if (aeron_agent_init(
+                    &_driver->runners[AERON_AGENT_RUNNER_RECEIVER + i],
+                    role_name,
+                    &_driver->receivers[i],
+                    _driver->context->agent_on_start_func,
+                    _driver->context->agent_on_start_state,
+                    aeron_driver_receiver_do_work,
+                    aeron_driver_receiver_on_close,
+                    _driver->context->receiver_idle_strategy_func,
+                    _driver->receiver_idle_strategy_states[i]) < 0)
+                {
+                    goto error;
+                }
             }
             break;
     }
@@ -1160,6 +1419,16 @@ int aeron_driver_close(aeron_driver_t *driver)
         }
     }
 
+    for (int i = 1; i < AERON_DRIVER_SENDER_COUNT_MAX; i++)
+    {
+        aeron_free(driver->sender_idle_strategy_states[i]);
+    }
+
+    for (int i = 1; i < AERON_DRIVER_RECEIVER_COUNT_MAX; i++)
+    {
+        aeron_free(driver->receiver_idle_strategy_states[i]);
+    }
+
     aeron_free(driver);
 
     return 0;
@@ -24,17 +24,19 @@
 
 #define AERON_AGENT_RUNNER_CONDUCTOR 0
 #define AERON_AGENT_RUNNER_SENDER 1
-#define AERON_AGENT_RUNNER_RECEIVER 2
+#define AERON_AGENT_RUNNER_RECEIVER (AERON_AGENT_RUNNER_SENDER + AERON_DRIVER_SENDER_COUNT_MAX)
 #define AERON_AGENT_RUNNER_SHARED_NETWORK 1
 #define AERON_AGENT_RUNNER_SHARED 0
-#define AERON_AGENT_RUNNER_MAX 3
+#define AERON_AGENT_RUNNER_MAX (AERON_AGENT_RUNNER_RECEIVER + AERON_DRIVER_RECEIVER_COUNT_MAX)
 
 typedef struct aeron_driver_stct
 {
     aeron_driver_context_t *context;
     aeron_driver_conductor_t conductor;
-    aeron_driver_sender_t sender;
-    aeron_driver_receiver_t receiver;
+    aeron_driver_sender_t senders[AERON_DRIVER_SENDER_COUNT_MAX];
+    void *sender_idle_strategy_states[AERON_DRIVER_SENDER_COUNT_MAX];
+    aeron_driver_receiver_t receivers[AERON_DRIVER_RECEIVER_COUNT_MAX];
+    void *receiver_idle_strategy_states[AERON_DRIVER_RECEIVER_COUNT_MAX];
     aeron_agent_runner_t runners[AERON_AGENT_RUNNER_MAX];
 }
 aeron_driver_t;
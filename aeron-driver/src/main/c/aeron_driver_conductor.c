@@ -38,6 +38,7 @@
 #include "collections/aeron_bit_set.h"
 #include "uri/aeron_uri.h"
 #include "util/aeron_parse_util.h"
+#include "util/aeron_strutil.h"
 
 
 #define STATIC_BIT_SET_U64_LEN (512u)
@@ -109,7 +110,7 @@ static inline bool aeron_driver_conductor_has_network_subscription_interest(
     return false;
 }
 
-static inline bool aeron_driver_conductor_is_oldest_subscription_sparse(
+static inline aeron_subscription_link_t *aeron_driver_conductor_oldest_subscription(
     aeron_driver_conductor_t *conductor,
     const aeron_receive_channel_endpoint_t *endpoint,
     int32_t stream_id,
@@ -117,7 +118,7 @@ static inline bool aeron_driver_conductor_is_oldest_subscription_sparse(
     int64_t highest_id)
 {
     int64_t registration_id = highest_id;
-    bool is_sparse = conductor->context->term_buffer_sparse_file;
+    aeron_subscription_link_t *oldest_link = NULL;
 
     for (size_t i = 0, length = conductor->network_subscriptions.length; i < length; i++)
     {
@@ -127,11 +128,11 @@ static inline bool aeron_driver_conductor_is_oldest_subscription_sparse(
             link->registration_id < registration_id)
         {
             registration_id = link->registration_id;
-            is_sparse = link->is_sparse;
+            oldest_link = link;
         }
     }
 
-    return is_sparse;
+    return oldest_link;
 }
 
 static bool aeron_driver_conductor_has_clashing_subscription(
@@ -574,6 +575,11 @@ static int aeron_time_tracking_name_resolver_close(aeron_name_resolver_t *resolv
     return 0;
 }
 
+static void aeron_driver_conductor_on_raw_log_pool_error(void *clientd, int errcode, const char *description)
+{
+    aeron_driver_conductor_log_explicit_error((aeron_driver_conductor_t *)clientd, errcode, description);
+}
+
 int aeron_driver_conductor_init(aeron_driver_conductor_t *conductor, aeron_driver_context_t *context)
 {
     if (aeron_mpsc_rb_init(
@@ -630,11 +636,47 @@ int aeron_driver_conductor_init(aeron_driver_conductor_t *conductor, aeron_drive
         return -1;
     }
 
+    if (aeron_int64_counter_map_init(
+        &conductor->client_index_by_id_map, AERON_NULL_VALUE, 64, AERON_MAP_DEFAULT_LOAD_FACTOR) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_int64_to_ptr_hash_map_init(
+        &conductor->ipc_publication_by_id_map, 64, AERON_MAP_DEFAULT_LOAD_FACTOR) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_int64_to_ptr_hash_map_init(
+        &conductor->ipc_publication_by_stream_id_map, 64, AERON_MAP_DEFAULT_LOAD_FACTOR) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_int64_to_ptr_hash_map_init(
+        &conductor->network_publication_by_id_map, 64, AERON_MAP_DEFAULT_LOAD_FACTOR) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_int64_to_ptr_hash_map_init(
+        &conductor->publication_image_by_id_map, 64, AERON_MAP_DEFAULT_LOAD_FACTOR) < 0)
+    {
+        return -1;
+    }
+
     if (aeron_loss_reporter_init(&conductor->loss_reporter, context->loss_report.addr, context->loss_report.length) < 0)
     {
         return -1;
     }
 
+    if (aeron_latency_reporter_init(
+        &conductor->latency_reporter, context->latency_report.addr, context->latency_report.length) < 0)
+    {
+        return -1;
+    }
+
     conductor->conductor_proxy.command_queue = &context->conductor_command_queue;
     conductor->conductor_proxy.fail_counter = aeron_counters_manager_addr(
         &conductor->counters_manager, AERON_SYSTEM_COUNTER_CONDUCTOR_PROXY_FAILS);
@@ -645,7 +687,41 @@ int aeron_driver_conductor_init(aeron_driver_conductor_t *conductor, aeron_drive
     {
         return -1;
     }
+
+    if (context->log_buffer_pool_size > 0)
+    {
+        const uint64_t term_lengths[] = { context->term_buffer_length, context->ipc_term_buffer_length };
+        if (aeron_raw_log_pool_init(
+            &conductor->raw_log_pool,
+            context->aeron_dir,
+            context->log_buffer_pool_size,
+            term_lengths,
+            sizeof(term_lengths) / sizeof(term_lengths[0]),
+            context->file_page_size,
+            &conductor->executor,
+            aeron_driver_conductor_on_raw_log_pool_error,
+            conductor) < 0)
+        {
+            AERON_APPEND_ERR("%s", "");
+            return -1;
+        }
+        context->raw_log_pool = &conductor->raw_log_pool;
+    }
+
+    if (context->term_buffer_cleaner_thread)
+    {
+        if (aeron_term_cleaner_init(&conductor->term_cleaner) < 0 ||
+            aeron_term_cleaner_start(&conductor->term_cleaner) < 0)
+        {
+            AERON_APPEND_ERR("%s", "");
+            return -1;
+        }
+        context->term_cleaner = &conductor->term_cleaner;
+    }
     conductor->async_client_command_in_flight = false;
+    conductor->pending_batch.buffer = NULL;
+    conductor->pending_batch.response = NULL;
+    conductor->pending_batch.current_result = NULL;
 
     conductor->clients.array = NULL;
     conductor->clients.capacity = 0;
@@ -883,18 +959,7 @@ int aeron_driver_conductor_init(aeron_driver_conductor_t *conductor, aeron_drive
 
 int aeron_driver_conductor_find_client(aeron_driver_conductor_t *conductor, int64_t client_id)
 {
-    int index = -1;
-
-    for (int i = (int)conductor->clients.length - 1; i >= 0; i--)
-    {
-        if (client_id == conductor->clients.array[i].client_id)
-        {
-            index = i;
-            break;
-        }
-    }
-
-    return index;
+    return (int)aeron_int64_counter_map_get(&conductor->client_index_by_id_map, client_id);
 }
 
 aeron_client_t *aeron_driver_conductor_get_or_add_client(aeron_driver_conductor_t *conductor, int64_t client_id)
@@ -919,6 +984,14 @@ aeron_client_t *aeron_driver_conductor_get_or_add_client(aeron_driver_conductor_
 
             if (client_heartbeat.counter_id >= 0)
             {
+                if (aeron_int64_counter_map_put(
+                    &conductor->client_index_by_id_map, client_id, (int64_t)conductor->clients.length, NULL) < 0)
+                {
+                    aeron_int64_counter_map_remove(&conductor->client_index_by_id_map, client_id);
+                    aeron_counters_manager_free(&conductor->counters_manager, client_heartbeat.counter_id);
+                    return NULL;
+                }
+
                 aeron_counters_manager_counter_registration_id(
                     &conductor->counters_manager, client_heartbeat.counter_id, client_id);
 
@@ -1135,8 +1208,48 @@ void aeron_driver_conductor_log_error(aeron_driver_conductor_t *conductor)
     aeron_driver_conductor_log_explicit_error(conductor, aeron_errcode(), aeron_errmsg());
 }
 
+static aeron_latency_reporter_entry_offset_t aeron_driver_conductor_create_latency_entry(
+    aeron_driver_conductor_t *conductor,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    int32_t hop,
+    aeron_udp_channel_t *udp_channel)
+{
+    aeron_latency_reporter_entry_offset_t offset = aeron_latency_reporter_create_entry(
+        &conductor->latency_reporter,
+        registration_id,
+        session_id,
+        stream_id,
+        hop,
+        udp_channel->original_uri,
+        udp_channel->uri_length);
+
+    if (offset < 0)
+    {
+        AERON_APPEND_ERR(
+            "latency report full, hop=%s registration_id=%" PRId64,
+            aeron_latency_report_hop_name(hop),
+            registration_id);
+        aeron_driver_conductor_log_error(conductor);
+    }
+
+    return offset;
+}
+
 void aeron_client_delete(aeron_driver_conductor_t *conductor, aeron_client_t *client)
 {
+    // The last client is about to be moved into this slot by the fast unordered remove, so its index moves with it.
+    const int64_t index = (int64_t)(client - conductor->clients.array);
+    const int64_t last_index = (int64_t)conductor->clients.length - 1;
+
+    aeron_int64_counter_map_remove(&conductor->client_index_by_id_map, client->client_id);
+    if (index != last_index)
+    {
+        aeron_int64_counter_map_put(
+            &conductor->client_index_by_id_map, conductor->clients.array[last_index].client_id, index, NULL);
+    }
+
     for (size_t i = 0; i < client->publication_links.length; i++)
     {
         aeron_driver_managed_resource_t *resource = client->publication_links.array[i].resource;
@@ -1320,6 +1433,120 @@ void aeron_driver_conductor_on_available_image(
     }
 }
 
+static int aeron_driver_conductor_index_ipc_publication(
+    aeron_driver_conductor_t *conductor, aeron_ipc_publication_t *publication)
+{
+    const int64_t stream_key = (int64_t)publication->stream_id;
+    publication->conductor_fields.next_in_stream = aeron_int64_to_ptr_hash_map_get(
+        &conductor->ipc_publication_by_stream_id_map, stream_key);
+
+    if (aeron_int64_to_ptr_hash_map_put(&conductor->ipc_publication_by_stream_id_map, stream_key, publication) < 0 ||
+        aeron_int64_to_ptr_hash_map_put(
+            &conductor->ipc_publication_by_id_map,
+            publication->conductor_fields.managed_resource.registration_id,
+            publication) < 0)
+    {
+        AERON_APPEND_ERR("%s", "failed to index ipc publication");
+        return -1;
+    }
+
+    return 0;
+}
+
+static void aeron_driver_conductor_unindex_ipc_publication(
+    aeron_driver_conductor_t *conductor, aeron_ipc_publication_t *publication)
+{
+    const int64_t stream_key = (int64_t)publication->stream_id;
+    aeron_ipc_publication_t *next = publication->conductor_fields.next_in_stream;
+    aeron_ipc_publication_t *head = aeron_int64_to_ptr_hash_map_get(
+        &conductor->ipc_publication_by_stream_id_map, stream_key);
+
+    aeron_int64_to_ptr_hash_map_remove(
+        &conductor->ipc_publication_by_id_map, publication->conductor_fields.managed_resource.registration_id);
+
+    if (publication == head)
+    {
+        if (NULL == next)
+        {
+            aeron_int64_to_ptr_hash_map_remove(&conductor->ipc_publication_by_stream_id_map, stream_key);
+        }
+        else
+        {
+            aeron_int64_to_ptr_hash_map_put(&conductor->ipc_publication_by_stream_id_map, stream_key, next);
+        }
+    }
+    else
+    {
+        for (aeron_ipc_publication_t *prev = head; NULL != prev; prev = prev->conductor_fields.next_in_stream)
+        {
+            if (publication == prev->conductor_fields.next_in_stream)
+            {
+                prev->conductor_fields.next_in_stream = next;
+                break;
+            }
+        }
+    }
+
+    publication->conductor_fields.next_in_stream = NULL;
+}
+
+static int aeron_driver_conductor_index_network_publication(
+    aeron_driver_conductor_t *conductor, aeron_network_publication_t *publication)
+{
+    aeron_int64_to_ptr_hash_map_t *stream_map = &publication->endpoint->conductor_fields.publication_by_stream_id_map;
+    const int64_t stream_key = (int64_t)publication->stream_id;
+    publication->conductor_fields.next_in_stream = aeron_int64_to_ptr_hash_map_get(stream_map, stream_key);
+
+    if (aeron_int64_to_ptr_hash_map_put(stream_map, stream_key, publication) < 0 ||
+        aeron_int64_to_ptr_hash_map_put(
+            &conductor->network_publication_by_id_map,
+            publication->conductor_fields.managed_resource.registration_id,
+            publication) < 0)
+    {
+        AERON_APPEND_ERR("%s", "failed to index network publication");
+        return -1;
+    }
+
+    return 0;
+}
+
+static void aeron_driver_conductor_unindex_network_publication(
+    aeron_driver_conductor_t *conductor, aeron_network_publication_t *publication)
+{
+    aeron_int64_to_ptr_hash_map_t *stream_map = &publication->endpoint->conductor_fields.publication_by_stream_id_map;
+    const int64_t stream_key = (int64_t)publication->stream_id;
+    aeron_network_publication_t *next = publication->conductor_fields.next_in_stream;
+    aeron_network_publication_t *head = aeron_int64_to_ptr_hash_map_get(stream_map, stream_key);
+
+    aeron_int64_to_ptr_hash_map_remove(
+        &conductor->network_publication_by_id_map, publication->conductor_fields.managed_resource.registration_id);
+
+    if (publication == head)
+    {
+        if (NULL == next)
+        {
+            aeron_int64_to_ptr_hash_map_remove(stream_map, stream_key);
+        }
+        else
+        {
+            aeron_int64_to_ptr_hash_map_put(stream_map, stream_key, next);
+        }
+    }
+    else
+    {
+        for (aeron_network_publication_t *prev = head; NULL != prev; prev = prev->conductor_fields.next_in_stream)
+        {
+            if (publication == prev->conductor_fields.next_in_stream)
+            {
+                prev->conductor_fields.next_in_stream = next;
+                break;
+            }
+        }
+    }
+
+    publication->conductor_fields.next_in_stream = NULL;
+}
+
 void aeron_ipc_publication_entry_on_time_event(
     aeron_driver_conductor_t *conductor, aeron_ipc_publication_entry_t *entry, int64_t now_ns, int64_t now_ms)
 {
@@ -1335,6 +1562,7 @@ bool aeron_ipc_publication_entry_has_reached_end_of_life(
 void aeron_ipc_publication_entry_delete(aeron_driver_conductor_t *conductor, aeron_ipc_publication_entry_t *entry)
 {
     aeron_ipc_publication_t *publication = entry->publication;
+    aeron_driver_conductor_unindex_ipc_publication(conductor, publication);
     conductor->context->log.remove_publication_cleanup(
         publication->session_id, publication->stream_id, publication->channel_length, publication->channel);
 
@@ -1374,6 +1602,7 @@ void aeron_network_publication_entry_delete(
     aeron_driver_conductor_t *conductor, aeron_network_publication_entry_t *entry)
 {
     aeron_send_channel_endpoint_t *endpoint = entry->publication->endpoint;
+    aeron_driver_conductor_unindex_network_publication(conductor, entry->publication);
 
     for (size_t i = 0, size = conductor->spy_subscriptions.length; i < size; i++)
     {
@@ -1433,7 +1662,7 @@ void aeron_driver_conductor_cleanup_network_publication(
     conductor->context->log.remove_publication_cleanup(
         publication->session_id, publication->stream_id, udp_channel->uri_length, udp_channel->original_uri);
 
-    aeron_driver_sender_proxy_on_remove_publication(conductor->context->sender_proxy, publication);
+    aeron_driver_sender_proxy_on_remove_publication(publication->endpoint->sender_proxy, publication);
 }
 
 void aeron_send_channel_endpoint_entry_on_time_event(
@@ -1509,6 +1738,8 @@ void aeron_publication_image_entry_delete(
     aeron_driver_conductor_t *conductor, aeron_publication_image_entry_t *entry)
 {
     aeron_publication_image_t *image = entry->image;
+    aeron_int64_to_ptr_hash_map_remove(
+        &conductor->publication_image_by_id_map, image->conductor_fields.managed_resource.registration_id);
 
     for (size_t i = 0, size = conductor->network_subscriptions.length; i < size; i++)
     {
@@ -1579,7 +1810,7 @@ void aeron_driver_conductor_image_transition_to_linger(
         if (rejoin)
         {
             aeron_driver_receiver_proxy_on_remove_cool_down(
-                conductor->context->receiver_proxy,
+                image->conductor_fields.endpoint->receiver_proxy,
                 image->conductor_fields.endpoint,
                 image->session_id,
                 image->stream_id);
@@ -1676,37 +1907,41 @@ aeron_ipc_publication_t *aeron_driver_conductor_get_or_add_ipc_publication(
     bool is_exclusive)
 {
     aeron_ipc_publication_t *publication = NULL;
+    aeron_ipc_publication_t *stream_head = aeron_int64_to_ptr_hash_map_get(
+        &conductor->ipc_publication_by_stream_id_map, (int64_t)stream_id);
+
+    size_t stream_publication_count = 0;
+    for (aeron_ipc_publication_t *pub_entry = stream_head; NULL != pub_entry;
+        pub_entry = pub_entry->conductor_fields.next_in_stream)
+    {
+        stream_publication_count++;
+    }
 
     uint64_t bits[STATIC_BIT_SET_U64_LEN];
     aeron_bit_set_t session_id_offsets;
-    aeron_bit_set_stack_init(
-        conductor->ipc_publications.length + 1, bits, STATIC_BIT_SET_U64_LEN, false, &session_id_offsets);
-    assert(conductor->ipc_publications.length < session_id_offsets.bit_set_length);
+    aeron_bit_set_stack_init(stream_publication_count + 1, bits, STATIC_BIT_SET_U64_LEN, false, &session_id_offsets);
+    assert(stream_publication_count < session_id_offsets.bit_set_length);
 
     bool is_session_id_in_use = false;
 
-    for (size_t i = 0; i < conductor->ipc_publications.length; i++)
+    for (aeron_ipc_publication_t *pub_entry = stream_head; NULL != pub_entry;
+        pub_entry = pub_entry->conductor_fields.next_in_stream)
     {
-        aeron_ipc_publication_t *pub_entry = conductor->ipc_publications.array[i].publication;
+        if (AERON_IPC_PUBLICATION_STATE_ACTIVE == pub_entry->conductor_fields.state &&
+            NULL == publication && !is_exclusive && !pub_entry->is_exclusive)
+        {
+            publication = pub_entry;
+        }
 
-        if (stream_id == pub_entry->stream_id)
+        if (AERON_IPC_PUBLICATION_STATE_ACTIVE == pub_entry->conductor_fields.state ||
+            AERON_IPC_PUBLICATION_STATE_DRAINING == pub_entry->conductor_fields.state)
         {
-            if (AERON_IPC_PUBLICATION_STATE_ACTIVE == pub_entry->conductor_fields.state &&
-                NULL == publication && !is_exclusive && !pub_entry->is_exclusive)
+            if (params->has_session_id && pub_entry->session_id == params->session_id)
             {
-                publication = pub_entry;
+                is_session_id_in_use = true;
             }
 
-            if (AERON_IPC_PUBLICATION_STATE_ACTIVE == pub_entry->conductor_fields.state ||
-                AERON_IPC_PUBLICATION_STATE_DRAINING == pub_entry->conductor_fields.state)
-            {
-                if (params->has_session_id && pub_entry->session_id == params->session_id)
-                {
-                    is_session_id_in_use = true;
-                }
-
-                aeron_driver_conductor_track_session_id_offsets(conductor, &session_id_offsets, pub_entry->session_id);
-            }
+            aeron_driver_conductor_track_session_id_offsets(conductor, &session_id_offsets, pub_entry->session_id);
         }
     }
 
@@ -1812,6 +2047,14 @@ aeron_ipc_publication_t *aeron_driver_conductor_get_or_add_ipc_publication(
                     uri_length,
                     uri) >= 0)
                 {
+                    if (aeron_driver_conductor_index_ipc_publication(conductor, publication) < 0)
+                    {
+                        aeron_driver_conductor_unindex_ipc_publication(conductor, publication);
+                        aeron_ipc_publication_close(&conductor->counters_manager, publication);
+                        aeron_ipc_publication_free(publication);
+                        return NULL;
+                    }
+
                     aeron_publication_link_t *link = &client->publication_links.array[client->publication_links.length];
 
                     link->resource = &publication->conductor_fields.managed_resource;
@@ -1858,24 +2101,22 @@ static int aeron_driver_conductor_find_response_publication_image(
         return -1;
     }
 
-    for (size_t i = 0; i < conductor->publication_images.length; i++)
+    aeron_publication_image_t *image_entry = aeron_int64_to_ptr_hash_map_get(
+        &conductor->publication_image_by_id_map, params->response_correlation_id);
+    if (NULL != image_entry)
     {
-        aeron_publication_image_t *image_entry = conductor->publication_images.array[i].image;
-        if (aeron_publication_image_registration_id(image_entry) == params->response_correlation_id)
+        if (aeron_publication_image_has_send_response_setup(image_entry))
         {
-            if (aeron_publication_image_has_send_response_setup(image_entry))
-            {
-                *image = image_entry;
-                return 0;
-            }
-            else
-            {
-                AERON_SET_ERR(
-                    EINVAL,
-                    "image.correlationId=%" PRId64 " did not request a response channel",
-                    params->response_correlation_id);
-                return -1;
-            }
+            *image = image_entry;
+            return 0;
+        }
+        else
+        {
+            AERON_SET_ERR(
+                EINVAL,
+                "image.correlationId=%" PRId64 " did not request a response channel",
+                params->response_correlation_id);
+            return -1;
         }
     }
 
@@ -1897,36 +2138,39 @@ aeron_network_publication_t *aeron_driver_conductor_get_or_add_network_publicati
 {
     aeron_network_publication_t *publication = NULL;
     const aeron_udp_channel_t *udp_channel = endpoint->conductor_fields.udp_channel;
+    aeron_network_publication_t *stream_head = aeron_int64_to_ptr_hash_map_get(
+        &endpoint->conductor_fields.publication_by_stream_id_map, (int64_t)stream_id);
+
+    size_t stream_publication_count = 0;
+    for (aeron_network_publication_t *pub_entry = stream_head; NULL != pub_entry;
+        pub_entry = pub_entry->conductor_fields.next_in_stream)
+    {
+        stream_publication_count++;
+    }
 
     uint64_t bits[STATIC_BIT_SET_U64_LEN];
     aeron_bit_set_t session_id_offsets;
-    aeron_bit_set_stack_init(
-        conductor->network_publications.length + 1, bits, STATIC_BIT_SET_U64_LEN, false, &session_id_offsets);
+    aeron_bit_set_stack_init(stream_publication_count + 1, bits, STATIC_BIT_SET_U64_LEN, false, &session_id_offsets);
 
     bool is_session_id_in_use = false;
 
-    // TODO: Extract
-    for (size_t i = 0; i < conductor->network_publications.length; i++)
+    for (aeron_network_publication_t *pub_entry = stream_head; NULL != pub_entry;
+        pub_entry = pub_entry->conductor_fields.next_in_stream)
     {
-        aeron_network_publication_t *pub_entry = conductor->network_publications.array[i].publication;
-
-        if (endpoint == pub_entry->endpoint && stream_id == pub_entry->stream_id)
+        if (AERON_NETWORK_PUBLICATION_STATE_ACTIVE == pub_entry->conductor_fields.state &&
+            !is_exclusive &&
+            !pub_entry->is_exclusive &&
+            pub_entry->response_correlation_id == params->response_correlation_id)
         {
-            if (AERON_NETWORK_PUBLICATION_STATE_ACTIVE == pub_entry->conductor_fields.state &&
-                !is_exclusive &&
-                !pub_entry->is_exclusive &&
-                pub_entry->response_correlation_id == params->response_correlation_id)
-            {
-                publication = pub_entry;
-            }
-
-            if (params->has_session_id && pub_entry->session_id == params->session_id)
-            {
-                is_session_id_in_use = true;
-            }
+            publication = pub_entry;
+        }
 
-            aeron_driver_conductor_track_session_id_offsets(conductor, &session_id_offsets, pub_entry->session_id);
+        if (params->has_session_id && pub_entry->session_id == params->session_id)
+        {
+            is_session_id_in_use = true;
         }
+
+        aeron_driver_conductor_track_session_id_offsets(conductor, &session_id_offsets, pub_entry->session_id);
     }
 
     int32_t speculated_session_id = 0;
@@ -1962,6 +2206,27 @@ aeron_network_publication_t *aeron_driver_conductor_get_or_add_network_publicati
             return NULL;
         }
 
+        if (params->rate_bytes_per_sec > 0 &&
+            (int64_t)params->rate_bytes_per_sec != publication->send_pacer.rate_bytes_per_sec)
+        {
+            AERON_SET_ERR(
+                EINVAL,
+                "existing publication has different '%s': existing=%" PRId64 " requested=%" PRIu64,
+                AERON_URI_RATE_KEY, publication->send_pacer.rate_bytes_per_sec, params->rate_bytes_per_sec);
+
+            return NULL;
+        }
+
+        if (params->has_burst_length && (int64_t)params->burst_length != publication->send_pacer.burst_length)
+        {
+            AERON_SET_ERR(
+                EINVAL,
+                "existing publication has different '%s': existing=%" PRId64 " requested=%" PRIu64,
+                AERON_URI_BURST_KEY, publication->send_pacer.burst_length, (uint64_t)params->burst_length);
+
+            return NULL;
+        }
+
         if (0 != aeron_confirm_publication_match(
             params,
             publication->session_id,
@@ -2014,6 +2279,8 @@ aeron_network_publication_t *aeron_driver_conductor_get_or_add_network_publicati
                 aeron_position_t snd_pos_position;
                 aeron_position_t snd_lmt_position;
                 aeron_atomic_counter_t snd_bpe_counter;
+                aeron_atomic_counter_t snd_batch_counter = { -1, NULL };
+                aeron_atomic_counter_t snd_pacing_delays_counter = { -1, NULL };
 
                 pub_pos_position.counter_id = aeron_counter_publisher_position_allocate(
                     &conductor->counters_manager, registration_id, session_id, stream_id, uri_length, uri);
@@ -2047,6 +2314,32 @@ aeron_network_publication_t *aeron_driver_conductor_get_or_add_network_publicati
                 snd_bpe_counter.value_addr = aeron_counters_manager_addr(
                     &conductor->counters_manager, snd_bpe_counter.counter_id);
 
+                if (conductor->context->network_publication_adaptive_messages_per_send)
+                {
+                    snd_batch_counter.counter_id = aeron_counter_sender_batch_allocate(
+                        &conductor->counters_manager, registration_id, session_id, stream_id, uri_length, uri);
+                    if (snd_batch_counter.counter_id < 0)
+                    {
+                        return NULL;
+                    }
+
+                    snd_batch_counter.value_addr = aeron_counters_manager_addr(
+                        &conductor->counters_manager, snd_batch_counter.counter_id);
+                }
+
+                if (params->rate_bytes_per_sec > 0)
+                {
+                    snd_pacing_delays_counter.counter_id = aeron_counter_sender_pacing_delays_allocate(
+                        &conductor->counters_manager, registration_id, session_id, stream_id, uri_length, uri);
+                    if (snd_pacing_delays_counter.counter_id < 0)
+                    {
+                        return NULL;
+                    }
+
+                    snd_pacing_delays_counter.value_addr = aeron_counters_manager_addr(
+                        &conductor->counters_manager, snd_pacing_delays_counter.counter_id);
+                }
+
                 if (params->has_position)
                 {
                     int64_t position = aeron_logbuffer_compute_position(
@@ -2075,14 +2368,37 @@ aeron_network_publication_t *aeron_driver_conductor_get_or_add_network_publicati
                         &snd_pos_position,
                         &snd_lmt_position,
                         &snd_bpe_counter,
+                        conductor->context->network_publication_adaptive_messages_per_send ? &snd_batch_counter : NULL,
+                        params->rate_bytes_per_sec > 0 ? &snd_pacing_delays_counter : NULL,
                         flow_control_strategy,
                         params,
                         is_exclusive,
                         &conductor->system_counters) >= 0)
                 {
+                    if (aeron_driver_conductor_index_network_publication(conductor, publication) < 0)
+                    {
+                        aeron_driver_conductor_unindex_network_publication(conductor, publication);
+                        aeron_network_publication_close(&conductor->counters_manager, publication);
+                        aeron_network_publication_free(publication);
+                        return NULL;
+                    }
+
                     endpoint->conductor_fields.managed_resource.incref(
                         endpoint->conductor_fields.managed_resource.clientd);
-                    aeron_driver_sender_proxy_on_add_publication(conductor->context->sender_proxy, publication);
+
+                    if (conductor->context->latency_report_enabled)
+                    {
+                        publication->latency_reporter = &conductor->latency_reporter;
+                        publication->send_to_wire_latency_offset = aeron_driver_conductor_create_latency_entry(
+                            conductor,
+                            registration_id,
+                            session_id,
+                            stream_id,
+                            AERON_LATENCY_REPORT_HOP_SEND_TO_WIRE,
+                            endpoint->conductor_fields.udp_channel);
+                    }
+
+                    aeron_driver_sender_proxy_on_add_publication(endpoint->sender_proxy, publication);
 
                     aeron_publication_link_t *link = &client->publication_links.array[client->publication_links.length];
 
@@ -2231,6 +2547,24 @@ static int aeron_driver_conductor_tagged_channels_match(aeron_udp_channel_t *exi
     return 0;
 }
 
+static aeron_driver_sender_proxy_t *aeron_driver_conductor_select_sender_proxy(
+    aeron_driver_conductor_t *conductor, aeron_udp_channel_t *channel, aeron_driver_uri_publication_params_t *params)
+{
+    aeron_driver_context_t *context = conductor->context;
+    if (context->sender_count <= 1)
+    {
+        return context->sender_proxy;
+    }
+
+    if (AERON_NULL_VALUE != params->sender_id)
+    {
+        return context->sender_proxies[params->sender_id];
+    }
+
+    uint64_t hash = aeron_fnv_64a_buf((uint8_t *)channel->canonical_form, channel->canonical_length);
+    return context->sender_proxies[hash % context->sender_count];
+}
+
 aeron_send_channel_endpoint_t *aeron_driver_conductor_get_or_add_send_channel_endpoint(
     aeron_driver_conductor_t *conductor,
     aeron_udp_channel_t *channel,
@@ -2304,7 +2638,13 @@ aeron_send_channel_endpoint_t *aeron_driver_conductor_get_or_add_send_channel_en
         }
 
         if (aeron_send_channel_endpoint_create(
-            &endpoint, channel, params, conductor->context, &conductor->counters_manager, registration_id) < 0)
+            &endpoint,
+            channel,
+            params,
+            conductor->context,
+            &conductor->counters_manager,
+            registration_id,
+            aeron_driver_conductor_select_sender_proxy(conductor, channel, params)) < 0)
         {
             // the `channel` is now owned by the endpoint
             return NULL;
@@ -2320,13 +2660,28 @@ aeron_send_channel_endpoint_t *aeron_driver_conductor_get_or_add_send_channel_en
             return NULL;
         }
 
-        aeron_driver_sender_proxy_on_add_endpoint(conductor->context->sender_proxy, endpoint);
+        aeron_driver_sender_proxy_on_add_endpoint(endpoint->sender_proxy, endpoint);
         conductor->send_channel_endpoints.array[conductor->send_channel_endpoints.length++].endpoint = endpoint;
 
         aeron_counter_set_ordered(endpoint->channel_status.value_addr, AERON_COUNTER_CHANNEL_ENDPOINT_STATUS_ACTIVE);
     }
     else
     {
+        if (AERON_NULL_VALUE != params->sender_id &&
+            aeron_driver_conductor_select_sender_proxy(conductor, channel, params) != endpoint->sender_proxy)
+        {
+            AERON_SET_ERR(
+                EINVAL,
+                "%s=%" PRId32 " does not match the sender of the existing endpoint: existingChannel=%.*s channel=%.*s",
+                AERON_URI_SENDER_ID_KEY,
+                params->sender_id,
+                (int)endpoint->conductor_fields.udp_channel->uri_length,
+                endpoint->conductor_fields.udp_channel->original_uri,
+                (int)channel->uri_length,
+                channel->original_uri);
+            goto error_cleanup;
+        }
+
         if (aeron_publication_params_validate_mtu_for_sndbuf(
             params,
             endpoint->conductor_fields.socket_sndbuf,
@@ -2368,6 +2723,42 @@ error_cleanup:
     return NULL;
 }
 
+static aeron_driver_receiver_proxy_t *aeron_driver_conductor_select_receiver_proxy(aeron_driver_conductor_t *conductor)
+{
+    aeron_driver_context_t *context = conductor->context;
+    if (context->receiver_count <= 1)
+    {
+        return context->receiver_proxy;
+    }
+
+    size_t endpoint_counts[AERON_DRIVER_RECEIVER_COUNT_MAX] = { 0 };
+    for (size_t i = 0; i < conductor->receive_channel_endpoints.length; i++)
+    {
+        aeron_driver_receiver_proxy_t *receiver_proxy =
+            conductor->receive_channel_endpoints.array[i].endpoint->receiver_proxy;
+
+        for (uint32_t j = 0; j < context->receiver_count; j++)
+        {
+            if (receiver_proxy == context->receiver_proxies[j])
+            {
+                endpoint_counts[j]++;
+                break;
+            }
+        }
+    }
+
+    uint32_t selected = 0;
+    for (uint32_t j = 1; j < context->receiver_count; j++)
+    {
+        if (endpoint_counts[j] < endpoint_counts[selected])
+        {
+            selected = j;
+        }
+    }
+
+    return context->receiver_proxies[selected];
+}
+
 aeron_receive_channel_endpoint_t *aeron_driver_conductor_get_or_add_receive_channel_endpoint(
     aeron_driver_conductor_t *conductor, aeron_udp_channel_t *channel, int64_t correlation_id)
 {
@@ -2430,6 +2821,7 @@ aeron_receive_channel_endpoint_t *aeron_driver_conductor_get_or_add_receive_chan
         status_indicator.value_addr = aeron_counters_manager_addr(
             &conductor->counters_manager, status_indicator.counter_id);
 
+        aeron_driver_receiver_proxy_t *receiver_proxy = aeron_driver_conductor_select_receiver_proxy(conductor);
         aeron_receive_destination_t *destination = NULL;
 
         if (AERON_UDP_CHANNEL_CONTROL_MODE_MANUAL != channel->control_mode)
@@ -2439,6 +2831,7 @@ aeron_receive_channel_endpoint_t *aeron_driver_conductor_get_or_add_receive_chan
                 channel,
                 channel,
                 conductor->context,
+                receiver_proxy,
                 &conductor->counters_manager,
                 correlation_id,
                 status_indicator.counter_id) < 0)
@@ -2454,7 +2847,8 @@ aeron_receive_channel_endpoint_t *aeron_driver_conductor_get_or_add_receive_chan
             destination,
             &status_indicator,
             &conductor->system_counters,
-            conductor->context) < 0)
+            conductor->context,
+            receiver_proxy) < 0)
         {
             aeron_receive_destination_delete(destination, &conductor->counters_manager);
             return NULL;
@@ -2578,6 +2972,12 @@ void aeron_driver_conductor_on_error(
         code = AERON_ERROR_CODE_STORAGE_SPACE;
     }
 
+    aeron_batch_result_t *batch_result = conductor->pending_batch.current_result;
+    if (NULL != batch_result && correlation_id == batch_result->correlation_id)
+    {
+        batch_result->error_code = code;
+    }
+
     const size_t length = strlen(errmsg);
     const size_t response_length = sizeof(aeron_error_response_t) + length;
 
@@ -2756,6 +3156,15 @@ void aeron_driver_conductor_on_client_timeout(aeron_driver_conductor_t *conducto
         conductor, AERON_RESPONSE_ON_CLIENT_TIMEOUT, response, sizeof(aeron_client_timeout_t));
 }
 
+void aeron_driver_conductor_on_batch_complete(aeron_driver_conductor_t *conductor)
+{
+    aeron_batch_complete_t *response = (aeron_batch_complete_t *)conductor->pending_batch.response;
+    const size_t response_length =
+        sizeof(aeron_batch_complete_t) + ((size_t)response->result_count * sizeof(aeron_batch_result_t));
+
+    aeron_driver_conductor_client_transmit(conductor, AERON_RESPONSE_ON_BATCH_COMPLETE, response, response_length);
+}
+
 void on_unavailable_image(
     aeron_driver_conductor_t *conductor,
     const int64_t correlation_id,
@@ -2830,11 +3239,31 @@ static bool aeron_driver_conductor_not_accepting_client_commands(aeron_driver_co
         return true;
     }
 
-    aeron_mpsc_rb_t *sender_rb = conductor->context->sender_proxy->command_queue;
-    aeron_mpsc_rb_t *receiver_rb = conductor->context->receiver_proxy->command_queue;
-    return
-        ((sender_rb->capacity - aeron_mpsc_rb_size(sender_rb)) <= AERON_COMMAND_RB_RESERVE) ||
-        ((receiver_rb->capacity - aeron_mpsc_rb_size(receiver_rb)) <= AERON_COMMAND_RB_RESERVE);
+    for (uint32_t i = 0, length = conductor->context->sender_count; i < length; i++)
+    {
+        aeron_driver_sender_proxy_t *sender_proxy = NULL != conductor->context->sender_proxies[i] ?
+            conductor->context->sender_proxies[i] : conductor->context->sender_proxy;
+        aeron_mpsc_rb_t *sender_rb = sender_proxy->command_queue;
+
+        if ((sender_rb->capacity - aeron_mpsc_rb_size(sender_rb)) <= AERON_COMMAND_RB_RESERVE)
+        {
+            return true;
+        }
+    }
+
+    for (uint32_t i = 0, length = conductor->context->receiver_count; i < length; i++)
+    {
+        aeron_driver_receiver_proxy_t *receiver_proxy = NULL != conductor->context->receiver_proxies[i] ?
+            conductor->context->receiver_proxies[i] : conductor->context->receiver_proxy;
+        aeron_mpsc_rb_t *receiver_rb = receiver_proxy->command_queue;
+
+        if ((receiver_rb->capacity - aeron_mpsc_rb_size(receiver_rb)) <= AERON_COMMAND_RB_RESERVE)
+        {
+            return true;
+        }
+    }
+
+    return false;
 }
 
 typedef struct aeron_driver_async_command_stct
@@ -3297,6 +3726,23 @@ aeron_rb_read_action_t aeron_driver_conductor_on_command(
             break;
         }
 
+        case AERON_COMMAND_BATCH:
+        {
+            aeron_batch_command_t *command = (aeron_batch_command_t *)message;
+
+            if (length < sizeof(aeron_batch_command_t) ||
+                command->entries_length < 0 ||
+                length < (sizeof(aeron_batch_command_t) + (size_t)command->entries_length))
+            {
+                goto malformed_command;
+            }
+
+            correlation_id = command->correlated.correlation_id;
+
+            result = aeron_driver_conductor_on_batch(conductor, command);
+            break;
+        }
+
         default:
             AERON_SET_ERR(-AERON_ERROR_CODE_UNKNOWN_COMMAND_TYPE_ID, "command=%d unknown", msg_type_id);
             aeron_driver_conductor_log_error(conductor);
@@ -3308,7 +3754,7 @@ aeron_rb_read_action_t aeron_driver_conductor_on_command(
         aeron_driver_conductor_on_error(conductor, aeron_errcode(), aeron_errmsg(), correlation_id);
     }
 
-    if (conductor->async_client_command_in_flight)
+    if (conductor->async_client_command_in_flight || NULL != conductor->pending_batch.buffer)
     {
         return AERON_RB_BREAK;
     }
@@ -3320,6 +3766,11 @@ malformed_command:
         -AERON_ERROR_CODE_MALFORMED_COMMAND, "command=%d too short: length=%" PRIu64, msg_type_id, (uint64_t)length);
     aeron_driver_conductor_log_error(conductor);
 
+    if (NULL != conductor->pending_batch.current_result)
+    {
+        conductor->pending_batch.current_result->error_code = AERON_ERROR_CODE_MALFORMED_COMMAND;
+    }
+
     return AERON_RB_CONTINUE;
 }
 
@@ -3385,7 +3836,12 @@ int aeron_driver_conductor_do_work(void *clientd)
     const int64_t now_ms = aeron_clock_cached_epoch_time(conductor->context->cached_clock);
     int work_count = 0;
 
-    if (!conductor->async_client_command_in_flight)
+    if (NULL != conductor->pending_batch.buffer)
+    {
+        work_count += aeron_driver_conductor_process_batch(conductor);
+    }
+
+    if (!conductor->async_client_command_in_flight && NULL == conductor->pending_batch.buffer)
     {
         work_count += (int)aeron_mpsc_rb_controlled_read(
             &conductor->to_driver_commands, aeron_driver_conductor_on_command, conductor, AERON_COMMAND_DRAIN_LIMIT);
@@ -3426,6 +3882,20 @@ int aeron_driver_conductor_do_work(void *clientd)
 
     work_count += aeron_executor_process_completions(&conductor->executor, 1);
 
+    if (NULL != conductor->context->raw_log_pool)
+    {
+        int fill_result = aeron_raw_log_pool_do_work(conductor->context->raw_log_pool);
+        if (fill_result < 0)
+        {
+            AERON_APPEND_ERR("%s", "");
+            aeron_driver_conductor_log_error(conductor);
+        }
+        else
+        {
+            work_count += fill_result;
+        }
+    }
+
     return work_count;
 }
 
@@ -3435,6 +3905,18 @@ void aeron_driver_conductor_on_close(void *clientd)
 
     aeron_executor_close(&conductor->executor);
 
+    if (NULL != conductor->context->raw_log_pool)
+    {
+        aeron_raw_log_pool_close(conductor->context->raw_log_pool);
+        conductor->context->raw_log_pool = NULL;
+    }
+
+    if (NULL != conductor->context->term_cleaner)
+    {
+        aeron_term_cleaner_close(conductor->context->term_cleaner);
+        conductor->context->term_cleaner = NULL;
+    }
+
     conductor->name_resolver.close_func(&conductor->name_resolver);
 
     for (size_t i = 0, length = conductor->clients.length; i < length; i++)
@@ -3507,6 +3989,13 @@ void aeron_driver_conductor_on_close(void *clientd)
 
     aeron_str_to_ptr_hash_map_delete(&conductor->send_channel_endpoint_by_channel_map);
     aeron_str_to_ptr_hash_map_delete(&conductor->receive_channel_endpoint_by_channel_map);
+    aeron_int64_counter_map_delete(&conductor->client_index_by_id_map);
+    aeron_int64_to_ptr_hash_map_delete(&conductor->ipc_publication_by_id_map);
+    aeron_int64_to_ptr_hash_map_delete(&conductor->ipc_publication_by_stream_id_map);
+    aeron_int64_to_ptr_hash_map_delete(&conductor->network_publication_by_id_map);
+    aeron_int64_to_ptr_hash_map_delete(&conductor->publication_image_by_id_map);
+    aeron_free(conductor->pending_batch.buffer);
+    aeron_free(conductor->pending_batch.response);
     aeron_mpsc_rb_consumer_heartbeat_time(&conductor->to_driver_commands, AERON_NULL_VALUE);
     aeron_msync(conductor->context->cnc_map.addr, conductor->context->cnc_map.length);
 }
@@ -4045,6 +4534,7 @@ int aeron_driver_conductor_on_add_ipc_subscription(
     link->is_response = false;
     link->group = AERON_INFER;
     link->is_sparse = params.is_sparse;
+    link->is_huge_pages = params.is_huge_pages;
     link->is_tether = params.is_tether;
     link->subscribable_list.length = 0;
     link->subscribable_list.capacity = 0;
@@ -4142,6 +4632,7 @@ int aeron_driver_conductor_on_add_spy_subscription_complete(
     link->registration_id = command->correlated.correlation_id;
     link->is_reliable = params.is_reliable;
     link->is_sparse = params.is_sparse;
+    link->is_huge_pages = params.is_huge_pages;
     link->is_tether = params.is_tether;
     link->is_rejoin = params.is_rejoin;
     link->group = AERON_INFER;
@@ -4364,6 +4855,7 @@ int aeron_driver_conductor_on_add_network_subscription_complete(
         link->registration_id = correlation_id;
         link->is_reliable = params.is_reliable;
         link->is_sparse = params.is_sparse;
+        link->is_huge_pages = params.is_huge_pages;
         link->is_tether = params.is_tether;
         link->is_rejoin = params.is_rejoin;
         link->is_response = AERON_UDP_CHANNEL_CONTROL_MODE_RESPONSE == control_mode;
@@ -4552,7 +5044,7 @@ int aeron_driver_conductor_on_add_send_destination_complete(
     aeron_name_resolver_async_resolve_t *async_resolve = on_execute_clientd;
 
     aeron_driver_sender_proxy_on_add_destination(
-        conductor->context->sender_proxy, async_command->endpoint, async_command->uri, &async_resolve->sockaddr);
+        async_command->endpoint->sender_proxy, async_command->endpoint, async_command->uri, &async_resolve->sockaddr);
     aeron_driver_conductor_on_operation_succeeded(conductor, command->correlated.correlation_id);
 
     return 0;
@@ -4690,7 +5182,7 @@ int aeron_driver_conductor_on_remove_send_destination_complete(
     aeron_name_resolver_async_resolve_t *async_resolve = on_execute_clientd;
 
     aeron_driver_sender_proxy_on_remove_destination(
-        conductor->context->sender_proxy, async_command->endpoint, &async_resolve->sockaddr);
+        async_command->endpoint->sender_proxy, async_command->endpoint, &async_resolve->sockaddr);
     aeron_driver_conductor_on_operation_succeeded(conductor, command->correlated.correlation_id);
 
     return 0;
@@ -4862,6 +5354,7 @@ int aeron_driver_conductor_on_add_receive_ipc_destination(
     link->is_rejoin = true;
     link->group = AERON_INFER;
     link->is_sparse = params.is_sparse;
+    link->is_huge_pages = params.is_huge_pages;
     link->is_tether = params.is_tether;
     link->subscribable_list.length = 0;
     link->subscribable_list.capacity = 0;
@@ -4964,6 +5457,7 @@ int aeron_driver_conductor_on_add_receive_spy_destination_complete(
     link->registration_id = mds_subscription_link->registration_id;
     link->is_reliable = params.is_reliable;
     link->is_sparse = params.is_sparse;
+    link->is_huge_pages = params.is_huge_pages;
     link->is_tether = params.is_tether;
     link->is_rejoin = params.is_rejoin;
     link->group = AERON_INFER;
@@ -5096,6 +5590,7 @@ int aeron_driver_conductor_on_add_receive_network_destination_complete(
         udp_channel,
         endpoint->conductor_fields.udp_channel,
         conductor->context,
+        endpoint->receiver_proxy,
         &conductor->counters_manager,
         command->registration_id,
         endpoint->channel_status.counter_id) < 0)
@@ -5105,7 +5600,7 @@ int aeron_driver_conductor_on_add_receive_network_destination_complete(
 
     udp_channel = NULL;
 
-    aeron_driver_receiver_proxy_on_add_destination(conductor->context->receiver_proxy, endpoint, destination);
+    aeron_driver_receiver_proxy_on_add_destination(endpoint->receiver_proxy, endpoint, destination);
     aeron_driver_conductor_on_operation_succeeded(conductor, command->correlated.correlation_id);
 
     return 0;
@@ -5281,7 +5776,7 @@ int aeron_driver_conductor_on_remove_receive_network_destination_complete(
 
     endpoint = mds_subscription_link->endpoint;
 
-    aeron_driver_receiver_proxy_on_remove_destination(conductor->context->receiver_proxy, endpoint, udp_channel);
+    aeron_driver_receiver_proxy_on_remove_destination(endpoint->receiver_proxy, endpoint, udp_channel);
     aeron_driver_conductor_on_operation_succeeded(conductor, command->correlated.correlation_id);
 
     return 0;
@@ -5478,6 +5973,134 @@ int aeron_driver_conductor_on_terminate_driver(
     return 0;
 }
 
+int aeron_driver_conductor_on_batch(aeron_driver_conductor_t *conductor, aeron_batch_command_t *command)
+{
+    const size_t entries_length = (size_t)command->entries_length;
+    const size_t max_entry_count = entries_length / AERON_ALIGN(
+        sizeof(aeron_batch_entry_header_t) + sizeof(aeron_correlated_command_t), AERON_BATCH_ENTRY_ALIGNMENT);
+
+    if (command->entry_count < 0 || (size_t)command->entry_count > max_entry_count)
+    {
+        AERON_SET_ERR(
+            -AERON_ERROR_CODE_MALFORMED_COMMAND,
+            "batch entry_count=%" PRId32 " invalid for entries_length=%" PRIu64,
+            command->entry_count,
+            (uint64_t)entries_length);
+        return -1;
+    }
+
+    uint8_t *buffer = NULL;
+    uint8_t *response = NULL;
+    const size_t response_length =
+        sizeof(aeron_batch_complete_t) + ((size_t)command->entry_count * sizeof(aeron_batch_result_t));
+
+    if (aeron_alloc((void **)&buffer, entries_length + 1) < 0 ||
+        aeron_alloc((void **)&response, response_length) < 0)
+    {
+        aeron_free(buffer);
+        AERON_APPEND_ERR("%s", "failed to allocate batch");
+        return -1;
+    }
+
+    memcpy(buffer, (const uint8_t *)command + sizeof(aeron_batch_command_t), entries_length);
+
+    aeron_batch_complete_t *batch_complete = (aeron_batch_complete_t *)response;
+    batch_complete->correlation_id = command->correlated.correlation_id;
+    batch_complete->result_count = command->entry_count;
+
+    aeron_batch_result_t *results = (aeron_batch_result_t *)(response + sizeof(aeron_batch_complete_t));
+    for (int32_t i = 0; i < command->entry_count; i++)
+    {
+        results[i].correlation_id = AERON_NULL_VALUE;
+        results[i].error_code = AERON_ERROR_CODE_MALFORMED_COMMAND;
+    }
+
+    conductor->pending_batch.buffer = buffer;
+    conductor->pending_batch.length = entries_length;
+    conductor->pending_batch.offset = 0;
+    conductor->pending_batch.response = response;
+    conductor->pending_batch.current_result = NULL;
+    conductor->pending_batch.entry_count = command->entry_count;
+    conductor->pending_batch.entry_index = 0;
+
+    aeron_driver_conductor_process_batch(conductor);
+
+    return 0;
+}
+
+int aeron_driver_conductor_process_batch(aeron_driver_conductor_t *conductor)
+{
+    struct aeron_driver_conductor_pending_batch_stct *batch = &conductor->pending_batch;
+    aeron_batch_result_t *results = (aeron_batch_result_t *)(batch->response + sizeof(aeron_batch_complete_t));
+    int work_count = 0;
+
+    while (!aeron_driver_conductor_not_accepting_client_commands(conductor))
+    {
+        if (batch->entry_index >= batch->entry_count)
+        {
+            batch->current_result = NULL;
+            aeron_driver_conductor_on_batch_complete(conductor);
+
+            aeron_free(batch->buffer);
+            aeron_free(batch->response);
+            batch->buffer = NULL;
+            batch->response = NULL;
+            break;
+        }
+
+        const size_t remaining = batch->length - batch->offset;
+        aeron_batch_entry_header_t *header = (aeron_batch_entry_header_t *)(batch->buffer + batch->offset);
+
+        if (remaining < sizeof(aeron_batch_entry_header_t) ||
+            header->length < (int32_t)sizeof(aeron_correlated_command_t) ||
+            remaining < sizeof(aeron_batch_entry_header_t) + (size_t)header->length)
+        {
+            AERON_SET_ERR(
+                -AERON_ERROR_CODE_MALFORMED_COMMAND,
+                "batch entry=%" PRId32 " malformed: remaining=%" PRIu64,
+                batch->entry_index,
+                (uint64_t)remaining);
+            aeron_driver_conductor_log_error(conductor);
+
+            batch->entry_index = batch->entry_count;
+            continue;
+        }
+
+        const int32_t msg_type_id = header->msg_type_id;
+        const size_t length = (size_t)header->length;
+        uint8_t *message = batch->buffer + batch->offset + sizeof(aeron_batch_entry_header_t);
+        aeron_batch_result_t *result = &results[batch->entry_index];
+
+        result->correlation_id = ((aeron_correlated_command_t *)message)->correlation_id;
+        result->error_code = AERON_ERROR_CODE_UNUSED;
+        batch->current_result = result;
+        batch->offset += AERON_ALIGN(sizeof(aeron_batch_entry_header_t) + length, AERON_BATCH_ENTRY_ALIGNMENT);
+        batch->entry_index++;
+        work_count++;
+
+        switch (msg_type_id)
+        {
+            case AERON_COMMAND_ADD_PUBLICATION:
+            case AERON_COMMAND_ADD_EXCLUSIVE_PUBLICATION:
+            case AERON_COMMAND_REMOVE_PUBLICATION:
+            case AERON_COMMAND_ADD_SUBSCRIPTION:
+            case AERON_COMMAND_REMOVE_SUBSCRIPTION:
+            case AERON_COMMAND_ADD_COUNTER:
+            case AERON_COMMAND_REMOVE_COUNTER:
+                aeron_driver_conductor_on_command(msg_type_id, message, length, conductor);
+                break;
+
+            default:
+                AERON_SET_ERR(
+                    -AERON_ERROR_CODE_UNKNOWN_COMMAND_TYPE_ID, "command=%d not supported in batch", msg_type_id);
+                aeron_driver_conductor_on_error(conductor, aeron_errcode(), aeron_errmsg(), result->correlation_id);
+                break;
+        }
+    }
+
+    return work_count;
+}
+
 void aeron_driver_conductor_on_create_publication_image(void *clientd, void *item)
 {
     aeron_driver_conductor_t *conductor = (aeron_driver_conductor_t *)clientd;
@@ -5499,7 +6122,7 @@ void aeron_driver_conductor_on_create_publication_image(void *clientd, void *ite
         conductor, endpoint, command->stream_id, command->session_id))
     {
         aeron_driver_receiver_proxy_on_remove_init_in_progress(
-            conductor->context->receiver_proxy, endpoint, command->session_id, command->stream_id);
+            endpoint->receiver_proxy, endpoint, command->session_id, command->stream_id);
         return;
     }
 
@@ -5578,8 +6201,12 @@ void aeron_driver_conductor_on_create_publication_image(void *clientd, void *ite
     aeron_inferable_boolean_t group_subscription = subscription_link.group;
     bool treat_as_multicast = AERON_INFER == group_subscription ?
         endpoint->conductor_fields.udp_channel->is_multicast : AERON_FORCE_TRUE == group_subscription;
-    bool is_oldest_subscription_sparse = aeron_driver_conductor_is_oldest_subscription_sparse(
+    aeron_subscription_link_t *oldest_subscription = aeron_driver_conductor_oldest_subscription(
         conductor, endpoint, command->stream_id, command->session_id, registration_id);
+    bool is_oldest_subscription_sparse = NULL != oldest_subscription ?
+        oldest_subscription->is_sparse : conductor->context->term_buffer_sparse_file;
+    bool is_oldest_subscription_huge_pages = NULL != oldest_subscription ?
+        oldest_subscription->is_huge_pages : conductor->context->term_buffer_huge_pages;
 
     aeron_publication_image_t *image = NULL;
     if (aeron_publication_image_create(
@@ -5604,6 +6231,7 @@ void aeron_driver_conductor_on_create_publication_image(void *clientd, void *ite
         &conductor->loss_reporter,
         is_reliable,
         is_oldest_subscription_sparse,
+        is_oldest_subscription_huge_pages,
         treat_as_multicast,
         &conductor->system_counters) < 0)
     {
@@ -5613,6 +6241,15 @@ void aeron_driver_conductor_on_create_publication_image(void *clientd, void *ite
         goto error_cleanup;
     }
 
+    if (aeron_int64_to_ptr_hash_map_put(&conductor->publication_image_by_id_map, registration_id, image) < 0)
+    {
+        aeron_int64_to_ptr_hash_map_remove(&conductor->publication_image_by_id_map, registration_id);
+        aeron_publication_image_close(&conductor->counters_manager, image);
+        aeron_publication_image_free(image);
+        AERON_APPEND_ERR("stream_id=%d session_id=%d", command->stream_id, command->session_id);
+        goto error_cleanup;
+    }
+
     aeron_receive_channel_endpoint_inc_image_ref_count(endpoint);
     conductor->publication_images.array[conductor->publication_images.length++].image = image;
     int64_t now_ns = aeron_clock_cached_nano_time(conductor->context->cached_clock);
@@ -5645,13 +6282,32 @@ void aeron_driver_conductor_on_create_publication_image(void *clientd, void *ite
         }
     }
 
-    aeron_driver_receiver_proxy_on_add_publication_image(conductor->context->receiver_proxy, endpoint, image);
+    if (conductor->context->latency_report_enabled)
+    {
+        image->latency_reporter = &conductor->latency_reporter;
+        image->wire_to_term_latency_offset = aeron_driver_conductor_create_latency_entry(
+            conductor,
+            registration_id,
+            command->session_id,
+            command->stream_id,
+            AERON_LATENCY_REPORT_HOP_WIRE_TO_TERM,
+            endpoint->conductor_fields.udp_channel);
+        image->term_to_subscriber_latency_offset = aeron_driver_conductor_create_latency_entry(
+            conductor,
+            registration_id,
+            command->session_id,
+            command->stream_id,
+            AERON_LATENCY_REPORT_HOP_TERM_TO_SUBSCRIBER,
+            endpoint->conductor_fields.udp_channel);
+    }
+
+    aeron_driver_receiver_proxy_on_add_publication_image(endpoint->receiver_proxy, endpoint, image);
     return;
 
 error_cleanup:
     aeron_driver_conductor_log_error(conductor);
     aeron_driver_receiver_proxy_on_remove_init_in_progress(
-        conductor->context->receiver_proxy, endpoint, command->session_id, command->stream_id);
+        endpoint->receiver_proxy, endpoint, command->session_id, command->stream_id);
 }
 
 void aeron_driver_conductor_on_linger_buffer(void *clientd, void *item)
@@ -5691,7 +6347,7 @@ void aeron_driver_conductor_on_re_resolve_endpoint_complete(int result, int errc
     else if (0 != memcmp(&async_cmd->async_resolve.sockaddr, &async_cmd->existing_addr, sizeof(struct sockaddr_storage)))
     {
         aeron_driver_sender_proxy_on_resolution_change(
-            conductor->context->sender_proxy,
+            ((aeron_send_channel_endpoint_t *)async_cmd->endpoint)->sender_proxy,
             async_cmd->async_resolve.endpoint_name,
             async_cmd->endpoint,
             &async_cmd->async_resolve.sockaddr);
@@ -5752,7 +6408,7 @@ void aeron_driver_conductor_on_re_resolve_control_complete(int result, int errco
     else if (0 != memcmp(&async_cmd->async_resolve.sockaddr, &async_cmd->existing_addr, sizeof(struct sockaddr_storage)))
     {
         aeron_driver_receiver_proxy_on_resolution_change(
-            conductor->context->receiver_proxy,
+            ((aeron_receive_channel_endpoint_t *)async_cmd->endpoint)->receiver_proxy,
             async_cmd->async_resolve.endpoint_name,
             async_cmd->endpoint,
             async_cmd->destination,
@@ -5860,13 +6516,11 @@ void aeron_driver_conductor_on_response_connected(void *clientd, void *item)
     aeron_command_response_connected_t *cmd = item;
     const int64_t response_correlation_id = cmd->response_correlation_id;
 
-    for (size_t i = 0, length = conductor->publication_images.length; i < length; i++)
+    aeron_publication_image_t *publication_image = aeron_int64_to_ptr_hash_map_get(
+        &conductor->publication_image_by_id_map, response_correlation_id);
+    if (NULL != publication_image)
     {
-        aeron_publication_image_t *publication_image = conductor->publication_images.array[i].image;
-        if (response_correlation_id == aeron_publication_image_registration_id(publication_image))
-        {
-            aeron_publication_image_remove_response_session_id(publication_image);
-        }
+        aeron_publication_image_remove_response_session_id(publication_image);
     }
 }
 
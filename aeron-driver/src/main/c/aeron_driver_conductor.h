@@ -28,11 +28,16 @@
 #include "aeron_system_counters.h"
 #include "aeron_ipc_publication.h"
 #include "collections/aeron_str_to_ptr_hash_map.h"
+#include "collections/aeron_int64_to_ptr_hash_map.h"
+#include "collections/aeron_int64_counter_map.h"
 #include "media/aeron_send_channel_endpoint.h"
 #include "media/aeron_receive_channel_endpoint.h"
 #include "aeron_driver_conductor_proxy.h"
 #include "aeron_publication_image.h"
+#include "aeron_raw_log_pool.h"
+#include "concurrent/aeron_term_cleaner.h"
 #include "reports/aeron_loss_reporter.h"
+#include "reports/aeron_latency_reporter.h"
 #include "util/aeron_deque.h"
 
 #define AERON_DRIVER_CONDUCTOR_LINGER_RESOURCE_TIMEOUT_NS (5 * 1000 * 1000 * 1000LL)
@@ -91,6 +96,7 @@ typedef struct aeron_subscription_link_stct
     char channel[AERON_MAX_PATH];
     bool is_tether;
     bool is_sparse;
+    bool is_huge_pages;
     bool is_reliable;
     bool is_rejoin;
     bool has_session_id;
@@ -174,11 +180,19 @@ typedef struct aeron_driver_conductor_stct
     aeron_system_counters_t system_counters;
     aeron_driver_conductor_proxy_t conductor_proxy;
     aeron_loss_reporter_t loss_reporter;
+    aeron_latency_reporter_t latency_reporter;
     aeron_name_resolver_t name_resolver;
     aeron_executor_t executor;
+    aeron_raw_log_pool_t raw_log_pool;
+    aeron_term_cleaner_t term_cleaner;
 
     aeron_str_to_ptr_hash_map_t send_channel_endpoint_by_channel_map;
     aeron_str_to_ptr_hash_map_t receive_channel_endpoint_by_channel_map;
+    aeron_int64_counter_map_t client_index_by_id_map;
+    aeron_int64_to_ptr_hash_map_t ipc_publication_by_id_map;
+    aeron_int64_to_ptr_hash_map_t ipc_publication_by_stream_id_map;
+    aeron_int64_to_ptr_hash_map_t network_publication_by_id_map;
+    aeron_int64_to_ptr_hash_map_t publication_image_by_id_map;
 
     struct client_stct
     {
@@ -305,6 +319,18 @@ typedef struct aeron_driver_conductor_stct
 
     bool async_client_command_in_flight;
 
+    struct aeron_driver_conductor_pending_batch_stct
+    {
+        uint8_t *buffer;
+        size_t length;
+        size_t offset;
+        uint8_t *response;
+        aeron_batch_result_t *current_result;
+        int32_t entry_count;
+        int32_t entry_index;
+    }
+    pending_batch;
+
     uint8_t padding[AERON_CACHE_LINE_LENGTH];
 }
 aeron_driver_conductor_t;
@@ -384,6 +410,11 @@ void aeron_driver_conductor_image_transition_to_linger(
 
 int aeron_driver_conductor_init(aeron_driver_conductor_t *conductor, aeron_driver_context_t *context);
 
+void aeron_driver_conductor_log_explicit_error(
+    aeron_driver_conductor_t *conductor, int error_code, const char *description);
+
+void aeron_driver_conductor_log_error(aeron_driver_conductor_t *conductor);
+
 void aeron_driver_conductor_client_transmit(
     aeron_driver_conductor_t *conductor,
     int32_t msg_type_id,
@@ -418,6 +449,8 @@ void aeron_driver_conductor_on_unavailable_counter(
 
 void aeron_driver_conductor_on_client_timeout(aeron_driver_conductor_t *conductor, int64_t correlation_id);
 
+void aeron_driver_conductor_on_batch_complete(aeron_driver_conductor_t *conductor);
+
 void aeron_driver_conductor_cleanup_spies(
     aeron_driver_conductor_t *conductor, aeron_network_publication_t *publication);
 
@@ -514,6 +547,11 @@ int aeron_driver_conductor_on_client_close(aeron_driver_conductor_t *conductor,
 int aeron_driver_conductor_on_terminate_driver(
     aeron_driver_conductor_t *conductor, aeron_terminate_driver_command_t *command);
 
+int aeron_driver_conductor_on_batch(
+    aeron_driver_conductor_t *conductor, aeron_batch_command_t *command);
+
+int aeron_driver_conductor_process_batch(aeron_driver_conductor_t *conductor);
+
 void aeron_driver_conductor_on_create_publication_image(void *clientd, void *item);
 
 void aeron_driver_conductor_on_linger_buffer(void *clientd, void *item);
@@ -695,33 +733,14 @@ inline aeron_receive_channel_endpoint_t * aeron_driver_conductor_find_receive_ch
 inline aeron_ipc_publication_t * aeron_driver_conductor_find_ipc_publication(
     aeron_driver_conductor_t *conductor, int64_t id)
 {
-    for (size_t i = 0, length = conductor->ipc_publications.length; i < length; i++)
-    {
-        aeron_ipc_publication_t *publication = conductor->ipc_publications.array[i].publication;
-
-        if (id == publication->conductor_fields.managed_resource.registration_id)
-        {
-            return publication;
-        }
-    }
-
-    return NULL;
+    return (aeron_ipc_publication_t *)aeron_int64_to_ptr_hash_map_get(&conductor->ipc_publication_by_id_map, id);
 }
 
 inline aeron_network_publication_t * aeron_driver_conductor_find_network_publication(
     aeron_driver_conductor_t *conductor, int64_t id)
 {
-    for (size_t i = 0, length = conductor->network_publications.length; i < length; i++)
-    {
-        aeron_network_publication_t *publication = conductor->network_publications.array[i].publication;
-
-        if (id == publication->conductor_fields.managed_resource.registration_id)
-        {
-            return publication;
-        }
-    }
-
-    return NULL;
+    return (aeron_network_publication_t *)aeron_int64_to_ptr_hash_map_get(
+        &conductor->network_publication_by_id_map, id);
 }
 
 inline aeron_network_publication_t *aeron_driver_conductor_find_network_publication_by_tag(
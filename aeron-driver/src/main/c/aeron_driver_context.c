@@ -280,6 +280,10 @@ static void aeron_driver_untethered_subscription_state_change_null(
 #define AERON_TERM_BUFFER_LENGTH_DEFAULT (16 * 1024 * 1024)
 #define AERON_IPC_TERM_BUFFER_LENGTH_DEFAULT (64 * 1024 * 1024)
 #define AERON_TERM_BUFFER_SPARSE_FILE_DEFAULT (false)
+#define AERON_TERM_BUFFER_HUGE_PAGES_DEFAULT (false)
+#define AERON_TERM_BUFFER_CLEAN_NON_TEMPORAL_DEFAULT (false)
+#define AERON_TERM_BUFFER_CLEANER_THREAD_DEFAULT (false)
+#define AERON_HUGE_PAGE_SIZE_DEFAULT (2 * 1024 * 1024)
 #define AERON_PERFORM_STORAGE_CHECKS_DEFAULT (true)
 #define AERON_LOW_FILE_STORE_WARNING_THRESHOLD_DEFAULT (AERON_TERM_BUFFER_LENGTH_DEFAULT * INT64_C(10))
 #define AERON_SPIES_SIMULATE_CONNECTION_DEFAULT (false)
@@ -292,6 +296,9 @@ static void aeron_driver_untethered_subscription_state_change_null(
 #define AERON_SOCKET_SO_RCVBUF_DEFAULT (128 * 1024)
 #define AERON_SOCKET_SO_SNDBUF_DEFAULT (0)
 #define AERON_SOCKET_MULTICAST_TTL_DEFAULT (0)
+#define AERON_SOCKET_GSO_ENABLED_DEFAULT (false)
+#define AERON_SOCKET_GRO_ENABLED_DEFAULT (false)
+#define AERON_RECEIVER_ZERO_COPY_ENABLED_DEFAULT (false)
 #define AERON_RECEIVER_GROUP_TAG_IS_PRESENT_DEFAULT false
 #define AERON_RECEIVER_GROUP_TAG_VALUE_DEFAULT (-1)
 #define AERON_FLOW_CONTROL_GROUP_TAG_DEFAULT (-1)
@@ -305,6 +312,9 @@ static void aeron_driver_untethered_subscription_state_change_null(
 #define AERON_IMAGE_LIVENESS_TIMEOUT_NS_DEFAULT (10 * 1000 * 1000 * INT64_C(1000))
 #define AERON_RCV_INITIAL_WINDOW_LENGTH_DEFAULT (128 * 1024)
 #define AERON_LOSS_REPORT_BUFFER_LENGTH_DEFAULT (1024 * 1024)
+#define AERON_LATENCY_REPORT_ENABLED_DEFAULT (false)
+#define AERON_LATENCY_REPORT_BUFFER_LENGTH_DEFAULT (1024 * 1024)
+#define AERON_LATENCY_REPORT_SAMPLE_INTERVAL_NS_DEFAULT (1000 * INT64_C(1000))
 #define AERON_PUBLICATION_UNBLOCK_TIMEOUT_NS_DEFAULT (15 * 1000 * 1000 * INT64_C(1000))
 #define AERON_PUBLICATION_CONNECTION_TIMEOUT_NS_DEFAULT (5 * 1000 * 1000 * INT64_C(1000))
 #define AERON_TIMER_INTERVAL_NS_DEFAULT (1 * 1000 * 1000 * INT64_C(1000))
@@ -334,14 +344,47 @@ static void aeron_driver_untethered_subscription_state_change_null(
 #define AERON_DRIVER_RECEIVER_CYCLE_THRESHOLD_NS_DEFAULT (1 * 1000 * 1000 * INT64_C(1000))
 #define AERON_DRIVER_NAME_RESOLVER_THRESHOLD_NS_DEFAULT (5 * 1000 * 1000 * INT64_C(1000))
 #define AERON_RECEIVER_IO_VECTOR_CAPACITY_DEFAULT UINT32_C(2)
+#define AERON_RECEIVER_COUNT_DEFAULT UINT32_C(1)
+#define AERON_SENDER_COUNT_DEFAULT UINT32_C(1)
 #define AERON_SENDER_IO_VECTOR_CAPACITY_DEFAULT UINT32_C(2)
 #define AERON_SENDER_MAX_MESSAGES_PER_SEND_DEFAULT UINT32_C(2)
+#define AERON_NETWORK_PUBLICATION_ADAPTIVE_MESSAGES_PER_SEND_DEFAULT (false)
 #define AERON_DRIVER_RESOURCE_FREE_LIMIT_DEFAULT UINT32_C(10)
 #define AERON_DRIVER_ASYNC_EXECUTOR_THREADS_DEFAULT UINT32_C(1)
+#define AERON_LOG_BUFFER_POOL_SIZE_DEFAULT UINT32_C(0)
 #define AERON_CPU_AFFINITY_DEFAULT (-1)
 #define AERON_DRIVER_CONNECT_DEFAULT true
 #define AERON_ENABLE_EXPERIMENTAL_FEATURES_DEFAULT false
 
+static int aeron_driver_context_parse_cpu_affinity_list(const char *value, int32_t *list, size_t length)
+{
+    const char *current = value;
+    size_t index = 0;
+
+    while ('\0' != *current)
+    {
+        if (index >= length)
+        {
+            AERON_SET_ERR(EINVAL, "more than %" PRIu64 " entries", (uint64_t)length);
+            return -1;
+        }
+
+        char *end_ptr = NULL;
+        errno = 0;
+        const long cpu = strtol(current, &end_ptr, 10);
+        if (0 != errno || end_ptr == current || cpu < -1 || cpu > 255 || (',' != *end_ptr && '\0' != *end_ptr))
+        {
+            AERON_SET_ERR(EINVAL, "invalid entry at index %" PRIu64, (uint64_t)index);
+            return -1;
+        }
+
+        list[index++] = (int32_t)cpu;
+        current = ',' == *end_ptr ? end_ptr + 1 : end_ptr;
+    }
+
+    return 0;
+}
+
 int aeron_driver_context_init(aeron_driver_context_t **context)
 {
     aeron_driver_context_t *_context = NULL;
@@ -360,6 +403,7 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
 
     _context->cnc_map.addr = NULL;
     _context->loss_report.addr = NULL;
+    _context->latency_report.addr = NULL;
     _context->aeron_dir = NULL;
     _context->conductor_proxy = NULL;
     _context->sender_proxy = NULL;
@@ -499,6 +543,13 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
     _context->dirs_delete_on_shutdown = AERON_DIR_DELETE_ON_SHUTDOWN_DEFAULT;
     _context->warn_if_dirs_exist = AERON_DIR_WARN_IF_EXISTS_DEFAULT;
     _context->term_buffer_sparse_file = AERON_TERM_BUFFER_SPARSE_FILE_DEFAULT;
+    _context->term_buffer_huge_pages = AERON_TERM_BUFFER_HUGE_PAGES_DEFAULT;
+    _context->term_buffer_clean_non_temporal = AERON_TERM_BUFFER_CLEAN_NON_TEMPORAL_DEFAULT;
+    _context->term_buffer_cleaner_thread = AERON_TERM_BUFFER_CLEANER_THREAD_DEFAULT;
+    _context->term_cleaner = NULL;
+    _context->huge_pages_dir = NULL;
+    _context->huge_pages_log_dir = NULL;
+    _context->huge_page_size = AERON_HUGE_PAGE_SIZE_DEFAULT;
     _context->perform_storage_checks = AERON_PERFORM_STORAGE_CHECKS_DEFAULT;
     _context->spies_simulate_connection = AERON_SPIES_SIMULATE_CONNECTION_DEFAULT;
     _context->print_configuration_on_start = AERON_PRINT_CONFIGURATION_DEFAULT;
@@ -523,6 +574,9 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
     _context->socket_rcvbuf = AERON_SOCKET_SO_RCVBUF_DEFAULT;
     _context->socket_sndbuf = AERON_SOCKET_SO_SNDBUF_DEFAULT;
     _context->multicast_ttl = AERON_SOCKET_MULTICAST_TTL_DEFAULT;
+    _context->socket_gso_enabled = AERON_SOCKET_GSO_ENABLED_DEFAULT;
+    _context->socket_gro_enabled = AERON_SOCKET_GRO_ENABLED_DEFAULT;
+    _context->receiver_zero_copy_enabled = AERON_RECEIVER_ZERO_COPY_ENABLED_DEFAULT;
     _context->receiver_group_tag.is_present = AERON_RECEIVER_GROUP_TAG_IS_PRESENT_DEFAULT;
     _context->receiver_group_tag.value = AERON_RECEIVER_GROUP_TAG_VALUE_DEFAULT;
     _context->flow_control.group_tag = AERON_FLOW_CONTROL_GROUP_TAG_DEFAULT;
@@ -533,6 +587,9 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
     _context->image_liveness_timeout_ns = AERON_IMAGE_LIVENESS_TIMEOUT_NS_DEFAULT;
     _context->initial_window_length = AERON_RCV_INITIAL_WINDOW_LENGTH_DEFAULT;
     _context->loss_report_length = AERON_LOSS_REPORT_BUFFER_LENGTH_DEFAULT;
+    _context->latency_report_enabled = AERON_LATENCY_REPORT_ENABLED_DEFAULT;
+    _context->latency_report_length = AERON_LATENCY_REPORT_BUFFER_LENGTH_DEFAULT;
+    _context->latency_report_sample_interval_ns = AERON_LATENCY_REPORT_SAMPLE_INTERVAL_NS_DEFAULT;
     _context->file_page_size = AERON_FILE_PAGE_SIZE_DEFAULT;
     _context->low_file_store_warning_threshold = AERON_LOW_FILE_STORE_WARNING_THRESHOLD_DEFAULT;
     _context->publication_unblock_timeout_ns = AERON_PUBLICATION_UNBLOCK_TIMEOUT_NS_DEFAULT;
@@ -560,12 +617,27 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
     _context->receiver_io_vector_capacity = AERON_RECEIVER_IO_VECTOR_CAPACITY_DEFAULT;
     _context->sender_io_vector_capacity = AERON_SENDER_IO_VECTOR_CAPACITY_DEFAULT;
     _context->network_publication_max_messages_per_send = AERON_SENDER_MAX_MESSAGES_PER_SEND_DEFAULT;
+    _context->network_publication_adaptive_messages_per_send =
+        AERON_NETWORK_PUBLICATION_ADAPTIVE_MESSAGES_PER_SEND_DEFAULT;
     _context->resource_free_limit = AERON_DRIVER_RESOURCE_FREE_LIMIT_DEFAULT;
     _context->async_executor_threads = AERON_DRIVER_ASYNC_EXECUTOR_THREADS_DEFAULT;
+    _context->log_buffer_pool_size = AERON_LOG_BUFFER_POOL_SIZE_DEFAULT;
     _context->connect_enabled = AERON_DRIVER_CONNECT_DEFAULT;
     _context->conductor_cpu_affinity_no = AERON_CPU_AFFINITY_DEFAULT;
     _context->sender_cpu_affinity_no = AERON_CPU_AFFINITY_DEFAULT;
     _context->receiver_cpu_affinity_no = AERON_CPU_AFFINITY_DEFAULT;
+    _context->receiver_count = AERON_RECEIVER_COUNT_DEFAULT;
+    for (size_t i = 0; i < AERON_DRIVER_RECEIVER_COUNT_MAX; i++)
+    {
+        _context->receiver_cpu_affinity_list[i] = AERON_CPU_AFFINITY_DEFAULT;
+        _context->receiver_proxies[i] = NULL;
+    }
+    _context->sender_count = AERON_SENDER_COUNT_DEFAULT;
+    for (size_t i = 0; i < AERON_DRIVER_SENDER_COUNT_MAX; i++)
+    {
+        _context->sender_cpu_affinity_list[i] = AERON_CPU_AFFINITY_DEFAULT;
+        _context->sender_proxies[i] = NULL;
+    }
     _context->enable_experimental_features = AERON_ENABLE_EXPERIMENTAL_FEATURES_DEFAULT;
 
     char *value = NULL;
@@ -641,12 +713,32 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
     _context->term_buffer_sparse_file = aeron_parse_bool(
         getenv(AERON_TERM_BUFFER_SPARSE_FILE_ENV_VAR), _context->term_buffer_sparse_file);
 
+    _context->term_buffer_huge_pages = aeron_parse_bool(
+        getenv(AERON_TERM_BUFFER_HUGE_PAGES_ENV_VAR), _context->term_buffer_huge_pages);
+
+    _context->huge_pages_dir = getenv(AERON_HUGE_PAGES_DIR_ENV_VAR);
+
+    _context->term_buffer_clean_non_temporal = aeron_parse_bool(
+        getenv(AERON_TERM_BUFFER_CLEAN_NON_TEMPORAL_ENV_VAR), _context->term_buffer_clean_non_temporal);
+
+    _context->term_buffer_cleaner_thread = aeron_parse_bool(
+        getenv(AERON_TERM_BUFFER_CLEANER_THREAD_ENV_VAR), _context->term_buffer_cleaner_thread);
+
     _context->perform_storage_checks = aeron_parse_bool(
         getenv(AERON_PERFORM_STORAGE_CHECKS_ENV_VAR), _context->perform_storage_checks);
 
     _context->spies_simulate_connection = aeron_parse_bool(
         getenv(AERON_SPIES_SIMULATE_CONNECTION_ENV_VAR), _context->spies_simulate_connection);
 
+    _context->socket_gso_enabled = aeron_parse_bool(
+        getenv(AERON_SOCKET_GSO_ENABLED_ENV_VAR), _context->socket_gso_enabled);
+
+    _context->socket_gro_enabled = aeron_parse_bool(
+        getenv(AERON_SOCKET_GRO_ENABLED_ENV_VAR), _context->socket_gro_enabled);
+
+    _context->receiver_zero_copy_enabled = aeron_parse_bool(
+        getenv(AERON_RECEIVER_ZERO_COPY_ENABLED_ENV_VAR), _context->receiver_zero_copy_enabled);
+
     _context->print_configuration_on_start = aeron_parse_bool(
         getenv(AERON_PRINT_CONFIGURATION_ON_START_ENV_VAR), _context->print_configuration_on_start);
 
@@ -827,6 +919,23 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
         1024,
         INT32_MAX);
 
+    _context->latency_report_enabled = aeron_parse_bool(
+        getenv(AERON_LATENCY_REPORT_ENABLED_ENV_VAR), _context->latency_report_enabled);
+
+    _context->latency_report_length = aeron_config_parse_size64(
+        AERON_LATENCY_REPORT_BUFFER_LENGTH_ENV_VAR,
+        getenv(AERON_LATENCY_REPORT_BUFFER_LENGTH_ENV_VAR),
+        _context->latency_report_length,
+        1024,
+        INT32_MAX);
+
+    _context->latency_report_sample_interval_ns = aeron_config_parse_duration_ns(
+        AERON_LATENCY_REPORT_SAMPLE_INTERVAL_ENV_VAR,
+        getenv(AERON_LATENCY_REPORT_SAMPLE_INTERVAL_ENV_VAR),
+        _context->latency_report_sample_interval_ns,
+        0,
+        INT64_MAX);
+
     _context->file_page_size = aeron_config_parse_size64(
         AERON_FILE_PAGE_SIZE_ENV_VAR,
         getenv(AERON_FILE_PAGE_SIZE_ENV_VAR),
@@ -834,6 +943,13 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
         4 * 1024,
         INT32_MAX);
 
+    _context->huge_page_size = aeron_config_parse_size64(
+        AERON_HUGE_PAGE_SIZE_ENV_VAR,
+        getenv(AERON_HUGE_PAGE_SIZE_ENV_VAR),
+        _context->huge_page_size,
+        4 * 1024,
+        INT32_MAX);
+
     _context->low_file_store_warning_threshold = aeron_config_parse_size64(
         AERON_LOW_FILE_STORE_WARNING_THRESHOLD_ENV_VAR,
         getenv(AERON_LOW_FILE_STORE_WARNING_THRESHOLD_ENV_VAR),
@@ -1040,6 +1156,40 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
         1,
         AERON_DRIVER_RECEIVER_IO_VECTOR_LENGTH_MAX);
 
+    _context->receiver_count = aeron_config_parse_uint32(
+        AERON_RECEIVER_COUNT_ENV_VAR,
+        getenv(AERON_RECEIVER_COUNT_ENV_VAR),
+        _context->receiver_count,
+        1,
+        AERON_DRIVER_RECEIVER_COUNT_MAX);
+
+    if ((value = getenv(AERON_RECEIVER_CPU_AFFINITY_LIST_ENV_VAR)))
+    {
+        if (aeron_driver_context_parse_cpu_affinity_list(
+            value, _context->receiver_cpu_affinity_list, AERON_DRIVER_RECEIVER_COUNT_MAX) < 0)
+        {
+            AERON_APPEND_ERR("receiver cpu affinity list \"%s\" is invalid", value);
+            return -1;
+        }
+    }
+
+    _context->sender_count = aeron_config_parse_uint32(
+        AERON_SENDER_COUNT_ENV_VAR,
+        getenv(AERON_SENDER_COUNT_ENV_VAR),
+        _context->sender_count,
+        1,
+        AERON_DRIVER_SENDER_COUNT_MAX);
+
+    if ((value = getenv(AERON_SENDER_CPU_AFFINITY_LIST_ENV_VAR)))
+    {
+        if (aeron_driver_context_parse_cpu_affinity_list(
+            value, _context->sender_cpu_affinity_list, AERON_DRIVER_SENDER_COUNT_MAX) < 0)
+        {
+            AERON_APPEND_ERR("sender cpu affinity list \"%s\" is invalid", value);
+            return -1;
+        }
+    }
+
     _context->sender_io_vector_capacity = aeron_config_parse_uint32(
         AERON_SENDER_IO_VECTOR_CAPACITY_ENV_VAR,
         getenv(AERON_SENDER_IO_VECTOR_CAPACITY_ENV_VAR),
@@ -1054,6 +1204,10 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
         1,
         AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND);
 
+    _context->network_publication_adaptive_messages_per_send = aeron_parse_bool(
+        getenv(AERON_NETWORK_PUBLICATION_ADAPTIVE_MESSAGES_PER_SEND_ENV_VAR),
+        _context->network_publication_adaptive_messages_per_send);
+
     _context->resource_free_limit = aeron_config_parse_uint32(
         AERON_DRIVER_RESOURCE_FREE_LIMIT_ENV_VAR,
         getenv(AERON_DRIVER_RESOURCE_FREE_LIMIT_ENV_VAR),
@@ -1068,6 +1222,13 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
         0,
         1);
 
+    _context->log_buffer_pool_size = aeron_config_parse_uint32(
+        AERON_LOG_BUFFER_POOL_SIZE_ENV_VAR,
+        getenv(AERON_LOG_BUFFER_POOL_SIZE_ENV_VAR),
+        _context->log_buffer_pool_size,
+        0,
+        1024);
+
     _context->enable_experimental_features = aeron_parse_bool(
         getenv(AERON_ENABLE_EXPERIMENTAL_FEATURES_ENV_VAR), _context->enable_experimental_features);
 
@@ -1095,8 +1256,10 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
     _context->conductor_idle_strategy_name = aeron_strndup("backoff", AERON_MAX_PATH);
     _context->shared_idle_strategy_name = aeron_strndup("backoff", AERON_MAX_PATH);
     _context->shared_network_idle_strategy_name = aeron_strndup("backoff", AERON_MAX_PATH);
-    _context->sender_idle_strategy_name = aeron_strndup("backoff", AERON_MAX_PATH);
-    _context->receiver_idle_strategy_name = aeron_strndup("backoff", AERON_MAX_PATH);
+    _context->sender_idle_strategy_name = aeron_strndup(
+        AERON_CONFIG_GETENV_OR_DEFAULT(AERON_SENDER_IDLE_STRATEGY_ENV_VAR, "backoff"), AERON_MAX_PATH);
+    _context->receiver_idle_strategy_name = aeron_strndup(
+        AERON_CONFIG_GETENV_OR_DEFAULT(AERON_RECEIVER_IDLE_STRATEGY_ENV_VAR, "backoff"), AERON_MAX_PATH);
 
     _context->conductor_idle_strategy_init_args =
         AERON_CONFIG_STRNDUP_GETENV_OR_NULL(AERON_CONDUCTOR_IDLE_STRATEGY_INIT_ARGS_ENV_VAR);
@@ -1158,6 +1321,7 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
     _context->raw_log_map_func = aeron_raw_log_map;
     _context->raw_log_close_func = aeron_raw_log_close;
     _context->raw_log_free_func = aeron_raw_log_free;
+    _context->raw_log_pool = NULL;
 
     _context->log.to_driver_interceptor = aeron_driver_conductor_to_driver_interceptor_null;
     _context->log.to_client_interceptor = aeron_driver_conductor_to_client_interceptor_null;
@@ -1280,17 +1444,17 @@ static void aeron_driver_context_free_bindings(const aeron_udp_channel_intercept
     }
 }
 
-int aeron_driver_context_run_storage_checks(aeron_driver_context_t *context, uint64_t log_length)
+int aeron_driver_context_run_storage_checks(aeron_driver_context_t *context, const char *dir, uint64_t log_length)
 {
     if (context->perform_storage_checks)
     {
-        const uint64_t usable_space = context->usable_fs_space_func(context->aeron_dir);
+        const uint64_t usable_space = context->usable_fs_space_func(dir);
         if (usable_space < log_length)
         {
             AERON_SET_ERR(
                 -AERON_ERROR_CODE_STORAGE_SPACE,
                 "insufficient usable storage for new log of length=%" PRId64 " usable=%" PRId64 " in %s",
-            log_length, usable_space, context->aeron_dir);
+            log_length, usable_space, dir);
             return -1;
         }
 
@@ -1299,7 +1463,7 @@ int aeron_driver_context_run_storage_checks(aeron_driver_context_t *context, uin
             AERON_SET_ERR(
                 -AERON_ERROR_CODE_STORAGE_SPACE,
                 "WARNING: space is running low: threshold=%" PRId64 " usable=%" PRId64 " in %s",
-            context->low_file_store_warning_threshold, usable_space, context->aeron_dir);
+            context->low_file_store_warning_threshold, usable_space, dir);
             aeron_distinct_error_log_record(context->error_log, aeron_errcode(), aeron_errmsg());
             aeron_err_clear();
         }
@@ -1389,6 +1553,7 @@ int aeron_driver_context_close(aeron_driver_context_t *context)
     aeron_driver_context_free_bindings(context->udp_channel_incoming_interceptor_bindings);
 
     aeron_unmap(&context->loss_report);
+    aeron_unmap(&context->latency_report);
     aeron_unmap(&context->cnc_map);
 
     int result = 0;
@@ -1408,7 +1573,13 @@ int aeron_driver_context_close(aeron_driver_context_t *context)
         }
     }
 
+    if (context->dirs_delete_on_shutdown && NULL != context->huge_pages_log_dir)
+    {
+        aeron_delete_directory(context->huge_pages_log_dir);
+    }
+
     aeron_free(context->aeron_dir);
+    aeron_free(context->huge_pages_log_dir);
     aeron_free(context->conductor_idle_strategy_state);
     aeron_free(context->receiver_idle_strategy_state);
     aeron_free(context->sender_idle_strategy_state);
@@ -1616,6 +1787,10 @@ size_t aeron_cnc_length(aeron_driver_context_t *context)
 
 extern void aeron_cnc_version_signal_cnc_ready(aeron_cnc_metadata_t *metadata, int32_t cnc_version);
 
+extern const char *aeron_driver_context_log_dir(aeron_driver_context_t *context, bool is_huge_pages);
+
+extern size_t aeron_driver_context_log_page_size(aeron_driver_context_t *context, bool is_huge_pages);
+
 extern size_t aeron_producer_window_length(size_t producer_window_length, size_t term_length);
 
 extern size_t aeron_receiver_window_length(size_t initial_receiver_window_length, size_t term_length);
@@ -1854,6 +2029,72 @@ size_t aeron_driver_context_get_file_page_size(aeron_driver_context_t *context)
     return NULL != context ? context->file_page_size : AERON_FILE_PAGE_SIZE_DEFAULT;
 }
 
+int aeron_driver_context_set_huge_pages_dir(aeron_driver_context_t *context, const char *value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->huge_pages_dir = value;
+    return 0;
+}
+
+const char *aeron_driver_context_get_huge_pages_dir(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->huge_pages_dir : NULL;
+}
+
+int aeron_driver_context_set_huge_page_size(aeron_driver_context_t *context, size_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->huge_page_size = value;
+    return 0;
+}
+
+size_t aeron_driver_context_get_huge_page_size(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->huge_page_size : AERON_HUGE_PAGE_SIZE_DEFAULT;
+}
+
+int aeron_driver_context_set_term_buffer_huge_pages(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->term_buffer_huge_pages = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_term_buffer_huge_pages(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->term_buffer_huge_pages : AERON_TERM_BUFFER_HUGE_PAGES_DEFAULT;
+}
+
+int aeron_driver_context_set_term_buffer_clean_non_temporal(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->term_buffer_clean_non_temporal = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_term_buffer_clean_non_temporal(aeron_driver_context_t *context)
+{
+    return NULL != context ?
+        context->term_buffer_clean_non_temporal : AERON_TERM_BUFFER_CLEAN_NON_TEMPORAL_DEFAULT;
+}
+
+int aeron_driver_context_set_term_buffer_cleaner_thread(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->term_buffer_cleaner_thread = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_term_buffer_cleaner_thread(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->term_buffer_cleaner_thread : AERON_TERM_BUFFER_CLEANER_THREAD_DEFAULT;
+}
+
 int aeron_driver_context_set_mtu_length(aeron_driver_context_t *context, size_t value)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
@@ -1958,6 +2199,45 @@ uint8_t aeron_driver_context_get_socket_multicast_ttl(aeron_driver_context_t *co
     return NULL != context ? context->multicast_ttl : AERON_SOCKET_MULTICAST_TTL_DEFAULT;
 }
 
+int aeron_driver_context_set_socket_gso_enabled(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->socket_gso_enabled = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_socket_gso_enabled(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->socket_gso_enabled : AERON_SOCKET_GSO_ENABLED_DEFAULT;
+}
+
+int aeron_driver_context_set_socket_gro_enabled(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->socket_gro_enabled = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_socket_gro_enabled(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->socket_gro_enabled : AERON_SOCKET_GRO_ENABLED_DEFAULT;
+}
+
+int aeron_driver_context_set_receiver_zero_copy_enabled(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->receiver_zero_copy_enabled = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_receiver_zero_copy_enabled(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->receiver_zero_copy_enabled : AERON_RECEIVER_ZERO_COPY_ENABLED_DEFAULT;
+}
+
 int aeron_driver_context_set_send_to_status_poll_ratio(aeron_driver_context_t *context, size_t value)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
@@ -2076,6 +2356,46 @@ size_t aeron_driver_context_get_loss_report_buffer_length(aeron_driver_context_t
     return NULL != context ? context->loss_report_length : AERON_LOSS_REPORT_BUFFER_LENGTH_DEFAULT;
 }
 
+int aeron_driver_context_set_latency_report_enabled(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->latency_report_enabled = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_latency_report_enabled(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->latency_report_enabled : AERON_LATENCY_REPORT_ENABLED_DEFAULT;
+}
+
+int aeron_driver_context_set_latency_report_buffer_length(aeron_driver_context_t *context, size_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->latency_report_length = value;
+    return 0;
+}
+
+size_t aeron_driver_context_get_latency_report_buffer_length(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->latency_report_length : AERON_LATENCY_REPORT_BUFFER_LENGTH_DEFAULT;
+}
+
+int aeron_driver_context_set_latency_report_sample_interval_ns(aeron_driver_context_t *context, uint64_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->latency_report_sample_interval_ns = value;
+    return 0;
+}
+
+uint64_t aeron_driver_context_get_latency_report_sample_interval_ns(aeron_driver_context_t *context)
+{
+    return NULL != context ?
+        context->latency_report_sample_interval_ns : AERON_LATENCY_REPORT_SAMPLE_INTERVAL_NS_DEFAULT;
+}
+
 int aeron_driver_context_set_publication_unblock_timeout_ns(aeron_driver_context_t *context, uint64_t value)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
@@ -3061,6 +3381,46 @@ aeron_driver_context_bindings_clientd_entry_t *aeron_driver_context_bindings_cli
 }
 
 
+int aeron_driver_context_set_receiver_count(aeron_driver_context_t *context, uint32_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    if (value < 1 || AERON_DRIVER_RECEIVER_COUNT_MAX < value)
+    {
+        AERON_SET_ERR(
+            EINVAL, "receiver_count must be between 1 and %d: %" PRIu32, AERON_DRIVER_RECEIVER_COUNT_MAX, value);
+        return -1;
+    }
+
+    context->receiver_count = value;
+    return 0;
+}
+
+uint32_t aeron_driver_context_get_receiver_count(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->receiver_count : AERON_RECEIVER_COUNT_DEFAULT;
+}
+
+int aeron_driver_context_set_sender_count(aeron_driver_context_t *context, uint32_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    if (value < 1 || AERON_DRIVER_SENDER_COUNT_MAX < value)
+    {
+        AERON_SET_ERR(
+            EINVAL, "sender_count must be between 1 and %d: %" PRIu32, AERON_DRIVER_SENDER_COUNT_MAX, value);
+        return -1;
+    }
+
+    context->sender_count = value;
+    return 0;
+}
+
+uint32_t aeron_driver_context_get_sender_count(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->sender_count : AERON_SENDER_COUNT_DEFAULT;
+}
+
 static uint32_t aeron_driver_context_clamp_value(uint32_t value, uint32_t min, uint32_t max)
 {
     uint32_t clamped_value;
@@ -3124,6 +3484,22 @@ uint32_t aeron_driver_context_get_network_publication_max_messages_per_send(aero
         context->network_publication_max_messages_per_send : AERON_SENDER_MAX_MESSAGES_PER_SEND_DEFAULT;
 }
 
+int aeron_driver_context_set_network_publication_adaptive_messages_per_send(
+    aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->network_publication_adaptive_messages_per_send = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_network_publication_adaptive_messages_per_send(aeron_driver_context_t *context)
+{
+    return NULL != context ?
+        context->network_publication_adaptive_messages_per_send :
+        AERON_NETWORK_PUBLICATION_ADAPTIVE_MESSAGES_PER_SEND_DEFAULT;
+}
+
 int aeron_driver_context_set_resource_free_limit(aeron_driver_context_t *context, uint32_t value)
 {
     if (NULL == context)
@@ -3156,6 +3532,53 @@ uint32_t aeron_driver_context_get_async_executor_threads(aeron_driver_context_t
     return NULL != context ? context->async_executor_threads : AERON_DRIVER_ASYNC_EXECUTOR_THREADS_DEFAULT;
 }
 
+int aeron_driver_context_set_log_buffer_pool_size(aeron_driver_context_t *context, uint32_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->log_buffer_pool_size = value;
+    return 0;
+}
+
+uint32_t aeron_driver_context_get_log_buffer_pool_size(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->log_buffer_pool_size : AERON_LOG_BUFFER_POOL_SIZE_DEFAULT;
+}
+
+/*
+ * The first sender or receiver is named after its role, e.g. "receiver", and the others "<role>-<index>".
+ */
+static int32_t aeron_driver_context_agent_cpu_affinity_no(
+    const char *role_name, size_t prefix_length, const int32_t *cpu_affinity_list, size_t length, int32_t first_no)
+{
+    const char *suffix = role_name + prefix_length;
+    size_t index = 0;
+
+    if ('-' == *suffix)
+    {
+        char *end_ptr = NULL;
+        errno = 0;
+        const long value = strtol(suffix + 1, &end_ptr, 10);
+        if (0 != errno || '\0' != *end_ptr || value < 0 || (long)length <= value)
+        {
+            return AERON_CPU_AFFINITY_DEFAULT;
+        }
+
+        index = (size_t)value;
+    }
+    else if ('\0' != *suffix)
+    {
+        return AERON_CPU_AFFINITY_DEFAULT;
+    }
+
+    if (0 <= cpu_affinity_list[index])
+    {
+        return cpu_affinity_list[index];
+    }
+
+    return 0 == index ? first_no : AERON_CPU_AFFINITY_DEFAULT;
+}
+
 void aeron_set_thread_affinity_on_start(void *state, const char *role_name)
 {
     aeron_driver_context_t *context = (aeron_driver_context_t *)state;
@@ -3164,13 +3587,31 @@ void aeron_set_thread_affinity_on_start(void *state, const char *role_name)
     {
         result = aeron_thread_set_affinity(role_name, (uint8_t)context->conductor_cpu_affinity_no);
     }
-    else if (0 == strcmp("sender", role_name) && 0 <= context->sender_cpu_affinity_no)
+    else if (0 == strncmp("sender", role_name, strlen("sender")))
     {
-        result = aeron_thread_set_affinity(role_name, (uint8_t)context->sender_cpu_affinity_no);
+        int32_t cpu_affinity_no = aeron_driver_context_agent_cpu_affinity_no(
+            role_name,
+            strlen("sender"),
+            context->sender_cpu_affinity_list,
+            AERON_DRIVER_SENDER_COUNT_MAX,
+            context->sender_cpu_affinity_no);
+        if (0 <= cpu_affinity_no)
+        {
+            result = aeron_thread_set_affinity(role_name, (uint8_t)cpu_affinity_no);
+        }
     }
-    else if (0 == strcmp("receiver", role_name) && 0 <= context->receiver_cpu_affinity_no)
+    else if (0 == strncmp("receiver", role_name, strlen("receiver")))
     {
-        result = aeron_thread_set_affinity(role_name, (uint8_t)context->receiver_cpu_affinity_no);
+        int32_t cpu_affinity_no = aeron_driver_context_agent_cpu_affinity_no(
+            role_name,
+            strlen("receiver"),
+            context->receiver_cpu_affinity_list,
+            AERON_DRIVER_RECEIVER_COUNT_MAX,
+            context->receiver_cpu_affinity_no);
+        if (0 <= cpu_affinity_no)
+        {
+            result = aeron_thread_set_affinity(role_name, (uint8_t)cpu_affinity_no);
+        }
     }
 
     if (result < 0)
@@ -44,6 +44,8 @@
 
 #define AERON_DRIVER_RECEIVER_IO_VECTOR_LENGTH_MAX (16)
 #define AERON_DRIVER_RECEIVER_MAX_UDP_PACKET_LENGTH (64 * 1024)
+#define AERON_DRIVER_RECEIVER_COUNT_MAX (16)
+#define AERON_DRIVER_SENDER_COUNT_MAX (16)
 
 #define AERON_TO_CONDUCTOR_BUFFER_LENGTH_DEFAULT (1024 * 1024 + AERON_RB_TRAILER_LENGTH)
 #define AERON_TO_CLIENTS_BUFFER_LENGTH_DEFAULT (1024 * 1024 + AERON_BROADCAST_BUFFER_TRAILER_LENGTH)
@@ -121,12 +123,18 @@ typedef void (*aeron_driver_name_resolver_on_host_name_t)(
 typedef struct aeron_driver_context_stct
 {
     char *aeron_dir;                                        /* aeron.dir */
+    const char *huge_pages_dir;                             /* aeron.huge.pages.dir */
+    char *huge_pages_log_dir;
     aeron_threading_mode_t threading_mode;                  /* aeron.threading.mode = DEDICATED */
     aeron_inferable_boolean_t receiver_group_consideration; /* aeron.receiver.group.consideration = INFER */
     bool dirs_delete_on_start;                              /* aeron.dir.delete.on.start = false */
     bool dirs_delete_on_shutdown;                           /* aeron.dir.delete.on.shutdown = false */
     bool warn_if_dirs_exist;                                /* aeron.dir.warn.if.exists = false */
     bool term_buffer_sparse_file;                           /* aeron.term.buffer.sparse.file = false */
+    bool term_buffer_huge_pages;                            /* aeron.term.buffer.huge.pages = false */
+    bool term_buffer_clean_non_temporal;                    /* aeron.term.buffer.clean.non.temporal = false */
+    bool term_buffer_cleaner_thread;                        /* aeron.term.buffer.cleaner.thread = false */
+    bool network_publication_adaptive_messages_per_send;    /* aeron.network.publication.adaptive.messages.per.send = false */
     bool perform_storage_checks;                            /* aeron.perform.storage.checks = true */
     bool spies_simulate_connection;                         /* aeron.spies.simulate.connection = false */
     bool print_configuration_on_start;                      /* aeron.print.configuration = false */
@@ -135,6 +143,10 @@ typedef struct aeron_driver_context_stct
     bool rejoin_stream;                                     /* aeron.rejoin.stream = true */
     bool ats_enabled;
     bool connect_enabled;                                   /* aeron.driver.connect = true */
+    bool socket_gso_enabled;                                /* aeron.socket.gso.enabled = false */
+    bool socket_gro_enabled;                                /* aeron.socket.gro.enabled = false */
+    bool receiver_zero_copy_enabled;                        /* aeron.receiver.zero.copy.enabled = false */
+    bool latency_report_enabled;                            /* aeron.latency.report.enabled = false */
     uint64_t driver_timeout_ms;                             /* aeron.driver.timeout = 10s */
     uint64_t client_liveness_timeout_ns;                    /* aeron.client.liveness.timeout = 10s */
     uint64_t publication_linger_timeout_ns;                 /* aeron.publication.linger.timeout = 5s */
@@ -152,6 +164,7 @@ typedef struct aeron_driver_context_stct
     uint64_t nak_unicast_retry_delay_ratio;                 /* aeron.nak.unicast.retry.delay.ratio = 100 */
     uint64_t nak_multicast_max_backoff_ns;                  /* aeron.nak.multicast.max.backoff = 60ms */
     uint64_t re_resolution_check_interval_ns;               /* aeron.driver.reresolution.check.interval = 1s */
+    uint64_t latency_report_sample_interval_ns;             /* aeron.latency.report.sample.interval = 1ms */
     uint64_t low_file_store_warning_threshold;              /* aeron.low.file.store.warning.threshold = 160MB */
     size_t to_driver_buffer_length;                         /* aeron.conductor.buffer.length = 1MB + trailer*/
     size_t to_clients_buffer_length;                        /* aeron.clients.buffer.length = 1MB + trailer */
@@ -168,7 +181,9 @@ typedef struct aeron_driver_context_stct
     size_t send_to_sm_poll_ratio;                           /* aeron.send.to.status.poll.ratio = 6 */
     size_t initial_window_length;                           /* aeron.rcv.initial.window.length = 128KB */
     size_t loss_report_length;                              /* aeron.loss.report.buffer.length = 1MB */
+    size_t latency_report_length;                           /* aeron.latency.report.buffer.length = 1MB */
     size_t file_page_size;                                  /* aeron.file.page.size = 4KB */
+    size_t huge_page_size;                                  /* aeron.huge.page.size = 2MB */
     size_t nak_multicast_group_size;                        /* aeron.nak.multicast.group.size = 10 */
     int32_t publication_reserved_session_id_low;            /* aeron.publication.reserved.session.id.low = -1 */
     int32_t publication_reserved_session_id_high;           /* aeron.publication.reserved.session.id.high = 1000 */
@@ -178,10 +193,15 @@ typedef struct aeron_driver_context_stct
     uint32_t network_publication_max_messages_per_send;     /* aeron.network.publication.max.messages.per.send = 2 */
     uint32_t resource_free_limit;                           /* aeron.driver.resource.free.limit = 10 */
     uint32_t async_executor_threads;                        /* aeron.driver.async.executor.threads = 1 */
+    uint32_t log_buffer_pool_size;                          /* aeron.log.buffer.pool.size = 0 */
+    uint32_t receiver_count;                                /* aeron.receiver.count = 1 */
+    uint32_t sender_count;                                  /* aeron.sender.count = 1 */
 
     int32_t conductor_cpu_affinity_no;                      /* aeron.conductor.cpu.affinity = -1 */
     int32_t receiver_cpu_affinity_no;                       /* aeron.receiver.cpu.affinity = -1 */
     int32_t sender_cpu_affinity_no;                         /* aeron.sender.cpu.affinity = -1 */
+    int32_t receiver_cpu_affinity_list[AERON_DRIVER_RECEIVER_COUNT_MAX]; /* aeron.receiver.cpu.affinity.list = <unset> */
+    int32_t sender_cpu_affinity_list[AERON_DRIVER_SENDER_COUNT_MAX]; /* aeron.sender.cpu.affinity.list = <unset> */
     bool enable_experimental_features;                      /* aeron.enable.experimental.features = false */
 
     struct                                                  /* aeron.receiver.receiver.tag = <unset> */
@@ -200,6 +220,7 @@ typedef struct aeron_driver_context_stct
 
     aeron_mapped_file_t cnc_map;
     aeron_mapped_file_t loss_report;
+    aeron_mapped_file_t latency_report;
 
     uint8_t *to_driver_buffer;
     uint8_t *to_clients_buffer;
@@ -249,6 +270,8 @@ typedef struct aeron_driver_context_stct
     aeron_raw_log_map_func_t raw_log_map_func;
     aeron_raw_log_close_func_t raw_log_close_func;
     aeron_raw_log_free_func_t raw_log_free_func;
+    struct aeron_raw_log_pool_stct *raw_log_pool;
+    struct aeron_term_cleaner_stct *term_cleaner;
 
     aeron_flow_control_strategy_supplier_func_t unicast_flow_control_supplier_func;
     aeron_flow_control_strategy_supplier_func_t multicast_flow_control_supplier_func;
@@ -257,7 +280,9 @@ typedef struct aeron_driver_context_stct
 
     aeron_driver_conductor_proxy_t *conductor_proxy;
     aeron_driver_sender_proxy_t *sender_proxy;
+    aeron_driver_sender_proxy_t *sender_proxies[AERON_DRIVER_SENDER_COUNT_MAX];
     aeron_driver_receiver_proxy_t *receiver_proxy;
+    aeron_driver_receiver_proxy_t *receiver_proxies[AERON_DRIVER_RECEIVER_COUNT_MAX];
 
     aeron_counters_manager_t *counters_manager;
     aeron_system_counters_t *system_counters;
@@ -355,7 +380,7 @@ int aeron_driver_context_validate_mtu_length(uint64_t mtu_length);
 
 size_t aeron_cnc_length(aeron_driver_context_t *context);
 
-int aeron_driver_context_run_storage_checks(aeron_driver_context_t *context, uint64_t log_length);
+int aeron_driver_context_run_storage_checks(aeron_driver_context_t *context, const char *dir, uint64_t log_length);
 
 int aeron_driver_context_bindings_clientd_create_entries(aeron_driver_context_t *context);
 int aeron_driver_context_bindings_clientd_delete_entries(aeron_driver_context_t *context);
@@ -370,6 +395,20 @@ inline void aeron_cnc_version_signal_cnc_ready(aeron_cnc_metadata_t *metadata, i
     AERON_PUT_VOLATILE(metadata->cnc_version, cnc_version);
 }
 
+/*
+ * Log buffers that use huge pages live under the driver's directory on the hugetlbfs mount, which is only set once
+ * the driver has recreated it on start.
+ */
+inline const char *aeron_driver_context_log_dir(aeron_driver_context_t *context, bool is_huge_pages)
+{
+    return is_huge_pages ? context->huge_pages_log_dir : context->aeron_dir;
+}
+
+inline size_t aeron_driver_context_log_page_size(aeron_driver_context_t *context, bool is_huge_pages)
+{
+    return is_huge_pages ? context->huge_page_size : context->file_page_size;
+}
+
 inline size_t aeron_producer_window_length(size_t producer_window_length, size_t term_length)
 {
     size_t window_length = term_length / 2;
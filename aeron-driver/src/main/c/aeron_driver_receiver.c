@@ -21,6 +21,7 @@
 
 #include <stdio.h>
 #include "util/aeron_arrayutil.h"
+#include "concurrent/aeron_term_rebuilder.h"
 #include "media/aeron_receive_channel_endpoint.h"
 #include "aeron_driver_receiver.h"
 
@@ -32,12 +33,68 @@ struct mmsghdr
 };
 #endif
 
+static int aeron_driver_receiver_init_agent_resources(aeron_driver_receiver_t *receiver, aeron_driver_context_t *context)
+{
+    if (0 == receiver->index)
+    {
+        receiver->receiver_proxy.command_queue = &context->receiver_command_queue;
+        receiver->cached_clock = context->receiver_cached_clock;
+        receiver->duty_cycle_tracker = context->receiver_duty_cycle_tracker;
+        return 0;
+    }
+
+    const size_t command_rb_capacity = (AERON_COMMAND_RB_CAPACITY * 1024) + AERON_RB_TRAILER_LENGTH;
+    void *command_buffer;
+    if (aeron_alloc(&command_buffer, command_rb_capacity) < 0)
+    {
+        AERON_APPEND_ERR("%s", "Failed to allocate receiver command queue");
+        return -1;
+    }
+
+    if (aeron_mpsc_rb_init(&receiver->command_queue, command_buffer, command_rb_capacity) < 0)
+    {
+        aeron_free(command_buffer);
+        AERON_APPEND_ERR("%s", "Failed to init receiver command queue");
+        return -1;
+    }
+
+    if (aeron_clock_cache_alloc(&receiver->cached_clock) < 0)
+    {
+        AERON_APPEND_ERR("%s", "Failed to allocate receiver cached clock");
+        return -1;
+    }
+
+    aeron_duty_cycle_stall_tracker_t *stall_tracker = &receiver->duty_cycle_stall_tracker;
+    stall_tracker->tracker.update = aeron_duty_cycle_stall_tracker_update;
+    stall_tracker->tracker.measure_and_update = aeron_duty_cycle_stall_tracker_measure_and_update;
+    stall_tracker->tracker.state = stall_tracker;
+    stall_tracker->cycle_threshold_ns = context->receiver_duty_cycle_stall_tracker.cycle_threshold_ns;
+    stall_tracker->max_cycle_time_counter = context->receiver_duty_cycle_stall_tracker.max_cycle_time_counter;
+    stall_tracker->cycle_time_threshold_exceeded_counter =
+        context->receiver_duty_cycle_stall_tracker.cycle_time_threshold_exceeded_counter;
+
+    receiver->receiver_proxy.command_queue = &receiver->command_queue;
+    receiver->duty_cycle_tracker = &stall_tracker->tracker;
+
+    return 0;
+}
+
 int aeron_driver_receiver_init(
     aeron_driver_receiver_t *receiver,
     aeron_driver_context_t *context,
     aeron_system_counters_t *system_counters,
-    aeron_distinct_error_log_t *error_log)
+    aeron_distinct_error_log_t *error_log,
+    size_t index)
 {
+    receiver->index = index;
+    receiver->command_queue.buffer = NULL;
+    receiver->cached_clock = NULL;
+
+    if (aeron_driver_receiver_init_agent_resources(receiver, context) < 0)
+    {
+        return -1;
+    }
+
     if (context->udp_channel_transport_bindings->poller_init_func(
         &receiver->poller, context, AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER) < 0)
     {
@@ -87,7 +144,14 @@ int aeron_driver_receiver_init(
     receiver->recvmmsg_func = context->udp_channel_transport_bindings->recvmmsg_func;
     receiver->error_log = error_log;
 
-    receiver->receiver_proxy.command_queue = &context->receiver_command_queue;
+    // Receiving into the term buffer bypasses the poller and any incoming interceptors, so it is only used with the
+    // default socket based bindings.
+    receiver->is_zero_copy_enabled =
+        context->receiver_zero_copy_enabled &&
+        aeron_udp_transport_poller_poll == receiver->poller_poll_func &&
+        aeron_udp_channel_transport_recvmmsg == receiver->recvmmsg_func &&
+        aeron_receive_channel_endpoint_dispatch == receiver->data_paths.recv_func;
+
     receiver->receiver_proxy.fail_counter = aeron_system_counter_addr(
         system_counters, AERON_SYSTEM_COUNTER_RECEIVER_PROXY_FAILS);
     receiver->receiver_proxy.threading_mode = context->threading_mode;
@@ -104,7 +168,7 @@ int aeron_driver_receiver_init(
 
     int64_t now_ns = context->nano_clock();
     receiver->re_resolution_deadline_ns = now_ns + (int64_t)context->re_resolution_check_interval_ns;
-    aeron_duty_cycle_tracker_t *tracker = receiver->context->receiver_duty_cycle_tracker;
+    aeron_duty_cycle_tracker_t *tracker = receiver->duty_cycle_tracker;
     tracker->update(tracker->state, now_ns);
 
     return 0;
@@ -120,6 +184,174 @@ static void aeron_driver_receiver_on_rb_command_queue(
     cmd->func(clientd, cmd);
 }
 
+static aeron_receive_destination_t *aeron_driver_receiver_zero_copy_destination(
+    aeron_driver_receiver_t *receiver, aeron_publication_image_t *image)
+{
+    aeron_receive_channel_endpoint_t *endpoint = image->endpoint;
+
+    if (NULL == endpoint ||
+        endpoint->conductor_fields.udp_channel->is_multicast ||
+        1 != endpoint->destinations.length ||
+        image->is_end_of_stream)
+    {
+        return NULL;
+    }
+
+    aeron_receive_destination_t *destination = endpoint->destinations.array[0].destination;
+    if (0 != destination->transport.timestamp_flags ||
+        0 != (destination->transport.offload_flags & AERON_UDP_CHANNEL_TRANSPORT_OFFLOAD_GRO))
+    {
+        return NULL;
+    }
+
+    // Datagrams for other images sharing the endpoint would always take the slower fallback path.
+    for (size_t i = 0, length = receiver->images.length; i < length; i++)
+    {
+        aeron_publication_image_t *other = receiver->images.array[i].image;
+        if (other != image && other->endpoint == endpoint)
+        {
+            return NULL;
+        }
+    }
+
+    return destination;
+}
+
+/*
+ * Receive datagrams for an established unicast image with the payload landing directly in the term buffer at the next
+ * expected position. The header is received into the first receive buffer and the payload into the term, with any
+ * excess spilling into the receive buffer. If the header looks like the next expected frame it is dispatched from the
+ * receive buffer with the image told where its payload lies, so the image only writes the header, publishing the
+ * frame, once it has accepted the packet as it would a copied one. If it is not accepted, or the datagram is not the
+ * next expected frame, the term is restored to zeros, with the payload first moved back to the receive buffer for a
+ * datagram dispatched as normal. Only done when nothing has been received beyond the next expected position and
+ * within the flow control window, so the bytes written are not visible to any reader until published.
+ */
+static int aeron_driver_receiver_zero_copy_poll(
+    aeron_driver_receiver_t *receiver, aeron_publication_image_t *image, size_t vlen, int64_t *bytes_received)
+{
+    aeron_receive_destination_t *destination = aeron_driver_receiver_zero_copy_destination(receiver, image);
+    if (NULL == destination)
+    {
+        return 0;
+    }
+
+    aeron_udp_channel_transport_t *transport = &destination->transport;
+    uint8_t *recv_buffer = receiver->recv_buffers.iov[0].iov_base;
+    int work_count = 0;
+
+    for (size_t i = 0; i < vlen; i++)
+    {
+        const int64_t rcv_position = aeron_counter_get_volatile(image->rcv_pos_position.value_addr);
+        const int64_t position = image->rcv_contiguous_position > rcv_position ?
+            image->rcv_contiguous_position : rcv_position;
+
+        if (position != aeron_counter_get(image->rcv_hwm_position.value_addr))
+        {
+            break;
+        }
+
+        const int32_t term_offset = (int32_t)(position & image->term_length_mask);
+        const size_t index = aeron_logbuffer_index_by_position(position, image->position_bits_to_shift);
+        uint8_t *term_frame = image->mapped_raw_log.term_buffers[index].addr + term_offset;
+
+        int64_t limit = image->term_length - term_offset;
+        limit = limit < image->mtu_length ? limit : image->mtu_length;
+        limit = limit < image->last_overrun_threshold - position ? limit : image->last_overrun_threshold - position;
+
+        if (limit <= (int64_t)AERON_DATA_HEADER_LENGTH || 0 != ((aeron_frame_header_t *)term_frame)->frame_length)
+        {
+            break;
+        }
+
+        struct iovec iov[3];
+        iov[0].iov_base = recv_buffer;
+        iov[0].iov_len = AERON_DATA_HEADER_LENGTH;
+        iov[1].iov_base = term_frame + AERON_DATA_HEADER_LENGTH;
+        iov[1].iov_len = (size_t)limit - AERON_DATA_HEADER_LENGTH;
+        iov[2].iov_base = recv_buffer + limit;
+        iov[2].iov_len = AERON_DRIVER_RECEIVER_MAX_UDP_PACKET_LENGTH - (size_t)limit;
+
+        struct msghdr msg;
+        msg.msg_name = &receiver->recv_buffers.addrs[0];
+        msg.msg_namelen = sizeof(receiver->recv_buffers.addrs[0]);
+        msg.msg_iov = iov;
+        msg.msg_iovlen = 3;
+        msg.msg_flags = 0;
+        msg.msg_control = NULL;
+        msg.msg_controllen = 0;
+
+        ssize_t result = aeron_recvmsg(transport->recv_fd, &msg, 0);
+        if (result < 0)
+        {
+            AERON_APPEND_ERR("%s", "");
+            return -1;
+        }
+
+        if (0 == result)
+        {
+            break;
+        }
+
+        const size_t length = (size_t)result;
+        const size_t length_in_term = length < (size_t)limit ? length : (size_t)limit;
+        aeron_data_header_t *data_header = (aeron_data_header_t *)recv_buffer;
+        const int32_t term_id = aeron_add_wrap_i32(
+            image->initial_term_id, (int32_t)(position >> image->position_bits_to_shift));
+
+        const bool is_next_frame =
+            length > AERON_DATA_HEADER_LENGTH &&
+            length <= (size_t)limit &&
+            AERON_FRAME_HEADER_VERSION == data_header->frame_header.version &&
+            AERON_HDR_TYPE_DATA == data_header->frame_header.type &&
+            data_header->frame_header.frame_length > 0 &&
+            data_header->session_id == image->session_id &&
+            data_header->stream_id == image->stream_id &&
+            data_header->term_id == term_id &&
+            data_header->term_offset == term_offset;
+
+        const size_t payload_in_term = length_in_term > AERON_DATA_HEADER_LENGTH ?
+            length_in_term - AERON_DATA_HEADER_LENGTH : 0;
+        if (is_next_frame)
+        {
+            image->zero_copy_frame = term_frame;
+        }
+        else if (payload_in_term > 0)
+        {
+            memcpy(recv_buffer + AERON_DATA_HEADER_LENGTH, term_frame + AERON_DATA_HEADER_LENGTH, payload_in_term);
+            memset(term_frame + AERON_DATA_HEADER_LENGTH, 0, payload_in_term);
+        }
+
+        receiver->data_paths.recv_func(
+            &receiver->data_paths,
+            transport,
+            receiver,
+            transport->dispatch_clientd,
+            transport->destination_clientd,
+            recv_buffer,
+            length,
+            &receiver->recv_buffers.addrs[0],
+            NULL);
+
+        image->zero_copy_frame = NULL;
+        *bytes_received += (int64_t)length;
+        work_count++;
+
+        if (!is_next_frame)
+        {
+            break;
+        }
+
+        if (0 == ((aeron_frame_header_t *)term_frame)->frame_length)
+        {
+            memset(term_frame + AERON_DATA_HEADER_LENGTH, 0, payload_in_term);
+            break;
+        }
+    }
+
+    return work_count;
+}
+
 int aeron_driver_receiver_do_work(void *clientd)
 {
     struct mmsghdr mmsghdr[AERON_DRIVER_RECEIVER_IO_VECTOR_LENGTH_MAX];
@@ -127,9 +359,9 @@ int aeron_driver_receiver_do_work(void *clientd)
 
     const size_t vlen = receiver->recv_buffers.vector_capacity;
     int64_t now_ns = receiver->context->nano_clock();
-    aeron_clock_update_cached_nano_time(receiver->context->receiver_cached_clock, now_ns);
+    aeron_clock_update_cached_nano_time(receiver->cached_clock, now_ns);
 
-    aeron_duty_cycle_tracker_t *tracker = receiver->context->receiver_duty_cycle_tracker;
+    aeron_duty_cycle_tracker_t *tracker = receiver->duty_cycle_tracker;
     tracker->measure_and_update(tracker->state, now_ns);
 
     int work_count = (int)aeron_mpsc_rb_read(
@@ -137,6 +369,7 @@ int aeron_driver_receiver_do_work(void *clientd)
         aeron_driver_receiver_on_rb_command_queue,
         receiver,
         AERON_COMMAND_DRAIN_LIMIT);
+    work_count += aeron_udp_channel_data_paths_poll(&receiver->data_paths, now_ns);
 
     for (size_t i = 0; i < vlen; i++)
     {
@@ -151,6 +384,19 @@ int aeron_driver_receiver_do_work(void *clientd)
     }
 
     int64_t bytes_received = 0;
+    if (receiver->is_zero_copy_enabled)
+    {
+        for (size_t i = 0, length = receiver->images.length; i < length; i++)
+        {
+            if (aeron_driver_receiver_zero_copy_poll(
+                receiver, receiver->images.array[i].image, vlen, &bytes_received) < 0)
+            {
+                AERON_APPEND_ERR("%s", "receiver zero copy poll");
+                aeron_driver_receiver_log_error(receiver);
+            }
+        }
+    }
+
     int poll_result = receiver->poller_poll_func(
         &receiver->poller,
         mmsghdr,
@@ -168,7 +414,10 @@ int aeron_driver_receiver_do_work(void *clientd)
 
     work_count += bytes_received > 0 ? (int)bytes_received : 0;
 
-    aeron_counter_add_ordered(receiver->total_bytes_received_counter, bytes_received);
+    if (bytes_received > 0)
+    {
+        aeron_counter_increment(receiver->total_bytes_received_counter, bytes_received);
+    }
 
     for (size_t i = 0, length = receiver->images.length; i < length; i++)
     {
@@ -270,6 +519,12 @@ void aeron_driver_receiver_on_close(void *clientd)
     aeron_udp_channel_data_paths_delete(&receiver->data_paths);
 
     receiver->context->udp_channel_transport_bindings->poller_close_func(&receiver->poller);
+
+    if (0 != receiver->index)
+    {
+        aeron_free(receiver->command_queue.buffer);
+        aeron_free(receiver->cached_clock);
+    }
 }
 
 void aeron_driver_receiver_on_add_endpoint(void *clientd, void *command)
@@ -575,7 +830,7 @@ void aeron_driver_receiver_on_resolution_change(void *clientd, void *item)
             pending_setup->is_periodic)
         {
             memcpy(&pending_setup->control_addr, &cmd->new_addr, sizeof(pending_setup->control_addr));
-            aeron_counter_add_ordered(receiver->resolution_changes_counter, 1);
+            aeron_counter_increment(receiver->resolution_changes_counter, 1);
         }
     }
 
@@ -607,7 +862,7 @@ int aeron_driver_receiver_add_pending_setup(
     entry->destination = destination;
     entry->session_id = session_id;
     entry->stream_id = stream_id;
-    entry->time_of_status_message_ns = aeron_clock_cached_nano_time(receiver->context->receiver_cached_clock);
+    entry->time_of_status_message_ns = aeron_clock_cached_nano_time(receiver->cached_clock);
     entry->is_periodic = false;
     if (NULL != control_addr)
     {
@@ -75,10 +75,17 @@ typedef struct aeron_driver_receiver_stct
 
     aeron_udp_channel_data_paths_t data_paths;
 
+    size_t index;
+    aeron_mpsc_rb_t command_queue;
+    aeron_clock_cache_t *cached_clock;
+    aeron_duty_cycle_tracker_t *duty_cycle_tracker;
+    aeron_duty_cycle_stall_tracker_t duty_cycle_stall_tracker;
+
     aeron_driver_context_t *context;
     aeron_udp_transport_poller_poll_func_t poller_poll_func;
     aeron_udp_channel_transport_recvmmsg_func_t recvmmsg_func;
     aeron_distinct_error_log_t *error_log;
+    bool is_zero_copy_enabled;
     int64_t re_resolution_deadline_ns;
 
     int64_t *errors_counter;
@@ -95,11 +102,16 @@ inline void aeron_driver_receiver_log_error(aeron_driver_receiver_t *receiver)
     aeron_err_clear();
 }
 
+/*
+ * Initialise the receiver at the given index. The first receiver uses the command queue, cached clock and duty cycle
+ * tracker of the context while the others allocate their own.
+ */
 int aeron_driver_receiver_init(
     aeron_driver_receiver_t *receiver,
     aeron_driver_context_t *context,
     aeron_system_counters_t *system_counters,
-    aeron_distinct_error_log_t *error_log);
+    aeron_distinct_error_log_t *error_log,
+    size_t index);
 
 int aeron_driver_receiver_do_work(void *clientd);
 void aeron_driver_receiver_on_close(void *clientd);
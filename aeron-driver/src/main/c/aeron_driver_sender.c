@@ -34,12 +34,68 @@ struct mmsghdr
 #include "media/aeron_send_channel_endpoint.h"
 #include "aeron_driver_sender.h"
 
+static int aeron_driver_sender_init_agent_resources(aeron_driver_sender_t *sender, aeron_driver_context_t *context)
+{
+    if (0 == sender->index)
+    {
+        sender->sender_proxy.command_queue = &context->sender_command_queue;
+        sender->cached_clock = context->sender_cached_clock;
+        sender->duty_cycle_tracker = context->sender_duty_cycle_tracker;
+        return 0;
+    }
+
+    const size_t command_rb_capacity = (AERON_COMMAND_RB_CAPACITY * 1024) + AERON_RB_TRAILER_LENGTH;
+    void *command_buffer;
+    if (aeron_alloc(&command_buffer, command_rb_capacity) < 0)
+    {
+        AERON_APPEND_ERR("%s", "Failed to allocate sender command queue");
+        return -1;
+    }
+
+    if (aeron_mpsc_rb_init(&sender->command_queue, command_buffer, command_rb_capacity) < 0)
+    {
+        aeron_free(command_buffer);
+        AERON_APPEND_ERR("%s", "Failed to init sender command queue");
+        return -1;
+    }
+
+    if (aeron_clock_cache_alloc(&sender->cached_clock) < 0)
+    {
+        AERON_APPEND_ERR("%s", "Failed to allocate sender cached clock");
+        return -1;
+    }
+
+    aeron_duty_cycle_stall_tracker_t *stall_tracker = &sender->duty_cycle_stall_tracker;
+    stall_tracker->tracker.update = aeron_duty_cycle_stall_tracker_update;
+    stall_tracker->tracker.measure_and_update = aeron_duty_cycle_stall_tracker_measure_and_update;
+    stall_tracker->tracker.state = stall_tracker;
+    stall_tracker->cycle_threshold_ns = context->sender_duty_cycle_stall_tracker.cycle_threshold_ns;
+    stall_tracker->max_cycle_time_counter = context->sender_duty_cycle_stall_tracker.max_cycle_time_counter;
+    stall_tracker->cycle_time_threshold_exceeded_counter =
+        context->sender_duty_cycle_stall_tracker.cycle_time_threshold_exceeded_counter;
+
+    sender->sender_proxy.command_queue = &sender->command_queue;
+    sender->duty_cycle_tracker = &stall_tracker->tracker;
+
+    return 0;
+}
+
 int aeron_driver_sender_init(
     aeron_driver_sender_t *sender,
     aeron_driver_context_t *context,
     aeron_system_counters_t *system_counters,
-    aeron_distinct_error_log_t *error_log)
+    aeron_distinct_error_log_t *error_log,
+    size_t index)
 {
+    sender->index = index;
+    sender->command_queue.buffer = NULL;
+    sender->cached_clock = NULL;
+
+    if (aeron_driver_sender_init_agent_resources(sender, context) < 0)
+    {
+        return -1;
+    }
+
     if (context->udp_channel_transport_bindings->poller_init_func(
         &sender->poller, context, AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_SENDER) < 0)
     {
@@ -81,7 +137,6 @@ int aeron_driver_sender_init(
     sender->recvmmsg_func = context->udp_channel_transport_bindings->recvmmsg_func;
     sender->error_log = error_log;
     sender->sender_proxy.sender = sender;
-    sender->sender_proxy.command_queue = &context->sender_command_queue;
     sender->sender_proxy.fail_counter =
         aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_SENDER_PROXY_FAILS);
     sender->sender_proxy.threading_mode = context->threading_mode;
@@ -110,7 +165,7 @@ int aeron_driver_sender_init(
 
     int64_t now_ns = context->nano_clock();
     sender->re_resolution_deadline_ns = now_ns + (int64_t)context->re_resolution_check_interval_ns;
-    aeron_duty_cycle_tracker_t *dutyCycleTracker = sender->context->sender_duty_cycle_tracker;
+    aeron_duty_cycle_tracker_t *dutyCycleTracker = sender->duty_cycle_tracker;
     dutyCycleTracker->update(dutyCycleTracker->state, now_ns);
 
     return 0;
@@ -131,13 +186,14 @@ int aeron_driver_sender_do_work(void *clientd)
     aeron_driver_sender_t *sender = (aeron_driver_sender_t *)clientd;
 
     int64_t now_ns = sender->context->nano_clock();
-    aeron_clock_update_cached_nano_time(sender->context->sender_cached_clock, now_ns);
+    aeron_clock_update_cached_nano_time(sender->cached_clock, now_ns);
 
-    aeron_duty_cycle_tracker_t *tracker = sender->context->sender_duty_cycle_tracker;
+    aeron_duty_cycle_tracker_t *tracker = sender->duty_cycle_tracker;
     tracker->measure_and_update(tracker->state, now_ns);
 
     int work_count = (int)aeron_mpsc_rb_read(
         sender->sender_proxy.command_queue, aeron_driver_sender_on_rb_command_queue, sender, AERON_COMMAND_DRAIN_LIMIT);
+    work_count += aeron_udp_channel_data_paths_poll(&sender->data_paths, now_ns);
 
     int64_t bytes_received = 0;
     int64_t short_sends_before = aeron_counter_get(sender->short_sends_counter);
@@ -202,6 +258,12 @@ void aeron_driver_sender_on_close(void *clientd)
 
     sender->context->udp_channel_transport_bindings->poller_close_func(&sender->poller);
     aeron_free(sender->network_publications.array);
+
+    if (0 != sender->index)
+    {
+        aeron_free(sender->command_queue.buffer);
+        aeron_free(sender->cached_clock);
+    }
 }
 
 void aeron_driver_sender_on_add_endpoint(void *clientd, void *command)
@@ -369,7 +431,7 @@ void aeron_driver_sender_on_resolution_change(void *clientd, void *command)
         aeron_driver_sender_log_error(sender);
     }
 
-    aeron_counter_add_ordered(sender->resolution_changes_counter, 1);
+    aeron_counter_increment(sender->resolution_changes_counter, 1);
 }
 
 int aeron_driver_sender_do_send(aeron_driver_sender_t *sender, int64_t now_ns)
@@ -412,7 +474,10 @@ int aeron_driver_sender_do_send(aeron_driver_sender_t *sender, int64_t now_ns)
         }
     }
 
-    aeron_counter_add_ordered(sender->total_bytes_sent_counter, bytes_sent);
+    if (bytes_sent > 0)
+    {
+        aeron_counter_increment(sender->total_bytes_sent_counter, bytes_sent);
+    }
 
     return bytes_sent;
 }
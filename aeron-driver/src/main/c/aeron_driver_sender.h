@@ -54,6 +54,12 @@ typedef struct aeron_driver_sender_stct
 
     aeron_udp_channel_data_paths_t data_paths;
 
+    size_t index;
+    aeron_mpsc_rb_t command_queue;
+    aeron_clock_cache_t *cached_clock;
+    aeron_duty_cycle_tracker_t *duty_cycle_tracker;
+    aeron_duty_cycle_stall_tracker_t duty_cycle_stall_tracker;
+
     volatile int64_t *total_bytes_sent_counter;
     volatile int64_t *errors_counter;
     volatile int64_t *invalid_frames_counter;
@@ -84,11 +90,16 @@ inline void aeron_driver_sender_log_error(aeron_driver_sender_t *sender)
     aeron_err_clear();
 }
 
+/*
+ * Initialise the sender at the given index. The first sender uses the command queue, cached clock and duty cycle
+ * tracker of the context while the others allocate their own.
+ */
 int aeron_driver_sender_init(
     aeron_driver_sender_t *sender,
     aeron_driver_context_t *context,
     aeron_system_counters_t *system_counters,
-    aeron_distinct_error_log_t *error_log);
+    aeron_distinct_error_log_t *error_log,
+    size_t index);
 
 int aeron_driver_sender_do_work(void *clientd);
 void aeron_driver_sender_on_close(void *clientd);
@@ -0,0 +1,297 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <string.h>
+
+#include "concurrent/aeron_atomic.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+#include "util/aeron_bitutil.h"
+#include "util/aeron_error.h"
+#include "util/aeron_platform.h"
+#include "aeron_alloc.h"
+#include "aeron_fec.h"
+
+#if defined(AERON_CPU_X64)
+#include <emmintrin.h>
+#endif
+
+#if defined(AERON_CPU_ARM)
+#include <arm_neon.h>
+#endif
+
+void aeron_fec_xor(uint8_t *dst, const uint8_t *src, size_t length)
+{
+    size_t i = 0;
+
+    // SSE2 and NEON are baseline for their architectures so there is nothing to dispatch on
+#if defined(AERON_CPU_X64)
+    for (; i + 16 <= length; i += 16)
+    {
+        const __m128i a = _mm_loadu_si128((const __m128i *)(dst + i));
+        const __m128i b = _mm_loadu_si128((const __m128i *)(src + i));
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_xor_si128(a, b));
+    }
+#elif defined(AERON_CPU_ARM)
+    for (; i + 16 <= length; i += 16)
+    {
+        vst1q_u8(dst + i, veorq_u8(vld1q_u8(dst + i), vld1q_u8(src + i)));
+    }
+#endif
+
+    for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t))
+    {
+        uint64_t a, b;
+        memcpy(&a, dst + i, sizeof(a));
+        memcpy(&b, src + i, sizeof(b));
+        a ^= b;
+        memcpy(dst + i, &a, sizeof(a));
+    }
+
+    for (; i < length; i++)
+    {
+        dst[i] ^= src[i];
+    }
+}
+
+int aeron_fec_encoder_init(
+    aeron_fec_encoder_t *encoder, int32_t group_length, size_t mtu_length, int32_t session_id, int32_t stream_id)
+{
+    encoder->frame = NULL;
+    encoder->max_parity_length = mtu_length;
+    encoder->group_length = group_length;
+    encoder->datagram_count = 0;
+    encoder->next_term_offset = 0;
+
+    if (0 == group_length)
+    {
+        return 0;
+    }
+
+    if (aeron_alloc((void **)&encoder->frame, sizeof(aeron_fec_header_t) + mtu_length) < 0)
+    {
+        AERON_APPEND_ERR("%s", "Unable to allocate FEC frame");
+        return -1;
+    }
+
+    aeron_fec_header_t *header = (aeron_fec_header_t *)encoder->frame;
+    header->frame_header.version = AERON_FRAME_HEADER_VERSION;
+    header->frame_header.flags = 0;
+    header->frame_header.type = AERON_HDR_TYPE_FEC;
+    header->session_id = session_id;
+    header->stream_id = stream_id;
+
+    return 0;
+}
+
+void aeron_fec_encoder_close(aeron_fec_encoder_t *encoder)
+{
+    aeron_free(encoder->frame);
+    encoder->frame = NULL;
+}
+
+bool aeron_fec_encoder_add(
+    aeron_fec_encoder_t *encoder, int32_t term_id, int32_t term_offset, const uint8_t *datagram, size_t length)
+{
+    aeron_fec_header_t *header = (aeron_fec_header_t *)encoder->frame;
+    uint8_t *parity = encoder->frame + sizeof(aeron_fec_header_t);
+    const int32_t count = encoder->datagram_count;
+
+    if (0 == count)
+    {
+        header->term_id = term_id;
+        header->term_offset = term_offset;
+        header->parity_length = (int32_t)length;
+        memcpy(parity, datagram, length);
+    }
+    else
+    {
+        if (count == encoder->group_length || term_id != header->term_id || term_offset != encoder->next_term_offset)
+        {
+            return true;
+        }
+
+        if ((int32_t)length > header->parity_length)
+        {
+            memset(parity + header->parity_length, 0, length - (size_t)header->parity_length);
+            header->parity_length = (int32_t)length;
+        }
+
+        aeron_fec_xor(parity, datagram, length);
+    }
+
+    header->datagram_lengths[count] = (uint16_t)length;
+    encoder->datagram_count = count + 1;
+    encoder->next_term_offset = term_offset + (int32_t)length;
+
+    return false;
+}
+
+size_t aeron_fec_encoder_flush(aeron_fec_encoder_t *encoder)
+{
+    const int32_t count = encoder->datagram_count;
+    if (0 == count)
+    {
+        return 0;
+    }
+
+    aeron_fec_header_t *header = (aeron_fec_header_t *)encoder->frame;
+    const size_t frame_length = sizeof(aeron_fec_header_t) + (size_t)header->parity_length;
+    header->frame_header.frame_length = (int32_t)frame_length;
+    header->datagram_count = (int16_t)count;
+
+    for (int32_t i = count; i < AERON_FEC_MAX_DATAGRAMS; i++)
+    {
+        header->datagram_lengths[i] = 0;
+    }
+
+    encoder->datagram_count = 0;
+
+    return frame_length;
+}
+
+void aeron_fec_encoder_reset(aeron_fec_encoder_t *encoder)
+{
+    encoder->datagram_count = 0;
+}
+
+int32_t aeron_fec_group_length(const aeron_fec_header_t *header, size_t length, size_t max_parity_length)
+{
+    const int32_t count = header->datagram_count;
+    const int32_t parity_length = header->parity_length;
+
+    if (count <= 0 || count > AERON_FEC_MAX_DATAGRAMS ||
+        parity_length < (int32_t)AERON_DATA_HEADER_LENGTH || (size_t)parity_length > max_parity_length ||
+        length < sizeof(aeron_fec_header_t) + (size_t)parity_length)
+    {
+        return -1;
+    }
+
+    int32_t group_length = 0;
+    for (int32_t i = 0; i < count; i++)
+    {
+        const int32_t datagram_length = header->datagram_lengths[i];
+        if (datagram_length < (int32_t)AERON_DATA_HEADER_LENGTH || datagram_length > parity_length)
+        {
+            return -1;
+        }
+
+        group_length += datagram_length;
+    }
+
+    return group_length;
+}
+
+static bool aeron_fec_is_present(const uint8_t *term_buffer, int32_t term_offset, int32_t length)
+{
+    const int32_t end_offset = term_offset + length;
+    int32_t offset = term_offset;
+
+    while (offset < end_offset)
+    {
+        const aeron_frame_header_t *frame_header = (const aeron_frame_header_t *)(term_buffer + offset);
+        int32_t frame_length;
+        AERON_GET_VOLATILE(frame_length, frame_header->frame_length);
+
+        if (frame_length <= 0)
+        {
+            return false;
+        }
+
+        offset += AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    }
+
+    return true;
+}
+
+size_t aeron_fec_recover(
+    const aeron_fec_header_t *header,
+    const uint8_t *term_buffer,
+    size_t term_length,
+    uint8_t *recovered,
+    int32_t *recovered_term_offset)
+{
+    const uint8_t *parity = (const uint8_t *)header + sizeof(aeron_fec_header_t);
+    int32_t missing_index = -1;
+    int32_t missing_offset = 0;
+    int32_t offset = header->term_offset;
+
+    if (offset < 0 || (offset & (AERON_LOGBUFFER_FRAME_ALIGNMENT - 1)) != 0)
+    {
+        return 0;
+    }
+
+    for (int32_t i = 0; i < header->datagram_count; i++)
+    {
+        const int32_t length = header->datagram_lengths[i];
+        if ((size_t)offset + (size_t)length > term_length)
+        {
+            return 0;
+        }
+
+        if (!aeron_fec_is_present(term_buffer, offset, length))
+        {
+            if (missing_index >= 0)
+            {
+                return 0;
+            }
+
+            missing_index = i;
+            missing_offset = offset;
+        }
+
+        offset += length;
+    }
+
+    if (missing_index < 0)
+    {
+        return 0;
+    }
+
+    memcpy(recovered, parity, (size_t)header->parity_length);
+
+    offset = header->term_offset;
+    for (int32_t i = 0; i < header->datagram_count; i++)
+    {
+        const int32_t length = header->datagram_lengths[i];
+        if (i != missing_index)
+        {
+            aeron_fec_xor(recovered, term_buffer + offset, (size_t)length);
+        }
+
+        offset += length;
+    }
+
+    const size_t recovered_length = header->datagram_lengths[missing_index];
+    const aeron_data_header_t *data_header = (const aeron_data_header_t *)recovered;
+    const int16_t type = data_header->frame_header.type;
+    if ((AERON_HDR_TYPE_DATA != type && AERON_HDR_TYPE_PAD != type) ||
+        data_header->frame_header.frame_length <= 0 ||
+        data_header->term_offset != missing_offset ||
+        data_header->term_id != header->term_id ||
+        data_header->session_id != header->session_id ||
+        data_header->stream_id != header->stream_id)
+    {
+        return 0;
+    }
+
+    *recovered_term_offset = missing_offset;
+
+    return recovered_length;
+}
+
+extern bool aeron_fec_encoder_is_enabled(aeron_fec_encoder_t *encoder);
+extern int32_t aeron_fec_encoder_datagram_count(aeron_fec_encoder_t *encoder);
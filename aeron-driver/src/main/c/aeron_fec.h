@@ -0,0 +1,96 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef AERON_FEC_H
+#define AERON_FEC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "protocol/aeron_udp_protocol.h"
+
+/*
+ * XOR length bytes of src into dst.
+ */
+void aeron_fec_xor(uint8_t *dst, const uint8_t *src, size_t length);
+
+/*
+ * Builds a parity frame over each group of up to group_length consecutive datagrams sent from a term. A group of 0
+ * disables the encoder.
+ */
+typedef struct aeron_fec_encoder_stct
+{
+    uint8_t *frame;
+    size_t max_parity_length;
+    int32_t group_length;
+    int32_t datagram_count;
+    int32_t next_term_offset;
+}
+aeron_fec_encoder_t;
+
+int aeron_fec_encoder_init(
+    aeron_fec_encoder_t *encoder, int32_t group_length, size_t mtu_length, int32_t session_id, int32_t stream_id);
+
+void aeron_fec_encoder_close(aeron_fec_encoder_t *encoder);
+
+inline bool aeron_fec_encoder_is_enabled(aeron_fec_encoder_t *encoder)
+{
+    return encoder->group_length > 0;
+}
+
+inline int32_t aeron_fec_encoder_datagram_count(aeron_fec_encoder_t *encoder)
+{
+    return encoder->datagram_count;
+}
+
+/*
+ * Add a sent datagram to the group. Returns true if the group was complete, or the datagram does not follow on from
+ * it, and so the frame must be taken with aeron_fec_encoder_flush before the datagram is added again.
+ */
+bool aeron_fec_encoder_add(
+    aeron_fec_encoder_t *encoder, int32_t term_id, int32_t term_offset, const uint8_t *datagram, size_t length);
+
+/*
+ * Complete the current group, returning the length of the frame to send from encoder->frame, or 0 if the group is
+ * empty. The encoder then starts a new group.
+ */
+size_t aeron_fec_encoder_flush(aeron_fec_encoder_t *encoder);
+
+/*
+ * Discard the current group, e.g. after a short send when the receiver cannot hold all of it.
+ */
+void aeron_fec_encoder_reset(aeron_fec_encoder_t *encoder);
+
+/*
+ * Length of the term covered by the group the frame protects, or -1 if the frame is malformed.
+ */
+int32_t aeron_fec_group_length(const aeron_fec_header_t *header, size_t length, size_t max_parity_length);
+
+/*
+ * Rebuild the datagram of the group which is missing from the term buffer into recovered, which must hold
+ * header->parity_length bytes. Returns the length of the rebuilt datagram and its offset in the term, or 0 if no
+ * datagram is missing, more than one is, or the parity does not produce a datagram which belongs at the gap.
+ */
+size_t aeron_fec_recover(
+    const aeron_fec_header_t *header,
+    const uint8_t *term_buffer,
+    size_t term_length,
+    uint8_t *recovered,
+    int32_t *recovered_term_offset);
+
+#endif //AERON_FEC_H
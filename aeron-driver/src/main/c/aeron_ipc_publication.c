@@ -38,14 +38,16 @@ int aeron_ipc_publication_create(
     size_t channel_length,
     const char *channel)
 {
+    const char *log_dir = aeron_driver_context_log_dir(context, params->is_huge_pages);
+    const size_t page_size = aeron_driver_context_log_page_size(context, params->is_huge_pages);
     char path[AERON_MAX_PATH];
-    int path_length = aeron_ipc_publication_location(path, sizeof(path), context->aeron_dir, registration_id);
+    int path_length = aeron_ipc_publication_location(path, sizeof(path), log_dir, registration_id);
     aeron_ipc_publication_t *_pub = NULL;
-    const uint64_t log_length = aeron_logbuffer_compute_log_length(params->term_length, context->file_page_size);
+    const uint64_t log_length = aeron_logbuffer_compute_log_length(params->term_length, page_size);
 
     *publication = NULL;
 
-    if (aeron_driver_context_run_storage_checks(context, log_length) < 0)
+    if (aeron_driver_context_run_storage_checks(context, log_dir, log_length) < 0)
     {
         return -1;
     }
@@ -73,8 +75,14 @@ int aeron_ipc_publication_create(
         return -1;
     }
 
-    if (context->raw_log_map_func(
-        &_pub->mapped_raw_log, path, params->is_sparse, params->term_length, context->file_page_size) < 0)
+    if (aeron_raw_log_pool_map(
+        context->raw_log_pool,
+        context->raw_log_map_func,
+        &_pub->mapped_raw_log,
+        path,
+        params->is_sparse,
+        params->term_length,
+        page_size) < 0)
     {
         aeron_free(_pub->log_file_name);
         aeron_free(_pub->channel);
@@ -135,7 +143,7 @@ int aeron_ipc_publication_create(
     _pub->log_meta_data->initial_term_id = initial_term_id;
     _pub->log_meta_data->mtu_length = (int32_t)params->mtu_length;
     _pub->log_meta_data->term_length = (int32_t)params->term_length;
-    _pub->log_meta_data->page_size = (int32_t)context->file_page_size;
+    _pub->log_meta_data->page_size = (int32_t)page_size;
     _pub->log_meta_data->correlation_id = registration_id;
     _pub->log_meta_data->is_connected = 0;
     _pub->log_meta_data->active_transport_count = 0;
@@ -159,6 +167,7 @@ int aeron_ipc_publication_create(
     _pub->conductor_fields.time_of_last_consumer_position_change_ns = now_ns;
     _pub->conductor_fields.state = AERON_IPC_PUBLICATION_STATE_ACTIVE;
     _pub->conductor_fields.refcnt = 1;
+    _pub->conductor_fields.next_in_stream = NULL;
     _pub->session_id = session_id;
     _pub->stream_id = stream_id;
     _pub->pub_lmt_position.counter_id = pub_lmt_position->counter_id;
@@ -179,11 +188,27 @@ int aeron_ipc_publication_create(
 
     _pub->conductor_fields.consumer_position = aeron_ipc_publication_producer_position(_pub);
     _pub->conductor_fields.last_consumer_position = _pub->conductor_fields.consumer_position;
-    _pub->conductor_fields.clean_position = _pub->conductor_fields.consumer_position;
+    aeron_term_cleaner_log_init(
+        &_pub->cleaner_log,
+        &_pub->mapped_raw_log,
+        _pub->position_bits_to_shift,
+        _pub->conductor_fields.consumer_position,
+        context->term_buffer_clean_non_temporal);
 
     _pub->unblocked_publications_counter = aeron_system_counter_addr(
         system_counters, AERON_SYSTEM_COUNTER_UNBLOCKED_PUBLICATIONS);
 
+    if (NULL != context->term_cleaner && aeron_term_cleaner_add(context->term_cleaner, &_pub->cleaner_log) < 0)
+    {
+        _pub->raw_log_free_func(&_pub->mapped_raw_log, _pub->log_file_name);
+        aeron_counter_add_ordered(_pub->mapped_bytes_counter, -(int64_t)log_length);
+        aeron_free(_pub->log_file_name);
+        aeron_free(_pub->channel);
+        aeron_free(_pub);
+        AERON_APPEND_ERR("%s", "");
+        return -1;
+    }
+
     *publication = _pub;
 
     return 0;
@@ -215,6 +240,8 @@ bool aeron_ipc_publication_free(aeron_ipc_publication_t *publication)
         return true;
     }
 
+    aeron_term_cleaner_remove(&publication->cleaner_log);
+
     if (!publication->raw_log_free_func(&publication->mapped_raw_log, publication->log_file_name))
     {
         return false;
@@ -261,19 +288,29 @@ int aeron_ipc_publication_update_pub_pos_and_lmt(aeron_ipc_publication_t *public
             int64_t proposed_limit = min_sub_pos + publication->term_window_length;
             if (proposed_limit > publication->conductor_fields.trip_limit)
             {
-                aeron_ipc_publication_clean_buffer(publication, min_sub_pos);
-                aeron_counter_set_ordered(publication->pub_lmt_position.value_addr, proposed_limit);
-                publication->conductor_fields.trip_limit = proposed_limit + publication->trip_gain;
-                work_count++;
+                // clean a term behind so fragments of a message held by a subscriber across polls are not zeroed
+                const int64_t term_length = (int64_t)publication->mapped_raw_log.term_length;
+                aeron_ipc_publication_clean_buffer(publication, min_sub_pos - term_length);
+                int64_t limit = aeron_term_cleaner_log_limit(&publication->cleaner_log, proposed_limit);
+                if (limit != aeron_counter_get(publication->pub_lmt_position.value_addr))
+                {
+                    aeron_counter_set_ordered(publication->pub_lmt_position.value_addr, limit);
+                    work_count++;
+                }
+
+                // trip again next duty cycle if held back by cleaning
+                publication->conductor_fields.trip_limit = limit < proposed_limit ?
+                    limit : proposed_limit + publication->trip_gain;
             }
 
             publication->conductor_fields.consumer_position = max_sub_pos;
         }
         else if (*publication->pub_lmt_position.value_addr > consumer_position)
         {
+            const int64_t term_length = (int64_t)publication->mapped_raw_log.term_length;
             aeron_counter_set_ordered(publication->pub_lmt_position.value_addr, consumer_position);
             publication->conductor_fields.trip_limit = consumer_position;
-            aeron_ipc_publication_clean_buffer(publication, consumer_position);
+            aeron_ipc_publication_clean_buffer(publication, consumer_position - term_length);
         }
     }
 
@@ -282,26 +319,7 @@ int aeron_ipc_publication_update_pub_pos_and_lmt(aeron_ipc_publication_t *public
 
 void aeron_ipc_publication_clean_buffer(aeron_ipc_publication_t *publication, int64_t position)
 {
-    int64_t clean_position = publication->conductor_fields.clean_position;
-    if (position > clean_position)
-    {
-        size_t dirty_index = aeron_logbuffer_index_by_position(clean_position, publication->position_bits_to_shift);
-        size_t bytes_to_clean = (size_t)(position - clean_position);
-        size_t term_length = publication->mapped_raw_log.term_length;
-        size_t term_offset = (size_t)(clean_position & (term_length - 1));
-        size_t bytes_left_in_term = term_length - term_offset;
-        size_t length = bytes_to_clean < bytes_left_in_term ? bytes_to_clean : bytes_left_in_term;
-
-        memset(
-            publication->mapped_raw_log.term_buffers[dirty_index].addr + term_offset + sizeof(int64_t),
-            0,
-            length - sizeof(int64_t));
-
-        uint64_t *ptr = (uint64_t *)(publication->mapped_raw_log.term_buffers[dirty_index].addr + term_offset);
-        AERON_PUT_ORDERED(*ptr, (uint64_t)0);
-
-        publication->conductor_fields.clean_position = (int64_t)(clean_position + length);
-    }
+    aeron_term_cleaner_log_clean_to(&publication->cleaner_log, position);
 }
 
 void aeron_ipc_publication_check_untethered_subscriptions(
@@ -22,6 +22,7 @@
 #include "util/aeron_fileutil.h"
 #include "aeron_driver_context.h"
 #include "aeron_system_counters.h"
+#include "concurrent/aeron_term_cleaner.h"
 
 typedef enum aeron_ipc_publication_state_enum
 {
@@ -35,6 +36,7 @@ aeron_ipc_publication_state_t;
 typedef struct aeron_ipc_publication_stct
 {
     aeron_mapped_raw_log_t mapped_raw_log;
+    aeron_term_cleaner_log_t cleaner_log;
     aeron_logbuffer_metadata_t *log_meta_data;
     aeron_position_t pub_lmt_position;
     aeron_position_t pub_pos_position;
@@ -47,10 +49,10 @@ typedef struct aeron_ipc_publication_stct
         aeron_driver_managed_resource_t managed_resource;
         aeron_subscribable_t subscribable;
         int64_t trip_limit;
-        int64_t clean_position;
         int64_t consumer_position;
         int64_t last_consumer_position;
         int64_t time_of_last_consumer_position_change_ns;
+        struct aeron_ipc_publication_stct *next_in_stream;
     }
     conductor_fields;
 
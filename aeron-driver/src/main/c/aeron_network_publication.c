@@ -53,17 +53,21 @@ int aeron_network_publication_create(
     aeron_position_t *snd_pos_position,
     aeron_position_t *snd_lmt_position,
     aeron_atomic_counter_t *snd_bpe_counter,
+    aeron_atomic_counter_t *snd_batch_counter,
+    aeron_atomic_counter_t *snd_pacing_delays_counter,
     aeron_flow_control_strategy_t *flow_control_strategy,
     aeron_driver_uri_publication_params_t *params,
     bool is_exclusive,
     aeron_system_counters_t *system_counters)
 {
     aeron_network_publication_t *_pub = NULL;
-    const uint64_t log_length = aeron_logbuffer_compute_log_length(params->term_length, context->file_page_size);
+    const char *log_dir = aeron_driver_context_log_dir(context, params->is_huge_pages);
+    const size_t page_size = aeron_driver_context_log_page_size(context, params->is_huge_pages);
+    const uint64_t log_length = aeron_logbuffer_compute_log_length(params->term_length, page_size);
 
     *publication = NULL;
 
-    if (aeron_driver_context_run_storage_checks(context, log_length) < 0)
+    if (aeron_driver_context_run_storage_checks(context, log_dir, log_length) < 0)
     {
         return -1;
     }
@@ -75,7 +79,7 @@ int aeron_network_publication_create(
     }
 
     char path[AERON_MAX_PATH];
-    int path_length = aeron_network_publication_location(path, sizeof(path), context->aeron_dir, registration_id);
+    int path_length = aeron_network_publication_location(path, sizeof(path), log_dir, registration_id);
     _pub->log_file_name = NULL;
     if (aeron_alloc((void **)(&_pub->log_file_name), (size_t)path_length + 1) < 0)
     {
@@ -84,12 +88,25 @@ int aeron_network_publication_create(
         return -1;
     }
 
+    if (aeron_fec_encoder_init(
+        &_pub->fec_encoder, params->fec_group_length, params->mtu_length, session_id, stream_id) < 0)
+    {
+        aeron_free(_pub->log_file_name);
+        aeron_free(_pub);
+        AERON_APPEND_ERR(
+            "Could not init network publication FEC encoder, group length: %" PRId32, params->fec_group_length);
+        return -1;
+    }
+
     if (aeron_retransmit_handler_init(
         &_pub->retransmit_handler,
         aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_INVALID_PACKETS),
+        aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_NAKS_COALESCED),
+        aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_NAKS_SUPPRESSED),
         context->retransmit_unicast_delay_ns,
         context->retransmit_unicast_linger_ns) < 0)
     {
+        aeron_fec_encoder_close(&_pub->fec_encoder);
         aeron_free(_pub->log_file_name);
         aeron_free(_pub);
         AERON_APPEND_ERR(
@@ -99,9 +116,17 @@ int aeron_network_publication_create(
         return -1;
     }
 
-    if (context->raw_log_map_func(
-        &_pub->mapped_raw_log, path, params->is_sparse, params->term_length, context->file_page_size) < 0)
+    if (aeron_raw_log_pool_map(
+        context->raw_log_pool,
+        context->raw_log_map_func,
+        &_pub->mapped_raw_log,
+        path,
+        params->is_sparse,
+        params->term_length,
+        page_size) < 0)
     {
+        aeron_retransmit_handler_close(&_pub->retransmit_handler);
+        aeron_fec_encoder_close(&_pub->fec_encoder);
         aeron_free(_pub->log_file_name);
         aeron_free(_pub);
         AERON_APPEND_ERR("error mapping network raw log: %s", path);
@@ -158,7 +183,7 @@ int aeron_network_publication_create(
     _pub->log_meta_data->initial_term_id = initial_term_id;
     _pub->log_meta_data->mtu_length = (int32_t)params->mtu_length;
     _pub->log_meta_data->term_length = (int32_t)params->term_length;
-    _pub->log_meta_data->page_size = (int32_t)context->file_page_size;
+    _pub->log_meta_data->page_size = (int32_t)page_size;
     _pub->log_meta_data->correlation_id = registration_id;
     _pub->log_meta_data->is_connected = 0;
     _pub->log_meta_data->active_transport_count = 0;
@@ -168,8 +193,10 @@ int aeron_network_publication_create(
 
     _pub->endpoint = endpoint;
     _pub->flow_control = flow_control_strategy;
-    // Will be called from sender thread.
-    _pub->cached_clock = context->sender_cached_clock;
+    // Will be called from the sender thread that owns the endpoint.
+    _pub->cached_clock = endpoint->cached_clock;
+    _pub->latency_reporter = NULL;
+    _pub->send_to_wire_latency_offset = -1;
     _pub->conductor_fields.subscribable.array = NULL;
     _pub->conductor_fields.subscribable.length = 0;
     _pub->conductor_fields.subscribable.capacity = 0;
@@ -181,9 +208,9 @@ int aeron_network_publication_create(
     _pub->conductor_fields.managed_resource.incref = aeron_network_publication_incref;
     _pub->conductor_fields.managed_resource.decref = aeron_network_publication_decref;
     _pub->conductor_fields.has_reached_end_of_life = false;
-    _pub->conductor_fields.clean_position = 0;
     _pub->conductor_fields.state = AERON_NETWORK_PUBLICATION_STATE_ACTIVE;
     _pub->conductor_fields.refcnt = 1;
+    _pub->conductor_fields.next_in_stream = NULL;
     _pub->conductor_fields.time_of_last_activity_ns = now_ns;
     _pub->conductor_fields.last_snd_pos = 0;
     _pub->session_id = session_id;
@@ -198,6 +225,20 @@ int aeron_network_publication_create(
     _pub->snd_lmt_position.value_addr = snd_lmt_position->value_addr;
     _pub->snd_bpe_counter.counter_id = snd_bpe_counter->counter_id;
     _pub->snd_bpe_counter.value_addr = snd_bpe_counter->value_addr;
+    _pub->snd_batch_counter.counter_id = -1;
+    _pub->snd_batch_counter.value_addr = NULL;
+    if (NULL != snd_batch_counter)
+    {
+        _pub->snd_batch_counter.counter_id = snd_batch_counter->counter_id;
+        _pub->snd_batch_counter.value_addr = snd_batch_counter->value_addr;
+    }
+    _pub->snd_pacing_delays_counter.counter_id = -1;
+    _pub->snd_pacing_delays_counter.value_addr = NULL;
+    if (NULL != snd_pacing_delays_counter)
+    {
+        _pub->snd_pacing_delays_counter.counter_id = snd_pacing_delays_counter->counter_id;
+        _pub->snd_pacing_delays_counter.value_addr = snd_pacing_delays_counter->value_addr;
+    }
     _pub->tag = params->entity_tag;
     _pub->initial_term_id = initial_term_id;
     _pub->starting_term_id = params->has_position ? params->term_id : initial_term_id;
@@ -206,8 +247,12 @@ int aeron_network_publication_create(
     _pub->term_length_mask = (int32_t)params->term_length - 1;
     _pub->position_bits_to_shift = (size_t)aeron_number_of_trailing_zeroes((int32_t)params->term_length);
     _pub->mtu_length = params->mtu_length;
-    _pub->max_messages_per_send = context->network_publication_max_messages_per_send;
-    _pub->current_messages_per_send = _pub->max_messages_per_send;
+    aeron_send_batch_controller_init(
+        &_pub->send_batch_controller,
+        context->network_publication_max_messages_per_send,
+        context->network_publication_adaptive_messages_per_send,
+        _pub->snd_batch_counter.value_addr);
+    aeron_send_pacer_init(&_pub->send_pacer, params->rate_bytes_per_sec, params->burst_length, now_ns);
     _pub->term_window_length = (int64_t)aeron_producer_window_length(
         context->publication_window_length, params->term_length);
     _pub->linger_timeout_ns = (int64_t)params->linger_timeout_ns;
@@ -240,12 +285,29 @@ int aeron_network_publication_create(
         system_counters, AERON_SYSTEM_COUNTER_UNBLOCKED_PUBLICATIONS);
 
     _pub->conductor_fields.last_snd_pos = aeron_counter_get(_pub->snd_pos_position.value_addr);
-    _pub->conductor_fields.clean_position = _pub->conductor_fields.last_snd_pos;
+    aeron_term_cleaner_log_init(
+        &_pub->cleaner_log,
+        &_pub->mapped_raw_log,
+        _pub->position_bits_to_shift,
+        _pub->conductor_fields.last_snd_pos,
+        context->term_buffer_clean_non_temporal);
 
     _pub->endpoint_address.ss_family = AF_UNSPEC;
     _pub->is_response = AERON_UDP_CHANNEL_CONTROL_MODE_RESPONSE == endpoint->conductor_fields.udp_channel->control_mode;
     _pub->response_correlation_id = params->response_correlation_id;
 
+    if (NULL != context->term_cleaner && aeron_term_cleaner_add(context->term_cleaner, &_pub->cleaner_log) < 0)
+    {
+        _pub->raw_log_free_func(&_pub->mapped_raw_log, _pub->log_file_name);
+        aeron_counter_add_ordered(_pub->mapped_bytes_counter, -(int64_t)log_length);
+        aeron_retransmit_handler_close(&_pub->retransmit_handler);
+        aeron_fec_encoder_close(&_pub->fec_encoder);
+        aeron_free(_pub->log_file_name);
+        aeron_free(_pub);
+        AERON_APPEND_ERR("%s", "");
+        return -1;
+    }
+
     *publication = _pub;
 
     return 0;
@@ -263,6 +325,14 @@ void aeron_network_publication_close(
         aeron_counters_manager_free(counters_manager, publication->snd_pos_position.counter_id);
         aeron_counters_manager_free(counters_manager, publication->snd_lmt_position.counter_id);
         aeron_counters_manager_free(counters_manager, publication->snd_bpe_counter.counter_id);
+        if (publication->snd_batch_counter.counter_id >= 0)
+        {
+            aeron_counters_manager_free(counters_manager, publication->snd_batch_counter.counter_id);
+        }
+        if (publication->snd_pacing_delays_counter.counter_id >= 0)
+        {
+            aeron_counters_manager_free(counters_manager, publication->snd_pacing_delays_counter.counter_id);
+        }
 
         for (size_t i = 0, length = subscribable->length; i < length; i++)
         {
@@ -273,6 +343,7 @@ void aeron_network_publication_close(
         publication->conductor_fields.managed_resource.clientd = NULL;
 
         aeron_retransmit_handler_close(&publication->retransmit_handler);
+        aeron_fec_encoder_close(&publication->fec_encoder);
         publication->flow_control->fini(publication->flow_control);
     }
 }
@@ -284,6 +355,8 @@ bool aeron_network_publication_free(aeron_network_publication_t *publication)
         return true;
     }
 
+    aeron_term_cleaner_remove(&publication->cleaner_log);
+
     if (!publication->raw_log_free_func(&publication->mapped_raw_log, publication->log_file_name))
     {
          return false;
@@ -430,28 +503,112 @@ int aeron_network_publication_heartbeat_message_check(
             }
         }
 
-        aeron_counter_ordered_increment(publication->heartbeats_sent_counter, 1);
+        aeron_counter_increment(publication->heartbeats_sent_counter, 1);
         publication->time_of_last_data_or_heartbeat_ns = now_ns;
     }
 
     return result;
 }
 
+static void aeron_network_publication_sample_socket_queue(aeron_network_publication_t *publication, int64_t now_ns)
+{
+    aeron_send_batch_controller_t *controller = &publication->send_batch_controller;
+
+    if (aeron_send_batch_controller_is_socket_queue_sample_due(controller, now_ns))
+    {
+        aeron_udp_channel_transport_bindings_t *bindings = publication->endpoint->transport_bindings;
+        size_t send_queue_length = 0;
+        size_t so_sndbuf = 0;
+
+        if (NULL == bindings->get_send_queue_length_func ||
+            bindings->get_send_queue_length_func(&publication->endpoint->transport, &send_queue_length, &so_sndbuf) < 0)
+        {
+            aeron_err_clear();
+            aeron_send_batch_controller_disable_socket_queue_sampling(controller);
+        }
+        else
+        {
+            aeron_send_batch_controller_on_socket_queue(controller, now_ns, send_queue_length, so_sndbuf);
+        }
+    }
+}
+
+static int aeron_network_publication_send_fec(aeron_network_publication_t *publication, int64_t now_ns)
+{
+    const size_t frame_length = aeron_fec_encoder_flush(&publication->fec_encoder);
+    if (0 == frame_length)
+    {
+        return 0;
+    }
+
+    struct iovec iov;
+    iov.iov_base = publication->fec_encoder.frame;
+    iov.iov_len = frame_length;
+
+    int64_t bytes_sent = 0;
+    int result = aeron_network_publication_do_send(publication, &iov, 1, &bytes_sent);
+    if (result >= 0)
+    {
+        aeron_send_pacer_on_sent(&publication->send_pacer, now_ns, bytes_sent);
+        if (bytes_sent < (int64_t)iov.iov_len)
+        {
+            aeron_counter_increment(publication->short_sends_counter, 1);
+        }
+    }
+
+    return result;
+}
+
+static int aeron_network_publication_on_data_sent(
+    aeron_network_publication_t *publication, int64_t now_ns, int64_t snd_pos, struct iovec *iov, int vlen)
+{
+    const int32_t term_id = aeron_logbuffer_compute_term_id_from_position(
+        snd_pos, publication->position_bits_to_shift, publication->initial_term_id);
+    const size_t index = aeron_logbuffer_index_by_position(snd_pos, publication->position_bits_to_shift);
+    const uint8_t *term_buffer = publication->mapped_raw_log.term_buffers[index].addr;
+
+    for (int i = 0; i < vlen; i++)
+    {
+        const uint8_t *datagram = (const uint8_t *)iov[i].iov_base;
+        const int32_t term_offset = (int32_t)(datagram - term_buffer);
+
+        if (aeron_fec_encoder_add(&publication->fec_encoder, term_id, term_offset, datagram, iov[i].iov_len))
+        {
+            if (aeron_network_publication_send_fec(publication, now_ns) < 0)
+            {
+                return -1;
+            }
+
+            aeron_fec_encoder_add(&publication->fec_encoder, term_id, term_offset, datagram, iov[i].iov_len);
+        }
+    }
+
+    if (aeron_fec_encoder_datagram_count(&publication->fec_encoder) == publication->fec_encoder.group_length)
+    {
+        return aeron_network_publication_send_fec(publication, now_ns);
+    }
+
+    return 0;
+}
+
 int aeron_network_publication_send_data(
     aeron_network_publication_t *publication, int64_t now_ns, int64_t snd_pos, int32_t term_offset)
 {
     const int32_t term_length = publication->term_length_mask + 1;
-    const size_t max_vlen = publication->current_messages_per_send;
-    int result = 0, vlen = 0;
+    const size_t max_vlen = publication->send_batch_controller.current_messages_per_send;
+    int result = 0, fec_result = 0, vlen = 0;
     int64_t bytes_sent = 0;
     int32_t available_window = (int32_t)(aeron_counter_get(publication->snd_lmt_position.value_addr) - snd_pos);
+    const int64_t paced_window = aeron_send_pacer_available(&publication->send_pacer, now_ns);
+    int32_t send_window = paced_window < available_window ? (int32_t)paced_window : available_window;
+    bool is_pacing_delayed = false;
     int64_t highest_pos = snd_pos;
     struct iovec iov[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND];
 
-    for (size_t i = 0; i < max_vlen && available_window > 0; i++)
+    for (size_t i = 0; i < max_vlen && send_window > 0; i++)
     {
-        int32_t scan_limit = available_window < (int32_t)publication->mtu_length ?
-           available_window : (int32_t)publication->mtu_length;
+        int32_t scan_limit = send_window < (int32_t)publication->mtu_length ?
+           send_window : (int32_t)publication->mtu_length;
         size_t active_index = aeron_logbuffer_index_by_position(snd_pos, publication->position_bits_to_shift);
         int32_t padding = 0;
 
@@ -467,15 +624,21 @@ int aeron_network_publication_send_data(
 
             int32_t total_available = (int32_t)(available + padding);
             available_window -= total_available;
+            send_window -= total_available;
             term_offset += total_available;
             highest_pos += total_available;
         }
+        else if (available < 0 && -available <= available_window)
+        {
+            is_pacing_delayed = true;
+            break;
+        }
         else if (available < 0)
         {
             if (publication->track_sender_limits)
             {
                 aeron_counter_ordered_increment(publication->snd_bpe_counter.value_addr, 1);
-                aeron_counter_ordered_increment(publication->sender_flow_control_limits_counter, 1);
+                aeron_counter_increment(publication->sender_flow_control_limits_counter, 1);
                 publication->track_sender_limits = false;
             }
             break;
@@ -487,29 +650,80 @@ int aeron_network_publication_send_data(
         }
     }
 
+    if (send_window <= 0 && available_window > 0 && term_offset < term_length)
+    {
+        size_t active_index = aeron_logbuffer_index_by_position(snd_pos, publication->position_bits_to_shift);
+        aeron_frame_header_t *frame_header =
+            (aeron_frame_header_t *)(publication->mapped_raw_log.term_buffers[active_index].addr + term_offset);
+        int32_t frame_length;
+        AERON_GET_VOLATILE(frame_length, frame_header->frame_length);
+
+        is_pacing_delayed = frame_length > 0;
+    }
+
+    if (is_pacing_delayed && NULL != publication->snd_pacing_delays_counter.value_addr)
+    {
+        aeron_counter_ordered_increment(publication->snd_pacing_delays_counter.value_addr, 1);
+    }
+
     if (vlen > 0)
     {
+        if (NULL != publication->latency_reporter)
+        {
+            aeron_send_channel_endpoint_request_tx_timestamp(
+                publication->endpoint, publication->latency_reporter, publication->send_to_wire_latency_offset, now_ns);
+        }
+
         result = aeron_network_publication_do_send(publication, iov, vlen, &bytes_sent);
+
+        if (NULL != publication->latency_reporter)
+        {
+            aeron_send_channel_endpoint_poll_tx_timestamp(publication->endpoint, now_ns);
+        }
         if (result == vlen) /* assume that a partial send from a broken stack will also move the snd-pos */
         {
             publication->time_of_last_data_or_heartbeat_ns = now_ns;
             publication->track_sender_limits = true;
-            publication->current_messages_per_send = publication->max_messages_per_send;
             aeron_counter_set_ordered(publication->snd_pos_position.value_addr, highest_pos);
+
+            if (aeron_fec_encoder_is_enabled(&publication->fec_encoder))
+            {
+                fec_result = aeron_network_publication_on_data_sent(publication, now_ns, snd_pos, iov, vlen);
+            }
         }
         else if (result >= 0)
         {
-            publication->current_messages_per_send = 1;
             aeron_counter_increment(publication->short_sends_counter, 1);
         }
+
+        if (result != vlen && aeron_fec_encoder_is_enabled(&publication->fec_encoder))
+        {
+            aeron_fec_encoder_reset(&publication->fec_encoder);
+        }
+
+        if (result >= 0)
+        {
+            aeron_send_pacer_on_sent(&publication->send_pacer, now_ns, bytes_sent);
+            aeron_network_publication_sample_socket_queue(publication, now_ns);
+            aeron_send_batch_controller_on_send(
+                &publication->send_batch_controller,
+                (size_t)vlen,
+                (size_t)result,
+                available_window >= (int32_t)publication->mtu_length);
+        }
     }
     else if (publication->track_sender_limits && available_window <= 0)
     {
         aeron_counter_ordered_increment(publication->snd_bpe_counter.value_addr, 1);
-        aeron_counter_ordered_increment(publication->sender_flow_control_limits_counter, 1);
+        aeron_counter_increment(publication->sender_flow_control_limits_counter, 1);
         publication->track_sender_limits = false;
     }
 
+    if (fec_result < 0)
+    {
+        return fec_result;
+    }
+
     return result < 0 ? result : (int)bytes_sent;
 }
 
@@ -534,6 +748,12 @@ int aeron_network_publication_send(aeron_network_publication_t *publication, int
         return -1;
     }
 
+    if (0 == bytes_sent && aeron_fec_encoder_is_enabled(&publication->fec_encoder) &&
+        aeron_network_publication_send_fec(publication, now_ns) < 0)
+    {
+        return -1;
+    }
+
     if (0 == bytes_sent)
     {
         bool is_end_of_stream;
@@ -620,6 +840,9 @@ int aeron_network_publication_resend(void *clientd, int32_t term_id, int32_t ter
             int sendmsg_result = aeron_network_publication_do_send(publication, &iov, 1, &msg_bytes_sent);
             if (0 <= sendmsg_result)
             {
+                aeron_send_pacer_on_sent(
+                    &publication->send_pacer, aeron_clock_cached_nano_time(publication->cached_clock), msg_bytes_sent);
+
                 if (msg_bytes_sent < (int64_t)iov.iov_len)
                 {
                     aeron_counter_increment(publication->short_sends_counter, 1);
@@ -637,7 +860,7 @@ int aeron_network_publication_resend(void *clientd, int32_t term_id, int32_t ter
         }
         while (remaining_bytes > 0);
 
-        aeron_counter_ordered_increment(publication->retransmits_sent_counter, 1);
+        aeron_counter_increment(publication->retransmits_sent_counter, 1);
     }
 
     if (NULL != publication->log.resend)
@@ -656,7 +879,7 @@ int aeron_network_publication_resend(void *clientd, int32_t term_id, int32_t ter
 }
 
 int aeron_network_publication_on_nak(
-    aeron_network_publication_t *publication, int32_t term_id, int32_t term_offset, int32_t length)
+    aeron_network_publication_t *publication, int32_t term_id, int32_t term_offset, int32_t length, int64_t receiver_key)
 {
     int result = aeron_retransmit_handler_on_nak(
         &publication->retransmit_handler,
@@ -666,6 +889,7 @@ int aeron_network_publication_on_nak(
         (size_t)publication->term_length_mask + 1,
         publication->mtu_length,
         publication->flow_control,
+        receiver_key,
         aeron_clock_cached_nano_time(publication->cached_clock),
         aeron_network_publication_resend,
         publication);
@@ -783,26 +1007,7 @@ void aeron_network_publication_on_rttm(
 
 void aeron_network_publication_clean_buffer(aeron_network_publication_t *publication, int64_t position)
 {
-    int64_t clean_position = publication->conductor_fields.clean_position;
-    if (position > clean_position)
-    {
-        size_t dirty_index = aeron_logbuffer_index_by_position(clean_position, publication->position_bits_to_shift);
-        size_t bytes_to_clean = (size_t)(position - clean_position);
-        size_t term_length = publication->mapped_raw_log.term_length;
-        size_t term_offset = (size_t)(clean_position & publication->term_length_mask);
-        size_t bytes_left_in_term = term_length - term_offset;
-        size_t length = bytes_to_clean < bytes_left_in_term ? bytes_to_clean : bytes_left_in_term;
-
-        memset(
-            publication->mapped_raw_log.term_buffers[dirty_index].addr + term_offset + sizeof(int64_t),
-            0,
-            length - sizeof(int64_t));
-
-        uint64_t *ptr = (uint64_t *)(publication->mapped_raw_log.term_buffers[dirty_index].addr + term_offset);
-        AERON_PUT_ORDERED(*ptr, (uint64_t)0);
-
-        publication->conductor_fields.clean_position = clean_position + (int64_t)length;
-    }
+    aeron_term_cleaner_log_clean_to(&publication->cleaner_log, position);
 }
 
 int aeron_network_publication_update_pub_pos_and_lmt(aeron_network_publication_t *publication)
@@ -842,8 +1047,12 @@ int aeron_network_publication_update_pub_pos_and_lmt(aeron_network_publication_t
             {
                 size_t term_length = (size_t)publication->term_length_mask + 1;
                 aeron_network_publication_clean_buffer(publication, min_consumer_position - (int64_t)term_length);
-                aeron_counter_set_ordered(publication->pub_lmt_position.value_addr, proposed_pub_lmt);
-                work_count = 1;
+                proposed_pub_lmt = aeron_term_cleaner_log_limit(&publication->cleaner_log, proposed_pub_lmt);
+                if (proposed_pub_lmt > publication_limit)
+                {
+                    aeron_counter_set_ordered(publication->pub_lmt_position.value_addr, proposed_pub_lmt);
+                    work_count = 1;
+                }
             }
         }
         else if (*publication->pub_lmt_position.value_addr > snd_pos)
@@ -22,9 +22,14 @@
 #include "uri/aeron_driver_uri.h"
 #include "aeron_driver_common.h"
 #include "aeron_driver_context.h"
+#include "aeron_fec.h"
 #include "concurrent/aeron_counters_manager.h"
 #include "aeron_system_counters.h"
 #include "aeron_retransmit_handler.h"
+#include "aeron_send_batch_controller.h"
+#include "aeron_send_pacer.h"
+#include "concurrent/aeron_term_cleaner.h"
+#include "reports/aeron_latency_reporter.h"
 
 typedef enum aeron_network_publication_state_enum
 {
@@ -50,9 +55,9 @@ typedef struct aeron_network_publication_stct
         int32_t refcnt;
         aeron_driver_managed_resource_t managed_resource;
         aeron_subscribable_t subscribable;
-        int64_t clean_position;
         int64_t time_of_last_activity_ns;
         int64_t last_snd_pos;
+        struct aeron_network_publication_stct *next_in_stream;
     }
     conductor_fields;
 
@@ -60,22 +65,29 @@ typedef struct aeron_network_publication_stct
         (4 * AERON_CACHE_LINE_LENGTH) - sizeof(struct aeron_network_publication_conductor_fields_stct)];
 
     aeron_mapped_raw_log_t mapped_raw_log;
+    aeron_term_cleaner_log_t cleaner_log;
     aeron_position_t pub_pos_position;
     aeron_position_t pub_lmt_position;
     aeron_position_t snd_pos_position;
     aeron_position_t snd_lmt_position;
     aeron_atomic_counter_t snd_bpe_counter;
+    aeron_atomic_counter_t snd_batch_counter;
+    aeron_atomic_counter_t snd_pacing_delays_counter;
     aeron_retransmit_handler_t retransmit_handler;
     aeron_logbuffer_metadata_t *log_meta_data;
     aeron_send_channel_endpoint_t *endpoint;
     aeron_flow_control_strategy_t *flow_control;
     aeron_clock_cache_t *cached_clock;
+    aeron_latency_reporter_t *latency_reporter;
+    aeron_latency_reporter_entry_offset_t send_to_wire_latency_offset;
 
     uint8_t sender_fields_pad_lhs[AERON_CACHE_LINE_LENGTH];
     bool has_initial_connection;
     bool track_sender_limits;
     int64_t time_of_last_data_or_heartbeat_ns;
-    size_t current_messages_per_send;
+    aeron_send_batch_controller_t send_batch_controller;
+    aeron_send_pacer_t send_pacer;
+    aeron_fec_encoder_t fec_encoder;
     int64_t status_message_deadline_ns;
     int64_t time_of_last_setup_ns;
     uint8_t sender_fields_pad_rhs[AERON_CACHE_LINE_LENGTH];
@@ -103,7 +115,6 @@ typedef struct aeron_network_publication_stct
     size_t log_file_name_length;
     size_t position_bits_to_shift;
     size_t mtu_length;
-    size_t max_messages_per_send;
     bool spies_simulate_connection;
     bool signal_eos;
     bool is_setup_elicited;
@@ -145,6 +156,8 @@ int aeron_network_publication_create(
     aeron_position_t *snd_pos_position,
     aeron_position_t *snd_lmt_position,
     aeron_atomic_counter_t *snd_bpe_counter,
+    aeron_atomic_counter_t *snd_batch_counter,
+    aeron_atomic_counter_t *snd_pacing_delays_counter,
     aeron_flow_control_strategy_t *flow_control_strategy,
     aeron_driver_uri_publication_params_t *params,
     bool is_exclusive,
@@ -168,8 +181,12 @@ int aeron_network_publication_resend(void *clientd, int32_t term_id, int32_t ter
 int aeron_network_publication_send_data(
     aeron_network_publication_t *publication, int64_t now_ns, int64_t snd_pos, int32_t term_offset);
 
+/*
+ * receiver_key identifies the source of the NAK so repeated requests from the same receiver can be told apart from
+ * other receivers sharing the loss.
+ */
 int aeron_network_publication_on_nak(
-    aeron_network_publication_t *publication, int32_t term_id, int32_t term_offset, int32_t length);
+    aeron_network_publication_t *publication, int32_t term_id, int32_t term_offset, int32_t length, int64_t receiver_key);
 
 void aeron_network_publication_on_status_message(
     aeron_network_publication_t *publication,
@@ -362,3 +362,43 @@ int32_t aeron_counter_sender_bpe_allocate(
         channel,
         "");
 }
+
+int32_t aeron_counter_sender_batch_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    size_t channel_length,
+    const char *channel)
+{
+    return aeron_stream_counter_allocate(
+        counters_manager,
+        AERON_COUNTER_SENDER_BATCH_NAME,
+        AERON_COUNTER_SENDER_BATCH_TYPE_ID,
+        registration_id,
+        session_id,
+        stream_id,
+        channel_length,
+        channel,
+        "");
+}
+
+int32_t aeron_counter_sender_pacing_delays_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    size_t channel_length,
+    const char *channel)
+{
+    return aeron_stream_counter_allocate(
+        counters_manager,
+        AERON_COUNTER_SENDER_PACING_DELAYS_NAME,
+        AERON_COUNTER_SENDER_PACING_DELAYS_TYPE_ID,
+        registration_id,
+        session_id,
+        stream_id,
+        channel_length,
+        channel,
+        "");
+}
@@ -22,6 +22,7 @@
 #include "aeron_driver_receiver_proxy.h"
 #include "aeron_driver_conductor.h"
 #include "concurrent/aeron_term_gap_filler.h"
+#include "aeron_fec.h"
 #include "util/aeron_parse_util.h"
 
 #define AERON_PUBLICATION_RESPONSE_NULL_RESPONSE_SESSION_ID INT64_C(0xF000000000000000)
@@ -128,16 +129,18 @@ int aeron_publication_image_create(
     aeron_loss_reporter_t *loss_reporter,
     bool is_reliable,
     bool is_sparse,
+    bool is_huge_pages,
     bool treat_as_multicast,
     aeron_system_counters_t *system_counters)
 {
     aeron_publication_image_t *_image = NULL;
-    const uint64_t log_length = aeron_logbuffer_compute_log_length(
-        (uint64_t)term_buffer_length, context->file_page_size);
+    const char *log_dir = aeron_driver_context_log_dir(context, is_huge_pages);
+    const size_t page_size = aeron_driver_context_log_page_size(context, is_huge_pages);
+    const uint64_t log_length = aeron_logbuffer_compute_log_length((uint64_t)term_buffer_length, page_size);
 
     *image = NULL;
 
-    if (aeron_driver_context_run_storage_checks(context, log_length) < 0)
+    if (aeron_driver_context_run_storage_checks(context, log_dir, log_length) < 0)
     {
         return -1;
     }
@@ -149,7 +152,7 @@ int aeron_publication_image_create(
     }
 
     char path[AERON_MAX_PATH];
-    int path_length = aeron_publication_image_location(path, sizeof(path), context->aeron_dir, correlation_id);
+    int path_length = aeron_publication_image_location(path, sizeof(path), log_dir, correlation_id);
     _image->log_file_name = NULL;
     if (aeron_alloc((void **)(&_image->log_file_name), (size_t)path_length + 1) < 0)
     {
@@ -176,8 +179,14 @@ int aeron_publication_image_create(
         goto error;
     }
 
-    if (context->raw_log_map_func(
-        &_image->mapped_raw_log, path, is_sparse, (uint64_t)term_buffer_length, context->file_page_size) < 0)
+    if (aeron_raw_log_pool_map(
+        context->raw_log_pool,
+        context->raw_log_map_func,
+        &_image->mapped_raw_log,
+        path,
+        is_sparse,
+        (uint64_t)term_buffer_length,
+        page_size) < 0)
     {
         AERON_APPEND_ERR("error mapping network raw log: %s", path);
         goto error;
@@ -193,7 +202,7 @@ int aeron_publication_image_create(
 
     _image->nano_clock = context->nano_clock;
     _image->epoch_clock = context->epoch_clock;
-    _image->cached_clock = context->receiver_cached_clock;
+    _image->cached_clock = endpoint->cached_clock;
 
     if (aeron_publication_image_add_destination(_image, destination) < 0)
     {
@@ -212,7 +221,7 @@ int aeron_publication_image_create(
     _image->log_meta_data->initial_term_id = initial_term_id;
     _image->log_meta_data->mtu_length = sender_mtu_length;
     _image->log_meta_data->term_length = term_buffer_length;
-    _image->log_meta_data->page_size = (int32_t)context->file_page_size;
+    _image->log_meta_data->page_size = (int32_t)page_size;
     _image->log_meta_data->correlation_id = correlation_id;
     _image->log_meta_data->is_connected = 0;
     _image->log_meta_data->active_transport_count = 0;
@@ -226,6 +235,13 @@ int aeron_publication_image_create(
     _image->congestion_control = congestion_control;
     _image->loss_reporter = loss_reporter;
     _image->loss_reporter_offset = -1;
+    _image->latency_reporter = NULL;
+    _image->wire_to_term_latency_offset = -1;
+    _image->term_to_subscriber_latency_offset = -1;
+    _image->latency_sample_interval_ns = (int64_t)context->latency_report_sample_interval_ns;
+    _image->next_latency_sample_ns = 0;
+    _image->latency_sample_timestamp_ns = 0;
+    _image->latency_sample_position = -1;
     _image->conductor_fields.subscribable.correlation_id = correlation_id;
     _image->conductor_fields.subscribable.array = NULL;
     _image->conductor_fields.subscribable.length = 0;
@@ -296,6 +312,8 @@ int aeron_publication_image_create(
         system_counters, AERON_SYSTEM_COUNTER_NAK_MESSAGES_SENT);
     _image->loss_gap_fills_counter = aeron_system_counter_addr(
         system_counters, AERON_SYSTEM_COUNTER_LOSS_GAP_FILLS);
+    _image->fec_recovered_datagrams_counter = aeron_system_counter_addr(
+        system_counters, AERON_SYSTEM_COUNTER_FEC_RECOVERED_DATAGRAMS);
 
     const int64_t initial_position = aeron_logbuffer_compute_position(
         active_term_id, initial_term_offset, _image->position_bits_to_shift, initial_term_id);
@@ -317,8 +335,16 @@ int aeron_publication_image_create(
     _image->last_sm_position = initial_position;
     _image->last_overrun_threshold = initial_position + (term_buffer_length / 2);
     _image->time_of_last_packet_ns = now_ns;
+    _image->rcv_contiguous_position = initial_position;
+    _image->zero_copy_frame = NULL;
     _image->time_of_last_sm_ns = 0;
-    _image->conductor_fields.clean_position = initial_position;
+    // images are always cleaned inline as the receiver window is not held back by a cleaner thread
+    aeron_term_cleaner_log_init(
+        &_image->cleaner_log,
+        &_image->mapped_raw_log,
+        _image->position_bits_to_shift,
+        initial_position,
+        context->term_buffer_clean_non_temporal);
     _image->conductor_fields.time_of_last_state_change_ns = now_ns;
 
     aeron_publication_image_remove_response_session_id(_image);
@@ -373,6 +399,7 @@ bool aeron_publication_image_free(aeron_publication_image_t *image)
 
     aeron_counter_add_ordered(image->mapped_bytes_counter, -((int64_t)image->mapped_raw_log.mapped_file.length));
 
+    aeron_free(image->fec_buffer);
     aeron_free(image->log_file_name);
     aeron_free(image);
 
@@ -381,26 +408,7 @@ bool aeron_publication_image_free(aeron_publication_image_t *image)
 
 void aeron_publication_image_clean_buffer_to(aeron_publication_image_t *image, int64_t position)
 {
-    int64_t clean_position = image->conductor_fields.clean_position;
-    if (position > clean_position)
-    {
-        size_t dirty_index = aeron_logbuffer_index_by_position(clean_position, image->position_bits_to_shift);
-        size_t bytes_to_clean = (size_t)(position - clean_position);
-        size_t term_length = (size_t)image->term_length;
-        size_t term_offset = (size_t)(clean_position & image->term_length_mask);
-        size_t bytes_left_in_term = term_length - term_offset;
-        size_t length = bytes_to_clean < bytes_left_in_term ? bytes_to_clean : bytes_left_in_term;
-
-        memset(
-            image->mapped_raw_log.term_buffers[dirty_index].addr + term_offset + sizeof(int64_t),
-            0,
-            length - sizeof(int64_t));
-
-        uint64_t *ptr = (uint64_t *)(image->mapped_raw_log.term_buffers[dirty_index].addr + term_offset);
-        AERON_PUT_ORDERED(*ptr, (uint64_t)0);
-
-        image->conductor_fields.clean_position = clean_position + (int64_t)length;
-    }
+    aeron_term_cleaner_log_clean_to(&image->cleaner_log, position);
 }
 
 // Called from conductor via loss detector.
@@ -446,6 +454,80 @@ void aeron_publication_image_on_gap_detected(void *clientd, int32_t term_id, int
     }
 }
 
+static int64_t aeron_publication_image_realtime_ns(void)
+{
+    struct timespec now;
+    if (aeron_clock_gettime_realtime(&now) < 0)
+    {
+        return -1;
+    }
+
+    return (INT64_C(1000) * 1000 * 1000 * now.tv_sec) + now.tv_nsec;
+}
+
+// Called from receiver.
+static void aeron_publication_image_record_latency(
+    aeron_publication_image_t *image,
+    struct timespec *media_receive_timestamp,
+    int64_t position,
+    int64_t now_ns)
+{
+    int64_t sample_position;
+    AERON_GET_VOLATILE(sample_position, image->latency_sample_position);
+
+    const bool has_wire_to_term = NULL != media_receive_timestamp && image->wire_to_term_latency_offset >= 0;
+    const bool is_term_to_subscriber_due = image->term_to_subscriber_latency_offset >= 0 &&
+        now_ns >= image->next_latency_sample_ns &&
+        -1 == sample_position;
+
+    if (has_wire_to_term || is_term_to_subscriber_due)
+    {
+        const int64_t timestamp_ns = aeron_publication_image_realtime_ns();
+        if (timestamp_ns < 0)
+        {
+            return;
+        }
+
+        if (has_wire_to_term)
+        {
+            const int64_t media_receive_timestamp_ns =
+                (INT64_C(1000) * 1000 * 1000 * media_receive_timestamp->tv_sec) + media_receive_timestamp->tv_nsec;
+            aeron_latency_reporter_record(
+                image->latency_reporter,
+                image->wire_to_term_latency_offset,
+                timestamp_ns - media_receive_timestamp_ns);
+        }
+
+        if (is_term_to_subscriber_due)
+        {
+            image->latency_sample_timestamp_ns = timestamp_ns;
+            image->next_latency_sample_ns = now_ns + image->latency_sample_interval_ns;
+            AERON_PUT_ORDERED(image->latency_sample_position, position);
+        }
+    }
+}
+
+// Called from conductor.
+static void aeron_publication_image_check_latency_sample(aeron_publication_image_t *image, int64_t min_sub_pos)
+{
+    int64_t sample_position;
+    AERON_GET_VOLATILE(sample_position, image->latency_sample_position);
+
+    if (-1 != sample_position && min_sub_pos >= sample_position)
+    {
+        const int64_t timestamp_ns = aeron_publication_image_realtime_ns();
+        if (timestamp_ns >= 0)
+        {
+            aeron_latency_reporter_record(
+                image->latency_reporter,
+                image->term_to_subscriber_latency_offset,
+                timestamp_ns - image->latency_sample_timestamp_ns);
+        }
+
+        AERON_PUT_ORDERED(image->latency_sample_position, INT64_C(-1));
+    }
+}
+
 void aeron_publication_image_track_rebuild(aeron_publication_image_t *image, int64_t now_ns)
 {
     if (aeron_driver_subscribable_has_working_positions(&image->conductor_fields.subscribable))
@@ -472,6 +554,11 @@ void aeron_publication_image_track_rebuild(aeron_publication_image_t *image, int
             return;
         }
 
+        if (NULL != image->latency_reporter)
+        {
+            aeron_publication_image_check_latency_sample(image, min_sub_pos);
+        }
+
         const int64_t rebuild_position = *image->rcv_pos_position.value_addr > max_sub_pos ?
             *image->rcv_pos_position.value_addr : max_sub_pos;
 
@@ -613,7 +700,8 @@ int aeron_publication_image_insert_packet(
     int32_t term_offset,
     const uint8_t *buffer,
     size_t length,
-    struct sockaddr_storage *addr)
+    struct sockaddr_storage *addr,
+    struct timespec *media_receive_timestamp)
 {
     if (aeron_sub_wrap_i32(term_id, image->initial_term_id) < 0)
     {
@@ -651,11 +739,11 @@ int aeron_publication_image_insert_packet(
                 }
 
                 aeron_counter_propose_max_ordered(image->rcv_hwm_position.value_addr, proposed_position);
-                aeron_counter_ordered_increment(image->heartbeats_received_counter, 1);
+                aeron_counter_increment(image->heartbeats_received_counter, 1);
             }
             else
             {
-                aeron_counter_ordered_increment(image->flow_control_under_runs_counter, 1);
+                aeron_counter_increment(image->flow_control_under_runs_counter, 1);
             }
         }
         else if (!aeron_publication_image_is_flow_control_under_run(image, packet_position))
@@ -666,9 +754,28 @@ int aeron_publication_image_insert_packet(
             const size_t index = aeron_logbuffer_index_by_position(packet_position, image->position_bits_to_shift);
             uint8_t *term_buffer = image->mapped_raw_log.term_buffers[index].addr;
 
-            aeron_term_rebuilder_insert(term_buffer + term_offset, buffer, length);
+            uint8_t *frame = term_buffer + term_offset;
+            if (frame == image->zero_copy_frame)
+            {
+                // the payload was received in place by the receiver so only the header is left to publish the frame
+                aeron_term_rebuilder_insert_header(frame, buffer);
+            }
+            else
+            {
+                aeron_term_rebuilder_insert(frame, buffer, length);
+            }
+
+            if (packet_position == image->rcv_contiguous_position)
+            {
+                image->rcv_contiguous_position = proposed_position;
+            }
 
             aeron_counter_propose_max_ordered(image->rcv_hwm_position.value_addr, proposed_position);
+
+            if (NULL != image->latency_reporter)
+            {
+                aeron_publication_image_record_latency(image, media_receive_timestamp, proposed_position, now_ns);
+            }
         }
         else if (proposed_position >= (image->last_sm_position - image->max_receiver_window_length))
         {
@@ -690,6 +797,58 @@ int aeron_publication_image_on_rttm(
     return 1;
 }
 
+// Called from receiver.
+int aeron_publication_image_on_fec(
+    aeron_publication_image_t *image,
+    aeron_receive_destination_t *destination,
+    aeron_fec_header_t *header,
+    size_t length,
+    struct sockaddr_storage *addr)
+{
+    const int32_t group_length = aeron_fec_group_length(header, length, (size_t)image->mtu_length);
+    if (group_length < 0 || aeron_sub_wrap_i32(header->term_id, image->initial_term_id) < 0)
+    {
+        return 0;
+    }
+
+    const int64_t start_position = aeron_logbuffer_compute_position(
+        header->term_id, header->term_offset, image->position_bits_to_shift, image->initial_term_id);
+    const int64_t end_position = start_position + group_length;
+
+    // only a group wholly inside the window can be checked against the term without racing the cleaner
+    if (start_position < image->last_sm_position ||
+        end_position > image->last_overrun_threshold ||
+        end_position <= aeron_counter_get(image->rcv_pos_position.value_addr))
+    {
+        return 0;
+    }
+
+    if (NULL == image->fec_buffer && aeron_alloc((void **)&image->fec_buffer, (size_t)image->mtu_length) < 0)
+    {
+        AERON_APPEND_ERR("%s", "Unable to allocate FEC buffer");
+        return -1;
+    }
+
+    const size_t index = aeron_logbuffer_index_by_position(start_position, image->position_bits_to_shift);
+    int32_t term_offset = 0;
+    const size_t recovered_length = aeron_fec_recover(
+        header,
+        image->mapped_raw_log.term_buffers[index].addr,
+        (size_t)image->term_length_mask + 1,
+        image->fec_buffer,
+        &term_offset);
+
+    if (0 == recovered_length)
+    {
+        return 0;
+    }
+
+    aeron_counter_increment(image->fec_recovered_datagrams_counter, 1);
+
+    return aeron_publication_image_insert_packet(
+        image, destination, header->term_id, term_offset, image->fec_buffer, recovered_length, addr, NULL);
+}
+
 // Called from receiver.
 int aeron_publication_image_send_pending_status_message(aeron_publication_image_t *image, int64_t now_ns)
 {
@@ -772,7 +931,7 @@ int aeron_publication_image_send_pending_status_message(aeron_publication_image_
                     }
 
                     work_count++;
-                    aeron_counter_ordered_increment(image->status_messages_sent_counter, 1);
+                    aeron_counter_increment(image->status_messages_sent_counter, 1);
                 }
             }
 
@@ -833,7 +992,7 @@ int aeron_publication_image_send_pending_loss(aeron_publication_image_t *image)
                         }
 
                         work_count++;
-                        aeron_counter_ordered_increment(image->nak_messages_sent_counter, 1);
+                        aeron_counter_increment(image->nak_messages_sent_counter, 1);
                     }
                 }
             }
@@ -844,7 +1003,7 @@ int aeron_publication_image_send_pending_loss(aeron_publication_image_t *image)
 
                 if (aeron_term_gap_filler_try_fill_gap(image->log_meta_data, buffer, term_id, term_offset, length))
                 {
-                    aeron_counter_ordered_increment(image->loss_gap_fills_counter, 1);
+                    aeron_counter_increment(image->loss_gap_fills_counter, 1);
                 }
 
                 work_count = 1;
@@ -1072,7 +1231,8 @@ void aeron_publication_image_on_time_event(
                 image->conductor_fields.time_of_last_state_change_ns = now_ns;
 
                 aeron_receive_channel_endpoint_dec_image_ref_count(image->endpoint);
-                aeron_driver_receiver_proxy_on_remove_publication_image(conductor->context->receiver_proxy, image);
+                aeron_driver_receiver_proxy_on_remove_publication_image(
+                    image->conductor_fields.endpoint->receiver_proxy, image);
                 aeron_driver_conductor_image_transition_to_linger(conductor, image);
 
                 aeron_receive_channel_endpoint_try_remove_endpoint(image->endpoint);
@@ -21,7 +21,9 @@
 #include "media/aeron_receive_channel_endpoint.h"
 #include "aeron_congestion_control.h"
 #include "aeron_loss_detector.h"
+#include "concurrent/aeron_term_cleaner.h"
 #include "reports/aeron_loss_reporter.h"
+#include "reports/aeron_latency_reporter.h"
 
 typedef enum aeron_publication_image_state_enum
 {
@@ -62,7 +64,6 @@ typedef struct aeron_publication_image_stct
         int64_t liveness_timeout_ns;
         int64_t untethered_window_limit_timeout_ns;
         int64_t untethered_resting_timeout_ns;
-        int64_t clean_position;
         aeron_receive_channel_endpoint_t *endpoint;
         uint8_t flags;
     }
@@ -85,6 +86,7 @@ typedef struct aeron_publication_image_stct
     aeron_feedback_delay_generator_state_t feedback_delay_state;
 
     aeron_mapped_raw_log_t mapped_raw_log;
+    aeron_term_cleaner_log_t cleaner_log;
     aeron_position_t rcv_hwm_position;
     aeron_position_t rcv_pos_position;
     aeron_logbuffer_metadata_t *log_meta_data;
@@ -98,6 +100,18 @@ typedef struct aeron_publication_image_stct
     aeron_loss_reporter_t *loss_reporter;
     aeron_loss_reporter_entry_offset_t loss_reporter_offset;
 
+    /*
+     * The term-sub hop is sampled by the receiver storing the position and time of an insert, which the conductor
+     * completes once the minimum subscriber position reaches it.
+     */
+    aeron_latency_reporter_t *latency_reporter;
+    aeron_latency_reporter_entry_offset_t wire_to_term_latency_offset;
+    aeron_latency_reporter_entry_offset_t term_to_subscriber_latency_offset;
+    int64_t latency_sample_interval_ns;
+    int64_t next_latency_sample_ns;
+    int64_t latency_sample_timestamp_ns;
+    volatile int64_t latency_sample_position;
+
     char *log_file_name;
     int32_t session_id;
     int32_t stream_id;
@@ -136,6 +150,8 @@ typedef struct aeron_publication_image_stct
     int64_t sm_timeout_ns;
 
     int64_t time_of_last_packet_ns;
+    int64_t rcv_contiguous_position;
+    const uint8_t *zero_copy_frame;
 
     volatile int64_t response_session_id;
 
@@ -143,6 +159,8 @@ typedef struct aeron_publication_image_stct
     volatile bool is_sending_eos_sm;
     volatile bool has_receiver_released;
 
+    uint8_t *fec_buffer;
+
     volatile int64_t *heartbeats_received_counter;
     volatile int64_t *flow_control_under_runs_counter;
     volatile int64_t *flow_control_over_runs_counter;
@@ -150,6 +168,7 @@ typedef struct aeron_publication_image_stct
     volatile int64_t *nak_messages_sent_counter;
     volatile int64_t *loss_gap_fills_counter;
     volatile int64_t *mapped_bytes_counter;
+    volatile int64_t *fec_recovered_datagrams_counter;
 }
 aeron_publication_image_t;
 
@@ -175,6 +194,7 @@ int aeron_publication_image_create(
     aeron_loss_reporter_t *loss_reporter,
     bool is_reliable,
     bool is_sparse,
+    bool is_huge_pages,
     bool treat_as_multicast,
     aeron_system_counters_t *system_counters);
 
@@ -195,11 +215,19 @@ int aeron_publication_image_insert_packet(
     int32_t term_offset,
     const uint8_t *buffer,
     size_t length,
-    struct sockaddr_storage *addr);
+    struct sockaddr_storage *addr,
+    struct timespec *media_receive_timestamp);
 
 int aeron_publication_image_on_rttm(
     aeron_publication_image_t *image, aeron_rttm_header_t *header, struct sockaddr_storage *addr);
 
+int aeron_publication_image_on_fec(
+    aeron_publication_image_t *image,
+    aeron_receive_destination_t *destination,
+    aeron_fec_header_t *header,
+    size_t length,
+    struct sockaddr_storage *addr);
+
 int aeron_publication_image_send_pending_status_message(aeron_publication_image_t *image, int64_t now_ns);
 
 int aeron_publication_image_send_pending_loss(aeron_publication_image_t *image);
@@ -234,7 +262,7 @@ inline bool aeron_publication_image_is_flow_control_under_run(aeron_publication_
 
     if (is_flow_control_under_run)
     {
-        aeron_counter_ordered_increment(image->flow_control_under_runs_counter, 1);
+        aeron_counter_increment(image->flow_control_under_runs_counter, 1);
     }
 
     return is_flow_control_under_run;
@@ -247,7 +275,7 @@ inline bool aeron_publication_image_is_flow_control_over_run(
 
     if (is_flow_control_over_run)
     {
-        aeron_counter_ordered_increment(image->flow_control_over_runs_counter, 1);
+        aeron_counter_increment(image->flow_control_over_runs_counter, 1);
     }
 
     return is_flow_control_over_run;
@@ -0,0 +1,294 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/aeron_platform.h"
+#if defined(AERON_COMPILER_MSVC)
+#define S_IRWXU 0
+#define S_IRWXG 0
+#define S_IRWXO 0
+#endif
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <inttypes.h>
+
+#include "aeron_raw_log_pool.h"
+#include "aeron_alloc.h"
+#include "util/aeron_error.h"
+
+int aeron_raw_log_pool_init(
+    aeron_raw_log_pool_t *pool,
+    const char *aeron_dir,
+    size_t entries_per_term_length,
+    const uint64_t *term_lengths,
+    size_t term_lengths_length,
+    uint64_t page_size,
+    aeron_executor_t *executor,
+    aeron_raw_log_pool_error_func_t error_func,
+    void *error_clientd)
+{
+    pool->entries = NULL;
+    pool->entries_length = 0;
+    pool->term_lengths_length = 0;
+    pool->page_size = page_size;
+    pool->next_file_id = 0;
+    pool->fill_in_flight = false;
+    pool->fill_suspended = false;
+    pool->executor = executor;
+    pool->error_func = error_func;
+    pool->error_clientd = error_clientd;
+
+    for (size_t i = 0; i < term_lengths_length; i++)
+    {
+        bool is_duplicate = false;
+        for (size_t j = 0; j < pool->term_lengths_length; j++)
+        {
+            is_duplicate |= pool->term_lengths[j] == term_lengths[i];
+        }
+
+        if (!is_duplicate)
+        {
+            if (pool->term_lengths_length >= AERON_RAW_LOG_POOL_MAX_TERM_LENGTHS)
+            {
+                AERON_SET_ERR(
+                    EINVAL, "log buffer pool supports at most %d term lengths", AERON_RAW_LOG_POOL_MAX_TERM_LENGTHS);
+                return -1;
+            }
+
+            pool->term_lengths[pool->term_lengths_length++] = term_lengths[i];
+        }
+    }
+
+    if (aeron_file_resolve(aeron_dir, AERON_LOG_BUFFER_POOL_DIR, pool->dir, sizeof(pool->dir)) < 0)
+    {
+        AERON_APPEND_ERR("%s", "Unable to get log buffer pool directory filename");
+        return -1;
+    }
+
+    if (!aeron_is_directory(pool->dir) && aeron_mkdir(pool->dir, S_IRWXU | S_IRWXG | S_IRWXO) != 0)
+    {
+        AERON_SET_ERR(errno, "Failed to mkdir log buffer pool directory: %s", pool->dir);
+        return -1;
+    }
+
+    const size_t entries_length = entries_per_term_length * pool->term_lengths_length;
+    if (aeron_alloc((void **)&pool->entries, entries_length * sizeof(aeron_raw_log_pool_entry_t)) < 0)
+    {
+        AERON_APPEND_ERR("%s", "Unable to allocate log buffer pool entries");
+        return -1;
+    }
+    pool->entries_length = entries_length;
+
+    // interleave term lengths so that each is filled at the same rate
+    for (size_t i = 0; i < entries_length; i++)
+    {
+        aeron_raw_log_pool_entry_t *entry = &pool->entries[i];
+        entry->pool = pool;
+        entry->state = AERON_RAW_LOG_POOL_ENTRY_FREE;
+        entry->is_mapped = false;
+        entry->term_length = pool->term_lengths[i % pool->term_lengths_length];
+        entry->path[0] = '\0';
+    }
+
+    return 0;
+}
+
+static int aeron_raw_log_pool_fill_execute(void *task_clientd, void *executor_clientd)
+{
+    aeron_raw_log_pool_entry_t *entry = (aeron_raw_log_pool_entry_t *)task_clientd;
+
+    if (aeron_raw_log_map(&entry->mapped_raw_log, entry->path, false, entry->term_length, entry->pool->page_size) < 0)
+    {
+        AERON_APPEND_ERR("Failed to fill log buffer pool, term_length=%" PRIu64, entry->term_length);
+        return -1;
+    }
+
+    entry->is_mapped = true;
+
+    return 0;
+}
+
+static void aeron_raw_log_pool_fill_complete(
+    int execution_result, int errcode, const char *errmsg, void *task_clientd, void *executor_clientd)
+{
+    aeron_raw_log_pool_entry_t *entry = (aeron_raw_log_pool_entry_t *)task_clientd;
+    aeron_raw_log_pool_t *pool = entry->pool;
+
+    pool->fill_in_flight = false;
+
+    if (execution_result < 0)
+    {
+        // stop filling until demand shows up again rather than retrying a full disk every duty cycle
+        entry->state = AERON_RAW_LOG_POOL_ENTRY_FREE;
+        pool->fill_suspended = true;
+        if (NULL != pool->error_func)
+        {
+            pool->error_func(pool->error_clientd, errcode, errmsg);
+        }
+        return;
+    }
+
+    entry->state = AERON_RAW_LOG_POOL_ENTRY_READY;
+}
+
+int aeron_raw_log_pool_do_work(aeron_raw_log_pool_t *pool)
+{
+    if (pool->fill_in_flight || pool->fill_suspended)
+    {
+        return 0;
+    }
+
+    for (size_t i = 0; i < pool->entries_length; i++)
+    {
+        aeron_raw_log_pool_entry_t *entry = &pool->entries[i];
+        if (AERON_RAW_LOG_POOL_ENTRY_FREE != entry->state)
+        {
+            continue;
+        }
+
+        char filename[64];
+        snprintf(filename, sizeof(filename), "%" PRId64 ".logbuffer", pool->next_file_id++);
+        if (aeron_file_resolve(pool->dir, filename, entry->path, sizeof(entry->path)) < 0)
+        {
+            AERON_APPEND_ERR("%s", "Unable to get log buffer pool filename");
+            return -1;
+        }
+
+        entry->state = AERON_RAW_LOG_POOL_ENTRY_FILLING;
+        entry->is_mapped = false;
+        pool->fill_in_flight = true;
+
+        if (aeron_executor_submit(
+            pool->executor, aeron_raw_log_pool_fill_execute, aeron_raw_log_pool_fill_complete, entry) < 0)
+        {
+            entry->state = AERON_RAW_LOG_POOL_ENTRY_FREE;
+            pool->fill_in_flight = false;
+            AERON_APPEND_ERR("%s", "");
+            return -1;
+        }
+
+        return 1;
+    }
+
+    return 0;
+}
+
+static void aeron_raw_log_pool_entry_free(aeron_raw_log_pool_entry_t *entry)
+{
+    if (entry->is_mapped)
+    {
+        aeron_raw_log_free(&entry->mapped_raw_log, entry->path);
+        entry->is_mapped = false;
+    }
+
+    entry->state = AERON_RAW_LOG_POOL_ENTRY_FREE;
+}
+
+bool aeron_raw_log_pool_lease(
+    aeron_raw_log_pool_t *pool,
+    aeron_mapped_raw_log_t *mapped_raw_log,
+    const char *path,
+    uint64_t term_length,
+    uint64_t page_size)
+{
+    pool->fill_suspended = false;
+
+    if (page_size != pool->page_size)
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < pool->entries_length; i++)
+    {
+        aeron_raw_log_pool_entry_t *entry = &pool->entries[i];
+        if (AERON_RAW_LOG_POOL_ENTRY_READY != entry->state || term_length != entry->term_length)
+        {
+            continue;
+        }
+
+        if (rename(entry->path, path) < 0)
+        {
+            const int errcode = errno;
+            if (NULL != pool->error_func)
+            {
+                char description[AERON_MAX_PATH * 2 + 64];
+                snprintf(
+                    description, sizeof(description), "Failed to lease log buffer, rename %s to %s", entry->path, path);
+                pool->error_func(pool->error_clientd, errcode, description);
+            }
+
+            aeron_raw_log_pool_entry_free(entry);
+            return false;
+        }
+
+        memcpy(mapped_raw_log, &entry->mapped_raw_log, sizeof(aeron_mapped_raw_log_t));
+        entry->state = AERON_RAW_LOG_POOL_ENTRY_FREE;
+        entry->is_mapped = false;
+
+        return true;
+    }
+
+    return false;
+}
+
+int aeron_raw_log_pool_map(
+    aeron_raw_log_pool_t *pool,
+    aeron_raw_log_map_func_t map_func,
+    aeron_mapped_raw_log_t *mapped_raw_log,
+    const char *path,
+    bool use_sparse_files,
+    uint64_t term_length,
+    uint64_t page_size)
+{
+    if (NULL != pool && !use_sparse_files &&
+        aeron_raw_log_pool_lease(pool, mapped_raw_log, path, term_length, page_size))
+    {
+        return 0;
+    }
+
+    return map_func(mapped_raw_log, path, use_sparse_files, term_length, page_size);
+}
+
+size_t aeron_raw_log_pool_available(aeron_raw_log_pool_t *pool, uint64_t term_length)
+{
+    size_t available = 0;
+
+    for (size_t i = 0; i < pool->entries_length; i++)
+    {
+        aeron_raw_log_pool_entry_t *entry = &pool->entries[i];
+        if (AERON_RAW_LOG_POOL_ENTRY_READY == entry->state && term_length == entry->term_length)
+        {
+            available++;
+        }
+    }
+
+    return available;
+}
+
+void aeron_raw_log_pool_close(aeron_raw_log_pool_t *pool)
+{
+    for (size_t i = 0; i < pool->entries_length; i++)
+    {
+        aeron_raw_log_pool_entry_free(&pool->entries[i]);
+    }
+
+    aeron_free(pool->entries);
+    pool->entries = NULL;
+    pool->entries_length = 0;
+
+    remove(pool->dir);
+}
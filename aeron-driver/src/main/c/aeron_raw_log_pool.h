@@ -0,0 +1,120 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_RAW_LOG_POOL_H
+#define AERON_RAW_LOG_POOL_H
+
+#include "aeron_driver_common.h"
+#include "aeron_common.h"
+#include "util/aeron_fileutil.h"
+#include "concurrent/aeron_executor.h"
+
+#define AERON_LOG_BUFFER_POOL_DIR "log-buffer-pool"
+#define AERON_RAW_LOG_POOL_MAX_TERM_LENGTHS (2)
+
+typedef void (*aeron_raw_log_pool_error_func_t)(void *clientd, int errcode, const char *description);
+
+typedef enum aeron_raw_log_pool_entry_state_en
+{
+    AERON_RAW_LOG_POOL_ENTRY_FREE,
+    AERON_RAW_LOG_POOL_ENTRY_FILLING,
+    AERON_RAW_LOG_POOL_ENTRY_READY
+}
+aeron_raw_log_pool_entry_state_t;
+
+typedef struct aeron_raw_log_pool_stct aeron_raw_log_pool_t;
+
+typedef struct aeron_raw_log_pool_entry_stct
+{
+    aeron_raw_log_pool_t *pool;
+    aeron_raw_log_pool_entry_state_t state;
+    bool is_mapped;
+    uint64_t term_length;
+    aeron_mapped_raw_log_t mapped_raw_log;
+    char path[AERON_MAX_PATH];
+}
+aeron_raw_log_pool_entry_t;
+
+/*
+ * Pool of log buffer files which are created, sized, and pre-touched on the executor ahead of need so that the
+ * conductor only has to rename one into place when a publication or image is added. The pool is confined to the
+ * conductor thread apart from the entry being filled, which is owned by the executor until its completion runs.
+ *
+ * A freed log is not returned to the pool as clients may still have it mapped, instead the slot its lease emptied
+ * is refilled with a new file.
+ */
+struct aeron_raw_log_pool_stct
+{
+    aeron_raw_log_pool_entry_t *entries;
+    size_t entries_length;
+    uint64_t term_lengths[AERON_RAW_LOG_POOL_MAX_TERM_LENGTHS];
+    size_t term_lengths_length;
+    uint64_t page_size;
+    int64_t next_file_id;
+    bool fill_in_flight;
+    bool fill_suspended;
+    aeron_executor_t *executor;
+    aeron_raw_log_pool_error_func_t error_func;
+    void *error_clientd;
+    char dir[AERON_MAX_PATH];
+};
+
+int aeron_raw_log_pool_init(
+    aeron_raw_log_pool_t *pool,
+    const char *aeron_dir,
+    size_t entries_per_term_length,
+    const uint64_t *term_lengths,
+    size_t term_lengths_length,
+    uint64_t page_size,
+    aeron_executor_t *executor,
+    aeron_raw_log_pool_error_func_t error_func,
+    void *error_clientd);
+
+/*
+ * Submit the next empty slot to the executor for filling if none is already in flight.
+ */
+int aeron_raw_log_pool_do_work(aeron_raw_log_pool_t *pool);
+
+/*
+ * Move a ready log of the given term length to path. Returns true if one was available.
+ */
+bool aeron_raw_log_pool_lease(
+    aeron_raw_log_pool_t *pool,
+    aeron_mapped_raw_log_t *mapped_raw_log,
+    const char *path,
+    uint64_t term_length,
+    uint64_t page_size);
+
+/*
+ * Lease a log from the pool when one matches the request, or create it with map_func otherwise.
+ */
+int aeron_raw_log_pool_map(
+    aeron_raw_log_pool_t *pool,
+    aeron_raw_log_map_func_t map_func,
+    aeron_mapped_raw_log_t *mapped_raw_log,
+    const char *path,
+    bool use_sparse_files,
+    uint64_t term_length,
+    uint64_t page_size);
+
+size_t aeron_raw_log_pool_available(aeron_raw_log_pool_t *pool, uint64_t term_length);
+
+/*
+ * Unmap and remove all pooled files. The executor must be closed first so that no fill is still running.
+ */
+void aeron_raw_log_pool_close(aeron_raw_log_pool_t *pool);
+
+#endif //AERON_RAW_LOG_POOL_H
@@ -14,56 +14,112 @@
  * limitations under the License.
  */
 
+#include <errno.h>
+
+#include "collections/aeron_hashing.h"
 #include "concurrent/aeron_counters_manager.h"
 #include "protocol/aeron_udp_protocol.h"
+#include "util/aeron_arrayutil.h"
 #include "util/aeron_error.h"
+#include "aeron_alloc.h"
 #include "aeron_retransmit_handler.h"
 #include "aeron_flow_control.h"
 
-int aeron_retransmit_handler_scan_for_available_retransmit(
-    aeron_retransmit_handler_t *handler,
-    int32_t term_id,
-    int32_t term_offset,
-    size_t length,
-    aeron_retransmit_action_t **actionp);
+static void aeron_retransmit_handler_deactivate_from(aeron_retransmit_handler_t *handler, size_t index)
+{
+    for (size_t i = index; i < handler->retransmit_actions_capacity; i++)
+    {
+        handler->retransmit_actions[i].state = AERON_RETRANSMIT_ACTION_STATE_INACTIVE;
+    }
+}
 
 int aeron_retransmit_handler_init(
     aeron_retransmit_handler_t *handler,
     int64_t *invalid_packets_counter,
+    int64_t *naks_coalesced_counter,
+    int64_t *naks_suppressed_counter,
     uint64_t delay_timeout_ns,
     uint64_t linger_timeout_ns)
 {
     handler->invalid_packets_counter = invalid_packets_counter;
+    handler->naks_coalesced_counter = naks_coalesced_counter;
+    handler->naks_suppressed_counter = naks_suppressed_counter;
     handler->delay_timeout_ns = delay_timeout_ns;
     handler->linger_timeout_ns = linger_timeout_ns;
+    handler->retransmit_actions = NULL;
+    handler->retransmit_actions_capacity = 0;
+    handler->active_retransmit_count = 0;
 
-    for (size_t i = 0; i < AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS; i++)
+    if (aeron_array_ensure_capacity(
+        (uint8_t **)&handler->retransmit_actions,
+        sizeof(aeron_retransmit_action_t),
+        0,
+        AERON_RETRANSMIT_HANDLER_INITIAL_RETRANSMITS) < 0)
     {
-        handler->retransmit_action_pool[i].state = AERON_RETRANSMIT_ACTION_STATE_INACTIVE;
+        AERON_APPEND_ERR("%s", "Unable to allocate retransmit actions");
+        return -1;
     }
 
-    handler->active_retransmit_count = 0;
+    handler->retransmit_actions_capacity = AERON_RETRANSMIT_HANDLER_INITIAL_RETRANSMITS;
+    aeron_retransmit_handler_deactivate_from(handler, 0);
 
     return 0;
 }
 
 void aeron_retransmit_handler_close(aeron_retransmit_handler_t *handler)
 {
+    aeron_free(handler->retransmit_actions);
+    handler->retransmit_actions = NULL;
+    handler->retransmit_actions_capacity = 0;
 }
 
-aeron_retransmit_action_t *aeron_retransmit_handler_add_retransmit(aeron_retransmit_handler_t *handler, aeron_retransmit_action_t *action)
+static aeron_retransmit_action_t *aeron_retransmit_handler_add_retransmit(aeron_retransmit_handler_t *handler)
 {
+    if ((size_t)handler->active_retransmit_count < handler->retransmit_actions_capacity)
+    {
+        for (size_t i = 0; i < handler->retransmit_actions_capacity; i++)
+        {
+            aeron_retransmit_action_t *action = &handler->retransmit_actions[i];
+            if (AERON_RETRANSMIT_ACTION_STATE_INACTIVE == action->state)
+            {
+                ++handler->active_retransmit_count;
+                return action;
+            }
+        }
+    }
+
+    const size_t old_capacity = handler->retransmit_actions_capacity;
+    if (old_capacity >= AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS)
+    {
+        AERON_SET_ERR(EINVAL, "%s", "maximum number of active RetransmitActions reached");
+        return NULL;
+    }
+
+    const size_t new_capacity = old_capacity * 2 < AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS ?
+        old_capacity * 2 : AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS;
+    if (aeron_array_ensure_capacity(
+        (uint8_t **)&handler->retransmit_actions, sizeof(aeron_retransmit_action_t), old_capacity, new_capacity) < 0)
+    {
+        AERON_APPEND_ERR("%s", "Unable to grow retransmit actions");
+        return NULL;
+    }
+
+    handler->retransmit_actions_capacity = new_capacity;
+    aeron_retransmit_handler_deactivate_from(handler, old_capacity);
+
     ++handler->active_retransmit_count;
-    return action;
+    return &handler->retransmit_actions[old_capacity];
 }
 
-void aeron_retransmit_handler_remove_retransmit(aeron_retransmit_handler_t *handler, aeron_retransmit_action_t *action)
+static void aeron_retransmit_handler_remove_retransmit(
+    aeron_retransmit_handler_t *handler, aeron_retransmit_action_t *action)
 {
     --handler->active_retransmit_count;
     action->state = AERON_RETRANSMIT_ACTION_STATE_INACTIVE;
 }
 
-bool aeron_retransmit_handler_is_invalid(aeron_retransmit_handler_t *handler, int32_t term_offset, size_t term_length)
+static bool aeron_retransmit_handler_is_invalid(
+    aeron_retransmit_handler_t *handler, int32_t term_offset, size_t term_length)
 {
     const bool is_invalid = (term_offset > ((int32_t)(term_length - AERON_DATA_HEADER_LENGTH))) || (term_offset < 0);
 
@@ -75,50 +131,257 @@ bool aeron_retransmit_handler_is_invalid(aeron_retransmit_handler_t *handler, in
     return is_invalid;
 }
 
-int aeron_retransmit_handler_on_nak(
+/*
+ * Trim [*start, *end) against the retransmits already active for the term, recording the receiver against those it
+ * overlaps. Returns true if the receiver had already asked for every overlapped range. Trimming stops at the first
+ * retransmit lying strictly within the range, leaving the uncovered prefix in [*start, *end) and the uncovered suffix
+ * in [*suffix_start, *suffix_end) for the caller to handle in turn.
+ */
+static bool aeron_retransmit_handler_trim(
     aeron_retransmit_handler_t *handler,
     int32_t term_id,
-    int32_t term_offset,
-    size_t length,
+    int32_t *start,
+    int32_t *end,
+    int32_t *suffix_start,
+    int32_t *suffix_end,
+    uint64_t receiver_bit)
+{
+    bool is_repeat = true;
+    bool is_trimmed;
+
+    do
+    {
+        is_trimmed = false;
+
+        for (size_t i = 0; i < handler->retransmit_actions_capacity && *start < *end; i++)
+        {
+            aeron_retransmit_action_t *action = &handler->retransmit_actions[i];
+            if (AERON_RETRANSMIT_ACTION_STATE_INACTIVE == action->state || action->term_id != term_id)
+            {
+                continue;
+            }
+
+            const int32_t action_end = action->term_offset + (int32_t)action->length;
+            if (action->term_offset <= *start && *start < action_end)
+            {
+                // a capped end may fall mid-frame so the remainder cannot be resent from there
+                if (action->is_length_capped && action_end < *end)
+                {
+                    continue;
+                }
+
+                *start = action_end;
+            }
+            else if (action->term_offset < *end && *end <= action_end)
+            {
+                *end = action->term_offset;
+            }
+            else if (*start < action->term_offset && action_end < *end && !action->is_length_capped)
+            {
+                *suffix_start = action_end;
+                *suffix_end = *end;
+                *end = action->term_offset;
+                is_repeat = is_repeat && 0 != (action->receiver_mask & receiver_bit);
+                action->receiver_mask |= receiver_bit;
+
+                return is_repeat;
+            }
+            else
+            {
+                continue;
+            }
+
+            is_repeat = is_repeat && 0 != (action->receiver_mask & receiver_bit);
+            action->receiver_mask |= receiver_bit;
+            is_trimmed = true;
+        }
+    }
+    while (is_trimmed && *start < *end);
+
+    return is_repeat;
+}
+
+static bool aeron_retransmit_handler_merge_delayed(
+    aeron_retransmit_handler_t *handler,
+    int32_t term_id,
+    int32_t start,
+    int32_t end,
+    size_t term_length,
+    size_t mtu_length,
+    aeron_flow_control_strategy_t *flow_control,
+    uint64_t receiver_bit,
+    bool is_length_capped)
+{
+    for (size_t i = 0; i < handler->retransmit_actions_capacity; i++)
+    {
+        aeron_retransmit_action_t *action = &handler->retransmit_actions[i];
+        if (AERON_RETRANSMIT_ACTION_STATE_DELAYED != action->state || action->term_id != term_id)
+        {
+            continue;
+        }
+
+        const int32_t action_end = action->term_offset + (int32_t)action->length;
+        if (action_end != start && end != action->term_offset)
+        {
+            continue;
+        }
+
+        const int32_t merged_offset = action->term_offset < start ? action->term_offset : start;
+        const size_t merged_length = (size_t)((action_end > end ? action_end : end) - merged_offset);
+        if (flow_control->max_retransmission_length(
+            flow_control->state, (size_t)merged_offset, merged_length, term_length, mtu_length) < merged_length)
+        {
+            continue;
+        }
+
+        action->term_offset = merged_offset;
+        action->length = merged_length;
+        action->receiver_mask |= receiver_bit;
+        action->is_length_capped = action_end == start ? is_length_capped : action->is_length_capped;
+
+        return true;
+    }
+
+    return false;
+}
+
+static int aeron_retransmit_handler_on_range(
+    aeron_retransmit_handler_t *handler,
+    int32_t term_id,
+    int32_t start,
+    int32_t end,
+    bool is_length_capped,
     size_t term_length,
     size_t mtu_length,
     aeron_flow_control_strategy_t *flow_control,
+    uint64_t receiver_bit,
     int64_t now_ns,
     aeron_retransmit_handler_resend_func_t resend,
     void *resend_clientd)
 {
     int result = 0;
 
-    if (!aeron_retransmit_handler_is_invalid(handler, term_offset, term_length))
+    if (handler->active_retransmit_count > 0)
     {
-        const size_t retransmit_length = flow_control->max_retransmission_length(flow_control->state, term_offset, length, term_length, mtu_length);
-        aeron_retransmit_action_t *action = NULL;
-        if (aeron_retransmit_handler_scan_for_available_retransmit(handler, term_id, term_offset, retransmit_length, &action) != 0)
+        const int32_t capped_end = end;
+        int32_t suffix_start = end;
+        int32_t suffix_end = end;
+        const bool is_repeat = aeron_retransmit_handler_trim(
+            handler, term_id, &start, &end, &suffix_start, &suffix_end, receiver_bit);
+
+        if (suffix_start < suffix_end)
         {
-            AERON_APPEND_ERR("dropping nak termId=%d termOffset=%d retransmit_length=%d", term_id, term_offset, retransmit_length);
-            return -1;
+            // a retransmit lies within the range so each uncovered end is handled as a range of its own
+            const int prefix_result = aeron_retransmit_handler_on_range(
+                handler,
+                term_id,
+                start,
+                end,
+                false,
+                term_length,
+                mtu_length,
+                flow_control,
+                receiver_bit,
+                now_ns,
+                resend,
+                resend_clientd);
+            const int suffix_result = aeron_retransmit_handler_on_range(
+                handler,
+                term_id,
+                suffix_start,
+                suffix_end,
+                is_length_capped && capped_end == suffix_end,
+                term_length,
+                mtu_length,
+                flow_control,
+                receiver_bit,
+                now_ns,
+                resend,
+                resend_clientd);
+
+            return prefix_result < 0 ? prefix_result : suffix_result;
         }
 
-        if (action != NULL)
+        is_length_capped = is_length_capped && capped_end == end;
+
+        if (start >= end)
         {
-            action->term_id = term_id;
-            action->term_offset = term_offset;
-            action->length = retransmit_length;
+            aeron_counter_increment(is_repeat ? handler->naks_suppressed_counter : handler->naks_coalesced_counter, 1);
+            return 0;
+        }
 
-            if (0 == handler->delay_timeout_ns)
-            {
-                result = resend(resend_clientd, term_id, term_offset, action->length);
-                action->state = AERON_RETRANSMIT_ACTION_STATE_LINGERING;
-                action->expiry_ns = now_ns + (int64_t)handler->linger_timeout_ns;
-            }
-            else
-            {
-                action->state = AERON_RETRANSMIT_ACTION_STATE_DELAYED;
-                action->expiry_ns = now_ns + (int64_t)handler->delay_timeout_ns;
-            }
+        if (aeron_retransmit_handler_merge_delayed(
+            handler, term_id, start, end, term_length, mtu_length, flow_control, receiver_bit, is_length_capped))
+        {
+            aeron_counter_increment(handler->naks_coalesced_counter, 1);
+            return 0;
         }
     }
 
+    aeron_retransmit_action_t *action = aeron_retransmit_handler_add_retransmit(handler);
+    if (NULL == action)
+    {
+        AERON_APPEND_ERR(
+            "dropping nak termId=%d termOffset=%d retransmit_length=%d", term_id, start, (int)(end - start));
+        return -1;
+    }
+
+    action->term_id = term_id;
+    action->term_offset = start;
+    action->length = (size_t)(end - start);
+    action->receiver_mask = receiver_bit;
+    action->is_length_capped = is_length_capped;
+
+    if (0 == handler->delay_timeout_ns)
+    {
+        result = resend(resend_clientd, term_id, start, action->length);
+        action->state = AERON_RETRANSMIT_ACTION_STATE_LINGERING;
+        action->expiry_ns = now_ns + (int64_t)handler->linger_timeout_ns;
+    }
+    else
+    {
+        action->state = AERON_RETRANSMIT_ACTION_STATE_DELAYED;
+        action->expiry_ns = now_ns + (int64_t)handler->delay_timeout_ns;
+    }
+
+    return result;
+}
+
+int aeron_retransmit_handler_on_nak(
+    aeron_retransmit_handler_t *handler,
+    int32_t term_id,
+    int32_t term_offset,
+    size_t length,
+    size_t term_length,
+    size_t mtu_length,
+    aeron_flow_control_strategy_t *flow_control,
+    int64_t receiver_key,
+    int64_t now_ns,
+    aeron_retransmit_handler_resend_func_t resend,
+    void *resend_clientd)
+{
+    int result = 0;
+
+    if (!aeron_retransmit_handler_is_invalid(handler, term_offset, term_length))
+    {
+        const size_t retransmit_length = flow_control->max_retransmission_length(
+            flow_control->state, term_offset, length, term_length, mtu_length);
+
+        result = aeron_retransmit_handler_on_range(
+            handler,
+            term_id,
+            term_offset,
+            term_offset + (int32_t)retransmit_length,
+            retransmit_length < length,
+            term_length,
+            mtu_length,
+            flow_control,
+            UINT64_C(1) << aeron_hash((uint64_t)receiver_key, 63),
+            now_ns,
+            resend,
+            resend_clientd);
+    }
+
     return result;
 }
 
@@ -132,9 +395,9 @@ int aeron_retransmit_handler_process_timeouts(
 
     if (handler->active_retransmit_count > 0)
     {
-        for (size_t i = 0; i < AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS; i++)
+        for (size_t i = 0; i < handler->retransmit_actions_capacity; i++)
         {
-            aeron_retransmit_action_t *action = &handler->retransmit_action_pool[i];
+            aeron_retransmit_action_t *action = &handler->retransmit_actions[i];
 
             if (AERON_RETRANSMIT_ACTION_STATE_DELAYED == action->state)
             {
@@ -159,54 +422,3 @@ int aeron_retransmit_handler_process_timeouts(
 
     return result;
 }
-
-int aeron_retransmit_handler_scan_for_available_retransmit(
-    aeron_retransmit_handler_t *handler,
-    int32_t term_id,
-    int32_t term_offset,
-    size_t length,
-    aeron_retransmit_action_t **actionp)
-{
-   if (0 == handler->active_retransmit_count)
-   {
-       *actionp = aeron_retransmit_handler_add_retransmit(handler, &handler->retransmit_action_pool[0]);
-       return 0;
-   }
-
-    aeron_retransmit_action_t *available_action = NULL;
-    for (size_t i = 0; i < AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS; i++)
-    {
-        aeron_retransmit_action_t *action = &handler->retransmit_action_pool[i];
-
-        switch (action->state)
-        {
-            case AERON_RETRANSMIT_ACTION_STATE_INACTIVE:
-                if (NULL == available_action)
-                {
-                    available_action = action;
-                }
-                break;
-
-            case AERON_RETRANSMIT_ACTION_STATE_DELAYED:
-            case AERON_RETRANSMIT_ACTION_STATE_LINGERING:
-                if (action->term_id == term_id &&
-                    action->term_offset <= term_offset &&
-                    term_offset < action->term_offset + (int32_t)action->length)
-                {
-                    *actionp = NULL;
-                    return 0;
-                }
-                break;
-        }
-    }
-
-    if (NULL != available_action)
-    {
-        *actionp = aeron_retransmit_handler_add_retransmit(handler, available_action);
-        return 0;
-    }
-
-    AERON_SET_ERR(EINVAL, "%s", "maximum number of active RetransmitActions reached");
-    *actionp = NULL;
-    return -1;
-}
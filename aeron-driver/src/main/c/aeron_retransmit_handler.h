@@ -35,22 +35,36 @@ typedef struct aeron_retransmit_action_stct
     int32_t term_id;
     int32_t term_offset;
     size_t length;
+    uint64_t receiver_mask;
+    bool is_length_capped;
     aeron_retransmit_action_state_t state;
 }
 aeron_retransmit_action_t;
 
-#define AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS (16)
+#define AERON_RETRANSMIT_HANDLER_INITIAL_RETRANSMITS (16)
+#define AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS (1024)
 
 typedef int (*aeron_retransmit_handler_resend_func_t)(
     void *clientd, int32_t term_id, int32_t term_offset, size_t length);
 
+/*
+ * NAKs for ranges already being retransmitted are absorbed rather than resent. Each action remembers which receivers,
+ * hashed to a bit, asked for it so a receiver repeating its own NAK is counted as suppressed while a NAK from another
+ * receiver sharing the loss is counted as coalesced. NAKs which only partially overlap are trimmed to what is still
+ * outstanding and, while a retransmit is delayed, adjacent ranges are merged into it. A range whose length was capped by
+ * flow control may end mid-frame so NAKs are never trimmed to start at its end. The action table grows on demand up
+ * to AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS.
+ */
 typedef struct aeron_retransmit_handler_stct
 {
-    aeron_retransmit_action_t retransmit_action_pool[AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS];
+    aeron_retransmit_action_t *retransmit_actions;
+    size_t retransmit_actions_capacity;
     uint64_t delay_timeout_ns;
     uint64_t linger_timeout_ns;
 
     int64_t *invalid_packets_counter;
+    int64_t *naks_coalesced_counter;
+    int64_t *naks_suppressed_counter;
 
     int active_retransmit_count;
 }
@@ -59,6 +73,8 @@ aeron_retransmit_handler_t;
 int aeron_retransmit_handler_init(
     aeron_retransmit_handler_t *handler,
     int64_t *invalid_packets_counter,
+    int64_t *naks_coalesced_counter,
+    int64_t *naks_suppressed_counter,
     uint64_t delay_timeout_ns,
     uint64_t linger_timeout_ns);
 
@@ -72,6 +88,7 @@ int aeron_retransmit_handler_on_nak(
     size_t term_length,
     size_t mtu_length,
     aeron_flow_control_strategy_t *flow_control,
+    int64_t receiver_key,
     int64_t now_ns,
     aeron_retransmit_handler_resend_func_t resend,
     void *resend_clientd);
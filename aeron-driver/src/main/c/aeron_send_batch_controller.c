@@ -0,0 +1,93 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "aeron_send_batch_controller.h"
+#include "concurrent/aeron_counters_manager.h"
+
+static void aeron_send_batch_controller_set(aeron_send_batch_controller_t *controller, size_t messages_per_send)
+{
+    if (messages_per_send != controller->current_messages_per_send)
+    {
+        controller->current_messages_per_send = messages_per_send;
+
+        if (NULL != controller->messages_per_send_counter)
+        {
+            aeron_counter_set_ordered(controller->messages_per_send_counter, (int64_t)messages_per_send);
+        }
+    }
+}
+
+void aeron_send_batch_controller_init(
+    aeron_send_batch_controller_t *controller,
+    size_t max_messages_per_send,
+    bool is_adaptive,
+    volatile int64_t *messages_per_send_counter)
+{
+    controller->max_messages_per_send = max_messages_per_send;
+    controller->current_messages_per_send = is_adaptive ? 1 : max_messages_per_send;
+    controller->socket_queue_percent = 0;
+    controller->socket_queue_sample_deadline_ns = 0;
+    controller->messages_per_send_counter = messages_per_send_counter;
+    controller->is_adaptive = is_adaptive;
+
+    if (NULL != messages_per_send_counter)
+    {
+        aeron_counter_set_ordered(messages_per_send_counter, (int64_t)controller->current_messages_per_send);
+    }
+}
+
+void aeron_send_batch_controller_on_send(
+    aeron_send_batch_controller_t *controller, size_t batch_length, size_t messages_sent, bool has_window_headroom)
+{
+    const size_t current = controller->current_messages_per_send;
+
+    if (!controller->is_adaptive)
+    {
+        aeron_send_batch_controller_set(
+            controller, messages_sent < batch_length ? 1 : controller->max_messages_per_send);
+    }
+    else if (messages_sent < batch_length ||
+        controller->socket_queue_percent >= AERON_SEND_BATCH_CONTROLLER_QUEUE_BACKOFF_PERCENT)
+    {
+        aeron_send_batch_controller_set(controller, current > 1 ? current / 2 : 1);
+    }
+    else if (batch_length < current)
+    {
+        aeron_send_batch_controller_set(controller, current - 1);
+    }
+    else if (has_window_headroom && controller->socket_queue_percent < AERON_SEND_BATCH_CONTROLLER_QUEUE_HOLD_PERCENT)
+    {
+        const size_t doubled = current * 2;
+        aeron_send_batch_controller_set(
+            controller, doubled < controller->max_messages_per_send ? doubled : controller->max_messages_per_send);
+    }
+}
+
+void aeron_send_batch_controller_on_socket_queue(
+    aeron_send_batch_controller_t *controller, int64_t now_ns, size_t queued_length, size_t capacity)
+{
+    controller->socket_queue_percent = capacity > 0 ? (queued_length * 100) / capacity : 0;
+    controller->socket_queue_sample_deadline_ns = now_ns + AERON_SEND_BATCH_CONTROLLER_QUEUE_SAMPLE_INTERVAL_NS;
+}
+
+void aeron_send_batch_controller_disable_socket_queue_sampling(aeron_send_batch_controller_t *controller)
+{
+    controller->socket_queue_percent = 0;
+    controller->socket_queue_sample_deadline_ns = INT64_MAX;
+}
+
+extern bool aeron_send_batch_controller_is_socket_queue_sample_due(
+    aeron_send_batch_controller_t *controller, int64_t now_ns);
@@ -0,0 +1,79 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_SEND_BATCH_CONTROLLER_H
+#define AERON_SEND_BATCH_CONTROLLER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define AERON_SEND_BATCH_CONTROLLER_QUEUE_SAMPLE_INTERVAL_NS (1000 * 1000LL)
+#define AERON_SEND_BATCH_CONTROLLER_QUEUE_HOLD_PERCENT (50)
+#define AERON_SEND_BATCH_CONTROLLER_QUEUE_BACKOFF_PERCENT (75)
+
+/*
+ * Chooses how many messages a network publication gathers into each send. A fixed controller sends up to the max
+ * and drops to a single message after a short send. An adaptive controller starts at a single message and doubles
+ * while batches fill with data still waiting, snd-lmt headroom to send it, and the socket send queue below the hold
+ * level. It halves on a short send or when the socket send queue is backing up, and shrinks by one whenever a batch
+ * is not filled so publications that only ever have a message or two ready stay at small batches.
+ */
+typedef struct aeron_send_batch_controller_stct
+{
+    size_t max_messages_per_send;
+    size_t current_messages_per_send;
+    size_t socket_queue_percent;
+    int64_t socket_queue_sample_deadline_ns;
+    volatile int64_t *messages_per_send_counter;
+    bool is_adaptive;
+}
+aeron_send_batch_controller_t;
+
+/*
+ * Initialise the controller. The counter, which may be NULL, is kept up to date with the current batch size.
+ */
+void aeron_send_batch_controller_init(
+    aeron_send_batch_controller_t *controller,
+    size_t max_messages_per_send,
+    bool is_adaptive,
+    volatile int64_t *messages_per_send_counter);
+
+/*
+ * Update from the outcome of a send of batch_length messages of which messages_sent were taken by the socket.
+ * has_window_headroom is true if snd-lmt would have allowed at least another MTU to be sent.
+ */
+void aeron_send_batch_controller_on_send(
+    aeron_send_batch_controller_t *controller, size_t batch_length, size_t messages_sent, bool has_window_headroom);
+
+/*
+ * Update from a sample of the bytes queued in the socket send buffer and the capacity of that buffer.
+ */
+void aeron_send_batch_controller_on_socket_queue(
+    aeron_send_batch_controller_t *controller, int64_t now_ns, size_t queued_length, size_t capacity);
+
+/*
+ * Stop sampling the socket send queue, used when the transport cannot report it.
+ */
+void aeron_send_batch_controller_disable_socket_queue_sampling(aeron_send_batch_controller_t *controller);
+
+inline bool aeron_send_batch_controller_is_socket_queue_sample_due(
+    aeron_send_batch_controller_t *controller, int64_t now_ns)
+{
+    return controller->is_adaptive && now_ns >= controller->socket_queue_sample_deadline_ns;
+}
+
+#endif //AERON_SEND_BATCH_CONTROLLER_H
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "aeron_send_pacer.h"
+
+static int64_t aeron_send_pacer_duration_ns(aeron_send_pacer_t *pacer, int64_t length)
+{
+    // round up so the rate can only ever be undershot
+    return ((length * AERON_SEND_PACER_NS_PER_SECOND) + pacer->rate_bytes_per_sec - 1) / pacer->rate_bytes_per_sec;
+}
+
+void aeron_send_pacer_init(
+    aeron_send_pacer_t *pacer, uint64_t rate_bytes_per_sec, size_t burst_length, int64_t now_ns)
+{
+    pacer->rate_bytes_per_sec = (int64_t)rate_bytes_per_sec;
+    pacer->burst_length = (int64_t)burst_length;
+    pacer->burst_ns = 0;
+    pacer->empty_time_ns = now_ns;
+
+    if (aeron_send_pacer_is_enabled(pacer))
+    {
+        pacer->burst_ns = aeron_send_pacer_duration_ns(pacer, pacer->burst_length);
+        pacer->empty_time_ns = now_ns - pacer->burst_ns;
+    }
+}
+
+void aeron_send_pacer_on_sent(aeron_send_pacer_t *pacer, int64_t now_ns, int64_t bytes_sent)
+{
+    if (aeron_send_pacer_is_enabled(pacer) && bytes_sent > 0)
+    {
+        const int64_t full_time_ns = now_ns - pacer->burst_ns;
+        const int64_t empty_time_ns = pacer->empty_time_ns > full_time_ns ? pacer->empty_time_ns : full_time_ns;
+
+        pacer->empty_time_ns = empty_time_ns + aeron_send_pacer_duration_ns(pacer, bytes_sent);
+    }
+}
+
+extern bool aeron_send_pacer_is_enabled(aeron_send_pacer_t *pacer);
+extern int64_t aeron_send_pacer_available(aeron_send_pacer_t *pacer, int64_t now_ns);
@@ -0,0 +1,76 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef AERON_SEND_PACER_H
+#define AERON_SEND_PACER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define AERON_SEND_PACER_NS_PER_SECOND (1000 * 1000 * 1000LL)
+
+/*
+ * Token bucket which caps the rate a publication puts bytes on the wire while allowing bursts of up to burst_length.
+ * The bucket is held as the time at which it was last empty, so tokens accrue with nanosecond precision and there is
+ * no refill to schedule. A rate of 0 disables pacing.
+ */
+typedef struct aeron_send_pacer_stct
+{
+    int64_t rate_bytes_per_sec;
+    int64_t burst_length;
+    int64_t burst_ns;
+    int64_t empty_time_ns;
+}
+aeron_send_pacer_t;
+
+void aeron_send_pacer_init(
+    aeron_send_pacer_t *pacer, uint64_t rate_bytes_per_sec, size_t burst_length, int64_t now_ns);
+
+inline bool aeron_send_pacer_is_enabled(aeron_send_pacer_t *pacer)
+{
+    return pacer->rate_bytes_per_sec > 0;
+}
+
+/*
+ * Bytes which may be sent at now_ns without exceeding the rate, never more than the burst length.
+ */
+inline int64_t aeron_send_pacer_available(aeron_send_pacer_t *pacer, int64_t now_ns)
+{
+    if (!aeron_send_pacer_is_enabled(pacer))
+    {
+        return INT64_MAX;
+    }
+
+    int64_t elapsed_ns = now_ns - pacer->empty_time_ns;
+    if (elapsed_ns <= 0)
+    {
+        return 0;
+    }
+
+    elapsed_ns = elapsed_ns < pacer->burst_ns ? elapsed_ns : pacer->burst_ns;
+
+    return (elapsed_ns * pacer->rate_bytes_per_sec) / AERON_SEND_PACER_NS_PER_SECOND;
+}
+
+/*
+ * Take bytes sent at now_ns from the bucket. Sends outside of the paced path, such as retransmits, may take the
+ * bucket into debt which delays the following data.
+ */
+void aeron_send_pacer_on_sent(aeron_send_pacer_t *pacer, int64_t now_ns, int64_t bytes_sent);
+
+#endif //AERON_SEND_PACER_H
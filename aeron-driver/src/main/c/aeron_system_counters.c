@@ -59,6 +59,9 @@ static aeron_system_counter_t system_counters[] =
         { "NameResolver exceeded threshold count", AERON_SYSTEM_COUNTER_NAME_RESOLVER_TIME_THRESHOLD_EXCEEDED },
         { "Aeron software: version=" AERON_VERSION_TXT " commit=" AERON_VERSION_GITSHA, AERON_SYSTEM_COUNTER_AERON_VERSION },
         { "Bytes currently mapped", AERON_SYSTEM_COUNTER_BYTES_CURRENTLY_MAPPED },
+        { "NAKs coalesced", AERON_SYSTEM_COUNTER_NAKS_COALESCED },
+        { "NAKs suppressed", AERON_SYSTEM_COUNTER_NAKS_SUPPRESSED },
+        { "FEC recovered datagrams", AERON_SYSTEM_COUNTER_FEC_RECOVERED_DATAGRAMS },
     };
 
 static size_t num_system_counters = sizeof(system_counters) / sizeof(aeron_system_counter_t);
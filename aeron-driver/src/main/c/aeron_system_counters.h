@@ -57,6 +57,9 @@ typedef enum aeron_system_counter_enum_stct
     AERON_SYSTEM_COUNTER_NAME_RESOLVER_TIME_THRESHOLD_EXCEEDED = 33,
     AERON_SYSTEM_COUNTER_AERON_VERSION = 34,
     AERON_SYSTEM_COUNTER_BYTES_CURRENTLY_MAPPED = 35,
+    AERON_SYSTEM_COUNTER_NAKS_COALESCED = 36,
+    AERON_SYSTEM_COUNTER_NAKS_SUPPRESSED = 37,
+    AERON_SYSTEM_COUNTER_FEC_RECOVERED_DATAGRAMS = 38,
 
     // Add all new counters before this one (used for a static assertion).
     AERON_SYSTEM_COUNTER_DUMMY_LAST,
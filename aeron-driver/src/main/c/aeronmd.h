@@ -178,6 +178,52 @@ bool aeron_driver_context_get_spies_simulate_connection(aeron_driver_context_t *
 int aeron_driver_context_set_file_page_size(aeron_driver_context_t *context, size_t value);
 size_t aeron_driver_context_get_file_page_size(aeron_driver_context_t *context);
 
+/**
+ * Directory on a hugetlbfs mount under which the driver places the log buffers of publications and images that use
+ * huge pages. The driver owns a sub-directory named after the aeron directory, which is recreated on start, and
+ * clients map the log buffers from there as they would from the aeron directory. Huge pages are not available when
+ * this is not set.
+ */
+#define AERON_HUGE_PAGES_DIR_ENV_VAR "AERON_HUGE_PAGES_DIR"
+
+int aeron_driver_context_set_huge_pages_dir(aeron_driver_context_t *context, const char *value);
+const char *aeron_driver_context_get_huge_pages_dir(aeron_driver_context_t *context);
+
+/**
+ * Page size of the hugetlbfs mount. Log buffers that use huge pages are aligned to this rather than the file page
+ * size.
+ */
+#define AERON_HUGE_PAGE_SIZE_ENV_VAR "AERON_HUGE_PAGE_SIZE"
+
+int aeron_driver_context_set_huge_page_size(aeron_driver_context_t *context, size_t value);
+size_t aeron_driver_context_get_huge_page_size(aeron_driver_context_t *context);
+
+/**
+ * Should term buffers use huge pages by default. Can be set per channel with the huge-pages URI param.
+ */
+#define AERON_TERM_BUFFER_HUGE_PAGES_ENV_VAR "AERON_TERM_BUFFER_HUGE_PAGES"
+
+int aeron_driver_context_set_term_buffer_huge_pages(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_term_buffer_huge_pages(aeron_driver_context_t *context);
+
+/**
+ * Should dirty term regions be zeroed with non-temporal stores, where supported, so cleaning does not evict the
+ * active terms from cache.
+ */
+#define AERON_TERM_BUFFER_CLEAN_NON_TEMPORAL_ENV_VAR "AERON_TERM_BUFFER_CLEAN_NON_TEMPORAL"
+
+int aeron_driver_context_set_term_buffer_clean_non_temporal(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_term_buffer_clean_non_temporal(aeron_driver_context_t *context);
+
+/**
+ * Should publication term buffers be cleaned on a dedicated low priority thread rather than by the conductor. The
+ * publication limit is held back so it never runs ahead of what the cleaner thread has zeroed.
+ */
+#define AERON_TERM_BUFFER_CLEANER_THREAD_ENV_VAR "AERON_TERM_BUFFER_CLEANER_THREAD"
+
+int aeron_driver_context_set_term_buffer_cleaner_thread(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_term_buffer_cleaner_thread(aeron_driver_context_t *context);
+
 /**
  * Length (in bytes) of the maximum transmission unit of the publication.
  */
@@ -242,6 +288,33 @@ size_t aeron_driver_context_get_socket_so_sndbuf(aeron_driver_context_t *context
 int aeron_driver_context_set_socket_multicast_ttl(aeron_driver_context_t *context, uint8_t value);
 uint8_t aeron_driver_context_get_socket_multicast_ttl(aeron_driver_context_t *context);
 
+/**
+ * Should the sender coalesce runs of equal length datagrams into a single UDP generic segmentation offload (GSO)
+ * send using UDP_SEGMENT. Only supported on Linux, other platforms ignore the setting.
+ */
+#define AERON_SOCKET_GSO_ENABLED_ENV_VAR "AERON_SOCKET_GSO_ENABLED"
+
+int aeron_driver_context_set_socket_gso_enabled(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_socket_gso_enabled(aeron_driver_context_t *context);
+
+/**
+ * Should the receiver enable UDP generic receive offload (GRO) using UDP_GRO and split coalesced datagrams back into
+ * individual frames on receipt. Only supported on Linux, other platforms ignore the setting.
+ */
+#define AERON_SOCKET_GRO_ENABLED_ENV_VAR "AERON_SOCKET_GRO_ENABLED"
+
+int aeron_driver_context_set_socket_gro_enabled(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_socket_gro_enabled(aeron_driver_context_t *context);
+
+/**
+ * Should the receiver receive data for established unicast images directly into the image term buffer at the next
+ * expected position, falling back to the receive buffer when a datagram does not match, to avoid copying the payload.
+ */
+#define AERON_RECEIVER_ZERO_COPY_ENABLED_ENV_VAR "AERON_RECEIVER_ZERO_COPY_ENABLED"
+
+int aeron_driver_context_set_receiver_zero_copy_enabled(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_receiver_zero_copy_enabled(aeron_driver_context_t *context);
+
 /**
  * Ratio of sending data to polling status messages in the Sender.
  */
@@ -349,6 +422,11 @@ typedef struct aeron_congestion_control_strategy_stct aeron_congestion_control_s
  */
 #define AERON_CUBICCONGESTIONCONTROL_TCPMODE_ENV_VAR "AERON_CUBICCONGESTIONCONTROL_TCPMODE"
 
+/**
+ * RTT in nanoseconds assumed by BBR congestion control until the first RTT measurement arrives.
+ */
+#define AERON_BBRCONGESTIONCONTROL_INITIALRTT_ENV_VAR "AERON_BBRCONGESTIONCONTROL_INITIALRTT"
+
 typedef struct aeron_counters_manager_stct aeron_counters_manager_t;
 struct sockaddr_storage;
 
@@ -378,6 +456,35 @@ aeron_congestion_control_strategy_supplier_func_t aeron_driver_context_get_conge
 int aeron_driver_context_set_loss_report_buffer_length(aeron_driver_context_t *context, size_t value);
 size_t aeron_driver_context_get_loss_report_buffer_length(aeron_driver_context_t *context);
 
+/**
+ * Should latency histograms be recorded for network publications and images in the latency report. When enabled
+ * the following hops are recorded, where timestamps are available:
+ * - snd-wire: from the sender passing a datagram to the kernel until its kernel transmit timestamp.
+ * - wire-term: from the kernel receive timestamp until the datagram is written to the image term buffer. Requires
+ *   media receive timestamps to be enabled on the channel, e.g. media-rcv-ts-offset=reserved.
+ * - term-sub: from the data being written to the image term buffer until all subscribers have consumed it.
+ */
+#define AERON_LATENCY_REPORT_ENABLED_ENV_VAR "AERON_LATENCY_REPORT_ENABLED"
+
+int aeron_driver_context_set_latency_report_enabled(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_latency_report_enabled(aeron_driver_context_t *context);
+
+/**
+ * Length (in bytes) of the buffer for the latency report.
+ */
+#define AERON_LATENCY_REPORT_BUFFER_LENGTH_ENV_VAR "AERON_LATENCY_REPORT_BUFFER_LENGTH"
+
+int aeron_driver_context_set_latency_report_buffer_length(aeron_driver_context_t *context, size_t value);
+size_t aeron_driver_context_get_latency_report_buffer_length(aeron_driver_context_t *context);
+
+/**
+ * Minimum interval in nanoseconds between samples of the snd-wire and term-sub hops for each publication or image.
+ */
+#define AERON_LATENCY_REPORT_SAMPLE_INTERVAL_ENV_VAR "AERON_LATENCY_REPORT_SAMPLE_INTERVAL"
+
+int aeron_driver_context_set_latency_report_sample_interval_ns(aeron_driver_context_t *context, uint64_t value);
+uint64_t aeron_driver_context_get_latency_report_sample_interval_ns(aeron_driver_context_t *context);
+
 /**
  * Timeout for publication unblock in nanoseconds.
  */
@@ -883,6 +990,15 @@ uint32_t aeron_driver_context_get_sender_io_vector_capacity(aeron_driver_context
 int aeron_driver_context_set_network_publication_max_messages_per_send(aeron_driver_context_t *context, uint32_t value);
 uint32_t aeron_driver_context_get_network_publication_max_messages_per_send(aeron_driver_context_t *context);
 
+/**
+ * Should network publications adapt the number of messages per send, up to the max messages per send, from short
+ * sends, socket send queue occupancy, and snd-lmt headroom. The current value is exposed in a snd-batch counter.
+ */
+#define AERON_NETWORK_PUBLICATION_ADAPTIVE_MESSAGES_PER_SEND_ENV_VAR "AERON_NETWORK_PUBLICATION_ADAPTIVE_MESSAGES_PER_SEND"
+int aeron_driver_context_set_network_publication_adaptive_messages_per_send(
+    aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_network_publication_adaptive_messages_per_send(aeron_driver_context_t *context);
+
 #define AERON_DRIVER_RESOURCE_FREE_LIMIT_ENV_VAR "AERON_DRIVER_RESOURCE_FREE_LIMIT"
 int aeron_driver_context_set_resource_free_limit(aeron_driver_context_t *context, uint32_t value);
 uint32_t aeron_driver_context_get_resource_free_limit(aeron_driver_context_t *context);
@@ -891,10 +1007,52 @@ uint32_t aeron_driver_context_get_resource_free_limit(aeron_driver_context_t *co
 int aeron_driver_context_set_async_executor_threads(aeron_driver_context_t *context, uint32_t value);
 uint32_t aeron_driver_context_get_async_executor_threads(aeron_driver_context_t *context);
 
+/**
+ * Number of log buffers per term length, for each of the default term length and the default IPC term length, which
+ * are created and pre-touched in advance by the conductor's executor. Publications and images which are not sparse
+ * take a pooled log buffer when one of their term length is available, rather than creating one on the conductor
+ * thread. A value of 0 disables the pool.
+ */
+#define AERON_LOG_BUFFER_POOL_SIZE_ENV_VAR "AERON_LOG_BUFFER_POOL_SIZE"
+int aeron_driver_context_set_log_buffer_pool_size(aeron_driver_context_t *context, uint32_t value);
+uint32_t aeron_driver_context_get_log_buffer_pool_size(aeron_driver_context_t *context);
+
 #define AERON_CONDUCTOR_CPU_AFFINITY_ENV_VAR "AERON_CONDUCTOR_CPU_AFFINITY"
 #define AERON_RECEIVER_CPU_AFFINITY_ENV_VAR "AERON_RECEIVER_CPU_AFFINITY"
 #define AERON_SENDER_CPU_AFFINITY_ENV_VAR "AERON_SENDER_CPU_AFFINITY"
 
+/**
+ * Number of receiver agents that receive channel endpoints are spread across when running in the DEDICATED threading
+ * mode, each with its own thread, poller and command queue. Each endpoint is assigned by the conductor to the receiver
+ * with the fewest endpoints when it is created. In the SHARED and SHARED_NETWORK modes the receivers are run in turn
+ * on the shared agent.
+ */
+#define AERON_RECEIVER_COUNT_ENV_VAR "AERON_RECEIVER_COUNT"
+int aeron_driver_context_set_receiver_count(aeron_driver_context_t *context, uint32_t value);
+uint32_t aeron_driver_context_get_receiver_count(aeron_driver_context_t *context);
+
+/**
+ * Comma separated list of CPUs to pin each receiver agent thread to, in receiver order, e.g. "2,3,4". An entry of -1
+ * leaves that receiver unpinned. The first receiver uses AERON_RECEIVER_CPU_AFFINITY when the list is not set.
+ */
+#define AERON_RECEIVER_CPU_AFFINITY_LIST_ENV_VAR "AERON_RECEIVER_CPU_AFFINITY_LIST"
+
+/**
+ * Number of sender agents that send channel endpoints, and the network publications on them, are spread across when
+ * running in the DEDICATED threading mode. An endpoint is assigned to the sender given by the sender-id URI param of
+ * the publication that creates it, otherwise to a sender chosen by a hash of the canonical channel. In the SHARED and
+ * SHARED_NETWORK modes the senders are run in turn on the shared agent.
+ */
+#define AERON_SENDER_COUNT_ENV_VAR "AERON_SENDER_COUNT"
+int aeron_driver_context_set_sender_count(aeron_driver_context_t *context, uint32_t value);
+uint32_t aeron_driver_context_get_sender_count(aeron_driver_context_t *context);
+
+/**
+ * Comma separated list of CPUs to pin each sender agent thread to, in sender order, e.g. "5,6". An entry of -1
+ * leaves that sender unpinned. The first sender uses AERON_SENDER_CPU_AFFINITY when the list is not set.
+ */
+#define AERON_SENDER_CPU_AFFINITY_LIST_ENV_VAR "AERON_SENDER_CPU_AFFINITY_LIST"
+
 /**
  * Set the list of filenames to dynamic libraries to load upon context init.
  */
@@ -1165,12 +1165,14 @@ aeron_udp_channel_interceptor_bindings_t *aeron_driver_agent_new_interceptor(voi
 
     interceptor->incoming_init_func = aeron_driver_agent_interceptor_init;
     interceptor->incoming_close_func = NULL;
+    interceptor->incoming_poll_func = NULL;
     interceptor->incoming_func = NULL;
     interceptor->incoming_transport_notification_func = NULL;
     interceptor->incoming_publication_notification_func = NULL;
     interceptor->incoming_image_notification_func = NULL;
     interceptor->outgoing_init_func = aeron_driver_agent_interceptor_init;
     interceptor->outgoing_close_func = NULL;
+    interceptor->outgoing_poll_func = NULL;
     interceptor->outgoing_send_func = NULL;
     interceptor->outgoing_transport_notification_func = NULL;
     interceptor->outgoing_publication_notification_func = NULL;
@@ -1747,6 +1749,9 @@ static const char *dissect_frame_type(int16_t type)
         case AERON_HDR_TYPE_RSP_SETUP:
             return "RSP_SETUP";
 
+        case AERON_HDR_TYPE_FEC:
+            return "FEC";
+
         default:
             return "unknown command";
     }
@@ -1866,6 +1871,27 @@ static const char *dissect_frame(const void *message, size_t length)
             break;
         }
 
+        case AERON_HDR_TYPE_FEC:
+        {
+            aeron_fec_header_t *fec = (aeron_fec_header_t *)message;
+
+            snprintf(
+                buffer,
+                sizeof(buffer) - 1,
+                "type=%s flags=%.*s frameLength=%d sessionId=%d streamId=%d termId=%d termOffset=%d datagramCount=%d parityLength=%d",
+                dissect_frame_type(hdr->type),
+                (int)sizeof(dissected_flags),
+                dissect_flags(hdr->flags, dissected_flags),
+                hdr->frame_length,
+                fec->session_id,
+                fec->stream_id,
+                fec->term_id,
+                fec->term_offset,
+                (int)fec->datagram_count,
+                fec->parity_length);
+            break;
+        }
+
         case AERON_HDR_TYPE_RTTM:
         {
             aeron_rttm_header_t *rttm = (aeron_rttm_header_t *)message;
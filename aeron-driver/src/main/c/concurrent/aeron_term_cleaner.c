@@ -0,0 +1,300 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <errno.h>
+#include <string.h>
+
+#include "concurrent/aeron_term_cleaner.h"
+#include "aeron_alloc.h"
+#include "util/aeron_arrayutil.h"
+#include "util/aeron_bitutil.h"
+#include "util/aeron_error.h"
+
+#if defined(AERON_CPU_X64)
+#include <emmintrin.h>
+#endif
+
+#define AERON_TERM_CLEANER_NON_TEMPORAL_MIN_LENGTH (256)
+#define AERON_TERM_CLEANER_THREAD_NICE (19)
+
+void aeron_term_cleaner_zero(uint8_t *addr, size_t length, bool non_temporal)
+{
+#if defined(AERON_CPU_X64)
+    if (non_temporal && length >= AERON_TERM_CLEANER_NON_TEMPORAL_MIN_LENGTH)
+    {
+        uint8_t *end = addr + length;
+        uint8_t *aligned_start = (uint8_t *)AERON_ALIGN((uintptr_t)addr, (uintptr_t)64);
+        uint8_t *aligned_end = (uint8_t *)((uintptr_t)end & ~(uintptr_t)63);
+        const __m128i zero = _mm_setzero_si128();
+
+        memset(addr, 0, (size_t)(aligned_start - addr));
+
+        for (uint8_t *p = aligned_start; p < aligned_end; p += 64)
+        {
+            _mm_stream_si128((__m128i *)p, zero);
+            _mm_stream_si128((__m128i *)(p + 16), zero);
+            _mm_stream_si128((__m128i *)(p + 32), zero);
+            _mm_stream_si128((__m128i *)(p + 48), zero);
+        }
+
+        memset(aligned_end, 0, (size_t)(end - aligned_end));
+
+        // streaming stores are weakly ordered so must be fenced before the clean is published
+        _mm_sfence();
+        return;
+    }
+#endif
+
+    memset(addr, 0, length);
+}
+
+void aeron_term_cleaner_log_init(
+    aeron_term_cleaner_log_t *log,
+    aeron_mapped_raw_log_t *mapped_raw_log,
+    size_t position_bits_to_shift,
+    int64_t initial_position,
+    bool non_temporal)
+{
+    log->mapped_raw_log = mapped_raw_log;
+    log->position_bits_to_shift = position_bits_to_shift;
+    log->non_temporal = non_temporal;
+    log->cleaner = NULL;
+    log->clean_target = initial_position;
+    log->clean_position = initial_position;
+}
+
+size_t aeron_term_cleaner_log_clean(aeron_term_cleaner_log_t *log, int64_t position, size_t max_length)
+{
+    const int64_t clean_position = log->clean_position;
+    if (position <= clean_position)
+    {
+        return 0;
+    }
+
+    size_t dirty_index = aeron_logbuffer_index_by_position(clean_position, log->position_bits_to_shift);
+    size_t bytes_to_clean = (size_t)(position - clean_position);
+    size_t term_length = log->mapped_raw_log->term_length;
+    size_t term_offset = (size_t)(clean_position & (int64_t)(term_length - 1));
+    size_t bytes_left_in_term = term_length - term_offset;
+    size_t length = bytes_to_clean < bytes_left_in_term ? bytes_to_clean : bytes_left_in_term;
+    length = length < max_length ? length : max_length;
+
+    uint8_t *addr = log->mapped_raw_log->term_buffers[dirty_index].addr + term_offset;
+    aeron_term_cleaner_zero(addr + sizeof(int64_t), length - sizeof(int64_t), log->non_temporal);
+
+    uint64_t *ptr = (uint64_t *)addr;
+    AERON_PUT_ORDERED(*ptr, (uint64_t)0);
+
+    AERON_PUT_ORDERED(log->clean_position, clean_position + (int64_t)length);
+
+    return length;
+}
+
+void aeron_term_cleaner_log_clean_to(aeron_term_cleaner_log_t *log, int64_t position)
+{
+    if (NULL == log->cleaner)
+    {
+        aeron_term_cleaner_log_clean(log, position, log->mapped_raw_log->term_length);
+    }
+    else if (position > log->clean_target)
+    {
+        AERON_PUT_ORDERED(log->clean_target, position);
+    }
+}
+
+static void *aeron_term_cleaner_run(void *arg)
+{
+    aeron_term_cleaner_t *cleaner = (aeron_term_cleaner_t *)arg;
+
+    aeron_thread_set_name("term-cleaner");
+
+#if defined(__linux__)
+    // nice applies per thread on Linux, best effort as it only affects how quickly terms are recycled
+    setpriority(PRIO_PROCESS, (id_t)syscall(SYS_gettid), AERON_TERM_CLEANER_THREAD_NICE);
+#endif
+
+    bool is_running;
+    AERON_GET_VOLATILE(is_running, cleaner->is_running);
+
+    while (is_running)
+    {
+        if (0 == aeron_term_cleaner_do_work(cleaner))
+        {
+            aeron_nano_sleep(AERON_TERM_CLEANER_IDLE_SLEEP_NS);
+        }
+
+        AERON_GET_VOLATILE(is_running, cleaner->is_running);
+    }
+
+    return NULL;
+}
+
+int aeron_term_cleaner_init(aeron_term_cleaner_t *cleaner)
+{
+    cleaner->logs = NULL;
+    cleaner->logs_length = 0;
+    cleaner->logs_capacity = 0;
+    cleaner->is_running = false;
+    cleaner->is_thread_started = false;
+
+    int result;
+    if ((result = aeron_mutex_init(&cleaner->mutex, NULL)) != 0)
+    {
+        AERON_SET_ERR(result, "%s", "aeron_mutex_init failed");
+        return -1;
+    }
+
+    return 0;
+}
+
+int aeron_term_cleaner_start(aeron_term_cleaner_t *cleaner)
+{
+    aeron_thread_attr_t attr;
+    int result;
+    if ((result = aeron_thread_attr_init(&attr)) != 0)
+    {
+        AERON_SET_ERR(result, "%s", "aeron_thread_attr_init failed");
+        return -1;
+    }
+
+    AERON_PUT_ORDERED(cleaner->is_running, true);
+
+    if ((result = aeron_thread_create(&cleaner->thread, &attr, aeron_term_cleaner_run, cleaner)) != 0)
+    {
+        AERON_PUT_ORDERED(cleaner->is_running, false);
+        AERON_SET_ERR(result, "%s", "aeron_thread_create failed");
+        return -1;
+    }
+
+    cleaner->is_thread_started = true;
+
+    return 0;
+}
+
+int aeron_term_cleaner_add(aeron_term_cleaner_t *cleaner, aeron_term_cleaner_log_t *log)
+{
+    int result = 0;
+
+    aeron_mutex_lock(&cleaner->mutex);
+
+    if (cleaner->logs_length >= cleaner->logs_capacity)
+    {
+        size_t new_capacity = 0 == cleaner->logs_capacity ? 4 : cleaner->logs_capacity * 2;
+        if (aeron_array_ensure_capacity(
+            (uint8_t **)&cleaner->logs, sizeof(aeron_term_cleaner_log_t *), cleaner->logs_capacity, new_capacity) < 0)
+        {
+            AERON_APPEND_ERR("%s", "Unable to add log to term cleaner");
+            result = -1;
+        }
+        else
+        {
+            cleaner->logs_capacity = new_capacity;
+        }
+    }
+
+    if (0 == result)
+    {
+        log->cleaner = cleaner;
+        cleaner->logs[cleaner->logs_length++] = log;
+    }
+
+    aeron_mutex_unlock(&cleaner->mutex);
+
+    return result;
+}
+
+void aeron_term_cleaner_remove(aeron_term_cleaner_log_t *log)
+{
+    aeron_term_cleaner_t *cleaner = log->cleaner;
+    if (NULL == cleaner)
+    {
+        return;
+    }
+
+    aeron_mutex_lock(&cleaner->mutex);
+
+    for (size_t i = 0; i < cleaner->logs_length; i++)
+    {
+        if (log == cleaner->logs[i])
+        {
+            cleaner->logs[i] = cleaner->logs[--cleaner->logs_length];
+            break;
+        }
+    }
+
+    aeron_mutex_unlock(&cleaner->mutex);
+
+    log->cleaner = NULL;
+}
+
+size_t aeron_term_cleaner_do_work(aeron_term_cleaner_t *cleaner)
+{
+    size_t bytes_cleaned = 0;
+
+    aeron_mutex_lock(&cleaner->mutex);
+
+    for (size_t i = 0; i < cleaner->logs_length; i++)
+    {
+        aeron_term_cleaner_log_t *log = cleaner->logs[i];
+        int64_t clean_target;
+        AERON_GET_VOLATILE(clean_target, log->clean_target);
+
+        bytes_cleaned += aeron_term_cleaner_log_clean(log, clean_target, AERON_TERM_CLEANER_CHUNK_LENGTH);
+    }
+
+    aeron_mutex_unlock(&cleaner->mutex);
+
+    return bytes_cleaned;
+}
+
+int aeron_term_cleaner_close(aeron_term_cleaner_t *cleaner)
+{
+    if (cleaner->is_thread_started)
+    {
+        AERON_PUT_ORDERED(cleaner->is_running, false);
+
+        int result = aeron_thread_join(cleaner->thread, NULL);
+        if (0 != result)
+        {
+            AERON_SET_ERR(result, "aeron_thread_join: %s", strerror(result));
+            return -1;
+        }
+
+        cleaner->is_thread_started = false;
+    }
+
+    for (size_t i = 0; i < cleaner->logs_length; i++)
+    {
+        cleaner->logs[i]->cleaner = NULL;
+    }
+
+    aeron_free(cleaner->logs);
+    cleaner->logs = NULL;
+    cleaner->logs_length = 0;
+    cleaner->logs_capacity = 0;
+
+    aeron_mutex_destroy(&cleaner->mutex);
+
+    return 0;
+}
+
+extern int64_t aeron_term_cleaner_log_limit(aeron_term_cleaner_log_t *log, int64_t proposed_limit);
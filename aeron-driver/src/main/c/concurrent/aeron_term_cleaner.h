@@ -0,0 +1,119 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_TERM_CLEANER_H
+#define AERON_TERM_CLEANER_H
+
+#include "util/aeron_fileutil.h"
+#include "concurrent/aeron_atomic.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+#include "concurrent/aeron_thread.h"
+
+#define AERON_TERM_CLEANER_CHUNK_LENGTH (256 * 1024)
+#define AERON_TERM_CLEANER_IDLE_SLEEP_NS (100 * 1000)
+
+typedef struct aeron_term_cleaner_stct aeron_term_cleaner_t;
+
+/*
+ * Clean state of a single log. The owner moves the target forward and, unless a cleaner thread is attached, cleans
+ * towards it itself. With a cleaner attached only the cleaner thread writes the clean position.
+ */
+typedef struct aeron_term_cleaner_log_stct
+{
+    aeron_mapped_raw_log_t *mapped_raw_log;
+    size_t position_bits_to_shift;
+    bool non_temporal;
+    aeron_term_cleaner_t *cleaner;
+    volatile int64_t clean_target;
+    volatile int64_t clean_position;
+}
+aeron_term_cleaner_log_t;
+
+/*
+ * Dedicated low priority thread which cleans the registered logs up to their targets so the conductor does not pay
+ * for zeroing terms in its duty cycle.
+ */
+struct aeron_term_cleaner_stct
+{
+    aeron_mutex_t mutex;
+    aeron_thread_t thread;
+    aeron_term_cleaner_log_t **logs;
+    size_t logs_length;
+    size_t logs_capacity;
+    volatile bool is_running;
+    bool is_thread_started;
+};
+
+/*
+ * Zero length bytes from addr. Non-temporal zeroing bypasses the cache so cleaning does not evict the terms being
+ * actively written and read.
+ */
+void aeron_term_cleaner_zero(uint8_t *addr, size_t length, bool non_temporal);
+
+void aeron_term_cleaner_log_init(
+    aeron_term_cleaner_log_t *log,
+    aeron_mapped_raw_log_t *mapped_raw_log,
+    size_t position_bits_to_shift,
+    int64_t initial_position,
+    bool non_temporal);
+
+/*
+ * Clean from the clean position towards position, stopping at the end of the term or after max_length bytes.
+ * Returns the number of bytes cleaned.
+ */
+size_t aeron_term_cleaner_log_clean(aeron_term_cleaner_log_t *log, int64_t position, size_t max_length);
+
+/*
+ * Request the log be cleaned up to position, inline or by the attached cleaner thread.
+ */
+void aeron_term_cleaner_log_clean_to(aeron_term_cleaner_log_t *log, int64_t position);
+
+/*
+ * Cap a proposed publication limit so a publisher can never write into a region which has not been cleaned yet,
+ * whether cleaning is inline and limited to a term per call or left to the cleaner thread.
+ */
+inline int64_t aeron_term_cleaner_log_limit(aeron_term_cleaner_log_t *log, int64_t proposed_limit)
+{
+    int64_t clean_position;
+    AERON_GET_VOLATILE(clean_position, log->clean_position);
+    const int64_t cleaned_limit =
+        clean_position + ((int64_t)log->mapped_raw_log->term_length * (AERON_LOGBUFFER_PARTITION_COUNT - 1));
+
+    return proposed_limit < cleaned_limit ? proposed_limit : cleaned_limit;
+}
+
+int aeron_term_cleaner_init(aeron_term_cleaner_t *cleaner);
+
+int aeron_term_cleaner_start(aeron_term_cleaner_t *cleaner);
+
+int aeron_term_cleaner_add(aeron_term_cleaner_t *cleaner, aeron_term_cleaner_log_t *log);
+
+/*
+ * Detach the log from its cleaner, after which the cleaner will no longer touch its buffers.
+ */
+void aeron_term_cleaner_remove(aeron_term_cleaner_log_t *log);
+
+/*
+ * Clean one chunk of each registered log that is behind its target. Returns the number of bytes cleaned.
+ */
+size_t aeron_term_cleaner_do_work(aeron_term_cleaner_t *cleaner);
+
+/*
+ * Stop and join the thread then detach any logs still registered.
+ */
+int aeron_term_cleaner_close(aeron_term_cleaner_t *cleaner);
+
+#endif //AERON_TERM_CLEANER_H
@@ -60,7 +60,8 @@ int aeron_receive_channel_endpoint_create(
     aeron_receive_destination_t *straight_through_destination,
     aeron_atomic_counter_t *status_indicator,
     aeron_system_counters_t *system_counters,
-    aeron_driver_context_t *context)
+    aeron_driver_context_t *context,
+    aeron_driver_receiver_proxy_t *receiver_proxy)
 {
     aeron_receive_channel_endpoint_t *_endpoint = NULL;
 
@@ -71,7 +72,7 @@ int aeron_receive_channel_endpoint_create(
     }
 
     if (aeron_data_packet_dispatcher_init(
-        &_endpoint->dispatcher, context->conductor_proxy, context->receiver_proxy->receiver) < 0)
+        &_endpoint->dispatcher, context->conductor_proxy, receiver_proxy->receiver) < 0)
     {
         AERON_APPEND_ERR("%s", "Failed to initialise data packet dispatcher");
         return -1;
@@ -111,7 +112,7 @@ int aeron_receive_channel_endpoint_create(
     _endpoint->channel_status.value_addr = status_indicator->value_addr;
 
     _endpoint->receiver_id = context->next_receiver_id++;
-    _endpoint->receiver_proxy = context->receiver_proxy;
+    _endpoint->receiver_proxy = receiver_proxy;
 
     if (aeron_receive_channel_endpoint_set_group_tag(_endpoint, channel, context) < 0)
     {
@@ -123,7 +124,7 @@ int aeron_receive_channel_endpoint_create(
     _endpoint->possible_ttl_asymmetry_counter = aeron_system_counter_addr(
         system_counters, AERON_SYSTEM_COUNTER_POSSIBLE_TTL_ASYMMETRY);
 
-    _endpoint->cached_clock = context->receiver_cached_clock;
+    _endpoint->cached_clock = receiver_proxy->receiver->cached_clock;
 
     _endpoint->send_nak_message = context->log.send_nak_message;
 
@@ -495,6 +496,21 @@ void aeron_receive_channel_endpoint_dispatch(
             }
             break;
 
+        case AERON_HDR_TYPE_FEC:
+            if (length >= sizeof(aeron_fec_header_t))
+            {
+                if (aeron_receive_channel_endpoint_on_fec(endpoint, destination, buffer, length, addr) < 0)
+                {
+                    AERON_APPEND_ERR("%s", "receiver on_fec");
+                    aeron_driver_receiver_log_error(receiver);
+                }
+            }
+            else
+            {
+                aeron_counter_increment(receiver->invalid_frames_counter, 1);
+            }
+            break;
+
         default:
             break;
     }
@@ -548,7 +564,7 @@ int aeron_receive_channel_endpoint_on_data(
         destination, aeron_clock_cached_nano_time(endpoint->cached_clock));
 
     return aeron_data_packet_dispatcher_on_data(
-        &endpoint->dispatcher, endpoint, destination, data_header, buffer, length, addr);
+        &endpoint->dispatcher, endpoint, destination, data_header, buffer, length, addr, media_receive_timestamp);
 }
 
 int aeron_receive_channel_endpoint_on_setup(
@@ -589,6 +605,22 @@ int aeron_receive_channel_endpoint_on_rttm(
     return result;
 }
 
+int aeron_receive_channel_endpoint_on_fec(
+    aeron_receive_channel_endpoint_t *endpoint,
+    aeron_receive_destination_t *destination,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr)
+{
+    aeron_fec_header_t *fec_header = (aeron_fec_header_t *)buffer;
+
+    aeron_receive_destination_update_last_activity_ns(
+        destination, aeron_clock_cached_nano_time(endpoint->cached_clock));
+
+    return aeron_data_packet_dispatcher_on_fec(
+        &endpoint->dispatcher, endpoint, destination, fec_header, buffer, length, addr);
+}
+
 void aeron_receive_channel_endpoint_try_remove_endpoint(aeron_receive_channel_endpoint_t *endpoint)
 {
     if (0 == endpoint->stream_id_to_refcnt_map.size &&
@@ -90,7 +90,8 @@ int aeron_receive_channel_endpoint_create(
     aeron_receive_destination_t *straight_through_destination,
     aeron_atomic_counter_t *status_indicator,
     aeron_system_counters_t *system_counters,
-    aeron_driver_context_t *context);
+    aeron_driver_context_t *context,
+    aeron_driver_receiver_proxy_t *receiver_proxy);
 
 int aeron_receive_channel_endpoint_delete(
     aeron_counters_manager_t *counters_manager, aeron_receive_channel_endpoint_t *endpoint);
@@ -180,6 +181,13 @@ int aeron_receive_channel_endpoint_on_rttm(
     size_t length,
     struct sockaddr_storage *addr);
 
+int aeron_receive_channel_endpoint_on_fec(
+    aeron_receive_channel_endpoint_t *endpoint,
+    aeron_receive_destination_t *destination,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr);
+
 int aeron_receive_channel_endpoint_on_unconnected_stream(
     aeron_receive_channel_endpoint_t *endpoint,
     aeron_receive_destination_t *destination,
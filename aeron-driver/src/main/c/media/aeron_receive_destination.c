@@ -24,6 +24,7 @@ int aeron_receive_destination_create(
     aeron_udp_channel_t *destination_channel,
     aeron_udp_channel_t *endpoint_channel,
     aeron_driver_context_t *context,
+    aeron_driver_receiver_proxy_t *receiver_proxy,
     aeron_counters_manager_t *counters_manager,
     int64_t registration_id,
     int32_t channel_status_counter_id)
@@ -31,7 +32,8 @@ int aeron_receive_destination_create(
     aeron_receive_destination_t *_destination = NULL;
     const size_t socket_rcvbuf = aeron_udp_channel_socket_so_rcvbuf(endpoint_channel, context->socket_rcvbuf);
     const size_t socket_sndbuf = aeron_udp_channel_socket_so_sndbuf(endpoint_channel, context->socket_sndbuf);
-    bool is_media_timestamping = aeron_udp_channel_is_media_rcv_timestamps_enabled(endpoint_channel);
+    bool is_media_timestamping =
+        aeron_udp_channel_is_media_rcv_timestamps_enabled(endpoint_channel) || context->latency_report_enabled;
 
     if (aeron_alloc((void **)&_destination, sizeof(aeron_receive_destination_t)) < 0)
     {
@@ -40,7 +42,7 @@ int aeron_receive_destination_create(
     }
 
     _destination->transport.fd = -1;
-    _destination->data_paths = &context->receiver_proxy->receiver->data_paths;
+    _destination->data_paths = &receiver_proxy->receiver->data_paths;
     _destination->transport.data_paths = _destination->data_paths;
     _destination->local_sockaddr_indicator.counter_id = AERON_NULL_COUNTER_ID;
 
@@ -115,7 +117,7 @@ int aeron_receive_destination_create(
     }
 
     _destination->transport.destination_clientd = _destination;
-    _destination->time_of_last_activity_ns = aeron_clock_cached_nano_time(context->receiver_cached_clock);
+    _destination->time_of_last_activity_ns = aeron_clock_cached_nano_time(receiver_proxy->receiver->cached_clock);
 
     if (destination_channel->is_multicast)
     {
@@ -49,6 +49,7 @@ int aeron_receive_destination_create(
     aeron_udp_channel_t *destination_channel,
     aeron_udp_channel_t *endpoint_channel,
     aeron_driver_context_t *context,
+    aeron_driver_receiver_proxy_t *receiver_proxy,
     aeron_counters_manager_t *counters_manager,
     int64_t registration_id,
     int32_t channel_status_counter_id);
@@ -42,7 +42,8 @@ int aeron_send_channel_endpoint_create(
     aeron_driver_uri_publication_params_t *params,
     aeron_driver_context_t *context,
     aeron_counters_manager_t *counters_manager,
-    int64_t registration_id)
+    int64_t registration_id,
+    aeron_driver_sender_proxy_t *sender_proxy)
 {
     aeron_send_channel_endpoint_t *_endpoint = NULL;
     char bind_addr_and_port[AERON_NETUTIL_FORMATTED_MAX_LENGTH];
@@ -55,7 +56,7 @@ int aeron_send_channel_endpoint_create(
     }
 
     _endpoint->destination_tracker = NULL;
-    _endpoint->data_paths = &context->sender_proxy->sender->data_paths;
+    _endpoint->data_paths = &sender_proxy->sender->data_paths;
 
     struct sockaddr_storage *connect_addr = NULL;
     if (aeron_udp_channel_is_multi_destination(channel))
@@ -64,7 +65,7 @@ int aeron_send_channel_endpoint_create(
             aeron_udp_destination_tracker_init(
                 _endpoint->destination_tracker,
                 _endpoint->data_paths,
-                context->sender_cached_clock,
+                sender_proxy->sender->cached_clock,
                 AERON_UDP_CHANNEL_CONTROL_MODE_MANUAL == channel->control_mode,
                 AERON_UDP_DESTINATION_TRACKER_DESTINATION_TIMEOUT_NS) < 0)
         {
@@ -94,7 +95,7 @@ int aeron_send_channel_endpoint_create(
     _endpoint->local_sockaddr_indicator.counter_id = -1;
     _endpoint->tracker_num_destinations.counter_id = -1;
     _endpoint->transport_bindings = context->udp_channel_transport_bindings;
-    _endpoint->data_paths = &context->sender_proxy->sender->data_paths;
+    _endpoint->data_paths = &sender_proxy->sender->data_paths;
     _endpoint->transport.data_paths = _endpoint->data_paths;
 
     if (context->sender_port_manager->get_managed_port(
@@ -138,6 +139,13 @@ int aeron_send_channel_endpoint_create(
         _endpoint->transport.timestamp_flags |= AERON_UDP_CHANNEL_TRANSPORT_CHANNEL_SND_TIMESTAMP;
     }
 
+    _endpoint->tx_timestamp_sample.latency_reporter = NULL;
+    _endpoint->tx_timestamp_sample.latency_reporter_offset = -1;
+    _endpoint->tx_timestamp_sample.sample_interval_ns = (int64_t)context->latency_report_sample_interval_ns;
+    _endpoint->tx_timestamp_sample.next_sample_ns = 0;
+    _endpoint->tx_timestamp_sample.is_pending = false;
+    _endpoint->tx_timestamp_sample.is_stale = false;
+
     if (aeron_int64_to_ptr_hash_map_init(
         &_endpoint->publication_dispatch_map, 8, AERON_MAP_DEFAULT_LOAD_FACTOR) < 0)
     {
@@ -145,6 +153,13 @@ int aeron_send_channel_endpoint_create(
         return -1;
     }
 
+    if (aeron_int64_to_ptr_hash_map_init(
+        &_endpoint->conductor_fields.publication_by_stream_id_map, 8, AERON_MAP_DEFAULT_LOAD_FACTOR) < 0)
+    {
+        aeron_send_channel_endpoint_delete(counters_manager, _endpoint);
+        return -1;
+    }
+
     if ((bind_addr_and_port_length = aeron_send_channel_endpoint_bind_addr_and_port(
         _endpoint, bind_addr_and_port, sizeof(bind_addr_and_port))) < 0)
     {
@@ -217,8 +232,8 @@ int aeron_send_channel_endpoint_create(
     aeron_counter_set_ordered(
         _endpoint->local_sockaddr_indicator.value_addr, AERON_COUNTER_CHANNEL_ENDPOINT_STATUS_ACTIVE);
 
-    _endpoint->sender_proxy = context->sender_proxy;
-    _endpoint->cached_clock = context->sender_cached_clock;
+    _endpoint->sender_proxy = sender_proxy;
+    _endpoint->cached_clock = sender_proxy->sender->cached_clock;
     _endpoint->time_of_last_sm_ns = aeron_clock_cached_nano_time(_endpoint->cached_clock);
     memcpy(&_endpoint->current_data_addr, &channel->remote_data, sizeof(_endpoint->current_data_addr));
 
@@ -248,6 +263,7 @@ int aeron_send_channel_endpoint_delete(
     }
 
     aeron_int64_to_ptr_hash_map_delete(&endpoint->publication_dispatch_map);
+    aeron_int64_to_ptr_hash_map_delete(&endpoint->conductor_fields.publication_by_stream_id_map);
     aeron_udp_channel_delete(endpoint->conductor_fields.udp_channel);
     endpoint->transport_bindings->close_func(&endpoint->transport);
 
@@ -334,6 +350,76 @@ int aeron_send_channel_send(
     return result;
 }
 
+void aeron_send_channel_endpoint_request_tx_timestamp(
+    aeron_send_channel_endpoint_t *endpoint,
+    aeron_latency_reporter_t *latency_reporter,
+    aeron_latency_reporter_entry_offset_t latency_reporter_offset,
+    int64_t now_ns)
+{
+    struct aeron_send_channel_endpoint_tx_timestamp_sample_stct *sample = &endpoint->tx_timestamp_sample;
+
+    if (latency_reporter_offset >= 0 &&
+        (AERON_UDP_CHANNEL_TRANSPORT_TX_TIMESTAMP & endpoint->transport.timestamp_flags) &&
+        !sample->is_pending &&
+        now_ns >= sample->next_sample_ns)
+    {
+        if (sample->is_stale)
+        {
+            // A previous sample was abandoned so discard its timestamp if it has since arrived.
+            int64_t timestamp_ns;
+            while (aeron_udp_channel_transport_recv_tx_timestamp(&endpoint->transport, &timestamp_ns) > 0)
+            {
+            }
+            aeron_err_clear();
+            sample->is_stale = false;
+        }
+
+        struct timespec send_timestamp;
+        if (0 == aeron_clock_gettime_realtime(&send_timestamp))
+        {
+            sample->latency_reporter = latency_reporter;
+            sample->latency_reporter_offset = latency_reporter_offset;
+            sample->send_timestamp_ns = (INT64_C(1000) * 1000 * 1000 * send_timestamp.tv_sec) + send_timestamp.tv_nsec;
+            sample->deadline_ns = now_ns + AERON_SEND_CHANNEL_ENDPOINT_TX_TIMESTAMP_TIMEOUT_NS;
+            sample->next_sample_ns = now_ns + sample->sample_interval_ns;
+            sample->is_pending = true;
+            endpoint->transport.is_tx_timestamp_requested = true;
+        }
+    }
+}
+
+void aeron_send_channel_endpoint_poll_tx_timestamp(aeron_send_channel_endpoint_t *endpoint, int64_t now_ns)
+{
+    struct aeron_send_channel_endpoint_tx_timestamp_sample_stct *sample = &endpoint->tx_timestamp_sample;
+
+    if (endpoint->transport.is_tx_timestamp_requested)
+    {
+        // Nothing was sent, or the bindings in use do not send through the kernel, so there will be no timestamp.
+        endpoint->transport.is_tx_timestamp_requested = false;
+        sample->is_pending = false;
+    }
+
+    if (sample->is_pending)
+    {
+        int64_t timestamp_ns;
+        int result = aeron_udp_channel_transport_recv_tx_timestamp(&endpoint->transport, &timestamp_ns);
+
+        if (result > 0)
+        {
+            aeron_latency_reporter_record(
+                sample->latency_reporter, sample->latency_reporter_offset, timestamp_ns - sample->send_timestamp_ns);
+            sample->is_pending = false;
+        }
+        else if (result < 0 || now_ns > sample->deadline_ns)
+        {
+            // The latency report is diagnostic so a failure to read it must not fail the send.
+            aeron_err_clear();
+            sample->is_pending = false;
+            sample->is_stale = true;
+        }
+    }
+}
+
 int aeron_send_channel_send_endpoint_address(
     aeron_send_channel_endpoint_t *endpoint,
     struct sockaddr_storage* endpoint_address,
@@ -394,7 +480,7 @@ void aeron_send_channel_endpoint_dispatch(
             if (length >= sizeof(aeron_nak_header_t))
             {
                 result = aeron_send_channel_endpoint_on_nak(endpoint, buffer, length, addr);
-                aeron_counter_ordered_increment(sender->nak_messages_received_counter, 1);
+                aeron_counter_increment(sender->nak_messages_received_counter, 1);
             }
             else
             {
@@ -406,7 +492,7 @@ void aeron_send_channel_endpoint_dispatch(
             if (length >= sizeof(aeron_status_message_header_t) && length >= (size_t)frame_header->frame_length)
             {
                 result = aeron_send_channel_endpoint_on_status_message(endpoint, conductor_proxy, buffer, length, addr);
-                aeron_counter_ordered_increment(sender->status_messages_received_counter, 1);
+                aeron_counter_increment(sender->status_messages_received_counter, 1);
             }
             else
             {
@@ -446,6 +532,27 @@ void aeron_send_channel_endpoint_dispatch(
     }
 }
 
+static int64_t aeron_send_channel_endpoint_receiver_key(struct sockaddr_storage *addr)
+{
+    if (AF_INET6 == addr->ss_family)
+    {
+        struct sockaddr_in6 *addr_in6 = (struct sockaddr_in6 *)addr;
+        uint64_t key = addr_in6->sin6_port;
+        const uint8_t *bytes = addr_in6->sin6_addr.s6_addr;
+
+        for (size_t i = 0; i < sizeof(addr_in6->sin6_addr.s6_addr); i++)
+        {
+            key = (key * 31) + bytes[i];
+        }
+
+        return (int64_t)key;
+    }
+
+    struct sockaddr_in *addr_in = (struct sockaddr_in *)addr;
+
+    return (int64_t)(((uint64_t)addr_in->sin_addr.s_addr << 16) | addr_in->sin_port);
+}
+
 int aeron_send_channel_endpoint_on_nak(
     aeron_send_channel_endpoint_t *endpoint, uint8_t *buffer, size_t length, struct sockaddr_storage *addr)
 {
@@ -456,7 +563,12 @@ int aeron_send_channel_endpoint_on_nak(
 
     if (NULL != publication)
     {
-        int result = aeron_network_publication_on_nak(publication, nak_header->term_id, nak_header->term_offset, nak_header->length);
+        int result = aeron_network_publication_on_nak(
+            publication,
+            nak_header->term_id,
+            nak_header->term_offset,
+            nak_header->length,
+            aeron_send_channel_endpoint_receiver_key(addr));
 
         if (0 != result)
         {
@@ -28,6 +28,7 @@
 #include "aeron_driver_sender_proxy.h"
 
 #define AERON_SEND_CHANNEL_ENDPOINT_DESTINATION_TIMEOUT_NS (5 * 1000 * 1000 * 1000LL)
+#define AERON_SEND_CHANNEL_ENDPOINT_TX_TIMESTAMP_TIMEOUT_NS (100 * 1000 * 1000LL)
 
 typedef enum aeron_send_channel_endpoint_status_enum
 {
@@ -47,6 +48,7 @@ typedef struct aeron_send_channel_endpoint_stct
         aeron_send_channel_endpoint_status_t status;
         size_t socket_sndbuf;
         size_t socket_rcvbuf;
+        aeron_int64_to_ptr_hash_map_t publication_by_stream_id_map;
     }
     conductor_fields;
 
@@ -65,6 +67,20 @@ typedef struct aeron_send_channel_endpoint_stct
     aeron_port_manager_t *port_manager;
     aeron_clock_cache_t *cached_clock;
     int64_t time_of_last_sm_ns;
+
+    struct aeron_send_channel_endpoint_tx_timestamp_sample_stct
+    {
+        aeron_latency_reporter_t *latency_reporter;
+        aeron_latency_reporter_entry_offset_t latency_reporter_offset;
+        int64_t send_timestamp_ns;
+        int64_t deadline_ns;
+        int64_t next_sample_ns;
+        int64_t sample_interval_ns;
+        bool is_pending;
+        bool is_stale;
+    }
+    tx_timestamp_sample;
+
     uint8_t padding[AERON_CACHE_LINE_LENGTH];
 }
 aeron_send_channel_endpoint_t;
@@ -75,7 +91,8 @@ int aeron_send_channel_endpoint_create(
     aeron_driver_uri_publication_params_t *params,
     aeron_driver_context_t *context,
     aeron_counters_manager_t *counters_manager,
-    int64_t registration_id);
+    int64_t registration_id,
+    aeron_driver_sender_proxy_t *sender_proxy);
 
 int aeron_send_channel_endpoint_delete(
     aeron_counters_manager_t *counters_manager, aeron_send_channel_endpoint_t *endpoint);
@@ -89,6 +106,19 @@ int aeron_send_channel_send(
     size_t iov_length,
     int64_t *bytes_sent);
 
+/*
+ * Sampling of the snd-wire hop for the latency report. At most one kernel transmit timestamp is outstanding per
+ * endpoint, so publications sharing an endpoint take turns. A request applies to the first datagram of the next
+ * send and the timestamp is collected by a later poll from the same sender.
+ */
+void aeron_send_channel_endpoint_request_tx_timestamp(
+    aeron_send_channel_endpoint_t *endpoint,
+    aeron_latency_reporter_t *latency_reporter,
+    aeron_latency_reporter_entry_offset_t latency_reporter_offset,
+    int64_t now_ns);
+
+void aeron_send_channel_endpoint_poll_tx_timestamp(aeron_send_channel_endpoint_t *endpoint, int64_t now_ns);
+
 int aeron_send_channel_send_endpoint_address(
     aeron_send_channel_endpoint_t *endpoint,
     struct sockaddr_storage* endpoint_address,
@@ -41,9 +41,24 @@
 
 #if defined(__linux__)
 #define HAS_MEDIA_RCV_TIMESTAMPS
+#define HAS_UDP_SEGMENTATION_OFFLOAD
 #include <linux/net_tstamp.h>
+#include <linux/errqueue.h>
 #include <sys/ioctl.h>
 #include <linux/sockios.h>
+#include <netinet/udp.h>
+
+#if !defined(SOL_UDP)
+#define SOL_UDP (17)
+#endif
+
+#if !defined(UDP_SEGMENT)
+#define UDP_SEGMENT (103)
+#endif
+
+#if !defined(UDP_GRO)
+#define UDP_GRO (104)
+#endif
 #endif
 
 #if !defined(HAVE_STRUCT_MMSGHDR)
@@ -80,6 +95,48 @@ static int aeron_udp_channel_transport_setup_media_rcv_timestamps(aeron_udp_chan
     return -1;
 }
 
+static int aeron_udp_channel_transport_setup_tx_timestamps(aeron_udp_channel_transport_t *transport)
+{
+#if defined(HAS_MEDIA_RCV_TIMESTAMPS)
+    // Only reporting is enabled on the socket, generation is requested per send so the error queue holds samples.
+    uint32_t timestamp_flags = SOF_TIMESTAMPING_SOFTWARE | SOF_TIMESTAMPING_OPT_TSONLY;
+    if (transport->timestamp_flags & AERON_UDP_CHANNEL_TRANSPORT_MEDIA_RCV_TIMESTAMP)
+    {
+        timestamp_flags |= SOF_TIMESTAMPING_RX_HARDWARE;
+    }
+
+    if (aeron_setsockopt(transport->fd, SOL_SOCKET, SO_TIMESTAMPING, &timestamp_flags, sizeof(timestamp_flags)) < 0)
+    {
+        AERON_SET_ERR(errno, "%s", "setsockopt(SO_TIMESTAMPING)");
+        return -1;
+    }
+
+    transport->timestamp_flags |= AERON_UDP_CHANNEL_TRANSPORT_TX_TIMESTAMP;
+    return 0;
+#endif
+
+    AERON_SET_ERR(EINVAL, "%s", "Transmit timestamps are not supported on this platform");
+    return -1;
+}
+
+static int aeron_udp_channel_transport_setup_gro(aeron_udp_channel_transport_t *transport)
+{
+#if defined(HAS_UDP_SEGMENTATION_OFFLOAD)
+    int enable_gro = 1;
+    if (aeron_setsockopt(transport->recv_fd, SOL_UDP, UDP_GRO, &enable_gro, sizeof(enable_gro)) < 0)
+    {
+        AERON_SET_ERR(errno, "%s", "setsockopt(UDP_GRO)");
+        return -1;
+    }
+
+    transport->offload_flags |= AERON_UDP_CHANNEL_TRANSPORT_OFFLOAD_GRO;
+    return 0;
+#endif
+
+    AERON_SET_ERR(EINVAL, "%s", "UDP GRO is not supported on this platform");
+    return -1;
+}
+
 int aeron_udp_channel_transport_init(
     aeron_udp_channel_transport_t *transport,
     struct sockaddr_storage *bind_addr,
@@ -96,6 +153,10 @@ int aeron_udp_channel_transport_init(
     transport->fd = -1;
     transport->bindings_clientd = NULL;
     transport->timestamp_flags = AERON_UDP_CHANNEL_TRANSPORT_MEDIA_RCV_TIMESTAMP_NONE;
+    transport->is_tx_timestamp_requested = false;
+    transport->offload_flags = AERON_UDP_CHANNEL_TRANSPORT_OFFLOAD_NONE;
+    transport->invalid_packets_counter = NULL != context && NULL != context->system_counters ?
+        aeron_system_counter_addr(context->system_counters, AERON_SYSTEM_COUNTER_INVALID_PACKETS) : NULL;
     for (size_t i = 0; i < AERON_UDP_CHANNEL_TRANSPORT_MAX_INTERCEPTORS; i++)
     {
         transport->interceptor_clientds[i] = NULL;
@@ -299,6 +360,33 @@ int aeron_udp_channel_transport_init(
         }
     }
 
+    if (AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER == affinity && context->socket_gro_enabled)
+    {
+        if (aeron_udp_channel_transport_setup_gro(transport) < 0)
+        {
+            AERON_APPEND_ERR("%s", "WARNING: unable to setup UDP GRO");
+            aeron_distinct_error_log_record(context->error_log, aeron_errcode(), aeron_errmsg());
+            aeron_err_clear();
+        }
+    }
+
+    if (AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_SENDER == affinity && context->latency_report_enabled)
+    {
+        if (aeron_udp_channel_transport_setup_tx_timestamps(transport) < 0)
+        {
+            AERON_APPEND_ERR("%s", "WARNING: unable to setup transmit timestamps for the latency report");
+            aeron_distinct_error_log_record(context->error_log, aeron_errcode(), aeron_errmsg());
+            aeron_err_clear();
+        }
+    }
+
+#if defined(HAS_UDP_SEGMENTATION_OFFLOAD)
+    if (AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_SENDER == affinity && context->socket_gso_enabled)
+    {
+        transport->offload_flags |= AERON_UDP_CHANNEL_TRANSPORT_OFFLOAD_GSO;
+    }
+#endif
+
     if (aeron_set_socket_non_blocking(transport->fd) < 0)
     {
         AERON_APPEND_ERR("%s", "failed to set transport->fd to be non-blocking");
@@ -356,30 +444,113 @@ int aeron_udp_channel_transport_close(aeron_udp_channel_transport_t *transport)
     return 0;
 }
 
-static inline int aeron_udp_channel_transport_recvmsg(
+#if defined(HAS_MEDIA_RCV_TIMESTAMPS)
+static inline void aeron_udp_channel_transport_set_recv_control(
     aeron_udp_channel_transport_t *transport,
     struct mmsghdr *msgvec,
     size_t vlen,
+    char buf[][AERON_UDP_CHANNEL_TRANSPORT_RECV_CONTROL_LENGTH])
+{
+    const bool has_control = 0 != transport->timestamp_flags ||
+        0 != (transport->offload_flags & AERON_UDP_CHANNEL_TRANSPORT_OFFLOAD_GRO);
+
+    for (size_t i = 0; i < vlen; i++)
+    {
+        msgvec[i].msg_hdr.msg_control = has_control ? (void *)buf[i] : NULL;
+        msgvec[i].msg_hdr.msg_controllen = has_control ? AERON_UDP_CHANNEL_TRANSPORT_RECV_CONTROL_LENGTH : 0;
+    }
+}
+#endif
+
+void aeron_udp_channel_transport_dispatch(
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *msg,
+    uint8_t *buffer,
+    size_t length,
     int64_t *bytes_rcved,
     aeron_udp_transport_recv_func_t recv_func,
     void *clientd)
 {
     struct timespec *media_rcv_timestamp = NULL;
-#if defined(HAS_MEDIA_RCV_TIMESTAMPS)
-    AERON_DECL_ALIGNED(
-        char buf[AERON_DRIVER_RECEIVER_IO_VECTOR_LENGTH_MAX][CMSG_SPACE(sizeof(struct timespec))],
-        sizeof(struct cmsghdr));
+    size_t segment_length = length;
+
+    // A datagram larger than the receive buffer has been cut short by the kernel and cannot be framed.
+    if (msg->msg_flags & MSG_TRUNC)
+    {
+        if (NULL != transport->invalid_packets_counter)
+        {
+            aeron_counter_increment(transport->invalid_packets_counter, 1);
+        }
+        return;
+    }
 
-    if (transport->timestamp_flags)
+#if defined(HAS_MEDIA_RCV_TIMESTAMPS)
+    if (NULL != msg->msg_control && msg->msg_controllen > 0)
     {
-        for (int i = 0; i < (int)vlen; i++)
+        for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(msg); NULL != cmsg; cmsg = CMSG_NXTHDR(msg, cmsg))
         {
-            msgvec[i].msg_hdr.msg_control = (void *)buf[i];
-            msgvec[i].msg_hdr.msg_controllen = CMSG_LEN(sizeof(buf[i]));
+            if (SOL_SOCKET == cmsg->cmsg_level &&
+                SCM_TIMESTAMPNS == cmsg->cmsg_type &&
+                CMSG_LEN(sizeof(struct timespec)) == cmsg->cmsg_len)
+            {
+                media_rcv_timestamp = (struct timespec *)CMSG_DATA(cmsg);
+            }
+#if defined(HAS_UDP_SEGMENTATION_OFFLOAD)
+            else if (SOL_UDP == cmsg->cmsg_level &&
+                UDP_GRO == cmsg->cmsg_type &&
+                CMSG_LEN(sizeof(int)) == cmsg->cmsg_len)
+            {
+                int gso_size;
+                memcpy(&gso_size, CMSG_DATA(cmsg), sizeof(gso_size));
+                if (gso_size > 0 && (size_t)gso_size < length)
+                {
+                    segment_length = (size_t)gso_size;
+                }
+            }
+#endif
         }
     }
 #endif
 
+    // Without GRO, or for a datagram that was not coalesced, this is a single pass over the whole buffer.
+    size_t offset = 0;
+    do
+    {
+        size_t remaining = length - offset;
+        size_t datagram_length = remaining < segment_length ? remaining : segment_length;
+
+        recv_func(
+            transport->data_paths,
+            transport,
+            clientd,
+            transport->dispatch_clientd,
+            transport->destination_clientd,
+            buffer + offset,
+            datagram_length,
+            msg->msg_name,
+            media_rcv_timestamp);
+        *bytes_rcved += (int64_t)datagram_length;
+        offset += datagram_length;
+    }
+    while (offset < length);
+}
+
+static inline int aeron_udp_channel_transport_recvmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen,
+    int64_t *bytes_rcved,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd)
+{
+#if defined(HAS_MEDIA_RCV_TIMESTAMPS)
+    AERON_DECL_ALIGNED(
+        char buf[AERON_DRIVER_RECEIVER_IO_VECTOR_LENGTH_MAX][AERON_UDP_CHANNEL_TRANSPORT_RECV_CONTROL_LENGTH],
+        sizeof(struct cmsghdr));
+
+    aeron_udp_channel_transport_set_recv_control(transport, msgvec, vlen, buf);
+#endif
+
     int work_count = 0;
 
     for (size_t i = 0, length = vlen; i < length; i++)
@@ -397,29 +568,15 @@ static inline int aeron_udp_channel_transport_recvmsg(
             break;
         }
 
-#if defined(HAS_MEDIA_RCV_TIMESTAMPS)
-        struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msgvec[i].msg_hdr);
-        if (NULL != cmsg &&
-            SOL_SOCKET == cmsg->cmsg_level &&
-            SCM_TIMESTAMPNS == cmsg->cmsg_type &&
-            CMSG_LEN(sizeof(struct timespec)) == cmsg->cmsg_len)
-        {
-            media_rcv_timestamp = (struct timespec *)CMSG_DATA(cmsg);
-        }
-#endif
-
         msgvec[i].msg_len = (unsigned int)result;
-        recv_func(
-            transport->data_paths,
+        aeron_udp_channel_transport_dispatch(
             transport,
-            clientd,
-            transport->dispatch_clientd,
-            transport->destination_clientd,
+            &msgvec[i].msg_hdr,
             msgvec[i].msg_hdr.msg_iov[0].iov_base,
             msgvec[i].msg_len,
-            msgvec[i].msg_hdr.msg_name,
-            media_rcv_timestamp);
-        *bytes_rcved += msgvec[i].msg_len;
+            bytes_rcved,
+            recv_func,
+            clientd);
         work_count++;
     }
 
@@ -438,20 +595,12 @@ int aeron_udp_channel_transport_recvmmsg(
     if (vlen > 1)
     {
         struct timespec tv = { .tv_nsec = 0, .tv_sec = 0 };
-        struct timespec *media_rcv_timestamp = NULL;
 #if defined(HAS_MEDIA_RCV_TIMESTAMPS)
         AERON_DECL_ALIGNED(
-            char buf[AERON_DRIVER_RECEIVER_IO_VECTOR_LENGTH_MAX][CMSG_SPACE(sizeof(struct timespec))],
+            char buf[AERON_DRIVER_RECEIVER_IO_VECTOR_LENGTH_MAX][AERON_UDP_CHANNEL_TRANSPORT_RECV_CONTROL_LENGTH],
             sizeof(struct cmsghdr));
 
-        if (transport->timestamp_flags)
-        {
-            for (int i = 0; i < (int)vlen; i++)
-            {
-                msgvec[i].msg_hdr.msg_control = (void *)buf[i];
-                msgvec[i].msg_hdr.msg_controllen = CMSG_LEN(sizeof(buf[i]));
-            }
-        }
+        aeron_udp_channel_transport_set_recv_control(transport, msgvec, vlen, buf);
 #endif
 
         int result = recvmmsg(transport->recv_fd, msgvec, vlen, 0, &tv);
@@ -483,28 +632,14 @@ int aeron_udp_channel_transport_recvmmsg(
         {
             for (size_t i = 0, length = (size_t)result; i < length; i++)
             {
-#if defined(HAS_MEDIA_RCV_TIMESTAMPS)
-                struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msgvec[i].msg_hdr);
-                if (NULL != cmsg &&
-                    SOL_SOCKET == cmsg->cmsg_level &&
-                    SCM_TIMESTAMPNS == cmsg->cmsg_type &&
-                    CMSG_LEN(sizeof(struct timespec)) == cmsg->cmsg_len)
-                {
-                    media_rcv_timestamp = (struct timespec *)CMSG_DATA(cmsg);
-                }
-#endif
-
-                recv_func(
-                    transport->data_paths,
+                aeron_udp_channel_transport_dispatch(
                     transport,
-                    clientd,
-                    transport->dispatch_clientd,
-                    transport->destination_clientd,
+                    &msgvec[i].msg_hdr,
                     msgvec[i].msg_hdr.msg_iov[0].iov_base,
                     msgvec[i].msg_len,
-                    msgvec[i].msg_hdr.msg_name,
-                    media_rcv_timestamp);
-                *bytes_rcved += msgvec[i].msg_len;
+                    bytes_rcved,
+                    recv_func,
+                    clientd);
             }
 
             return result;
@@ -517,6 +652,30 @@ int aeron_udp_channel_transport_recvmmsg(
     }
 }
 
+#if defined(HAS_MEDIA_RCV_TIMESTAMPS)
+#define AERON_UDP_CHANNEL_TRANSPORT_TX_TIMESTAMP_CMSG_SPACE (CMSG_SPACE(sizeof(uint32_t)))
+
+static inline void aeron_udp_channel_transport_add_tx_timestamp_control(
+    aeron_udp_channel_transport_t *transport, struct msghdr *msg, char *buf)
+{
+    if (transport->is_tx_timestamp_requested)
+    {
+        struct cmsghdr *cmsg = (struct cmsghdr *)(buf + msg->msg_controllen);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type = SO_TIMESTAMPING;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(uint32_t));
+        uint32_t timestamp_flags = SOF_TIMESTAMPING_TX_SOFTWARE;
+        memcpy(CMSG_DATA(cmsg), &timestamp_flags, sizeof(timestamp_flags));
+
+        msg->msg_control = (void *)buf;
+        msg->msg_controllen += AERON_UDP_CHANNEL_TRANSPORT_TX_TIMESTAMP_CMSG_SPACE;
+        transport->is_tx_timestamp_requested = false;
+    }
+}
+#else
+#define AERON_UDP_CHANNEL_TRANSPORT_TX_TIMESTAMP_CMSG_SPACE (0)
+#endif
+
 static int aeron_udp_channel_transport_send_connected(
     aeron_udp_channel_transport_t *transport,
     struct iovec *iov,
@@ -594,6 +753,12 @@ static int aeron_udp_channel_transport_sendv(
         msg[msg_i].msg_len = 0;
     }
 
+#if defined(HAS_MEDIA_RCV_TIMESTAMPS)
+    AERON_DECL_ALIGNED(
+        char tx_timestamp_control[AERON_UDP_CHANNEL_TRANSPORT_TX_TIMESTAMP_CMSG_SPACE], sizeof(struct cmsghdr));
+    aeron_udp_channel_transport_add_tx_timestamp_control(transport, &msg[0].msg_hdr, tx_timestamp_control);
+#endif
+
     int num_sent = sendmmsg(transport->fd, msg, msg_i, 0);
     if (num_sent < 0)
     {
@@ -620,6 +785,119 @@ static int aeron_udp_channel_transport_sendv(
     }
 }
 
+#if defined(HAS_UDP_SEGMENTATION_OFFLOAD)
+
+/*
+ * Coalesce runs of consecutive datagrams into a single send with UDP_SEGMENT so the kernel performs the
+ * segmentation. Every datagram in a run must be the same length, apart from the last which may be shorter, as
+ * the kernel splits on a fixed segment size and frames must not straddle datagrams. The return value counts
+ * datagrams, not runs, so callers see the same result as for aeron_udp_channel_transport_sendv.
+ */
+static int aeron_udp_channel_transport_sendv_gso(
+    aeron_udp_channel_transport_t *transport,
+    struct sockaddr_storage *address,
+    struct iovec *iov,
+    size_t iov_length,
+    int64_t *bytes_sent)
+{
+    struct mmsghdr msg[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND];
+    size_t segment_count[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND];
+    AERON_DECL_ALIGNED(
+        char buf[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND]
+            [CMSG_SPACE(sizeof(uint16_t)) + AERON_UDP_CHANNEL_TRANSPORT_TX_TIMESTAMP_CMSG_SPACE],
+        sizeof(struct cmsghdr));
+    size_t msg_i = 0;
+    size_t iov_i = 0;
+
+    if (iov_length > AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND)
+    {
+        iov_length = AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND;
+    }
+
+    while (iov_i < iov_length)
+    {
+        const size_t segment_length = iov[iov_i].iov_len;
+        size_t run_length = segment_length;
+        size_t count = 1;
+
+        while (iov_i + count < iov_length &&
+            count < AERON_UDP_CHANNEL_TRANSPORT_GSO_MAX_SEGMENTS &&
+            iov[iov_i + count - 1].iov_len == segment_length &&
+            iov[iov_i + count].iov_len <= segment_length &&
+            run_length + iov[iov_i + count].iov_len <= AERON_MAX_UDP_PAYLOAD_LENGTH)
+        {
+            run_length += iov[iov_i + count].iov_len;
+            count++;
+        }
+
+        msg[msg_i].msg_hdr.msg_name = address;
+        msg[msg_i].msg_hdr.msg_namelen = AERON_ADDR_LEN(address);
+        msg[msg_i].msg_hdr.msg_flags = 0;
+        msg[msg_i].msg_hdr.msg_iov = &iov[iov_i];
+        msg[msg_i].msg_hdr.msg_iovlen = count;
+        msg[msg_i].msg_len = 0;
+
+        if (count > 1)
+        {
+            msg[msg_i].msg_hdr.msg_control = (void *)buf[msg_i];
+            msg[msg_i].msg_hdr.msg_controllen = CMSG_SPACE(sizeof(uint16_t));
+
+            struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg[msg_i].msg_hdr);
+            cmsg->cmsg_level = SOL_UDP;
+            cmsg->cmsg_type = UDP_SEGMENT;
+            cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+            uint16_t gso_size = (uint16_t)segment_length;
+            memcpy(CMSG_DATA(cmsg), &gso_size, sizeof(gso_size));
+        }
+        else
+        {
+            msg[msg_i].msg_hdr.msg_control = NULL;
+            msg[msg_i].msg_hdr.msg_controllen = 0;
+        }
+
+        segment_count[msg_i] = count;
+        iov_i += count;
+        msg_i++;
+    }
+
+    aeron_udp_channel_transport_add_tx_timestamp_control(transport, &msg[0].msg_hdr, buf[0]);
+
+    int num_sent = sendmmsg(transport->fd, msg, msg_i, 0);
+    if (num_sent < 0)
+    {
+        if (EAGAIN == errno || EWOULDBLOCK == errno || ECONNREFUSED == errno || EINTR == errno)
+        {
+            return 0;
+        }
+        else if (EINVAL == errno || EIO == errno)
+        {
+            // The route or device does not support segmentation offload, so stop using it for this transport.
+            transport->offload_flags &= ~AERON_UDP_CHANNEL_TRANSPORT_OFFLOAD_GSO;
+            return aeron_udp_channel_transport_sendv(transport, address, iov, iov_length, bytes_sent);
+        }
+        else
+        {
+            char addr[AERON_NETUTIL_FORMATTED_MAX_LENGTH];
+            aeron_format_source_identity(addr, sizeof(addr), address);
+            AERON_SET_ERR(errno, "%s: address=%s (protocol_family=%i)", "failed to sendmmsg", addr, address->ss_family);
+            return -1;
+        }
+    }
+    else
+    {
+        int datagrams_sent = 0;
+        for (int i = 0; i < num_sent; i++)
+        {
+            *bytes_sent += msg[i].msg_len;
+            datagrams_sent += (int)segment_count[i];
+        }
+
+        return datagrams_sent;
+    }
+}
+
+#endif
+
 #endif
 
 
@@ -632,10 +910,16 @@ int aeron_udp_channel_transport_send(
     int64_t *bytes_sent)
 {
 #if defined(HAVE_SENDMMSG)
-    if (1 == iov_length && NULL != transport->connected_address)
+    if (1 == iov_length && NULL != transport->connected_address && !transport->is_tx_timestamp_requested)
     {
         return aeron_udp_channel_transport_send_connected(transport, iov, bytes_sent);
     }
+#if defined(HAS_UDP_SEGMENTATION_OFFLOAD)
+    else if (iov_length > 1 && (transport->offload_flags & AERON_UDP_CHANNEL_TRANSPORT_OFFLOAD_GSO))
+    {
+        return aeron_udp_channel_transport_sendv_gso(transport, address, iov, iov_length, bytes_sent);
+    }
+#endif
     else
     {
         return aeron_udp_channel_transport_sendv(transport, address, iov, iov_length, bytes_sent);
@@ -686,6 +970,64 @@ int aeron_udp_channel_transport_send(
 #endif
 }
 
+int aeron_udp_channel_transport_recv_tx_timestamp(aeron_udp_channel_transport_t *transport, int64_t *timestamp_ns)
+{
+#if defined(HAS_MEDIA_RCV_TIMESTAMPS)
+    AERON_DECL_ALIGNED(char control[AERON_UDP_CHANNEL_TRANSPORT_TX_TIMESTAMP_CONTROL_LENGTH], sizeof(struct cmsghdr));
+
+    while (true)
+    {
+        struct msghdr msg;
+        msg.msg_name = NULL;
+        msg.msg_namelen = 0;
+        msg.msg_iov = NULL;
+        msg.msg_iovlen = 0;
+        msg.msg_control = (void *)control;
+        msg.msg_controllen = sizeof(control);
+        msg.msg_flags = 0;
+
+        if (recvmsg(transport->fd, &msg, MSG_ERRQUEUE | MSG_DONTWAIT) < 0)
+        {
+            if (EAGAIN == errno || EWOULDBLOCK == errno || EINTR == errno)
+            {
+                return 0;
+            }
+
+            AERON_SET_ERR(errno, "%s", "failed to recvmsg(MSG_ERRQUEUE)");
+            return -1;
+        }
+
+        struct scm_timestamping *timestamping = NULL;
+        struct sock_extended_err *extended_err = NULL;
+
+        for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); NULL != cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg))
+        {
+            if (SOL_SOCKET == cmsg->cmsg_level && SCM_TIMESTAMPING == cmsg->cmsg_type)
+            {
+                timestamping = (struct scm_timestamping *)CMSG_DATA(cmsg);
+            }
+            else if ((SOL_IP == cmsg->cmsg_level && IP_RECVERR == cmsg->cmsg_type) ||
+                (SOL_IPV6 == cmsg->cmsg_level && IPV6_RECVERR == cmsg->cmsg_type))
+            {
+                extended_err = (struct sock_extended_err *)CMSG_DATA(cmsg);
+            }
+        }
+
+        // Anything else on the error queue, e.g. an ICMP error, is not of interest here so is discarded.
+        if (NULL != timestamping &&
+            NULL != extended_err &&
+            ENOMSG == extended_err->ee_errno &&
+            SO_EE_ORIGIN_TIMESTAMPING == extended_err->ee_origin)
+        {
+            *timestamp_ns = (INT64_C(1000) * 1000 * 1000 * timestamping->ts[0].tv_sec) + timestamping->ts[0].tv_nsec;
+            return 1;
+        }
+    }
+#else
+    return 0;
+#endif
+}
+
 int aeron_udp_channel_transport_get_so_rcvbuf(aeron_udp_channel_transport_t *transport, size_t *so_rcvbuf)
 {
     socklen_t len = sizeof(size_t);
@@ -699,6 +1041,36 @@ int aeron_udp_channel_transport_get_so_rcvbuf(aeron_udp_channel_transport_t *tra
     return 0;
 }
 
+int aeron_udp_channel_transport_get_send_queue_length(
+    aeron_udp_channel_transport_t *transport, size_t *send_queue_length, size_t *so_sndbuf)
+{
+#if defined(__linux__)
+    int queued = 0;
+    int sndbuf = 0;
+    socklen_t len = sizeof(sndbuf);
+
+    if (ioctl(transport->fd, SIOCOUTQ, &queued) < 0)
+    {
+        AERON_SET_ERR(errno, "%s", "failed to get SIOCOUTQ");
+        return -1;
+    }
+
+    if (aeron_getsockopt(transport->fd, SOL_SOCKET, SO_SNDBUF, &sndbuf, &len) < 0)
+    {
+        AERON_APPEND_ERR("%s", "failed to get SOL_SOCKET/SO_SNDBUF option");
+        return -1;
+    }
+
+    *send_queue_length = (size_t)queued;
+    *so_sndbuf = (size_t)sndbuf;
+
+    return 0;
+#else
+    AERON_SET_ERR(EINVAL, "%s", "send queue length not supported on this platform");
+    return -1;
+#endif
+}
+
 int aeron_udp_channel_transport_bind_addr_and_port(
     aeron_udp_channel_transport_t *transport, char *buffer, size_t length)
 {
@@ -27,6 +27,16 @@
 #define AERON_UDP_CHANNEL_TRANSPORT_MEDIA_RCV_TIMESTAMP (0x3)
 #define AERON_UDP_CHANNEL_TRANSPORT_CHANNEL_RCV_TIMESTAMP (0x4)
 #define AERON_UDP_CHANNEL_TRANSPORT_CHANNEL_SND_TIMESTAMP (0x8)
+#define AERON_UDP_CHANNEL_TRANSPORT_TX_TIMESTAMP (0x10)
+
+#define AERON_UDP_CHANNEL_TRANSPORT_OFFLOAD_NONE (0x0)
+#define AERON_UDP_CHANNEL_TRANSPORT_OFFLOAD_GSO (0x1)
+#define AERON_UDP_CHANNEL_TRANSPORT_OFFLOAD_GRO (0x2)
+
+#define AERON_UDP_CHANNEL_TRANSPORT_GSO_MAX_SEGMENTS (64)
+#define AERON_UDP_CHANNEL_TRANSPORT_RECV_CONTROL_LENGTH \
+    (CMSG_SPACE(sizeof(struct timespec)) + CMSG_SPACE(sizeof(int)))
+#define AERON_UDP_CHANNEL_TRANSPORT_TX_TIMESTAMP_CONTROL_LENGTH (256)
 
 struct aeron_udp_channel_transport_params_stct
 {
@@ -49,7 +59,10 @@ typedef struct aeron_udp_channel_transport_stct
     void *bindings_clientd;
     void *destination_clientd;
     void *interceptor_clientds[AERON_UDP_CHANNEL_TRANSPORT_MAX_INTERCEPTORS];
+    int64_t *invalid_packets_counter;
     uint32_t timestamp_flags;
+    uint32_t offload_flags;
+    bool is_tx_timestamp_requested;
 }
 aeron_udp_channel_transport_t;
 
@@ -78,6 +91,20 @@ int aeron_udp_channel_transport_recvmmsg(
     aeron_udp_transport_recv_func_t recv_func,
     void *clientd);
 
+/**
+ * Dispatch a received datagram to recv_func. The ancillary data in msg, if any, is searched for a media receive
+ * timestamp and a GRO segment size. When a GRO segment size is present the datagram is split into the individual
+ * datagrams coalesced by the kernel and each is dispatched in turn.
+ */
+void aeron_udp_channel_transport_dispatch(
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *msg,
+    uint8_t *buffer,
+    size_t length,
+    int64_t *bytes_rcved,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd);
+
 int aeron_udp_channel_transport_send(
     aeron_udp_channel_data_paths_t *data_paths,
     aeron_udp_channel_transport_t *transport,
@@ -86,7 +113,18 @@ int aeron_udp_channel_transport_send(
     size_t iov_length,
     int64_t *bytes_sent);
 
+/**
+ * Read the next kernel transmit timestamp from the socket error queue. Timestamps are only generated when the
+ * transport has AERON_UDP_CHANNEL_TRANSPORT_TX_TIMESTAMP set and then only for the first datagram of a send made
+ * while is_tx_timestamp_requested is set, which the send consumes.
+ *
+ * @return 1 if a timestamp was read, 0 if none is available or -1 on error.
+ */
+int aeron_udp_channel_transport_recv_tx_timestamp(aeron_udp_channel_transport_t *transport, int64_t *timestamp_ns);
+
 int aeron_udp_channel_transport_get_so_rcvbuf(aeron_udp_channel_transport_t *transport, size_t *so_rcvbuf);
+int aeron_udp_channel_transport_get_send_queue_length(
+    aeron_udp_channel_transport_t *transport, size_t *send_queue_length, size_t *so_sndbuf);
 int aeron_udp_channel_transport_bind_addr_and_port(
     aeron_udp_channel_transport_t *transport, char *buffer, size_t length);
 
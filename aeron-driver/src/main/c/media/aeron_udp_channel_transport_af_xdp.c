@@ -0,0 +1,1255 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#if defined(HAVE_AF_XDP)
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <net/if.h>
+#include <netinet/ip.h>
+#include <netinet/udp.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/bpf.h>
+#include <linux/if_ether.h>
+#include <linux/if_link.h>
+#include <linux/if_xdp.h>
+
+#include "concurrent/aeron_atomic.h"
+#include "concurrent/aeron_thread.h"
+#include "util/aeron_error.h"
+#include "util/aeron_netutil.h"
+#include "uri/aeron_uri.h"
+#include "aeron_alloc.h"
+#include "aeron_driver_context.h"
+#include "aeron_udp_channel_transport.h"
+#include "aeron_udp_transport_poller.h"
+#include "aeron_udp_channel_transport_af_xdp.h"
+
+#if !defined(AF_XDP)
+#define AF_XDP (44)
+#endif
+
+#if !defined(SOL_XDP)
+#define SOL_XDP (283)
+#endif
+
+#define AERON_CONFIG_GETENV_OR_DEFAULT(e, d) ((NULL == getenv(e)) ? (d) : getenv(e))
+
+#define AERON_AF_XDP_HEADERS_LENGTH (sizeof(struct ethhdr) + sizeof(struct iphdr) + sizeof(struct udphdr))
+#define AERON_AF_XDP_RX_BATCH (64)
+#define AERON_AF_XDP_PORTS_MAP_CAPACITY (1024)
+#define AERON_AF_XDP_DEFAULT_TTL (64)
+
+typedef struct aeron_af_xdp_ring_stct
+{
+    uint32_t *producer;
+    uint32_t *consumer;
+    uint32_t *flags;
+    void *descs;
+    uint32_t mask;
+    uint32_t size;
+    uint32_t cached_producer;
+    uint32_t cached_consumer;
+    void *map;
+    size_t map_length;
+}
+aeron_af_xdp_ring_t;
+
+typedef struct aeron_af_xdp_socket_stct
+{
+    aeron_driver_context_t *context;
+    int ifindex;
+    uint32_t queue_id;
+    int ref_count;
+    int fd;
+    int prog_fd;
+    int link_fd;
+    int xsks_map_fd;
+    int ports_map_fd;
+    uint8_t *umem;
+    size_t umem_length;
+    aeron_af_xdp_ring_t rx;
+    aeron_af_xdp_ring_t fill;
+    aeron_af_xdp_ring_t tx;
+    aeron_af_xdp_ring_t completion;
+    uint64_t *tx_free_frames;
+    uint32_t tx_free_count;
+    uint16_t ip_id;
+    uint8_t src_mac[ETH_ALEN];
+    uint32_t src_addr;
+    struct aeron_af_xdp_socket_stct *next;
+}
+aeron_af_xdp_socket_t;
+
+typedef struct aeron_af_xdp_neighbour_stct
+{
+    uint32_t addr;
+    uint32_t retry_countdown;
+    bool is_resolved;
+    uint8_t mac[ETH_ALEN];
+}
+aeron_af_xdp_neighbour_t;
+
+typedef struct aeron_af_xdp_transport_stct
+{
+    aeron_af_xdp_socket_t *xsk;
+    aeron_udp_channel_transport_affinity_t affinity;
+    uint32_t bound_addr;
+    uint16_t port;
+    uint8_t ttl;
+    bool is_port_registered;
+    size_t neighbour_count;
+    aeron_af_xdp_neighbour_t neighbours[AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_NEIGHBOUR_CAPACITY];
+}
+aeron_af_xdp_transport_t;
+
+static AERON_INIT_ONCE aeron_af_xdp_is_initialized = AERON_INIT_ONCE_VALUE;
+static aeron_mutex_t aeron_af_xdp_sockets_lock;
+static aeron_af_xdp_socket_t *aeron_af_xdp_sockets = NULL;
+static aeron_udp_channel_transport_af_xdp_params_t aeron_af_xdp_params;
+static bool aeron_af_xdp_params_are_valid = false;
+
+static void aeron_udp_channel_transport_af_xdp_load_env(void)
+{
+    aeron_mutex_init(&aeron_af_xdp_sockets_lock, NULL);
+
+    const char *args = AERON_CONFIG_GETENV_OR_DEFAULT(AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_AF_XDP_ARGS_ENV_VAR, "");
+    char *args_dup = strdup(args);
+    if (NULL == args_dup)
+    {
+        return;
+    }
+
+    aeron_af_xdp_params_are_valid = aeron_udp_channel_transport_af_xdp_parse_params(args_dup, &aeron_af_xdp_params) >= 0;
+    aeron_free(args_dup);
+}
+
+int aeron_udp_channel_transport_af_xdp_parse_params(char *args, aeron_udp_channel_transport_af_xdp_params_t *params)
+{
+    memset(params, 0, sizeof(aeron_udp_channel_transport_af_xdp_params_t));
+    params->frame_count = AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_FRAME_COUNT_DEFAULT;
+    params->mode = AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_MODE_SKB;
+
+    if (aeron_uri_parse_params(args, aeron_udp_channel_transport_af_xdp_parse_callback, (void *)params) < 0)
+    {
+        return -1;
+    }
+
+    if ('\0' == params->interface_name[0])
+    {
+        AERON_SET_ERR(EINVAL, "%s", "AF_XDP interface must be specified");
+        return -1;
+    }
+
+    return 0;
+}
+
+int aeron_udp_channel_transport_af_xdp_parse_callback(void *clientd, const char *key, const char *value)
+{
+    aeron_udp_channel_transport_af_xdp_params_t *params = clientd;
+    int result = 0;
+
+    if (strncmp(key, "interface", sizeof("interface")) == 0)
+    {
+        if (strlen(value) >= IF_NAMESIZE)
+        {
+            AERON_SET_ERR(EINVAL, "AF_XDP interface name too long: %s", value);
+            result = -1;
+        }
+        else
+        {
+            strncpy(params->interface_name, value, sizeof(params->interface_name) - 1);
+        }
+    }
+    else if (strncmp(key, "queue", sizeof("queue")) == 0)
+    {
+        errno = 0;
+        char *endptr;
+        params->queue_id = (uint32_t)strtoul(value, &endptr, 10);
+
+        if (errno != 0 || value == endptr)
+        {
+            AERON_SET_ERR(EINVAL, "Could not parse queue %s from: %s:", key, value);
+            result = -1;
+        }
+    }
+    else if (strncmp(key, "frames", sizeof("frames")) == 0)
+    {
+        errno = 0;
+        char *endptr;
+        unsigned long frame_count = strtoul(value, &endptr, 10);
+
+        if (errno != 0 || value == endptr || frame_count < 64 || 0 != (frame_count & (frame_count - 1)))
+        {
+            AERON_SET_ERR(EINVAL, "Could not parse frames %s from: %s: must be a power of 2 >= 64", key, value);
+            result = -1;
+        }
+        else
+        {
+            params->frame_count = (uint32_t)frame_count;
+        }
+    }
+    else if (strncmp(key, "mode", sizeof("mode")) == 0)
+    {
+        if (strncmp(value, "skb", sizeof("skb")) == 0)
+        {
+            params->mode = AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_MODE_SKB;
+        }
+        else if (strncmp(value, "drv", sizeof("drv")) == 0)
+        {
+            params->mode = AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_MODE_DRV;
+        }
+        else if (strncmp(value, "zc", sizeof("zc")) == 0)
+        {
+            params->mode = AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_MODE_ZERO_COPY;
+        }
+        else
+        {
+            AERON_SET_ERR(EINVAL, "Could not parse mode %s from: %s: expected skb, drv or zc", key, value);
+            result = -1;
+        }
+    }
+
+    return result;
+}
+
+static int aeron_af_xdp_bpf(int cmd, union bpf_attr *attr)
+{
+    return (int)syscall(__NR_bpf, cmd, attr, sizeof(union bpf_attr));
+}
+
+static int aeron_af_xdp_map_create(enum bpf_map_type type, uint32_t max_entries)
+{
+    union bpf_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.map_type = type;
+    attr.key_size = sizeof(uint32_t);
+    attr.value_size = sizeof(uint32_t);
+    attr.max_entries = max_entries;
+
+    int fd = aeron_af_xdp_bpf(BPF_MAP_CREATE, &attr);
+    if (fd < 0)
+    {
+        AERON_SET_ERR(errno, "bpf(BPF_MAP_CREATE), map_type=%d", (int)type);
+    }
+
+    return fd;
+}
+
+static int aeron_af_xdp_map_lookup(int map_fd, uint32_t key, uint32_t *value)
+{
+    union bpf_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.map_fd = (uint32_t)map_fd;
+    attr.key = (uint64_t)(uintptr_t)&key;
+    attr.value = (uint64_t)(uintptr_t)value;
+
+    return aeron_af_xdp_bpf(BPF_MAP_LOOKUP_ELEM, &attr);
+}
+
+static int aeron_af_xdp_map_update(int map_fd, uint32_t key, uint32_t value)
+{
+    union bpf_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.map_fd = (uint32_t)map_fd;
+    attr.key = (uint64_t)(uintptr_t)&key;
+    attr.value = (uint64_t)(uintptr_t)&value;
+    attr.flags = BPF_ANY;
+
+    if (aeron_af_xdp_bpf(BPF_MAP_UPDATE_ELEM, &attr) < 0)
+    {
+        AERON_SET_ERR(errno, "bpf(BPF_MAP_UPDATE_ELEM), key=%" PRIu32, key);
+        return -1;
+    }
+
+    return 0;
+}
+
+static int aeron_af_xdp_map_delete(int map_fd, uint32_t key)
+{
+    union bpf_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.map_fd = (uint32_t)map_fd;
+    attr.key = (uint64_t)(uintptr_t)&key;
+
+    if (aeron_af_xdp_bpf(BPF_MAP_DELETE_ELEM, &attr) < 0 && ENOENT != errno)
+    {
+        AERON_SET_ERR(errno, "bpf(BPF_MAP_DELETE_ELEM), key=%" PRIu32, key);
+        return -1;
+    }
+
+    return 0;
+}
+
+#define AERON_BPF_INSN(c, d, s, o, i) { .code = (c), .dst_reg = (d), .src_reg = (s), .off = (o), .imm = (i) }
+#define AERON_BPF_MOV64_REG(d, s) AERON_BPF_INSN(BPF_ALU64 | BPF_MOV | BPF_X, d, s, 0, 0)
+#define AERON_BPF_MOV64_IMM(d, i) AERON_BPF_INSN(BPF_ALU64 | BPF_MOV | BPF_K, d, 0, 0, i)
+#define AERON_BPF_ALU64_IMM(op, d, i) AERON_BPF_INSN(BPF_ALU64 | (op) | BPF_K, d, 0, 0, i)
+#define AERON_BPF_LDX_MEM(sz, d, s, o) AERON_BPF_INSN(BPF_LDX | BPF_MEM | (sz), d, s, o, 0)
+#define AERON_BPF_STX_MEM(sz, d, s, o) AERON_BPF_INSN(BPF_STX | BPF_MEM | (sz), d, s, o, 0)
+#define AERON_BPF_LD_MAP_FD(d, fd) \
+    AERON_BPF_INSN(BPF_LD | BPF_DW | BPF_IMM, d, BPF_PSEUDO_MAP_FD, 0, fd), AERON_BPF_INSN(0, 0, 0, 0, 0)
+#define AERON_BPF_CALL(f) AERON_BPF_INSN(BPF_JMP | BPF_CALL, 0, 0, 0, f)
+#define AERON_BPF_EXIT() AERON_BPF_INSN(BPF_JMP | BPF_EXIT, 0, 0, 0, 0)
+#define AERON_BPF_JMP_TO_PASS (0x7fff)
+#define AERON_BPF_JMP_REG_TO_PASS(op, d, s) AERON_BPF_INSN(BPF_JMP | (op) | BPF_X, d, s, AERON_BPF_JMP_TO_PASS, 0)
+#define AERON_BPF_JMP_IMM_TO_PASS(op, d, i) AERON_BPF_INSN(BPF_JMP | (op) | BPF_K, d, 0, AERON_BPF_JMP_TO_PASS, i)
+
+/*
+ * Redirect unfragmented IPv4 UDP datagrams without IP options, that fit in a UMEM frame and are addressed to a
+ * registered port, to the XDP socket bound to the receive queue. Everything else is passed to the kernel.
+ */
+static int aeron_af_xdp_prog_load(int ports_map_fd, int xsks_map_fd)
+{
+    struct bpf_insn insns[] =
+        {
+            AERON_BPF_MOV64_REG(BPF_REG_6, BPF_REG_1),
+            AERON_BPF_LDX_MEM(BPF_W, BPF_REG_2, BPF_REG_6, offsetof(struct xdp_md, data)),
+            AERON_BPF_LDX_MEM(BPF_W, BPF_REG_3, BPF_REG_6, offsetof(struct xdp_md, data_end)),
+            AERON_BPF_MOV64_REG(BPF_REG_4, BPF_REG_2),
+            AERON_BPF_ALU64_IMM(BPF_ADD, BPF_REG_4, (int32_t)AERON_AF_XDP_HEADERS_LENGTH),
+            AERON_BPF_JMP_REG_TO_PASS(BPF_JGT, BPF_REG_4, BPF_REG_3),
+            AERON_BPF_MOV64_REG(BPF_REG_4, BPF_REG_2),
+            AERON_BPF_ALU64_IMM(BPF_ADD, BPF_REG_4, AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_FRAME_LENGTH),
+            AERON_BPF_JMP_REG_TO_PASS(BPF_JLT, BPF_REG_4, BPF_REG_3),
+            AERON_BPF_LDX_MEM(BPF_H, BPF_REG_5, BPF_REG_2, offsetof(struct ethhdr, h_proto)),
+            AERON_BPF_JMP_IMM_TO_PASS(BPF_JNE, BPF_REG_5, htons(ETH_P_IP)),
+            AERON_BPF_LDX_MEM(BPF_B, BPF_REG_5, BPF_REG_2, sizeof(struct ethhdr)),
+            AERON_BPF_JMP_IMM_TO_PASS(BPF_JNE, BPF_REG_5, 0x45),
+            AERON_BPF_LDX_MEM(BPF_H, BPF_REG_5, BPF_REG_2, sizeof(struct ethhdr) + offsetof(struct iphdr, frag_off)),
+            AERON_BPF_ALU64_IMM(BPF_AND, BPF_REG_5, htons(0x3fff)),
+            AERON_BPF_JMP_IMM_TO_PASS(BPF_JNE, BPF_REG_5, 0),
+            AERON_BPF_LDX_MEM(BPF_B, BPF_REG_5, BPF_REG_2, sizeof(struct ethhdr) + offsetof(struct iphdr, protocol)),
+            AERON_BPF_JMP_IMM_TO_PASS(BPF_JNE, BPF_REG_5, IPPROTO_UDP),
+            AERON_BPF_LDX_MEM(
+                BPF_H, BPF_REG_5, BPF_REG_2, sizeof(struct ethhdr) + sizeof(struct iphdr) + offsetof(struct udphdr, dest)),
+            AERON_BPF_STX_MEM(BPF_W, BPF_REG_10, BPF_REG_5, -4),
+            AERON_BPF_MOV64_REG(BPF_REG_2, BPF_REG_10),
+            AERON_BPF_ALU64_IMM(BPF_ADD, BPF_REG_2, -4),
+            AERON_BPF_LD_MAP_FD(BPF_REG_1, ports_map_fd),
+            AERON_BPF_CALL(BPF_FUNC_map_lookup_elem),
+            AERON_BPF_JMP_IMM_TO_PASS(BPF_JEQ, BPF_REG_0, 0),
+            AERON_BPF_LDX_MEM(BPF_W, BPF_REG_2, BPF_REG_6, offsetof(struct xdp_md, rx_queue_index)),
+            AERON_BPF_LD_MAP_FD(BPF_REG_1, xsks_map_fd),
+            AERON_BPF_MOV64_IMM(BPF_REG_3, XDP_PASS),
+            AERON_BPF_CALL(BPF_FUNC_redirect_map),
+            AERON_BPF_EXIT(),
+            AERON_BPF_MOV64_IMM(BPF_REG_0, XDP_PASS),
+            AERON_BPF_EXIT(),
+        };
+    const size_t insn_count = sizeof(insns) / sizeof(insns[0]);
+    const size_t pass_index = insn_count - 2;
+
+    for (size_t i = 0; i < insn_count; i++)
+    {
+        if (BPF_JMP == BPF_CLASS(insns[i].code) && AERON_BPF_JMP_TO_PASS == insns[i].off)
+        {
+            insns[i].off = (int16_t)(pass_index - i - 1);
+        }
+    }
+
+    union bpf_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.prog_type = BPF_PROG_TYPE_XDP;
+    attr.expected_attach_type = BPF_XDP;
+    attr.insns = (uint64_t)(uintptr_t)insns;
+    attr.insn_cnt = (uint32_t)insn_count;
+    attr.license = (uint64_t)(uintptr_t)"Apache-2.0";
+
+    int fd = aeron_af_xdp_bpf(BPF_PROG_LOAD, &attr);
+    if (fd < 0)
+    {
+        int err = errno;
+        char log[4096] = { 0 };
+        attr.log_buf = (uint64_t)(uintptr_t)log;
+        attr.log_size = sizeof(log);
+        attr.log_level = 1;
+        aeron_af_xdp_bpf(BPF_PROG_LOAD, &attr);
+        AERON_SET_ERR(err, "bpf(BPF_PROG_LOAD): %s", log);
+    }
+
+    return fd;
+}
+
+static int aeron_af_xdp_ring_mmap(
+    aeron_af_xdp_ring_t *ring,
+    int fd,
+    struct xdp_ring_offset *offset,
+    uint32_t size,
+    size_t desc_length,
+    off_t pgoff,
+    const char *name)
+{
+    ring->map_length = offset->desc + (size * desc_length);
+    ring->map = mmap(NULL, ring->map_length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, pgoff);
+    if (MAP_FAILED == ring->map)
+    {
+        ring->map = NULL;
+        AERON_SET_ERR(errno, "mmap of AF_XDP %s ring", name);
+        return -1;
+    }
+
+    ring->producer = (uint32_t *)((uint8_t *)ring->map + offset->producer);
+    ring->consumer = (uint32_t *)((uint8_t *)ring->map + offset->consumer);
+    ring->flags = (uint32_t *)((uint8_t *)ring->map + offset->flags);
+    ring->descs = (uint8_t *)ring->map + offset->desc;
+    ring->size = size;
+    ring->mask = size - 1;
+    ring->cached_producer = *ring->producer;
+    ring->cached_consumer = *ring->consumer;
+
+    return 0;
+}
+
+static void aeron_af_xdp_ring_munmap(aeron_af_xdp_ring_t *ring)
+{
+    if (NULL != ring->map)
+    {
+        munmap(ring->map, ring->map_length);
+        ring->map = NULL;
+    }
+}
+
+static void aeron_af_xdp_socket_delete(aeron_af_xdp_socket_t *xsk)
+{
+    if (xsk->link_fd >= 0)
+    {
+        close(xsk->link_fd);
+    }
+
+    if (xsk->prog_fd >= 0)
+    {
+        close(xsk->prog_fd);
+    }
+
+    if (xsk->xsks_map_fd >= 0)
+    {
+        close(xsk->xsks_map_fd);
+    }
+
+    if (xsk->ports_map_fd >= 0)
+    {
+        close(xsk->ports_map_fd);
+    }
+
+    aeron_af_xdp_ring_munmap(&xsk->rx);
+    aeron_af_xdp_ring_munmap(&xsk->fill);
+    aeron_af_xdp_ring_munmap(&xsk->tx);
+    aeron_af_xdp_ring_munmap(&xsk->completion);
+
+    if (xsk->fd >= 0)
+    {
+        close(xsk->fd);
+    }
+
+    if (NULL != xsk->umem)
+    {
+        munmap(xsk->umem, xsk->umem_length);
+    }
+
+    aeron_free(xsk->tx_free_frames);
+    aeron_free(xsk);
+}
+
+static int aeron_af_xdp_interface_addresses(aeron_af_xdp_socket_t *xsk, const char *interface_name)
+{
+    struct ifreq ifr;
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0)
+    {
+        AERON_SET_ERR(errno, "%s", "socket(AF_INET) for interface lookup");
+        return -1;
+    }
+
+    memset(&ifr, 0, sizeof(ifr));
+    strncpy(ifr.ifr_name, interface_name, IF_NAMESIZE - 1);
+    if (ioctl(fd, SIOCGIFHWADDR, &ifr) < 0)
+    {
+        AERON_SET_ERR(errno, "ioctl(SIOCGIFHWADDR), interface=%s", interface_name);
+        close(fd);
+        return -1;
+    }
+    memcpy(xsk->src_mac, ifr.ifr_hwaddr.sa_data, ETH_ALEN);
+
+    // An interface without an IPv4 address can still send from transports bound to a specific address.
+    memset(&ifr, 0, sizeof(ifr));
+    strncpy(ifr.ifr_name, interface_name, IF_NAMESIZE - 1);
+    ifr.ifr_addr.sa_family = AF_INET;
+    xsk->src_addr = ioctl(fd, SIOCGIFADDR, &ifr) < 0 ? 0 : ((struct sockaddr_in *)&ifr.ifr_addr)->sin_addr.s_addr;
+
+    close(fd);
+    return 0;
+}
+
+static int aeron_af_xdp_socket_create(
+    aeron_af_xdp_socket_t **xskp,
+    aeron_driver_context_t *context,
+    int ifindex,
+    const aeron_udp_channel_transport_af_xdp_params_t *params)
+{
+    aeron_af_xdp_socket_t *xsk = NULL;
+    const uint32_t ring_size = params->frame_count / 2;
+
+    if (aeron_alloc((void **)&xsk, sizeof(aeron_af_xdp_socket_t)) < 0)
+    {
+        AERON_APPEND_ERR("%s", "failed to allocate AF_XDP socket");
+        return -1;
+    }
+
+    xsk->context = context;
+    xsk->ifindex = ifindex;
+    xsk->queue_id = params->queue_id;
+    xsk->ref_count = 0;
+    xsk->fd = -1;
+    xsk->prog_fd = -1;
+    xsk->link_fd = -1;
+    xsk->xsks_map_fd = -1;
+    xsk->ports_map_fd = -1;
+
+    if (aeron_af_xdp_interface_addresses(xsk, params->interface_name) < 0)
+    {
+        goto error;
+    }
+
+    if ((xsk->fd = socket(AF_XDP, SOCK_RAW, 0)) < 0)
+    {
+        AERON_SET_ERR(errno, "%s", "socket(AF_XDP)");
+        goto error;
+    }
+
+    xsk->umem_length = (size_t)params->frame_count * AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_FRAME_LENGTH;
+    xsk->umem = mmap(NULL, xsk->umem_length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (MAP_FAILED == xsk->umem)
+    {
+        xsk->umem = NULL;
+        AERON_SET_ERR(errno, "mmap of AF_XDP UMEM, length=%" PRIu64, (uint64_t)xsk->umem_length);
+        goto error;
+    }
+
+    struct xdp_umem_reg umem_reg;
+    memset(&umem_reg, 0, sizeof(umem_reg));
+    umem_reg.addr = (uint64_t)(uintptr_t)xsk->umem;
+    umem_reg.len = xsk->umem_length;
+    umem_reg.chunk_size = AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_FRAME_LENGTH;
+    umem_reg.headroom = 0;
+
+    if (setsockopt(xsk->fd, SOL_XDP, XDP_UMEM_REG, &umem_reg, sizeof(umem_reg)) < 0)
+    {
+        AERON_SET_ERR(errno, "%s", "setsockopt(XDP_UMEM_REG)");
+        goto error;
+    }
+
+    if (setsockopt(xsk->fd, SOL_XDP, XDP_UMEM_FILL_RING, &ring_size, sizeof(ring_size)) < 0 ||
+        setsockopt(xsk->fd, SOL_XDP, XDP_UMEM_COMPLETION_RING, &ring_size, sizeof(ring_size)) < 0 ||
+        setsockopt(xsk->fd, SOL_XDP, XDP_RX_RING, &ring_size, sizeof(ring_size)) < 0 ||
+        setsockopt(xsk->fd, SOL_XDP, XDP_TX_RING, &ring_size, sizeof(ring_size)) < 0)
+    {
+        AERON_SET_ERR(errno, "setsockopt of AF_XDP ring sizes, size=%" PRIu32, ring_size);
+        goto error;
+    }
+
+    struct xdp_mmap_offsets offsets;
+    socklen_t offsets_length = sizeof(offsets);
+    if (getsockopt(xsk->fd, SOL_XDP, XDP_MMAP_OFFSETS, &offsets, &offsets_length) < 0)
+    {
+        AERON_SET_ERR(errno, "%s", "getsockopt(XDP_MMAP_OFFSETS)");
+        goto error;
+    }
+
+    if (aeron_af_xdp_ring_mmap(
+        &xsk->rx, xsk->fd, &offsets.rx, ring_size, sizeof(struct xdp_desc), XDP_PGOFF_RX_RING, "rx") < 0 ||
+        aeron_af_xdp_ring_mmap(
+        &xsk->tx, xsk->fd, &offsets.tx, ring_size, sizeof(struct xdp_desc), XDP_PGOFF_TX_RING, "tx") < 0 ||
+        aeron_af_xdp_ring_mmap(
+        &xsk->fill, xsk->fd, &offsets.fr, ring_size, sizeof(uint64_t), XDP_UMEM_PGOFF_FILL_RING, "fill") < 0 ||
+        aeron_af_xdp_ring_mmap(
+        &xsk->completion, xsk->fd, &offsets.cr, ring_size, sizeof(uint64_t), XDP_UMEM_PGOFF_COMPLETION_RING, "completion") < 0)
+    {
+        goto error;
+    }
+
+    // The first half of the UMEM is handed to the kernel for receiving, the second half is kept for sending.
+    uint64_t *fill_addrs = (uint64_t *)xsk->fill.descs;
+    for (uint32_t i = 0; i < ring_size; i++)
+    {
+        fill_addrs[i] = (uint64_t)i * AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_FRAME_LENGTH;
+    }
+    xsk->fill.cached_producer += ring_size;
+    AERON_PUT_ORDERED(*xsk->fill.producer, xsk->fill.cached_producer);
+
+    if (aeron_alloc((void **)&xsk->tx_free_frames, ring_size * sizeof(uint64_t)) < 0)
+    {
+        AERON_APPEND_ERR("%s", "failed to allocate AF_XDP TX frames");
+        goto error;
+    }
+
+    for (uint32_t i = 0; i < ring_size; i++)
+    {
+        xsk->tx_free_frames[i] = (uint64_t)(ring_size + i) * AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_FRAME_LENGTH;
+    }
+    xsk->tx_free_count = ring_size;
+
+    struct sockaddr_xdp sxdp;
+    memset(&sxdp, 0, sizeof(sxdp));
+    sxdp.sxdp_family = AF_XDP;
+    sxdp.sxdp_ifindex = (uint32_t)ifindex;
+    sxdp.sxdp_queue_id = params->queue_id;
+    sxdp.sxdp_flags = XDP_USE_NEED_WAKEUP;
+    if (AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_MODE_SKB == params->mode)
+    {
+        sxdp.sxdp_flags |= XDP_COPY;
+    }
+    else if (AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_MODE_ZERO_COPY == params->mode)
+    {
+        sxdp.sxdp_flags |= XDP_ZEROCOPY;
+    }
+
+    if (bind(xsk->fd, (struct sockaddr *)&sxdp, sizeof(sxdp)) < 0)
+    {
+        AERON_SET_ERR(
+            errno, "bind of AF_XDP socket, interface=%s, queue=%" PRIu32, params->interface_name, params->queue_id);
+        goto error;
+    }
+
+    if ((xsk->ports_map_fd = aeron_af_xdp_map_create(BPF_MAP_TYPE_HASH, AERON_AF_XDP_PORTS_MAP_CAPACITY)) < 0 ||
+        (xsk->xsks_map_fd = aeron_af_xdp_map_create(BPF_MAP_TYPE_XSKMAP, params->queue_id + 1)) < 0)
+    {
+        goto error;
+    }
+
+    if (aeron_af_xdp_map_update(xsk->xsks_map_fd, params->queue_id, (uint32_t)xsk->fd) < 0)
+    {
+        goto error;
+    }
+
+    if ((xsk->prog_fd = aeron_af_xdp_prog_load(xsk->ports_map_fd, xsk->xsks_map_fd)) < 0)
+    {
+        goto error;
+    }
+
+    union bpf_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.link_create.prog_fd = (uint32_t)xsk->prog_fd;
+    attr.link_create.target_ifindex = (uint32_t)ifindex;
+    attr.link_create.attach_type = BPF_XDP;
+    attr.link_create.flags = AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_MODE_SKB == params->mode ?
+        XDP_FLAGS_SKB_MODE : XDP_FLAGS_DRV_MODE;
+
+    if ((xsk->link_fd = aeron_af_xdp_bpf(BPF_LINK_CREATE, &attr)) < 0)
+    {
+        AERON_SET_ERR(errno, "bpf(BPF_LINK_CREATE) of XDP program, interface=%s", params->interface_name);
+        goto error;
+    }
+
+    *xskp = xsk;
+    return 0;
+
+error:
+    aeron_af_xdp_socket_delete(xsk);
+    return -1;
+}
+
+static aeron_af_xdp_socket_t *aeron_af_xdp_socket_acquire(aeron_driver_context_t *context)
+{
+    const aeron_udp_channel_transport_af_xdp_params_t *params = &aeron_af_xdp_params;
+    aeron_af_xdp_socket_t *xsk = NULL;
+
+    // Interface indexes are only unique within a network namespace, and each driver has its own XDP socket.
+    int ifindex = (int)if_nametoindex(params->interface_name);
+    if (0 == ifindex)
+    {
+        AERON_SET_ERR(errno, "if_nametoindex, interface=%s", params->interface_name);
+        return NULL;
+    }
+
+    aeron_mutex_lock(&aeron_af_xdp_sockets_lock);
+
+    for (aeron_af_xdp_socket_t *existing = aeron_af_xdp_sockets; NULL != existing; existing = existing->next)
+    {
+        if (existing->context == context && existing->ifindex == ifindex && existing->queue_id == params->queue_id)
+        {
+            xsk = existing;
+            break;
+        }
+    }
+
+    if (NULL == xsk)
+    {
+        if (aeron_af_xdp_socket_create(&xsk, context, ifindex, params) < 0)
+        {
+            aeron_mutex_unlock(&aeron_af_xdp_sockets_lock);
+            return NULL;
+        }
+
+        xsk->next = aeron_af_xdp_sockets;
+        aeron_af_xdp_sockets = xsk;
+    }
+
+    xsk->ref_count++;
+    aeron_mutex_unlock(&aeron_af_xdp_sockets_lock);
+
+    return xsk;
+}
+
+static void aeron_af_xdp_socket_release(aeron_af_xdp_socket_t *xsk)
+{
+    aeron_mutex_lock(&aeron_af_xdp_sockets_lock);
+
+    if (0 == --xsk->ref_count)
+    {
+        aeron_af_xdp_socket_t **prev = &aeron_af_xdp_sockets;
+        while (*prev != xsk)
+        {
+            prev = &(*prev)->next;
+        }
+        *prev = xsk->next;
+
+        aeron_af_xdp_socket_delete(xsk);
+    }
+
+    aeron_mutex_unlock(&aeron_af_xdp_sockets_lock);
+}
+
+static int aeron_af_xdp_register_port(aeron_af_xdp_transport_t *state)
+{
+    uint32_t count = 0;
+    if (aeron_af_xdp_map_lookup(state->xsk->ports_map_fd, state->port, &count) < 0)
+    {
+        count = 0;
+    }
+
+    if (aeron_af_xdp_map_update(state->xsk->ports_map_fd, state->port, count + 1) < 0)
+    {
+        return -1;
+    }
+
+    state->is_port_registered = true;
+    return 0;
+}
+
+static int aeron_af_xdp_unregister_port(aeron_af_xdp_transport_t *state)
+{
+    uint32_t count = 0;
+    if (!state->is_port_registered)
+    {
+        return 0;
+    }
+
+    state->is_port_registered = false;
+    if (aeron_af_xdp_map_lookup(state->xsk->ports_map_fd, state->port, &count) < 0 || count <= 1)
+    {
+        return aeron_af_xdp_map_delete(state->xsk->ports_map_fd, state->port);
+    }
+
+    return aeron_af_xdp_map_update(state->xsk->ports_map_fd, state->port, count - 1);
+}
+
+int aeron_udp_channel_transport_af_xdp_init(
+    aeron_udp_channel_transport_t *transport,
+    struct sockaddr_storage *bind_addr,
+    struct sockaddr_storage *multicast_if_addr,
+    struct sockaddr_storage *connect_addr,
+    aeron_udp_channel_transport_params_t *params,
+    aeron_driver_context_t *context,
+    aeron_udp_channel_transport_affinity_t affinity)
+{
+    aeron_af_xdp_transport_t *state = NULL;
+
+    if (aeron_udp_channel_transport_init(
+        transport, bind_addr, multicast_if_addr, connect_addr, params, context, affinity) < 0)
+    {
+        return -1;
+    }
+
+    // IPv6 and the conductor's name resolution traffic stay on the kernel stack.
+    if (AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_CONDUCTOR == affinity || AF_INET != bind_addr->ss_family)
+    {
+        return 0;
+    }
+
+    (void)aeron_thread_once(&aeron_af_xdp_is_initialized, aeron_udp_channel_transport_af_xdp_load_env);
+    if (!aeron_af_xdp_params_are_valid)
+    {
+        AERON_SET_ERR(
+            EINVAL, "invalid or missing %s", AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_AF_XDP_ARGS_ENV_VAR);
+        goto error;
+    }
+
+    // The rings of the shared socket are used without locking, so only one receiver and one sender agent may use them.
+    if (AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER == affinity && context->receiver_count > 1)
+    {
+        AERON_SET_ERR(
+            EINVAL, "AF_XDP bindings require a single receiver, receiver_count=%" PRIu32, context->receiver_count);
+        goto error;
+    }
+
+    if (AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_SENDER == affinity && context->sender_count > 1)
+    {
+        AERON_SET_ERR(
+            EINVAL, "AF_XDP bindings require a single sender, sender_count=%" PRIu32, context->sender_count);
+        goto error;
+    }
+
+    if (aeron_alloc((void **)&state, sizeof(aeron_af_xdp_transport_t)) < 0)
+    {
+        AERON_APPEND_ERR("%s", "failed to allocate AF_XDP transport");
+        goto error;
+    }
+
+    struct sockaddr_in local_addr;
+    socklen_t local_addr_length = sizeof(local_addr);
+    aeron_socket_t local_fd = AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER == affinity ?
+        transport->recv_fd : transport->fd;
+    if (getsockname(local_fd, (struct sockaddr *)&local_addr, &local_addr_length) < 0)
+    {
+        AERON_SET_ERR(errno, "%s", "getsockname for AF_XDP transport");
+        goto error;
+    }
+
+    state->affinity = affinity;
+    state->bound_addr = local_addr.sin_addr.s_addr;
+    state->port = local_addr.sin_port;
+    state->ttl = params->ttl > 0 ? params->ttl : AERON_AF_XDP_DEFAULT_TTL;
+
+    if (NULL == (state->xsk = aeron_af_xdp_socket_acquire(context)))
+    {
+        goto error;
+    }
+
+    if (AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER == affinity && aeron_af_xdp_register_port(state) < 0)
+    {
+        aeron_af_xdp_socket_release(state->xsk);
+        goto error;
+    }
+
+    transport->bindings_clientd = state;
+    return 0;
+
+error:
+    aeron_free(state);
+    aeron_udp_channel_transport_close(transport);
+    return -1;
+}
+
+int aeron_udp_channel_transport_af_xdp_close(aeron_udp_channel_transport_t *transport)
+{
+    aeron_af_xdp_transport_t *state = transport->bindings_clientd;
+    int result = 0;
+
+    if (NULL != state)
+    {
+        result = aeron_af_xdp_unregister_port(state);
+        aeron_af_xdp_socket_release(state->xsk);
+        aeron_free(state);
+        transport->bindings_clientd = NULL;
+    }
+
+    if (aeron_udp_channel_transport_close(transport) < 0)
+    {
+        result = -1;
+    }
+
+    return result;
+}
+
+static bool aeron_af_xdp_neighbour_resolve(aeron_af_xdp_neighbour_t *neighbour, int ifindex)
+{
+    char interface_name[IF_NAMESIZE];
+    char line[256];
+    bool is_resolved = false;
+
+    if (NULL == if_indextoname((unsigned int)ifindex, interface_name))
+    {
+        return false;
+    }
+
+    // /proc/net follows the network namespace of the main thread, which need not be that of the sending thread.
+    FILE *arp = fopen("/proc/thread-self/net/arp", "r");
+    if (NULL == arp && NULL == (arp = fopen("/proc/net/arp", "r")))
+    {
+        return false;
+    }
+
+    while (!is_resolved && NULL != fgets(line, sizeof(line), arp))
+    {
+        char ip[64], mac[32], mask[32], device[IF_NAMESIZE + 1];
+        unsigned int hw_type, flags;
+        struct in_addr addr;
+        unsigned int octets[ETH_ALEN];
+
+        if (6 == sscanf(line, "%63s 0x%x 0x%x %31s %31s %16s", ip, &hw_type, &flags, mac, mask, device) &&
+            0 != (flags & 0x2) &&
+            0 == strcmp(device, interface_name) &&
+            1 == inet_pton(AF_INET, ip, &addr) &&
+            addr.s_addr == neighbour->addr &&
+            ETH_ALEN == sscanf(
+                mac, "%x:%x:%x:%x:%x:%x", &octets[0], &octets[1], &octets[2], &octets[3], &octets[4], &octets[5]))
+        {
+            for (int i = 0; i < ETH_ALEN; i++)
+            {
+                neighbour->mac[i] = (uint8_t)octets[i];
+            }
+            is_resolved = true;
+        }
+    }
+
+    fclose(arp);
+    return is_resolved;
+}
+
+/*
+ * Find the hardware address for a destination. Multicast addresses map directly, unicast destinations are looked
+ * up in the kernel neighbour table, which the kernel populates as it sends on behalf of unresolved destinations.
+ * Only on-link destinations are supported, a destination behind a gateway never resolves and stays on the kernel.
+ */
+static aeron_af_xdp_neighbour_t *aeron_af_xdp_neighbour_find(aeron_af_xdp_transport_t *state, uint32_t addr)
+{
+    aeron_af_xdp_neighbour_t *neighbour = NULL;
+
+    for (size_t i = 0; i < state->neighbour_count; i++)
+    {
+        if (state->neighbours[i].addr == addr)
+        {
+            neighbour = &state->neighbours[i];
+            break;
+        }
+    }
+
+    if (NULL == neighbour)
+    {
+        if (state->neighbour_count >= AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_NEIGHBOUR_CAPACITY)
+        {
+            return NULL;
+        }
+
+        neighbour = &state->neighbours[state->neighbour_count++];
+        neighbour->addr = addr;
+        neighbour->is_resolved = false;
+        neighbour->retry_countdown = 1;
+
+        const uint32_t host_addr = ntohl(addr);
+        if (IN_MULTICAST(host_addr))
+        {
+            neighbour->mac[0] = 0x01;
+            neighbour->mac[1] = 0x00;
+            neighbour->mac[2] = 0x5e;
+            neighbour->mac[3] = (uint8_t)((host_addr >> 16) & 0x7f);
+            neighbour->mac[4] = (uint8_t)((host_addr >> 8) & 0xff);
+            neighbour->mac[5] = (uint8_t)(host_addr & 0xff);
+            neighbour->is_resolved = true;
+        }
+    }
+
+    if (!neighbour->is_resolved && 0 == --neighbour->retry_countdown)
+    {
+        neighbour->retry_countdown = AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_NEIGHBOUR_RETRY_SENDS;
+        neighbour->is_resolved = aeron_af_xdp_neighbour_resolve(neighbour, state->xsk->ifindex);
+    }
+
+    return neighbour->is_resolved ? neighbour : NULL;
+}
+
+static void aeron_af_xdp_reap_completions(aeron_af_xdp_socket_t *xsk)
+{
+    uint32_t producer;
+    AERON_GET_VOLATILE(producer, *xsk->completion.producer);
+
+    uint32_t consumer = xsk->completion.cached_consumer;
+    if (producer == consumer)
+    {
+        return;
+    }
+
+    const uint64_t *addrs = (const uint64_t *)xsk->completion.descs;
+    for (; consumer != producer; consumer++)
+    {
+        xsk->tx_free_frames[xsk->tx_free_count++] = addrs[consumer & xsk->completion.mask];
+    }
+
+    xsk->completion.cached_consumer = consumer;
+    AERON_PUT_ORDERED(*xsk->completion.consumer, consumer);
+}
+
+static uint16_t aeron_af_xdp_ip_checksum(const struct iphdr *ip)
+{
+    const uint16_t *words = (const uint16_t *)ip;
+    uint32_t sum = 0;
+
+    for (size_t i = 0; i < sizeof(struct iphdr) / sizeof(uint16_t); i++)
+    {
+        sum += words[i];
+    }
+
+    while (sum >> 16)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    return (uint16_t)~sum;
+}
+
+int aeron_udp_channel_transport_af_xdp_send(
+    aeron_udp_channel_data_paths_t *data_paths,
+    aeron_udp_channel_transport_t *transport,
+    struct sockaddr_storage *address,
+    struct iovec *iov,
+    size_t iov_length,
+    int64_t *bytes_sent)
+{
+    aeron_af_xdp_transport_t *state = transport->bindings_clientd;
+    aeron_af_xdp_neighbour_t *neighbour;
+    struct sockaddr_in *dest = (struct sockaddr_in *)address;
+
+    if (NULL == state ||
+        AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_SENDER != state->affinity ||
+        AF_INET != address->ss_family ||
+        NULL == (neighbour = aeron_af_xdp_neighbour_find(state, dest->sin_addr.s_addr)))
+    {
+        return aeron_udp_channel_transport_send(data_paths, transport, address, iov, iov_length, bytes_sent);
+    }
+
+    aeron_af_xdp_socket_t *xsk = state->xsk;
+    const uint32_t src_addr = 0 != state->bound_addr ? state->bound_addr : xsk->src_addr;
+
+    for (size_t i = 0; i < iov_length; i++)
+    {
+        if (iov[i].iov_len + AERON_AF_XDP_HEADERS_LENGTH > AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_FRAME_LENGTH)
+        {
+            return aeron_udp_channel_transport_send(data_paths, transport, address, iov, iov_length, bytes_sent);
+        }
+    }
+
+    aeron_af_xdp_reap_completions(xsk);
+
+    uint32_t consumer;
+    AERON_GET_VOLATILE(consumer, *xsk->tx.consumer);
+
+    uint32_t producer = xsk->tx.cached_producer;
+    struct xdp_desc *descs = (struct xdp_desc *)xsk->tx.descs;
+    int sent = 0;
+
+    for (size_t i = 0; i < iov_length; i++)
+    {
+        if (0 == xsk->tx_free_count || (producer - consumer) >= xsk->tx.size)
+        {
+            break;
+        }
+
+        const uint64_t frame_addr = xsk->tx_free_frames[--xsk->tx_free_count];
+        uint8_t *frame = xsk->umem + frame_addr;
+        const size_t length = iov[i].iov_len;
+
+        struct ethhdr *eth = (struct ethhdr *)frame;
+        memcpy(eth->h_dest, neighbour->mac, ETH_ALEN);
+        memcpy(eth->h_source, xsk->src_mac, ETH_ALEN);
+        eth->h_proto = htons(ETH_P_IP);
+
+        struct iphdr *ip = (struct iphdr *)(frame + sizeof(struct ethhdr));
+        ip->version = 4;
+        ip->ihl = 5;
+        ip->tos = 0;
+        ip->tot_len = htons((uint16_t)(sizeof(struct iphdr) + sizeof(struct udphdr) + length));
+        ip->id = htons(xsk->ip_id++);
+        ip->frag_off = htons(0x4000);
+        ip->ttl = state->ttl;
+        ip->protocol = IPPROTO_UDP;
+        ip->check = 0;
+        ip->saddr = src_addr;
+        ip->daddr = dest->sin_addr.s_addr;
+        ip->check = aeron_af_xdp_ip_checksum(ip);
+
+        // A zero UDP checksum is valid for IPv4 and means no checksum was computed.
+        struct udphdr *udp = (struct udphdr *)(frame + sizeof(struct ethhdr) + sizeof(struct iphdr));
+        udp->source = state->port;
+        udp->dest = dest->sin_port;
+        udp->len = htons((uint16_t)(sizeof(struct udphdr) + length));
+        udp->check = 0;
+
+        memcpy(frame + AERON_AF_XDP_HEADERS_LENGTH, iov[i].iov_base, length);
+
+        struct xdp_desc *desc = &descs[producer & xsk->tx.mask];
+        desc->addr = frame_addr;
+        desc->len = (uint32_t)(AERON_AF_XDP_HEADERS_LENGTH + length);
+        desc->options = 0;
+
+        producer++;
+        sent++;
+        *bytes_sent += (int64_t)length;
+    }
+
+    if (sent > 0)
+    {
+        xsk->tx.cached_producer = producer;
+        AERON_PUT_ORDERED(*xsk->tx.producer, producer);
+
+        uint32_t flags;
+        AERON_GET_VOLATILE(flags, *xsk->tx.flags);
+        if (0 != (flags & XDP_RING_NEED_WAKEUP) && sendto(xsk->fd, NULL, 0, MSG_DONTWAIT, NULL, 0) < 0)
+        {
+            int err = errno;
+            if (EAGAIN != err && EBUSY != err && ENOBUFS != err && ENETDOWN != err)
+            {
+                AERON_SET_ERR(err, "sendto of AF_XDP socket, fd=%d", xsk->fd);
+                return -1;
+            }
+        }
+    }
+
+    return sent;
+}
+
+static int aeron_af_xdp_socket_poll(
+    aeron_af_xdp_socket_t *xsk,
+    aeron_udp_transport_poller_t *poller,
+    int64_t *bytes_rcved,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd)
+{
+    uint32_t producer;
+    AERON_GET_VOLATILE(producer, *xsk->rx.producer);
+
+    uint32_t consumer = xsk->rx.cached_consumer;
+    uint32_t available = producer - consumer;
+    if (0 == available)
+    {
+        return 0;
+    }
+
+    if (available > AERON_AF_XDP_RX_BATCH)
+    {
+        available = AERON_AF_XDP_RX_BATCH;
+    }
+
+    const struct xdp_desc *descs = (const struct xdp_desc *)xsk->rx.descs;
+    uint64_t *fill_addrs = (uint64_t *)xsk->fill.descs;
+    uint32_t fill_producer = xsk->fill.cached_producer;
+    int work_count = 0;
+
+    for (uint32_t i = 0; i < available; i++, consumer++)
+    {
+        const struct xdp_desc *desc = &descs[consumer & xsk->rx.mask];
+        uint8_t *frame = xsk->umem + desc->addr;
+
+        if (desc->len >= AERON_AF_XDP_HEADERS_LENGTH)
+        {
+            const struct iphdr *ip = (const struct iphdr *)(frame + sizeof(struct ethhdr));
+            const struct udphdr *udp = (const struct udphdr *)(frame + sizeof(struct ethhdr) + sizeof(struct iphdr));
+            const size_t udp_length = ntohs(udp->len);
+
+            if (udp_length >= sizeof(struct udphdr) &&
+                udp_length <= desc->len - sizeof(struct ethhdr) - sizeof(struct iphdr))
+            {
+                for (size_t j = 0, length = poller->transports.length; j < length; j++)
+                {
+                    aeron_udp_channel_transport_t *transport = poller->transports.array[j].transport;
+                    aeron_af_xdp_transport_t *state = transport->bindings_clientd;
+
+                    if (NULL != state &&
+                        state->port == udp->dest &&
+                        (0 == state->bound_addr || state->bound_addr == ip->daddr))
+                    {
+                        struct sockaddr_storage src_addr;
+                        struct sockaddr_in *src_in = (struct sockaddr_in *)&src_addr;
+                        memset(&src_addr, 0, sizeof(struct sockaddr_in));
+                        src_in->sin_family = AF_INET;
+                        src_in->sin_addr.s_addr = ip->saddr;
+                        src_in->sin_port = udp->source;
+
+                        const size_t payload_length = udp_length - sizeof(struct udphdr);
+                        recv_func(
+                            transport->data_paths,
+                            transport,
+                            clientd,
+                            transport->dispatch_clientd,
+                            transport->destination_clientd,
+                            frame + AERON_AF_XDP_HEADERS_LENGTH,
+                            payload_length,
+                            &src_addr,
+                            NULL);
+                        *bytes_rcved += (int64_t)payload_length;
+                        work_count++;
+                        break;
+                    }
+                }
+            }
+        }
+
+        fill_addrs[fill_producer++ & xsk->fill.mask] =
+            desc->addr & ~((uint64_t)AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_FRAME_LENGTH - 1);
+    }
+
+    xsk->rx.cached_consumer = consumer;
+    AERON_PUT_ORDERED(*xsk->rx.consumer, consumer);
+
+    xsk->fill.cached_producer = fill_producer;
+    AERON_PUT_ORDERED(*xsk->fill.producer, fill_producer);
+
+    uint32_t flags;
+    AERON_GET_VOLATILE(flags, *xsk->fill.flags);
+    if (0 != (flags & XDP_RING_NEED_WAKEUP))
+    {
+        recvfrom(xsk->fd, NULL, 0, MSG_DONTWAIT, NULL, NULL);
+    }
+
+    return work_count;
+}
+
+int aeron_udp_transport_poller_af_xdp_poll(
+    aeron_udp_transport_poller_t *poller,
+    struct mmsghdr *msgvec,
+    size_t vlen,
+    int64_t *bytes_rcved,
+    aeron_udp_transport_recv_func_t recv_func,
+    aeron_udp_channel_transport_recvmmsg_func_t recvmmsg_func,
+    void *clientd)
+{
+    aeron_af_xdp_socket_t *polled_xsk = NULL;
+
+    int work_count = aeron_udp_transport_poller_poll(
+        poller, msgvec, vlen, bytes_rcved, recv_func, recvmmsg_func, clientd);
+    if (work_count < 0)
+    {
+        return work_count;
+    }
+
+    for (size_t i = 0, length = poller->transports.length; i < length; i++)
+    {
+        aeron_af_xdp_transport_t *state = poller->transports.array[i].transport->bindings_clientd;
+
+        if (NULL != state &&
+            AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER == state->affinity &&
+            state->xsk != polled_xsk)
+        {
+            polled_xsk = state->xsk;
+            work_count += aeron_af_xdp_socket_poll(polled_xsk, poller, bytes_rcved, recv_func, clientd);
+        }
+    }
+
+    return work_count;
+}
+
+#endif
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_H
+#define AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_H
+
+#include "aeron_udp_channel_transport_bindings.h"
+
+/*
+ * AF_XDP based bindings for UDP channel transports. Sockets are set up exactly as for the default bindings, so
+ * ports are reserved and anything the XDP program does not redirect is still delivered through the kernel. In
+ * addition a single XDP socket is opened per driver on the configured interface and queue:
+ *
+ * - an XDP program redirects IPv4 UDP datagrams addressed to the ports of receiver transports into the socket's
+ *   RX ring, and the receiver poller dispatches them directly from the UMEM frames.
+ * - sender transports build the Ethernet, IPv4 and UDP headers in front of each datagram in a UMEM frame and
+ *   transmit through the socket's TX ring once the next hop hardware address has been learnt from the kernel
+ *   neighbour table. Until then, and for IPv6 destinations, sends go through the kernel.
+ *
+ * The RX and fill rings are only used by the receiver and the TX and completion rings only by the sender, so the
+ * socket can be shared between the two agents without locking. Configured with
+ * AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_AF_XDP_ARGS, e.g. "interface=eth0|queue=0|mode=skb".
+ */
+
+#define AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_AF_XDP_ARGS_ENV_VAR "AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_AF_XDP_ARGS"
+
+#define AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_FRAME_LENGTH (4096)
+#define AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_FRAME_COUNT_DEFAULT (4096)
+#define AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_NEIGHBOUR_CAPACITY (8)
+#define AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_NEIGHBOUR_RETRY_SENDS (256)
+
+typedef enum aeron_udp_channel_transport_af_xdp_mode_en
+{
+    AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_MODE_SKB,
+    AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_MODE_DRV,
+    AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_MODE_ZERO_COPY
+}
+aeron_udp_channel_transport_af_xdp_mode_t;
+
+typedef struct aeron_udp_channel_transport_af_xdp_params_stct
+{
+    char interface_name[64];
+    uint32_t queue_id;
+    uint32_t frame_count;
+    aeron_udp_channel_transport_af_xdp_mode_t mode;
+}
+aeron_udp_channel_transport_af_xdp_params_t;
+
+int aeron_udp_channel_transport_af_xdp_parse_params(char *args, aeron_udp_channel_transport_af_xdp_params_t *params);
+
+int aeron_udp_channel_transport_af_xdp_parse_callback(void *clientd, const char *key, const char *value);
+
+int aeron_udp_channel_transport_af_xdp_init(
+    aeron_udp_channel_transport_t *transport,
+    struct sockaddr_storage *bind_addr,
+    struct sockaddr_storage *multicast_if_addr,
+    struct sockaddr_storage *connect_addr,
+    aeron_udp_channel_transport_params_t *params,
+    aeron_driver_context_t *context,
+    aeron_udp_channel_transport_affinity_t affinity);
+
+int aeron_udp_channel_transport_af_xdp_close(aeron_udp_channel_transport_t *transport);
+
+int aeron_udp_channel_transport_af_xdp_send(
+    aeron_udp_channel_data_paths_t *data_paths,
+    aeron_udp_channel_transport_t *transport,
+    struct sockaddr_storage *address,
+    struct iovec *iov,
+    size_t iov_length,
+    int64_t *bytes_sent);
+
+int aeron_udp_transport_poller_af_xdp_poll(
+    aeron_udp_transport_poller_t *poller,
+    struct mmsghdr *msgvec,
+    size_t vlen,
+    int64_t *bytes_rcved,
+    aeron_udp_transport_recv_func_t recv_func,
+    aeron_udp_channel_transport_recvmmsg_func_t recvmmsg_func,
+    void *clientd);
+
+#endif //AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_H
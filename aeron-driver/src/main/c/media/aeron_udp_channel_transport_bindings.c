@@ -30,10 +30,19 @@
 #include "util/aeron_symbol_table.h"
 #include "aeron_udp_channel_transport_loss.h"
 #include "aeron_udp_channel_transport_fixed_loss.h"
+#include "aeron_udp_channel_transport_netem.h"
 #include "aeron_udp_channel_transport_bindings.h"
 #include "aeron_udp_channel_transport.h"
 #include "aeron_udp_transport_poller.h"
 
+#if defined(HAVE_IO_URING)
+#include "aeron_udp_channel_transport_io_uring.h"
+#endif
+
+#if defined(HAVE_AF_XDP)
+#include "aeron_udp_channel_transport_af_xdp.h"
+#endif
+
 aeron_udp_channel_transport_bindings_t aeron_udp_channel_transport_bindings_default =
     {
         aeron_udp_channel_transport_init,
@@ -42,6 +51,7 @@ aeron_udp_channel_transport_bindings_t aeron_udp_channel_transport_bindings_defa
         aeron_udp_channel_transport_recvmmsg,
         aeron_udp_channel_transport_send,
         aeron_udp_channel_transport_get_so_rcvbuf,
+        aeron_udp_channel_transport_get_send_queue_length,
         aeron_udp_channel_transport_bind_addr_and_port,
         aeron_udp_transport_poller_init,
         aeron_udp_transport_poller_close,
@@ -55,6 +65,54 @@ aeron_udp_channel_transport_bindings_t aeron_udp_channel_transport_bindings_defa
         }
     };
 
+#if defined(HAVE_IO_URING)
+aeron_udp_channel_transport_bindings_t aeron_udp_channel_transport_bindings_io_uring =
+    {
+        aeron_udp_channel_transport_init,
+        aeron_udp_channel_transport_reconnect,
+        aeron_udp_channel_transport_close,
+        aeron_udp_channel_transport_recvmmsg,
+        aeron_udp_channel_transport_send,
+        aeron_udp_channel_transport_get_so_rcvbuf,
+        aeron_udp_channel_transport_get_send_queue_length,
+        aeron_udp_channel_transport_bind_addr_and_port,
+        aeron_udp_transport_poller_io_uring_init,
+        aeron_udp_transport_poller_io_uring_close,
+        aeron_udp_transport_poller_io_uring_add,
+        aeron_udp_transport_poller_io_uring_remove,
+        aeron_udp_transport_poller_io_uring_poll,
+        {
+            "io_uring",
+            "media",
+            NULL,
+        }
+    };
+#endif
+
+#if defined(HAVE_AF_XDP)
+aeron_udp_channel_transport_bindings_t aeron_udp_channel_transport_bindings_af_xdp =
+    {
+        aeron_udp_channel_transport_af_xdp_init,
+        aeron_udp_channel_transport_reconnect,
+        aeron_udp_channel_transport_af_xdp_close,
+        aeron_udp_channel_transport_recvmmsg,
+        aeron_udp_channel_transport_af_xdp_send,
+        aeron_udp_channel_transport_get_so_rcvbuf,
+        aeron_udp_channel_transport_get_send_queue_length,
+        aeron_udp_channel_transport_bind_addr_and_port,
+        aeron_udp_transport_poller_init,
+        aeron_udp_transport_poller_close,
+        aeron_udp_transport_poller_add,
+        aeron_udp_transport_poller_remove,
+        aeron_udp_transport_poller_af_xdp_poll,
+        {
+            "af_xdp",
+            "media",
+            NULL,
+        }
+    };
+#endif
+
 static const aeron_symbol_table_obj_t aeron_udp_channel_transport_bindings_table[] =
     {
         {
@@ -62,6 +120,20 @@ static const aeron_symbol_table_obj_t aeron_udp_channel_transport_bindings_table
             "aeron_udp_channel_transport_bindings_default",
             (void *)&aeron_udp_channel_transport_bindings_default
         },
+#if defined(HAVE_IO_URING)
+        {
+            "io_uring",
+            "aeron_udp_channel_transport_bindings_io_uring",
+            (void *)&aeron_udp_channel_transport_bindings_io_uring
+        },
+#endif
+#if defined(HAVE_AF_XDP)
+        {
+            "af_xdp",
+            "aeron_udp_channel_transport_bindings_af_xdp",
+            (void *)&aeron_udp_channel_transport_bindings_af_xdp
+        },
+#endif
     };
 
 static const size_t aeron_udp_channel_transport_bindings_table_length =
@@ -78,6 +150,11 @@ static const aeron_symbol_table_func_t aeron_udp_channel_interceptor_table[] =
             "fixed-loss",
             "aeron_udp_channel_interceptor_fixed_loss_load",
             (aeron_fptr_t)aeron_udp_channel_interceptor_fixed_loss_load
+        },
+        {
+            "netem",
+            "aeron_udp_channel_interceptor_netem_load",
+            (aeron_fptr_t)aeron_udp_channel_interceptor_netem_load
         }
     };
 
@@ -217,6 +294,7 @@ int aeron_udp_channel_data_paths_init(
             interceptor->interceptor_state = NULL;
             interceptor->outgoing_send_func = binding->outgoing_send_func;
             interceptor->close_func = binding->outgoing_close_func;
+            interceptor->poll_func = binding->outgoing_poll_func;
             interceptor->outgoing_transport_notification_func = binding->outgoing_transport_notification_func;
             interceptor->outgoing_publication_notification_func = binding->outgoing_publication_notification_func;
             interceptor->outgoing_image_notification_func = binding->outgoing_image_notification_func;
@@ -250,6 +328,7 @@ int aeron_udp_channel_data_paths_init(
         /* last interceptor calls sendmmsg_func/sendmsg_func from transport bindings */
         outgoing_transport_interceptor->outgoing_send_func = aeron_udp_channel_outgoing_interceptor_send_to_transport;
         outgoing_transport_interceptor->close_func = NULL;
+        outgoing_transport_interceptor->poll_func = NULL;
         outgoing_transport_interceptor->next_interceptor = NULL;
         last_outgoing_interceptor->next_interceptor = outgoing_transport_interceptor;
         /* set up to pass into interceptors */
@@ -277,6 +356,7 @@ int aeron_udp_channel_data_paths_init(
             interceptor->interceptor_state = NULL;
             interceptor->incoming_func = binding->incoming_func;
             interceptor->close_func = binding->incoming_close_func;
+            interceptor->poll_func = binding->incoming_poll_func;
             interceptor->incoming_transport_notification_func = binding->incoming_transport_notification_func;
             interceptor->incoming_publication_notification_func = binding->incoming_publication_notification_func;
             interceptor->incoming_image_notification_func = binding->incoming_image_notification_func;
@@ -318,6 +398,7 @@ int aeron_udp_channel_data_paths_init(
         incoming_transport_interceptor->interceptor_state = recv_function_holder;
         incoming_transport_interceptor->incoming_func = aeron_udp_channel_incoming_interceptor_to_endpoint;
         incoming_transport_interceptor->close_func = aeron_udp_channel_transport_recv_func_holder_close;
+        incoming_transport_interceptor->poll_func = NULL;
         incoming_transport_interceptor->next_interceptor = NULL;
         last_incoming_interceptor->next_interceptor = incoming_transport_interceptor;
         data_paths->recv_func = aeron_udp_channel_incoming_interceptor_recv_func;
@@ -363,6 +444,35 @@ int aeron_udp_channel_data_paths_delete(aeron_udp_channel_data_paths_t *data_pat
     return 0;
 }
 
+int aeron_udp_channel_data_paths_poll(aeron_udp_channel_data_paths_t *data_paths, int64_t now_ns)
+{
+    int work_count = 0;
+
+    for (
+        aeron_udp_channel_outgoing_interceptor_t *interceptor = data_paths->outgoing_interceptors;
+        NULL != interceptor;
+        interceptor = interceptor->next_interceptor)
+    {
+        if (NULL != interceptor->poll_func)
+        {
+            work_count += interceptor->poll_func(interceptor->interceptor_state, now_ns);
+        }
+    }
+
+    for (
+        aeron_udp_channel_incoming_interceptor_t *interceptor = data_paths->incoming_interceptors;
+        NULL != interceptor;
+        interceptor = interceptor->next_interceptor)
+    {
+        if (NULL != interceptor->poll_func)
+        {
+            work_count += interceptor->poll_func(interceptor->interceptor_state, now_ns);
+        }
+    }
+
+    return work_count;
+}
+
 int aeron_udp_channel_transport_recv_func_holder_close(void *holder)
 {
     aeron_free(holder);
@@ -85,6 +85,12 @@ typedef int (*aeron_udp_channel_transport_send_func_t)(
 typedef int (*aeron_udp_channel_transport_get_so_rcvbuf_func_t)(
     aeron_udp_channel_transport_t *transport, size_t *so_rcvbuf);
 
+/*
+ * Bytes queued in the send socket buffer and the size of that buffer. Optional, may be NULL in the bindings.
+ */
+typedef int (*aeron_udp_channel_transport_get_send_queue_length_func_t)(
+    aeron_udp_channel_transport_t *transport, size_t *send_queue_length, size_t *so_sndbuf);
+
 typedef int (*aeron_udp_channel_transport_bind_addr_and_port_func_t)(
     aeron_udp_channel_transport_t *transport, char *buffer, size_t length);
 
@@ -118,6 +124,7 @@ struct aeron_udp_channel_transport_bindings_stct
     aeron_udp_channel_transport_recvmmsg_func_t recvmmsg_func;
     aeron_udp_channel_transport_send_func_t send_func;
     aeron_udp_channel_transport_get_so_rcvbuf_func_t get_so_rcvbuf_func;
+    aeron_udp_channel_transport_get_send_queue_length_func_t get_send_queue_length_func;
     aeron_udp_channel_transport_bind_addr_and_port_func_t bind_addr_and_port_func;
     aeron_udp_transport_poller_init_func_t poller_init_func;
     aeron_udp_transport_poller_close_func_t poller_close_func;
@@ -183,6 +190,12 @@ typedef int (*aeron_udp_channel_interceptor_init_func_t)(
 typedef int (*aeron_udp_channel_interceptor_close_func_t)(
     void *interceptor_state);
 
+/*
+ * Called from the duty cycle of the agent which owns the data paths so an interceptor can release anything it has
+ * held back. Returns the work count. Optional, may be NULL in the bindings.
+ */
+typedef int (*aeron_udp_channel_interceptor_poll_func_t)(void *interceptor_state, int64_t now_ns);
+
 typedef int (*aeron_udp_channel_interceptor_transport_notification_func_t)(
     void *interceptor_state,
     aeron_udp_channel_transport_t *transport,
@@ -210,6 +223,8 @@ struct aeron_udp_channel_interceptor_bindings_stct
     aeron_udp_channel_interceptor_incoming_func_t incoming_func;
     aeron_udp_channel_interceptor_close_func_t outgoing_close_func;
     aeron_udp_channel_interceptor_close_func_t incoming_close_func;
+    aeron_udp_channel_interceptor_poll_func_t outgoing_poll_func;
+    aeron_udp_channel_interceptor_poll_func_t incoming_poll_func;
     aeron_udp_channel_interceptor_transport_notification_func_t outgoing_transport_notification_func;
     aeron_udp_channel_interceptor_transport_notification_func_t incoming_transport_notification_func;
     aeron_udp_channel_interceptor_publication_notification_func_t outgoing_publication_notification_func;
@@ -231,6 +246,7 @@ struct aeron_udp_channel_outgoing_interceptor_stct
     void *interceptor_state;
     aeron_udp_channel_interceptor_outgoing_send_func_t outgoing_send_func;
     aeron_udp_channel_interceptor_close_func_t close_func;
+    aeron_udp_channel_interceptor_poll_func_t poll_func;
     aeron_udp_channel_interceptor_transport_notification_func_t outgoing_transport_notification_func;
     aeron_udp_channel_interceptor_publication_notification_func_t outgoing_publication_notification_func;
     aeron_udp_channel_interceptor_image_notification_func_t outgoing_image_notification_func;
@@ -242,6 +258,7 @@ struct aeron_udp_channel_incoming_interceptor_stct
     void *interceptor_state;
     aeron_udp_channel_interceptor_incoming_func_t incoming_func;
     aeron_udp_channel_interceptor_close_func_t close_func;
+    aeron_udp_channel_interceptor_poll_func_t poll_func;
     aeron_udp_channel_interceptor_transport_notification_func_t incoming_transport_notification_func;
     aeron_udp_channel_interceptor_publication_notification_func_t incoming_publication_notification_func;
     aeron_udp_channel_interceptor_image_notification_func_t incoming_image_notification_func;
@@ -350,6 +367,8 @@ int aeron_udp_channel_data_paths_init(
 
 int aeron_udp_channel_data_paths_delete(aeron_udp_channel_data_paths_t *data_paths);
 
+int aeron_udp_channel_data_paths_poll(aeron_udp_channel_data_paths_t *data_paths, int64_t now_ns);
+
 inline int aeron_udp_channel_interceptors_transport_notifications(
     aeron_udp_channel_data_paths_t *data_paths,
     aeron_udp_channel_transport_t *transport,
@@ -67,6 +67,8 @@ aeron_udp_channel_interceptor_bindings_t *aeron_udp_channel_interceptor_fixed_lo
     interceptor_bindings->incoming_func = aeron_udp_channel_interceptor_fixed_loss_incoming;
     interceptor_bindings->outgoing_close_func = NULL;
     interceptor_bindings->incoming_close_func = NULL;
+    interceptor_bindings->outgoing_poll_func = NULL;
+    interceptor_bindings->incoming_poll_func = NULL;
     interceptor_bindings->outgoing_transport_notification_func = NULL;
     interceptor_bindings->outgoing_publication_notification_func = NULL;
     interceptor_bindings->outgoing_image_notification_func = NULL;
@@ -0,0 +1,661 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#if defined(HAVE_IO_URING)
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+#include "util/aeron_error.h"
+#include "util/aeron_arrayutil.h"
+#include "util/aeron_bitutil.h"
+#include "concurrent/aeron_atomic.h"
+#include "aeron_alloc.h"
+#include "aeron_udp_channel_transport.h"
+#include "aeron_udp_transport_poller.h"
+#include "aeron_udp_channel_transport_io_uring.h"
+
+#define AERON_IO_URING_RECVMSG_NAME_LENGTH (sizeof(struct sockaddr_storage))
+#define AERON_IO_URING_RECVMSG_CONTROL_LENGTH (AERON_UDP_CHANNEL_TRANSPORT_RECV_CONTROL_LENGTH)
+#define AERON_IO_URING_RECVMSG_HEADER_LENGTH \
+    (sizeof(struct io_uring_recvmsg_out) + AERON_IO_URING_RECVMSG_NAME_LENGTH + AERON_IO_URING_RECVMSG_CONTROL_LENGTH)
+
+typedef struct aeron_udp_transport_poller_io_uring_entry_stct
+{
+    aeron_udp_channel_transport_t *transport;
+    struct msghdr msg;
+}
+aeron_udp_transport_poller_io_uring_entry_t;
+
+typedef struct aeron_udp_transport_poller_io_uring_stct
+{
+    int ring_fd;
+
+    struct aeron_udp_transport_poller_io_uring_sq_stct
+    {
+        uint32_t *head;
+        uint32_t *tail;
+        uint32_t *flags;
+        uint32_t mask;
+        uint32_t entries;
+        uint32_t sqe_tail;
+        uint32_t pending;
+        struct io_uring_sqe *sqes;
+        size_t sqes_length;
+        void *ring;
+        size_t ring_length;
+    }
+    sq;
+
+    struct aeron_udp_transport_poller_io_uring_cq_stct
+    {
+        uint32_t *head;
+        uint32_t *tail;
+        uint32_t mask;
+        struct io_uring_cqe *cqes;
+        void *ring;
+        size_t ring_length;
+    }
+    cq;
+
+    struct aeron_udp_transport_poller_io_uring_buffers_stct
+    {
+        struct io_uring_buf_ring *ring;
+        size_t ring_length;
+        uint8_t *memory;
+        uint8_t *base;
+        size_t buffer_length;
+        uint16_t count;
+        uint16_t tail;
+    }
+    buffers;
+
+    struct aeron_udp_transport_poller_io_uring_entries_stct
+    {
+        aeron_udp_transport_poller_io_uring_entry_t **array;
+        size_t length;
+        size_t capacity;
+    }
+    entries;
+}
+aeron_udp_transport_poller_io_uring_t;
+
+static int aeron_io_uring_setup(unsigned int entries, struct io_uring_params *params)
+{
+    return (int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+static int aeron_io_uring_enter(int ring_fd, unsigned int to_submit, unsigned int min_complete, unsigned int flags)
+{
+    return (int)syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, NULL, 0);
+}
+
+static int aeron_io_uring_register(int ring_fd, unsigned int opcode, void *arg, unsigned int nr_args)
+{
+    return (int)syscall(__NR_io_uring_register, ring_fd, opcode, arg, nr_args);
+}
+
+static int aeron_udp_transport_poller_io_uring_submit(aeron_udp_transport_poller_io_uring_t *ring)
+{
+    if (0 == ring->sq.pending)
+    {
+        return 0;
+    }
+
+    AERON_PUT_ORDERED(*ring->sq.tail, ring->sq.sqe_tail);
+
+    int result = aeron_io_uring_enter(ring->ring_fd, ring->sq.pending, 0, 0);
+    if (result < 0)
+    {
+        int err = errno;
+        if (EINTR == err || EAGAIN == err || EBUSY == err)
+        {
+            return 0;
+        }
+
+        AERON_SET_ERR(err, "io_uring_enter, to_submit=%u", ring->sq.pending);
+        return -1;
+    }
+
+    ring->sq.pending -= (uint32_t)result;
+
+    return result;
+}
+
+static struct io_uring_sqe *aeron_udp_transport_poller_io_uring_next_sqe(aeron_udp_transport_poller_io_uring_t *ring)
+{
+    uint32_t head;
+    AERON_GET_VOLATILE(head, *ring->sq.head);
+
+    if ((ring->sq.sqe_tail - head) >= ring->sq.entries)
+    {
+        if (aeron_udp_transport_poller_io_uring_submit(ring) < 0)
+        {
+            return NULL;
+        }
+
+        AERON_GET_VOLATILE(head, *ring->sq.head);
+        if ((ring->sq.sqe_tail - head) >= ring->sq.entries)
+        {
+            AERON_SET_ERR(EBUSY, "%s", "io_uring submission queue is full");
+            return NULL;
+        }
+    }
+
+    struct io_uring_sqe *sqe = &ring->sq.sqes[ring->sq.sqe_tail & ring->sq.mask];
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+    ring->sq.sqe_tail++;
+    ring->sq.pending++;
+
+    return sqe;
+}
+
+static int aeron_udp_transport_poller_io_uring_arm(
+    aeron_udp_transport_poller_io_uring_t *ring, aeron_udp_transport_poller_io_uring_entry_t *entry)
+{
+    struct io_uring_sqe *sqe = aeron_udp_transport_poller_io_uring_next_sqe(ring);
+    if (NULL == sqe)
+    {
+        AERON_APPEND_ERR("failed to arm multishot recvmsg, fd=%d", entry->transport->recv_fd);
+        return -1;
+    }
+
+    sqe->opcode = IORING_OP_RECVMSG;
+    sqe->fd = entry->transport->recv_fd;
+    sqe->addr = (uint64_t)(uintptr_t)&entry->msg;
+    sqe->len = 1;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = AERON_UDP_TRANSPORT_POLLER_IO_URING_BUFFER_GROUP_ID;
+    sqe->user_data = (uint64_t)(uintptr_t)entry;
+
+    return 0;
+}
+
+static inline void aeron_udp_transport_poller_io_uring_recycle_buffer(
+    aeron_udp_transport_poller_io_uring_t *ring, uint16_t buffer_id)
+{
+    struct io_uring_buf *buf = &ring->buffers.ring->bufs[ring->buffers.tail & (ring->buffers.count - 1)];
+
+    buf->addr = (uint64_t)(uintptr_t)(ring->buffers.base + ((size_t)buffer_id * ring->buffers.buffer_length));
+    buf->len = (uint32_t)ring->buffers.buffer_length;
+    buf->bid = buffer_id;
+    ring->buffers.tail++;
+}
+
+static void aeron_udp_transport_poller_io_uring_release_entry(
+    aeron_udp_transport_poller_io_uring_t *ring, aeron_udp_transport_poller_io_uring_entry_t *entry)
+{
+    int last_index = (int)ring->entries.length - 1;
+
+    for (int i = last_index; i >= 0; i--)
+    {
+        if (ring->entries.array[i] == entry)
+        {
+            aeron_array_fast_unordered_remove(
+                (uint8_t *)ring->entries.array,
+                sizeof(aeron_udp_transport_poller_io_uring_entry_t *),
+                (size_t)i,
+                (size_t)last_index);
+            ring->entries.length--;
+            break;
+        }
+    }
+
+    aeron_free(entry);
+}
+
+static int aeron_udp_transport_poller_io_uring_map(
+    aeron_udp_transport_poller_io_uring_t *ring, struct io_uring_params *params)
+{
+    ring->sq.ring_length = params->sq_off.array + (params->sq_entries * sizeof(uint32_t));
+    ring->cq.ring_length = params->cq_off.cqes + (params->cq_entries * sizeof(struct io_uring_cqe));
+
+    if (params->features & IORING_FEAT_SINGLE_MMAP)
+    {
+        if (ring->cq.ring_length > ring->sq.ring_length)
+        {
+            ring->sq.ring_length = ring->cq.ring_length;
+        }
+        ring->cq.ring_length = ring->sq.ring_length;
+    }
+
+    ring->sq.ring = mmap(
+        NULL, ring->sq.ring_length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ring_fd, IORING_OFF_SQ_RING);
+    if (MAP_FAILED == ring->sq.ring)
+    {
+        ring->sq.ring = NULL;
+        AERON_SET_ERR(errno, "%s", "failed to mmap io_uring submission queue");
+        return -1;
+    }
+
+    if (params->features & IORING_FEAT_SINGLE_MMAP)
+    {
+        ring->cq.ring = ring->sq.ring;
+    }
+    else
+    {
+        ring->cq.ring = mmap(
+            NULL,
+            ring->cq.ring_length,
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE,
+            ring->ring_fd,
+            IORING_OFF_CQ_RING);
+        if (MAP_FAILED == ring->cq.ring)
+        {
+            ring->cq.ring = NULL;
+            AERON_SET_ERR(errno, "%s", "failed to mmap io_uring completion queue");
+            return -1;
+        }
+    }
+
+    ring->sq.sqes_length = params->sq_entries * sizeof(struct io_uring_sqe);
+    ring->sq.sqes = mmap(
+        NULL, ring->sq.sqes_length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ring_fd, IORING_OFF_SQES);
+    if (MAP_FAILED == ring->sq.sqes)
+    {
+        ring->sq.sqes = NULL;
+        AERON_SET_ERR(errno, "%s", "failed to mmap io_uring submission queue entries");
+        return -1;
+    }
+
+    uint8_t *sq_ring = (uint8_t *)ring->sq.ring;
+    uint8_t *cq_ring = (uint8_t *)ring->cq.ring;
+
+    ring->sq.head = (uint32_t *)(sq_ring + params->sq_off.head);
+    ring->sq.tail = (uint32_t *)(sq_ring + params->sq_off.tail);
+    ring->sq.flags = (uint32_t *)(sq_ring + params->sq_off.flags);
+    ring->sq.mask = *(uint32_t *)(sq_ring + params->sq_off.ring_mask);
+    ring->sq.entries = *(uint32_t *)(sq_ring + params->sq_off.ring_entries);
+    ring->sq.sqe_tail = *ring->sq.tail;
+    ring->sq.pending = 0;
+
+    uint32_t *sq_array = (uint32_t *)(sq_ring + params->sq_off.array);
+    for (uint32_t i = 0; i < ring->sq.entries; i++)
+    {
+        sq_array[i] = i;
+    }
+
+    ring->cq.head = (uint32_t *)(cq_ring + params->cq_off.head);
+    ring->cq.tail = (uint32_t *)(cq_ring + params->cq_off.tail);
+    ring->cq.mask = *(uint32_t *)(cq_ring + params->cq_off.ring_mask);
+    ring->cq.cqes = (struct io_uring_cqe *)(cq_ring + params->cq_off.cqes);
+
+    return 0;
+}
+
+static int aeron_udp_transport_poller_io_uring_register_buffers(
+    aeron_udp_transport_poller_io_uring_t *ring, uint16_t count, size_t buffer_length)
+{
+    ring->buffers.count = count;
+    ring->buffers.tail = 0;
+    ring->buffers.buffer_length = AERON_ALIGN(buffer_length + AERON_IO_URING_RECVMSG_HEADER_LENGTH, AERON_CACHE_LINE_LENGTH);
+    ring->buffers.ring_length = count * sizeof(struct io_uring_buf);
+
+    ring->buffers.ring = mmap(
+        NULL, ring->buffers.ring_length, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+    if (MAP_FAILED == ring->buffers.ring)
+    {
+        ring->buffers.ring = NULL;
+        AERON_SET_ERR(errno, "%s", "failed to mmap io_uring provided buffer ring");
+        return -1;
+    }
+
+    size_t offset = 0;
+    if (aeron_alloc_aligned(
+        (void **)&ring->buffers.memory, &offset, count * ring->buffers.buffer_length, AERON_CACHE_LINE_LENGTH) < 0)
+    {
+        AERON_APPEND_ERR("%s", "failed to allocate io_uring provided buffers");
+        return -1;
+    }
+    ring->buffers.base = ring->buffers.memory + offset;
+
+    struct io_uring_buf_reg reg;
+    memset(&reg, 0, sizeof(reg));
+    reg.ring_addr = (uint64_t)(uintptr_t)ring->buffers.ring;
+    reg.ring_entries = count;
+    reg.bgid = AERON_UDP_TRANSPORT_POLLER_IO_URING_BUFFER_GROUP_ID;
+
+    if (aeron_io_uring_register(ring->ring_fd, IORING_REGISTER_PBUF_RING, &reg, 1) < 0)
+    {
+        AERON_SET_ERR(errno, "%s", "io_uring_register(IORING_REGISTER_PBUF_RING), requires Linux 5.19+");
+        return -1;
+    }
+
+    for (uint16_t i = 0; i < count; i++)
+    {
+        aeron_udp_transport_poller_io_uring_recycle_buffer(ring, i);
+    }
+    AERON_PUT_ORDERED(ring->buffers.ring->tail, ring->buffers.tail);
+
+    return 0;
+}
+
+int aeron_udp_transport_poller_io_uring_init(
+    aeron_udp_transport_poller_t *poller,
+    aeron_driver_context_t *context,
+    aeron_udp_channel_transport_affinity_t affinity)
+{
+    aeron_udp_transport_poller_io_uring_t *ring = NULL;
+
+    poller->transports.array = NULL;
+    poller->transports.length = 0;
+    poller->transports.capacity = 0;
+    poller->fd = -1;
+    poller->bindings_clientd = NULL;
+
+    if (aeron_alloc((void **)&ring, sizeof(aeron_udp_transport_poller_io_uring_t)) < 0)
+    {
+        AERON_APPEND_ERR("%s", "failed to allocate io_uring poller");
+        return -1;
+    }
+    poller->bindings_clientd = ring;
+
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    params.flags = IORING_SETUP_CQSIZE;
+    params.cq_entries = AERON_UDP_TRANSPORT_POLLER_IO_URING_CQ_ENTRIES;
+
+    if ((ring->ring_fd = aeron_io_uring_setup(AERON_UDP_TRANSPORT_POLLER_IO_URING_SQ_ENTRIES, &params)) < 0)
+    {
+        AERON_SET_ERR(errno, "%s", "io_uring_setup");
+        goto error;
+    }
+    poller->fd = ring->ring_fd;
+
+    if (aeron_udp_transport_poller_io_uring_map(ring, &params) < 0)
+    {
+        goto error;
+    }
+
+    uint16_t buffer_count = AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER == affinity ?
+        AERON_UDP_TRANSPORT_POLLER_IO_URING_RECEIVER_BUFFER_COUNT : AERON_UDP_TRANSPORT_POLLER_IO_URING_BUFFER_COUNT;
+    size_t buffer_length = AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER == affinity ?
+        AERON_DRIVER_RECEIVER_MAX_UDP_PACKET_LENGTH : context->mtu_length;
+
+    if (aeron_udp_transport_poller_io_uring_register_buffers(ring, buffer_count, buffer_length) < 0)
+    {
+        goto error;
+    }
+
+    return 0;
+
+error:
+    aeron_udp_transport_poller_io_uring_close(poller);
+    poller->bindings_clientd = NULL;
+    return -1;
+}
+
+int aeron_udp_transport_poller_io_uring_close(aeron_udp_transport_poller_t *poller)
+{
+    aeron_udp_transport_poller_io_uring_t *ring = (aeron_udp_transport_poller_io_uring_t *)poller->bindings_clientd;
+
+    if (NULL != ring)
+    {
+        if (ring->ring_fd >= 0)
+        {
+            close(ring->ring_fd);
+        }
+
+        if (NULL != ring->sq.sqes)
+        {
+            munmap(ring->sq.sqes, ring->sq.sqes_length);
+        }
+
+        if (NULL != ring->cq.ring && ring->cq.ring != ring->sq.ring)
+        {
+            munmap(ring->cq.ring, ring->cq.ring_length);
+        }
+
+        if (NULL != ring->sq.ring)
+        {
+            munmap(ring->sq.ring, ring->sq.ring_length);
+        }
+
+        if (NULL != ring->buffers.ring)
+        {
+            munmap(ring->buffers.ring, ring->buffers.ring_length);
+        }
+
+        aeron_free(ring->buffers.memory);
+
+        for (size_t i = 0; i < ring->entries.length; i++)
+        {
+            aeron_free(ring->entries.array[i]);
+        }
+        aeron_free(ring->entries.array);
+        aeron_free(ring);
+    }
+
+    aeron_free(poller->transports.array);
+
+    return 0;
+}
+
+int aeron_udp_transport_poller_io_uring_add(
+    aeron_udp_transport_poller_t *poller, aeron_udp_channel_transport_t *transport)
+{
+    aeron_udp_transport_poller_io_uring_t *ring = (aeron_udp_transport_poller_io_uring_t *)poller->bindings_clientd;
+    aeron_udp_transport_poller_io_uring_entry_t *entry = NULL;
+    int ensure_capacity_result = 0;
+
+    AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, poller->transports, aeron_udp_channel_transport_entry_t)
+    if (ensure_capacity_result < 0)
+    {
+        return -1;
+    }
+
+    AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, ring->entries, aeron_udp_transport_poller_io_uring_entry_t *)
+    if (ensure_capacity_result < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&entry, sizeof(aeron_udp_transport_poller_io_uring_entry_t)) < 0)
+    {
+        AERON_APPEND_ERR("%s", "failed to allocate io_uring poller entry");
+        return -1;
+    }
+
+    entry->transport = transport;
+    entry->msg.msg_namelen = AERON_IO_URING_RECVMSG_NAME_LENGTH;
+    entry->msg.msg_controllen =
+        transport->timestamp_flags || (transport->offload_flags & AERON_UDP_CHANNEL_TRANSPORT_OFFLOAD_GRO) ?
+        AERON_IO_URING_RECVMSG_CONTROL_LENGTH : 0;
+
+    if (aeron_udp_transport_poller_io_uring_arm(ring, entry) < 0 ||
+        aeron_udp_transport_poller_io_uring_submit(ring) < 0)
+    {
+        aeron_free(entry);
+        return -1;
+    }
+
+    ring->entries.array[ring->entries.length++] = entry;
+    poller->transports.array[poller->transports.length++].transport = transport;
+
+    return 0;
+}
+
+int aeron_udp_transport_poller_io_uring_remove(
+    aeron_udp_transport_poller_t *poller, aeron_udp_channel_transport_t *transport)
+{
+    aeron_udp_transport_poller_io_uring_t *ring = (aeron_udp_transport_poller_io_uring_t *)poller->bindings_clientd;
+    int last_index = (int)poller->transports.length - 1;
+
+    for (int i = last_index; i >= 0; i--)
+    {
+        if (poller->transports.array[i].transport == transport)
+        {
+            aeron_array_fast_unordered_remove(
+                (uint8_t *)poller->transports.array,
+                sizeof(aeron_udp_channel_transport_entry_t),
+                (size_t)i,
+                (size_t)last_index);
+            poller->transports.length--;
+            break;
+        }
+    }
+
+    for (size_t i = 0; i < ring->entries.length; i++)
+    {
+        aeron_udp_transport_poller_io_uring_entry_t *entry = ring->entries.array[i];
+
+        if (entry->transport == transport)
+        {
+            // The entry is released when the terminal completion for the cancelled recvmsg is reaped.
+            entry->transport = NULL;
+
+            struct io_uring_sqe *sqe = aeron_udp_transport_poller_io_uring_next_sqe(ring);
+            if (NULL == sqe)
+            {
+                AERON_APPEND_ERR("failed to cancel multishot recvmsg, fd=%d", transport->recv_fd);
+                return -1;
+            }
+
+            sqe->opcode = IORING_OP_ASYNC_CANCEL;
+            sqe->fd = -1;
+            sqe->addr = (uint64_t)(uintptr_t)entry;
+            sqe->user_data = 0;
+
+            if (aeron_udp_transport_poller_io_uring_submit(ring) < 0)
+            {
+                return -1;
+            }
+            break;
+        }
+    }
+
+    return 0;
+}
+
+int aeron_udp_transport_poller_io_uring_poll(
+    aeron_udp_transport_poller_t *poller,
+    struct mmsghdr *msgvec,
+    size_t vlen,
+    int64_t *bytes_rcved,
+    aeron_udp_transport_recv_func_t recv_func,
+    aeron_udp_channel_transport_recvmmsg_func_t recvmmsg_func,
+    void *clientd)
+{
+    aeron_udp_transport_poller_io_uring_t *ring = (aeron_udp_transport_poller_io_uring_t *)poller->bindings_clientd;
+    int work_count = 0;
+    int result = 0;
+
+    uint32_t sq_flags;
+    AERON_GET_VOLATILE(sq_flags, *ring->sq.flags);
+    if (sq_flags & IORING_SQ_CQ_OVERFLOW)
+    {
+        aeron_io_uring_enter(ring->ring_fd, 0, 0, IORING_ENTER_GETEVENTS);
+    }
+
+    uint32_t head = *ring->cq.head;
+    uint32_t tail;
+    AERON_GET_VOLATILE(tail, *ring->cq.tail);
+
+    if (head == tail)
+    {
+        return aeron_udp_transport_poller_io_uring_submit(ring) < 0 ? -1 : 0;
+    }
+
+    for (; head != tail; head++)
+    {
+        struct io_uring_cqe *cqe = &ring->cq.cqes[head & ring->cq.mask];
+        aeron_udp_transport_poller_io_uring_entry_t *entry =
+            (aeron_udp_transport_poller_io_uring_entry_t *)(uintptr_t)cqe->user_data;
+
+        if (NULL == entry)
+        {
+            continue;
+        }
+
+        aeron_udp_channel_transport_t *transport = entry->transport;
+
+        if (cqe->flags & IORING_CQE_F_BUFFER)
+        {
+            uint16_t buffer_id = (uint16_t)(cqe->flags >> IORING_CQE_BUFFER_SHIFT);
+            uint8_t *buffer = ring->buffers.base + ((size_t)buffer_id * ring->buffers.buffer_length);
+
+            if (cqe->res >= 0 && NULL != transport)
+            {
+                struct io_uring_recvmsg_out *out = (struct io_uring_recvmsg_out *)buffer;
+                uint8_t *name = buffer + sizeof(struct io_uring_recvmsg_out);
+                uint8_t *control = name + entry->msg.msg_namelen;
+                uint8_t *payload = control + entry->msg.msg_controllen;
+                size_t available = (size_t)((buffer + ring->buffers.buffer_length) - payload);
+                size_t length = out->payloadlen < available ? out->payloadlen : available;
+
+                struct msghdr msg;
+                memset(&msg, 0, sizeof(msg));
+                msg.msg_name = name;
+                msg.msg_control = out->controllen > 0 ? control : NULL;
+                msg.msg_controllen = out->controllen;
+                msg.msg_flags = (int)out->flags | (out->payloadlen > available ? MSG_TRUNC : 0);
+
+                aeron_udp_channel_transport_dispatch(
+                    transport, &msg, payload, length, bytes_rcved, recv_func, clientd);
+                work_count++;
+            }
+
+            aeron_udp_transport_poller_io_uring_recycle_buffer(ring, buffer_id);
+        }
+        else if (cqe->res < 0 && NULL != transport && 0 == result)
+        {
+            int err = -cqe->res;
+
+            // ECONNREFUSED can occur with connected UDP sockets, ENOBUFS when the provided buffers are exhausted,
+            // in both cases the recvmsg is simply re-armed below.
+            if (ENOBUFS != err && ECANCELED != err && ECONNREFUSED != err && EINTR != err && EAGAIN != err)
+            {
+                AERON_SET_ERR(err, "io_uring multishot recvmsg, fd=%d", transport->recv_fd);
+                result = -1;
+            }
+        }
+
+        if (0 == (cqe->flags & IORING_CQE_F_MORE))
+        {
+            if (NULL == transport)
+            {
+                aeron_udp_transport_poller_io_uring_release_entry(ring, entry);
+            }
+            else if (aeron_udp_transport_poller_io_uring_arm(ring, entry) < 0)
+            {
+                result = -1;
+            }
+        }
+    }
+
+    AERON_PUT_ORDERED(*ring->cq.head, head);
+    AERON_PUT_ORDERED(ring->buffers.ring->tail, ring->buffers.tail);
+
+    if (aeron_udp_transport_poller_io_uring_submit(ring) < 0)
+    {
+        result = -1;
+    }
+
+    return result < 0 ? -1 : work_count;
+}
+
+#endif
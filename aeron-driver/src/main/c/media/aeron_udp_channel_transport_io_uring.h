@@ -0,0 +1,57 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_UDP_CHANNEL_TRANSPORT_IO_URING_H
+#define AERON_UDP_CHANNEL_TRANSPORT_IO_URING_H
+
+#include "aeron_udp_channel_transport_bindings.h"
+
+/*
+ * io_uring based poller for UDP channel transports. Each transport added to the poller has a multishot recvmsg
+ * armed against it that receives into a ring of provided buffers shared with the kernel, so completions are
+ * consumed from the mapped completion queue without a syscall. Re-arms are batched into a single ring enter per
+ * poll across all transports. Sockets are set up and sent on exactly as for the default bindings.
+ */
+
+#define AERON_UDP_TRANSPORT_POLLER_IO_URING_SQ_ENTRIES (256)
+#define AERON_UDP_TRANSPORT_POLLER_IO_URING_CQ_ENTRIES (4096)
+#define AERON_UDP_TRANSPORT_POLLER_IO_URING_RECEIVER_BUFFER_COUNT (256)
+#define AERON_UDP_TRANSPORT_POLLER_IO_URING_BUFFER_COUNT (32)
+#define AERON_UDP_TRANSPORT_POLLER_IO_URING_BUFFER_GROUP_ID (0)
+
+int aeron_udp_transport_poller_io_uring_init(
+    aeron_udp_transport_poller_t *poller,
+    aeron_driver_context_t *context,
+    aeron_udp_channel_transport_affinity_t affinity);
+
+int aeron_udp_transport_poller_io_uring_close(aeron_udp_transport_poller_t *poller);
+
+int aeron_udp_transport_poller_io_uring_add(
+    aeron_udp_transport_poller_t *poller, aeron_udp_channel_transport_t *transport);
+
+int aeron_udp_transport_poller_io_uring_remove(
+    aeron_udp_transport_poller_t *poller, aeron_udp_channel_transport_t *transport);
+
+int aeron_udp_transport_poller_io_uring_poll(
+    aeron_udp_transport_poller_t *poller,
+    struct mmsghdr *msgvec,
+    size_t vlen,
+    int64_t *bytes_rcved,
+    aeron_udp_transport_recv_func_t recv_func,
+    aeron_udp_channel_transport_recvmmsg_func_t recvmmsg_func,
+    void *clientd);
+
+#endif //AERON_UDP_CHANNEL_TRANSPORT_IO_URING_H
@@ -64,6 +64,8 @@ aeron_udp_channel_interceptor_bindings_t *aeron_udp_channel_interceptor_loss_loa
     interceptor_bindings->incoming_func = aeron_udp_channel_interceptor_loss_incoming;
     interceptor_bindings->outgoing_close_func = NULL;
     interceptor_bindings->incoming_close_func = NULL;
+    interceptor_bindings->outgoing_poll_func = NULL;
+    interceptor_bindings->incoming_poll_func = NULL;
     interceptor_bindings->outgoing_transport_notification_func = NULL;
     interceptor_bindings->outgoing_publication_notification_func = NULL;
     interceptor_bindings->outgoing_image_notification_func = NULL;
@@ -0,0 +1,694 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "concurrent/aeron_thread.h"
+#include "protocol/aeron_udp_protocol.h"
+#include "util/aeron_error.h"
+#include "util/aeron_parse_util.h"
+#include "aeron_alloc.h"
+#include "aeron_windows.h"
+#include "aeron_udp_channel_transport_netem.h"
+
+#define AERON_CONFIG_GETENV_OR_DEFAULT(e, d) ((NULL == getenv(e)) ? (d) : getenv(e))
+#define AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_NETEM_ARGS_ENV_VAR "AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_NETEM_ARGS"
+
+#define AERON_UDP_CHANNEL_INTERCEPTOR_NETEM_WHEEL_MASK (AERON_UDP_CHANNEL_INTERCEPTOR_NETEM_WHEEL_LENGTH - 1)
+#define AERON_UDP_CHANNEL_INTERCEPTOR_NETEM_SECOND_IN_NS (1000 * 1000 * 1000LL)
+
+struct aeron_udp_channel_interceptor_netem_datagram_stct
+{
+    aeron_udp_channel_interceptor_netem_datagram_t *next;
+    int64_t deadline_ns;
+    aeron_udp_channel_transport_t *transport;
+    aeron_udp_channel_outgoing_interceptor_t *outgoing_delegate;
+    aeron_udp_channel_incoming_interceptor_t *incoming_delegate;
+    void *receiver_clientd;
+    void *endpoint_clientd;
+    void *destination_clientd;
+    struct sockaddr_storage addr;
+    struct timespec media_timestamp;
+    bool has_media_timestamp;
+    size_t length;
+    uint8_t *buffer;
+};
+
+static AERON_INIT_ONCE env_is_initialized = AERON_INIT_ONCE_VALUE;
+
+static aeron_udp_channel_interceptor_netem_params_t *aeron_udp_channel_interceptor_netem_env_params = NULL;
+
+static void aeron_udp_channel_interceptor_netem_load_env(void)
+{
+    aeron_udp_channel_interceptor_netem_params_t *params;
+    const char *args = AERON_CONFIG_GETENV_OR_DEFAULT(AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_NETEM_ARGS_ENV_VAR, "");
+    char *args_dup = strdup(args);
+    if (NULL == args_dup)
+    {
+        AERON_SET_ERR(errno, "%s", "Duplicating args string");
+        return;
+    }
+
+    if (aeron_alloc((void **)&params, sizeof(aeron_udp_channel_interceptor_netem_params_t)) < 0)
+    {
+        aeron_free(args_dup);
+        return;
+    }
+
+    if (aeron_udp_channel_interceptor_netem_parse_params(args_dup, params) >= 0)
+    {
+        aeron_udp_channel_interceptor_netem_env_params = params;
+    }
+    else
+    {
+        aeron_free(params);
+    }
+
+    aeron_free(args_dup);
+}
+
+static int aeron_udp_channel_interceptor_netem_init(
+    void **interceptor_state, aeron_driver_context_t *context, aeron_udp_channel_transport_affinity_t affinity)
+{
+    (void)aeron_thread_once(&env_is_initialized, aeron_udp_channel_interceptor_netem_load_env);
+
+    if (NULL == aeron_udp_channel_interceptor_netem_env_params)
+    {
+        AERON_APPEND_ERR("%s", "netem interceptor params");
+        return -1;
+    }
+
+    // the conductor has no duty cycle feeding the wheel so its traffic passes straight through
+    aeron_udp_channel_interceptor_netem_params_t params = { 0 };
+    if (AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_CONDUCTOR != affinity)
+    {
+        params = *aeron_udp_channel_interceptor_netem_env_params;
+        params.seed += (unsigned long long)affinity;
+    }
+
+    return aeron_udp_channel_interceptor_netem_create(
+        (aeron_udp_channel_interceptor_netem_t **)interceptor_state, &params);
+}
+
+aeron_udp_channel_interceptor_bindings_t *aeron_udp_channel_interceptor_netem_load(
+    aeron_udp_channel_interceptor_bindings_t *delegate_bindings)
+{
+    aeron_udp_channel_interceptor_bindings_t *interceptor_bindings;
+    if (aeron_alloc((void **)&interceptor_bindings, sizeof(aeron_udp_channel_interceptor_bindings_t)) < 0)
+    {
+        return NULL;
+    }
+
+    interceptor_bindings->incoming_init_func = aeron_udp_channel_interceptor_netem_init;
+    interceptor_bindings->outgoing_init_func = aeron_udp_channel_interceptor_netem_init;
+    interceptor_bindings->outgoing_send_func = aeron_udp_channel_interceptor_netem_outgoing_send;
+    interceptor_bindings->incoming_func = aeron_udp_channel_interceptor_netem_incoming;
+    interceptor_bindings->outgoing_close_func = aeron_udp_channel_interceptor_netem_close;
+    interceptor_bindings->incoming_close_func = aeron_udp_channel_interceptor_netem_close;
+    interceptor_bindings->outgoing_poll_func = aeron_udp_channel_interceptor_netem_poll;
+    interceptor_bindings->incoming_poll_func = aeron_udp_channel_interceptor_netem_poll;
+    interceptor_bindings->outgoing_transport_notification_func =
+        aeron_udp_channel_interceptor_netem_transport_notification;
+    interceptor_bindings->outgoing_publication_notification_func = NULL;
+    interceptor_bindings->outgoing_image_notification_func = NULL;
+    interceptor_bindings->incoming_transport_notification_func =
+        aeron_udp_channel_interceptor_netem_transport_notification;
+    interceptor_bindings->incoming_publication_notification_func = NULL;
+    interceptor_bindings->incoming_image_notification_func = NULL;
+
+    interceptor_bindings->meta_info.name = "netem";
+    interceptor_bindings->meta_info.type = "interceptor";
+    interceptor_bindings->meta_info.next_interceptor_bindings = delegate_bindings;
+
+    return interceptor_bindings;
+}
+
+int aeron_udp_channel_interceptor_netem_create(
+    aeron_udp_channel_interceptor_netem_t **netem, const aeron_udp_channel_interceptor_netem_params_t *params)
+{
+    aeron_udp_channel_interceptor_netem_t *_netem;
+    if (aeron_alloc((void **)&_netem, sizeof(aeron_udp_channel_interceptor_netem_t)) < 0)
+    {
+        AERON_APPEND_ERR("%s", "Unable to allocate netem interceptor");
+        return -1;
+    }
+
+    _netem->params = *params;
+    if (0 == _netem->params.tick_ns)
+    {
+        _netem->params.tick_ns = AERON_UDP_CHANNEL_INTERCEPTOR_NETEM_TICK_NS_DEFAULT;
+    }
+
+    _netem->xsubi[2] = (unsigned short)(params->seed & 0xFFFF);
+    _netem->xsubi[1] = (unsigned short)((params->seed >> 16) & 0xFFFF);
+    _netem->xsubi[0] = (unsigned short)((params->seed >> 32) & 0xFFFF);
+
+    *netem = _netem;
+
+    return 0;
+}
+
+int aeron_udp_channel_interceptor_netem_close(void *interceptor_state)
+{
+    aeron_udp_channel_interceptor_netem_t *netem = (aeron_udp_channel_interceptor_netem_t *)interceptor_state;
+    if (NULL == netem)
+    {
+        return 0;
+    }
+
+    for (size_t i = 0; i < AERON_UDP_CHANNEL_INTERCEPTOR_NETEM_WHEEL_LENGTH; i++)
+    {
+        aeron_udp_channel_interceptor_netem_datagram_t *datagram = netem->heads[i];
+        while (NULL != datagram)
+        {
+            aeron_udp_channel_interceptor_netem_datagram_t *next = datagram->next;
+            aeron_free(datagram);
+            datagram = next;
+        }
+    }
+
+    aeron_free(netem);
+
+    return 0;
+}
+
+static bool aeron_udp_channel_interceptor_netem_matches(
+    aeron_udp_channel_interceptor_netem_t *netem, const uint8_t *buffer, size_t length)
+{
+    if (length < sizeof(aeron_frame_header_t))
+    {
+        return false;
+    }
+
+    const aeron_frame_header_t *frame_header = (const aeron_frame_header_t *)buffer;
+
+    return 0 != ((1UL << (unsigned int)frame_header->type) & netem->params.msg_type_mask);
+}
+
+static int64_t aeron_udp_channel_interceptor_netem_delay_ns(aeron_udp_channel_interceptor_netem_t *netem)
+{
+    const double delay_ns = (double)netem->params.delay_ns;
+    const double jitter_ns = (double)netem->params.jitter_ns;
+    double sample_ns = delay_ns;
+
+    if (jitter_ns > 0.0)
+    {
+        if (AERON_UDP_CHANNEL_INTERCEPTOR_NETEM_DISTRIBUTION_NORMAL == netem->params.distribution)
+        {
+            // Box-Muller with jitter as the standard deviation
+            const double u1 = 1.0 - aeron_erand48(netem->xsubi);
+            const double u2 = aeron_erand48(netem->xsubi);
+            sample_ns += jitter_ns * sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+        }
+        else
+        {
+            sample_ns += jitter_ns * ((2.0 * aeron_erand48(netem->xsubi)) - 1.0);
+        }
+    }
+
+    return sample_ns > 0.0 ? (int64_t)sample_ns : 0;
+}
+
+static int64_t aeron_udp_channel_interceptor_netem_deadline_ns(
+    aeron_udp_channel_interceptor_netem_t *netem, size_t length)
+{
+    int64_t departure_ns = netem->now_ns;
+
+    if (0 != netem->params.rate_bytes_per_sec)
+    {
+        const int64_t start_ns = netem->link_free_ns > netem->now_ns ? netem->link_free_ns : netem->now_ns;
+        const uint64_t rate = netem->params.rate_bytes_per_sec;
+        const int64_t serialisation_ns = (int64_t)(
+            (((uint64_t)length * AERON_UDP_CHANNEL_INTERCEPTOR_NETEM_SECOND_IN_NS) + rate - 1) / rate);
+
+        netem->link_free_ns = start_ns + serialisation_ns;
+        departure_ns = netem->link_free_ns;
+    }
+
+    if (netem->params.reorder_rate > 0.0 && aeron_erand48(netem->xsubi) < netem->params.reorder_rate)
+    {
+        return departure_ns;
+    }
+
+    return departure_ns + aeron_udp_channel_interceptor_netem_delay_ns(netem);
+}
+
+static void aeron_udp_channel_interceptor_netem_release(aeron_udp_channel_interceptor_netem_datagram_t *datagram)
+{
+    if (NULL != datagram->outgoing_delegate)
+    {
+        aeron_udp_channel_outgoing_interceptor_t *delegate = datagram->outgoing_delegate;
+        struct iovec iov;
+        int64_t bytes_sent = 0;
+
+        iov.iov_base = datagram->buffer;
+        iov.iov_len = (uint32_t)datagram->length;
+
+        // a failed send is a datagram lost on the emulated link
+        delegate->outgoing_send_func(
+            delegate->interceptor_state,
+            delegate->next_interceptor,
+            datagram->transport,
+            &datagram->addr,
+            &iov,
+            1,
+            &bytes_sent);
+    }
+    else
+    {
+        aeron_udp_channel_incoming_interceptor_t *delegate = datagram->incoming_delegate;
+
+        delegate->incoming_func(
+            delegate->interceptor_state,
+            delegate->next_interceptor,
+            datagram->transport,
+            datagram->receiver_clientd,
+            datagram->endpoint_clientd,
+            datagram->destination_clientd,
+            datagram->buffer,
+            datagram->length,
+            &datagram->addr,
+            datagram->has_media_timestamp ? &datagram->media_timestamp : NULL);
+    }
+}
+
+/*
+ * Take a copy of the datagram and schedule it, or hand it straight on if it is already due. Returns -1 if the copy
+ * could not be allocated, 0 if it was dropped because the queue limit was reached, and 1 otherwise.
+ */
+static int aeron_udp_channel_interceptor_netem_offer(
+    aeron_udp_channel_interceptor_netem_t *netem, aeron_udp_channel_interceptor_netem_datagram_t *datagram)
+{
+    if (0 != netem->params.limit_length &&
+        netem->queued_length + datagram->length > netem->params.limit_length)
+    {
+        return 0;
+    }
+
+    const int copies = netem->params.duplicate_rate > 0.0 &&
+        aeron_erand48(netem->xsubi) < netem->params.duplicate_rate ? 2 : 1;
+
+    for (int i = 0; i < copies; i++)
+    {
+        const int64_t deadline_ns = aeron_udp_channel_interceptor_netem_deadline_ns(netem, datagram->length);
+        if (deadline_ns <= netem->now_ns)
+        {
+            aeron_udp_channel_interceptor_netem_release(datagram);
+            continue;
+        }
+
+        aeron_udp_channel_interceptor_netem_datagram_t *copy;
+        if (aeron_alloc((void **)&copy, sizeof(aeron_udp_channel_interceptor_netem_datagram_t) + datagram->length) < 0)
+        {
+            AERON_APPEND_ERR("%s", "Unable to hold back datagram in netem interceptor");
+            return -1;
+        }
+
+        *copy = *datagram;
+        copy->buffer = (uint8_t *)(copy + 1);
+        copy->next = NULL;
+        copy->deadline_ns = deadline_ns;
+        memcpy(copy->buffer, datagram->buffer, datagram->length);
+
+        const size_t slot = (size_t)(deadline_ns / (int64_t)netem->params.tick_ns) &
+            AERON_UDP_CHANNEL_INTERCEPTOR_NETEM_WHEEL_MASK;
+        if (NULL == netem->tails[slot])
+        {
+            netem->heads[slot] = copy;
+        }
+        else
+        {
+            netem->tails[slot]->next = copy;
+        }
+        netem->tails[slot] = copy;
+
+        netem->queued_length += copy->length;
+        netem->queued_count++;
+    }
+
+    return 1;
+}
+
+int aeron_udp_channel_interceptor_netem_outgoing_send(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct sockaddr_storage *address,
+    struct iovec *iov,
+    size_t iov_length,
+    int64_t *bytes_sent)
+{
+    aeron_udp_channel_interceptor_netem_t *netem = (aeron_udp_channel_interceptor_netem_t *)interceptor_state;
+
+    for (size_t i = 0; i < iov_length; i++)
+    {
+        uint8_t *buffer = (uint8_t *)iov[i].iov_base;
+        const size_t length = (size_t)iov[i].iov_len;
+
+        if (!aeron_udp_channel_interceptor_netem_matches(netem, buffer, length))
+        {
+            if (delegate->outgoing_send_func(
+                delegate->interceptor_state,
+                delegate->next_interceptor,
+                transport,
+                address,
+                &iov[i],
+                1,
+                bytes_sent) < 0)
+            {
+                return -1;
+            }
+
+            continue;
+        }
+
+        aeron_udp_channel_interceptor_netem_datagram_t datagram = { 0 };
+        datagram.transport = transport;
+        datagram.outgoing_delegate = delegate;
+        datagram.addr = *address;
+        datagram.buffer = buffer;
+        datagram.length = length;
+
+        if (aeron_udp_channel_interceptor_netem_offer(netem, &datagram) < 0)
+        {
+            return -1;
+        }
+
+        *bytes_sent += (int64_t)length;
+    }
+
+    return (int)iov_length;
+}
+
+void aeron_udp_channel_interceptor_netem_incoming(
+    void *interceptor_state,
+    aeron_udp_channel_incoming_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    void *receiver_clientd,
+    void *endpoint_clientd,
+    void *destination_clientd,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr,
+    struct timespec *media_timestamp)
+{
+    aeron_udp_channel_interceptor_netem_t *netem = (aeron_udp_channel_interceptor_netem_t *)interceptor_state;
+
+    if (!aeron_udp_channel_interceptor_netem_matches(netem, buffer, length))
+    {
+        delegate->incoming_func(
+            delegate->interceptor_state,
+            delegate->next_interceptor,
+            transport,
+            receiver_clientd,
+            endpoint_clientd,
+            destination_clientd,
+            buffer,
+            length,
+            addr,
+            media_timestamp);
+        return;
+    }
+
+    aeron_udp_channel_interceptor_netem_datagram_t datagram = { 0 };
+    datagram.transport = transport;
+    datagram.incoming_delegate = delegate;
+    datagram.receiver_clientd = receiver_clientd;
+    datagram.endpoint_clientd = endpoint_clientd;
+    datagram.destination_clientd = destination_clientd;
+    datagram.addr = *addr;
+    datagram.buffer = buffer;
+    datagram.length = length;
+    if (NULL != media_timestamp)
+    {
+        datagram.media_timestamp = *media_timestamp;
+        datagram.has_media_timestamp = true;
+    }
+
+    // there is no way to push back on receipt so a failed copy is a loss
+    aeron_udp_channel_interceptor_netem_offer(netem, &datagram);
+}
+
+int aeron_udp_channel_interceptor_netem_poll(void *interceptor_state, int64_t now_ns)
+{
+    aeron_udp_channel_interceptor_netem_t *netem = (aeron_udp_channel_interceptor_netem_t *)interceptor_state;
+    const int64_t now_tick = now_ns / (int64_t)netem->params.tick_ns;
+    int work_count = 0;
+
+    netem->now_ns = now_ns;
+
+    if (0 != netem->queued_count)
+    {
+        int64_t ticks = (now_tick - netem->current_tick) + 1;
+        ticks = ticks < AERON_UDP_CHANNEL_INTERCEPTOR_NETEM_WHEEL_LENGTH ?
+            ticks : AERON_UDP_CHANNEL_INTERCEPTOR_NETEM_WHEEL_LENGTH;
+
+        for (int64_t tick = netem->current_tick, end = netem->current_tick + ticks; tick < end; tick++)
+        {
+            const size_t slot = (size_t)tick & AERON_UDP_CHANNEL_INTERCEPTOR_NETEM_WHEEL_MASK;
+            aeron_udp_channel_interceptor_netem_datagram_t *previous = NULL;
+            aeron_udp_channel_interceptor_netem_datagram_t *datagram = netem->heads[slot];
+
+            while (NULL != datagram)
+            {
+                aeron_udp_channel_interceptor_netem_datagram_t *next = datagram->next;
+
+                if (datagram->deadline_ns <= now_ns)
+                {
+                    if (NULL == previous)
+                    {
+                        netem->heads[slot] = next;
+                    }
+                    else
+                    {
+                        previous->next = next;
+                    }
+
+                    if (datagram == netem->tails[slot])
+                    {
+                        netem->tails[slot] = previous;
+                    }
+
+                    netem->queued_length -= datagram->length;
+                    netem->queued_count--;
+
+                    aeron_udp_channel_interceptor_netem_release(datagram);
+                    aeron_free(datagram);
+                    work_count++;
+                }
+                else
+                {
+                    previous = datagram;
+                }
+
+                datagram = next;
+            }
+        }
+    }
+
+    netem->current_tick = now_tick;
+
+    return work_count;
+}
+
+int aeron_udp_channel_interceptor_netem_transport_notification(
+    void *interceptor_state,
+    aeron_udp_channel_transport_t *transport,
+    const aeron_udp_channel_t *udp_channel,
+    aeron_data_packet_dispatcher_t *data_packet_dispatcher,
+    aeron_udp_channel_interceptor_notification_type_t type)
+{
+    aeron_udp_channel_interceptor_netem_t *netem = (aeron_udp_channel_interceptor_netem_t *)interceptor_state;
+
+    if (AERON_UDP_CHANNEL_INTERCEPTOR_REMOVE_NOTIFICATION != type || 0 == netem->queued_count)
+    {
+        return 0;
+    }
+
+    for (size_t slot = 0; slot < AERON_UDP_CHANNEL_INTERCEPTOR_NETEM_WHEEL_LENGTH; slot++)
+    {
+        aeron_udp_channel_interceptor_netem_datagram_t *previous = NULL;
+        aeron_udp_channel_interceptor_netem_datagram_t *datagram = netem->heads[slot];
+
+        while (NULL != datagram)
+        {
+            aeron_udp_channel_interceptor_netem_datagram_t *next = datagram->next;
+
+            if (transport == datagram->transport)
+            {
+                if (NULL == previous)
+                {
+                    netem->heads[slot] = next;
+                }
+                else
+                {
+                    previous->next = next;
+                }
+
+                if (datagram == netem->tails[slot])
+                {
+                    netem->tails[slot] = previous;
+                }
+
+                netem->queued_length -= datagram->length;
+                netem->queued_count--;
+                aeron_free(datagram);
+            }
+            else
+            {
+                previous = datagram;
+            }
+
+            datagram = next;
+        }
+    }
+
+    return 0;
+}
+
+int aeron_udp_channel_interceptor_netem_parse_params(char *uri, aeron_udp_channel_interceptor_netem_params_t *params)
+{
+    memset(params, 0, sizeof(aeron_udp_channel_interceptor_netem_params_t));
+    params->tick_ns = AERON_UDP_CHANNEL_INTERCEPTOR_NETEM_TICK_NS_DEFAULT;
+    params->msg_type_mask = ~0UL;
+
+    return aeron_uri_parse_params(uri, aeron_udp_channel_interceptor_netem_parse_callback, (void *)params);
+}
+
+static int aeron_udp_channel_interceptor_netem_parse_rate(const char *key, const char *value, double *rate)
+{
+    errno = 0;
+    char *endptr;
+    *rate = strtod(value, &endptr);
+
+    if (errno != 0 || value == endptr || *rate < 0.0 || *rate > 1.0)
+    {
+        AERON_SET_ERR(EINVAL, "Could not parse netem %s from: %s", key, value);
+        return -1;
+    }
+
+    return 0;
+}
+
+int aeron_udp_channel_interceptor_netem_parse_callback(void *clientd, const char *key, const char *value)
+{
+    aeron_udp_channel_interceptor_netem_params_t *params = clientd;
+
+    if (0 == strcmp(key, "delay") || 0 == strcmp(key, "jitter") || 0 == strcmp(key, "tick"))
+    {
+        uint64_t duration_ns;
+        if (aeron_parse_duration_ns(value, &duration_ns) < 0 || (0 == duration_ns && 0 == strcmp(key, "tick")))
+        {
+            AERON_SET_ERR(EINVAL, "Could not parse netem %s from: %s", key, value);
+            return -1;
+        }
+
+        if ('d' == key[0])
+        {
+            params->delay_ns = duration_ns;
+        }
+        else if ('j' == key[0])
+        {
+            params->jitter_ns = duration_ns;
+        }
+        else
+        {
+            params->tick_ns = duration_ns;
+        }
+    }
+    else if (0 == strcmp(key, "distribution"))
+    {
+        if (0 == strcmp(value, "uniform"))
+        {
+            params->distribution = AERON_UDP_CHANNEL_INTERCEPTOR_NETEM_DISTRIBUTION_UNIFORM;
+        }
+        else if (0 == strcmp(value, "normal"))
+        {
+            params->distribution = AERON_UDP_CHANNEL_INTERCEPTOR_NETEM_DISTRIBUTION_NORMAL;
+        }
+        else
+        {
+            AERON_SET_ERR(EINVAL, "Unknown netem distribution: %s", value);
+            return -1;
+        }
+    }
+    else if (0 == strcmp(key, "reorder"))
+    {
+        return aeron_udp_channel_interceptor_netem_parse_rate(key, value, &params->reorder_rate);
+    }
+    else if (0 == strcmp(key, "duplicate"))
+    {
+        return aeron_udp_channel_interceptor_netem_parse_rate(key, value, &params->duplicate_rate);
+    }
+    else if (0 == strcmp(key, "rate") || 0 == strcmp(key, "limit"))
+    {
+        uint64_t size;
+        if (aeron_parse_size64(value, &size) < 0)
+        {
+            AERON_SET_ERR(EINVAL, "Could not parse netem %s from: %s", key, value);
+            return -1;
+        }
+
+        if ('r' == key[0])
+        {
+            params->rate_bytes_per_sec = size;
+        }
+        else
+        {
+            params->limit_length = size;
+        }
+    }
+    else if (0 == strcmp(key, "msg-mask"))
+    {
+        errno = 0;
+        char *endptr;
+        params->msg_type_mask = strtoul(value, &endptr, 16);
+
+        if (errno != 0 || value == endptr)
+        {
+            AERON_SET_ERR(EINVAL, "Could not parse netem %s from: %s", key, value);
+            return -1;
+        }
+    }
+    else if (0 == strcmp(key, "seed"))
+    {
+        errno = 0;
+        char *endptr;
+        params->seed = strtoull(value, &endptr, 10);
+
+        if (errno != 0 || value == endptr)
+        {
+            AERON_SET_ERR(EINVAL, "Could not parse netem %s from: %s", key, value);
+            return -1;
+        }
+    }
+    else
+    {
+        AERON_SET_ERR(EINVAL, "Unknown netem param: %s", key);
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef AERON_UDP_CHANNEL_TRANSPORT_NETEM_H
+#define AERON_UDP_CHANNEL_TRANSPORT_NETEM_H
+
+#include "aeron_udp_channel_transport_bindings.h"
+
+#define AERON_UDP_CHANNEL_INTERCEPTOR_NETEM_WHEEL_LENGTH (4096)
+#define AERON_UDP_CHANNEL_INTERCEPTOR_NETEM_TICK_NS_DEFAULT (10 * 1000LL)
+
+typedef enum aeron_udp_channel_interceptor_netem_distribution_en
+{
+    AERON_UDP_CHANNEL_INTERCEPTOR_NETEM_DISTRIBUTION_UNIFORM,
+    AERON_UDP_CHANNEL_INTERCEPTOR_NETEM_DISTRIBUTION_NORMAL
+}
+aeron_udp_channel_interceptor_netem_distribution_t;
+
+/*
+ * Delay and jitter are applied after any serialisation delay from the rate. Reordered datagrams skip the delay,
+ * duplicates are scheduled independently, and datagrams which would take the queued length beyond the limit are
+ * dropped. A rate or limit of 0 is unbounded.
+ */
+typedef struct aeron_udp_channel_interceptor_netem_params_stct
+{
+    uint64_t delay_ns;
+    uint64_t jitter_ns;
+    aeron_udp_channel_interceptor_netem_distribution_t distribution;
+    double reorder_rate;
+    double duplicate_rate;
+    uint64_t rate_bytes_per_sec;
+    uint64_t limit_length;
+    uint64_t tick_ns;
+    unsigned long msg_type_mask;
+    unsigned long long seed;
+}
+aeron_udp_channel_interceptor_netem_params_t;
+
+typedef struct aeron_udp_channel_interceptor_netem_datagram_stct aeron_udp_channel_interceptor_netem_datagram_t;
+
+/*
+ * Held back datagrams sit in a hashed timing wheel which the owning agent advances from its duty cycle.
+ */
+typedef struct aeron_udp_channel_interceptor_netem_stct
+{
+    aeron_udp_channel_interceptor_netem_params_t params;
+    aeron_udp_channel_interceptor_netem_datagram_t *heads[AERON_UDP_CHANNEL_INTERCEPTOR_NETEM_WHEEL_LENGTH];
+    aeron_udp_channel_interceptor_netem_datagram_t *tails[AERON_UDP_CHANNEL_INTERCEPTOR_NETEM_WHEEL_LENGTH];
+    int64_t now_ns;
+    int64_t current_tick;
+    int64_t link_free_ns;
+    size_t queued_length;
+    size_t queued_count;
+    unsigned short xsubi[3];
+}
+aeron_udp_channel_interceptor_netem_t;
+
+aeron_udp_channel_interceptor_bindings_t *aeron_udp_channel_interceptor_netem_load(
+    aeron_udp_channel_interceptor_bindings_t *delegate_bindings);
+
+int aeron_udp_channel_interceptor_netem_create(
+    aeron_udp_channel_interceptor_netem_t **netem, const aeron_udp_channel_interceptor_netem_params_t *params);
+
+int aeron_udp_channel_interceptor_netem_close(void *interceptor_state);
+
+int aeron_udp_channel_interceptor_netem_outgoing_send(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct sockaddr_storage *address,
+    struct iovec *iov,
+    size_t iov_length,
+    int64_t *bytes_sent);
+
+void aeron_udp_channel_interceptor_netem_incoming(
+    void *interceptor_state,
+    aeron_udp_channel_incoming_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    void *receiver_clientd,
+    void *endpoint_clientd,
+    void *destination_clientd,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr,
+    struct timespec *media_timestamp);
+
+/*
+ * Advance to now_ns and release every held back datagram which is due. Returns the number released.
+ */
+int aeron_udp_channel_interceptor_netem_poll(void *interceptor_state, int64_t now_ns);
+
+int aeron_udp_channel_interceptor_netem_transport_notification(
+    void *interceptor_state,
+    aeron_udp_channel_transport_t *transport,
+    const aeron_udp_channel_t *udp_channel,
+    aeron_data_packet_dispatcher_t *data_packet_dispatcher,
+    aeron_udp_channel_interceptor_notification_type_t type);
+
+int aeron_udp_channel_interceptor_netem_parse_params(char *uri, aeron_udp_channel_interceptor_netem_params_t *params);
+
+int aeron_udp_channel_interceptor_netem_parse_callback(void *clientd, const char *key, const char *value);
+
+#endif //AERON_UDP_CHANNEL_TRANSPORT_NETEM_H
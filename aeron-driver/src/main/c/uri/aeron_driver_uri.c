@@ -136,6 +136,131 @@ int aeron_uri_subscription_session_id_param(aeron_uri_params_t *uri_params, aero
     return result < 0 ? -1 : 0;
 }
 
+static int aeron_driver_uri_get_pacing_params(
+    aeron_uri_t *uri,
+    aeron_uri_params_t *uri_params,
+    aeron_driver_context_t *context,
+    aeron_driver_uri_publication_params_t *params)
+{
+    const char *rate_str = aeron_uri_find_param_value(uri_params, AERON_URI_RATE_KEY);
+    const char *burst_str = aeron_uri_find_param_value(uri_params, AERON_URI_BURST_KEY);
+    uint64_t value;
+
+    if (AERON_URI_IPC == uri->type && (NULL != rate_str || NULL != burst_str))
+    {
+        AERON_SET_ERR(
+            EINVAL,
+            "%s and %s are not supported for IPC publications",
+            AERON_URI_RATE_KEY,
+            AERON_URI_BURST_KEY);
+        return -1;
+    }
+
+    if (NULL != rate_str)
+    {
+        if (-1 == aeron_parse_size64(rate_str, &value) || 0 == value)
+        {
+            AERON_SET_ERR(EINVAL, "could not parse %s=%s in URI", AERON_URI_RATE_KEY, rate_str);
+            return -1;
+        }
+
+        params->rate_bytes_per_sec = value;
+        params->burst_length = params->mtu_length * context->network_publication_max_messages_per_send;
+    }
+
+    if (NULL != burst_str)
+    {
+        if (NULL == rate_str)
+        {
+            AERON_SET_ERR(EINVAL, "%s requires %s to be set", AERON_URI_BURST_KEY, AERON_URI_RATE_KEY);
+            return -1;
+        }
+
+        if (-1 == aeron_parse_size64(burst_str, &value))
+        {
+            AERON_SET_ERR(EINVAL, "could not parse %s=%s in URI", AERON_URI_BURST_KEY, burst_str);
+            return -1;
+        }
+
+        if (value < params->mtu_length || value > INT32_MAX)
+        {
+            AERON_SET_ERR(
+                EINVAL,
+                "%s=%" PRIu64 " must be at least %s=%" PRIu64 " and no more than %" PRId32,
+                AERON_URI_BURST_KEY,
+                value,
+                AERON_URI_MTU_LENGTH_KEY,
+                (uint64_t)params->mtu_length,
+                INT32_MAX);
+            return -1;
+        }
+
+        params->burst_length = (size_t)value;
+        params->has_burst_length = true;
+    }
+
+    return 0;
+}
+
+static int aeron_driver_uri_get_fec_param(
+    aeron_uri_params_t *uri_params, aeron_driver_uri_publication_params_t *params)
+{
+    const char *fec_str = aeron_uri_find_param_value(uri_params, AERON_URI_FEC_KEY);
+    if (NULL == fec_str)
+    {
+        return 0;
+    }
+
+    errno = 0;
+    char *end_ptr;
+    long value = strtol(fec_str, &end_ptr, 10);
+    if (0 != errno || '\0' != *end_ptr || value < 1 || value > AERON_FEC_MAX_DATAGRAMS)
+    {
+        AERON_SET_ERR(
+            EINVAL,
+            "could not parse %s=%s in URI, must be a group length from 1 to %d",
+            AERON_URI_FEC_KEY,
+            fec_str,
+            AERON_FEC_MAX_DATAGRAMS);
+        return -1;
+    }
+
+    if (params->mtu_length + sizeof(aeron_fec_header_t) > AERON_MAX_UDP_PAYLOAD_LENGTH)
+    {
+        AERON_SET_ERR(
+            EINVAL,
+            "%s=%" PRIu64 " leaves no room for the FEC header, %s requires %s of at most %" PRIu64,
+            AERON_URI_MTU_LENGTH_KEY,
+            (uint64_t)params->mtu_length,
+            AERON_URI_FEC_KEY,
+            AERON_URI_MTU_LENGTH_KEY,
+            (uint64_t)(AERON_MAX_UDP_PAYLOAD_LENGTH - sizeof(aeron_fec_header_t)));
+        return -1;
+    }
+
+    params->fec_group_length = (int32_t)value;
+
+    return 0;
+}
+
+static int aeron_driver_uri_get_huge_pages(
+    aeron_uri_params_t *uri_params, aeron_driver_context_t *context, bool *is_huge_pages)
+{
+    if (aeron_uri_get_bool(uri_params, AERON_URI_HUGE_PAGES_KEY, is_huge_pages) < 0)
+    {
+        return -1;
+    }
+
+    if (*is_huge_pages && NULL == context->huge_pages_log_dir)
+    {
+        AERON_SET_ERR(
+            EINVAL, "%s=true requires %s to be set", AERON_URI_HUGE_PAGES_KEY, AERON_HUGE_PAGES_DIR_ENV_VAR);
+        return -1;
+    }
+
+    return 0;
+}
+
 int aeron_diver_uri_publication_params(
     aeron_uri_t *uri,
     aeron_driver_uri_publication_params_t *params,
@@ -156,12 +281,18 @@ int aeron_diver_uri_publication_params(
     params->term_id = 0;
     params->has_position = false;
     params->is_sparse = context->term_buffer_sparse_file;
+    params->is_huge_pages = context->term_buffer_huge_pages;
     params->signal_eos = true;
     params->spies_simulate_connection = context->spies_simulate_connection;
     params->has_session_id = false;
     params->session_id = 0;
     params->entity_tag = AERON_URI_INVALID_TAG;
     params->response_correlation_id = AERON_NULL_VALUE;
+    params->sender_id = AERON_NULL_VALUE;
+    params->rate_bytes_per_sec = 0;
+    params->burst_length = 0;
+    params->has_burst_length = false;
+    params->fec_group_length = 0;
 
     aeron_uri_params_t *uri_params = AERON_URI_IPC == uri->type ?
         &uri->params.ipc.additional_params : &uri->params.udp.additional_params;
@@ -201,6 +332,16 @@ int aeron_diver_uri_publication_params(
         return -1;
     }
 
+    if (aeron_driver_uri_get_pacing_params(uri, uri_params, context, params) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_driver_uri_get_fec_param(uri_params, params) < 0)
+    {
+        return -1;
+    }
+
     int count = 0;
 
     int32_t initial_term_id;
@@ -298,6 +439,11 @@ int aeron_diver_uri_publication_params(
         return -1;
     }
 
+    if (aeron_driver_uri_get_huge_pages(uri_params, context, &params->is_huge_pages) < 0)
+    {
+        return -1;
+    }
+
     if (aeron_uri_get_bool(uri_params, AERON_URI_EOS_KEY, &params->signal_eos) < 0)
     {
         return -1;
@@ -314,6 +460,28 @@ int aeron_diver_uri_publication_params(
         return -1;
     }
 
+    int32_t sender_id;
+    if ((parse_result = aeron_uri_get_int32(uri_params, AERON_URI_SENDER_ID_KEY, &sender_id)) < 0)
+    {
+        return -1;
+    }
+
+    if (parse_result > 0)
+    {
+        if (sender_id < 0 || (uint32_t)sender_id >= context->sender_count)
+        {
+            AERON_SET_ERR(
+                EINVAL,
+                "%s=%" PRId32 " must be between 0 and sender count - 1 (%" PRIu32 ")",
+                AERON_URI_SENDER_ID_KEY,
+                sender_id,
+                context->sender_count);
+            return -1;
+        }
+
+        params->sender_id = sender_id;
+    }
+
     if (aeron_uri_get_timeout(
         uri_params,
         AERON_URI_UNTETHERED_WINDOW_LIMIT_TIMEOUT_KEY,
@@ -342,6 +510,7 @@ int aeron_driver_uri_subscription_params(
 
     params->is_reliable = context->reliable_stream;
     params->is_sparse = context->term_buffer_sparse_file;
+    params->is_huge_pages = context->term_buffer_huge_pages;
     params->is_tether = context->tether_subscriptions;
     params->is_rejoin = context->rejoin_stream;
     params->initial_window_length = context->initial_window_length;
@@ -359,6 +528,11 @@ int aeron_driver_uri_subscription_params(
         return -1;
     }
 
+    if (aeron_driver_uri_get_huge_pages(uri_params, context, &params->is_huge_pages) < 0)
+    {
+        return -1;
+    }
+
     if (aeron_uri_get_bool(uri_params, AERON_URI_TETHER_KEY, &params->is_tether) < 0)
     {
         return -1;
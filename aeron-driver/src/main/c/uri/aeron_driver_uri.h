@@ -25,6 +25,7 @@ typedef struct aeron_driver_uri_publication_params_stct
 {
     bool has_position;
     bool is_sparse;
+    bool is_huge_pages;
     bool signal_eos;
     bool spies_simulate_connection;
     bool has_mtu_length;
@@ -41,6 +42,11 @@ typedef struct aeron_driver_uri_publication_params_stct
     int32_t session_id;
     int64_t entity_tag;
     int64_t response_correlation_id;
+    int32_t sender_id;
+    uint64_t rate_bytes_per_sec;
+    bool has_burst_length;
+    size_t burst_length;
+    int32_t fec_group_length;
 }
 aeron_driver_uri_publication_params_t;
 
@@ -48,6 +54,7 @@ typedef struct aeron_driver_uri_subscription_params_stct
 {
     bool is_reliable;
     bool is_sparse;
+    bool is_huge_pages;
     bool is_tether;
     bool is_rejoin;
     aeron_inferable_boolean_t group;
@@ -19,16 +19,22 @@ import io.aeron.ErrorCode;
 import io.aeron.command.*;
 import io.aeron.exceptions.ControlProtocolException;
 import io.aeron.exceptions.StorageSpaceException;
+import org.agrona.BitUtil;
 import org.agrona.ErrorHandler;
+import org.agrona.ExpandableArrayBuffer;
 import org.agrona.MutableDirectBuffer;
 import org.agrona.concurrent.ControlledMessageHandler;
 import org.agrona.concurrent.ringbuffer.RingBuffer;
 import org.agrona.concurrent.status.AtomicCounter;
 
+import static io.aeron.Aeron.NULL_VALUE;
 import static io.aeron.ChannelUri.SPY_QUALIFIER;
 import static io.aeron.CommonContext.IPC_CHANNEL;
 import static io.aeron.ErrorCode.GENERIC_ERROR;
+import static io.aeron.ErrorCode.MALFORMED_COMMAND;
 import static io.aeron.ErrorCode.STORAGE_SPACE;
+import static io.aeron.ErrorCode.UNKNOWN_COMMAND_TYPE_ID;
+import static io.aeron.ErrorCode.UNUSED;
 import static io.aeron.command.ControlProtocolEvents.*;
 
 /**
@@ -43,11 +49,21 @@ final class ClientCommandAdapter implements ControlledMessageHandler
     private final DestinationMessageFlyweight destinationMsgFlyweight = new DestinationMessageFlyweight();
     private final CounterMessageFlyweight counterMsgFlyweight = new CounterMessageFlyweight();
     private final TerminateDriverFlyweight terminateDriverFlyweight = new TerminateDriverFlyweight();
+    private final BatchMessageFlyweight batchMsgFlyweight = new BatchMessageFlyweight();
+    private final BatchCompleteFlyweight batchComplete = new BatchCompleteFlyweight();
+    private final ExpandableArrayBuffer batchEntries = new ExpandableArrayBuffer(1024);
+    private final ExpandableArrayBuffer batchResponse = new ExpandableArrayBuffer(1024);
     private final DriverConductor conductor;
     private final RingBuffer toDriverCommands;
     private final ClientProxy clientProxy;
     private final AtomicCounter errors;
     private final ErrorHandler errorHandler;
+    private boolean isBatchPending;
+    private int batchEntriesLength;
+    private int batchOffset;
+    private int batchEntryCount;
+    private int batchEntryIndex;
+    private int batchResultIndex = -1;
 
     ClientCommandAdapter(
         final AtomicCounter errors,
@@ -61,27 +77,49 @@ final class ClientCommandAdapter implements ControlledMessageHandler
         this.toDriverCommands = toDriverCommands;
         this.clientProxy = clientProxy;
         this.conductor = driverConductor;
+
+        batchComplete.wrap(batchResponse, 0);
     }
 
     int receive()
     {
-        return toDriverCommands.controlledRead(this, Configuration.COMMAND_DRAIN_LIMIT);
+        int workCount = 0;
+
+        if (isBatchPending)
+        {
+            workCount += processBatch();
+        }
+
+        if (!isBatchPending)
+        {
+            workCount += toDriverCommands.controlledRead(this, Configuration.COMMAND_DRAIN_LIMIT);
+        }
+
+        return workCount;
     }
 
     /**
      * {@inheritDoc}
      */
-    @SuppressWarnings("MethodLength")
     public ControlledMessageHandler.Action onMessage(
         final int msgTypeId, final MutableDirectBuffer buffer, final int index, final int length)
     {
-        long correlationId = 0;
-
         if (conductor.notAcceptingClientCommands())
         {
             return Action.ABORT;
         }
 
+        onCommand(msgTypeId, buffer, index, length);
+
+        return isBatchPending ? Action.BREAK : Action.CONTINUE;
+    }
+
+    @SuppressWarnings("MethodLength")
+    private ErrorCode onCommand(
+        final int msgTypeId, final MutableDirectBuffer buffer, final int index, final int length)
+    {
+        long correlationId = 0;
+
         try
         {
             switch (msgTypeId)
@@ -263,21 +301,125 @@ final class ClientCommandAdapter implements ControlledMessageHandler
                     break;
                 }
 
+                case BATCH:
+                {
+                    batchMsgFlyweight.wrap(buffer, index);
+                    batchMsgFlyweight.validateLength(msgTypeId, length);
+
+                    correlationId = batchMsgFlyweight.correlationId();
+                    onBatch(buffer, correlationId);
+                    break;
+                }
+
                 default:
                 {
                     final ControlProtocolException ex = new ControlProtocolException(
-                        ErrorCode.UNKNOWN_COMMAND_TYPE_ID, "command typeId=" + msgTypeId);
+                        UNKNOWN_COMMAND_TYPE_ID, "command typeId=" + msgTypeId);
 
-                    onError(correlationId, ex);
+                    return onError(correlationId, ex);
                 }
             }
         }
         catch (final Exception ex)
         {
-            onError(correlationId, ex);
+            return onError(correlationId, ex);
+        }
+
+        return UNUSED;
+    }
+
+    private void onBatch(final MutableDirectBuffer buffer, final long correlationId)
+    {
+        final int entryCount = batchMsgFlyweight.entryCount();
+        final int entriesLength = batchMsgFlyweight.entriesLength();
+
+        if (entryCount < 0 || entryCount > entriesLength / BatchMessageFlyweight.MIN_ALIGNED_ENTRY_LENGTH)
+        {
+            throw new ControlProtocolException(
+                MALFORMED_COMMAND, "batch entryCount=" + entryCount + " invalid for entriesLength=" + entriesLength);
+        }
+
+        batchEntries.putBytes(0, buffer, batchMsgFlyweight.entriesOffset(), entriesLength);
+        batchComplete.correlationId(correlationId).resultCount(entryCount);
+        for (int i = 0; i < entryCount; i++)
+        {
+            batchComplete.resultCorrelationId(i, NULL_VALUE).resultErrorCode(i, MALFORMED_COMMAND);
+        }
+
+        isBatchPending = true;
+        batchEntriesLength = entriesLength;
+        batchOffset = 0;
+        batchEntryCount = entryCount;
+        batchEntryIndex = 0;
+        batchResultIndex = -1;
+
+        processBatch();
+    }
+
+    private int processBatch()
+    {
+        int workCount = 0;
+
+        while (!conductor.notAcceptingClientCommands() && !conductor.asyncClientCommandInFlight())
+        {
+            if (batchEntryIndex >= batchEntryCount)
+            {
+                batchResultIndex = -1;
+                isBatchPending = false;
+                clientProxy.onBatchComplete(batchResponse, 0, batchComplete.length());
+                break;
+            }
+
+            final int remaining = batchEntriesLength - batchOffset;
+            final int entryLength = remaining < BatchMessageFlyweight.ENTRY_HEADER_LENGTH ?
+                0 : batchEntries.getInt(batchOffset + BatchMessageFlyweight.ENTRY_LENGTH_OFFSET);
+
+            if (entryLength < CorrelatedMessageFlyweight.LENGTH ||
+                entryLength > remaining - BatchMessageFlyweight.ENTRY_HEADER_LENGTH)
+            {
+                logError(new ControlProtocolException(
+                    MALFORMED_COMMAND, "batch entry=" + batchEntryIndex + " malformed: remaining=" + remaining));
+
+                batchEntryIndex = batchEntryCount;
+                continue;
+            }
+
+            final int msgTypeId = batchEntries.getInt(batchOffset + BatchMessageFlyweight.ENTRY_TYPE_ID_OFFSET);
+            final int messageOffset = batchOffset + BatchMessageFlyweight.ENTRY_HEADER_LENGTH;
+            final long correlationId = correlatedMsgFlyweight.wrap(batchEntries, messageOffset).correlationId();
+            final int resultIndex = batchEntryIndex;
+
+            batchComplete.resultCorrelationId(resultIndex, correlationId).resultErrorCode(resultIndex, UNUSED);
+            batchResultIndex = resultIndex;
+            batchOffset += BitUtil.align(
+                BatchMessageFlyweight.ENTRY_HEADER_LENGTH + entryLength, BatchMessageFlyweight.ENTRY_ALIGNMENT);
+            batchEntryIndex++;
+            workCount++;
+
+            switch (msgTypeId)
+            {
+                case ADD_PUBLICATION:
+                case ADD_EXCLUSIVE_PUBLICATION:
+                case REMOVE_PUBLICATION:
+                case ADD_SUBSCRIPTION:
+                case REMOVE_SUBSCRIPTION:
+                case ADD_COUNTER:
+                case REMOVE_COUNTER:
+                    batchComplete.resultErrorCode(
+                        resultIndex, onCommand(msgTypeId, batchEntries, messageOffset, entryLength));
+                    break;
+
+                default:
+                {
+                    final ControlProtocolException ex = new ControlProtocolException(
+                        UNKNOWN_COMMAND_TYPE_ID, "command=" + msgTypeId + " not supported in batch");
+
+                    batchComplete.resultErrorCode(resultIndex, onError(correlationId, ex));
+                }
+            }
         }
 
-        return Action.CONTINUE;
+        return workCount;
     }
 
     private void addPublication(final long correlationId, final boolean isExclusive)
@@ -296,27 +438,43 @@ final class ClientCommandAdapter implements ControlledMessageHandler
         }
     }
 
-    void onError(final long correlationId, final Exception error)
+    ErrorCode onError(final long correlationId, final Exception error)
     {
-        if (!errors.isClosed())
-        {
-            errors.increment();
-        }
-
-        errorHandler.onError(error);
+        logError(error);
 
+        final ErrorCode errorCode;
         if (error instanceof ControlProtocolException)
         {
-            clientProxy.onError(correlationId, ((ControlProtocolException)error).errorCode(), error.getMessage());
+            errorCode = ((ControlProtocolException)error).errorCode();
+            clientProxy.onError(correlationId, errorCode, error.getMessage());
         }
         else if (error instanceof StorageSpaceException || StorageSpaceException.isStorageSpaceError(error))
         {
-            clientProxy.onError(correlationId, STORAGE_SPACE, error.getMessage());
+            errorCode = STORAGE_SPACE;
+            clientProxy.onError(correlationId, errorCode, error.getMessage());
         }
         else
         {
+            errorCode = GENERIC_ERROR;
             final String errorMessage = error.getClass().getName() + " : " + error.getMessage();
-            clientProxy.onError(correlationId, GENERIC_ERROR, errorMessage);
+            clientProxy.onError(correlationId, errorCode, errorMessage);
+        }
+
+        if (batchResultIndex >= 0 && batchComplete.resultCorrelationId(batchResultIndex) == correlationId)
+        {
+            batchComplete.resultErrorCode(batchResultIndex, errorCode);
         }
+
+        return errorCode;
+    }
+
+    private void logError(final Exception error)
+    {
+        if (!errors.isClosed())
+        {
+            errors.increment();
+        }
+
+        errorHandler.onError(error);
     }
 }
@@ -162,6 +162,11 @@ final class ClientProxy
         transmit(ON_CLIENT_TIMEOUT, buffer, 0, ClientTimeoutFlyweight.LENGTH);
     }
 
+    void onBatchComplete(final DirectBuffer buffer, final int index, final int length)
+    {
+        transmit(ON_BATCH_COMPLETE, buffer, index, length);
+    }
+
     private void transmit(final int msgTypeId, final DirectBuffer buffer, final int index, final int length)
     {
         transmitter.transmit(msgTypeId, buffer, index, length);
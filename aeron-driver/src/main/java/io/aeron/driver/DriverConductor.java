@@ -270,6 +270,11 @@ public final class DriverConductor implements Agent
         return senderProxy.isApplyingBackpressure() || receiverProxy.isApplyingBackpressure();
     }
 
+    boolean asyncClientCommandInFlight()
+    {
+        return asyncClientCommandInFlight;
+    }
+
     @SuppressWarnings("MethodLength")
     void onCreatePublicationImage(
         final int sessionId,
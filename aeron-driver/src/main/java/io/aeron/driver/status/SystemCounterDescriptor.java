@@ -204,7 +204,22 @@ public enum SystemCounterDescriptor
     /**
      * The total number of bytes currently mapped in log buffers, CnC file, and loss report.
      */
-    BYTES_CURRENTLY_MAPPED(35, "Bytes currently mapped");
+    BYTES_CURRENTLY_MAPPED(35, "Bytes currently mapped"),
+
+    /**
+     * Count of NAKs absorbed into a retransmit already requested by another receiver.
+     */
+    NAKS_COALESCED(36, "NAKs coalesced"),
+
+    /**
+     * Count of NAKs repeated by a receiver while the retransmit it requested is still in progress.
+     */
+    NAKS_SUPPRESSED(37, "NAKs suppressed"),
+
+    /**
+     * Count of datagrams lost by the network which a receiver rebuilt from forward error correction parity.
+     */
+    FEC_RECOVERED_DATAGRAMS(38, "FEC recovered datagrams");
 
     /**
      * All system counters have the same type id, i.e. system counters are the same type. Other types can exist.
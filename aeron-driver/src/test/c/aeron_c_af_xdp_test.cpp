@@ -0,0 +1,280 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fcntl.h>
+#include <sched.h>
+#include <unistd.h>
+
+#include <functional>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "aeronc.h"
+#include "EmbeddedMediaDriver.h"
+
+extern "C"
+{
+#include "util/aeron_env.h"
+#include "media/aeron_udp_channel_transport_af_xdp.h"
+}
+
+#define NETNS_PUB "aeron_xdp_pub"
+#define NETNS_SUB "aeron_xdp_sub"
+#define VETH_NAME "aeronxdp0"
+#define PUB_ADDR "10.211.0.1"
+#define SUB_ADDR "10.211.0.2"
+#define CHANNEL "aeron:udp?endpoint=" SUB_ADDR ":24325"
+#define STREAM_ID (117)
+
+static bool run(const std::string &command)
+{
+    return 0 == std::system((command + " > /dev/null 2>&1").c_str());
+}
+
+/*
+ * Runs a publishing and a subscribing driver in their own network namespaces joined by a veth pair, so traffic
+ * between them crosses the veth and is seen by the XDP programs in generic (SKB) mode. Requires root.
+ */
+class CAfXdpTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        if (0 != geteuid())
+        {
+            GTEST_SKIP() << "AF_XDP test requires root";
+        }
+
+        tearDownNetwork();
+        if (!run("ip netns add " NETNS_PUB) ||
+            !run("ip netns add " NETNS_SUB) ||
+            !run("ip link add " VETH_NAME " netns " NETNS_PUB " type veth peer name " VETH_NAME " netns " NETNS_SUB) ||
+            !run("ip -n " NETNS_PUB " addr add " PUB_ADDR "/24 dev " VETH_NAME) ||
+            !run("ip -n " NETNS_SUB " addr add " SUB_ADDR "/24 dev " VETH_NAME) ||
+            !run("ip -n " NETNS_PUB " link set " VETH_NAME " up") ||
+            !run("ip -n " NETNS_SUB " link set " VETH_NAME " up"))
+        {
+            tearDownNetwork();
+            GTEST_SKIP() << "unable to create veth pair between network namespaces";
+        }
+
+        m_networkCreated = true;
+        aeron_env_set(AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_AF_XDP_ARGS_ENV_VAR, "interface=" VETH_NAME "|mode=skb");
+
+        m_pubDriver = startDriverInNamespace(NETNS_PUB, m_pubDir);
+        m_subDriver = startDriverInNamespace(NETNS_SUB, m_subDir);
+    }
+
+    void TearDown() override
+    {
+        closeClient(m_pubAeron, m_pubContext);
+        closeClient(m_subAeron, m_subContext);
+
+        for (auto *driver : { m_pubDriver.get(), m_subDriver.get() })
+        {
+            if (nullptr != driver)
+            {
+                driver->stop();
+            }
+        }
+
+        m_pubDriver.reset();
+        m_subDriver.reset();
+
+        if (m_networkCreated)
+        {
+            tearDownNetwork();
+        }
+    }
+
+    static void tearDownNetwork()
+    {
+        run("ip netns del " NETNS_PUB);
+        run("ip netns del " NETNS_SUB);
+    }
+
+    std::unique_ptr<aeron::EmbeddedMediaDriver> startDriverInNamespace(const char *netns, std::string &dir)
+    {
+        char default_dir[1024];
+        aeron_default_path(default_dir, sizeof(default_dir));
+        dir = std::string(default_dir) + "-" + netns;
+
+        const std::string driverDir = dir;
+        auto driver = std::unique_ptr<aeron::EmbeddedMediaDriver>(new aeron::EmbeddedMediaDriver(
+            [driverDir](aeron_driver_context_t *context)
+            {
+                aeron_driver_context_set_dir(context, driverDir.c_str());
+                aeron_driver_context_set_udp_channel_transport_bindings(
+                    context, aeron_udp_channel_transport_bindings_load_media("af_xdp"));
+            }));
+
+        // Threads inherit the network namespace of the thread that creates them, so the driver's sockets are
+        // opened in the target namespace while the test thread returns to its own.
+        int originalNetns = open("/proc/self/ns/net", O_RDONLY);
+        int targetNetns = open((std::string("/var/run/netns/") + netns).c_str(), O_RDONLY);
+        EXPECT_LE(0, originalNetns);
+        EXPECT_LE(0, targetNetns);
+        EXPECT_EQ(0, setns(targetNetns, CLONE_NEWNET));
+
+        driver->start();
+
+        EXPECT_EQ(0, setns(originalNetns, CLONE_NEWNET));
+        close(targetNetns);
+        close(originalNetns);
+
+        return driver;
+    }
+
+    static aeron_t *connect(const std::string &dir, aeron_context_t **context)
+    {
+        aeron_t *aeron = nullptr;
+
+        if (aeron_context_init(context) < 0 ||
+            aeron_context_set_dir(*context, dir.c_str()) < 0 ||
+            aeron_init(&aeron, *context) < 0 ||
+            aeron_start(aeron) < 0)
+        {
+            throw std::runtime_error(aeron_errmsg());
+        }
+
+        return aeron;
+    }
+
+    static void closeClient(aeron_t *aeron, aeron_context_t *context)
+    {
+        if (nullptr != aeron)
+        {
+            aeron_close(aeron);
+        }
+
+        if (nullptr != context)
+        {
+            aeron_context_close(context);
+        }
+    }
+
+    static void onFragment(void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
+    {
+        auto *received = static_cast<int *>(clientd);
+        int32_t value;
+
+        memcpy(&value, buffer, sizeof(value));
+        EXPECT_EQ(*received, value);
+        (*received)++;
+    }
+
+    bool m_networkCreated = false;
+    std::string m_pubDir;
+    std::string m_subDir;
+    std::unique_ptr<aeron::EmbeddedMediaDriver> m_pubDriver;
+    std::unique_ptr<aeron::EmbeddedMediaDriver> m_subDriver;
+    aeron_context_t *m_pubContext = nullptr;
+    aeron_context_t *m_subContext = nullptr;
+    aeron_t *m_pubAeron = nullptr;
+    aeron_t *m_subAeron = nullptr;
+};
+
+TEST(CAfXdpParamsTest, shouldParseParams)
+{
+    aeron_udp_channel_transport_af_xdp_params_t params;
+    char args[] = "interface=eth1|queue=3|frames=1024|mode=zc";
+
+    ASSERT_EQ(0, aeron_udp_channel_transport_af_xdp_parse_params(args, &params));
+    EXPECT_STREQ("eth1", params.interface_name);
+    EXPECT_EQ(3U, params.queue_id);
+    EXPECT_EQ(1024U, params.frame_count);
+    EXPECT_EQ(AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_MODE_ZERO_COPY, params.mode);
+}
+
+TEST(CAfXdpParamsTest, shouldDefaultParams)
+{
+    aeron_udp_channel_transport_af_xdp_params_t params;
+    char args[] = "interface=eth1";
+
+    ASSERT_EQ(0, aeron_udp_channel_transport_af_xdp_parse_params(args, &params));
+    EXPECT_EQ(0U, params.queue_id);
+    EXPECT_EQ((uint32_t)AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_FRAME_COUNT_DEFAULT, params.frame_count);
+    EXPECT_EQ(AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_MODE_SKB, params.mode);
+}
+
+TEST(CAfXdpParamsTest, shouldRejectInvalidParams)
+{
+    aeron_udp_channel_transport_af_xdp_params_t params;
+    char missingInterface[] = "queue=1";
+    char invalidFrames[] = "interface=eth1|frames=1000";
+    char invalidMode[] = "interface=eth1|mode=fast";
+
+    EXPECT_EQ(-1, aeron_udp_channel_transport_af_xdp_parse_params(missingInterface, &params));
+    EXPECT_EQ(-1, aeron_udp_channel_transport_af_xdp_parse_params(invalidFrames, &params));
+    EXPECT_EQ(-1, aeron_udp_channel_transport_af_xdp_parse_params(invalidMode, &params));
+}
+
+TEST_F(CAfXdpTest, shouldExchangeMessagesAcrossVethPair)
+{
+    const int messageCount = 10000;
+    uint8_t message[256] = {};
+    int received = 0;
+
+    m_pubAeron = connect(m_pubDir, &m_pubContext);
+    m_subAeron = connect(m_subDir, &m_subContext);
+
+    aeron_async_add_subscription_t *asyncSub = nullptr;
+    ASSERT_EQ(0, aeron_async_add_subscription(
+        &asyncSub, m_subAeron, CHANNEL, STREAM_ID, nullptr, nullptr, nullptr, nullptr));
+    aeron_subscription_t *subscription = nullptr;
+    while (nullptr == subscription)
+    {
+        ASSERT_LE(0, aeron_async_add_subscription_poll(&subscription, asyncSub)) << aeron_errmsg();
+        std::this_thread::yield();
+    }
+
+    aeron_async_add_publication_t *asyncPub = nullptr;
+    ASSERT_EQ(0, aeron_async_add_publication(&asyncPub, m_pubAeron, CHANNEL, STREAM_ID));
+    aeron_publication_t *publication = nullptr;
+    while (nullptr == publication)
+    {
+        ASSERT_LE(0, aeron_async_add_publication_poll(&publication, asyncPub)) << aeron_errmsg();
+        std::this_thread::yield();
+    }
+
+    while (!aeron_subscription_is_connected(subscription))
+    {
+        std::this_thread::yield();
+    }
+
+    for (int32_t i = 0; i < messageCount; i++)
+    {
+        memcpy(message, &i, sizeof(i));
+        while (aeron_publication_offer(publication, message, sizeof(message), nullptr, nullptr) < 0)
+        {
+            aeron_subscription_poll(subscription, onFragment, &received, 10);
+        }
+    }
+
+    while (received < messageCount)
+    {
+        if (0 == aeron_subscription_poll(subscription, onFragment, &received, 10))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    EXPECT_EQ(messageCount, received);
+
+    aeron_publication_close(publication, nullptr, nullptr);
+    aeron_subscription_close(subscription, nullptr, nullptr);
+}
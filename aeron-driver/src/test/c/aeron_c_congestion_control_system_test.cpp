@@ -0,0 +1,160 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include "aeron_test_base.h"
+
+extern "C"
+{
+#include "aeron_congestion_control.h"
+}
+
+#define PUB_URI "aeron:udp?endpoint=localhost:24326|term-length=64k"
+#define STREAM_ID (1001)
+#define MESSAGE_LENGTH (1024)
+#define MESSAGE_COUNT (64 * 16)
+
+// drop a fraction of data frames on the way into the receiver so loss recovery runs alongside each strategy
+#define LOSS_ARGS "rate=0.05|recv-msg-mask=0x2|seed=7"
+
+class CCongestionControlSystemTest : public CSystemTestBase, public testing::TestWithParam<const char *>
+{
+protected:
+    CCongestionControlSystemTest() : CSystemTestBase(
+        std::vector<std::pair<std::string, std::string>>
+            {
+                { "AERON_UDP_CHANNEL_INCOMING_INTERCEPTORS", "loss" },
+                { "AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_LOSS_ARGS", LOSS_ARGS }
+            })
+    {
+    }
+
+    struct counter_search_stct
+    {
+        const char *label_prefix;
+        int32_t counter_id;
+        int64_t value;
+    };
+
+    static void findCounter(
+        int64_t value,
+        int32_t id,
+        int32_t type_id,
+        const uint8_t *key,
+        size_t key_length,
+        const char *label,
+        size_t label_length,
+        void *clientd)
+    {
+        auto *search = static_cast<counter_search_stct *>(clientd);
+        const size_t prefix_length = strlen(search->label_prefix);
+        if (label_length >= prefix_length && 0 == memcmp(label, search->label_prefix, prefix_length))
+        {
+            search->counter_id = id;
+            search->value = value;
+        }
+    }
+
+    counter_search_stct findCounterByLabelPrefix(const char *label_prefix)
+    {
+        counter_search_stct search = { label_prefix, -1, 0 };
+        aeron_counters_reader_foreach_counter(aeron_counters_reader(m_aeron), findCounter, &search);
+
+        return search;
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    CCongestionControlSystemTestWithParams,
+    CCongestionControlSystemTest,
+    testing::Values(
+        AERON_STATICWINDOWCONGESTIONCONTROL_CC_PARAM_VALUE,
+        AERON_CUBICCONGESTIONCONTROL_CC_PARAM_VALUE,
+        AERON_BBRCONGESTIONCONTROL_CC_PARAM_VALUE));
+
+TEST_P(CCongestionControlSystemTest, shouldDeliverAllMessagesInOrderWithLoss)
+{
+    aeron_async_add_publication_t *async_pub = nullptr;
+    aeron_async_add_subscription_t *async_sub = nullptr;
+    const std::string uri = std::string(PUB_URI) + "|cc=" + GetParam();
+    uint8_t message[MESSAGE_LENGTH] = {};
+
+    ASSERT_TRUE(connect());
+    ASSERT_EQ(aeron_async_add_publication(&async_pub, m_aeron, uri.c_str(), STREAM_ID), 0);
+    aeron_publication_t *publication = awaitPublicationOrError(async_pub);
+    ASSERT_TRUE(publication) << aeron_errmsg();
+
+    ASSERT_EQ(aeron_async_add_subscription(
+        &async_sub, m_aeron, uri.c_str(), STREAM_ID, nullptr, nullptr, nullptr, nullptr), 0);
+    aeron_subscription_t *subscription = awaitSubscriptionOrError(async_sub);
+    ASSERT_TRUE(subscription) << aeron_errmsg();
+    awaitConnected(subscription);
+
+    int32_t messages_sent = 0;
+    int32_t messages_received = 0;
+    poll_handler_t handler = [&](const uint8_t *buffer, size_t length, aeron_header_t *header)
+    {
+        int32_t sequence;
+        memcpy(&sequence, buffer, sizeof(sequence));
+        ASSERT_EQ(MESSAGE_LENGTH, (int32_t)length);
+        ASSERT_EQ(messages_received, sequence);
+        messages_received++;
+    };
+
+    while (messages_received < MESSAGE_COUNT)
+    {
+        if (messages_sent < MESSAGE_COUNT)
+        {
+            memcpy(message, &messages_sent, sizeof(messages_sent));
+            if (aeron_publication_offer(publication, message, sizeof(message), nullptr, nullptr) > 0)
+            {
+                messages_sent++;
+            }
+        }
+
+        if (0 == poll(subscription, handler, 10))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    EXPECT_EQ(MESSAGE_COUNT, messages_received);
+    EXPECT_GT(findCounterByLabelPrefix("NAKs sent").value, 0);
+
+    if (0 == strcmp(AERON_BBRCONGESTIONCONTROL_CC_PARAM_VALUE, GetParam()))
+    {
+        const counter_search_stct window = findCounterByLabelPrefix(
+            AERON_BBRCONGESTIONCONTROL_WINDOW_INDICATOR_COUNTER_NAME);
+        const counter_search_stct bandwidth = findCounterByLabelPrefix(
+            AERON_BBRCONGESTIONCONTROL_BANDWIDTH_INDICATOR_COUNTER_NAME);
+        ASSERT_NE(-1, window.counter_id);
+        ASSERT_NE(-1, bandwidth.counter_id);
+        EXPECT_GT(window.value, 0);
+        EXPECT_GT(bandwidth.value, 0);
+    }
+    else if (0 == strcmp(AERON_CUBICCONGESTIONCONTROL_CC_PARAM_VALUE, GetParam()))
+    {
+        const counter_search_stct window = findCounterByLabelPrefix(
+            AERON_CUBICCONGESTIONCONTROL_WINDOW_INDICATOR_COUNTER_NAME);
+        ASSERT_NE(-1, window.counter_id);
+        EXPECT_GT(window.value, 0);
+    }
+
+    EXPECT_EQ(aeron_publication_close(publication, nullptr, nullptr), 0);
+    EXPECT_EQ(aeron_subscription_close(subscription, nullptr, nullptr), 0);
+}
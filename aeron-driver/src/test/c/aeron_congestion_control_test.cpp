@@ -15,7 +15,9 @@
  */
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <array>
+#include <vector>
 
 extern "C"
 {
@@ -29,6 +31,9 @@ int32_t aeron_cubic_congestion_control_strategy_get_max_cwnd(void *state);
 }
 
 #define CAPACITY (32 * 1024)
+#define BBR_MTU_LENGTH (1408)
+#define BBR_RTT_NS (1000 * 1000LL)
+#define BBR_START_NS (1000 * 1000 * 1000LL)
 typedef std::array<std::uint8_t, CAPACITY> buffer_t;
 typedef std::array<std::uint8_t, 4 * CAPACITY> buffer_4x_t;
 
@@ -68,6 +73,7 @@ public:
         aeron_env_unset(AERON_CUBICCONGESTIONCONTROL_INITIALRTT_ENV_VAR);
         aeron_env_unset(AERON_CUBICCONGESTIONCONTROL_TCPMODE_ENV_VAR);
         aeron_env_unset(AERON_CUBICCONGESTIONCONTROL_MEASURERTT_ENV_VAR);
+        aeron_env_unset(AERON_BBRCONGESTIONCONTROL_INITIALRTT_ENV_VAR);
         aeron_env_unset(AERON_CONGESTIONCONTROL_SUPPLIER_ENV_VAR);
     }
 
@@ -166,6 +172,71 @@ public:
         return udp_channel;
     }
 
+    int64_t get_counter_value(const char *label_prefix) const
+    {
+        const int32_t counter_id = find_counter_by_label_prefix(
+            &m_counters_manager, AERON_COUNTER_PER_IMAGE_TYPE_ID, label_prefix);
+        return aeron_counter_get(
+            aeron_counters_manager_addr((aeron_counters_manager_t *)&m_counters_manager, counter_id));
+    }
+
+    aeron_congestion_control_strategy_t *create_bbr_strategy(const char *channel, int32_t term_length)
+    {
+        aeron_congestion_control_strategy_t *congestion_control_strategy = nullptr;
+        const int result = aeron_congestion_control_default_strategy_supplier(
+            &congestion_control_strategy,
+            parse_udp_channel(channel),
+            42,
+            5,
+            11,
+            term_length,
+            BBR_MTU_LENGTH,
+            nullptr,
+            nullptr,
+            m_context,
+            &m_counters_manager);
+        EXPECT_EQ(0, result) << aeron_errmsg();
+
+        return congestion_control_strategy;
+    }
+
+    // a bottleneck which delivers at most capacity bytes per round trip whatever the window allows
+    int32_t run_bbr_rounds(
+        aeron_congestion_control_strategy_t *strategy,
+        int64_t &now_ns,
+        int64_t &position,
+        int32_t window_length,
+        int32_t capacity,
+        int rounds,
+        std::vector<int32_t> *windows = nullptr)
+    {
+        for (int i = 0; i < rounds; i++)
+        {
+            bool should_force_sm = false;
+            const int32_t delivered = window_length < capacity ? window_length : capacity;
+            position += delivered;
+            now_ns += BBR_RTT_NS;
+
+            window_length = strategy->on_track_rebuild(
+                strategy->state,
+                &should_force_sm,
+                now_ns,
+                position,
+                position,
+                position,
+                position - delivered,
+                position,
+                false);
+
+            if (nullptr != windows)
+            {
+                windows->push_back(window_length);
+            }
+        }
+
+        return window_length;
+    }
+
     int32_t get_counter_state(int32_t counter_id) const
     {
         const aeron_counter_metadata_descriptor_t *metadata = (aeron_counter_metadata_descriptor_t *)
@@ -445,3 +516,112 @@ TEST_F(CongestionControlTest, cubicCongestionControlStrategyConfiguration)
     EXPECT_EQ(AERON_COUNTER_RECORD_RECLAIMED, get_counter_state(rtt_indicator_counter_id));
     EXPECT_EQ(AERON_COUNTER_RECORD_RECLAIMED, get_counter_state(window_counter_id));
 }
+
+TEST_F(CongestionControlTest, defaultStrategySupplierShouldChooseBbrCongestionControlWhenCcParamIsBbr)
+{
+    aeron_congestion_control_strategy_t *congestion_control_strategy = create_bbr_strategy(
+        "aeron:udp?endpoint=192.168.0.1:9999|cc=bbr|rcv-wnd=65536", 65536 << 2);
+    ASSERT_NE(nullptr, congestion_control_strategy);
+    void *const state = congestion_control_strategy->state;
+
+    const int32_t rtt_indicator_counter_id = find_counter_by_label_prefix(
+        &m_counters_manager, AERON_COUNTER_PER_IMAGE_TYPE_ID, AERON_BBRCONGESTIONCONTROL_RTT_INDICATOR_COUNTER_NAME);
+    const int32_t bandwidth_counter_id = find_counter_by_label_prefix(
+        &m_counters_manager,
+        AERON_COUNTER_PER_IMAGE_TYPE_ID,
+        AERON_BBRCONGESTIONCONTROL_BANDWIDTH_INDICATOR_COUNTER_NAME);
+    const int32_t window_counter_id = find_counter_by_label_prefix(
+        &m_counters_manager, AERON_COUNTER_PER_IMAGE_TYPE_ID, AERON_BBRCONGESTIONCONTROL_WINDOW_INDICATOR_COUNTER_NAME);
+    EXPECT_EQ(AERON_COUNTER_RECORD_ALLOCATED, get_counter_state(rtt_indicator_counter_id));
+    EXPECT_EQ(AERON_COUNTER_RECORD_ALLOCATED, get_counter_state(bandwidth_counter_id));
+    EXPECT_EQ(AERON_COUNTER_RECORD_ALLOCATED, get_counter_state(window_counter_id));
+
+    EXPECT_EQ(BBR_MTU_LENGTH * 10, congestion_control_strategy->initial_window_length(state));
+    EXPECT_EQ(65536, congestion_control_strategy->max_window_length(state));
+    EXPECT_EQ(BBR_MTU_LENGTH * 10, get_counter_value(AERON_BBRCONGESTIONCONTROL_WINDOW_INDICATOR_COUNTER_NAME));
+
+    EXPECT_TRUE(congestion_control_strategy->should_measure_rtt(state, BBR_START_NS));
+    congestion_control_strategy->on_rttm_sent(state, BBR_START_NS);
+    EXPECT_FALSE(congestion_control_strategy->should_measure_rtt(state, BBR_START_NS));
+
+    congestion_control_strategy->on_rttm(state, BBR_START_NS + 555, 555, nullptr);
+    EXPECT_EQ(555, get_counter_value(AERON_BBRCONGESTIONCONTROL_RTT_INDICATOR_COUNTER_NAME));
+
+    congestion_control_strategy->on_rttm(state, BBR_START_NS + 1000, 777, nullptr);
+    EXPECT_EQ(555, get_counter_value(AERON_BBRCONGESTIONCONTROL_RTT_INDICATOR_COUNTER_NAME));
+
+    congestion_control_strategy->fini(congestion_control_strategy);
+
+    EXPECT_EQ(AERON_COUNTER_RECORD_RECLAIMED, get_counter_state(rtt_indicator_counter_id));
+    EXPECT_EQ(AERON_COUNTER_RECORD_RECLAIMED, get_counter_state(bandwidth_counter_id));
+    EXPECT_EQ(AERON_COUNTER_RECORD_RECLAIMED, get_counter_state(window_counter_id));
+}
+
+TEST_F(CongestionControlTest, bbrShouldGrowWindowInStartupThenSettleAroundBandwidthDelayProduct)
+{
+    const int32_t bdp = BBR_MTU_LENGTH * 100;
+    aeron_congestion_control_strategy_t *congestion_control_strategy = create_bbr_strategy(
+        "aeron:udp?endpoint=192.168.0.1:9999|cc=bbr|rcv-wnd=4194304", 16 * 1024 * 1024);
+    ASSERT_NE(nullptr, congestion_control_strategy);
+    void *const state = congestion_control_strategy->state;
+
+    int64_t now_ns = BBR_START_NS;
+    int64_t position = 0;
+    congestion_control_strategy->on_rttm(state, now_ns, BBR_RTT_NS, nullptr);
+
+    std::vector<int32_t> windows;
+    const int32_t initial_window_length = congestion_control_strategy->initial_window_length(state);
+    const int32_t window_length = run_bbr_rounds(
+        congestion_control_strategy, now_ns, position, initial_window_length, bdp, 50, &windows);
+
+    EXPECT_LT(initial_window_length, windows[1]);
+    EXPECT_LT(windows[1], windows[2]);
+    EXPECT_LT(windows[2], windows[3]);
+    EXPECT_LE(*std::min_element(windows.begin() + 4, windows.end()), bdp);
+    EXPECT_GE(window_length, (bdp * 3) / 2);
+    EXPECT_LE(window_length, (bdp * 5) / 2);
+    EXPECT_EQ(bdp * 1000LL, get_counter_value(AERON_BBRCONGESTIONCONTROL_BANDWIDTH_INDICATOR_COUNTER_NAME));
+    EXPECT_EQ(window_length, get_counter_value(AERON_BBRCONGESTIONCONTROL_WINDOW_INDICATOR_COUNTER_NAME));
+
+    congestion_control_strategy->fini(congestion_control_strategy);
+}
+
+TEST_F(CongestionControlTest, bbrShouldProbeRttWithMinWindowWhenMinRttExpires)
+{
+    const int32_t bdp = BBR_MTU_LENGTH * 100;
+    aeron_congestion_control_strategy_t *congestion_control_strategy = create_bbr_strategy(
+        "aeron:udp?endpoint=192.168.0.1:9999|cc=bbr|rcv-wnd=4194304", 16 * 1024 * 1024);
+    ASSERT_NE(nullptr, congestion_control_strategy);
+    void *const state = congestion_control_strategy->state;
+
+    int64_t now_ns = BBR_START_NS;
+    int64_t position = 0;
+    congestion_control_strategy->on_rttm(state, now_ns, BBR_RTT_NS, nullptr);
+
+    int32_t window_length = run_bbr_rounds(
+        congestion_control_strategy,
+        now_ns,
+        position,
+        congestion_control_strategy->initial_window_length(state),
+        bdp,
+        50);
+    ASSERT_GE(window_length, (bdp * 3) / 2);
+
+    now_ns = BBR_START_NS + (10 * 1000 * BBR_RTT_NS);
+    window_length = run_bbr_rounds(congestion_control_strategy, now_ns, position, window_length, bdp, 1);
+    EXPECT_EQ(BBR_MTU_LENGTH * 4, window_length);
+
+    congestion_control_strategy->on_rttm(state, now_ns, BBR_RTT_NS * 2, nullptr);
+    EXPECT_EQ(BBR_RTT_NS * 2, get_counter_value(AERON_BBRCONGESTIONCONTROL_RTT_INDICATOR_COUNTER_NAME));
+    congestion_control_strategy->on_rttm(state, now_ns, BBR_RTT_NS, nullptr);
+
+    window_length = run_bbr_rounds(congestion_control_strategy, now_ns, position, window_length, bdp, 199);
+    EXPECT_EQ(BBR_MTU_LENGTH * 4, window_length);
+    EXPECT_EQ(bdp * 1000LL, get_counter_value(AERON_BBRCONGESTIONCONTROL_BANDWIDTH_INDICATOR_COUNTER_NAME));
+
+    window_length = run_bbr_rounds(congestion_control_strategy, now_ns, position, window_length, bdp, 1);
+    EXPECT_GE(window_length, (bdp * 3) / 2);
+    EXPECT_LE(window_length, (bdp * 5) / 2);
+
+    congestion_control_strategy->fini(congestion_control_strategy);
+}
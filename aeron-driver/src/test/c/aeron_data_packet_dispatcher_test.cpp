@@ -94,7 +94,8 @@ TEST_F(DataPacketDispatcherTest, shouldInsertDataInputSubscribedPublicationImage
         data_header,
         data_buffer.data(),
         len,
-        &m_receive_endpoint->conductor_fields.udp_channel->local_data);
+        &m_receive_endpoint->conductor_fields.udp_channel->local_data,
+        NULL);
 
     ASSERT_EQ((int)len, bytes_written);
     ASSERT_EQ((int64_t)len, *image->rcv_hwm_position.value_addr);
@@ -128,7 +129,8 @@ TEST_F(DataPacketDispatcherTest, shouldNotInsertDataInputWithNoSubscription)
         data_header,
         data_buffer.data(),
         len,
-        &m_receive_endpoint->conductor_fields.udp_channel->local_data);
+        &m_receive_endpoint->conductor_fields.udp_channel->local_data,
+        NULL);
 
     ASSERT_EQ(0, bytes_written);
     ASSERT_EQ(expected_position_after_data, *image->rcv_hwm_position.value_addr);
@@ -154,7 +156,8 @@ TEST_F(DataPacketDispatcherTest, shouldElicitSetupMessageForSubscriptionWithoutI
         data_header,
         data_buffer.data(),
         len,
-        &m_receive_endpoint->conductor_fields.udp_channel->local_data));
+        &m_receive_endpoint->conductor_fields.udp_channel->local_data,
+        NULL));
     ASSERT_EQ(0, aeron_data_packet_dispatcher_on_data(
         m_dispatcher,
         m_receive_endpoint,
@@ -162,7 +165,8 @@ TEST_F(DataPacketDispatcherTest, shouldElicitSetupMessageForSubscriptionWithoutI
         data_header,
         data_buffer.data(),
         len,
-        &m_receive_endpoint->conductor_fields.udp_channel->local_data));
+        &m_receive_endpoint->conductor_fields.udp_channel->local_data,
+        NULL));
     ASSERT_EQ(0, aeron_data_packet_dispatcher_on_data(
         m_dispatcher,
         m_receive_endpoint,
@@ -170,7 +174,8 @@ TEST_F(DataPacketDispatcherTest, shouldElicitSetupMessageForSubscriptionWithoutI
         data_header,
         data_buffer.data(),
         len,
-        &m_receive_endpoint->conductor_fields.udp_channel->local_data));
+        &m_receive_endpoint->conductor_fields.udp_channel->local_data,
+        NULL));
 
     ASSERT_EQ(1, m_test_bindings_state->sm_count);
 
@@ -183,7 +188,8 @@ TEST_F(DataPacketDispatcherTest, shouldElicitSetupMessageForSubscriptionWithoutI
         data_header,
         data_buffer.data(),
         len,
-        &m_receive_endpoint->conductor_fields.udp_channel->local_data));
+        &m_receive_endpoint->conductor_fields.udp_channel->local_data,
+        NULL));
 
     ASSERT_EQ(2, m_test_bindings_state->sm_count);
 }
@@ -332,7 +338,8 @@ TEST_F(DataPacketDispatcherTest, shouldIgnoreDataAndSetupAfterImageRemoved)
         data_header,
         data_buffer.data(),
         len,
-        &m_receive_endpoint->conductor_fields.udp_channel->local_data);
+        &m_receive_endpoint->conductor_fields.udp_channel->local_data,
+        NULL);
     ASSERT_TRUE(isEmpty(m_conductor_proxy.command_queue));
     aeron_data_packet_dispatcher_on_setup(
         m_dispatcher,
@@ -373,7 +380,8 @@ TEST_F(DataPacketDispatcherTest, shouldNotIgnoreDataAndSetupAfterImageRemovedAnd
         data_header,
         data_buffer.data(),
         len,
-        &m_receive_endpoint->conductor_fields.udp_channel->local_data);
+        &m_receive_endpoint->conductor_fields.udp_channel->local_data,
+        NULL);
     aeron_data_packet_dispatcher_on_setup(
         m_dispatcher,
         m_receive_endpoint,
@@ -418,7 +426,8 @@ TEST_F(DataPacketDispatcherTest, shouldNotRemoveNewPublicationImageFromOldRemove
         data_header,
         data_buffer.data(),
         len,
-        &m_receive_endpoint->conductor_fields.udp_channel->local_data);
+        &m_receive_endpoint->conductor_fields.udp_channel->local_data,
+        NULL);
 
     ASSERT_EQ((int)len, bytes_written);
     ASSERT_EQ((int64_t)len, *image2->rcv_hwm_position.value_addr);
@@ -491,7 +500,8 @@ TEST_F(DataPacketDispatcherTest, shouldRemoveSessionSpecificSubscriptionAndStill
         data_header,
         data_buffer.data(),
         len,
-        &m_receive_endpoint->conductor_fields.udp_channel->local_data);
+        &m_receive_endpoint->conductor_fields.udp_channel->local_data,
+        NULL);
 
     ASSERT_EQ((int)len, bytes_written);
     ASSERT_EQ((int64_t)len, *image->rcv_hwm_position.value_addr);
@@ -524,7 +534,8 @@ TEST_F(DataPacketDispatcherTest, shouldNotRemoveStreamInterestOnRemovalOfSession
         data_header,
         data_buffer.data(),
         len,
-        &m_receive_endpoint->conductor_fields.udp_channel->local_data);
+        &m_receive_endpoint->conductor_fields.udp_channel->local_data,
+        NULL);
 
     ASSERT_EQ((int)len, bytes_written);
     ASSERT_EQ((int64_t)len, *image->rcv_hwm_position.value_addr);
@@ -0,0 +1,185 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "aeron_driver_conductor_test.h"
+
+#define COUNTER_TYPE_ID (102)
+
+using testing::_;
+using testing::InSequence;
+
+class DriverConductorBatchTest : public DriverConductorTest, public testing::Test
+{
+protected:
+    std::string m_label = "batch counter";
+    uint8_t m_key[sizeof(int64_t)] = { 0 };
+};
+
+TEST_F(DriverConductorBatchTest, shouldAddPublicationsSubscriptionAndCounterInSingleBatch)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t pub_id_1 = nextCorrelationId();
+    int64_t pub_id_2 = nextCorrelationId();
+    int64_t sub_id = nextCorrelationId();
+    int64_t counter_id = nextCorrelationId();
+    int64_t batch_id = nextCorrelationId();
+
+    startBatch();
+    ASSERT_EQ(addIpcPublication(client_id, pub_id_1, STREAM_ID_1, false), 0);
+    ASSERT_EQ(addIpcPublication(client_id, pub_id_2, STREAM_ID_2, true), 0);
+    ASSERT_EQ(addIpcSubscription(client_id, sub_id, STREAM_ID_1, -1), 0);
+    ASSERT_EQ(addCounter(client_id, counter_id, COUNTER_TYPE_ID, m_key, sizeof(m_key), m_label), 0);
+    ASSERT_EQ(submitBatch(client_id, batch_id), 0);
+
+    doWork();
+
+    EXPECT_EQ(aeron_driver_conductor_num_ipc_publications(&m_conductor.m_conductor), 2u);
+    EXPECT_EQ(aeron_driver_conductor_num_ipc_subscriptions(&m_conductor.m_conductor), 1u);
+    EXPECT_EQ(nullptr, m_conductor.m_conductor.pending_batch.buffer);
+
+    int64_t complete_id = 0;
+    std::vector<aeron_batch_result_t> results;
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(_, _, _)).Times(testing::AnyNumber());
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_PUBLICATION_READY, _, _))
+        .With(IsPublicationReady(pub_id_1, testing::_, testing::_));
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_EXCLUSIVE_PUBLICATION_READY, _, _))
+        .With(IsPublicationReady(pub_id_2, testing::_, testing::_));
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_SUBSCRIPTION_READY, _, _))
+        .With(IsSubscriptionReady(sub_id));
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_BATCH_COMPLETE, _, _))
+        .WillOnce(CaptureBatchComplete(&complete_id, &results));
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_ERROR, _, _)).Times(0);
+
+    readAllBroadcastsFromConductor(mock_broadcast_handler);
+
+    EXPECT_EQ(batch_id, complete_id);
+    ASSERT_EQ(4u, results.size());
+    EXPECT_EQ(pub_id_1, results[0].correlation_id);
+    EXPECT_EQ(pub_id_2, results[1].correlation_id);
+    EXPECT_EQ(sub_id, results[2].correlation_id);
+    EXPECT_EQ(counter_id, results[3].correlation_id);
+    for (const auto &result : results)
+    {
+        EXPECT_EQ(AERON_ERROR_CODE_UNUSED, result.error_code);
+    }
+}
+
+TEST_F(DriverConductorBatchTest, shouldRemovePublicationsInSingleBatch)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t pub_id_1 = nextCorrelationId();
+    int64_t pub_id_2 = nextCorrelationId();
+
+    ASSERT_EQ(addIpcPublication(client_id, pub_id_1, STREAM_ID_1, false), 0);
+    ASSERT_EQ(addIpcPublication(client_id, pub_id_2, STREAM_ID_2, false), 0);
+    doWork();
+    EXPECT_EQ(aeron_driver_conductor_num_ipc_publications(&m_conductor.m_conductor), 2u);
+    readAllBroadcastsFromConductor(null_broadcast_handler);
+
+    int64_t remove_id_1 = nextCorrelationId();
+    int64_t remove_id_2 = nextCorrelationId();
+    int64_t batch_id = nextCorrelationId();
+
+    startBatch();
+    ASSERT_EQ(removePublication(client_id, remove_id_1, pub_id_1), 0);
+    ASSERT_EQ(removePublication(client_id, remove_id_2, pub_id_2), 0);
+    ASSERT_EQ(submitBatch(client_id, batch_id), 0);
+    doWork();
+
+    int64_t complete_id = 0;
+    std::vector<aeron_batch_result_t> results;
+    {
+        InSequence sequence;
+        EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_OPERATION_SUCCESS, _, _))
+            .With(IsOperationSuccess(remove_id_1));
+        EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_OPERATION_SUCCESS, _, _))
+            .With(IsOperationSuccess(remove_id_2));
+        EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_BATCH_COMPLETE, _, _))
+            .WillOnce(CaptureBatchComplete(&complete_id, &results));
+    }
+
+    readAllBroadcastsFromConductor(mock_broadcast_handler);
+
+    EXPECT_EQ(batch_id, complete_id);
+    ASSERT_EQ(2u, results.size());
+    EXPECT_EQ(AERON_ERROR_CODE_UNUSED, results[0].error_code);
+    EXPECT_EQ(AERON_ERROR_CODE_UNUSED, results[1].error_code);
+
+    int64_t timeout_ns = m_context.m_context->publication_linger_timeout_ns * 2;
+    doWorkForNs(timeout_ns);
+    EXPECT_EQ(aeron_driver_conductor_num_ipc_publications(&m_conductor.m_conductor), 0u);
+}
+
+TEST_F(DriverConductorBatchTest, shouldReportFailedEntriesInBatchComplete)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t remove_id = nextCorrelationId();
+    int64_t pub_id = nextCorrelationId();
+    int64_t keepalive_id = nextCorrelationId();
+    int64_t batch_id = nextCorrelationId();
+
+    startBatch();
+    ASSERT_EQ(removePublication(client_id, remove_id, 4242), 0);
+    ASSERT_EQ(addIpcPublication(client_id, pub_id, STREAM_ID_1, false), 0);
+    auto *keepalive = reinterpret_cast<aeron_correlated_command_t *>(m_command_buffer);
+    keepalive->client_id = client_id;
+    keepalive->correlation_id = keepalive_id;
+    ASSERT_EQ(writeCommand(AERON_COMMAND_CLIENT_KEEPALIVE, sizeof(aeron_correlated_command_t)), 0);
+    ASSERT_EQ(submitBatch(client_id, batch_id), 0);
+
+    doWork();
+
+    EXPECT_EQ(aeron_driver_conductor_num_ipc_publications(&m_conductor.m_conductor), 1u);
+
+    int64_t complete_id = 0;
+    std::vector<aeron_batch_result_t> results;
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(_, _, _)).Times(testing::AnyNumber());
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_ERROR, _, _)).With(IsError(remove_id));
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_ERROR, _, _)).With(IsError(keepalive_id));
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_BATCH_COMPLETE, _, _))
+        .WillOnce(CaptureBatchComplete(&complete_id, &results));
+
+    readAllBroadcastsFromConductor(mock_broadcast_handler);
+
+    EXPECT_EQ(batch_id, complete_id);
+    ASSERT_EQ(3u, results.size());
+    EXPECT_EQ(remove_id, results[0].correlation_id);
+    EXPECT_EQ(AERON_ERROR_CODE_UNKNOWN_PUBLICATION, results[0].error_code);
+    EXPECT_EQ(pub_id, results[1].correlation_id);
+    EXPECT_EQ(AERON_ERROR_CODE_UNUSED, results[1].error_code);
+    EXPECT_EQ(keepalive_id, results[2].correlation_id);
+    EXPECT_EQ(AERON_ERROR_CODE_UNKNOWN_COMMAND_TYPE_ID, results[2].error_code);
+}
+
+TEST_F(DriverConductorBatchTest, shouldCompleteEmptyBatch)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t batch_id = nextCorrelationId();
+
+    startBatch();
+    ASSERT_EQ(submitBatch(client_id, batch_id), 0);
+    doWork();
+
+    int64_t complete_id = 0;
+    std::vector<aeron_batch_result_t> results;
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_BATCH_COMPLETE, _, _))
+        .WillOnce(CaptureBatchComplete(&complete_id, &results));
+
+    readAllBroadcastsFromConductor(mock_broadcast_handler);
+
+    EXPECT_EQ(batch_id, complete_id);
+    EXPECT_TRUE(results.empty());
+}
@@ -118,3 +118,74 @@ TEST_F(DriverConductorConfigTest, shouldRejectResponseSubscriptionDestination)
             });
     readAllBroadcastsFromConductor(mock_broadcast_handler);
 }
+
+TEST_F(DriverConductorConfigTest, shouldRejectPublicationWithSenderIdOutOfRange)
+{
+    addPublication(1234, 1234, "aeron:udp?endpoint=localhost:8001|sender-id=0", 1234, false);
+    doWork();
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_COUNTER_READY, _, _));
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_PUBLICATION_READY, _, _));
+    readAllBroadcastsFromConductor(mock_broadcast_handler);
+    testing::Mock::VerifyAndClear(&m_mockCallbacks);
+
+    addPublication(1234, 1235, "aeron:udp?endpoint=localhost:8002|sender-id=1", 1234, false);
+    doWork();
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_ERROR, _, _))
+        .WillOnce(
+            [&](std::int32_t msgTypeId, uint8_t *buffer, size_t length)
+            {
+                const aeron_error_response_t *msg = reinterpret_cast<aeron_error_response_t *>(buffer);
+                char *msg_buf = (char *)malloc(msg->error_message_length + 1);
+
+                memset(msg_buf, 0, msg->error_message_length + 1);
+                memcpy(msg_buf, buffer + sizeof(aeron_error_response_t), msg->error_message_length);
+
+                EXPECT_THAT(msg_buf, HasSubstr(AERON_URI_SENDER_ID_KEY));
+
+                free(msg_buf);
+            });
+    readAllBroadcastsFromConductor(mock_broadcast_handler);
+}
+
+TEST_F(DriverConductorConfigTest, shouldRejectPublicationWithSenderIdOfAnotherSenderForExistingEndpoint)
+{
+    aeron_driver_sender_t other_sender = {};
+    ASSERT_EQ(0, aeron_driver_sender_init(
+        &other_sender,
+        m_context.m_context,
+        &m_conductor.m_conductor.system_counters,
+        &m_conductor.m_conductor.error_log,
+        1));
+    m_context.m_context->sender_count = 2;
+    m_context.m_context->sender_proxies[0] = &m_conductor.m_sender.sender_proxy;
+    m_context.m_context->sender_proxies[1] = &other_sender.sender_proxy;
+
+    addPublication(1234, 1234, "aeron:udp?endpoint=localhost:8001|sender-id=0", 1234, false);
+    doWork();
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_COUNTER_READY, _, _));
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_PUBLICATION_READY, _, _));
+    readAllBroadcastsFromConductor(mock_broadcast_handler);
+    testing::Mock::VerifyAndClear(&m_mockCallbacks);
+
+    addPublication(1234, 1235, "aeron:udp?endpoint=localhost:8001|sender-id=1", 1234, false);
+    doWork();
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_ERROR, _, _))
+        .WillOnce(
+            [&](std::int32_t msgTypeId, uint8_t *buffer, size_t length)
+            {
+                const aeron_error_response_t *msg = reinterpret_cast<aeron_error_response_t *>(buffer);
+                char *msg_buf = (char *)malloc(msg->error_message_length + 1);
+
+                memset(msg_buf, 0, msg->error_message_length + 1);
+                memcpy(msg_buf, buffer + sizeof(aeron_error_response_t), msg->error_message_length);
+
+                EXPECT_THAT(msg_buf, HasSubstr("does not match the sender of the existing endpoint"));
+
+                free(msg_buf);
+            });
+    readAllBroadcastsFromConductor(mock_broadcast_handler);
+
+    m_context.m_context->sender_count = 1;
+    m_context.m_context->sender_proxies[1] = nullptr;
+    aeron_driver_sender_on_close(&other_sender);
+}
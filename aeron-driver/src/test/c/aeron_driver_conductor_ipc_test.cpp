@@ -271,6 +271,48 @@ TEST_F(DriverConductorIpcTest, shouldBeAbleToTimeoutIpcPublicationWithActiveIpcS
     readAllBroadcastsFromConductor(mock_broadcast_handler);
 }
 
+TEST_F(DriverConductorIpcTest, shouldFindRemainingClientAndPublicationsAfterEarlierClientsTimeout)
+{
+    int64_t client_id1 = nextCorrelationId();
+    int64_t client_id2 = nextCorrelationId();
+    int64_t client_id3 = nextCorrelationId();
+    int64_t pub_id1 = nextCorrelationId();
+    int64_t pub_id2 = nextCorrelationId();
+    int64_t pub_id3 = nextCorrelationId();
+    int64_t remove_correlation_id = nextCorrelationId();
+
+    ASSERT_EQ(addIpcPublication(client_id1, pub_id1, STREAM_ID_1, true), 0);
+    ASSERT_EQ(addIpcPublication(client_id2, pub_id2, STREAM_ID_1, true), 0);
+    ASSERT_EQ(addIpcPublication(client_id3, pub_id3, STREAM_ID_1, true), 0);
+    doWorkUntilDone();
+
+    EXPECT_EQ(aeron_driver_conductor_num_clients(&m_conductor.m_conductor), 3u);
+    EXPECT_EQ(aeron_driver_conductor_num_ipc_publications(&m_conductor.m_conductor), 3u);
+    readAllBroadcastsFromConductor(null_broadcast_handler);
+
+    doWorkForNs(
+        m_context.m_context->publication_linger_timeout_ns + (m_context.m_context->client_liveness_timeout_ns * 2),
+        100,
+        [&]()
+        {
+            clientKeepalive(client_id3);
+        });
+
+    EXPECT_EQ(aeron_driver_conductor_num_clients(&m_conductor.m_conductor), 1u);
+    EXPECT_EQ(aeron_driver_conductor_num_ipc_publications(&m_conductor.m_conductor), 1u);
+    EXPECT_EQ(aeron_driver_conductor_find_ipc_publication(&m_conductor.m_conductor, pub_id1), nullptr);
+    EXPECT_EQ(aeron_driver_conductor_find_ipc_publication(&m_conductor.m_conductor, pub_id2), nullptr);
+    EXPECT_NE(aeron_driver_conductor_find_ipc_publication(&m_conductor.m_conductor, pub_id3), nullptr);
+    readAllBroadcastsFromConductor(null_broadcast_handler);
+
+    ASSERT_EQ(removePublication(client_id3, remove_correlation_id, pub_id3), 0);
+    doWorkUntilDone();
+
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_OPERATION_SUCCESS, _, _))
+        .With(IsOperationSuccess(remove_correlation_id));
+    readAllBroadcastsFromConductor(mock_broadcast_handler);
+}
+
 // TODO: Parameterise
 TEST_F(DriverConductorIpcTest, shouldAddIpcPublicationThenSubscriptionWithSessionId)
 {
@@ -555,6 +555,33 @@ TEST_F(DriverConductorNetworkTest, shouldUseExistingPublicationOnAddPublicationW
     EXPECT_EQ(aeron_driver_conductor_num_send_channel_endpoints(&m_conductor.m_conductor), 0u);
 }
 
+TEST_F(DriverConductorNetworkTest, shouldErrorOnAddPublicationWithDifferentPacingToExistingPublication)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t pub_id_1 = nextCorrelationId();
+    int64_t pub_id_2 = nextCorrelationId();
+    int64_t pub_id_3 = nextCorrelationId();
+    int64_t pub_id_4 = nextCorrelationId();
+
+    ASSERT_EQ(addPublication(client_id, pub_id_1, CHANNEL_1 "|rate=1m|burst=64k", STREAM_ID_1, false), 0);
+    ASSERT_EQ(addPublication(client_id, pub_id_2, CHANNEL_1 "|rate=1m", STREAM_ID_1, false), 0);
+    ASSERT_EQ(addPublication(client_id, pub_id_3, CHANNEL_1, STREAM_ID_1, false), 0);
+    doWorkUntilDone();
+    EXPECT_EQ(aeron_driver_conductor_num_network_publications(&m_conductor.m_conductor), 1u);
+    readAllBroadcastsFromConductor(null_broadcast_handler);
+
+    ASSERT_EQ(addPublication(client_id, pub_id_4, CHANNEL_1 "|rate=2m", STREAM_ID_1, false), 0);
+    doWorkUntilDone();
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_ERROR, _, _));
+    readAllBroadcastsFromConductor(mock_broadcast_handler);
+    testing::Mock::VerifyAndClear(&m_mockCallbacks);
+
+    ASSERT_EQ(addPublication(client_id, pub_id_4, CHANNEL_1 "|rate=1m|burst=32k", STREAM_ID_1, false), 0);
+    doWorkUntilDone();
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_ERROR, _, _));
+    readAllBroadcastsFromConductor(mock_broadcast_handler);
+}
+
 TEST_F(DriverConductorNetworkTest, shouldErrorWithUnknownSessionIdTag)
 {
     int64_t client_id = nextCorrelationId();
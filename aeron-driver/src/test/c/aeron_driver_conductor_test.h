@@ -18,6 +18,7 @@
 #define AERON_DRIVER_CONDUCTOR_TEST_H
 
 #include <array>
+#include <vector>
 #include <cstdint>
 #include <thread>
 #include <exception>
@@ -257,7 +258,7 @@ struct TestDriverConductor
         context.m_context->conductor_proxy = &m_conductor.conductor_proxy;
 
         if (aeron_driver_sender_init(
-            &m_sender, context.m_context, &m_conductor.system_counters, &m_conductor.error_log) < 0)
+            &m_sender, context.m_context, &m_conductor.system_counters, &m_conductor.error_log, 0) < 0)
         {
             throw std::runtime_error("could not init sender: " + std::string(aeron_errmsg()));
         }
@@ -265,7 +266,7 @@ struct TestDriverConductor
         context.m_context->sender_proxy = &m_sender.sender_proxy;
 
         if (aeron_driver_receiver_init(
-            &m_receiver, context.m_context, &m_conductor.system_counters, &m_conductor.error_log) < 0)
+            &m_receiver, context.m_context, &m_conductor.system_counters, &m_conductor.error_log, 0) < 0)
         {
             throw std::runtime_error("could not init receiver: " + std::string(aeron_errmsg()));
         }
@@ -342,9 +343,46 @@ public:
 
     inline int writeCommand(int32_t msg_type_id, size_t length)
     {
+        if (m_is_batching)
+        {
+            const size_t offset = m_batch_entries.size();
+            m_batch_entries.resize(
+                offset + AERON_ALIGN(sizeof(aeron_batch_entry_header_t) + length, AERON_BATCH_ENTRY_ALIGNMENT));
+
+            auto *header = reinterpret_cast<aeron_batch_entry_header_t *>(m_batch_entries.data() + offset);
+            header->msg_type_id = msg_type_id;
+            header->length = (int32_t)length;
+            memcpy(m_batch_entries.data() + offset + sizeof(aeron_batch_entry_header_t), m_command_buffer, length);
+            m_batch_entry_count++;
+
+            return 0;
+        }
+
         return aeron_mpsc_rb_write(&m_to_driver, msg_type_id, m_command_buffer, length);
     }
 
+    void startBatch()
+    {
+        m_batch_entries.clear();
+        m_batch_entry_count = 0;
+        m_is_batching = true;
+    }
+
+    int submitBatch(int64_t client_id, int64_t correlation_id)
+    {
+        std::vector<uint8_t> record(sizeof(aeron_batch_command_t) + m_batch_entries.size());
+        auto *cmd = reinterpret_cast<aeron_batch_command_t *>(record.data());
+
+        cmd->correlated.client_id = client_id;
+        cmd->correlated.correlation_id = correlation_id;
+        cmd->entry_count = m_batch_entry_count;
+        cmd->entries_length = (int32_t)m_batch_entries.size();
+        memcpy(record.data() + sizeof(aeron_batch_command_t), m_batch_entries.data(), m_batch_entries.size());
+        m_is_batching = false;
+
+        return aeron_mpsc_rb_write(&m_to_driver, AERON_COMMAND_BATCH, record.data(), record.size());
+    }
+
     int addIpcPublication(int64_t client_id, int64_t correlation_id, int32_t stream_id, bool is_exclusive)
     {
         return addPublication(client_id, correlation_id, AERON_IPC_CHANNEL, stream_id, is_exclusive);
@@ -614,6 +652,9 @@ public:
 
 protected:
     uint8_t m_command_buffer[AERON_MAX_PATH] = {};
+    std::vector<uint8_t> m_batch_entries;
+    int32_t m_batch_entry_count = 0;
+    bool m_is_batching = false;
     TestDriverContext m_context = {};
     TestDriverConductor m_conductor;
     aeron_broadcast_receiver_t m_broadcast_receiver = {};
@@ -991,4 +1032,13 @@ ACTION_P(CaptureCounterId, counter_id_out)
     *counter_id_out = response->counter_id;
 }
 
+ACTION_P2(CaptureBatchComplete, correlation_id_out, results_out)
+{
+    const aeron_batch_complete_t *response = reinterpret_cast<aeron_batch_complete_t *>(arg1);
+    const auto *results = reinterpret_cast<const aeron_batch_result_t *>(arg1 + sizeof(aeron_batch_complete_t));
+
+    *correlation_id_out = response->correlation_id;
+    results_out->assign(results, results + response->result_count);
+}
+
 #endif //AERON_DRIVER_CONDUCTOR_TEST_H
@@ -138,6 +138,88 @@ TEST_F(DriverUriTest, shouldParsePublicationParamUdpEndpointAndMtuLength)
     EXPECT_EQ(params.mtu_length, 18432u);
 }
 
+TEST_F(DriverUriTest, shouldParsePublicationParamRateAndBurst)
+{
+    aeron_driver_uri_publication_params_t params;
+
+    EXPECT_EQ(AERON_URI_PARSE("aeron:udp?endpoint=224.10.9.8|mtu=8k|rate=125m|burst=64k", &m_uri), 0);
+    EXPECT_EQ(aeron_diver_uri_publication_params(&m_uri, &params, &m_conductor, false), 0) << aeron_errmsg();
+    EXPECT_EQ(params.rate_bytes_per_sec, 125u * 1024 * 1024);
+    EXPECT_EQ(params.burst_length, 64u * 1024);
+}
+
+TEST_F(DriverUriTest, shouldDefaultBurstToFullSendBatchWhenPaced)
+{
+    aeron_driver_uri_publication_params_t params;
+
+    EXPECT_EQ(AERON_URI_PARSE("aeron:udp?endpoint=224.10.9.8|mtu=8k|rate=1m", &m_uri), 0);
+    EXPECT_EQ(aeron_diver_uri_publication_params(&m_uri, &params, &m_conductor, false), 0) << aeron_errmsg();
+    EXPECT_EQ(params.rate_bytes_per_sec, 1024u * 1024);
+    EXPECT_EQ(params.burst_length, 8u * 1024 * m_context->network_publication_max_messages_per_send);
+}
+
+TEST_F(DriverUriTest, shouldRejectBurstLessThanMtuOrWithoutRate)
+{
+    aeron_driver_uri_publication_params_t params;
+
+    EXPECT_EQ(AERON_URI_PARSE("aeron:udp?endpoint=224.10.9.8|mtu=8k|rate=1m|burst=4k", &m_uri), 0);
+    EXPECT_EQ(aeron_diver_uri_publication_params(&m_uri, &params, &m_conductor, false), -1);
+    EXPECT_THAT(std::string(aeron_errmsg()), ::testing::HasSubstr(AERON_URI_BURST_KEY));
+
+    aeron_uri_close(&m_uri);
+    EXPECT_EQ(AERON_URI_PARSE("aeron:udp?endpoint=224.10.9.8|burst=64k", &m_uri), 0);
+    EXPECT_EQ(aeron_diver_uri_publication_params(&m_uri, &params, &m_conductor, false), -1);
+
+    aeron_uri_close(&m_uri);
+    EXPECT_EQ(AERON_URI_PARSE("aeron:udp?endpoint=224.10.9.8|rate=0", &m_uri), 0);
+    EXPECT_EQ(aeron_diver_uri_publication_params(&m_uri, &params, &m_conductor, false), -1);
+}
+
+TEST_F(DriverUriTest, shouldRejectRateAndBurstForIpc)
+{
+    aeron_driver_uri_publication_params_t params;
+
+    EXPECT_EQ(AERON_URI_PARSE("aeron:ipc?rate=1m", &m_uri), 0);
+    EXPECT_EQ(aeron_diver_uri_publication_params(&m_uri, &params, &m_conductor, false), -1);
+    EXPECT_THAT(std::string(aeron_errmsg()), ::testing::HasSubstr("IPC"));
+
+    aeron_uri_close(&m_uri);
+    EXPECT_EQ(AERON_URI_PARSE("aeron:ipc?burst=64k", &m_uri), 0);
+    EXPECT_EQ(aeron_diver_uri_publication_params(&m_uri, &params, &m_conductor, false), -1);
+    EXPECT_THAT(std::string(aeron_errmsg()), ::testing::HasSubstr("IPC"));
+}
+
+TEST_F(DriverUriTest, shouldParsePublicationParamFecGroupLength)
+{
+    aeron_driver_uri_publication_params_t params;
+
+    EXPECT_EQ(AERON_URI_PARSE("aeron:udp?endpoint=224.10.9.8", &m_uri), 0);
+    EXPECT_EQ(aeron_diver_uri_publication_params(&m_uri, &params, &m_conductor, false), 0) << aeron_errmsg();
+    EXPECT_EQ(params.fec_group_length, 0);
+
+    aeron_uri_close(&m_uri);
+    EXPECT_EQ(AERON_URI_PARSE("aeron:udp?endpoint=224.10.9.8|fec=8", &m_uri), 0);
+    EXPECT_EQ(aeron_diver_uri_publication_params(&m_uri, &params, &m_conductor, false), 0) << aeron_errmsg();
+    EXPECT_EQ(params.fec_group_length, 8);
+}
+
+TEST_F(DriverUriTest, shouldRejectInvalidFecGroupLength)
+{
+    aeron_driver_uri_publication_params_t params;
+
+    EXPECT_EQ(AERON_URI_PARSE("aeron:udp?endpoint=224.10.9.8|fec=0", &m_uri), 0);
+    EXPECT_EQ(aeron_diver_uri_publication_params(&m_uri, &params, &m_conductor, false), -1);
+    EXPECT_THAT(std::string(aeron_errmsg()), ::testing::HasSubstr(AERON_URI_FEC_KEY));
+
+    aeron_uri_close(&m_uri);
+    EXPECT_EQ(AERON_URI_PARSE("aeron:udp?endpoint=224.10.9.8|fec=17", &m_uri), 0);
+    EXPECT_EQ(aeron_diver_uri_publication_params(&m_uri, &params, &m_conductor, false), -1);
+
+    aeron_uri_close(&m_uri);
+    EXPECT_EQ(AERON_URI_PARSE("aeron:udp?endpoint=224.10.9.8|mtu=65504|fec=4", &m_uri), 0);
+    EXPECT_EQ(aeron_diver_uri_publication_params(&m_uri, &params, &m_conductor, false), -1);
+}
+
 TEST_F(DriverUriTest, shouldParsePublicationParamIpcMtuLength32K)
 {
     aeron_driver_uri_publication_params_t params;
@@ -180,6 +262,29 @@ TEST_F(DriverUriTest, shouldParsePublicationParamIpcSparse)
     EXPECT_EQ(params.is_sparse, true);
 }
 
+TEST_F(DriverUriTest, shouldParsePublicationParamIpcHugePages)
+{
+    aeron_driver_uri_publication_params_t params;
+    char huge_pages_log_dir[] = "/dev/hugepages/aeron";
+    m_context->huge_pages_log_dir = huge_pages_log_dir;
+
+    EXPECT_EQ(AERON_URI_PARSE("aeron:ipc?huge-pages=true", &m_uri), 0);
+    EXPECT_EQ(aeron_diver_uri_publication_params(&m_uri, &params, &m_conductor, false), 0) << aeron_errmsg();
+    EXPECT_EQ(params.is_huge_pages, true);
+
+    m_context->huge_pages_log_dir = nullptr;
+}
+
+TEST_F(DriverUriTest, shouldRejectHugePagesParamWithoutHugePagesDir)
+{
+    aeron_driver_uri_publication_params_t params;
+    aeron_driver_uri_subscription_params_t subscription_params;
+
+    EXPECT_EQ(AERON_URI_PARSE("aeron:ipc?huge-pages=true", &m_uri), 0);
+    EXPECT_EQ(aeron_diver_uri_publication_params(&m_uri, &params, &m_conductor, false), -1);
+    EXPECT_EQ(aeron_driver_uri_subscription_params(&m_uri, &subscription_params, &m_conductor), -1);
+}
+
 TEST_F(DriverUriTest, shouldParsePublicationParamsForReplayUdp)
 {
     aeron_driver_uri_publication_params_t params;
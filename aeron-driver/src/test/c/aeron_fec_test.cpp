@@ -0,0 +1,223 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <array>
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "concurrent/aeron_logbuffer_descriptor.h"
+#include "aeron_fec.h"
+}
+
+#define TERM_LENGTH (AERON_LOGBUFFER_TERM_MIN_LENGTH)
+#define MTU_LENGTH (1408)
+#define SESSION_ID (1001)
+#define STREAM_ID (101)
+#define TERM_ID (7)
+
+class FecTest : public testing::Test
+{
+public:
+    FecTest() : m_sent(TERM_LENGTH, 0), m_received(TERM_LENGTH, 0), m_recovered(MTU_LENGTH, 0)
+    {
+    }
+
+protected:
+    void TearDown() override
+    {
+        aeron_fec_encoder_close(&m_encoder);
+    }
+
+    void writeDatagram(int32_t term_offset, int32_t length)
+    {
+        auto *header = reinterpret_cast<aeron_data_header_t *>(m_sent.data() + term_offset);
+        header->frame_header.frame_length = length;
+        header->frame_header.version = AERON_FRAME_HEADER_VERSION;
+        header->frame_header.flags = AERON_DATA_HEADER_UNFRAGMENTED;
+        header->frame_header.type = AERON_HDR_TYPE_DATA;
+        header->term_offset = term_offset;
+        header->session_id = SESSION_ID;
+        header->stream_id = STREAM_ID;
+        header->term_id = TERM_ID;
+
+        for (int32_t i = AERON_DATA_HEADER_LENGTH; i < length; i++)
+        {
+            m_sent[term_offset + i] = static_cast<uint8_t>(term_offset + (i * 31));
+        }
+    }
+
+    size_t encode(const std::vector<int32_t> &lengths)
+    {
+        EXPECT_EQ(0, aeron_fec_encoder_init(
+            &m_encoder, static_cast<int32_t>(lengths.size()), MTU_LENGTH, SESSION_ID, STREAM_ID));
+
+        int32_t term_offset = 0;
+        for (int32_t length : lengths)
+        {
+            writeDatagram(term_offset, length);
+            EXPECT_FALSE(aeron_fec_encoder_add(
+                &m_encoder, TERM_ID, term_offset, m_sent.data() + term_offset, static_cast<size_t>(length)));
+            m_offsets.push_back(term_offset);
+            term_offset += length;
+        }
+
+        return aeron_fec_encoder_flush(&m_encoder);
+    }
+
+    void receive(size_t index, const std::vector<int32_t> &lengths)
+    {
+        std::memcpy(m_received.data() + m_offsets[index], m_sent.data() + m_offsets[index], lengths[index]);
+    }
+
+    aeron_fec_header_t *fecHeader()
+    {
+        return reinterpret_cast<aeron_fec_header_t *>(m_encoder.frame);
+    }
+
+    size_t recover(int32_t *term_offset)
+    {
+        return aeron_fec_recover(fecHeader(), m_received.data(), TERM_LENGTH, m_recovered.data(), term_offset);
+    }
+
+    aeron_fec_encoder_t m_encoder = {};
+    std::vector<uint8_t> m_sent;
+    std::vector<uint8_t> m_received;
+    std::vector<uint8_t> m_recovered;
+    std::vector<int32_t> m_offsets;
+};
+
+TEST_F(FecTest, shouldXorAcrossVectorAndScalarLengths)
+{
+    for (size_t length : { 0, 1, 7, 8, 15, 16, 17, 33, 100 })
+    {
+        std::vector<uint8_t> dst(length), src(length), expected(length);
+        for (size_t i = 0; i < length; i++)
+        {
+            dst[i] = static_cast<uint8_t>(i * 7);
+            src[i] = static_cast<uint8_t>(i * 13 + 1);
+            expected[i] = dst[i] ^ src[i];
+        }
+
+        aeron_fec_xor(dst.data(), src.data(), length);
+        EXPECT_EQ(expected, dst) << length;
+    }
+}
+
+TEST_F(FecTest, shouldBeDisabledWithoutGroupLength)
+{
+    ASSERT_EQ(0, aeron_fec_encoder_init(&m_encoder, 0, MTU_LENGTH, SESSION_ID, STREAM_ID));
+
+    EXPECT_FALSE(aeron_fec_encoder_is_enabled(&m_encoder));
+    EXPECT_EQ(nullptr, m_encoder.frame);
+}
+
+TEST_F(FecTest, shouldCompleteGroupWhenFullOrNotContiguous)
+{
+    ASSERT_EQ(0, aeron_fec_encoder_init(&m_encoder, 2, MTU_LENGTH, SESSION_ID, STREAM_ID));
+    writeDatagram(0, 64);
+    writeDatagram(64, 96);
+    writeDatagram(160, 64);
+    writeDatagram(512, 64);
+
+    EXPECT_FALSE(aeron_fec_encoder_add(&m_encoder, TERM_ID, 0, m_sent.data(), 64));
+    EXPECT_TRUE(aeron_fec_encoder_add(&m_encoder, TERM_ID, 512, m_sent.data() + 512, 64));
+    EXPECT_TRUE(aeron_fec_encoder_add(&m_encoder, TERM_ID + 1, 64, m_sent.data() + 64, 96));
+    EXPECT_FALSE(aeron_fec_encoder_add(&m_encoder, TERM_ID, 64, m_sent.data() + 64, 96));
+    EXPECT_EQ(2, aeron_fec_encoder_datagram_count(&m_encoder));
+    EXPECT_TRUE(aeron_fec_encoder_add(&m_encoder, TERM_ID, 160, m_sent.data() + 160, 64));
+
+    EXPECT_EQ(sizeof(aeron_fec_header_t) + 96, aeron_fec_encoder_flush(&m_encoder));
+    EXPECT_EQ(AERON_HDR_TYPE_FEC, fecHeader()->frame_header.type);
+    EXPECT_EQ(0, fecHeader()->term_offset);
+    EXPECT_EQ(TERM_ID, fecHeader()->term_id);
+    EXPECT_EQ(96, fecHeader()->parity_length);
+    EXPECT_EQ(64, fecHeader()->datagram_lengths[0]);
+    EXPECT_EQ(96, fecHeader()->datagram_lengths[1]);
+    EXPECT_EQ(0u, aeron_fec_encoder_flush(&m_encoder));
+}
+
+TEST_F(FecTest, shouldRecoverSingleMissingDatagram)
+{
+    const std::vector<int32_t> lengths = { 1024, 96, 1408, 64 };
+    const size_t frame_length = encode(lengths);
+    ASSERT_EQ(sizeof(aeron_fec_header_t) + 1408, frame_length);
+    ASSERT_EQ(1024 + 96 + 1408 + 64, aeron_fec_group_length(fecHeader(), frame_length, MTU_LENGTH));
+
+    for (size_t missing = 0; missing < lengths.size(); missing++)
+    {
+        std::fill(m_received.begin(), m_received.end(), 0);
+        for (size_t i = 0; i < lengths.size(); i++)
+        {
+            if (i != missing)
+            {
+                receive(i, lengths);
+            }
+        }
+
+        int32_t term_offset = -1;
+        ASSERT_EQ(static_cast<size_t>(lengths[missing]), recover(&term_offset)) << missing;
+        EXPECT_EQ(m_offsets[missing], term_offset);
+        EXPECT_EQ(0, std::memcmp(m_sent.data() + term_offset, m_recovered.data(), lengths[missing])) << missing;
+    }
+}
+
+TEST_F(FecTest, shouldNotRecoverWhenNothingOrMoreThanOneDatagramIsMissing)
+{
+    const std::vector<int32_t> lengths = { 128, 128, 128 };
+    encode(lengths);
+    int32_t term_offset = -1;
+
+    receive(0, lengths);
+    EXPECT_EQ(0u, recover(&term_offset));
+
+    receive(1, lengths);
+    receive(2, lengths);
+    EXPECT_EQ(0u, recover(&term_offset));
+    EXPECT_EQ(-1, term_offset);
+}
+
+TEST_F(FecTest, shouldNotRecoverDatagramForAnotherStream)
+{
+    const std::vector<int32_t> lengths = { 128, 128 };
+    encode(lengths);
+    receive(0, lengths);
+    fecHeader()->stream_id = STREAM_ID + 1;
+
+    int32_t term_offset = -1;
+    EXPECT_EQ(0u, recover(&term_offset));
+}
+
+TEST_F(FecTest, shouldRejectMalformedHeader)
+{
+    const std::vector<int32_t> lengths = { 128, 256 };
+    const size_t frame_length = encode(lengths);
+
+    EXPECT_EQ(384, aeron_fec_group_length(fecHeader(), frame_length, MTU_LENGTH));
+    EXPECT_EQ(-1, aeron_fec_group_length(fecHeader(), frame_length - 1, MTU_LENGTH));
+    EXPECT_EQ(-1, aeron_fec_group_length(fecHeader(), frame_length, 128));
+
+    fecHeader()->datagram_lengths[0] = 512;
+    EXPECT_EQ(-1, aeron_fec_group_length(fecHeader(), frame_length, MTU_LENGTH));
+
+    fecHeader()->datagram_lengths[0] = 128;
+    fecHeader()->datagram_count = AERON_FEC_MAX_DATAGRAMS + 1;
+    EXPECT_EQ(-1, aeron_fec_group_length(fecHeader(), frame_length, MTU_LENGTH));
+}
@@ -15,6 +15,7 @@
  */
 
 #include <array>
+#include <string>
 #include <gtest/gtest.h>
 
 extern "C"
@@ -22,8 +23,16 @@ extern "C"
 #include "aeron_ipc_publication.h"
 #include "aeron_driver_sender.h"
 #include "aeron_position.h"
+#include "aeron_driver_conductor.h"
 
 int aeron_driver_ensure_dir_is_recreated(aeron_driver_context_t *context);
+
+int aeron_driver_subscribable_add_position(
+    aeron_subscribable_t *subscribable,
+    aeron_subscription_link_t *link,
+    int32_t counter_id,
+    int64_t *value_addr,
+    int64_t now_ns);
 }
 
 #define CAPACITY (32 * 1024)
@@ -72,7 +81,7 @@ protected:
         aeron_driver_context_close(m_context);
     }
 
-    aeron_ipc_publication_t *createPublication(const char *uri)
+    aeron_ipc_publication_t *createPublication(const char *uri, bool is_huge_pages = false, size_t term_length = 0)
     {
         int64_t registration_id = 1;
         int32_t stream_id = 10;
@@ -101,6 +110,8 @@ protected:
             &m_counters_manager, pub_lmt_position.counter_id);
 
         aeron_driver_uri_publication_params_t params = {};
+        params.is_huge_pages = is_huge_pages;
+        params.term_length = term_length;
 
         aeron_ipc_publication_t *publication = nullptr;
         if (aeron_ipc_publication_create(
@@ -151,6 +162,49 @@ TEST_F(IpcPublicationTest, shouldCreatePublication)
     EXPECT_FALSE(publication->is_exclusive);
 }
 
+TEST_F(IpcPublicationTest, shouldPlaceHugePagesLogBufferInHugePagesDir)
+{
+    const size_t huge_page_size = 64 * 1024;
+    aeron_driver_context_set_huge_pages_dir(m_context, m_context->aeron_dir);
+    aeron_driver_context_set_huge_page_size(m_context, huge_page_size);
+    ASSERT_EQ(0, aeron_driver_ensure_dir_is_recreated(m_context)) << aeron_errmsg();
+    ASSERT_NE(nullptr, m_context->huge_pages_log_dir);
+
+    aeron_ipc_publication_t *publication = createPublication("aeron:ipc?huge-pages=true", true);
+
+    ASSERT_NE(nullptr, publication) << aeron_errmsg();
+    const std::string log_file_name = publication->log_file_name;
+    EXPECT_EQ(0u, log_file_name.find(m_context->huge_pages_log_dir));
+    EXPECT_EQ(static_cast<int64_t>(huge_page_size), aeron_file_length(log_file_name.c_str()));
+    EXPECT_EQ(static_cast<int32_t>(huge_page_size), publication->log_meta_data->page_size);
+}
+
+TEST_F(IpcPublicationTest, shouldNotRecreateHugePagesDirOfAnotherAeronDirWithSameName)
+{
+    const std::string aeron_dir = m_context->aeron_dir;
+    char other_aeron_dir[AERON_MAX_PATH];
+    ASSERT_LE(0, aeron_file_resolve(
+        aeron_dir.c_str(),
+        aeron_dir.substr(aeron_dir.find_last_of("/\\") + 1).c_str(),
+        other_aeron_dir,
+        sizeof(other_aeron_dir)));
+    aeron_driver_context_set_huge_pages_dir(m_context, aeron_dir.c_str());
+    ASSERT_EQ(0, aeron_driver_ensure_dir_is_recreated(m_context)) << aeron_errmsg();
+    const std::string huge_pages_log_dir = m_context->huge_pages_log_dir;
+
+    aeron_driver_context_t *other_context = nullptr;
+    ASSERT_EQ(0, aeron_driver_context_init(&other_context));
+    aeron_driver_context_set_dir(other_context, other_aeron_dir);
+    aeron_driver_context_set_dir_delete_on_start(other_context, true);
+    aeron_driver_context_set_huge_pages_dir(other_context, aeron_dir.c_str());
+    ASSERT_EQ(0, aeron_driver_ensure_dir_is_recreated(other_context)) << aeron_errmsg();
+
+    EXPECT_NE(huge_pages_log_dir, std::string(other_context->huge_pages_log_dir));
+    EXPECT_TRUE(aeron_is_directory(huge_pages_log_dir.c_str()));
+
+    aeron_driver_context_close(other_context);
+}
+
 TEST_F(IpcPublicationTest, shouldReturnStorageSpaceErrorIfNotEnoughStorageSpaceAvailable)
 {
     m_context->usable_fs_space_func = [](const char* path) -> uint64_t
@@ -194,3 +248,29 @@ TEST_F(IpcPublicationTest, shouldWarnIfRemainingStorageSpaceIsLow)
             .append(m_context->aeron_dir);
     EXPECT_NE(std::string::npos, error_text.find(expected_warning));
 }
+
+TEST_F(IpcPublicationTest, shouldKeepLimitAheadOfSubscriberWhileCleaningInline)
+{
+    const size_t term_length = AERON_LOGBUFFER_TERM_MIN_LENGTH;
+    aeron_ipc_publication_t *publication = createPublication("aeron:ipc", false, term_length);
+    ASSERT_NE(nullptr, publication) << aeron_errmsg();
+    ASSERT_EQ(nullptr, publication->cleaner_log.cleaner);
+
+    int64_t subscriber_position = 0;
+    aeron_subscription_link_t link = {};
+    link.is_tether = true;
+    ASSERT_EQ(0, aeron_driver_subscribable_add_position(
+        &publication->conductor_fields.subscribable, &link, 1, &subscriber_position, 0));
+
+    const int64_t window_length = publication->term_window_length;
+    for (int i = 0; i < 10 * 8; i++)
+    {
+        subscriber_position += (int64_t)term_length / 8;
+        aeron_ipc_publication_update_pub_pos_and_lmt(publication);
+
+        ASSERT_EQ(subscriber_position + window_length, aeron_counter_get(publication->pub_lmt_position.value_addr))
+            << "step " << i;
+    }
+
+    EXPECT_GE(publication->cleaner_log.clean_position, subscriber_position - (int64_t)(term_length * 2));
+}
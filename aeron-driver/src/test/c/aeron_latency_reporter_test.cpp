@@ -0,0 +1,282 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "reports/aeron_latency_reporter.h"
+}
+
+#define CAPACITY (8192)
+
+#define REGISTRATION_ID (0x2F)
+#define SESSION_ID (0x0EADBEEF)
+#define STREAM_ID (0x12A)
+
+typedef std::array<std::uint8_t, CAPACITY> buffer_t;
+
+class LatencyReporterTest : public testing::Test
+{
+public:
+    LatencyReporterTest() :
+        m_ptr(m_buffer.data())
+    {
+        m_buffer.fill(0);
+    }
+
+    static void on_latency_entry(
+        void *clientd,
+        int64_t registration_id,
+        int32_t session_id,
+        int32_t stream_id,
+        int32_t hop,
+        const char *channel,
+        int32_t channel_length,
+        int64_t sample_count,
+        int64_t total_ns,
+        int64_t max_ns,
+        const int64_t *buckets,
+        size_t bucket_count)
+    {
+        auto *t = (LatencyReporterTest *)clientd;
+
+        t->m_on_latency_entry(
+            registration_id,
+            session_id,
+            stream_id,
+            hop,
+            channel,
+            channel_length,
+            sample_count,
+            total_ns,
+            max_ns,
+            buckets,
+            bucket_count);
+    }
+
+protected:
+    buffer_t m_buffer = {};
+    uint8_t *m_ptr = nullptr;
+    aeron_latency_reporter_t m_reporter = {};
+    std::function<void(
+        int64_t, int32_t, int32_t, int32_t, const char *, int32_t, int64_t, int64_t, int64_t, const int64_t *, size_t)>
+        m_on_latency_entry;
+};
+
+TEST_F(LatencyReporterTest, shouldMapValuesToBucketsWithBoundedError)
+{
+    for (int64_t value = 0; value < AERON_LATENCY_REPORT_SUB_BUCKET_COUNT; value++)
+    {
+        EXPECT_EQ(aeron_latency_reporter_bucket_index(value), (size_t)value);
+        EXPECT_EQ(aeron_latency_reporter_bucket_highest_value((size_t)value), value);
+    }
+
+    const int64_t values[] = { 8, 9, 15, 16, 17, 1000, 12345, 999999, INT64_C(1000000000), INT64_C(10000000000) };
+    for (int64_t value : values)
+    {
+        const size_t index = aeron_latency_reporter_bucket_index(value);
+        const int64_t highest_value = aeron_latency_reporter_bucket_highest_value(index);
+
+        EXPECT_GE(highest_value, value) << value;
+        EXPECT_LE(highest_value - value, value / AERON_LATENCY_REPORT_SUB_BUCKET_COUNT) << value;
+        if (index > 0)
+        {
+            EXPECT_LT(aeron_latency_reporter_bucket_highest_value(index - 1), value) << value;
+        }
+    }
+
+    EXPECT_EQ(aeron_latency_reporter_bucket_index(-1), 0u);
+    EXPECT_EQ(aeron_latency_reporter_bucket_index(INT64_MAX), (size_t)AERON_LATENCY_REPORT_BUCKET_COUNT - 1);
+    EXPECT_EQ(aeron_latency_reporter_bucket_highest_value(AERON_LATENCY_REPORT_BUCKET_COUNT - 1), INT64_MAX);
+}
+
+TEST_F(LatencyReporterTest, shouldCreateAndRecordEntry)
+{
+    ASSERT_EQ(aeron_latency_reporter_init(&m_reporter, m_ptr, CAPACITY), 0);
+
+    const char *channel = "aeron:udp://stuff";
+
+    aeron_latency_reporter_entry_offset_t offset = aeron_latency_reporter_create_entry(
+        &m_reporter,
+        REGISTRATION_ID,
+        SESSION_ID,
+        STREAM_ID,
+        AERON_LATENCY_REPORT_HOP_WIRE_TO_TERM,
+        channel,
+        strlen(channel));
+
+    EXPECT_EQ(offset, 0);
+
+    aeron_latency_reporter_record(&m_reporter, offset, 5);
+    aeron_latency_reporter_record(&m_reporter, offset, 1000);
+    aeron_latency_reporter_record(&m_reporter, offset, -3);
+
+    auto *entry = (aeron_latency_reporter_entry_t *)m_ptr;
+    EXPECT_EQ(entry->registration_id, REGISTRATION_ID);
+    EXPECT_EQ(entry->session_id, SESSION_ID);
+    EXPECT_EQ(entry->stream_id, STREAM_ID);
+    EXPECT_EQ(entry->hop, AERON_LATENCY_REPORT_HOP_WIRE_TO_TERM);
+    EXPECT_EQ(entry->sample_count, 3);
+    EXPECT_EQ(entry->total_ns, 1005);
+    EXPECT_EQ(entry->max_ns, 1000);
+    EXPECT_EQ(entry->buckets[0], 1);
+    EXPECT_EQ(entry->buckets[5], 1);
+    EXPECT_EQ(entry->buckets[aeron_latency_reporter_bucket_index(1000)], 1);
+}
+
+TEST_F(LatencyReporterTest, shouldReadNoEntriesInEmptyReport)
+{
+    size_t called = 0;
+    m_on_latency_entry =
+        [&](int64_t registration_id,
+            int32_t session_id,
+            int32_t stream_id,
+            int32_t hop,
+            const char *channel,
+            int32_t channel_length,
+            int64_t sample_count,
+            int64_t total_ns,
+            int64_t max_ns,
+            const int64_t *buckets,
+            size_t bucket_count)
+        {
+            called++;
+        };
+
+    EXPECT_EQ(aeron_latency_reporter_read(m_ptr, CAPACITY, LatencyReporterTest::on_latency_entry, this), 0u);
+    EXPECT_EQ(called, 0u);
+}
+
+TEST_F(LatencyReporterTest, shouldReadTwoEntries)
+{
+    ASSERT_EQ(aeron_latency_reporter_init(&m_reporter, m_ptr, CAPACITY), 0);
+
+    const char *channel_1 = "aeron:udp://stuff";
+    const char *channel_2 = "aeron:udp://stuff2";
+
+    aeron_latency_reporter_entry_offset_t offset_1 = aeron_latency_reporter_create_entry(
+        &m_reporter,
+        REGISTRATION_ID,
+        SESSION_ID,
+        STREAM_ID,
+        AERON_LATENCY_REPORT_HOP_SEND_TO_WIRE,
+        channel_1,
+        strlen(channel_1));
+
+    aeron_latency_reporter_entry_offset_t offset_2 = aeron_latency_reporter_create_entry(
+        &m_reporter,
+        REGISTRATION_ID + 1,
+        SESSION_ID + 1,
+        STREAM_ID + 1,
+        AERON_LATENCY_REPORT_HOP_TERM_TO_SUBSCRIBER,
+        channel_2,
+        strlen(channel_2));
+
+    EXPECT_EQ(offset_1, 0);
+    EXPECT_GT(offset_2, 0);
+    EXPECT_EQ(offset_2 % AERON_LATENCY_REPORTER_ENTRY_ALIGNMENT, 0);
+
+    for (int64_t i = 1; i <= 100; i++)
+    {
+        aeron_latency_reporter_record(&m_reporter, offset_2, i);
+    }
+
+    size_t called = 0;
+    m_on_latency_entry =
+        [&](int64_t registration_id,
+            int32_t session_id,
+            int32_t stream_id,
+            int32_t hop,
+            const char *read_channel,
+            int32_t channel_length,
+            int64_t sample_count,
+            int64_t total_ns,
+            int64_t max_ns,
+            const int64_t *buckets,
+            size_t bucket_count)
+        {
+            called++;
+
+            EXPECT_EQ(bucket_count, (size_t)AERON_LATENCY_REPORT_BUCKET_COUNT);
+            if (1 == called)
+            {
+                EXPECT_EQ(registration_id, REGISTRATION_ID);
+                EXPECT_EQ(session_id, SESSION_ID);
+                EXPECT_EQ(stream_id, STREAM_ID);
+                EXPECT_EQ(hop, AERON_LATENCY_REPORT_HOP_SEND_TO_WIRE);
+                EXPECT_EQ(std::string(read_channel, channel_length), std::string(channel_1));
+                EXPECT_EQ(sample_count, 0);
+                EXPECT_EQ(aeron_latency_report_value_at_percentile(buckets, bucket_count, 50.0), 0);
+            }
+            else if (2 == called)
+            {
+                EXPECT_EQ(registration_id, REGISTRATION_ID + 1);
+                EXPECT_EQ(session_id, SESSION_ID + 1);
+                EXPECT_EQ(stream_id, STREAM_ID + 1);
+                EXPECT_EQ(hop, AERON_LATENCY_REPORT_HOP_TERM_TO_SUBSCRIBER);
+                EXPECT_EQ(std::string(read_channel, channel_length), std::string(channel_2));
+                EXPECT_EQ(sample_count, 100);
+                EXPECT_EQ(total_ns, 5050);
+                EXPECT_EQ(max_ns, 100);
+
+                const int64_t p50 = aeron_latency_report_value_at_percentile(buckets, bucket_count, 50.0);
+                const int64_t p99 = aeron_latency_report_value_at_percentile(buckets, bucket_count, 99.0);
+                EXPECT_GE(p50, 50);
+                EXPECT_LE(p50, 50 + 50 / AERON_LATENCY_REPORT_SUB_BUCKET_COUNT);
+                EXPECT_GE(p99, 99);
+                EXPECT_LE(p99, 99 + 99 / AERON_LATENCY_REPORT_SUB_BUCKET_COUNT);
+            }
+        };
+
+    EXPECT_EQ(aeron_latency_reporter_read(m_ptr, CAPACITY, LatencyReporterTest::on_latency_entry, this), 2u);
+    EXPECT_EQ(called, 2u);
+}
+
+TEST_F(LatencyReporterTest, shouldFailToCreateEntryWhenFull)
+{
+    ASSERT_EQ(aeron_latency_reporter_init(&m_reporter, m_ptr, CAPACITY), 0);
+
+    const char *channel = "aeron:udp://stuff";
+    aeron_latency_reporter_entry_offset_t offset;
+    int created = 0;
+
+    while ((offset = aeron_latency_reporter_create_entry(
+        &m_reporter,
+        REGISTRATION_ID,
+        SESSION_ID,
+        STREAM_ID,
+        AERON_LATENCY_REPORT_HOP_WIRE_TO_TERM,
+        channel,
+        strlen(channel))) >= 0)
+    {
+        created++;
+    }
+
+    EXPECT_EQ(offset, -1);
+    EXPECT_EQ(aeron_errcode(), ENOMEM);
+    EXPECT_EQ(created, (int)(CAPACITY / AERON_ALIGN(
+        sizeof(aeron_latency_reporter_entry_t) + strlen(channel), AERON_LATENCY_REPORTER_ENTRY_ALIGNMENT)));
+    m_on_latency_entry =
+        [&](int64_t, int32_t, int32_t, int32_t, const char *, int32_t, int64_t, int64_t, int64_t, const int64_t *, size_t)
+        {
+        };
+
+    EXPECT_EQ(aeron_latency_reporter_read(m_ptr, CAPACITY, LatencyReporterTest::on_latency_entry, this), (size_t)created);
+}
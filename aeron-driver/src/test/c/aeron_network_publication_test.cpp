@@ -59,7 +59,7 @@ protected:
         aeron_distinct_error_log_init(
             &m_error_log, m_error_log_buffer.data(), m_error_log_buffer.size(), aeron_epoch_clock);
 
-        aeron_driver_sender_init(&m_sender, m_context, &m_system_counters, nullptr);
+        aeron_driver_sender_init(&m_sender, m_context, &m_system_counters, nullptr, 0);
 
         m_sender_proxy.sender = &m_sender;
         m_context->sender_proxy = &m_sender_proxy;
@@ -101,7 +101,8 @@ protected:
         aeron_driver_uri_publication_params_t params = {};
         params.mtu_length = 1408;
         aeron_send_channel_endpoint_t *endpoint = nullptr;
-        if (aeron_send_channel_endpoint_create(&endpoint, channel, &params, m_context, &m_counters_manager, 1) < 0)
+        if (aeron_send_channel_endpoint_create(
+            &endpoint, channel, &params, m_context, &m_counters_manager, 1, m_context->sender_proxy) < 0)
         {
             return nullptr;
         }
@@ -110,7 +111,7 @@ protected:
         return endpoint;
     }
 
-    aeron_network_publication_t *createPublication(const char *uri)
+    aeron_network_publication_t *createPublication(const char *uri, size_t term_length = 0)
     {
         aeron_send_channel_endpoint_t *endpoint = createEndpoint(uri);
         if (nullptr == endpoint)
@@ -165,6 +166,7 @@ protected:
         aeron_unicast_flow_control_strategy_supplier(&flow_control, nullptr, nullptr, nullptr, 0, 0, 0, 0, 0);
 
         aeron_driver_uri_publication_params_t params = {};
+        params.term_length = term_length;
 
         aeron_network_publication_t *publication = nullptr;
         if (aeron_network_publication_create(
@@ -180,6 +182,8 @@ protected:
             &snd_pos_position,
             &snd_lmt_position,
             &snd_bpe_counter,
+            nullptr,
+            nullptr,
             flow_control,
             &params,
             false,
@@ -232,6 +236,8 @@ TEST_F(NetworkPublicationTest, shouldSendHeartbeatWhileSendingPeriodicSetups)
     aeron_driver_conductor_proxy_t proxy = {};
     proxy.conductor = &conductor;
     proxy.threading_mode = AERON_THREADING_MODE_INVOKER;
+    ASSERT_EQ(0, aeron_int64_to_ptr_hash_map_init(
+        &conductor.publication_image_by_id_map, 8, AERON_MAP_DEFAULT_LOAD_FACTOR));
 
     aeron_network_publication_t *publication = createPublication("aeron:udp?endpoint=localhost:23245");
     ASSERT_NE(nullptr, publication) << aeron_errmsg();
@@ -261,6 +267,8 @@ TEST_F(NetworkPublicationTest, shouldSendHeartbeatWhileSendingPeriodicSetups)
     aeron_network_publication_send(publication, time_ns);
     ASSERT_EQ(1, test_bindings_state->setup_count);
     ASSERT_EQ(3, test_bindings_state->heartbeat_count);
+
+    aeron_int64_to_ptr_hash_map_delete(&conductor.publication_image_by_id_map);
 }
 
 TEST_F(NetworkPublicationTest, shouldReturnStorageSpaceErrorIfNotEnoughStorageSpaceAvailable)
@@ -306,3 +314,27 @@ TEST_F(NetworkPublicationTest, shouldWarnIfRemainingStorageSpaceIsLow)
             .append(m_context->aeron_dir);
     EXPECT_NE(std::string::npos, error_text.find(expected_warning));
 }
+
+TEST_F(NetworkPublicationTest, shouldKeepLimitAheadOfSenderWhileCleaningInline)
+{
+    const size_t term_length = AERON_LOGBUFFER_TERM_MIN_LENGTH;
+    aeron_network_publication_t *publication = createPublication("aeron:udp?endpoint=localhost:23245", term_length);
+    ASSERT_NE(nullptr, publication) << aeron_errmsg();
+    ASSERT_EQ(nullptr, publication->cleaner_log.cleaner);
+
+    publication->has_receivers = true;
+
+    const int64_t window_length = publication->term_window_length;
+    int64_t sender_position = 0;
+    for (int i = 0; i < 10 * 8; i++)
+    {
+        sender_position += (int64_t)term_length / 8;
+        aeron_counter_set_ordered(publication->snd_pos_position.value_addr, sender_position);
+        aeron_network_publication_update_pub_pos_and_lmt(publication);
+
+        ASSERT_EQ(sender_position + window_length, aeron_counter_get(publication->pub_lmt_position.value_addr))
+            << "step " << i;
+    }
+
+    EXPECT_GE(publication->cleaner_log.clean_position, sender_position - (int64_t)(term_length * 2));
+}
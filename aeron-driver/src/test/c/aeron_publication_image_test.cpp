@@ -22,6 +22,7 @@ extern "C"
 #include "aeron_publication_image.h"
 #include "aeron_data_packet_dispatcher.h"
 #include "aeron_driver_receiver.h"
+#include "aeron_fec.h"
 }
 
 #define CAPACITY (32 * 1024)
@@ -55,7 +56,7 @@ TEST_F(PublicationImageTest, shouldAddAndRemoveDestination)
     aeron_receive_destination_t *dest_1;
 
     ASSERT_LE(0, aeron_receive_destination_create(
-        &dest_1, channel_1, channel_1, m_context, &m_counters_manager, registration_id, endpoint->channel_status.counter_id));
+        &dest_1, channel_1, channel_1, m_context, m_context->receiver_proxy, &m_counters_manager, registration_id, endpoint->channel_status.counter_id));
     ASSERT_EQ(1, aeron_receive_channel_endpoint_add_destination(endpoint, dest_1));
 
     aeron_publication_image_t *image = createImage(endpoint, dest_1, stream_id, session_id);
@@ -64,7 +65,7 @@ TEST_F(PublicationImageTest, shouldAddAndRemoveDestination)
     aeron_receive_destination_t *dest_2;
 
     ASSERT_LE(0, aeron_receive_destination_create(
-        &dest_2, channel_2, channel_2, m_context, &m_counters_manager, registration_id, endpoint->channel_status.counter_id));
+        &dest_2, channel_2, channel_2, m_context, m_context->receiver_proxy, &m_counters_manager, registration_id, endpoint->channel_status.counter_id));
     ASSERT_EQ(2, aeron_receive_channel_endpoint_add_destination(endpoint, dest_2));
 
     ASSERT_EQ(2, aeron_publication_image_add_destination(image, dest_2));
@@ -124,13 +125,13 @@ TEST_F(PublicationImageTest, shouldSendControlMessagesToAllDestinations)
     aeron_udp_channel_parse(strlen(uri_2), uri_2, &m_resolver, &channel_2, false);
 
     ASSERT_LE(0, aeron_receive_destination_create(
-        &dest_1, channel_1, channel_1, m_context, &m_counters_manager, registration_id, endpoint->channel_status.counter_id));
+        &dest_1, channel_1, channel_1, m_context, m_context->receiver_proxy, &m_counters_manager, registration_id, endpoint->channel_status.counter_id));
     ASSERT_EQ(1, aeron_receive_channel_endpoint_add_destination(endpoint, dest_1));
 
     aeron_publication_image_t *image = createImage(endpoint, dest_1, stream_id, session_id);
 
     ASSERT_LE(0, aeron_receive_destination_create(
-        &dest_2, channel_2, channel_2, m_context, &m_counters_manager, registration_id, endpoint->channel_status.counter_id));
+        &dest_2, channel_2, channel_2, m_context, m_context->receiver_proxy, &m_counters_manager, registration_id, endpoint->channel_status.counter_id));
     ASSERT_EQ(2, aeron_receive_channel_endpoint_add_destination(endpoint, dest_2));
 
     ASSERT_EQ(2, aeron_publication_image_add_destination(image, dest_2));
@@ -159,7 +160,7 @@ TEST_F(PublicationImageTest, shouldSendControlMessagesToAllDestinations)
     message->term_id = 0;
     message->term_offset = 0;
 
-    aeron_publication_image_insert_packet(image, dest_2, 0, 0, data, 64, &addr);
+    aeron_publication_image_insert_packet(image, dest_2, 0, 0, data, 64, &addr, NULL);
 
     aeron_publication_image_schedule_status_message(image, 1, TERM_BUFFER_SIZE);
     aeron_publication_image_send_pending_status_message(image, 2000000000);
@@ -177,6 +178,115 @@ TEST_F(PublicationImageTest, shouldSendControlMessagesToAllDestinations)
     ASSERT_EQ(2, bindings_state_dest1->rttm_count);
 }
 
+TEST_F(PublicationImageTest, shouldRecoverLostDatagramFromFecParity)
+{
+    struct sockaddr_storage addr = {}; // Don't really care what value this is.
+    const char *uri = "aeron:udp?endpoint=localhost:9090";
+    aeron_receive_channel_endpoint_t *endpoint = createMdsEndpoint();
+    int32_t stream_id = 1001;
+    int32_t session_id = 1000001;
+    int32_t message_length = 128;
+    uint8_t data[3 * 128] = {};
+
+    aeron_udp_channel_t *channel;
+    aeron_receive_destination_t *dest;
+
+    aeron_udp_channel_parse(strlen(uri), uri, &m_resolver, &channel, false);
+
+    ASSERT_LE(0, aeron_receive_destination_create(
+        &dest, channel, channel, m_context, m_context->receiver_proxy, &m_counters_manager, 0, endpoint->channel_status.counter_id));
+    ASSERT_EQ(1, aeron_receive_channel_endpoint_add_destination(endpoint, dest));
+
+    aeron_publication_image_t *image = createImage(endpoint, dest, stream_id, session_id);
+
+    aeron_fec_encoder_t encoder;
+    ASSERT_EQ(0, aeron_fec_encoder_init(&encoder, 3, MTU, session_id, stream_id));
+
+    for (int32_t i = 0; i < 3; i++)
+    {
+        uint8_t *datagram = data + (i * message_length);
+        auto *message = reinterpret_cast<aeron_data_header_t *>(datagram);
+        message->frame_header.frame_length = message_length;
+        message->frame_header.version = AERON_FRAME_HEADER_VERSION;
+        message->frame_header.type = AERON_HDR_TYPE_DATA;
+        message->stream_id = stream_id;
+        message->session_id = session_id;
+        message->term_id = 0;
+        message->term_offset = i * message_length;
+        memset(datagram + AERON_DATA_HEADER_LENGTH, 'a' + i, message_length - AERON_DATA_HEADER_LENGTH);
+
+        ASSERT_FALSE(aeron_fec_encoder_add(&encoder, 0, i * message_length, datagram, message_length));
+    }
+
+    const size_t fec_length = aeron_fec_encoder_flush(&encoder);
+    auto *fec_header = reinterpret_cast<aeron_fec_header_t *>(encoder.frame);
+
+    aeron_publication_image_insert_packet(image, dest, 0, 0, data, message_length, &addr, NULL);
+    aeron_publication_image_insert_packet(
+        image, dest, 0, 2 * message_length, data + (2 * message_length), message_length, &addr, NULL);
+
+    EXPECT_EQ(message_length, aeron_publication_image_on_fec(image, dest, fec_header, fec_length, &addr));
+    EXPECT_EQ(1, aeron_counter_get(image->fec_recovered_datagrams_counter));
+    EXPECT_EQ(0, memcmp(image->mapped_raw_log.term_buffers[0].addr, data, sizeof(data)));
+
+    EXPECT_EQ(0, aeron_publication_image_on_fec(image, dest, fec_header, fec_length, &addr));
+    EXPECT_EQ(1, aeron_counter_get(image->fec_recovered_datagrams_counter));
+
+    aeron_fec_encoder_close(&encoder);
+}
+
+TEST_F(PublicationImageTest, shouldOnlyWriteHeaderOfZeroCopyFrameOnceAccepted)
+{
+    struct sockaddr_storage addr = {}; // Don't really care what value this is.
+    const char *uri = "aeron:udp?endpoint=localhost:9090";
+    aeron_receive_channel_endpoint_t *endpoint = createMdsEndpoint();
+    int32_t stream_id = 1001;
+    int32_t session_id = 1000001;
+    int32_t message_length = 128;
+    uint8_t data[128] = {};
+
+    aeron_udp_channel_t *channel;
+    aeron_receive_destination_t *dest;
+
+    aeron_udp_channel_parse(strlen(uri), uri, &m_resolver, &channel, false);
+
+    ASSERT_LE(0, aeron_receive_destination_create(
+        &dest, channel, channel, m_context, m_context->receiver_proxy, &m_counters_manager, 0, endpoint->channel_status.counter_id));
+    ASSERT_EQ(1, aeron_receive_channel_endpoint_add_destination(endpoint, dest));
+
+    aeron_publication_image_t *image = createImage(endpoint, dest, stream_id, session_id);
+    uint8_t *term_buffer = image->mapped_raw_log.term_buffers[0].addr;
+    const int32_t overrun_offset = (int32_t)((image->term_length_mask + 1) / 2);
+
+    auto *message = reinterpret_cast<aeron_data_header_t *>(data);
+    message->frame_header.frame_length = message_length;
+    message->frame_header.version = AERON_FRAME_HEADER_VERSION;
+    message->frame_header.type = AERON_HDR_TYPE_DATA;
+    message->stream_id = stream_id;
+    message->session_id = session_id;
+    message->term_id = 0;
+    message->term_offset = overrun_offset;
+    memset(data + AERON_DATA_HEADER_LENGTH, 'x', message_length - AERON_DATA_HEADER_LENGTH);
+    memset(term_buffer + overrun_offset + AERON_DATA_HEADER_LENGTH, 'z', message_length - AERON_DATA_HEADER_LENGTH);
+
+    image->zero_copy_frame = term_buffer + overrun_offset;
+    aeron_publication_image_insert_packet(image, dest, 0, overrun_offset, data, message_length, &addr, NULL);
+    EXPECT_EQ(0, reinterpret_cast<aeron_frame_header_t *>(term_buffer + overrun_offset)->frame_length);
+
+    message->term_offset = 0;
+    memset(term_buffer + AERON_DATA_HEADER_LENGTH, 'z', message_length - AERON_DATA_HEADER_LENGTH);
+
+    image->zero_copy_frame = term_buffer;
+    aeron_publication_image_insert_packet(image, dest, 0, 0, data, message_length, &addr, NULL);
+    image->zero_copy_frame = nullptr;
+
+    EXPECT_EQ(0, memcmp(term_buffer, data, AERON_DATA_HEADER_LENGTH));
+    for (int32_t i = AERON_DATA_HEADER_LENGTH; i < message_length; i++)
+    {
+        ASSERT_EQ('z', term_buffer[i]) << i;
+    }
+}
+
 TEST_F(PublicationImageTest, shouldHandleEosAcrossDestinations)
 {
     struct sockaddr_storage addr = {}; // Don't really care what value this is.
@@ -200,13 +310,13 @@ TEST_F(PublicationImageTest, shouldHandleEosAcrossDestinations)
     aeron_udp_channel_parse(strlen(uri_2), uri_2, &m_resolver, &channel_2, false);
 
     ASSERT_LE(0, aeron_receive_destination_create(
-        &dest_1, channel_1, channel_1, m_context, &m_counters_manager, registration_id, endpoint->channel_status.counter_id));
+        &dest_1, channel_1, channel_1, m_context, m_context->receiver_proxy, &m_counters_manager, registration_id, endpoint->channel_status.counter_id));
     ASSERT_EQ(1, aeron_receive_channel_endpoint_add_destination(endpoint, dest_1));
 
     aeron_publication_image_t *image = createImage(endpoint, dest_1, stream_id, session_id);
 
     ASSERT_LE(0, aeron_receive_destination_create(
-        &dest_2, channel_2, channel_2, m_context, &m_counters_manager, registration_id, endpoint->channel_status.counter_id));
+        &dest_2, channel_2, channel_2, m_context, m_context->receiver_proxy, &m_counters_manager, registration_id, endpoint->channel_status.counter_id));
     ASSERT_EQ(2, aeron_receive_channel_endpoint_add_destination(endpoint, dest_2));
 
     ASSERT_EQ(2, aeron_publication_image_add_destination(image, dest_2));
@@ -225,12 +335,12 @@ TEST_F(PublicationImageTest, shouldHandleEosAcrossDestinations)
     AERON_GET_VOLATILE(is_eos, image->is_end_of_stream);
     ASSERT_EQ(false, is_eos);
 
-    aeron_publication_image_insert_packet(image, dest_2, 0, 0, data, AERON_DATA_HEADER_LENGTH, &addr);
+    aeron_publication_image_insert_packet(image, dest_2, 0, 0, data, AERON_DATA_HEADER_LENGTH, &addr, NULL);
 
     AERON_GET_VOLATILE(is_eos, image->is_end_of_stream);
     ASSERT_EQ(false, is_eos);
 
-    aeron_publication_image_insert_packet(image, dest_1, 0, 0, data, AERON_DATA_HEADER_LENGTH, &addr);
+    aeron_publication_image_insert_packet(image, dest_1, 0, 0, data, AERON_DATA_HEADER_LENGTH, &addr, NULL);
 
     AERON_GET_VOLATILE(is_eos, image->is_end_of_stream);
     ASSERT_EQ(true, is_eos);
@@ -262,13 +372,13 @@ TEST_F(PublicationImageTest, shouldNotSendControlMessagesToAllDestinationThatHav
     aeron_clock_update_cached_nano_time(m_context->receiver_cached_clock, t0_ns);
 
     ASSERT_LE(0, aeron_receive_destination_create(
-        &dest_1, channel_1, channel_1, m_context, &m_counters_manager, registration_id, endpoint->channel_status.counter_id));
+        &dest_1, channel_1, channel_1, m_context, m_context->receiver_proxy, &m_counters_manager, registration_id, endpoint->channel_status.counter_id));
     ASSERT_EQ(1, aeron_receive_channel_endpoint_add_destination(endpoint, dest_1));
 
     aeron_publication_image_t *image = createImage(endpoint, dest_1, stream_id, session_id);
 
     ASSERT_LE(0, aeron_receive_destination_create(
-        &dest_2, channel_2, channel_2, m_context, &m_counters_manager, registration_id, endpoint->channel_status.counter_id));
+        &dest_2, channel_2, channel_2, m_context, m_context->receiver_proxy, &m_counters_manager, registration_id, endpoint->channel_status.counter_id));
     ASSERT_EQ(2, aeron_receive_channel_endpoint_add_destination(endpoint, dest_2));
 
     ASSERT_EQ(2, aeron_publication_image_add_destination(image, dest_2));
@@ -286,15 +396,15 @@ TEST_F(PublicationImageTest, shouldNotSendControlMessagesToAllDestinationThatHav
     message->term_id = 0;
     message->term_offset = 0;
 
-    aeron_publication_image_insert_packet(image, dest_1, 0, 0, data, message_length, &addr);
-    aeron_publication_image_insert_packet(image, dest_2, 0, 0, data, message_length, &addr);
+    aeron_publication_image_insert_packet(image, dest_1, 0, 0, data, message_length, &addr, NULL);
+    aeron_publication_image_insert_packet(image, dest_2, 0, 0, data, message_length, &addr, NULL);
 
     aeron_clock_update_cached_nano_time(m_context->receiver_cached_clock, t1_ns);
 
     auto next_offset = (int32_t)message_length;
     message->term_offset = next_offset;
 
-    aeron_publication_image_insert_packet(image, dest_2, 0, next_offset, data, message_length, &addr);
+    aeron_publication_image_insert_packet(image, dest_2, 0, next_offset, data, message_length, &addr, NULL);
 
     aeron_publication_image_schedule_status_message(image, 1, TERM_BUFFER_SIZE);
     aeron_publication_image_send_pending_status_message(image, t1_ns);
@@ -333,13 +443,13 @@ TEST_F(PublicationImageTest, shouldTrackActiveTransportAccountBasedOnFrames)
     aeron_clock_update_cached_nano_time(m_context->receiver_cached_clock, t0_ns);
 
     ASSERT_LE(0, aeron_receive_destination_create(
-        &dest_1, channel_1, channel_1, m_context, &m_counters_manager, registration_id, endpoint->channel_status.counter_id));
+        &dest_1, channel_1, channel_1, m_context, m_context->receiver_proxy, &m_counters_manager, registration_id, endpoint->channel_status.counter_id));
     ASSERT_EQ(1, aeron_receive_channel_endpoint_add_destination(endpoint, dest_1));
 
     aeron_publication_image_t *image = createImage(endpoint, dest_1, stream_id, session_id);
 
     ASSERT_LE(0, aeron_receive_destination_create(
-        &dest_2, channel_2, channel_2, m_context, &m_counters_manager, registration_id, endpoint->channel_status.counter_id));
+        &dest_2, channel_2, channel_2, m_context, m_context->receiver_proxy, &m_counters_manager, registration_id, endpoint->channel_status.counter_id));
     ASSERT_EQ(2, aeron_receive_channel_endpoint_add_destination(endpoint, dest_2));
 
     ASSERT_EQ(2, aeron_publication_image_add_destination(image, dest_2));
@@ -361,13 +471,13 @@ TEST_F(PublicationImageTest, shouldTrackActiveTransportAccountBasedOnFrames)
     message->term_id = 0;
     message->term_offset = 0;
 
-    aeron_publication_image_insert_packet(image, dest_2, 0, 0, data, 64, &addr);
+    aeron_publication_image_insert_packet(image, dest_2, 0, 0, data, 64, &addr, NULL);
     aeron_publication_image_schedule_status_message(image, 0, TERM_BUFFER_SIZE);
     aeron_publication_image_send_pending_status_message(image, t0_ns);
 
     ASSERT_EQ(1, image->log_meta_data->active_transport_count);
 
-    aeron_publication_image_insert_packet(image, dest_1, 0, 0, data, 64, &addr);
+    aeron_publication_image_insert_packet(image, dest_1, 0, 0, data, 64, &addr, NULL);
     aeron_publication_image_schedule_status_message(image, 0, TERM_BUFFER_SIZE);
     aeron_publication_image_send_pending_status_message(image, t0_ns);
 
@@ -405,6 +515,7 @@ TEST_F(PublicationImageTest, shouldTrackUnderRunningTransportsWithLastSmAndRecei
         channel_1,
         channel_1,
         m_context,
+        m_context->receiver_proxy,
         &m_counters_manager,
         registration_id,
         endpoint->channel_status.counter_id));
@@ -417,6 +528,7 @@ TEST_F(PublicationImageTest, shouldTrackUnderRunningTransportsWithLastSmAndRecei
         channel_2,
         channel_2,
         m_context,
+        m_context->receiver_proxy,
         &m_counters_manager,
         registration_id,
         endpoint->channel_status.counter_id));
@@ -442,14 +554,14 @@ TEST_F(PublicationImageTest, shouldTrackUnderRunningTransportsWithLastSmAndRecei
     message->term_id = 0;
     message->term_offset = 0;
 
-    aeron_publication_image_insert_packet(image, dest_2, 0, 0, data, message_length, &addr);
+    aeron_publication_image_insert_packet(image, dest_2, 0, 0, data, message_length, &addr, NULL);
 
     aeron_publication_image_schedule_status_message(image, message_length, TERM_BUFFER_SIZE);
     aeron_publication_image_send_pending_status_message(image, t1_ns);
 
     ASSERT_EQ(1, bindings_state_dest1->sm_count);
 
-    aeron_publication_image_insert_packet(image, dest_1, 0, 0, data, message_length, &addr);
+    aeron_publication_image_insert_packet(image, dest_1, 0, 0, data, message_length, &addr, NULL);
 
     aeron_publication_image_schedule_status_message(image, message_length, TERM_BUFFER_SIZE);
     aeron_publication_image_send_pending_status_message(image, t1_ns);
@@ -476,6 +588,7 @@ TEST_F(PublicationImageTest, shouldReturnStorageSpaceErrorIfNotEnoughStorageSpac
         channel,
         channel,
         m_context,
+        m_context->receiver_proxy,
         &m_counters_manager,
         registration_id,
         endpoint->channel_status.counter_id));
@@ -513,6 +626,7 @@ TEST_F(PublicationImageTest, shouldLogWarningIfStorageSpaceIsLow)
         channel,
         channel,
         m_context,
+        m_context->receiver_proxy,
         &m_counters_manager,
         registration_id,
         endpoint->channel_status.counter_id));
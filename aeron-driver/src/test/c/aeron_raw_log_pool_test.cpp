@@ -0,0 +1,203 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#if defined(_MSC_VER)
+#define S_IRWXU 0
+#define S_IRWXG 0
+#define S_IRWXO 0
+#else
+#include <sys/stat.h>
+#endif
+
+extern "C"
+{
+#include "aeron_raw_log_pool.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+#include "util/aeron_error.h"
+}
+
+#define TERM_LENGTH (AERON_LOGBUFFER_TERM_MIN_LENGTH)
+#define IPC_TERM_LENGTH (AERON_LOGBUFFER_TERM_MIN_LENGTH * 2)
+#define PAGE_SIZE (4 * 1024)
+#define POOL_SIZE (2)
+
+static int fallback_map_count = 0;
+
+static int fallback_raw_log_map(
+    aeron_mapped_raw_log_t *mapped_raw_log,
+    const char *path,
+    bool use_sparse_files,
+    uint64_t term_length,
+    uint64_t page_size)
+{
+    fallback_map_count++;
+    return aeron_raw_log_map(mapped_raw_log, path, use_sparse_files, term_length, page_size);
+}
+
+class RawLogPoolTest : public testing::Test
+{
+public:
+    RawLogPoolTest()
+    {
+        char dir[AERON_MAX_PATH] = { 0 };
+        aeron_temp_filename(dir, sizeof(dir) - 1);
+        m_dir = dir;
+        fallback_map_count = 0;
+    }
+
+protected:
+    void SetUp() override
+    {
+        ASSERT_EQ(0, aeron_mkdir(m_dir.c_str(), S_IRWXU | S_IRWXG | S_IRWXO));
+        ASSERT_EQ(0, aeron_executor_init(&m_executor, false, nullptr, nullptr));
+
+        const uint64_t term_lengths[] = { TERM_LENGTH, IPC_TERM_LENGTH };
+        ASSERT_EQ(0, aeron_raw_log_pool_init(
+            &m_pool, m_dir.c_str(), POOL_SIZE, term_lengths, 2, PAGE_SIZE, &m_executor, on_error, this))
+            << aeron_errmsg();
+    }
+
+    void TearDown() override
+    {
+        aeron_raw_log_pool_close(&m_pool);
+        aeron_executor_close(&m_executor);
+        aeron_delete_directory(m_dir.c_str());
+    }
+
+    static void on_error(void *clientd, int errcode, const char *description)
+    {
+        static_cast<RawLogPoolTest *>(clientd)->m_error_count++;
+    }
+
+    void fill()
+    {
+        while (aeron_raw_log_pool_do_work(&m_pool) > 0)
+        {
+        }
+    }
+
+    std::string logPath(const char *name)
+    {
+        char path[AERON_MAX_PATH];
+        aeron_file_resolve(m_dir.c_str(), name, path, sizeof(path));
+        return path;
+    }
+
+    std::string m_dir;
+    aeron_executor_t m_executor = {};
+    aeron_raw_log_pool_t m_pool = {};
+    int m_error_count = 0;
+};
+
+TEST_F(RawLogPoolTest, shouldFillPoolForEachTermLength)
+{
+    fill();
+
+    EXPECT_EQ(POOL_SIZE, aeron_raw_log_pool_available(&m_pool, TERM_LENGTH));
+    EXPECT_EQ(POOL_SIZE, aeron_raw_log_pool_available(&m_pool, IPC_TERM_LENGTH));
+    EXPECT_EQ(0, aeron_raw_log_pool_do_work(&m_pool));
+    EXPECT_EQ(0, m_error_count);
+}
+
+TEST_F(RawLogPoolTest, shouldLeaseLogOfMatchingTermLengthAndRefill)
+{
+    fill();
+
+    aeron_mapped_raw_log_t mapped_raw_log = {};
+    const std::string path = logPath("1.logbuffer");
+    ASSERT_EQ(0, aeron_raw_log_pool_map(
+        &m_pool, fallback_raw_log_map, &mapped_raw_log, path.c_str(), false, IPC_TERM_LENGTH, PAGE_SIZE));
+
+    EXPECT_EQ(0, fallback_map_count);
+    EXPECT_EQ((size_t)IPC_TERM_LENGTH, mapped_raw_log.term_length);
+    EXPECT_EQ(
+        (int64_t)aeron_logbuffer_compute_log_length(IPC_TERM_LENGTH, PAGE_SIZE), aeron_file_length(path.c_str()));
+    EXPECT_EQ(POOL_SIZE - 1, aeron_raw_log_pool_available(&m_pool, IPC_TERM_LENGTH));
+    EXPECT_EQ(POOL_SIZE, aeron_raw_log_pool_available(&m_pool, TERM_LENGTH));
+
+    auto *metadata = (aeron_logbuffer_metadata_t *)mapped_raw_log.log_meta_data.addr;
+    metadata->initial_term_id = 7;
+    EXPECT_EQ(7, metadata->initial_term_id);
+
+    EXPECT_EQ(1, aeron_raw_log_pool_do_work(&m_pool));
+    EXPECT_EQ(POOL_SIZE, aeron_raw_log_pool_available(&m_pool, IPC_TERM_LENGTH));
+
+    EXPECT_TRUE(aeron_raw_log_free(&mapped_raw_log, path.c_str()));
+    EXPECT_EQ(-1, aeron_file_length(path.c_str()));
+}
+
+TEST_F(RawLogPoolTest, shouldFallBackWhenNoMatchingLogIsAvailable)
+{
+    fill();
+
+    const std::string sparse_path = logPath("1.logbuffer");
+    const std::string other_term_length_path = logPath("2.logbuffer");
+    const std::string other_page_size_path = logPath("3.logbuffer");
+    aeron_mapped_raw_log_t sparse = {};
+    aeron_mapped_raw_log_t other_term_length = {};
+    aeron_mapped_raw_log_t other_page_size = {};
+
+    ASSERT_EQ(0, aeron_raw_log_pool_map(
+        &m_pool, fallback_raw_log_map, &sparse, sparse_path.c_str(), true, TERM_LENGTH, PAGE_SIZE));
+    ASSERT_EQ(0, aeron_raw_log_pool_map(
+        &m_pool, fallback_raw_log_map, &other_term_length, other_term_length_path.c_str(), false, TERM_LENGTH * 4,
+        PAGE_SIZE));
+    ASSERT_EQ(0, aeron_raw_log_pool_map(
+        &m_pool, fallback_raw_log_map, &other_page_size, other_page_size_path.c_str(), false, TERM_LENGTH,
+        PAGE_SIZE * 2));
+
+    EXPECT_EQ(3, fallback_map_count);
+    EXPECT_EQ(POOL_SIZE, aeron_raw_log_pool_available(&m_pool, TERM_LENGTH));
+
+    aeron_raw_log_free(&sparse, sparse_path.c_str());
+    aeron_raw_log_free(&other_term_length, other_term_length_path.c_str());
+    aeron_raw_log_free(&other_page_size, other_page_size_path.c_str());
+}
+
+TEST_F(RawLogPoolTest, shouldFallBackWhenPoolIsEmpty)
+{
+    const std::string empty_pool_path = logPath("1.logbuffer");
+    const std::string no_pool_path = logPath("2.logbuffer");
+    aeron_mapped_raw_log_t empty_pool = {};
+    aeron_mapped_raw_log_t no_pool = {};
+
+    ASSERT_EQ(0, aeron_raw_log_pool_map(
+        &m_pool, fallback_raw_log_map, &empty_pool, empty_pool_path.c_str(), false, TERM_LENGTH, PAGE_SIZE));
+    EXPECT_EQ(1, fallback_map_count);
+
+    ASSERT_EQ(0, aeron_raw_log_pool_map(
+        nullptr, fallback_raw_log_map, &no_pool, no_pool_path.c_str(), false, TERM_LENGTH, PAGE_SIZE));
+    EXPECT_EQ(2, fallback_map_count);
+
+    aeron_raw_log_free(&empty_pool, empty_pool_path.c_str());
+    aeron_raw_log_free(&no_pool, no_pool_path.c_str());
+}
+
+TEST_F(RawLogPoolTest, shouldRemovePooledLogsOnClose)
+{
+    fill();
+
+    std::string pool_dir = m_pool.dir;
+    EXPECT_TRUE(aeron_is_directory(pool_dir.c_str()));
+
+    aeron_raw_log_pool_close(&m_pool);
+
+    EXPECT_FALSE(aeron_is_directory(pool_dir.c_str()));
+}
@@ -98,7 +98,7 @@ protected:
 
         aeron_distinct_error_log_init(
             &m_error_log, m_error_log_buffer.data(), m_error_log_buffer.size(), aeron_epoch_clock);
-        aeron_driver_receiver_init(&m_receiver, m_context, &m_system_counters, &m_error_log);
+        aeron_driver_receiver_init(&m_receiver, m_context, &m_system_counters, &m_error_log, 0);
 
         m_receiver_proxy.receiver = &m_receiver;
         m_context->receiver_proxy = &m_receiver_proxy;
@@ -144,7 +144,14 @@ protected:
         if (AERON_UDP_CHANNEL_CONTROL_MODE_MANUAL != channel->control_mode)
         {
             if (0 != aeron_receive_destination_create(
-                &destination, channel, channel, m_context, &m_counters_manager, 0, status_indicator.counter_id))
+                &destination,
+                channel,
+                channel,
+                m_context,
+                m_context->receiver_proxy,
+                &m_counters_manager,
+                0,
+                status_indicator.counter_id))
             {
                 return nullptr;
             }
@@ -152,7 +159,7 @@ protected:
 
         aeron_receive_channel_endpoint_t *endpoint = nullptr;
         if (0 != aeron_receive_channel_endpoint_create(
-            &endpoint, channel, destination, &status_indicator, &m_system_counters, m_context))
+            &endpoint, channel, destination, &status_indicator, &m_system_counters, m_context, m_context->receiver_proxy))
         {
             return nullptr;
         }
@@ -226,7 +233,7 @@ protected:
             &image, endpoint, destination, m_context, correlation_id, session_id, stream_id, 0, 0, 0,
             &hwm_position, &pos_position, congestion_control_strategy,
             &channel->remote_control, &channel->local_data,
-            TERM_BUFFER_SIZE, MTU, UINT8_C(0), nullptr, true, true, false, &m_system_counters) < 0)
+            TERM_BUFFER_SIZE, MTU, UINT8_C(0), nullptr, true, true, false, false, &m_system_counters) < 0)
         {
             congestion_control_strategy->fini(congestion_control_strategy);
             return nullptr;
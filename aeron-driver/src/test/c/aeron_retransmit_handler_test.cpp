@@ -16,6 +16,7 @@
 
 #include <array>
 #include <functional>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -40,6 +41,9 @@ extern "C"
 
 #define MTU_LENGTH (1234) // this value is ignored
 
+#define RECEIVER_KEY (1)
+#define OTHER_RECEIVER_KEY (2)
+
 class RetransmitHandlerTest : public testing::Test
 {
 public:
@@ -75,9 +79,23 @@ public:
             AERON_MAX_FLOW_CONTROL_RETRANSMIT_RECEIVER_WINDOW_MULTIPLE);
     }
 
+    static size_t capped_retransmission_length(
+        void *state,
+        size_t term_offset,
+        size_t resend_length,
+        size_t term_buffer_length,
+        size_t mtu_length)
+    {
+        const size_t max_length = ALIGNED_FRAME_LENGTH + (ALIGNED_FRAME_LENGTH / 2);
+
+        return resend_length < max_length ? resend_length : max_length;
+    }
+
 protected:
     int64_t m_time = 0;
     int64_t m_invalid_packet_counter = 0;
+    int64_t m_naks_coalesced_counter = 0;
+    int64_t m_naks_suppressed_counter = 0;
     aeron_retransmit_handler_t m_handler = {};
     aeron_flow_control_strategy_t m_flow_control = {};
     std::function<int(int32_t, int32_t, size_t)> m_resend;
@@ -85,7 +103,7 @@ protected:
 
 TEST_F(RetransmitHandlerTest, shouldImmediateRetransmitOnNak)
 {
-    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, 0, LINGER_TIMEOUT_20MS), 0);
+    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, &m_naks_coalesced_counter, &m_naks_suppressed_counter, 0, LINGER_TIMEOUT_20MS), 0);
 
     const int32_t nak_offset = (ALIGNED_FRAME_LENGTH * 2);
     const size_t nak_length = ALIGNED_FRAME_LENGTH;
@@ -102,13 +120,13 @@ TEST_F(RetransmitHandlerTest, shouldImmediateRetransmitOnNak)
         };
 
     EXPECT_EQ(aeron_retransmit_handler_on_nak(
-        &m_handler, TERM_ID, nak_offset, nak_length, TERM_LENGTH, MTU_LENGTH, &m_flow_control, m_time, RetransmitHandlerTest::on_resend, this), 0);
+        &m_handler, TERM_ID, nak_offset, nak_length, TERM_LENGTH, MTU_LENGTH, &m_flow_control, RECEIVER_KEY, m_time, RetransmitHandlerTest::on_resend, this), 0);
     EXPECT_EQ(called, 1u);
 }
 
 TEST_F(RetransmitHandlerTest, shouldNotRetransmitOnNakWhileInLinger)
 {
-    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, 0, LINGER_TIMEOUT_20MS), 0);
+    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, &m_naks_coalesced_counter, &m_naks_suppressed_counter, 0, LINGER_TIMEOUT_20MS), 0);
 
     const int32_t nak_offset = (ALIGNED_FRAME_LENGTH * 2);
     const size_t nak_length = ALIGNED_FRAME_LENGTH;
@@ -125,19 +143,19 @@ TEST_F(RetransmitHandlerTest, shouldNotRetransmitOnNakWhileInLinger)
         };
 
     EXPECT_EQ(aeron_retransmit_handler_on_nak(
-        &m_handler, TERM_ID, nak_offset, nak_length, TERM_LENGTH, MTU_LENGTH, &m_flow_control, m_time, RetransmitHandlerTest::on_resend, this), 0);
+        &m_handler, TERM_ID, nak_offset, nak_length, TERM_LENGTH, MTU_LENGTH, &m_flow_control, RECEIVER_KEY, m_time, RetransmitHandlerTest::on_resend, this), 0);
     EXPECT_EQ(called, 1u);
 
     m_time = 10 * 1000 * 1000L;
     EXPECT_EQ(aeron_retransmit_handler_process_timeouts(&m_handler, m_time, RetransmitHandlerTest::on_resend, this), 0);
     EXPECT_EQ(aeron_retransmit_handler_on_nak(
-        &m_handler, TERM_ID, nak_offset, nak_length, TERM_LENGTH, MTU_LENGTH, &m_flow_control, m_time, RetransmitHandlerTest::on_resend, this), 0);
+        &m_handler, TERM_ID, nak_offset, nak_length, TERM_LENGTH, MTU_LENGTH, &m_flow_control, RECEIVER_KEY, m_time, RetransmitHandlerTest::on_resend, this), 0);
     EXPECT_EQ(called, 1u);
 }
 
 TEST_F(RetransmitHandlerTest, shouldRetransmitOnNakAfterLinger)
 {
-    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, 0, LINGER_TIMEOUT_20MS), 0);
+    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, &m_naks_coalesced_counter, &m_naks_suppressed_counter, 0, LINGER_TIMEOUT_20MS), 0);
 
     const int32_t nak_offset = (ALIGNED_FRAME_LENGTH * 2);
     const size_t nak_length = ALIGNED_FRAME_LENGTH;
@@ -154,19 +172,19 @@ TEST_F(RetransmitHandlerTest, shouldRetransmitOnNakAfterLinger)
         };
 
     EXPECT_EQ(aeron_retransmit_handler_on_nak(
-        &m_handler, TERM_ID, nak_offset, nak_length, TERM_LENGTH, MTU_LENGTH, &m_flow_control, m_time, RetransmitHandlerTest::on_resend, this), 0);
+        &m_handler, TERM_ID, nak_offset, nak_length, TERM_LENGTH, MTU_LENGTH, &m_flow_control, RECEIVER_KEY, m_time, RetransmitHandlerTest::on_resend, this), 0);
     EXPECT_EQ(called, 1u);
 
     m_time = 30 * 1000 * 1000L;
     EXPECT_EQ(aeron_retransmit_handler_process_timeouts(&m_handler, m_time, RetransmitHandlerTest::on_resend, this), 1);
     EXPECT_EQ(aeron_retransmit_handler_on_nak(
-        &m_handler, TERM_ID, nak_offset, nak_length, TERM_LENGTH, MTU_LENGTH, &m_flow_control, m_time, RetransmitHandlerTest::on_resend, this), 0);
+        &m_handler, TERM_ID, nak_offset, nak_length, TERM_LENGTH, MTU_LENGTH, &m_flow_control, RECEIVER_KEY, m_time, RetransmitHandlerTest::on_resend, this), 0);
     EXPECT_EQ(called, 2u);
 }
 
 TEST_F(RetransmitHandlerTest, shouldRetransmitOnMultipleNaks)
 {
-    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, 0, LINGER_TIMEOUT_20MS), 0);
+    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, &m_naks_coalesced_counter, &m_naks_suppressed_counter, 0, LINGER_TIMEOUT_20MS), 0);
 
     const int32_t nak_offset_1 = (ALIGNED_FRAME_LENGTH * 2);
     const size_t nak_length_1 = ALIGNED_FRAME_LENGTH;
@@ -194,38 +212,193 @@ TEST_F(RetransmitHandlerTest, shouldRetransmitOnMultipleNaks)
         };
 
     EXPECT_EQ(aeron_retransmit_handler_on_nak(
-        &m_handler, TERM_ID, nak_offset_1, nak_length_1, TERM_LENGTH, MTU_LENGTH, &m_flow_control, m_time, RetransmitHandlerTest::on_resend, this), 0);
+        &m_handler, TERM_ID, nak_offset_1, nak_length_1, TERM_LENGTH, MTU_LENGTH, &m_flow_control, RECEIVER_KEY, m_time, RetransmitHandlerTest::on_resend, this), 0);
     EXPECT_EQ(called, 1u);
     EXPECT_EQ(aeron_retransmit_handler_on_nak(
-        &m_handler, TERM_ID, nak_offset_2, nak_length_2, TERM_LENGTH, MTU_LENGTH, &m_flow_control, m_time, RetransmitHandlerTest::on_resend, this), 0);
+        &m_handler, TERM_ID, nak_offset_2, nak_length_2, TERM_LENGTH, MTU_LENGTH, &m_flow_control, RECEIVER_KEY, m_time, RetransmitHandlerTest::on_resend, this), 0);
     EXPECT_EQ(called, 2u);
 }
 
 TEST_F(RetransmitHandlerTest, errorOnRetransmitOverflow)
 {
-    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, DELAY_TIMEOUT_20MS, LINGER_TIMEOUT_20MS), 0);
+    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, &m_naks_coalesced_counter, &m_naks_suppressed_counter, DELAY_TIMEOUT_20MS, LINGER_TIMEOUT_20MS), 0);
 
     EXPECT_EQ(m_handler.active_retransmit_count, 0);
 
+    // NAKs are kept apart so they cannot be merged
     int32_t i = 0;
     for (i = 0; i < AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS; i++)
     {
         EXPECT_EQ(aeron_retransmit_handler_on_nak(
-            &m_handler, TERM_ID, i, 1, TERM_LENGTH, MTU_LENGTH, &m_flow_control, m_time, RetransmitHandlerTest::on_resend, this), 0);
+            &m_handler, TERM_ID, i * 2, 1, TERM_LENGTH, MTU_LENGTH, &m_flow_control, RECEIVER_KEY, m_time, RetransmitHandlerTest::on_resend, this), 0);
     }
 
     EXPECT_EQ(m_handler.active_retransmit_count, AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS);
 
     // there should be no more available retransmit actions
     EXPECT_EQ(aeron_retransmit_handler_on_nak(
-        &m_handler, TERM_ID, i, 1, TERM_LENGTH, MTU_LENGTH, &m_flow_control, m_time, RetransmitHandlerTest::on_resend, this), -1);
+        &m_handler, TERM_ID, i * 2, 1, TERM_LENGTH, MTU_LENGTH, &m_flow_control, RECEIVER_KEY, m_time, RetransmitHandlerTest::on_resend, this), -1);
 
     // these will all be duplicates of previous NAKs
     for (i = 0; i < AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS; i++)
     {
         EXPECT_EQ(aeron_retransmit_handler_on_nak(
-            &m_handler, TERM_ID, i, 1, TERM_LENGTH, MTU_LENGTH, &m_flow_control, m_time, RetransmitHandlerTest::on_resend, this), 0);
+            &m_handler, TERM_ID, i * 2, 1, TERM_LENGTH, MTU_LENGTH, &m_flow_control, RECEIVER_KEY, m_time, RetransmitHandlerTest::on_resend, this), 0);
     }
 
     EXPECT_EQ(m_handler.active_retransmit_count, AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS);
+    EXPECT_EQ(m_handler.retransmit_actions_capacity, (size_t)AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS);
+    EXPECT_EQ(m_naks_suppressed_counter, AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS);
+}
+
+TEST_F(RetransmitHandlerTest, shouldCoalesceAdjacentNaksWhileDelayed)
+{
+    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, &m_naks_coalesced_counter, &m_naks_suppressed_counter, DELAY_TIMEOUT_20MS, LINGER_TIMEOUT_20MS), 0);
+
+    const int32_t nak_offset = (ALIGNED_FRAME_LENGTH * 2);
+    const size_t nak_length = ALIGNED_FRAME_LENGTH;
+
+    size_t called = 0;
+    m_resend =
+        [&](int32_t term_id, int32_t term_offset, size_t length)
+        {
+            EXPECT_EQ(term_id, TERM_ID);
+            EXPECT_EQ(term_offset, nak_offset - (int32_t)nak_length);
+            EXPECT_EQ(length, nak_length * 3);
+            called++;
+            return 0;
+        };
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, nak_offset, nak_length, TERM_LENGTH, MTU_LENGTH, &m_flow_control, RECEIVER_KEY, m_time, RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, nak_offset + (int32_t)nak_length, nak_length, TERM_LENGTH, MTU_LENGTH, &m_flow_control, OTHER_RECEIVER_KEY, m_time, RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, nak_offset - (int32_t)nak_length, nak_length, TERM_LENGTH, MTU_LENGTH, &m_flow_control, OTHER_RECEIVER_KEY, m_time, RetransmitHandlerTest::on_resend, this), 0);
+
+    EXPECT_EQ(m_handler.active_retransmit_count, 1);
+    EXPECT_EQ(m_naks_coalesced_counter, 2);
+
+    m_time = 30 * 1000 * 1000L;
+    EXPECT_EQ(aeron_retransmit_handler_process_timeouts(&m_handler, m_time, RetransmitHandlerTest::on_resend, this), 1);
+    EXPECT_EQ(called, 1u);
+}
+
+TEST_F(RetransmitHandlerTest, shouldOnlyRetransmitRemainderOfPartiallyLingeringNak)
+{
+    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, &m_naks_coalesced_counter, &m_naks_suppressed_counter, 0, LINGER_TIMEOUT_20MS), 0);
+
+    const int32_t nak_offset = (ALIGNED_FRAME_LENGTH * 2);
+    const size_t nak_length = ALIGNED_FRAME_LENGTH * 2;
+
+    std::vector<std::pair<int32_t, size_t>> resends;
+    m_resend =
+        [&](int32_t term_id, int32_t term_offset, size_t length)
+        {
+            resends.emplace_back(term_offset, length);
+            return 0;
+        };
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, nak_offset, nak_length, TERM_LENGTH, MTU_LENGTH, &m_flow_control, RECEIVER_KEY, m_time, RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, nak_offset + ALIGNED_FRAME_LENGTH, nak_length, TERM_LENGTH, MTU_LENGTH, &m_flow_control, RECEIVER_KEY, m_time, RetransmitHandlerTest::on_resend, this), 0);
+
+    ASSERT_EQ(resends.size(), 2u);
+    EXPECT_EQ(resends[0], std::make_pair(nak_offset, nak_length));
+    EXPECT_EQ(resends[1], std::make_pair(nak_offset + (int32_t)nak_length, (size_t)ALIGNED_FRAME_LENGTH));
+}
+
+TEST_F(RetransmitHandlerTest, shouldCountRepeatedNaksPerReceiver)
+{
+    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, &m_naks_coalesced_counter, &m_naks_suppressed_counter, 0, LINGER_TIMEOUT_20MS), 0);
+
+    const int32_t nak_offset = (ALIGNED_FRAME_LENGTH * 2);
+    const size_t nak_length = ALIGNED_FRAME_LENGTH;
+
+    size_t called = 0;
+    m_resend =
+        [&](int32_t term_id, int32_t term_offset, size_t length)
+        {
+            called++;
+            return 0;
+        };
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, nak_offset, nak_length, TERM_LENGTH, MTU_LENGTH, &m_flow_control, RECEIVER_KEY, m_time, RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, nak_offset, nak_length, TERM_LENGTH, MTU_LENGTH, &m_flow_control, RECEIVER_KEY, m_time, RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(m_naks_suppressed_counter, 1);
+    EXPECT_EQ(m_naks_coalesced_counter, 0);
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, nak_offset, nak_length, TERM_LENGTH, MTU_LENGTH, &m_flow_control, OTHER_RECEIVER_KEY, m_time, RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(m_naks_suppressed_counter, 1);
+    EXPECT_EQ(m_naks_coalesced_counter, 1);
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, nak_offset, nak_length, TERM_LENGTH, MTU_LENGTH, &m_flow_control, OTHER_RECEIVER_KEY, m_time, RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(m_naks_suppressed_counter, 2);
+    EXPECT_EQ(called, 1u);
+}
+
+TEST_F(RetransmitHandlerTest, shouldNotTrimNakToMidFrameEndOfCappedRetransmit)
+{
+    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, &m_naks_coalesced_counter, &m_naks_suppressed_counter, 0, LINGER_TIMEOUT_20MS), 0);
+    m_flow_control.max_retransmission_length = capped_retransmission_length;
+
+    const int32_t nak_offset = (ALIGNED_FRAME_LENGTH * 2);
+    const size_t nak_length = ALIGNED_FRAME_LENGTH * 3;
+
+    std::vector<std::pair<int32_t, size_t>> resends;
+    m_resend =
+        [&](int32_t term_id, int32_t term_offset, size_t length)
+        {
+            resends.emplace_back(term_offset, length);
+            return 0;
+        };
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, nak_offset, nak_length, TERM_LENGTH, MTU_LENGTH, &m_flow_control, RECEIVER_KEY, m_time, RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, nak_offset, nak_length, TERM_LENGTH, MTU_LENGTH, &m_flow_control, OTHER_RECEIVER_KEY, m_time, RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(m_naks_coalesced_counter, 1);
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, nak_offset + ALIGNED_FRAME_LENGTH, ALIGNED_FRAME_LENGTH * 2, TERM_LENGTH, MTU_LENGTH, &m_flow_control, RECEIVER_KEY, m_time, RetransmitHandlerTest::on_resend, this), 0);
+
+    ASSERT_EQ(resends.size(), 2u);
+    EXPECT_EQ(resends[0], std::make_pair(nak_offset, (size_t)(ALIGNED_FRAME_LENGTH + (ALIGNED_FRAME_LENGTH / 2))));
+    EXPECT_EQ(resends[1].first, nak_offset + ALIGNED_FRAME_LENGTH);
+    EXPECT_EQ(resends[1].first % ALIGNED_FRAME_LENGTH, 0);
+}
+
+TEST_F(RetransmitHandlerTest, shouldRetransmitBothUncoveredEndsOfNakCoveringLingeringNak)
+{
+    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, &m_naks_coalesced_counter, &m_naks_suppressed_counter, 0, LINGER_TIMEOUT_20MS), 0);
+
+    const int32_t nak_offset = (ALIGNED_FRAME_LENGTH * 2);
+    const size_t nak_length = ALIGNED_FRAME_LENGTH;
+
+    std::vector<std::pair<int32_t, size_t>> resends;
+    m_resend =
+        [&](int32_t term_id, int32_t term_offset, size_t length)
+        {
+            resends.emplace_back(term_offset, length);
+            return 0;
+        };
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, nak_offset, nak_length, TERM_LENGTH, MTU_LENGTH, &m_flow_control, RECEIVER_KEY, m_time, RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, nak_offset - ALIGNED_FRAME_LENGTH, ALIGNED_FRAME_LENGTH * 4, TERM_LENGTH, MTU_LENGTH, &m_flow_control, OTHER_RECEIVER_KEY, m_time, RetransmitHandlerTest::on_resend, this), 0);
+
+    ASSERT_EQ(resends.size(), 3u);
+    EXPECT_EQ(resends[0], std::make_pair(nak_offset, nak_length));
+    EXPECT_EQ(resends[1], std::make_pair(nak_offset - (int32_t)ALIGNED_FRAME_LENGTH, (size_t)ALIGNED_FRAME_LENGTH));
+    EXPECT_EQ(resends[2], std::make_pair(nak_offset + (int32_t)ALIGNED_FRAME_LENGTH, (size_t)(ALIGNED_FRAME_LENGTH * 2)));
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, nak_offset - ALIGNED_FRAME_LENGTH, ALIGNED_FRAME_LENGTH * 4, TERM_LENGTH, MTU_LENGTH, &m_flow_control, OTHER_RECEIVER_KEY, m_time, RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(resends.size(), 3u);
 }
@@ -0,0 +1,137 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeron_send_batch_controller.h"
+}
+
+#define MAX_MESSAGES_PER_SEND (16)
+
+class SendBatchControllerTest : public testing::Test
+{
+protected:
+    void initAdaptive()
+    {
+        aeron_send_batch_controller_init(&m_controller, MAX_MESSAGES_PER_SEND, true, &m_counter);
+    }
+
+    void sendFullBatch(bool has_window_headroom = true)
+    {
+        const size_t batch_length = m_controller.current_messages_per_send;
+        aeron_send_batch_controller_on_send(&m_controller, batch_length, batch_length, has_window_headroom);
+    }
+
+    aeron_send_batch_controller_t m_controller = {};
+    volatile int64_t m_counter = 0;
+};
+
+TEST_F(SendBatchControllerTest, shouldKeepFixedBehaviourWhenNotAdaptive)
+{
+    aeron_send_batch_controller_init(&m_controller, MAX_MESSAGES_PER_SEND, false, nullptr);
+    EXPECT_EQ(MAX_MESSAGES_PER_SEND, m_controller.current_messages_per_send);
+
+    aeron_send_batch_controller_on_send(&m_controller, MAX_MESSAGES_PER_SEND, 3, true);
+    EXPECT_EQ(1u, m_controller.current_messages_per_send);
+
+    aeron_send_batch_controller_on_send(&m_controller, 1, 1, false);
+    EXPECT_EQ(MAX_MESSAGES_PER_SEND, m_controller.current_messages_per_send);
+    EXPECT_FALSE(aeron_send_batch_controller_is_socket_queue_sample_due(&m_controller, INT64_MAX));
+}
+
+TEST_F(SendBatchControllerTest, shouldGrowToMaxWhileBatchesFill)
+{
+    initAdaptive();
+    EXPECT_EQ(1u, m_controller.current_messages_per_send);
+    EXPECT_EQ(1, m_counter);
+
+    for (size_t expected : { 2, 4, 8, 16, 16 })
+    {
+        sendFullBatch();
+        EXPECT_EQ(expected, m_controller.current_messages_per_send);
+        EXPECT_EQ((int64_t)expected, m_counter);
+    }
+}
+
+TEST_F(SendBatchControllerTest, shouldNotGrowWithoutWindowHeadroom)
+{
+    initAdaptive();
+    sendFullBatch();
+    sendFullBatch(false);
+
+    EXPECT_EQ(2u, m_controller.current_messages_per_send);
+}
+
+TEST_F(SendBatchControllerTest, shouldHalveOnShortSend)
+{
+    initAdaptive();
+    for (int i = 0; i < 4; i++)
+    {
+        sendFullBatch();
+    }
+    ASSERT_EQ(16u, m_controller.current_messages_per_send);
+
+    aeron_send_batch_controller_on_send(&m_controller, 16, 10, true);
+    EXPECT_EQ(8u, m_controller.current_messages_per_send);
+    EXPECT_EQ(8, m_counter);
+}
+
+TEST_F(SendBatchControllerTest, shouldShrinkWhenBatchesAreNotFilled)
+{
+    initAdaptive();
+    for (int i = 0; i < 3; i++)
+    {
+        sendFullBatch();
+    }
+    ASSERT_EQ(8u, m_controller.current_messages_per_send);
+
+    for (size_t expected : { 7, 6, 5, 4, 3, 2, 1 })
+    {
+        aeron_send_batch_controller_on_send(&m_controller, 1, 1, true);
+        EXPECT_EQ(expected, m_controller.current_messages_per_send);
+    }
+}
+
+TEST_F(SendBatchControllerTest, shouldHoldThenBackOffAsSocketQueueFills)
+{
+    const int64_t now_ns = 1000;
+    initAdaptive();
+    sendFullBatch();
+    sendFullBatch();
+    ASSERT_EQ(4u, m_controller.current_messages_per_send);
+
+    ASSERT_TRUE(aeron_send_batch_controller_is_socket_queue_sample_due(&m_controller, now_ns));
+    aeron_send_batch_controller_on_socket_queue(&m_controller, now_ns, 600, 1000);
+    EXPECT_FALSE(aeron_send_batch_controller_is_socket_queue_sample_due(&m_controller, now_ns + 1));
+    sendFullBatch();
+    EXPECT_EQ(4u, m_controller.current_messages_per_send);
+
+    aeron_send_batch_controller_on_socket_queue(&m_controller, now_ns, 800, 1000);
+    sendFullBatch();
+    EXPECT_EQ(2u, m_controller.current_messages_per_send);
+
+    aeron_send_batch_controller_on_socket_queue(&m_controller, now_ns, 100, 1000);
+    sendFullBatch();
+    EXPECT_EQ(4u, m_controller.current_messages_per_send);
+    EXPECT_TRUE(aeron_send_batch_controller_is_socket_queue_sample_due(
+        &m_controller, now_ns + AERON_SEND_BATCH_CONTROLLER_QUEUE_SAMPLE_INTERVAL_NS));
+
+    aeron_send_batch_controller_disable_socket_queue_sampling(&m_controller);
+    EXPECT_FALSE(aeron_send_batch_controller_is_socket_queue_sample_due(&m_controller, INT64_MAX - 1));
+}
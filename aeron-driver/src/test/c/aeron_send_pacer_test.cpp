@@ -0,0 +1,97 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeron_send_pacer.h"
+}
+
+#define RATE_BYTES_PER_SEC (1000 * 1000)
+#define BURST_LENGTH (4096)
+#define START_NS (1000 * 1000 * 1000LL)
+
+class SendPacerTest : public testing::Test
+{
+protected:
+    aeron_send_pacer_t m_pacer = {};
+};
+
+TEST_F(SendPacerTest, shouldNotLimitWhenRateIsNotSet)
+{
+    aeron_send_pacer_init(&m_pacer, 0, 0, START_NS);
+
+    EXPECT_FALSE(aeron_send_pacer_is_enabled(&m_pacer));
+    EXPECT_EQ(INT64_MAX, aeron_send_pacer_available(&m_pacer, START_NS));
+
+    aeron_send_pacer_on_sent(&m_pacer, START_NS, 1024 * 1024);
+    EXPECT_EQ(INT64_MAX, aeron_send_pacer_available(&m_pacer, START_NS));
+}
+
+TEST_F(SendPacerTest, shouldStartWithFullBurst)
+{
+    aeron_send_pacer_init(&m_pacer, RATE_BYTES_PER_SEC, BURST_LENGTH, START_NS);
+
+    EXPECT_TRUE(aeron_send_pacer_is_enabled(&m_pacer));
+    EXPECT_EQ(BURST_LENGTH, aeron_send_pacer_available(&m_pacer, START_NS));
+    EXPECT_EQ(BURST_LENGTH, aeron_send_pacer_available(&m_pacer, START_NS + START_NS));
+}
+
+TEST_F(SendPacerTest, shouldRefillAtRateWithNanosecondPrecision)
+{
+    aeron_send_pacer_init(&m_pacer, RATE_BYTES_PER_SEC, BURST_LENGTH, START_NS);
+
+    aeron_send_pacer_on_sent(&m_pacer, START_NS, BURST_LENGTH);
+    EXPECT_EQ(0, aeron_send_pacer_available(&m_pacer, START_NS));
+
+    // 1 byte per microsecond at 1MB/s
+    EXPECT_EQ(0, aeron_send_pacer_available(&m_pacer, START_NS + 999));
+    EXPECT_EQ(1, aeron_send_pacer_available(&m_pacer, START_NS + 1000));
+    EXPECT_EQ(1408, aeron_send_pacer_available(&m_pacer, START_NS + 1408 * 1000 + 999));
+    EXPECT_EQ(BURST_LENGTH, aeron_send_pacer_available(&m_pacer, START_NS + (BURST_LENGTH * 1000)));
+    EXPECT_EQ(BURST_LENGTH, aeron_send_pacer_available(&m_pacer, START_NS + (BURST_LENGTH * 2000)));
+}
+
+TEST_F(SendPacerTest, shouldHoldLongRunRateToConfiguredRate)
+{
+    aeron_send_pacer_init(&m_pacer, RATE_BYTES_PER_SEC, BURST_LENGTH, START_NS);
+
+    int64_t bytes_sent = 0;
+    for (int64_t now_ns = START_NS; now_ns < START_NS + 1000 * 1000 * 1000LL; now_ns += 7777)
+    {
+        const int64_t available = aeron_send_pacer_available(&m_pacer, now_ns);
+        const int64_t length = available < 1408 ? available : 1408;
+        if (length > 0)
+        {
+            aeron_send_pacer_on_sent(&m_pacer, now_ns, length);
+            bytes_sent += length;
+        }
+    }
+
+    EXPECT_LE(bytes_sent, RATE_BYTES_PER_SEC + BURST_LENGTH);
+    EXPECT_GE(bytes_sent, RATE_BYTES_PER_SEC - 1408);
+}
+
+TEST_F(SendPacerTest, shouldDelayDataAfterDebtFromRetransmits)
+{
+    aeron_send_pacer_init(&m_pacer, RATE_BYTES_PER_SEC, BURST_LENGTH, START_NS);
+
+    aeron_send_pacer_on_sent(&m_pacer, START_NS, BURST_LENGTH * 2);
+    EXPECT_EQ(0, aeron_send_pacer_available(&m_pacer, START_NS + (BURST_LENGTH * 1000)));
+    EXPECT_EQ(BURST_LENGTH, aeron_send_pacer_available(&m_pacer, START_NS + (BURST_LENGTH * 2000)));
+}
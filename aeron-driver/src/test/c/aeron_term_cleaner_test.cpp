@@ -0,0 +1,177 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "concurrent/aeron_term_cleaner.h"
+}
+
+#define TERM_LENGTH (AERON_LOGBUFFER_TERM_MIN_LENGTH * 16)
+#define POSITION_BITS_TO_SHIFT (20)
+
+class TermCleanerTest : public testing::Test
+{
+public:
+    TermCleanerTest()
+    {
+        for (size_t i = 0; i < AERON_LOGBUFFER_PARTITION_COUNT; i++)
+        {
+            m_terms[i].assign(TERM_LENGTH, 0xFF);
+            m_mapped_raw_log.term_buffers[i].addr = m_terms[i].data();
+            m_mapped_raw_log.term_buffers[i].length = TERM_LENGTH;
+        }
+        m_mapped_raw_log.term_length = TERM_LENGTH;
+    }
+
+protected:
+    void SetUp() override
+    {
+        ASSERT_EQ(0, aeron_term_cleaner_init(&m_cleaner));
+    }
+
+    void TearDown() override
+    {
+        if (!m_is_closed)
+        {
+            aeron_term_cleaner_close(&m_cleaner);
+        }
+    }
+
+    size_t countNonZero(size_t index, size_t offset, size_t length)
+    {
+        size_t count = 0;
+        for (size_t i = offset; i < offset + length; i++)
+        {
+            count += 0 != m_terms[index][i] ? 1 : 0;
+        }
+
+        return count;
+    }
+
+    std::array<std::vector<uint8_t>, AERON_LOGBUFFER_PARTITION_COUNT> m_terms;
+    aeron_mapped_raw_log_t m_mapped_raw_log = {};
+    aeron_term_cleaner_t m_cleaner = {};
+    bool m_is_closed = false;
+};
+
+TEST_F(TermCleanerTest, shouldZeroOnlyRequestedRangeWithNonTemporalStores)
+{
+    const size_t offsets[] = { 0, 8, 13, 64, 100 };
+    const size_t lengths[] = { 0, 7, 255, 256, 4096 + 9 };
+
+    for (size_t offset : offsets)
+    {
+        for (size_t length : lengths)
+        {
+            m_terms[0].assign(TERM_LENGTH, 0xFF);
+
+            aeron_term_cleaner_zero(m_terms[0].data() + offset, length, true);
+
+            EXPECT_EQ(0u, countNonZero(0, offset, length)) << offset << ":" << length;
+            EXPECT_EQ(TERM_LENGTH - length, countNonZero(0, 0, TERM_LENGTH)) << offset << ":" << length;
+        }
+    }
+}
+
+TEST_F(TermCleanerTest, shouldCleanInlineUpToEndOfTerm)
+{
+    aeron_term_cleaner_log_t log;
+    aeron_term_cleaner_log_init(&log, &m_mapped_raw_log, POSITION_BITS_TO_SHIFT, TERM_LENGTH / 2, true);
+
+    aeron_term_cleaner_log_clean_to(&log, TERM_LENGTH * 2);
+
+    EXPECT_EQ(TERM_LENGTH, log.clean_position);
+    EXPECT_EQ(TERM_LENGTH / 2, countNonZero(0, 0, TERM_LENGTH));
+    EXPECT_EQ(0u, countNonZero(0, TERM_LENGTH / 2, TERM_LENGTH / 2));
+    EXPECT_EQ(TERM_LENGTH, countNonZero(1, 0, TERM_LENGTH));
+    EXPECT_EQ(TERM_LENGTH * 2, aeron_term_cleaner_log_limit(&log, TERM_LENGTH * 2));
+}
+
+TEST_F(TermCleanerTest, shouldHoldLimitWhenCleaningInlineFallsBehind)
+{
+    aeron_term_cleaner_log_t log;
+    aeron_term_cleaner_log_init(&log, &m_mapped_raw_log, POSITION_BITS_TO_SHIFT, 0, false);
+
+    aeron_term_cleaner_log_clean_to(&log, TERM_LENGTH * 2);
+
+    EXPECT_EQ(TERM_LENGTH, log.clean_position);
+    EXPECT_EQ(TERM_LENGTH * 3, aeron_term_cleaner_log_limit(&log, TERM_LENGTH * 4));
+
+    aeron_term_cleaner_log_clean_to(&log, TERM_LENGTH * 2);
+
+    EXPECT_EQ(TERM_LENGTH * 2, log.clean_position);
+    EXPECT_EQ(TERM_LENGTH * 4, aeron_term_cleaner_log_limit(&log, TERM_LENGTH * 4));
+}
+
+TEST_F(TermCleanerTest, shouldHoldLimitUntilCleanerCatchesUp)
+{
+    aeron_term_cleaner_log_t log;
+    aeron_term_cleaner_log_init(&log, &m_mapped_raw_log, POSITION_BITS_TO_SHIFT, 0, false);
+    ASSERT_EQ(0, aeron_term_cleaner_add(&m_cleaner, &log));
+
+    const int64_t proposed_limit = TERM_LENGTH * 3;
+    aeron_term_cleaner_log_clean_to(&log, TERM_LENGTH);
+
+    EXPECT_EQ(0, log.clean_position);
+    EXPECT_EQ(TERM_LENGTH * 2, aeron_term_cleaner_log_limit(&log, proposed_limit));
+
+    size_t bytes_cleaned = 0;
+    size_t work_count;
+    while ((work_count = aeron_term_cleaner_do_work(&m_cleaner)) > 0)
+    {
+        EXPECT_LE(work_count, (size_t)AERON_TERM_CLEANER_CHUNK_LENGTH);
+        bytes_cleaned += work_count;
+    }
+
+    EXPECT_EQ((size_t)TERM_LENGTH, bytes_cleaned);
+    EXPECT_EQ(TERM_LENGTH, log.clean_position);
+    EXPECT_EQ(0u, countNonZero(0, 0, TERM_LENGTH));
+    EXPECT_EQ(proposed_limit, aeron_term_cleaner_log_limit(&log, proposed_limit));
+
+    aeron_term_cleaner_remove(&log);
+    EXPECT_EQ(nullptr, log.cleaner);
+    EXPECT_EQ(0u, m_cleaner.logs_length);
+}
+
+TEST_F(TermCleanerTest, shouldCleanOnDedicatedThread)
+{
+    aeron_term_cleaner_log_t log;
+    aeron_term_cleaner_log_init(&log, &m_mapped_raw_log, POSITION_BITS_TO_SHIFT, 0, true);
+    ASSERT_EQ(0, aeron_term_cleaner_add(&m_cleaner, &log));
+    ASSERT_EQ(0, aeron_term_cleaner_start(&m_cleaner));
+
+    aeron_term_cleaner_log_clean_to(&log, TERM_LENGTH + (TERM_LENGTH / 2));
+
+    int64_t clean_position = 0;
+    while (clean_position < TERM_LENGTH + (TERM_LENGTH / 2))
+    {
+        AERON_GET_VOLATILE(clean_position, log.clean_position);
+        aeron_micro_sleep(100);
+    }
+
+    ASSERT_EQ(0, aeron_term_cleaner_close(&m_cleaner));
+    m_is_closed = true;
+
+    EXPECT_EQ(nullptr, log.cleaner);
+    EXPECT_EQ(0u, countNonZero(0, 0, TERM_LENGTH));
+    EXPECT_EQ(0u, countNonZero(1, 0, TERM_LENGTH / 2));
+    EXPECT_EQ(TERM_LENGTH / 2, countNonZero(1, TERM_LENGTH / 2, TERM_LENGTH / 2));
+}
@@ -21,6 +21,7 @@
 extern "C"
 {
 #include "concurrent/aeron_term_scanner.h"
+#include "concurrent/aeron_term_gap_scanner.h"
 }
 
 #define CAPACITY (AERON_LOGBUFFER_TERM_MIN_LENGTH)
@@ -188,3 +189,202 @@ TEST_F(TermScannerTest, shouldScanLastMessageInBufferMinusPaddingLimitedByMtu)
         m_ptr, CAPACITY - offset, mtu, &m_padding), aligned_frame_length);
     EXPECT_EQ(m_padding, 0);
 }
+
+class TermScannerSimdTest : public testing::TestWithParam<const char *>
+{
+public:
+    TermScannerSimdTest()
+    {
+        m_buffer.fill(0);
+    }
+
+protected:
+    void SetUp() override
+    {
+        if (aeron_term_scanner_simd_select(GetParam()) < 0)
+        {
+            GTEST_SKIP() << GetParam() << " not supported";
+        }
+    }
+
+    void TearDown() override
+    {
+        aeron_term_scanner_simd_select(nullptr);
+    }
+
+    int32_t appendFrame(int32_t offset, int32_t frame_length, int16_t type = AERON_HDR_TYPE_DATA)
+    {
+        auto *frame_header = (aeron_frame_header_t *)(m_buffer.data() + offset);
+        frame_header->frame_length = frame_length;
+        frame_header->type = type;
+
+        return offset + AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    }
+
+    int32_t scan(int32_t offset, int32_t max_length, const char *name)
+    {
+        aeron_term_scanner_simd_select(name);
+        int32_t available = aeron_term_scanner_scan_for_availability(
+            m_buffer.data() + offset, CAPACITY - offset, max_length, &m_padding);
+        aeron_term_scanner_simd_select(GetParam());
+
+        return available;
+    }
+
+    static void onGap(void *clientd, int32_t term_id, int32_t term_offset, size_t length)
+    {
+        auto *gap = static_cast<std::pair<int32_t, size_t> *>(clientd);
+        gap->first = term_offset;
+        gap->second = length;
+    }
+
+    std::pair<int32_t, size_t> scanForGap(int32_t offset, int32_t limit_offset)
+    {
+        std::pair<int32_t, size_t> gap = { -1, 0 };
+        aeron_term_gap_scanner_scan_for_gap(m_buffer.data(), 0, offset, limit_offset, onGap, &gap);
+
+        return gap;
+    }
+
+    buffer_t m_buffer = {};
+    int32_t m_padding = 0;
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    TermScannerSimdTest, TermScannerSimdTest, testing::Values("scalar", "avx2", "neon"),
+    [](const testing::TestParamInfo<const char *> &info) { return std::string(info.param); });
+
+TEST_P(TermScannerSimdTest, shouldScanRunOfSmallMessagesUpToMtu)
+{
+    const int32_t frame_length = AERON_DATA_HEADER_LENGTH + 40;
+    const int32_t aligned_frame_length = AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    int32_t offset = 0;
+    while (offset < CAPACITY / 2)
+    {
+        offset = appendFrame(offset, frame_length);
+    }
+
+    EXPECT_EQ((MTU_LENGTH / aligned_frame_length) * aligned_frame_length, scan(0, MTU_LENGTH, GetParam()));
+    EXPECT_EQ(0, m_padding);
+    EXPECT_EQ(offset, scan(0, CAPACITY, GetParam()));
+    EXPECT_EQ(offset - aligned_frame_length * 3, scan(aligned_frame_length * 3, CAPACITY, GetParam()));
+}
+
+TEST_P(TermScannerSimdTest, shouldMatchScalarWhenRunIsBroken)
+{
+    const int32_t frame_length = AERON_DATA_HEADER_LENGTH + 64;
+    int32_t offset = 0;
+    for (int i = 0; i < 20; i++)
+    {
+        offset = appendFrame(offset, frame_length);
+    }
+    const int32_t longer_frame_offset = offset;
+    offset = appendFrame(offset, frame_length * 2);
+    for (int i = 0; i < 20; i++)
+    {
+        offset = appendFrame(offset, frame_length);
+    }
+    const int32_t in_progress_offset = offset;
+    offset = appendFrame(offset, -frame_length);
+    appendFrame(offset, frame_length);
+
+    for (int32_t start = 0; start < in_progress_offset; start += AERON_ALIGN(frame_length, 32))
+    {
+        for (int32_t max_length : { 100, MTU_LENGTH, 4096, CAPACITY })
+        {
+            const int32_t expected = scan(start, max_length, "scalar");
+            EXPECT_EQ(expected, scan(start, max_length, GetParam())) << start << ":" << max_length;
+        }
+    }
+
+    EXPECT_EQ(in_progress_offset - longer_frame_offset, scan(longer_frame_offset, CAPACITY, GetParam()));
+}
+
+TEST_P(TermScannerSimdTest, shouldStopAtPaddingInRun)
+{
+    const int32_t frame_length = AERON_DATA_HEADER_LENGTH + 8;
+    const int32_t aligned_frame_length = AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    int32_t offset = 0;
+    for (int i = 0; i < 12; i++)
+    {
+        offset = appendFrame(offset, frame_length);
+    }
+    appendFrame(offset, aligned_frame_length, AERON_HDR_TYPE_PAD);
+
+    EXPECT_EQ(offset + AERON_DATA_HEADER_LENGTH, scan(0, CAPACITY, GetParam()));
+    EXPECT_EQ(aligned_frame_length - AERON_DATA_HEADER_LENGTH, m_padding);
+}
+
+TEST_P(TermScannerSimdTest, shouldMatchScalarWithPaddingInterleavedInRun)
+{
+    const int32_t frame_length = AERON_DATA_HEADER_LENGTH + 8;
+    const int32_t aligned_frame_length = AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    int32_t offset = 0;
+    for (int i = 0; i < 11; i++)
+    {
+        offset = appendFrame(offset, frame_length);
+    }
+    const int32_t padding_offset = offset;
+    offset = appendFrame(offset, aligned_frame_length, AERON_HDR_TYPE_PAD);
+    for (int i = 0; i < 20; i++)
+    {
+        offset = appendFrame(offset, frame_length);
+    }
+
+    for (int32_t start = 0; start < offset; start += aligned_frame_length)
+    {
+        const int32_t expected = scan(start, CAPACITY, "scalar");
+        const int32_t expected_padding = m_padding;
+        EXPECT_EQ(expected, scan(start, CAPACITY, GetParam())) << start;
+        EXPECT_EQ(expected_padding, m_padding) << start;
+    }
+
+    EXPECT_EQ(padding_offset + AERON_DATA_HEADER_LENGTH, scan(0, CAPACITY, GetParam()));
+}
+
+TEST_P(TermScannerSimdTest, shouldFindGapAfterRunOfFrames)
+{
+    const int32_t frame_length = AERON_DATA_HEADER_LENGTH + 40;
+    int32_t offset = 0;
+    for (int i = 0; i < 30; i++)
+    {
+        offset = appendFrame(offset, frame_length);
+    }
+    const int32_t gap_begin = offset;
+
+    for (int32_t gap_length : { 32, 96, 128, 160, 1024, 4096 + 64 })
+    {
+        m_buffer.fill(0);
+        offset = 0;
+        for (int i = 0; i < 30; i++)
+        {
+            offset = appendFrame(offset, frame_length);
+        }
+        appendFrame(gap_begin + gap_length, frame_length);
+
+        auto gap = scanForGap(0, CAPACITY);
+        EXPECT_EQ(gap_begin, gap.first) << gap_length;
+        EXPECT_EQ((size_t)gap_length, gap.second) << gap_length;
+
+        gap = scanForGap(0, gap_begin + gap_length);
+        EXPECT_EQ(gap_begin, gap.first) << gap_length;
+        EXPECT_EQ((size_t)gap_length, gap.second) << gap_length;
+    }
+}
+
+TEST_P(TermScannerSimdTest, shouldReportGapToLimitWhenRestOfTermIsEmpty)
+{
+    const int32_t frame_length = AERON_DATA_HEADER_LENGTH + 40;
+    int32_t offset = 0;
+    for (int i = 0; i < 10; i++)
+    {
+        offset = appendFrame(offset, frame_length);
+    }
+
+    for (int32_t limit_offset : { offset + 32, offset + 64, offset + 512, CAPACITY })
+    {
+        auto gap = scanForGap(0, limit_offset);
+        EXPECT_EQ(offset, gap.first);
+        EXPECT_EQ((size_t)(limit_offset - offset), gap.second);
+    }
+}
@@ -29,6 +29,8 @@ typedef struct aeron_test_udp_bindings_state_stct
     int setup_count;
     int rttm_count;
     int heartbeat_count;
+    size_t send_queue_length;
+    size_t so_sndbuf;
 }
 aeron_test_udp_bindings_state_t;
 
@@ -122,6 +124,16 @@ int aeron_test_udp_channel_transport_get_so_rcvbuf(aeron_udp_channel_transport_t
     return 0;
 }
 
+int aeron_test_udp_channel_transport_get_send_queue_length(
+    aeron_udp_channel_transport_t *transport, size_t *send_queue_length, size_t *so_sndbuf)
+{
+    aeron_test_udp_bindings_state_t *state = (aeron_test_udp_bindings_state_t *)transport->bindings_clientd;
+    *send_queue_length = state->send_queue_length;
+    *so_sndbuf = state->so_sndbuf;
+
+    return 0;
+}
+
 int aeron_test_udp_channel_transport_bind_addr_and_port(
     aeron_udp_channel_transport_t *transport, char *buffer, size_t length)
 {
@@ -183,6 +195,7 @@ void aeron_test_udp_bindings_load(aeron_udp_channel_transport_bindings_t *bindin
     bindings->init_func = aeron_test_udp_channel_transport_init;
     bindings->bind_addr_and_port_func = aeron_test_udp_channel_transport_bind_addr_and_port;
     bindings->get_so_rcvbuf_func = aeron_test_udp_channel_transport_get_so_rcvbuf;
+    bindings->get_send_queue_length_func = aeron_test_udp_channel_transport_get_send_queue_length;
 }
 
 #endif //AERON_AERON_TEST_UDP_BINDINGS_H
@@ -0,0 +1,334 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <algorithm>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "media/aeron_udp_channel_transport.h"
+#include "media/aeron_udp_channel_transport_netem.h"
+#include "protocol/aeron_udp_protocol.h"
+}
+
+#define TEMP_URL_LEN (128)
+#define MESSAGE_LENGTH (1000)
+#define START_NS (1000 * 1000 * 1000LL)
+
+static int netem_test_outgoing_delegate(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct sockaddr_storage *address,
+    struct iovec *iov,
+    size_t iov_length,
+    int64_t *bytes_sent)
+{
+    auto *received = static_cast<std::vector<int32_t> *>(interceptor_state);
+
+    for (size_t i = 0; i < iov_length; i++)
+    {
+        auto *frame_header = static_cast<aeron_frame_header_t *>(iov[i].iov_base);
+        received->push_back(*reinterpret_cast<int32_t *>(frame_header + 1));
+        *bytes_sent += (int64_t)iov[i].iov_len;
+    }
+
+    return (int)iov_length;
+}
+
+static void netem_test_incoming_delegate(
+    void *interceptor_state,
+    aeron_udp_channel_incoming_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    void *receiver_clientd,
+    void *endpoint_clientd,
+    void *destination_clientd,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr,
+    struct timespec *media_timestamp)
+{
+    auto *received = static_cast<std::vector<int32_t> *>(interceptor_state);
+    received->push_back(*reinterpret_cast<int32_t *>(buffer + sizeof(aeron_frame_header_t)));
+}
+
+class UdpChannelTransportNetemTest : public testing::Test
+{
+public:
+    UdpChannelTransportNetemTest()
+    {
+        m_params.tick_ns = AERON_UDP_CHANNEL_INTERCEPTOR_NETEM_TICK_NS_DEFAULT;
+        m_params.msg_type_mask = 1UL << AERON_HDR_TYPE_DATA;
+
+        m_outgoing_delegate.interceptor_state = &m_received;
+        m_outgoing_delegate.outgoing_send_func = netem_test_outgoing_delegate;
+        m_incoming_delegate.interceptor_state = &m_received;
+        m_incoming_delegate.incoming_func = netem_test_incoming_delegate;
+    }
+
+protected:
+    void TearDown() override
+    {
+        aeron_udp_channel_interceptor_netem_close(m_netem);
+    }
+
+    void create()
+    {
+        ASSERT_EQ(0, aeron_udp_channel_interceptor_netem_create(&m_netem, &m_params));
+        aeron_udp_channel_interceptor_netem_poll(m_netem, START_NS);
+    }
+
+    int send(int32_t id, int16_t type = AERON_HDR_TYPE_DATA, aeron_udp_channel_transport_t *transport = nullptr)
+    {
+        uint8_t buffer[MESSAGE_LENGTH] = {};
+        auto *frame_header = reinterpret_cast<aeron_frame_header_t *>(buffer);
+        frame_header->type = type;
+        *reinterpret_cast<int32_t *>(frame_header + 1) = id;
+
+        struct iovec iov = { buffer, MESSAGE_LENGTH };
+        int64_t bytes_sent = 0;
+
+        const int result = aeron_udp_channel_interceptor_netem_outgoing_send(
+            m_netem, &m_outgoing_delegate, transport, &m_addr, &iov, 1, &bytes_sent);
+        EXPECT_EQ(MESSAGE_LENGTH, bytes_sent);
+
+        return result;
+    }
+
+    aeron_udp_channel_interceptor_netem_params_t m_params = {};
+    aeron_udp_channel_interceptor_netem_t *m_netem = nullptr;
+    aeron_udp_channel_outgoing_interceptor_t m_outgoing_delegate = {};
+    aeron_udp_channel_incoming_interceptor_t m_incoming_delegate = {};
+    struct sockaddr_storage m_addr = {};
+    std::vector<int32_t> m_received;
+};
+
+TEST_F(UdpChannelTransportNetemTest, shouldPassThroughWithNoImpairment)
+{
+    create();
+
+    EXPECT_EQ(1, send(1));
+    EXPECT_EQ(std::vector<int32_t>({ 1 }), m_received);
+    EXPECT_EQ(0u, m_netem->queued_count);
+}
+
+TEST_F(UdpChannelTransportNetemTest, shouldHoldBackUntilDelayHasPassed)
+{
+    m_params.delay_ns = 1000 * 1000;
+    create();
+
+    EXPECT_EQ(1, send(1));
+    EXPECT_EQ(1, send(2));
+    EXPECT_TRUE(m_received.empty());
+    EXPECT_EQ(2u, m_netem->queued_count);
+    EXPECT_EQ(2u * MESSAGE_LENGTH, m_netem->queued_length);
+
+    EXPECT_EQ(0, aeron_udp_channel_interceptor_netem_poll(m_netem, START_NS + m_params.delay_ns - 1));
+    EXPECT_TRUE(m_received.empty());
+
+    EXPECT_EQ(2, aeron_udp_channel_interceptor_netem_poll(m_netem, START_NS + m_params.delay_ns));
+    EXPECT_EQ(std::vector<int32_t>({ 1, 2 }), m_received);
+    EXPECT_EQ(0u, m_netem->queued_count);
+    EXPECT_EQ(0u, m_netem->queued_length);
+}
+
+TEST_F(UdpChannelTransportNetemTest, shouldReleaseDelaysLongerThanTheWheel)
+{
+    const int64_t wheel_span_ns =
+        (int64_t)AERON_UDP_CHANNEL_INTERCEPTOR_NETEM_WHEEL_LENGTH * (int64_t)m_params.tick_ns;
+    m_params.delay_ns = (uint64_t)(wheel_span_ns + (wheel_span_ns / 2));
+    create();
+
+    send(1);
+
+    int64_t now_ns = START_NS;
+    for (; now_ns < START_NS + (int64_t)m_params.delay_ns; now_ns += (int64_t)m_params.tick_ns)
+    {
+        aeron_udp_channel_interceptor_netem_poll(m_netem, now_ns);
+        ASSERT_TRUE(m_received.empty()) << now_ns;
+    }
+
+    aeron_udp_channel_interceptor_netem_poll(m_netem, now_ns);
+    EXPECT_EQ(std::vector<int32_t>({ 1 }), m_received);
+}
+
+TEST_F(UdpChannelTransportNetemTest, shouldPaceToRateAndDropBeyondLimit)
+{
+    m_params.rate_bytes_per_sec = 1000 * 1000;
+    m_params.limit_length = 3 * MESSAGE_LENGTH;
+    create();
+
+    for (int32_t i = 0; i < 5; i++)
+    {
+        EXPECT_EQ(1, send(i));
+    }
+
+    EXPECT_EQ(3u, m_netem->queued_count);
+
+    // each message takes 1ms to serialise at 1MB/s
+    for (int64_t i = 1; i <= 3; i++)
+    {
+        aeron_udp_channel_interceptor_netem_poll(m_netem, START_NS + (i * 1000 * 1000) - 1);
+        EXPECT_EQ((size_t)(i - 1), m_received.size());
+        aeron_udp_channel_interceptor_netem_poll(m_netem, START_NS + (i * 1000 * 1000));
+        EXPECT_EQ((size_t)i, m_received.size());
+    }
+
+    EXPECT_EQ(std::vector<int32_t>({ 0, 1, 2 }), m_received);
+}
+
+TEST_F(UdpChannelTransportNetemTest, shouldDuplicateEveryMessage)
+{
+    m_params.duplicate_rate = 1.0;
+    create();
+
+    send(1);
+    send(2);
+
+    EXPECT_EQ(std::vector<int32_t>({ 1, 1, 2, 2 }), m_received);
+}
+
+TEST_F(UdpChannelTransportNetemTest, shouldReorderAheadOfDelayedMessages)
+{
+    m_params.delay_ns = 1000 * 1000;
+    create();
+
+    send(1);
+    m_netem->params.reorder_rate = 1.0;
+    send(2);
+
+    EXPECT_EQ(std::vector<int32_t>({ 2 }), m_received);
+
+    aeron_udp_channel_interceptor_netem_poll(m_netem, START_NS + m_params.delay_ns);
+    EXPECT_EQ(std::vector<int32_t>({ 2, 1 }), m_received);
+}
+
+TEST_F(UdpChannelTransportNetemTest, shouldKeepJitterWithinBounds)
+{
+    const int64_t delay_ns = 1000 * 1000;
+    const int64_t jitter_ns = 200 * 1000;
+    m_params.delay_ns = delay_ns;
+    m_params.jitter_ns = jitter_ns;
+    m_params.seed = 7;
+    create();
+
+    const int32_t count = 100;
+    for (int32_t i = 0; i < count; i++)
+    {
+        send(i);
+    }
+
+    EXPECT_EQ(0, aeron_udp_channel_interceptor_netem_poll(m_netem, START_NS + delay_ns - jitter_ns - 1));
+
+    int released = aeron_udp_channel_interceptor_netem_poll(m_netem, START_NS + delay_ns);
+    EXPECT_GT(released, 0);
+    EXPECT_LT(released, count);
+
+    released += aeron_udp_channel_interceptor_netem_poll(m_netem, START_NS + delay_ns + jitter_ns);
+    EXPECT_EQ(count, released);
+
+    std::vector<int32_t> in_order(m_received);
+    std::sort(in_order.begin(), in_order.end());
+    EXPECT_NE(in_order, m_received);
+}
+
+TEST_F(UdpChannelTransportNetemTest, shouldNotHoldBackUnmatchedMessageTypes)
+{
+    m_params.delay_ns = 1000 * 1000;
+    create();
+
+    send(1);
+    send(2, AERON_HDR_TYPE_SM);
+
+    EXPECT_EQ(std::vector<int32_t>({ 2 }), m_received);
+}
+
+TEST_F(UdpChannelTransportNetemTest, shouldDelayIncomingMessages)
+{
+    m_params.delay_ns = 1000 * 1000;
+    create();
+
+    uint8_t buffer[MESSAGE_LENGTH] = {};
+    auto *frame_header = reinterpret_cast<aeron_frame_header_t *>(buffer);
+    frame_header->type = AERON_HDR_TYPE_DATA;
+    *reinterpret_cast<int32_t *>(frame_header + 1) = 42;
+
+    aeron_udp_channel_interceptor_netem_incoming(
+        m_netem, &m_incoming_delegate, nullptr, nullptr, nullptr, nullptr, buffer, MESSAGE_LENGTH, &m_addr, nullptr);
+
+    // the receive buffer is reused so the held back copy must not depend on it
+    memset(buffer, 0, sizeof(buffer));
+    EXPECT_TRUE(m_received.empty());
+
+    aeron_udp_channel_interceptor_netem_poll(m_netem, START_NS + m_params.delay_ns);
+    EXPECT_EQ(std::vector<int32_t>({ 42 }), m_received);
+}
+
+TEST_F(UdpChannelTransportNetemTest, shouldDiscardHeldBackMessagesForRemovedTransport)
+{
+    aeron_udp_channel_transport_t transport_a = {};
+    aeron_udp_channel_transport_t transport_b = {};
+    m_params.delay_ns = 1000 * 1000;
+    create();
+
+    send(1, AERON_HDR_TYPE_DATA, &transport_a);
+    send(2, AERON_HDR_TYPE_DATA, &transport_b);
+
+    aeron_udp_channel_interceptor_netem_transport_notification(
+        m_netem, &transport_a, nullptr, nullptr, AERON_UDP_CHANNEL_INTERCEPTOR_REMOVE_NOTIFICATION);
+    EXPECT_EQ(1u, m_netem->queued_count);
+
+    aeron_udp_channel_interceptor_netem_poll(m_netem, START_NS + m_params.delay_ns);
+    EXPECT_EQ(std::vector<int32_t>({ 2 }), m_received);
+}
+
+TEST_F(UdpChannelTransportNetemTest, shouldParseAllParams)
+{
+    char uri[TEMP_URL_LEN];
+    aeron_udp_channel_interceptor_netem_params_t params;
+    strncpy(
+        uri,
+        "delay=2ms|jitter=500us|distribution=normal|reorder=0.1|duplicate=0.05|rate=1m|limit=64k|seed=3|msg-mask=0x1",
+        TEMP_URL_LEN);
+
+    EXPECT_EQ(0, aeron_udp_channel_interceptor_netem_parse_params(uri, &params));
+    EXPECT_EQ(2 * 1000 * 1000ull, params.delay_ns);
+    EXPECT_EQ(500 * 1000ull, params.jitter_ns);
+    EXPECT_EQ(AERON_UDP_CHANNEL_INTERCEPTOR_NETEM_DISTRIBUTION_NORMAL, params.distribution);
+    EXPECT_EQ(0.1, params.reorder_rate);
+    EXPECT_EQ(0.05, params.duplicate_rate);
+    EXPECT_EQ(1024 * 1024ull, params.rate_bytes_per_sec);
+    EXPECT_EQ(64 * 1024ull, params.limit_length);
+    EXPECT_EQ(3ull, params.seed);
+    EXPECT_EQ(0x1ul, params.msg_type_mask);
+    EXPECT_EQ((uint64_t)AERON_UDP_CHANNEL_INTERCEPTOR_NETEM_TICK_NS_DEFAULT, params.tick_ns);
+}
+
+TEST_F(UdpChannelTransportNetemTest, shouldFailOnInvalidParams)
+{
+    const char *invalid[] = { "delay=abc", "reorder=1.5", "distribution=pareto", "tick=0ns", "bogus=1" };
+    for (const char *param : invalid)
+    {
+        char uri[TEMP_URL_LEN];
+        aeron_udp_channel_interceptor_netem_params_t params;
+        strncpy(uri, param, TEMP_URL_LEN);
+
+        EXPECT_EQ(-1, aeron_udp_channel_interceptor_netem_parse_params(uri, &params)) << param;
+    }
+}
@@ -16,12 +16,18 @@
 package io.aeron.driver;
 
 import io.aeron.ErrorCode;
+import io.aeron.command.BatchCompleteFlyweight;
+import io.aeron.command.BatchMessageFlyweight;
 import io.aeron.command.ControlProtocolEvents;
+import io.aeron.command.CorrelatedMessageFlyweight;
 import io.aeron.command.PublicationMessageFlyweight;
 import io.aeron.exceptions.AeronException;
 import io.aeron.exceptions.ControlProtocolException;
 import io.aeron.exceptions.StorageSpaceException;
+import org.agrona.BitUtil;
+import org.agrona.DirectBuffer;
 import org.agrona.ErrorHandler;
+import org.agrona.ExpandableArrayBuffer;
 import org.agrona.LangUtil;
 import org.agrona.concurrent.UnsafeBuffer;
 import org.agrona.concurrent.ringbuffer.RingBuffer;
@@ -183,6 +189,95 @@ class ClientCommandAdapterTest
         inOrder.verifyNoMoreInteractions();
     }
 
+    @Test
+    void shouldProcessBatchAndCompleteWithResultOfEachEntry()
+    {
+        final long clientId = 109;
+        final long batchCorrelationId = 40;
+        final long publicationCorrelationId = 41;
+        final long keepaliveCorrelationId = 42;
+        final int streamId = 100;
+        final String channel = "aeron:ipc";
+        final BatchMessageFlyweight batchMsgFlyweight = new BatchMessageFlyweight();
+        final CorrelatedMessageFlyweight correlatedMsgFlyweight = new CorrelatedMessageFlyweight();
+
+        batchMsgFlyweight.wrap(buffer, 0)
+            .clientId(clientId)
+            .correlationId(batchCorrelationId);
+        int entryOffset = batchMsgFlyweight.entriesOffset();
+
+        publicationMsgFlyweight.wrap(buffer, entryOffset + BatchMessageFlyweight.ENTRY_HEADER_LENGTH)
+            .clientId(clientId)
+            .correlationId(publicationCorrelationId);
+        publicationMsgFlyweight
+            .streamId(streamId)
+            .channel(channel);
+        entryOffset = putEntryHeader(
+            entryOffset, ControlProtocolEvents.ADD_PUBLICATION, publicationMsgFlyweight.length());
+
+        correlatedMsgFlyweight.wrap(buffer, entryOffset + BatchMessageFlyweight.ENTRY_HEADER_LENGTH)
+            .clientId(clientId)
+            .correlationId(keepaliveCorrelationId);
+        entryOffset = putEntryHeader(
+            entryOffset, ControlProtocolEvents.CLIENT_KEEPALIVE, CorrelatedMessageFlyweight.LENGTH);
+
+        batchMsgFlyweight
+            .entryCount(2)
+            .entriesLength(entryOffset - batchMsgFlyweight.entriesOffset());
+
+        clientCommandAdapter.onMessage(ControlProtocolEvents.BATCH, buffer, 0, batchMsgFlyweight.length());
+
+        final ArgumentCaptor<DirectBuffer> responseCaptor = ArgumentCaptor.forClass(DirectBuffer.class);
+        final ArgumentCaptor<Integer> responseLengthCaptor = ArgumentCaptor.forClass(Integer.class);
+        final InOrder inOrder = inOrder(driverConductor, clientProxy);
+        inOrder.verify(driverConductor).onAddIpcPublication(
+            channel, streamId, publicationCorrelationId, clientId, false);
+        inOrder.verify(clientProxy).onError(
+            keepaliveCorrelationId,
+            ErrorCode.UNKNOWN_COMMAND_TYPE_ID,
+            "ERROR - command=" + ControlProtocolEvents.CLIENT_KEEPALIVE + " not supported in batch");
+        inOrder.verify(clientProxy).onBatchComplete(responseCaptor.capture(), eq(0), responseLengthCaptor.capture());
+        verify(driverConductor, never()).onClientKeepalive(anyLong());
+
+        final ExpandableArrayBuffer response = new ExpandableArrayBuffer(responseLengthCaptor.getValue());
+        response.putBytes(0, responseCaptor.getValue(), 0, responseLengthCaptor.getValue());
+        final BatchCompleteFlyweight batchComplete = new BatchCompleteFlyweight().wrap(response, 0);
+        assertEquals(batchCorrelationId, batchComplete.correlationId());
+        assertEquals(2, batchComplete.resultCount());
+        assertEquals(batchComplete.length(), (int)responseLengthCaptor.getValue());
+        assertEquals(publicationCorrelationId, batchComplete.resultCorrelationId(0));
+        assertEquals(ErrorCode.UNUSED.value(), batchComplete.resultErrorCodeValue(0));
+        assertEquals(keepaliveCorrelationId, batchComplete.resultCorrelationId(1));
+        assertEquals(ErrorCode.UNKNOWN_COMMAND_TYPE_ID.value(), batchComplete.resultErrorCodeValue(1));
+    }
+
+    @Test
+    void shouldRejectBatchWithMoreEntriesThanFitInItsLength()
+    {
+        final long batchCorrelationId = 40;
+        final BatchMessageFlyweight batchMsgFlyweight = new BatchMessageFlyweight();
+        batchMsgFlyweight.wrap(buffer, 0)
+            .clientId(109)
+            .correlationId(batchCorrelationId);
+        batchMsgFlyweight
+            .entryCount(2)
+            .entriesLength(BatchMessageFlyweight.MIN_ALIGNED_ENTRY_LENGTH);
+
+        clientCommandAdapter.onMessage(ControlProtocolEvents.BATCH, buffer, 0, batchMsgFlyweight.length());
+
+        verify(clientProxy).onError(eq(batchCorrelationId), eq(ErrorCode.MALFORMED_COMMAND), anyString());
+        verify(clientProxy, never()).onBatchComplete(any(), anyInt(), anyInt());
+    }
+
+    private int putEntryHeader(final int entryOffset, final int msgTypeId, final int length)
+    {
+        buffer.putInt(entryOffset + BatchMessageFlyweight.ENTRY_TYPE_ID_OFFSET, msgTypeId);
+        buffer.putInt(entryOffset + BatchMessageFlyweight.ENTRY_LENGTH_OFFSET, length);
+
+        return entryOffset + BitUtil.align(
+            BatchMessageFlyweight.ENTRY_HEADER_LENGTH + length, BatchMessageFlyweight.ENTRY_ALIGNMENT);
+    }
+
     private static List<Throwable> noSpaceLeftExceptions()
     {
         return Arrays.asList(
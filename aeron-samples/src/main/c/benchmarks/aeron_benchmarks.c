@@ -0,0 +1,631 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <stdlib.h>
+#include <errno.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include <string.h>
+
+#if !defined(_MSC_VER)
+#include <unistd.h>
+#endif
+
+#include <hdr/hdr_histogram.h>
+
+#include "aeronmd.h"
+#include "aeron_common.h"
+#include "aeron_benchmarks.h"
+#include "concurrent/aeron_atomic.h"
+#include "util/aeron_parse_util.h"
+
+const char usage_str[] =
+    "[-h][-v][-l][-b batch][-f filter][-F length][-H dir][-L length][-m operations][-o file][-p prefix][-r runs]"
+    "[-u uri][-w operations]\n"
+    "    -h               help\n"
+    "    -v               show version and exit\n"
+    "    -l               list benchmarks and exit\n"
+    "    -b batch         number of operations timed together for each histogram sample\n"
+    "    -f filter        only run benchmarks with names containing filter\n"
+    "    -F length        use message length of length bytes for fragment assembly\n"
+    "    -H dir           write a percentile distribution (.hgrm) for each benchmark to dir\n"
+    "    -L length        use message length of length bytes\n"
+    "    -m operations    number of operations for each measured run\n"
+    "    -o file          write results as JSON to file\n"
+    "    -p prefix        aeron.dir location for the embedded media driver specified as prefix\n"
+    "    -r runs          number of measured runs\n"
+    "    -u uri           use channel specified in uri for UDP benchmarks\n"
+    "    -w operations    number of warm up operations\n";
+
+#define AERON_BENCHMARK_MAX_BENCHMARKS (64)
+#define AERON_BENCHMARK_PERCENTILE_COUNT (6)
+static const double aeron_benchmark_percentiles[AERON_BENCHMARK_PERCENTILE_COUNT] =
+    { 50.0, 90.0, 99.0, 99.9, 99.99, 100.0 };
+static const char *aeron_benchmark_percentile_names[AERON_BENCHMARK_PERCENTILE_COUNT] =
+    { "p50", "p90", "p99", "p99.9", "p99.99", "max" };
+
+typedef struct aeron_benchmark_settings_stct
+{
+    const char *filter;
+    const char *aeron_dir;
+    const char *udp_channel;
+    const char *json_filename;
+    const char *histogram_dir;
+    uint64_t message_length;
+    uint64_t fragmented_message_length;
+    uint64_t operations;
+    uint64_t warm_up_operations;
+    uint64_t runs;
+    uint64_t batch_size;
+}
+aeron_benchmark_settings_t;
+
+typedef struct aeron_benchmark_result_stct
+{
+    uint64_t operations;
+    uint64_t bytes;
+    int64_t duration_ns;
+    double *run_ops_per_sec;
+    struct hdr_histogram *histogram;
+}
+aeron_benchmark_result_t;
+
+typedef struct aeron_benchmark_embedded_driver_stct
+{
+    aeron_driver_context_t *driver_context;
+    aeron_driver_t *driver;
+    aeron_context_t *context;
+    aeron_t *aeron;
+}
+aeron_benchmark_embedded_driver_t;
+
+volatile bool running = true;
+
+void sigint_handler(int signal)
+{
+    AERON_PUT_ORDERED(running, false);
+}
+
+bool aeron_benchmark_is_running(void)
+{
+    bool result;
+    AERON_GET_VOLATILE(result, running);
+    return result;
+}
+
+static bool aeron_benchmark_is_selected(const aeron_benchmark_settings_t *settings, const aeron_benchmark_t *benchmark)
+{
+    return NULL == settings->filter || NULL != strstr(benchmark->name, settings->filter);
+}
+
+static int aeron_benchmark_driver_start(
+    aeron_benchmark_embedded_driver_t *embedded_driver, const aeron_benchmark_settings_t *settings)
+{
+    char default_dir[AERON_MAX_PATH];
+
+    if (aeron_driver_context_init(&embedded_driver->driver_context) < 0)
+    {
+        fprintf(stderr, "aeron_driver_context_init: %s\n", aeron_errmsg());
+        return -1;
+    }
+
+    if (NULL == settings->aeron_dir)
+    {
+        snprintf(
+            default_dir,
+            sizeof(default_dir),
+            "%s-benchmarks",
+            aeron_driver_context_get_dir(embedded_driver->driver_context));
+    }
+
+    aeron_driver_context_set_dir(
+        embedded_driver->driver_context, NULL == settings->aeron_dir ? default_dir : settings->aeron_dir);
+    aeron_driver_context_set_dir_delete_on_start(embedded_driver->driver_context, true);
+    aeron_driver_context_set_dir_delete_on_shutdown(embedded_driver->driver_context, true);
+
+    if (aeron_driver_init(&embedded_driver->driver, embedded_driver->driver_context) < 0)
+    {
+        fprintf(stderr, "aeron_driver_init: %s\n", aeron_errmsg());
+        return -1;
+    }
+
+    if (aeron_driver_start(embedded_driver->driver, false) < 0)
+    {
+        fprintf(stderr, "aeron_driver_start: %s\n", aeron_errmsg());
+        return -1;
+    }
+
+    if (aeron_context_init(&embedded_driver->context) < 0)
+    {
+        fprintf(stderr, "aeron_context_init: %s\n", aeron_errmsg());
+        return -1;
+    }
+
+    if (aeron_context_set_dir(
+        embedded_driver->context, aeron_driver_context_get_dir(embedded_driver->driver_context)) < 0)
+    {
+        fprintf(stderr, "aeron_context_set_dir: %s\n", aeron_errmsg());
+        return -1;
+    }
+
+    if (aeron_init(&embedded_driver->aeron, embedded_driver->context) < 0)
+    {
+        fprintf(stderr, "aeron_init: %s\n", aeron_errmsg());
+        return -1;
+    }
+
+    if (aeron_start(embedded_driver->aeron) < 0)
+    {
+        fprintf(stderr, "aeron_start: %s\n", aeron_errmsg());
+        return -1;
+    }
+
+    return 0;
+}
+
+static void aeron_benchmark_driver_close(aeron_benchmark_embedded_driver_t *embedded_driver)
+{
+    aeron_close(embedded_driver->aeron);
+    aeron_context_close(embedded_driver->context);
+    aeron_driver_close(embedded_driver->driver);
+    aeron_driver_context_close(embedded_driver->driver_context);
+}
+
+static int aeron_benchmark_run_batches(
+    const aeron_benchmark_t *benchmark,
+    void *state,
+    uint64_t operations,
+    uint64_t batch_size,
+    struct hdr_histogram *histogram,
+    uint64_t *bytes)
+{
+    uint64_t remaining = operations;
+
+    while (remaining > 0 && aeron_benchmark_is_running())
+    {
+        const uint64_t batch = remaining < batch_size ? remaining : batch_size;
+        const int64_t start_ns = aeron_nano_clock();
+        const int64_t result = benchmark->run(state, batch);
+        const int64_t duration_ns = aeron_nano_clock() - start_ns;
+
+        if (result < 0)
+        {
+            return -1;
+        }
+
+        if (NULL != histogram)
+        {
+            const int64_t ns_per_operation = (duration_ns + (int64_t)(batch / 2)) / (int64_t)batch;
+            hdr_record_values(histogram, ns_per_operation > 0 ? ns_per_operation : 1, (int64_t)batch);
+        }
+
+        *bytes += (uint64_t)result;
+        remaining -= batch;
+    }
+
+    return aeron_benchmark_is_running() ? 0 : -1;
+}
+
+static int aeron_benchmark_run(
+    const aeron_benchmark_t *benchmark,
+    aeron_benchmark_context_t *context,
+    const aeron_benchmark_settings_t *settings,
+    aeron_benchmark_result_t *result)
+{
+    void *state = NULL;
+    uint64_t warm_up_bytes = 0;
+    int status = -1;
+
+    if (benchmark->setup(context, &state) < 0)
+    {
+        fprintf(stderr, "%s setup failed: %s\n", benchmark->name, aeron_errmsg());
+        return -1;
+    }
+
+    if (aeron_benchmark_run_batches(
+        benchmark, state, settings->warm_up_operations, settings->batch_size, NULL, &warm_up_bytes) < 0)
+    {
+        fprintf(stderr, "%s warm up failed: %s\n", benchmark->name, aeron_errmsg());
+        goto cleanup;
+    }
+
+    for (uint64_t i = 0; i < settings->runs; i++)
+    {
+        uint64_t run_bytes = 0;
+        const int64_t start_ns = aeron_nano_clock();
+
+        if (aeron_benchmark_run_batches(
+            benchmark, state, settings->operations, settings->batch_size, result->histogram, &run_bytes) < 0)
+        {
+            fprintf(stderr, "%s run %" PRIu64 " failed: %s\n", benchmark->name, i, aeron_errmsg());
+            goto cleanup;
+        }
+
+        const int64_t run_duration_ns = aeron_nano_clock() - start_ns;
+
+        result->operations += settings->operations;
+        result->bytes += run_bytes;
+        result->duration_ns += run_duration_ns;
+        result->run_ops_per_sec[i] = ((double)settings->operations * 1e9) / (double)run_duration_ns;
+    }
+
+    status = 0;
+
+cleanup:
+    benchmark->teardown(state);
+
+    return status;
+}
+
+static void aeron_benchmark_print_result(const aeron_benchmark_t *benchmark, const aeron_benchmark_result_t *result)
+{
+    const double seconds = (double)result->duration_ns / 1e9;
+
+    printf(
+        "%-28s %14.0f ops/s %10.2f MB/s   ns/op p50=%" PRId64 " p99=%" PRId64 " p99.9=%" PRId64 " max=%" PRId64 "\n",
+        benchmark->name,
+        (double)result->operations / seconds,
+        ((double)result->bytes / seconds) / (1024.0 * 1024.0),
+        hdr_value_at_percentile(result->histogram, 50.0),
+        hdr_value_at_percentile(result->histogram, 99.0),
+        hdr_value_at_percentile(result->histogram, 99.9),
+        hdr_max(result->histogram));
+    fflush(stdout);
+}
+
+static int aeron_benchmark_write_histogram(
+    const char *histogram_dir, const aeron_benchmark_t *benchmark, const aeron_benchmark_result_t *result)
+{
+    char filename[AERON_MAX_PATH];
+    snprintf(filename, sizeof(filename), "%s/%s.hgrm", histogram_dir, benchmark->name);
+
+    FILE *file = fopen(filename, "w");
+    if (NULL == file)
+    {
+        fprintf(stderr, "could not open %s: %s\n", filename, strerror(errno));
+        return -1;
+    }
+
+    hdr_percentiles_print(result->histogram, file, 5, 1.0, CLASSIC);
+    fclose(file);
+
+    return 0;
+}
+
+static void aeron_benchmark_print_json_string(FILE *file, const char *value)
+{
+    fputc('"', file);
+    for (const char *c = value; '\0' != *c; c++)
+    {
+        if ('"' == *c || '\\' == *c)
+        {
+            fputc('\\', file);
+        }
+        fputc(*c, file);
+    }
+    fputc('"', file);
+}
+
+static int aeron_benchmark_write_json(
+    const char *filename,
+    const aeron_benchmark_settings_t *settings,
+    const aeron_benchmark_t **benchmarks,
+    const aeron_benchmark_result_t *results,
+    size_t length)
+{
+    FILE *file = fopen(filename, "w");
+    if (NULL == file)
+    {
+        fprintf(stderr, "could not open %s: %s\n", filename, strerror(errno));
+        return -1;
+    }
+
+    fprintf(file, "{\n  \"version\": ");
+    aeron_benchmark_print_json_string(file, aeron_version_full());
+    fprintf(file, ",\n  \"gitSha\": ");
+    aeron_benchmark_print_json_string(file, aeron_version_gitsha());
+    fprintf(file, ",\n  \"timestampMs\": %" PRId64 ",\n", aeron_epoch_clock());
+    fprintf(file, "  \"settings\": {\n");
+    fprintf(file, "    \"messageLength\": %" PRIu64 ",\n", settings->message_length);
+    fprintf(file, "    \"fragmentedMessageLength\": %" PRIu64 ",\n", settings->fragmented_message_length);
+    fprintf(file, "    \"operations\": %" PRIu64 ",\n", settings->operations);
+    fprintf(file, "    \"warmUpOperations\": %" PRIu64 ",\n", settings->warm_up_operations);
+    fprintf(file, "    \"runs\": %" PRIu64 ",\n", settings->runs);
+    fprintf(file, "    \"batchSize\": %" PRIu64 ",\n", settings->batch_size);
+    fprintf(file, "    \"udpChannel\": ");
+    aeron_benchmark_print_json_string(file, settings->udp_channel);
+    fprintf(file, "\n  },\n  \"results\": [");
+
+    for (size_t i = 0; i < length; i++)
+    {
+        const aeron_benchmark_result_t *result = &results[i];
+        const double seconds = (double)result->duration_ns / 1e9;
+
+        fprintf(file, "%s\n    {\n      \"name\": ", 0 == i ? "" : ",");
+        aeron_benchmark_print_json_string(file, benchmarks[i]->name);
+        fprintf(file, ",\n      \"operations\": %" PRIu64 ",\n", result->operations);
+        fprintf(file, "      \"bytes\": %" PRIu64 ",\n", result->bytes);
+        fprintf(file, "      \"durationNs\": %" PRId64 ",\n", result->duration_ns);
+        fprintf(file, "      \"opsPerSec\": %.1f,\n", (double)result->operations / seconds);
+        fprintf(file, "      \"bytesPerSec\": %.1f,\n", (double)result->bytes / seconds);
+        fprintf(file, "      \"runOpsPerSec\": [");
+        for (uint64_t r = 0; r < settings->runs; r++)
+        {
+            fprintf(file, "%s%.1f", 0 == r ? "" : ", ", result->run_ops_per_sec[r]);
+        }
+        fprintf(file, "],\n      \"nsPerOp\": {\n");
+        fprintf(file, "        \"min\": %" PRId64 ",\n", hdr_min(result->histogram));
+        fprintf(file, "        \"mean\": %.1f,\n", hdr_mean(result->histogram));
+        for (size_t p = 0; p < AERON_BENCHMARK_PERCENTILE_COUNT; p++)
+        {
+            fprintf(
+                file,
+                "        \"%s\": %" PRId64 "%s\n",
+                aeron_benchmark_percentile_names[p],
+                hdr_value_at_percentile(result->histogram, aeron_benchmark_percentiles[p]),
+                p < AERON_BENCHMARK_PERCENTILE_COUNT - 1 ? "," : "");
+        }
+        fprintf(file, "      }\n    }");
+    }
+
+    fprintf(file, "\n  ]\n}\n");
+    fclose(file);
+
+    return 0;
+}
+
+static void aeron_benchmark_parse_size(const char *value, const char *name, uint64_t *result)
+{
+    if (aeron_parse_size64(value, result) < 0)
+    {
+        fprintf(stderr, "malformed %s %s: %s\n", name, value, aeron_errmsg());
+        exit(EXIT_FAILURE);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int status = EXIT_FAILURE, opt;
+    bool list_only = false;
+    aeron_benchmark_settings_t settings =
+        {
+            .filter = NULL,
+            .aeron_dir = NULL,
+            .udp_channel = AERON_BENCHMARK_DEFAULT_UDP_CHANNEL,
+            .json_filename = NULL,
+            .histogram_dir = NULL,
+            .message_length = AERON_BENCHMARK_DEFAULT_MESSAGE_LENGTH,
+            .fragmented_message_length = AERON_BENCHMARK_DEFAULT_FRAGMENTED_MESSAGE_LENGTH,
+            .operations = AERON_BENCHMARK_DEFAULT_OPERATIONS,
+            .warm_up_operations = AERON_BENCHMARK_DEFAULT_WARM_UP_OPERATIONS,
+            .runs = AERON_BENCHMARK_DEFAULT_RUNS,
+            .batch_size = AERON_BENCHMARK_DEFAULT_BATCH_SIZE
+        };
+    aeron_benchmark_embedded_driver_t embedded_driver = { 0 };
+    const aeron_benchmark_t *benchmarks[AERON_BENCHMARK_MAX_BENCHMARKS];
+    aeron_benchmark_result_t results[AERON_BENCHMARK_MAX_BENCHMARKS] = { 0 };
+    size_t benchmarks_length = 0;
+    size_t results_length = 0;
+    bool requires_driver = false;
+
+    while ((opt = getopt(argc, argv, "hvlb:f:F:H:L:m:o:p:r:u:w:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'b':
+            {
+                aeron_benchmark_parse_size(optarg, "batch size", &settings.batch_size);
+                break;
+            }
+
+            case 'f':
+            {
+                settings.filter = optarg;
+                break;
+            }
+
+            case 'F':
+            {
+                aeron_benchmark_parse_size(optarg, "fragmented message length", &settings.fragmented_message_length);
+                break;
+            }
+
+            case 'H':
+            {
+                settings.histogram_dir = optarg;
+                break;
+            }
+
+            case 'l':
+            {
+                list_only = true;
+                break;
+            }
+
+            case 'L':
+            {
+                aeron_benchmark_parse_size(optarg, "message length", &settings.message_length);
+                break;
+            }
+
+            case 'm':
+            {
+                aeron_benchmark_parse_size(optarg, "number of operations", &settings.operations);
+                break;
+            }
+
+            case 'o':
+            {
+                settings.json_filename = optarg;
+                break;
+            }
+
+            case 'p':
+            {
+                settings.aeron_dir = optarg;
+                break;
+            }
+
+            case 'r':
+            {
+                aeron_benchmark_parse_size(optarg, "number of runs", &settings.runs);
+                break;
+            }
+
+            case 'u':
+            {
+                settings.udp_channel = optarg;
+                break;
+            }
+
+            case 'v':
+            {
+                printf(
+                    "%s <%s> major %d minor %d patch %d git %s\n",
+                    argv[0],
+                    aeron_version_full(),
+                    aeron_version_major(),
+                    aeron_version_minor(),
+                    aeron_version_patch(),
+                    aeron_version_gitsha());
+                exit(EXIT_SUCCESS);
+            }
+
+            case 'w':
+            {
+                aeron_benchmark_parse_size(optarg, "number of warm up operations", &settings.warm_up_operations);
+                break;
+            }
+
+            case 'h':
+            default:
+                fprintf(stderr, "Usage: %s %s", argv[0], usage_str);
+                exit(status);
+        }
+    }
+
+    if (0 == settings.batch_size || 0 == settings.runs || 0 == settings.message_length)
+    {
+        fprintf(stderr, "batch size, runs and message length must be greater than zero\n");
+        exit(status);
+    }
+
+    const aeron_benchmark_t *all_benchmarks[2] = { aeron_client_benchmarks, aeron_concurrent_benchmarks };
+    const size_t all_benchmarks_length[2] = { aeron_client_benchmarks_length, aeron_concurrent_benchmarks_length };
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        for (size_t j = 0; j < all_benchmarks_length[i]; j++)
+        {
+            const aeron_benchmark_t *benchmark = &all_benchmarks[i][j];
+            if (aeron_benchmark_is_selected(&settings, benchmark) && benchmarks_length < AERON_BENCHMARK_MAX_BENCHMARKS)
+            {
+                benchmarks[benchmarks_length++] = benchmark;
+                requires_driver |= AERON_BENCHMARK_TRANSPORT_NONE != benchmark->transport;
+            }
+        }
+    }
+
+    if (list_only)
+    {
+        for (size_t i = 0; i < benchmarks_length; i++)
+        {
+            printf("%s\n", benchmarks[i]->name);
+        }
+
+        return EXIT_SUCCESS;
+    }
+
+    signal(SIGINT, sigint_handler);
+
+    if (requires_driver && aeron_benchmark_driver_start(&embedded_driver, &settings) < 0)
+    {
+        goto cleanup;
+    }
+
+    printf(
+        "Running %" PRIu64 " x %" PRIu64 " operations after %" PRIu64 " warm up operations, message length %" PRIu64
+        " bytes\n",
+        settings.runs,
+        settings.operations,
+        settings.warm_up_operations,
+        settings.message_length);
+
+    for (size_t i = 0; i < benchmarks_length; i++)
+    {
+        const aeron_benchmark_t *benchmark = benchmarks[i];
+        aeron_benchmark_result_t *result = &results[i];
+        aeron_benchmark_context_t context =
+            {
+                .aeron = embedded_driver.aeron,
+                .channel = AERON_BENCHMARK_TRANSPORT_UDP == benchmark->transport ?
+                    settings.udp_channel : AERON_BENCHMARK_DEFAULT_IPC_CHANNEL,
+                .stream_id = AERON_BENCHMARK_DEFAULT_STREAM_ID + (int32_t)i,
+                .message_length = (size_t)settings.message_length,
+                .fragmented_message_length = (size_t)settings.fragmented_message_length
+            };
+
+        if (hdr_init(1, 10 * 1000 * 1000 * INT64_C(1000), 3, &result->histogram) != 0 ||
+            NULL == (result->run_ops_per_sec = calloc(settings.runs, sizeof(double))))
+        {
+            fprintf(stderr, "%s\n", "could not allocate result");
+            goto cleanup;
+        }
+        results_length++;
+
+        if (aeron_benchmark_run(benchmark, &context, &settings, result) < 0)
+        {
+            goto cleanup;
+        }
+
+        aeron_benchmark_print_result(benchmark, result);
+
+        if (NULL != settings.histogram_dir &&
+            aeron_benchmark_write_histogram(settings.histogram_dir, benchmark, result) < 0)
+        {
+            goto cleanup;
+        }
+    }
+
+    if (NULL != settings.json_filename &&
+        aeron_benchmark_write_json(settings.json_filename, &settings, benchmarks, results, results_length) < 0)
+    {
+        goto cleanup;
+    }
+
+    status = EXIT_SUCCESS;
+
+cleanup:
+    if (requires_driver)
+    {
+        aeron_benchmark_driver_close(&embedded_driver);
+    }
+
+    for (size_t i = 0; i < results_length; i++)
+    {
+        hdr_close(results[i].histogram);
+        free(results[i].run_ops_per_sec);
+    }
+
+    return status;
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_BENCHMARKS_H
+#define AERON_BENCHMARKS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "aeronc.h"
+
+#define AERON_BENCHMARK_DEFAULT_IPC_CHANNEL "aeron:ipc"
+#define AERON_BENCHMARK_DEFAULT_UDP_CHANNEL "aeron:udp?endpoint=localhost:20121"
+#define AERON_BENCHMARK_DEFAULT_STREAM_ID (1001)
+#define AERON_BENCHMARK_DEFAULT_MESSAGE_LENGTH (32)
+#define AERON_BENCHMARK_DEFAULT_FRAGMENTED_MESSAGE_LENGTH (16 * 1024)
+#define AERON_BENCHMARK_DEFAULT_OPERATIONS (10 * 1000 * 1000)
+#define AERON_BENCHMARK_DEFAULT_WARM_UP_OPERATIONS (1000 * 1000)
+#define AERON_BENCHMARK_DEFAULT_RUNS (3)
+#define AERON_BENCHMARK_DEFAULT_BATCH_SIZE (100)
+
+typedef enum aeron_benchmark_transport_en
+{
+    AERON_BENCHMARK_TRANSPORT_NONE,
+    AERON_BENCHMARK_TRANSPORT_IPC,
+    AERON_BENCHMARK_TRANSPORT_UDP
+}
+aeron_benchmark_transport_t;
+
+typedef struct aeron_benchmark_context_stct
+{
+    aeron_t *aeron;
+    const char *channel;
+    int32_t stream_id;
+    size_t message_length;
+    size_t fragmented_message_length;
+}
+aeron_benchmark_context_t;
+
+/*
+ * A benchmark operation is a single message sent or received. The harness times calls to run in batches and records
+ * the mean time per operation of each batch, so run must complete exactly the number of operations asked of it. It
+ * returns the number of payload bytes moved, or -1 with the error set.
+ */
+typedef int (*aeron_benchmark_setup_func_t)(aeron_benchmark_context_t *context, void **state);
+typedef int64_t (*aeron_benchmark_run_func_t)(void *state, uint64_t operations);
+typedef void (*aeron_benchmark_teardown_func_t)(void *state);
+
+typedef struct aeron_benchmark_stct
+{
+    const char *name;
+    aeron_benchmark_transport_t transport;
+    aeron_benchmark_setup_func_t setup;
+    aeron_benchmark_run_func_t run;
+    aeron_benchmark_teardown_func_t teardown;
+}
+aeron_benchmark_t;
+
+extern const aeron_benchmark_t aeron_client_benchmarks[];
+extern const size_t aeron_client_benchmarks_length;
+
+extern const aeron_benchmark_t aeron_concurrent_benchmarks[];
+extern const size_t aeron_concurrent_benchmarks_length;
+
+bool aeron_benchmark_is_running(void);
+
+#endif //AERON_BENCHMARKS_H
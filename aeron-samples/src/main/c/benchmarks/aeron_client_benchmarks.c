@@ -0,0 +1,597 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <inttypes.h>
+#include <string.h>
+
+#include "aeron_benchmarks.h"
+#include "aeron_agent.h"
+#include "aeron_alloc.h"
+#include "concurrent/aeron_atomic.h"
+#include "concurrent/aeron_thread.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+#include "protocol/aeron_udp_protocol.h"
+#include "util/aeron_bitutil.h"
+#include "util/aeron_error.h"
+
+#define AERON_BENCHMARK_BLOCK_MESSAGES (16)
+#define AERON_BENCHMARK_FRAGMENT_LIMIT (10)
+
+typedef enum aeron_client_benchmark_peer_en
+{
+    AERON_CLIENT_BENCHMARK_PEER_CONSUMER,
+    AERON_CLIENT_BENCHMARK_PEER_PRODUCER
+}
+aeron_client_benchmark_peer_t;
+
+typedef struct aeron_client_benchmark_state_stct
+{
+    aeron_publication_t *publication;
+    aeron_exclusive_publication_t *exclusive_publication;
+    aeron_subscription_t *subscription;
+    aeron_image_t *image;
+    aeron_image_fragment_assembler_t *fragment_assembler;
+    aeron_publication_constants_t constants;
+
+    aeron_thread_t peer_thread;
+    bool peer_started;
+    volatile bool peer_running;
+
+    uint8_t *message;
+    size_t message_length;
+    uint8_t *block;
+    size_t frame_length;
+
+    uint64_t received_messages;
+    uint64_t received_bytes;
+}
+aeron_client_benchmark_state_t;
+
+static void aeron_client_benchmark_null_handler(
+    void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
+{
+}
+
+static void aeron_client_benchmark_counting_handler(
+    void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
+{
+    aeron_client_benchmark_state_t *state = (aeron_client_benchmark_state_t *)clientd;
+
+    state->received_messages++;
+    state->received_bytes += length;
+}
+
+static aeron_controlled_fragment_handler_action_t aeron_client_benchmark_controlled_counting_handler(
+    void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
+{
+    aeron_client_benchmark_state_t *state = (aeron_client_benchmark_state_t *)clientd;
+
+    state->received_messages++;
+    state->received_bytes += length;
+
+    return AERON_ACTION_CONTINUE;
+}
+
+static void aeron_client_benchmark_block_counting_handler(
+    void *clientd, const uint8_t *buffer, size_t length, int32_t session_id, int32_t term_id)
+{
+    aeron_client_benchmark_state_t *state = (aeron_client_benchmark_state_t *)clientd;
+    size_t offset = 0;
+
+    while (offset < length)
+    {
+        const aeron_data_header_t *header = (const aeron_data_header_t *)(buffer + offset);
+        const int32_t frame_length = header->frame_header.frame_length;
+
+        if (frame_length <= 0)
+        {
+            break;
+        }
+
+        if (AERON_HDR_TYPE_DATA == header->frame_header.type)
+        {
+            state->received_messages++;
+            state->received_bytes += (uint64_t)frame_length - AERON_DATA_HEADER_LENGTH;
+        }
+
+        offset += AERON_ALIGN((size_t)frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    }
+}
+
+static void *aeron_client_benchmark_consumer(void *arg)
+{
+    aeron_client_benchmark_state_t *state = (aeron_client_benchmark_state_t *)arg;
+    bool running = true;
+
+    while (running)
+    {
+        aeron_image_poll(state->image, aeron_client_benchmark_null_handler, NULL, INT32_MAX);
+
+        AERON_GET_VOLATILE(running, state->peer_running);
+    }
+
+    return NULL;
+}
+
+static void *aeron_client_benchmark_producer(void *arg)
+{
+    aeron_client_benchmark_state_t *state = (aeron_client_benchmark_state_t *)arg;
+    bool running = true;
+
+    while (running)
+    {
+        aeron_exclusive_publication_offer(
+            state->exclusive_publication, state->message, state->message_length, NULL, NULL);
+
+        AERON_GET_VOLATILE(running, state->peer_running);
+    }
+
+    return NULL;
+}
+
+static int aeron_client_benchmark_check_offer_result(int64_t result)
+{
+    if (AERON_PUBLICATION_BACK_PRESSURED == result || AERON_PUBLICATION_ADMIN_ACTION == result)
+    {
+        return 0;
+    }
+
+    AERON_SET_ERR(EINVAL, "publication failed with result %" PRId64, result);
+    return -1;
+}
+
+static void aeron_client_benchmark_teardown(void *clientd)
+{
+    aeron_client_benchmark_state_t *state = (aeron_client_benchmark_state_t *)clientd;
+
+    if (NULL == state)
+    {
+        return;
+    }
+
+    if (state->peer_started)
+    {
+        AERON_PUT_ORDERED(state->peer_running, false);
+        aeron_thread_join(state->peer_thread, NULL);
+    }
+
+    if (NULL != state->image)
+    {
+        aeron_subscription_image_release(state->subscription, state->image);
+    }
+
+    aeron_image_fragment_assembler_delete(state->fragment_assembler);
+    aeron_subscription_close(state->subscription, NULL, NULL);
+    aeron_publication_close(state->publication, NULL, NULL);
+    aeron_exclusive_publication_close(state->exclusive_publication, NULL, NULL);
+
+    aeron_free(state->message);
+    aeron_free(state->block);
+    aeron_free(state);
+}
+
+static int aeron_client_benchmark_setup(
+    aeron_benchmark_context_t *context,
+    void **clientd,
+    bool exclusive,
+    aeron_client_benchmark_peer_t peer,
+    size_t message_length)
+{
+    aeron_client_benchmark_state_t *state = NULL;
+    aeron_async_add_subscription_t *async_add_subscription = NULL;
+    aeron_async_add_publication_t *async_add_publication = NULL;
+    aeron_async_add_exclusive_publication_t *async_add_exclusive_publication = NULL;
+
+    if (aeron_alloc((void **)&state, sizeof(aeron_client_benchmark_state_t)) < 0)
+    {
+        AERON_APPEND_ERR("%s", "unable to allocate benchmark state");
+        return -1;
+    }
+
+    *clientd = state;
+
+    if (aeron_async_add_subscription(
+        &async_add_subscription, context->aeron, context->channel, context->stream_id, NULL, NULL, NULL, NULL) < 0)
+    {
+        AERON_APPEND_ERR("%s", "");
+        goto error;
+    }
+
+    if (exclusive)
+    {
+        if (aeron_async_add_exclusive_publication(
+            &async_add_exclusive_publication, context->aeron, context->channel, context->stream_id) < 0)
+        {
+            AERON_APPEND_ERR("%s", "");
+            goto error;
+        }
+    }
+    else
+    {
+        if (aeron_async_add_publication(
+            &async_add_publication, context->aeron, context->channel, context->stream_id) < 0)
+        {
+            AERON_APPEND_ERR("%s", "");
+            goto error;
+        }
+    }
+
+    while (NULL == state->subscription)
+    {
+        if (aeron_async_add_subscription_poll(&state->subscription, async_add_subscription) < 0)
+        {
+            AERON_APPEND_ERR("%s", "");
+            goto error;
+        }
+
+        aeron_idle_strategy_yielding_idle(NULL, 0);
+    }
+
+    while (NULL == state->publication && NULL == state->exclusive_publication)
+    {
+        int result = exclusive ?
+            aeron_async_add_exclusive_publication_poll(
+                &state->exclusive_publication, async_add_exclusive_publication) :
+            aeron_async_add_publication_poll(&state->publication, async_add_publication);
+
+        if (result < 0)
+        {
+            AERON_APPEND_ERR("%s", "");
+            goto error;
+        }
+
+        aeron_idle_strategy_yielding_idle(NULL, 0);
+    }
+
+    while (!aeron_subscription_is_connected(state->subscription))
+    {
+        if (!aeron_benchmark_is_running())
+        {
+            AERON_SET_ERR(EINTR, "%s", "interrupted waiting for subscription to connect");
+            goto error;
+        }
+
+        aeron_idle_strategy_yielding_idle(NULL, 0);
+    }
+
+    if (NULL == (state->image = aeron_subscription_image_at_index(state->subscription, 0)))
+    {
+        AERON_SET_ERR(EINVAL, "%s", "could not find image");
+        goto error;
+    }
+
+    if ((exclusive ?
+        aeron_exclusive_publication_constants(state->exclusive_publication, &state->constants) :
+        aeron_publication_constants(state->publication, &state->constants)) < 0)
+    {
+        AERON_APPEND_ERR("%s", "");
+        goto error;
+    }
+
+    state->message_length = message_length;
+    state->frame_length = AERON_ALIGN(message_length + AERON_DATA_HEADER_LENGTH, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+
+    if (aeron_alloc((void **)&state->message, message_length) < 0)
+    {
+        AERON_APPEND_ERR("%s", "unable to allocate message");
+        goto error;
+    }
+
+    AERON_PUT_ORDERED(state->peer_running, true);
+    if (aeron_thread_create(
+        &state->peer_thread,
+        NULL,
+        AERON_CLIENT_BENCHMARK_PEER_PRODUCER == peer ?
+            aeron_client_benchmark_producer : aeron_client_benchmark_consumer,
+        state) != 0)
+    {
+        AERON_SET_ERR(errno, "%s", "unable to start peer thread");
+        goto error;
+    }
+    state->peer_started = true;
+
+    return 0;
+
+error:
+    aeron_client_benchmark_teardown(state);
+    *clientd = NULL;
+    return -1;
+}
+
+static int aeron_client_benchmark_publication_setup(aeron_benchmark_context_t *context, void **state)
+{
+    return aeron_client_benchmark_setup(
+        context, state, false, AERON_CLIENT_BENCHMARK_PEER_CONSUMER, context->message_length);
+}
+
+static int aeron_client_benchmark_exclusive_publication_setup(aeron_benchmark_context_t *context, void **state)
+{
+    if (aeron_client_benchmark_setup(
+        context, state, true, AERON_CLIENT_BENCHMARK_PEER_CONSUMER, context->message_length) < 0)
+    {
+        return -1;
+    }
+
+    aeron_client_benchmark_state_t *_state = (aeron_client_benchmark_state_t *)*state;
+    if (aeron_alloc((void **)&_state->block, _state->frame_length * AERON_BENCHMARK_BLOCK_MESSAGES) < 0)
+    {
+        AERON_APPEND_ERR("%s", "unable to allocate block");
+        aeron_client_benchmark_teardown(_state);
+        *state = NULL;
+        return -1;
+    }
+
+    return 0;
+}
+
+static int aeron_client_benchmark_image_setup(aeron_benchmark_context_t *context, void **state)
+{
+    return aeron_client_benchmark_setup(
+        context, state, true, AERON_CLIENT_BENCHMARK_PEER_PRODUCER, context->message_length);
+}
+
+static int aeron_client_benchmark_fragment_assembly_setup(aeron_benchmark_context_t *context, void **state)
+{
+    if (aeron_client_benchmark_setup(
+        context, state, true, AERON_CLIENT_BENCHMARK_PEER_PRODUCER, context->fragmented_message_length) < 0)
+    {
+        return -1;
+    }
+
+    aeron_client_benchmark_state_t *_state = (aeron_client_benchmark_state_t *)*state;
+    if (aeron_image_fragment_assembler_create(
+        &_state->fragment_assembler, aeron_client_benchmark_counting_handler, _state) < 0)
+    {
+        AERON_APPEND_ERR("%s", "");
+        aeron_client_benchmark_teardown(_state);
+        *state = NULL;
+        return -1;
+    }
+
+    return 0;
+}
+
+static int64_t aeron_client_benchmark_offer(void *clientd, uint64_t operations)
+{
+    aeron_client_benchmark_state_t *state = (aeron_client_benchmark_state_t *)clientd;
+
+    for (uint64_t i = 0; i < operations; i++)
+    {
+        int64_t result;
+        while ((result = aeron_publication_offer(
+            state->publication, state->message, state->message_length, NULL, NULL)) < 0)
+        {
+            if (aeron_client_benchmark_check_offer_result(result) < 0)
+            {
+                return -1;
+            }
+        }
+    }
+
+    return (int64_t)(operations * state->message_length);
+}
+
+static int64_t aeron_client_benchmark_try_claim(void *clientd, uint64_t operations)
+{
+    aeron_client_benchmark_state_t *state = (aeron_client_benchmark_state_t *)clientd;
+    aeron_buffer_claim_t buffer_claim;
+
+    for (uint64_t i = 0; i < operations; i++)
+    {
+        int64_t result;
+        while ((result = aeron_publication_try_claim(state->publication, state->message_length, &buffer_claim)) < 0)
+        {
+            if (aeron_client_benchmark_check_offer_result(result) < 0)
+            {
+                return -1;
+            }
+        }
+
+        memcpy(buffer_claim.data, state->message, state->message_length);
+        aeron_buffer_claim_commit(&buffer_claim);
+    }
+
+    return (int64_t)(operations * state->message_length);
+}
+
+/*
+ * Blocks must be formatted for the current position of the publication and may not cross a term boundary, so they
+ * are rebuilt for each offer. When less than a frame remains in the term it is filled by a single shorter message.
+ */
+static size_t aeron_client_benchmark_format_block(aeron_client_benchmark_state_t *state, uint64_t max_messages)
+{
+    const int64_t position = aeron_exclusive_publication_position(state->exclusive_publication);
+    const size_t term_length = state->constants.term_buffer_length;
+    const int32_t term_offset = (int32_t)(position & (int64_t)(term_length - 1));
+    const int32_t term_id = state->constants.initial_term_id +
+        (int32_t)(position >> state->constants.position_bits_to_shift);
+    const size_t remaining = term_length - (size_t)term_offset;
+
+    size_t messages = remaining / state->frame_length;
+    messages = messages < max_messages ? messages : (size_t)max_messages;
+    messages = messages < AERON_BENCHMARK_BLOCK_MESSAGES ? messages : AERON_BENCHMARK_BLOCK_MESSAGES;
+
+    const size_t frame_length = 0 == messages ? remaining : state->frame_length;
+    messages = 0 == messages ? 1 : messages;
+
+    for (size_t i = 0; i < messages; i++)
+    {
+        aeron_data_header_t *header = (aeron_data_header_t *)(state->block + (i * frame_length));
+
+        header->frame_header.frame_length = (int32_t)frame_length;
+        header->frame_header.version = AERON_FRAME_HEADER_VERSION;
+        header->frame_header.flags = AERON_DATA_HEADER_UNFRAGMENTED;
+        header->frame_header.type = AERON_HDR_TYPE_DATA;
+        header->term_offset = term_offset + (int32_t)(i * frame_length);
+        header->session_id = state->constants.session_id;
+        header->stream_id = state->constants.stream_id;
+        header->term_id = term_id;
+        header->reserved_value = 0;
+    }
+
+    return messages;
+}
+
+static int64_t aeron_client_benchmark_offer_block(void *clientd, uint64_t operations)
+{
+    aeron_client_benchmark_state_t *state = (aeron_client_benchmark_state_t *)clientd;
+    uint64_t messages_sent = 0;
+    int64_t bytes_sent = 0;
+
+    while (messages_sent < operations)
+    {
+        int64_t result;
+        size_t messages;
+
+        do
+        {
+            messages = aeron_client_benchmark_format_block(state, operations - messages_sent);
+            const aeron_data_header_t *first_frame = (const aeron_data_header_t *)state->block;
+            const size_t block_length = messages * (size_t)first_frame->frame_header.frame_length;
+
+            result = aeron_exclusive_publication_offer_block(state->exclusive_publication, state->block, block_length);
+            if (result > 0)
+            {
+                bytes_sent += (int64_t)(block_length - (messages * AERON_DATA_HEADER_LENGTH));
+            }
+            else if (aeron_client_benchmark_check_offer_result(result) < 0)
+            {
+                return -1;
+            }
+        }
+        while (result < 0);
+
+        messages_sent += messages;
+    }
+
+    return bytes_sent;
+}
+
+static int64_t aeron_client_benchmark_image_poll(void *clientd, uint64_t operations)
+{
+    aeron_client_benchmark_state_t *state = (aeron_client_benchmark_state_t *)clientd;
+
+    state->received_messages = 0;
+    state->received_bytes = 0;
+
+    while (state->received_messages < operations && aeron_benchmark_is_running())
+    {
+        if (aeron_image_poll(
+            state->image,
+            aeron_client_benchmark_counting_handler,
+            state,
+            (size_t)(operations - state->received_messages)) < 0)
+        {
+            AERON_APPEND_ERR("%s", "");
+            return -1;
+        }
+    }
+
+    return (int64_t)state->received_bytes;
+}
+
+static int64_t aeron_client_benchmark_image_controlled_poll(void *clientd, uint64_t operations)
+{
+    aeron_client_benchmark_state_t *state = (aeron_client_benchmark_state_t *)clientd;
+
+    state->received_messages = 0;
+    state->received_bytes = 0;
+
+    while (state->received_messages < operations && aeron_benchmark_is_running())
+    {
+        if (aeron_image_controlled_poll(
+            state->image,
+            aeron_client_benchmark_controlled_counting_handler,
+            state,
+            (size_t)(operations - state->received_messages)) < 0)
+        {
+            AERON_APPEND_ERR("%s", "");
+            return -1;
+        }
+    }
+
+    return (int64_t)state->received_bytes;
+}
+
+static int64_t aeron_client_benchmark_image_block_poll(void *clientd, uint64_t operations)
+{
+    aeron_client_benchmark_state_t *state = (aeron_client_benchmark_state_t *)clientd;
+
+    state->received_messages = 0;
+    state->received_bytes = 0;
+
+    while (state->received_messages < operations && aeron_benchmark_is_running())
+    {
+        const size_t block_length_limit = (size_t)(operations - state->received_messages) * state->frame_length;
+        if (aeron_image_block_poll(
+            state->image,
+            aeron_client_benchmark_block_counting_handler,
+            state,
+            block_length_limit < INT32_MAX ? block_length_limit : INT32_MAX) < 0)
+        {
+            AERON_APPEND_ERR("%s", "");
+            return -1;
+        }
+    }
+
+    return (int64_t)state->received_bytes;
+}
+
+static int64_t aeron_client_benchmark_fragment_assembly(void *clientd, uint64_t operations)
+{
+    aeron_client_benchmark_state_t *state = (aeron_client_benchmark_state_t *)clientd;
+
+    state->received_messages = 0;
+    state->received_bytes = 0;
+
+    while (state->received_messages < operations && aeron_benchmark_is_running())
+    {
+        if (aeron_image_poll(
+            state->image,
+            aeron_image_fragment_assembler_handler,
+            state->fragment_assembler,
+            AERON_BENCHMARK_FRAGMENT_LIMIT) < 0)
+        {
+            AERON_APPEND_ERR("%s", "");
+            return -1;
+        }
+    }
+
+    return (int64_t)state->received_bytes;
+}
+
+#define AERON_CLIENT_BENCHMARKS(prefix, transport) \
+{ prefix ".offer", transport, aeron_client_benchmark_publication_setup, aeron_client_benchmark_offer, aeron_client_benchmark_teardown }, \
+{ prefix ".tryClaim", transport, aeron_client_benchmark_publication_setup, aeron_client_benchmark_try_claim, aeron_client_benchmark_teardown }, \
+{ prefix ".offerBlock", transport, aeron_client_benchmark_exclusive_publication_setup, aeron_client_benchmark_offer_block, aeron_client_benchmark_teardown }, \
+{ prefix ".poll", transport, aeron_client_benchmark_image_setup, aeron_client_benchmark_image_poll, aeron_client_benchmark_teardown }, \
+{ prefix ".controlledPoll", transport, aeron_client_benchmark_image_setup, aeron_client_benchmark_image_controlled_poll, aeron_client_benchmark_teardown }, \
+{ prefix ".blockPoll", transport, aeron_client_benchmark_image_setup, aeron_client_benchmark_image_block_poll, aeron_client_benchmark_teardown }, \
+{ prefix ".fragmentAssembly", transport, aeron_client_benchmark_fragment_assembly_setup, aeron_client_benchmark_fragment_assembly, aeron_client_benchmark_teardown }
+
+const aeron_benchmark_t aeron_client_benchmarks[] =
+{
+    AERON_CLIENT_BENCHMARKS("ipc", AERON_BENCHMARK_TRANSPORT_IPC),
+    AERON_CLIENT_BENCHMARKS("udp", AERON_BENCHMARK_TRANSPORT_UDP)
+};
+
+const size_t aeron_client_benchmarks_length = sizeof(aeron_client_benchmarks) / sizeof(aeron_benchmark_t);
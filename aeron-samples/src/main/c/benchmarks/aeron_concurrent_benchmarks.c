@@ -0,0 +1,458 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <inttypes.h>
+
+#include "aeron_benchmarks.h"
+#include "aeron_alloc.h"
+#include "concurrent/aeron_atomic.h"
+#include "concurrent/aeron_thread.h"
+#include "concurrent/aeron_mpsc_rb.h"
+#include "concurrent/aeron_spsc_rb.h"
+#include "concurrent/aeron_broadcast_transmitter.h"
+#include "concurrent/aeron_broadcast_receiver.h"
+#include "concurrent/aeron_term_scanner.h"
+#include "concurrent/aeron_term_gap_scanner.h"
+#include "util/aeron_error.h"
+
+#define AERON_BENCHMARK_BUFFER_CAPACITY (1024 * 1024)
+#define AERON_BENCHMARK_MSG_TYPE_ID (1)
+#define AERON_BENCHMARK_READ_LIMIT (100)
+#define AERON_BENCHMARK_TERM_LENGTH (64 * 1024)
+#define AERON_BENCHMARK_MTU_LENGTH (1408)
+
+typedef enum aeron_concurrent_benchmark_type_en
+{
+    AERON_CONCURRENT_BENCHMARK_MPSC_RB,
+    AERON_CONCURRENT_BENCHMARK_SPSC_RB,
+    AERON_CONCURRENT_BENCHMARK_BROADCAST
+}
+aeron_concurrent_benchmark_type_t;
+
+typedef struct aeron_concurrent_benchmark_state_stct
+{
+    aeron_concurrent_benchmark_type_t type;
+    aeron_mpsc_rb_t mpsc_rb;
+    aeron_spsc_rb_t spsc_rb;
+    aeron_broadcast_transmitter_t transmitter;
+    aeron_broadcast_receiver_t receiver;
+    uint8_t *buffer;
+    uint8_t *message;
+    size_t message_length;
+
+    aeron_thread_t consumer_thread;
+    bool consumer_started;
+    volatile bool consumer_running;
+}
+aeron_concurrent_benchmark_state_t;
+
+static void aeron_concurrent_benchmark_rb_handler(int32_t msg_type_id, const void *buffer, size_t length, void *clientd)
+{
+}
+
+static void aeron_concurrent_benchmark_broadcast_handler(
+    int32_t type_id, uint8_t *buffer, size_t length, void *clientd)
+{
+}
+
+static void *aeron_concurrent_benchmark_consumer(void *arg)
+{
+    aeron_concurrent_benchmark_state_t *state = (aeron_concurrent_benchmark_state_t *)arg;
+    bool running = true;
+
+    while (running)
+    {
+        switch (state->type)
+        {
+            case AERON_CONCURRENT_BENCHMARK_MPSC_RB:
+                aeron_mpsc_rb_read(
+                    &state->mpsc_rb, aeron_concurrent_benchmark_rb_handler, NULL, AERON_BENCHMARK_READ_LIMIT);
+                break;
+
+            case AERON_CONCURRENT_BENCHMARK_SPSC_RB:
+                aeron_spsc_rb_read(
+                    &state->spsc_rb, aeron_concurrent_benchmark_rb_handler, NULL, AERON_BENCHMARK_READ_LIMIT);
+                break;
+
+            case AERON_CONCURRENT_BENCHMARK_BROADCAST:
+                // a lapped receiver reports an error and then carries on from the latest record.
+                aeron_broadcast_receiver_receive(&state->receiver, aeron_concurrent_benchmark_broadcast_handler, NULL);
+                break;
+        }
+
+        AERON_GET_VOLATILE(running, state->consumer_running);
+    }
+
+    return NULL;
+}
+
+static void aeron_concurrent_benchmark_teardown(void *clientd)
+{
+    aeron_concurrent_benchmark_state_t *state = (aeron_concurrent_benchmark_state_t *)clientd;
+
+    if (NULL == state)
+    {
+        return;
+    }
+
+    if (state->consumer_started)
+    {
+        AERON_PUT_ORDERED(state->consumer_running, false);
+        aeron_thread_join(state->consumer_thread, NULL);
+    }
+
+    aeron_free(state->buffer);
+    aeron_free(state->message);
+    aeron_free(state);
+}
+
+static int aeron_concurrent_benchmark_setup(
+    aeron_benchmark_context_t *context, void **clientd, aeron_concurrent_benchmark_type_t type)
+{
+    aeron_concurrent_benchmark_state_t *state = NULL;
+    const size_t trailer_length = AERON_CONCURRENT_BENCHMARK_BROADCAST == type ?
+        AERON_BROADCAST_BUFFER_TRAILER_LENGTH : AERON_RB_TRAILER_LENGTH;
+    const size_t buffer_length = AERON_BENCHMARK_BUFFER_CAPACITY + trailer_length;
+
+    if (aeron_alloc((void **)&state, sizeof(aeron_concurrent_benchmark_state_t)) < 0)
+    {
+        AERON_APPEND_ERR("%s", "unable to allocate benchmark state");
+        return -1;
+    }
+
+    *clientd = state;
+    state->type = type;
+    state->message_length = context->message_length;
+
+    if (aeron_alloc((void **)&state->buffer, buffer_length) < 0 ||
+        aeron_alloc((void **)&state->message, state->message_length) < 0)
+    {
+        AERON_APPEND_ERR("%s", "unable to allocate buffer");
+        goto error;
+    }
+
+    int result = 0;
+    switch (type)
+    {
+        case AERON_CONCURRENT_BENCHMARK_MPSC_RB:
+            result = aeron_mpsc_rb_init(&state->mpsc_rb, state->buffer, buffer_length);
+            break;
+
+        case AERON_CONCURRENT_BENCHMARK_SPSC_RB:
+            result = aeron_spsc_rb_init(&state->spsc_rb, state->buffer, buffer_length);
+            break;
+
+        case AERON_CONCURRENT_BENCHMARK_BROADCAST:
+            result = aeron_broadcast_transmitter_init(&state->transmitter, state->buffer, buffer_length);
+            if (result >= 0)
+            {
+                result = aeron_broadcast_receiver_init(&state->receiver, state->buffer, buffer_length);
+            }
+            break;
+    }
+
+    if (result < 0)
+    {
+        AERON_APPEND_ERR("%s", "");
+        goto error;
+    }
+
+    AERON_PUT_ORDERED(state->consumer_running, true);
+    if (aeron_thread_create(&state->consumer_thread, NULL, aeron_concurrent_benchmark_consumer, state) != 0)
+    {
+        AERON_SET_ERR(errno, "%s", "unable to start consumer thread");
+        goto error;
+    }
+    state->consumer_started = true;
+
+    return 0;
+
+error:
+    aeron_concurrent_benchmark_teardown(state);
+    *clientd = NULL;
+    return -1;
+}
+
+static int aeron_concurrent_benchmark_mpsc_rb_setup(aeron_benchmark_context_t *context, void **state)
+{
+    return aeron_concurrent_benchmark_setup(context, state, AERON_CONCURRENT_BENCHMARK_MPSC_RB);
+}
+
+static int aeron_concurrent_benchmark_spsc_rb_setup(aeron_benchmark_context_t *context, void **state)
+{
+    return aeron_concurrent_benchmark_setup(context, state, AERON_CONCURRENT_BENCHMARK_SPSC_RB);
+}
+
+static int aeron_concurrent_benchmark_broadcast_setup(aeron_benchmark_context_t *context, void **state)
+{
+    return aeron_concurrent_benchmark_setup(context, state, AERON_CONCURRENT_BENCHMARK_BROADCAST);
+}
+
+static int64_t aeron_concurrent_benchmark_mpsc_rb_write(void *clientd, uint64_t operations)
+{
+    aeron_concurrent_benchmark_state_t *state = (aeron_concurrent_benchmark_state_t *)clientd;
+
+    for (uint64_t i = 0; i < operations; i++)
+    {
+        aeron_rb_write_result_t result;
+        while (AERON_RB_SUCCESS != (result = aeron_mpsc_rb_write(
+            &state->mpsc_rb, AERON_BENCHMARK_MSG_TYPE_ID, state->message, state->message_length)))
+        {
+            if (AERON_RB_FULL != result)
+            {
+                AERON_SET_ERR(EINVAL, "mpsc ring buffer write failed with result %d", result);
+                return -1;
+            }
+        }
+    }
+
+    return (int64_t)(operations * state->message_length);
+}
+
+static int64_t aeron_concurrent_benchmark_spsc_rb_write(void *clientd, uint64_t operations)
+{
+    aeron_concurrent_benchmark_state_t *state = (aeron_concurrent_benchmark_state_t *)clientd;
+
+    for (uint64_t i = 0; i < operations; i++)
+    {
+        aeron_rb_write_result_t result;
+        while (AERON_RB_SUCCESS != (result = aeron_spsc_rb_write(
+            &state->spsc_rb, AERON_BENCHMARK_MSG_TYPE_ID, state->message, state->message_length)))
+        {
+            if (AERON_RB_FULL != result)
+            {
+                AERON_SET_ERR(EINVAL, "spsc ring buffer write failed with result %d", result);
+                return -1;
+            }
+        }
+    }
+
+    return (int64_t)(operations * state->message_length);
+}
+
+static int64_t aeron_concurrent_benchmark_broadcast_transmit(void *clientd, uint64_t operations)
+{
+    aeron_concurrent_benchmark_state_t *state = (aeron_concurrent_benchmark_state_t *)clientd;
+
+    for (uint64_t i = 0; i < operations; i++)
+    {
+        if (aeron_broadcast_transmitter_transmit(
+            &state->transmitter, AERON_BENCHMARK_MSG_TYPE_ID, state->message, state->message_length) < 0)
+        {
+            AERON_APPEND_ERR("%s", "");
+            return -1;
+        }
+    }
+
+    return (int64_t)(operations * state->message_length);
+}
+
+typedef struct aeron_term_scanner_benchmark_state_stct
+{
+    uint8_t *term;
+    int32_t frames_length;
+    int32_t gap_length;
+    int32_t offset;
+}
+aeron_term_scanner_benchmark_state_t;
+
+static void aeron_term_scanner_benchmark_teardown(void *clientd)
+{
+    aeron_term_scanner_benchmark_state_t *state = (aeron_term_scanner_benchmark_state_t *)clientd;
+
+    if (NULL == state)
+    {
+        return;
+    }
+
+    aeron_term_scanner_simd_select(NULL);
+    aeron_free(state->term);
+    aeron_free(state);
+}
+
+/*
+ * A term of message length frames, ending in a gap of a quarter of the term before the last frame, scanned with the
+ * named implementation so the vectorised and scalar scanners can be compared.
+ */
+static int aeron_term_scanner_benchmark_setup(aeron_benchmark_context_t *context, void **clientd, const char *simd)
+{
+    aeron_term_scanner_benchmark_state_t *state = NULL;
+    const int32_t frame_length = (int32_t)(AERON_DATA_HEADER_LENGTH + context->message_length);
+    const int32_t aligned_frame_length = AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+
+    if (aligned_frame_length > AERON_BENCHMARK_MTU_LENGTH)
+    {
+        AERON_SET_ERR(EINVAL, "message length must fit in an MTU of %d", AERON_BENCHMARK_MTU_LENGTH);
+        return -1;
+    }
+
+    if (aeron_term_scanner_simd_select(simd) < 0)
+    {
+        AERON_APPEND_ERR("%s", "");
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&state, sizeof(aeron_term_scanner_benchmark_state_t)) < 0 ||
+        aeron_alloc((void **)&state->term, AERON_BENCHMARK_TERM_LENGTH) < 0)
+    {
+        AERON_APPEND_ERR("%s", "unable to allocate benchmark term");
+        aeron_term_scanner_benchmark_teardown(state);
+        return -1;
+    }
+
+    const int32_t gap_offset = ((AERON_BENCHMARK_TERM_LENGTH * 3) / 4 / aligned_frame_length) * aligned_frame_length;
+    const int32_t last_frame_offset = AERON_BENCHMARK_TERM_LENGTH - aligned_frame_length;
+    for (int32_t offset = 0; offset < gap_offset; offset += aligned_frame_length)
+    {
+        aeron_frame_header_t *frame_header = (aeron_frame_header_t *)(state->term + offset);
+        frame_header->frame_length = frame_length;
+        frame_header->type = AERON_HDR_TYPE_DATA;
+    }
+
+    aeron_frame_header_t *last_frame_header = (aeron_frame_header_t *)(state->term + last_frame_offset);
+    last_frame_header->frame_length = frame_length;
+    last_frame_header->type = AERON_HDR_TYPE_DATA;
+
+    state->frames_length = gap_offset;
+    state->gap_length = last_frame_offset - gap_offset;
+    state->offset = 0;
+    *clientd = state;
+
+    return 0;
+}
+
+static int aeron_term_scanner_benchmark_simd_setup(aeron_benchmark_context_t *context, void **state)
+{
+    return aeron_term_scanner_benchmark_setup(context, state, NULL);
+}
+
+static int aeron_term_scanner_benchmark_scalar_setup(aeron_benchmark_context_t *context, void **state)
+{
+    return aeron_term_scanner_benchmark_setup(context, state, "scalar");
+}
+
+static int64_t aeron_term_scanner_benchmark_scan_for_availability(void *clientd, uint64_t operations)
+{
+    aeron_term_scanner_benchmark_state_t *state = (aeron_term_scanner_benchmark_state_t *)clientd;
+    int64_t bytes = 0;
+
+    for (uint64_t i = 0; i < operations; i++)
+    {
+        int32_t padding;
+        int32_t available = aeron_term_scanner_scan_for_availability(
+            state->term + state->offset,
+            state->frames_length - state->offset,
+            AERON_BENCHMARK_MTU_LENGTH,
+            &padding);
+
+        state->offset += available;
+        if (available <= 0 || state->offset >= state->frames_length)
+        {
+            state->offset = 0;
+        }
+
+        bytes += available;
+    }
+
+    return bytes;
+}
+
+static void aeron_term_scanner_benchmark_on_gap(void *clientd, int32_t term_id, int32_t term_offset, size_t length)
+{
+    *(int32_t *)clientd = (int32_t)length;
+}
+
+static int64_t aeron_term_scanner_benchmark_scan_for_gap(void *clientd, uint64_t operations)
+{
+    aeron_term_scanner_benchmark_state_t *state = (aeron_term_scanner_benchmark_state_t *)clientd;
+
+    for (uint64_t i = 0; i < operations; i++)
+    {
+        int32_t gap_length = 0;
+        aeron_term_gap_scanner_scan_for_gap(
+            state->term, 0, 0, AERON_BENCHMARK_TERM_LENGTH, aeron_term_scanner_benchmark_on_gap, &gap_length);
+
+        if (gap_length != state->gap_length)
+        {
+            AERON_SET_ERR(EINVAL, "gap length %d, expected %d", gap_length, state->gap_length);
+            return -1;
+        }
+    }
+
+    return (int64_t)(operations * AERON_BENCHMARK_TERM_LENGTH);
+}
+
+const aeron_benchmark_t aeron_concurrent_benchmarks[] =
+{
+    {
+        "concurrent.mpscRingBuffer",
+        AERON_BENCHMARK_TRANSPORT_NONE,
+        aeron_concurrent_benchmark_mpsc_rb_setup,
+        aeron_concurrent_benchmark_mpsc_rb_write,
+        aeron_concurrent_benchmark_teardown
+    },
+    {
+        "concurrent.spscRingBuffer",
+        AERON_BENCHMARK_TRANSPORT_NONE,
+        aeron_concurrent_benchmark_spsc_rb_setup,
+        aeron_concurrent_benchmark_spsc_rb_write,
+        aeron_concurrent_benchmark_teardown
+    },
+    {
+        "concurrent.broadcast",
+        AERON_BENCHMARK_TRANSPORT_NONE,
+        aeron_concurrent_benchmark_broadcast_setup,
+        aeron_concurrent_benchmark_broadcast_transmit,
+        aeron_concurrent_benchmark_teardown
+    },
+    {
+        "concurrent.termScanner",
+        AERON_BENCHMARK_TRANSPORT_NONE,
+        aeron_term_scanner_benchmark_simd_setup,
+        aeron_term_scanner_benchmark_scan_for_availability,
+        aeron_term_scanner_benchmark_teardown
+    },
+    {
+        "concurrent.termScannerScalar",
+        AERON_BENCHMARK_TRANSPORT_NONE,
+        aeron_term_scanner_benchmark_scalar_setup,
+        aeron_term_scanner_benchmark_scan_for_availability,
+        aeron_term_scanner_benchmark_teardown
+    },
+    {
+        "concurrent.termGapScanner",
+        AERON_BENCHMARK_TRANSPORT_NONE,
+        aeron_term_scanner_benchmark_simd_setup,
+        aeron_term_scanner_benchmark_scan_for_gap,
+        aeron_term_scanner_benchmark_teardown
+    },
+    {
+        "concurrent.termGapScannerScalar",
+        AERON_BENCHMARK_TRANSPORT_NONE,
+        aeron_term_scanner_benchmark_scalar_setup,
+        aeron_term_scanner_benchmark_scan_for_gap,
+        aeron_term_scanner_benchmark_teardown
+    }
+};
+
+const size_t aeron_concurrent_benchmarks_length =
+    sizeof(aeron_concurrent_benchmarks) / sizeof(aeron_benchmark_t);
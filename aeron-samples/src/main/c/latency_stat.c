@@ -0,0 +1,154 @@
+/*
+ * Copyright 2014-2024 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include <errno.h>
+
+#ifndef _MSC_VER
+#include <unistd.h>
+#include <getopt.h>
+#endif
+
+#include "aeronc.h"
+#include "aeron_common.h"
+#include "util/aeron_strutil.h"
+
+static const char *aeron_latency_stat_usage(void)
+{
+    return
+        "    -h            Displays help information.\n"
+        "    -d basePath   Base Path to shared memory. Default: /dev/shm/aeron-[user]\n"
+        "    -t timeout    Number of milliseconds to wait to see if the driver metadata is available. Default: 1000\n";
+}
+
+static void aeron_latency_stat_print_error_and_usage(const char *message)
+{
+    fprintf(stderr, "%s\n%s", message, aeron_latency_stat_usage());
+}
+
+typedef struct aeron_latency_stat_settings_stct
+{
+    const char *base_path;
+    int64_t timeout_ms;
+}
+aeron_latency_stat_settings_t;
+
+static void aeron_latency_stat_print_entry(
+    void *clientd,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    int32_t hop,
+    const char *channel,
+    int32_t channel_length,
+    int64_t sample_count,
+    int64_t total_ns,
+    int64_t max_ns,
+    const int64_t *buckets,
+    size_t bucket_count)
+{
+    printf(
+        "%" PRId64 ",%" PRId32 ",%" PRId32 ",%s,%" PRId64 ",%" PRId64 ",%" PRId64 ",%" PRId64 ",%" PRId64 ",%" PRId64
+        ",%" PRId64 ",%.*s\n",
+        registration_id,
+        session_id,
+        stream_id,
+        aeron_latency_report_hop_name(hop),
+        sample_count,
+        0 == sample_count ? 0 : total_ns / sample_count,
+        aeron_latency_report_value_at_percentile(buckets, bucket_count, 50.0),
+        aeron_latency_report_value_at_percentile(buckets, bucket_count, 90.0),
+        aeron_latency_report_value_at_percentile(buckets, bucket_count, 99.0),
+        aeron_latency_report_value_at_percentile(buckets, bucket_count, 99.9),
+        max_ns,
+        (int)channel_length,
+        channel);
+}
+
+int main(int argc, char **argv)
+{
+    char default_directory[AERON_MAX_PATH];
+    aeron_default_path(default_directory, AERON_MAX_PATH);
+    aeron_latency_stat_settings_t settings =
+        {
+            .base_path = default_directory,
+            .timeout_ms = 1000
+        };
+
+    int opt;
+
+    while ((opt = getopt(argc, argv, "d:t:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 'd':
+                settings.base_path = optarg;
+                break;
+
+            case 't':
+            {
+                errno = 0;
+                char *endptr;
+                settings.timeout_ms = strtoll(optarg, &endptr, 10);
+                if (0 != errno || '\0' != endptr[0])
+                {
+                    aeron_latency_stat_print_error_and_usage("Invalid timeout");
+                    return EXIT_FAILURE;
+                }
+                break;
+            }
+
+            case 'h':
+                aeron_latency_stat_print_error_and_usage(argv[0]);
+                return EXIT_SUCCESS;
+
+            default:
+                aeron_latency_stat_print_error_and_usage("Unknown option");
+                return EXIT_FAILURE;
+        }
+    }
+
+    aeron_cnc_t *aeron_cnc = NULL;
+
+    if (aeron_cnc_init(&aeron_cnc, settings.base_path, settings.timeout_ms) < 0)
+    {
+        aeron_latency_stat_print_error_and_usage(aeron_errmsg());
+        return EXIT_FAILURE;
+    }
+
+    int exit_result = EXIT_FAILURE;
+    printf(
+        "%s\n",
+        "REGISTRATION_ID, SESSION_ID, STREAM_ID, HOP, SAMPLE_COUNT, MEAN_NS,"
+        "P50_NS, P90_NS, P99_NS, P99.9_NS, MAX_NS, CHANNEL");
+    int entries_read = aeron_cnc_latency_reporter_read(aeron_cnc, aeron_latency_stat_print_entry, NULL);
+
+    if (entries_read < 0)
+    {
+        printf("%s\n", aeron_errmsg());
+    }
+    else
+    {
+        printf("%d entries read\n", entries_read);
+        exit_result = EXIT_SUCCESS;
+    }
+
+    aeron_cnc_close(aeron_cnc);
+
+    return exit_result;
+}